@@ -1862,8 +1862,8 @@ ae_int16 _ae_int16_bias = ZERO16; \
 #endif /* (ROW_UNROLL == 4 && VEC_UNROLL == 2)*/
 
 #define AE_SW_PRIME_64(p_char, tmp) \
-    WORD8 *p_char_align_##p_char =  (WORD8 *)((unsigned int)p_char & ~0x7); \
-    int sel_idx_##p_char = (unsigned int)p_char - (unsigned int)p_char_align_##p_char; \
+    WORD8 *p_char_align_##p_char =  (WORD8 *)p_char - ((uintptr_t)p_char & 0x7); \
+    int sel_idx_##p_char = (uintptr_t)p_char & 0x7; \
     ae_int8x8 sel_##p_char = AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(g_sel_pattern[2 * sel_idx_##p_char], g_sel_pattern[2 * sel_idx_##p_char + 1])); \
     AE_L8X8_IP(tmp, (ae_int8x8 *)p_char_align_##p_char, 8); 
 
@@ -1875,8 +1875,8 @@ ae_int16 _ae_int16_bias = ZERO16; \
 
 // Circular buffer size needs to be multiple of 8 
 #define AE_SW_PRIME_CIRC_64(p_char, tmp) \
-    WORD8 *p_char_align_##p_char =  (WORD8 *)((unsigned int)p_char & ~0x7); \
-    int sel_idx_##p_char = (unsigned int)p_char - (unsigned int)p_char_align_##p_char; \
+    WORD8 *p_char_align_##p_char =  (WORD8 *)p_char - ((uintptr_t)p_char & 0x7); \
+    int sel_idx_##p_char = (uintptr_t)p_char & 0x7; \
     ae_int8x8 sel_##p_char = AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(g_sel_pattern[2 * sel_idx_##p_char], g_sel_pattern[2 * sel_idx_##p_char + 1])); \
     AE_L8X8_XC(tmp, (ae_int8x8 *)p_char_align_##p_char, 8); 
         
@@ -1985,6 +1985,6 @@ ae_int16 _ae_int16_bias = ZERO16; \
      }
  
 /* Alignment checking */
-#define ALIGNED_PTR(ptr, alignment) ((((unsigned int)ptr & (alignment - 1))) == 0)
+#define ALIGNED_PTR(ptr, alignment) ((((uintptr_t)ptr & (alignment - 1))) == 0)
 
 #endif /* __XA_NNLIB_COMMON_MACROS_H__ */
@@ -35,7 +35,7 @@ do {                                                                    \
 
 #define XA_NNLIB_ARG_CHK_ALIGN(_ptr, _align, _err)                      \
 do {                                                                    \
-  if(((unsigned int)(_ptr) & ((_align) - 1)) != 0) return (_err);       \
+  if(((uintptr_t)(_ptr) & ((_align) - 1)) != 0) return (_err);          \
 } while(0)
 
 #define XA_NNLIB_ARG_CHK_COND(_cond, _err)                              \
@@ -58,7 +58,7 @@ do {                                                                    \
 
 #define XA_NNLIB_CHK_ALIGN(_ptr, _align, _err)                          \
 do {                                                                    \
-  if(((unsigned int)(_ptr) & ((_align) - 1)) != 0) return (_err);       \
+  if(((uintptr_t)(_ptr) & ((_align) - 1)) != 0) return (_err);          \
 } while(0)
 
 #define XA_NNLIB_CHK_COND(_cond, _err)                                  \
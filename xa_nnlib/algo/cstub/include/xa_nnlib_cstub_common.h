@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host emulation: processor state, saturation/rounding helpers and the
+ * pointer-update plumbing shared by the intrinsic emulation headers.
+ */
+#ifndef __XA_NNLIB_CSTUB_COMMON_H__
+#define __XA_NNLIB_CSTUB_COMMON_H__
+
+#include <assert.h>
+#include "xa_nnlib_cstub_types.h"
+
+/* Processor state. Every thread emulates its own core. */
+extern "C" {
+extern __thread void *xa_nnlib_cstub_cbegin0;   /* AE_CBEGIN0 */
+extern __thread void *xa_nnlib_cstub_cend0;     /* AE_CEND0 */
+extern __thread int xa_nnlib_cstub_sar;         /* AE_SAR */
+extern __thread int xa_nnlib_cstub_biasv8;      /* AE_BIASV8 */
+extern __thread int xa_nnlib_cstub_biasc8;      /* AE_BIASC8 */
+extern __thread unsigned xa_nnlib_cstub_fsr;    /* FSR */
+}
+
+extern "C++" {
+
+/*
+ * The updating load/store intrinsics (_IP, _XP, _IC, _XC ...) modify their
+ * pointer argument, which the kernels frequently pass through a cast, e.g.
+ * AE_L16_IP(x, (ae_int16 *)p_v, 2). CSTUB_LV() strips up to two leading
+ * casts so that the underlying pointer variable can be bound to a reference:
+ *   p              ->  p
+ *   (T *)p         ->  p
+ *   (T *)(U *)p    ->  p
+ *   (p)            ->  (p)    (castxcc() expands to this on the host)
+ */
+#define CSTUB_CAT(a, b)             CSTUB_CAT_(a, b)
+#define CSTUB_CAT_(a, b)            a##b
+#define CSTUB_EAT(...)
+#define CSTUB_PROBE(...)            ~, 1,
+#define CSTUB_SECOND(a, b, ...)     b
+#define CSTUB_SECOND_(...)          CSTUB_SECOND(__VA_ARGS__)
+#define CSTUB_IS_PAREN(x)           CSTUB_SECOND_(CSTUB_PROBE x, 0, 0)
+#define CSTUB_EMPTY(...)            CSTUB_EMPTY_ ## __VA_OPT__(0)
+#define CSTUB_EMPTY_                1
+#define CSTUB_EMPTY_0               0
+#define CSTUB_LV(x)                 CSTUB_LV1(CSTUB_LV1(x))
+#define CSTUB_LV1(x)                CSTUB_CAT(CSTUB_LV_, CSTUB_IS_PAREN(x))(x)
+#define CSTUB_LV_0(x)               x
+#define CSTUB_LV_1(x)               CSTUB_LV_1_(x, CSTUB_EAT x)
+#define CSTUB_LV_1_(x, ...)         CSTUB_CAT(CSTUB_LVE_, CSTUB_EMPTY(__VA_ARGS__))(x, __VA_ARGS__)
+#define CSTUB_LVE_1(x, ...)         x
+#define CSTUB_LVE_0(x, ...)         __VA_ARGS__
+
+/* Byte address arithmetic on a pointer of any type */
+template <class P> static inline P *cstub_addr(P *p, int inc)
+{
+  return (P *)((const char *)p + inc);
+}
+
+/* Circular addressing in [AE_CBEGIN0, AE_CEND0) */
+static inline const char *cstub_circ_wrap(const char *p)
+{
+  const char *b = (const char *)xa_nnlib_cstub_cbegin0;
+  const char *e = (const char *)xa_nnlib_cstub_cend0;
+  long len = (long)(e - b);
+  if(len <= 0)
+    return p;
+  if(p >= e)
+    p -= ((p - e) / len + 1) * len;
+  else if(p < b)
+    p += ((b - p + len - 1) / len) * len;
+  return p;
+}
+
+template <class P> static inline P *cstub_circ_addr(P *p, int inc)
+{
+  return (P *)cstub_circ_wrap((const char *)p + inc);
+}
+
+/* Memory access in the byte order of a little-endian core */
+static inline void cstub_rd(void *dst, const void *src, int n)
+{
+  memcpy(dst, src, n);
+}
+
+static inline void cstub_wr(void *dst, const void *src, int n)
+{
+  memcpy(dst, src, n);
+}
+
+/* Circular buffer reads/writes that may straddle AE_CEND0 */
+static inline void cstub_rd_circ(void *dst, const void *src, int n)
+{
+  for(int i = 0; i < n; i++)
+    ((char *)dst)[i] = *cstub_circ_wrap((const char *)src + i);
+}
+
+static inline void cstub_wr_circ(void *dst, const void *src, int n)
+{
+  for(int i = 0; i < n; i++)
+    *(char *)cstub_circ_wrap((const char *)dst + i) = ((const char *)src)[i];
+}
+
+/* Saturation */
+static inline int64_t cstub_sat(int64_t x, int bits)
+{
+  int64_t mx = (int64_t)((((uint64_t)1) << (bits - 1)) - 1);
+  int64_t mn = -mx - 1;
+  return x > mx ? mx : (x < mn ? mn : x);
+}
+
+static inline int64_t cstub_satu(int64_t x, int bits)
+{
+  int64_t mx = (int64_t)((((uint64_t)1) << bits) - 1);
+  return x > mx ? mx : (x < 0 ? 0 : x);
+}
+
+static inline int32_t cstub_sat32(int64_t x) { return (int32_t)cstub_sat(x, 32); }
+static inline int16_t cstub_sat16(int64_t x) { return (int16_t)cstub_sat(x, 16); }
+static inline int8_t  cstub_sat8(int64_t x)  { return (int8_t)cstub_sat(x, 8); }
+
+static inline int64_t cstub_sat64(__int128 x)
+{
+  if(x > (__int128)INT64_MAX) return INT64_MAX;
+  if(x < (__int128)INT64_MIN) return INT64_MIN;
+  return (int64_t)x;
+}
+
+/* Arithmetic right shift (s >= 0) of a 128-bit intermediate */
+static inline __int128 cstub_sra(__int128 x, int s)
+{
+  if(s > 126) s = 126;
+  return x >> s;
+}
+
+/* Right shift with round-half-up (asymmetric) rounding */
+static inline __int128 cstub_sra_rnd(__int128 x, int s)
+{
+  if(s <= 0) return x;
+  if(s > 126) s = 126;
+  return (x + ((__int128)1 << (s - 1))) >> s;
+}
+
+/* Right shift with round-half-away-from-zero (symmetric) rounding */
+static inline __int128 cstub_sra_sym(__int128 x, int s)
+{
+  if(s <= 0) return x;
+  if(s > 126) s = 126;
+  __int128 h = (__int128)1 << (s - 1);
+  return x < 0 ? -((-x + h) >> s) : (x + h) >> s;
+}
+
+/* Left shift (s >= 0) of a value that fits in 64 bits */
+static inline __int128 cstub_sla(int64_t x, int s)
+{
+  if(s > 64) s = 64;
+  return (__int128)x * ((__int128)1 << s);
+}
+
+/* Signed shift: s > 0 is left, s < 0 is arithmetic right */
+static inline int64_t cstub_shift_sat(int64_t x, int s, int bits)
+{
+  if(s >= 0)
+    return cstub_sat(cstub_sat64(cstub_sla(x, s)), bits);
+  return (int64_t)cstub_sra(x, -s);
+}
+
+static inline int64_t cstub_shift_wrap(int64_t x, int s)
+{
+  if(s >= 0)
+    return s > 63 ? 0 : (int64_t)((uint64_t)x << s);
+  return s < -63 ? (x < 0 ? -1 : 0) : x >> -s;
+}
+
+} /* extern "C++" */
+
+#endif /* __XA_NNLIB_CSTUB_COMMON_H__ */
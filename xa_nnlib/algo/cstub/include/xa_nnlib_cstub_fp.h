@@ -0,0 +1,319 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host emulation of the single precision FPU (scalar and SX2 vector) and
+ * of the core integer helpers exposed through <xtensa/tie/xt_core.h>.
+ * The fused multiply-add forms map to fmaf() so that they round once, as
+ * on the core; the reciprocal/square root seeds return the exact result.
+ */
+#ifndef __XA_NNLIB_CSTUB_FP_H__
+#define __XA_NNLIB_CSTUB_FP_H__
+
+#include <math.h>
+#include "xa_nnlib_cstub_ops.h"
+
+extern "C++" {
+
+/*---------------------------------------------------------------------------
+ * Core integer operations
+ *-------------------------------------------------------------------------*/
+static inline int XT_ADD(int a, int b) { return (int)((unsigned)a + (unsigned)b); }
+static inline int XT_SUB(int a, int b) { return (int)((unsigned)a - (unsigned)b); }
+static inline int XT_MAX(int a, int b) { return a > b ? a : b; }
+static inline int XT_MIN(int a, int b) { return a < b ? a : b; }
+static inline int XT_SLLI(int a, int s) { return (int)((unsigned)a << s); }
+static inline int XT_SRAI(int a, int s) { return a >> s; }
+static inline unsigned XT_SRLI(unsigned a, int s) { return a >> s; }
+static inline int XT_NSA(int a) { return __builtin_clrsb(a); }
+
+/*---------------------------------------------------------------------------
+ * Vector float operators
+ *-------------------------------------------------------------------------*/
+#define CSTUB_FMAP2(a, b, expr)                                               \
+  xtfloatx2 r;                                                                \
+  for(int k = 0; k < 2; k++)                                                  \
+  {                                                                           \
+    float x = (a).v[k], y = (b).v[k];                                         \
+    (void)y;                                                                  \
+    r.v[k] = (expr);                                                          \
+  }                                                                           \
+  return r;
+
+static inline xtfloatx2 operator+(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, x + y) }
+static inline xtfloatx2 operator-(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, x - y) }
+static inline xtfloatx2 operator*(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, x * y) }
+static inline xtfloatx2 operator/(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, x / y) }
+static inline xtfloatx2 operator-(const xtfloatx2 &a) { CSTUB_FMAP2(a, a, -x) }
+/* Mixed with a scalar, which is replicated, as on the core */
+static inline xtfloatx2 operator+(const xtfloatx2 &a, xtfloat b) { return a + xtfloatx2(b); }
+static inline xtfloatx2 operator-(const xtfloatx2 &a, xtfloat b) { return a - xtfloatx2(b); }
+static inline xtfloatx2 operator*(const xtfloatx2 &a, xtfloat b) { return a * xtfloatx2(b); }
+static inline xtfloatx2 operator/(const xtfloatx2 &a, xtfloat b) { return a / xtfloatx2(b); }
+static inline xtfloatx2 operator+(xtfloat a, const xtfloatx2 &b) { return xtfloatx2(a) + b; }
+static inline xtfloatx2 operator-(xtfloat a, const xtfloatx2 &b) { return xtfloatx2(a) - b; }
+static inline xtfloatx2 operator*(xtfloat a, const xtfloatx2 &b) { return xtfloatx2(a) * b; }
+static inline xtfloatx2 operator/(xtfloat a, const xtfloatx2 &b) { return xtfloatx2(a) / b; }
+static inline xtfloatx2 &operator+=(xtfloatx2 &a, const xtfloatx2 &b) { return a = a + b; }
+static inline xtfloatx2 &operator-=(xtfloatx2 &a, const xtfloatx2 &b) { return a = a - b; }
+static inline xtfloatx2 &operator*=(xtfloatx2 &a, const xtfloatx2 &b) { return a = a * b; }
+
+/*---------------------------------------------------------------------------
+ * Arithmetic
+ *-------------------------------------------------------------------------*/
+static inline xtfloat XT_CONST_S(int i)
+{
+  static const float c[] = { 0.0f, 1.0f, 2.0f, 0.5f };
+  return c[i & 3];
+}
+
+static inline xtfloat XT_ADD_S(xtfloat a, xtfloat b) { return a + b; }
+static inline xtfloat XT_SUB_S(xtfloat a, xtfloat b) { return a - b; }
+static inline xtfloat XT_MUL_S(xtfloat a, xtfloat b) { return a * b; }
+static inline xtfloat XT_DIV_S(xtfloat a, xtfloat b) { return a / b; }
+static inline xtfloat XT_NEG_S(xtfloat a) { return -a; }
+static inline xtfloat XT_ABS_S(xtfloat a) { return fabsf(a); }
+static inline xtfloat XT_MAX_S(xtfloat a, xtfloat b) { return a > b ? a : b; }
+static inline xtfloat XT_MIN_S(xtfloat a, xtfloat b) { return a < b ? a : b; }
+#define XT_MAX_S XT_MAX_S
+#define XT_MIN_S XT_MIN_S
+static inline xtfloat XT_SQRT_S(xtfloat a) { return sqrtf(a); }
+static inline xtfloat XT_RECIP0_S(xtfloat a) { return 1.0f / a; }
+static inline xtfloat XT_RECIP_S(xtfloat a) { return 1.0f / a; }
+
+static inline xtfloatx2 XT_ADD_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return a + b; }
+static inline xtfloatx2 XT_SUB_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return a - b; }
+static inline xtfloatx2 XT_MUL_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return a * b; }
+static inline xtfloatx2 XT_DIV_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return a / b; }
+static inline xtfloatx2 XT_NEG_SX2(const xtfloatx2 &a) { return -a; }
+static inline xtfloatx2 XT_MAX_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, x > y ? x : y) }
+static inline xtfloatx2 XT_MIN_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, x < y ? x : y) }
+static inline xtfloatx2 XT_RECIP0_SX2(const xtfloatx2 &a) { CSTUB_FMAP2(a, a, 1.0f / x) }
+static inline xtfloat XT_RADD_SX2(const xtfloatx2 &a) { return a.v[0] + a.v[1]; }
+
+#define XT_MADD_S(d, a, b)    { (d) = fmaf((a), (b), (d)); }
+#define XT_MADDN_S(d, a, b)   { (d) = fmaf((a), (b), (d)); }
+#define XT_MSUB_S(d, a, b)    { (d) = fmaf(-(a), (b), (d)); }
+#define XT_MADD_SX2(d, a, b)  cstub_madd_sx2((d), (a), (b), 1.0f)
+#define XT_MSUB_SX2(d, a, b)  cstub_madd_sx2((d), (a), (b), -1.0f)
+
+static inline void cstub_madd_sx2(xtfloatx2 &d, const xtfloatx2 &a, const xtfloatx2 &b, float sign)
+{
+  for(int k = 0; k < 2; k++)
+    d.v[k] = fmaf(sign * a.v[k], b.v[k], d.v[k]);
+}
+
+/*
+ * HiFi5 FPU forms without the XT_ prefix, including the paired (SX2X2)
+ * and scalar-by-vector (Q) operations that write two registers.
+ */
+#define CONST_S(i)                      XT_CONST_S(i)
+#define ADD_S(a, b)                     XT_ADD_S((a), (b))
+#define MUL_S(a, b)                     XT_MUL_S((a), (b))
+#define MAX_S(a, b)                     XT_MAX_S((a), (b))
+#define MIN_S(a, b)                     XT_MIN_S((a), (b))
+#define RECIP_S(a)                      XT_RECIP_S(a)
+#define MADD_S(d, a, b)                 XT_MADD_S(d, a, b)
+#define ADD_SX2(a, b)                   XT_ADD_SX2((a), (b))
+#define MAX_SX2(a, b)                   XT_MAX_SX2((a), (b))
+#define MIN_SX2(a, b)                   XT_MIN_SX2((a), (b))
+#define RADD_SX2(a)                     XT_RADD_SX2(a)
+#define MADD_SX2(d, a, b)               XT_MADD_SX2(d, a, b)
+
+static inline xtfloat FIFLOOR_S(xtfloat x) { return floorf(x); }
+static inline xtfloatx2 FIFLOOR_SX2(const xtfloatx2 &a) { CSTUB_FMAP2(a, a, floorf(x)) }
+static inline xtfloatx2 MAXNUM_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { CSTUB_FMAP2(a, b, fmaxf(x, y)) }
+static inline xtfloatx2 ABS_SX2(const xtfloatx2 &a) { CSTUB_FMAP2(a, a, fabsf(x)) }
+
+/* Sum of the crossed halves of two vectors, a.H + b.L in the low lane */
+static inline xtfloatx2 ADD_HL_LH_S(const xtfloatx2 &a, const xtfloatx2 &b)
+{
+  xtfloatx2 r;
+  r.lane(1) = a.lane(0) + b.lane(1);
+  r.lane(0) = a.lane(1) + b.lane(0);
+  return r;
+}
+
+/* 2^e for the signed exponents held in bytes 4 (H) and 0 (L) */
+static inline float cstub_floatexp(int e)
+{
+  int b = e + 127;
+  uint32_t u = b <= 0 ? 0 : (b >= 255 ? 0x7f800000u : (uint32_t)b << 23);
+  float r;
+  memcpy(&r, &u, 4);
+  return r;
+}
+
+static inline xtfloatx2 FLOATEXP_SX2(const ae_int8x8 &e)
+{
+  xtfloatx2 r;
+  r.lane(1) = cstub_floatexp(e.lane(4));
+  r.lane(0) = cstub_floatexp(e.lane(0));
+  return r;
+}
+
+#define MOV_SX2X2(d0, d1, a0, a1)             { xtfloatx2 t0_ = (a0); xtfloatx2 t1_ = (a1); (d0) = t0_; (d1) = t1_; }
+#define CONST_SX2X2(d0, d1, i)                { (d0) = XT_CONST_S(i); (d1) = XT_CONST_S(i); }
+#define NEG_SX2X2(d0, d1, a0, a1)             { (d0) = -(a0); (d1) = -(a1); }
+#define ABS_SX2X2(d0, d1, a0, a1)             { (d0) = ABS_SX2(a0); (d1) = ABS_SX2(a1); }
+#define ADD_SX2X2(d0, d1, a0, a1, b0, b1)     { xtfloatx2 t0_ = (a0) + (b0); xtfloatx2 t1_ = (a1) + (b1); (d0) = t0_; (d1) = t1_; }
+#define SUB_SX2X2(d0, d1, a0, a1, b0, b1)     { xtfloatx2 t0_ = (a0) - (b0); xtfloatx2 t1_ = (a1) - (b1); (d0) = t0_; (d1) = t1_; }
+#define MUL_SX2X2(d0, d1, a0, a1, b0, b1)     { xtfloatx2 t0_ = (a0) * (b0); xtfloatx2 t1_ = (a1) * (b1); (d0) = t0_; (d1) = t1_; }
+#define MADD_SX2X2(d0, d1, a0, a1, b0, b1)    { cstub_madd_sx2((d0), (a0), (b0), 1.0f); cstub_madd_sx2((d1), (a1), (b1), 1.0f); }
+#define MSUB_SX2X2(d0, d1, a0, a1, b0, b1)    { cstub_madd_sx2((d0), (a0), (b0), -1.0f); cstub_madd_sx2((d1), (a1), (b1), -1.0f); }
+#define MULQ_S(d0, d1, a0, a1, c)             { xtfloat c_ = (c); xtfloatx2 t0_ = (a0) * c_; xtfloatx2 t1_ = (a1) * c_; (d0) = t0_; (d1) = t1_; }
+#define MADDQ_S(d0, d1, a0, a1, c)            { xtfloat c_ = (c); cstub_madd_sx2((d0), (a0), c_, 1.0f); cstub_madd_sx2((d1), (a1), c_, 1.0f); }
+
+/*
+ * Multiply-accumulate with a lane multiplexer on the first operand pair.
+ * Only the two selections used by the kernels are emulated:
+ *   0: d += b.H * c
+ *   5: d += b.L * swap(c)
+ */
+static inline void cstub_maddmux(xtfloatx2 &d, const xtfloatx2 &b, const xtfloatx2 &c, int mux)
+{
+  assert(mux == 0 || mux == 5);
+  if(mux == 0)
+  {
+    d.lane(1) = fmaf(b.lane(1), c.lane(1), d.lane(1));
+    d.lane(0) = fmaf(b.lane(1), c.lane(0), d.lane(0));
+  }
+  else
+  {
+    d.lane(1) = fmaf(b.lane(0), c.lane(0), d.lane(1));
+    d.lane(0) = fmaf(b.lane(0), c.lane(1), d.lane(0));
+  }
+}
+
+#define MADDMUX_SX2X2(d0, d1, b0, b1, c0, c1, mux) \
+  { cstub_maddmux((d0), (b0), (c0), (mux)); cstub_maddmux((d1), (b1), (c1), (mux)); }
+
+/*---------------------------------------------------------------------------
+ * Conversions. The second argument scales by 2^s (float to int) or by
+ * 2^-s (int to float).
+ *-------------------------------------------------------------------------*/
+static inline int32_t cstub_f2i(float x, int s, int rnd)
+{
+  double y = ldexp((double)x, s);
+  if(y != y)
+    return INT32_MAX;
+  y = rnd ? round(y) : trunc(y);
+  if(y >= 2147483647.0) return INT32_MAX;
+  if(y <= -2147483648.0) return INT32_MIN;
+  return (int32_t)y;
+}
+
+static inline int XT_ROUND_S(xtfloat x, int s) { return cstub_f2i(x, s, 1); }
+static inline int XT_TRUNC_S(xtfloat x, int s) { return cstub_f2i(x, s, 0); }
+static inline xtfloat XT_FLOAT_S(int x, int s) { return (float)ldexp((double)x, -s); }
+static inline xtfloat XT_FIROUND_S(xtfloat x) { return rintf(x); }
+#define XT_FIROUND_S XT_FIROUND_S
+
+static inline ae_int32x2 XT_TRUNC_SX2(const xtfloatx2 &a, int s)
+{
+  ae_int32x2 r;
+  for(int k = 0; k < 2; k++)
+    r.lane(k) = cstub_f2i(a.lane(k), s, 0);
+  return r;
+}
+
+static inline xtfloatx2 XT_FLOAT_SX2(const ae_int32x2 &a, int s)
+{
+  xtfloatx2 r;
+  for(int k = 0; k < 2; k++)
+    r.lane(k) = XT_FLOAT_S(a.lane(k), s);
+  return r;
+}
+
+static inline xtfloatx2 XT_FIROUND_SX2(const xtfloatx2 &a) { CSTUB_FMAP2(a, a, rintf(x)) }
+
+/* Bit-level moves */
+static inline int XT_RFR(xtfloat x) { int r; memcpy(&r, &x, 4); return r; }
+static inline xtfloat XT_WFR(int x) { float r; memcpy(&r, &x, 4); return r; }
+
+static inline ae_int32x2 XT_AE_MOVINT32X2_FROMXTFLOATX2(const xtfloatx2 &a) { ae_int32x2 r; memcpy(r.v, a.v, 8); return r; }
+static inline xtfloatx2 XT_AE_MOVXTFLOATX2_FROMINT32X2(const ae_int32x2 &a) { xtfloatx2 r; memcpy(r.v, a.v, 8); return r; }
+
+static inline xtfloat XT_HIGH_S(const xtfloatx2 &a) { return a.lane(1); }
+static inline xtfloat XT_LOW_S(const xtfloatx2 &a) { return a.lane(0); }
+
+static inline xtfloatx2 XT_SEL32_HL_SX2(const xtfloatx2 &a, const xtfloatx2 &b)
+{
+  xtfloatx2 r;
+  r.lane(1) = a.lane(1);
+  r.lane(0) = b.lane(0);
+  return r;
+}
+
+static inline xtfloatx2 XT_SEL32_LH_SX2(const xtfloatx2 &a, const xtfloatx2 &b)
+{
+  xtfloatx2 r;
+  r.lane(1) = a.lane(0);
+  r.lane(0) = b.lane(1);
+  return r;
+}
+
+/*---------------------------------------------------------------------------
+ * Comparisons and conditional moves
+ *-------------------------------------------------------------------------*/
+static inline xtbool XT_OLT_S(xtfloat a, xtfloat b) { xtbool r = { a < b }; return r; }
+static inline xtbool XT_OLE_S(xtfloat a, xtfloat b) { xtbool r = { a <= b }; return r; }
+static inline xtbool XT_OEQ_S(xtfloat a, xtfloat b) { xtbool r = { a == b }; return r; }
+static inline xtbool XT_UN_S(xtfloat a, xtfloat b) { xtbool r = { a != a || b != b }; return r; }
+
+static inline xtbool2 cstub_fcmp2(const xtfloatx2 &a, const xtfloatx2 &b, int op)
+{
+  xtbool2 r = { 0 };
+  for(int k = 0; k < 2; k++)
+  {
+    float x = a.lane(k), y = b.lane(k);
+    int c = op == 0 ? x < y : (op == 1 ? x <= y : (op == 2 ? x == y : (x != x || y != y)));
+    r.v |= (unsigned)c << k;
+  }
+  return r;
+}
+
+static inline xtbool2 XT_OLT_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return cstub_fcmp2(a, b, 0); }
+static inline xtbool2 XT_OLE_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return cstub_fcmp2(a, b, 1); }
+static inline xtbool2 XT_OEQ_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return cstub_fcmp2(a, b, 2); }
+static inline xtbool2 XT_UN_SX2(const xtfloatx2 &a, const xtfloatx2 &b) { return cstub_fcmp2(a, b, 3); }
+
+static inline unsigned cstub_cond(int c) { return c != 0; }
+static inline unsigned cstub_cond(xtbool b) { return b.v & 1; }
+static inline unsigned cstub_cond(xtbool2 b) { return b.v & 1; }
+
+#define XT_MOVT_S(d, s, b)     { if(cstub_cond(b)) (d) = (s); }
+#define XT_MOVF_S(d, s, b)     { if(!cstub_cond(b)) (d) = (s); }
+#define XT_MOVNEZ_S(d, s, c)   { if(cstub_cond(c)) (d) = (s); }
+#define XT_MOVEQZ_S(d, s, c)   { if(!cstub_cond(c)) (d) = (s); }
+#define XT_MOVT_SX2(d, s, b)   cstub_movt_sx2((d), (s), (b).v)
+#define XT_MOVF_SX2(d, s, b)   cstub_movt_sx2((d), (s), ~(b).v)
+
+static inline void cstub_movt_sx2(xtfloatx2 &d, const xtfloatx2 &s, unsigned b)
+{
+  for(int k = 0; k < 2; k++)
+    if((b >> k) & 1)
+      d.lane(k) = s.lane(k);
+}
+
+} /* extern "C++" */
+
+#endif /* __XA_NNLIB_CSTUB_FP_H__ */
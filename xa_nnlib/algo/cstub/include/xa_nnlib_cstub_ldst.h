@@ -0,0 +1,400 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host emulation of the HiFi5 loads and stores.
+ *
+ * Addressing modes:
+ *   _I, _X     address p + offset, p unchanged
+ *   _IP, _XP   access at p, then p += inc
+ *   _XC, _IC   access at p, then p += inc wrapped into [AE_CBEGIN0, AE_CEND0)
+ * The aligning forms (AE_LA*, AE_SA*) access unaligned memory directly, so
+ * the priming and flushing operations are no-ops.
+ */
+#ifndef __XA_NNLIB_CSTUB_LDST_H__
+#define __XA_NNLIB_CSTUB_LDST_H__
+
+#include "xa_nnlib_cstub_ops.h"
+
+extern "C++" {
+
+/*---------------------------------------------------------------------------
+ * Element loaders/storers; c != 0 selects circular access
+ *-------------------------------------------------------------------------*/
+static inline void cstub_get(void *d, const void *p, int n, int c)
+{
+  if(c) cstub_rd_circ(d, p, n); else cstub_rd(d, p, n);
+}
+
+static inline void cstub_put(void *p, const void *s, int n, int c)
+{
+  if(c) cstub_wr_circ(p, s, n); else cstub_wr(p, s, n);
+}
+
+static inline ae_int16x4 cstub_ld16x4(const void *p, int c) { ae_int16x4 d; cstub_get(d.v, p, 8, c); return d; }
+static inline ae_int32x2 cstub_ld32x2(const void *p, int c) { ae_int32x2 d; cstub_get(d.v, p, 8, c); return d; }
+static inline ae_int8x8 cstub_ld8x8(const void *p, int c) { ae_int8x8 d; cstub_get(d.v, p, 8, c); return d; }
+static inline ae_int64 cstub_ld64(const void *p, int c) { ae_int64 d; cstub_get(&d.v, p, 8, c); return d; }
+static inline ae_int16x4 cstub_ld16(const void *p, int c) { int16_t x; cstub_get(&x, p, 2, c); return ae_int16x4(x); }
+static inline ae_int32x2 cstub_ld32(const void *p, int c) { int32_t x; cstub_get(&x, p, 4, c); return ae_int32x2(x); }
+static inline ae_int8x8 cstub_ld8(const void *p, int c) { int8_t x; cstub_get(&x, p, 1, c); return ae_int8x8(x); }
+static inline xtfloat cstub_lds(const void *p, int c) { float x; cstub_get(&x, p, 4, c); return x; }
+static inline xtfloatx2 cstub_ldsx2(const void *p, int c) { xtfloatx2 d; cstub_get(d.v, p, 8, c); return d; }
+
+/* Four bytes into four 16-bit lanes: signed, unsigned, or in the upper byte */
+static inline ae_int16x4 cstub_ld8x4(const void *p, int c, int mode)
+{
+  int8_t b[4];
+  ae_int16x4 d;
+  cstub_get(b, p, 4, c);
+  for(int i = 0; i < 4; i++)
+    d.v[i] = mode == 0 ? (int16_t)b[i] : (mode == 1 ? (int16_t)(uint8_t)b[i] : (int16_t)((uint16_t)(uint8_t)b[i] << 8));
+  return d;
+}
+
+static inline ae_int16x4 cstub_ld8x4s(const void *p, int c) { return cstub_ld8x4(p, c, 0); }
+static inline ae_int16x4 cstub_ld8x4u(const void *p, int c) { return cstub_ld8x4(p, c, 1); }
+static inline ae_int16x4 cstub_ld8x4f(const void *p, int c) { return cstub_ld8x4(p, c, 2); }
+
+static inline void cstub_st16x4(void *p, const ae_int16x4 &d, int c) { cstub_put(p, d.v, 8, c); }
+static inline void cstub_st32x2(void *p, const ae_int32x2 &d, int c) { cstub_put(p, d.v, 8, c); }
+static inline void cstub_st8x8(void *p, const ae_int8x8 &d, int c) { cstub_put(p, d.v, 8, c); }
+static inline void cstub_st64(void *p, const ae_int64 &d, int c) { cstub_put(p, &d.v, 8, c); }
+static inline void cstub_st16_0(void *p, const ae_int16x4 &d, int c) { int16_t x = d.lane(0); cstub_put(p, &x, 2, c); }
+static inline void cstub_st32_l(void *p, const ae_int32x2 &d, int c) { int32_t x = d.lane(0); cstub_put(p, &x, 4, c); }
+static inline void cstub_st32_h(void *p, const ae_int32x2 &d, int c) { int32_t x = d.lane(1); cstub_put(p, &x, 4, c); }
+static inline void cstub_st8_0(void *p, const ae_int8x8 &d, int c) { int8_t x = d.lane(0); cstub_put(p, &x, 1, c); }
+static inline void cstub_sts(void *p, const xtfloat &d, int c) { cstub_put(p, &d, 4, c); }
+static inline void cstub_stsx2(void *p, const xtfloatx2 &d, int c) { cstub_put(p, d.v, 8, c); }
+
+/*---------------------------------------------------------------------------
+ * Addressing modes
+ *-------------------------------------------------------------------------*/
+template <class P> static inline P *cstub_next(P *p, int inc, int c)
+{
+  return c ? cstub_circ_addr(p, inc) : cstub_addr(p, inc);
+}
+
+template <class D, class PP, class F>
+static inline void cstub_ld_u(D &d, PP &p, int inc, F f, int c)
+{
+  d = f(p, c);
+  p = cstub_next(p, inc, c);
+}
+
+/* Pair of 64-bit registers from 128 bits of memory */
+template <class D, class PP, class F>
+static inline void cstub_ld2_u(D &d0, D &d1, PP &p, int inc, F f, int c)
+{
+  d0 = f(p, c);
+  d1 = f(cstub_next(p, 8, c), c);
+  p = cstub_next(p, inc, c);
+}
+
+template <class D, class F>
+static inline void cstub_ld2(D &d0, D &d1, const void *p, F f)
+{
+  d0 = f(p, 0);
+  d1 = f((const char *)p + 8, 0);
+}
+
+template <class V, class PP, class F>
+static inline void cstub_st_u(const V &d, PP &p, int inc, F f, int c)
+{
+  f((void *)p, d, c);
+  p = cstub_next(p, inc, c);
+}
+
+template <class V, class PP, class F>
+static inline void cstub_st2_u(const V &d0, const V &d1, PP &p, int inc, F f, int c)
+{
+  f((void *)p, d0, c);
+  f((void *)cstub_next(p, 8, c), d1, c);
+  p = cstub_next(p, inc, c);
+}
+
+template <class V, class F>
+static inline void cstub_st2(const V &d0, const V &d1, void *p, F f)
+{
+  f(p, d0, 0);
+  f((char *)p + 8, d1, 0);
+}
+
+/* Circular pointer update without an access */
+template <class PP> static inline void cstub_addcirc(PP &p, int inc)
+{
+  p = cstub_circ_addr(p, inc);
+}
+
+#define AE_ADDCIRC16X4_XC(p, inc)           cstub_addcirc(CSTUB_LV(p), (inc))
+#define AE_ADDCIRC_XC(p, inc)               cstub_addcirc(CSTUB_LV(p), (inc))
+
+#define CSTUB_LD_I(f, p, off)               f(cstub_addr((p), (off)), 0)
+#define CSTUB_LD_IP(d, p, inc, f)           cstub_ld_u((d), CSTUB_LV(p), (inc), f, 0)
+#define CSTUB_LD_XC(d, p, inc, f)           cstub_ld_u((d), CSTUB_LV(p), (inc), f, 1)
+#define CSTUB_LD2_I(d0, d1, p, off, f)      cstub_ld2((d0), (d1), cstub_addr((p), (off)), f)
+#define CSTUB_LD2_IP(d0, d1, p, inc, f)     cstub_ld2_u((d0), (d1), CSTUB_LV(p), (inc), f, 0)
+#define CSTUB_LD2_XC(d0, d1, p, inc, f)     cstub_ld2_u((d0), (d1), CSTUB_LV(p), (inc), f, 1)
+#define CSTUB_ST_I(d, p, off, f)            f((void *)cstub_addr((p), (off)), (d), 0)
+#define CSTUB_ST_IP(d, p, inc, f)           cstub_st_u((d), CSTUB_LV(p), (inc), f, 0)
+#define CSTUB_ST_XC(d, p, inc, f)           cstub_st_u((d), CSTUB_LV(p), (inc), f, 1)
+#define CSTUB_ST2_I(d0, d1, p, off, f)      cstub_st2((d0), (d1), (void *)cstub_addr((p), (off)), f)
+#define CSTUB_ST2_IP(d0, d1, p, inc, f)     cstub_st2_u((d0), (d1), CSTUB_LV(p), (inc), f, 0)
+
+/*---------------------------------------------------------------------------
+ * Integer loads
+ *-------------------------------------------------------------------------*/
+#define AE_L8_IP(d, p, inc)                 CSTUB_LD_IP(d, p, inc, cstub_ld8)
+#define AE_L8_XP(d, p, inc)                 CSTUB_LD_IP(d, p, inc, cstub_ld8)
+#define AE_L8_XC(d, p, inc)                 CSTUB_LD_XC(d, p, inc, cstub_ld8)
+#define AE_L8_I(p, off)                     CSTUB_LD_I(cstub_ld8, p, off)
+#define AE_L8_X(p, off)                     CSTUB_LD_I(cstub_ld8, p, off)
+
+#define AE_L16_I(p, off)                    CSTUB_LD_I(cstub_ld16, p, off)
+#define AE_L16_X(p, off)                    CSTUB_LD_I(cstub_ld16, p, off)
+#define AE_L16_IP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ld16)
+#define AE_L16_XP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ld16)
+#define AE_L16_XC(d, p, inc)                CSTUB_LD_XC(d, p, inc, cstub_ld16)
+
+#define AE_L32_I(p, off)                    CSTUB_LD_I(cstub_ld32, p, off)
+#define AE_L32_X(p, off)                    CSTUB_LD_I(cstub_ld32, p, off)
+#define AE_L32_IP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ld32)
+#define AE_L32_XP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ld32)
+#define AE_L32_XC(d, p, inc)                CSTUB_LD_XC(d, p, inc, cstub_ld32)
+
+#define AE_L64_I(p, off)                    CSTUB_LD_I(cstub_ld64, p, off)
+#define AE_L64_X(p, off)                    CSTUB_LD_I(cstub_ld64, p, off)
+#define AE_L64_IP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ld64)
+#define AE_L64_XP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ld64)
+
+#define AE_L8X4S_I(p, off)                  CSTUB_LD_I(cstub_ld8x4s, p, off)
+#define AE_L8X4S_X(p, off)                  CSTUB_LD_I(cstub_ld8x4s, p, off)
+#define AE_L8X4S_IP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld8x4s)
+#define AE_L8X4S_XP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld8x4s)
+#define AE_L8X4U_I(p, off)                  CSTUB_LD_I(cstub_ld8x4u, p, off)
+#define AE_L8X4U_IP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld8x4u)
+#define AE_L8X4F_I(p, off)                  CSTUB_LD_I(cstub_ld8x4f, p, off)
+#define AE_L8X4F_IP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld8x4f)
+
+#define AE_L8X8_I(p, off)                   CSTUB_LD_I(cstub_ld8x8, p, off)
+#define AE_L8X8_X(p, off)                   CSTUB_LD_I(cstub_ld8x8, p, off)
+#define AE_L8X8_IP(d, p, inc)               CSTUB_LD_IP(d, p, inc, cstub_ld8x8)
+#define AE_L8X8_XP(d, p, inc)               CSTUB_LD_IP(d, p, inc, cstub_ld8x8)
+#define AE_L8X8_XC(d, p, inc)               CSTUB_LD_XC(d, p, inc, cstub_ld8x8)
+
+#define AE_L16X4_I(p, off)                  CSTUB_LD_I(cstub_ld16x4, p, off)
+#define AE_L16X4_X(p, off)                  CSTUB_LD_I(cstub_ld16x4, p, off)
+#define AE_L16X4_IP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld16x4)
+#define AE_L16X4_XP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld16x4)
+#define AE_L16X4_XC(d, p, inc)              CSTUB_LD_XC(d, p, inc, cstub_ld16x4)
+
+#define AE_L32X2_I(p, off)                  CSTUB_LD_I(cstub_ld32x2, p, off)
+#define AE_L32X2_X(p, off)                  CSTUB_LD_I(cstub_ld32x2, p, off)
+#define AE_L32X2_IP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld32x2)
+#define AE_L32X2_XP(d, p, inc)              CSTUB_LD_IP(d, p, inc, cstub_ld32x2)
+#define AE_L32X2_XC(d, p, inc)              CSTUB_LD_XC(d, p, inc, cstub_ld32x2)
+
+#define AE_L8X8X2_I(d0, d1, p, off)         CSTUB_LD2_I(d0, d1, p, off, cstub_ld8x8)
+#define AE_L8X8X2_X(d0, d1, p, off)         CSTUB_LD2_I(d0, d1, p, off, cstub_ld8x8)
+#define AE_L8X8X2_IP(d0, d1, p, inc)        CSTUB_LD2_IP(d0, d1, p, inc, cstub_ld8x8)
+#define AE_L8X8X2_XP(d0, d1, p, inc)        CSTUB_LD2_IP(d0, d1, p, inc, cstub_ld8x8)
+#define AE_L8X8X2_XC(d0, d1, p, inc)        CSTUB_LD2_XC(d0, d1, p, inc, cstub_ld8x8)
+#define AE_L16X4X2_I(d0, d1, p, off)        CSTUB_LD2_I(d0, d1, p, off, cstub_ld16x4)
+#define AE_L16X4X2_X(d0, d1, p, off)        CSTUB_LD2_I(d0, d1, p, off, cstub_ld16x4)
+#define AE_L16X4X2_IP(d0, d1, p, inc)       CSTUB_LD2_IP(d0, d1, p, inc, cstub_ld16x4)
+#define AE_L16X4X2_XP(d0, d1, p, inc)       CSTUB_LD2_IP(d0, d1, p, inc, cstub_ld16x4)
+#define AE_L16X4X2_XC(d0, d1, p, inc)       CSTUB_LD2_XC(d0, d1, p, inc, cstub_ld16x4)
+#define AE_L32X2X2_I(d0, d1, p, off)        CSTUB_LD2_I(d0, d1, p, off, cstub_ld32x2)
+#define AE_L32X2X2_X(d0, d1, p, off)        CSTUB_LD2_I(d0, d1, p, off, cstub_ld32x2)
+#define AE_L32X2X2_IP(d0, d1, p, inc)       CSTUB_LD2_IP(d0, d1, p, inc, cstub_ld32x2)
+#define AE_L32X2X2_XP(d0, d1, p, inc)       CSTUB_LD2_IP(d0, d1, p, inc, cstub_ld32x2)
+#define AE_L32X2X2_XC(d0, d1, p, inc)       CSTUB_LD2_XC(d0, d1, p, inc, cstub_ld32x2)
+
+static inline ae_int16 ae_int16_loadip_f(const void *p, int c) { ae_int16 x; cstub_get(&x.v, p, 2, c); return x; }
+static inline ae_int64 ae_int64_loadip_f(const void *p, int c) { return cstub_ld64(p, c); }
+#define ae_int16_loadip(d, p, inc)          CSTUB_LD_IP(d, p, inc, ae_int16_loadip_f)
+#define ae_int64_loadip(d, p, inc)          CSTUB_LD_IP(d, p, inc, ae_int64_loadip_f)
+
+/*---------------------------------------------------------------------------
+ * Aligning loads: the pointer advances by the access size
+ *-------------------------------------------------------------------------*/
+static inline ae_valign AE_LA64_PP(const void *p) { (void)p; return AE_ZALIGN64(); }
+static inline ae_valignx2 AE_LA128_PP(const void *p) { (void)p; return AE_ZALIGN128(); }
+#define AE_LA8X8POS_PC(a, p)                ((void)(a))
+#define AE_LA8X8X2POS_PC(a, p)              ((void)(a))
+#define AE_LA16X4X2POS_PC(a, p)             ((void)(a))
+#define AE_LASX2X2POS_PC(a, p)              ((void)(a))
+
+#define AE_LA8X4S_IP(d, a, p)               CSTUB_LD_IP(d, p, 4, cstub_ld8x4s)
+#define AE_LA8X4U_IP(d, a, p)               CSTUB_LD_IP(d, p, 4, cstub_ld8x4u)
+#define AE_LA8X8_IP(d, a, p)                CSTUB_LD_IP(d, p, 8, cstub_ld8x8)
+#define AE_LA8X8_IC(d, a, p)                CSTUB_LD_XC(d, p, 8, cstub_ld8x8)
+#define AE_LA16X4_IP(d, a, p)               CSTUB_LD_IP(d, p, 8, cstub_ld16x4)
+#define AE_LA32X2_IP(d, a, p)               CSTUB_LD_IP(d, p, 8, cstub_ld32x2)
+#define AE_LA8X8X2_IP(d0, d1, a, p)         CSTUB_LD2_IP(d0, d1, p, 16, cstub_ld8x8)
+#define AE_LA8X8X2_IC(d0, d1, a, p)         CSTUB_LD2_XC(d0, d1, p, 16, cstub_ld8x8)
+#define AE_LA16X4X2_IP(d0, d1, a, p)        CSTUB_LD2_IP(d0, d1, p, 16, cstub_ld16x4)
+#define AE_LA16X4X2_IC(d0, d1, a, p)        CSTUB_LD2_XC(d0, d1, p, 16, cstub_ld16x4)
+#define AE_LA32X2X2_IP(d0, d1, a, p)        CSTUB_LD2_IP(d0, d1, p, 16, cstub_ld32x2)
+
+/* Variable length: min(n, 16) bytes, the remaining lanes are zeroed */
+#define AE_LAV8X8X2_XP(d0, d1, a, p, n)     cstub_lav8x8x2((d0), (d1), CSTUB_LV(p), (n))
+template <class PP>
+static inline void cstub_lav8x8x2(ae_int8x8 &d0, ae_int8x8 &d1, PP &p, int n)
+{
+  int8_t b[16] = { 0 };
+  n = n < 0 ? 0 : (n > 16 ? 16 : n);
+  cstub_rd(b, p, n);
+  memcpy(d0.v, b, 8);
+  memcpy(d1.v, b + 8, 8);
+  p = cstub_addr(p, n);
+}
+
+/*---------------------------------------------------------------------------
+ * Integer stores
+ *-------------------------------------------------------------------------*/
+#define AE_S8_0_I(d, p, off)                CSTUB_ST_I(d, p, off, cstub_st8_0)
+#define AE_S8_0_X(d, p, off)                CSTUB_ST_I(d, p, off, cstub_st8_0)
+#define AE_S8_0_IP(d, p, inc)               CSTUB_ST_IP(d, p, inc, cstub_st8_0)
+#define AE_S8_0_XP(d, p, inc)               CSTUB_ST_IP(d, p, inc, cstub_st8_0)
+#define AE_S8_0_XC(d, p, inc)               CSTUB_ST_XC(d, p, inc, cstub_st8_0)
+
+#define AE_S16_0_I(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st16_0)
+#define AE_S16_0_X(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st16_0)
+#define AE_S16_0_IP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st16_0)
+#define AE_S16_0_XP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st16_0)
+#define AE_S16_0_XC(d, p, inc)              CSTUB_ST_XC(d, p, inc, cstub_st16_0)
+
+#define AE_S32_L_I(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st32_l)
+#define AE_S32_L_X(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st32_l)
+#define AE_S32_L_IP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st32_l)
+#define AE_S32_L_XP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st32_l)
+#define AE_S32_L_XC(d, p, inc)              CSTUB_ST_XC(d, p, inc, cstub_st32_l)
+#define AE_S32_H_I(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st32_h)
+#define AE_S32_H_X(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st32_h)
+#define AE_S32_H_IP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st32_h)
+#define AE_S32_H_XP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st32_h)
+
+#define AE_S64_I(d, p, off)                 CSTUB_ST_I(d, p, off, cstub_st64)
+#define AE_S64_X(d, p, off)                 CSTUB_ST_I(d, p, off, cstub_st64)
+#define AE_S64_IP(d, p, inc)                CSTUB_ST_IP(d, p, inc, cstub_st64)
+#define AE_S64_XP(d, p, inc)                CSTUB_ST_IP(d, p, inc, cstub_st64)
+#define AE_S64X2_I(d0, d1, p, off)          CSTUB_ST2_I(d0, d1, p, off, cstub_st64)
+#define AE_S64X2_IP(d0, d1, p, inc)         CSTUB_ST2_IP(d0, d1, p, inc, cstub_st64)
+
+#define AE_S8X8_I(d, p, off)                CSTUB_ST_I(d, p, off, cstub_st8x8)
+#define AE_S8X8_X(d, p, off)                CSTUB_ST_I(d, p, off, cstub_st8x8)
+#define AE_S8X8_IP(d, p, inc)               CSTUB_ST_IP(d, p, inc, cstub_st8x8)
+#define AE_S8X8_XP(d, p, inc)               CSTUB_ST_IP(d, p, inc, cstub_st8x8)
+#define AE_S16X4_I(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st16x4)
+#define AE_S16X4_X(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st16x4)
+#define AE_S16X4_IP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st16x4)
+#define AE_S16X4_XP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st16x4)
+#define AE_S32X2_I(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st32x2)
+#define AE_S32X2_X(d, p, off)               CSTUB_ST_I(d, p, off, cstub_st32x2)
+#define AE_S32X2_IP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st32x2)
+#define AE_S32X2_XP(d, p, inc)              CSTUB_ST_IP(d, p, inc, cstub_st32x2)
+
+#define AE_S8X8X2_I(d0, d1, p, off)         CSTUB_ST2_I(d0, d1, p, off, cstub_st8x8)
+#define AE_S8X8X2_IP(d0, d1, p, inc)        CSTUB_ST2_IP(d0, d1, p, inc, cstub_st8x8)
+#define AE_S8X8X2_XP(d0, d1, p, inc)        CSTUB_ST2_IP(d0, d1, p, inc, cstub_st8x8)
+#define AE_S16X4X2_I(d0, d1, p, off)        CSTUB_ST2_I(d0, d1, p, off, cstub_st16x4)
+#define AE_S16X4X2_IP(d0, d1, p, inc)       CSTUB_ST2_IP(d0, d1, p, inc, cstub_st16x4)
+#define AE_S16X4X2_XP(d0, d1, p, inc)       CSTUB_ST2_IP(d0, d1, p, inc, cstub_st16x4)
+#define AE_S32X2X2_I(d0, d1, p, off)        CSTUB_ST2_I(d0, d1, p, off, cstub_st32x2)
+#define AE_S32X2X2_IP(d0, d1, p, inc)       CSTUB_ST2_IP(d0, d1, p, inc, cstub_st32x2)
+#define AE_S32X2X2_XP(d0, d1, p, inc)       CSTUB_ST2_IP(d0, d1, p, inc, cstub_st32x2)
+
+/* Aligning stores */
+#define AE_SA64POS_FP(a, p)                 ((void)(a))
+#define AE_SA128POS_FP(a, p)                ((void)(a))
+#define AE_SA8X8_IP(d, a, p)                CSTUB_ST_IP(d, p, 8, cstub_st8x8)
+#define AE_SA16X4_IP(d, a, p)               CSTUB_ST_IP(d, p, 8, cstub_st16x4)
+#define AE_SA32X2_IP(d, a, p)               CSTUB_ST_IP(d, p, 8, cstub_st32x2)
+#define AE_SA8X8X2_IP(d0, d1, a, p)         CSTUB_ST2_IP(d0, d1, p, 16, cstub_st8x8)
+#define AE_SA16X4X2_IP(d0, d1, a, p)        CSTUB_ST2_IP(d0, d1, p, 16, cstub_st16x4)
+#define AE_SA32X2X2_IP(d0, d1, a, p)        CSTUB_ST2_IP(d0, d1, p, 16, cstub_st32x2)
+
+#define AE_SAV8X8X2_XP(d0, d1, a, p, n)     cstub_sav8x8x2((d0), (d1), CSTUB_LV(p), (n))
+template <class PP>
+static inline void cstub_sav8x8x2(const ae_int8x8 &d0, const ae_int8x8 &d1, PP &p, int n)
+{
+  int8_t b[16];
+  n = n < 0 ? 0 : (n > 16 ? 16 : n);
+  memcpy(b, d0.v, 8);
+  memcpy(b + 8, d1.v, 8);
+  cstub_wr((void *)p, b, n);
+  p = cstub_addr(p, n);
+}
+
+/*---------------------------------------------------------------------------
+ * Floating point loads and stores
+ *-------------------------------------------------------------------------*/
+#define XT_LSI(p, off)                      CSTUB_LD_I(cstub_lds, p, off)
+#define XT_LSX(p, off)                      CSTUB_LD_I(cstub_lds, p, off)
+#define XT_LSIP(d, p, inc)                  CSTUB_LD_IP(d, p, inc, cstub_lds)
+#define XT_LSXP(d, p, inc)                  CSTUB_LD_IP(d, p, inc, cstub_lds)
+#define XT_LSXC(d, p, inc)                  CSTUB_LD_XC(d, p, inc, cstub_lds)
+#define AE_LSIP                             XT_LSIP
+#define AE_LSXC                             XT_LSXC
+
+#define XT_LSX2I(p, off)                    CSTUB_LD_I(cstub_ldsx2, p, off)
+#define XT_LSX2X(p, off)                    CSTUB_LD_I(cstub_ldsx2, p, off)
+#define XT_LSX2IP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ldsx2)
+#define XT_LSX2XP(d, p, inc)                CSTUB_LD_IP(d, p, inc, cstub_ldsx2)
+#define XT_LSX2XC(d, p, inc)                CSTUB_LD_XC(d, p, inc, cstub_ldsx2)
+#define AE_LSX2IP                           XT_LSX2IP
+#define AE_LSX2XP                           XT_LSX2XP
+#define AE_LSX2XC                           XT_LSX2XC
+
+#define AE_LSX2X2_I(d0, d1, p, off)         CSTUB_LD2_I(d0, d1, p, off, cstub_ldsx2)
+#define AE_LSX2X2_X(d0, d1, p, off)         CSTUB_LD2_I(d0, d1, p, off, cstub_ldsx2)
+#define AE_LSX2X2_IP(d0, d1, p, inc)        CSTUB_LD2_IP(d0, d1, p, inc, cstub_ldsx2)
+#define AE_LSX2X2_XP(d0, d1, p, inc)        CSTUB_LD2_IP(d0, d1, p, inc, cstub_ldsx2)
+#define AE_LSX2X2_XC(d0, d1, p, inc)        CSTUB_LD2_XC(d0, d1, p, inc, cstub_ldsx2)
+
+#define XT_LASX2PP(p)                       AE_LA64_PP(p)
+#define XT_LASX2IP(d, a, p)                 CSTUB_LD_IP(d, p, 8, cstub_ldsx2)
+#define AE_LASX2X2_IP(d0, d1, a, p)         CSTUB_LD2_IP(d0, d1, p, 16, cstub_ldsx2)
+#define AE_LASX2X2_IC(d0, d1, a, p)         CSTUB_LD2_XC(d0, d1, p, 16, cstub_ldsx2)
+
+#define XT_SSI(d, p, off)                   CSTUB_ST_I(d, p, off, cstub_sts)
+#define XT_SSX(d, p, off)                   CSTUB_ST_I(d, p, off, cstub_sts)
+#define XT_SSIP(d, p, inc)                  CSTUB_ST_IP(d, p, inc, cstub_sts)
+#define XT_SSXP(d, p, inc)                  CSTUB_ST_IP(d, p, inc, cstub_sts)
+#define XT_SSXC(d, p, inc)                  CSTUB_ST_XC(d, p, inc, cstub_sts)
+#define AE_SSIP                             XT_SSIP
+
+#define XT_SSX2I(d, p, off)                 CSTUB_ST_I(d, p, off, cstub_stsx2)
+#define XT_SSX2X(d, p, off)                 CSTUB_ST_I(d, p, off, cstub_stsx2)
+#define XT_SSX2IP(d, p, inc)                CSTUB_ST_IP(d, p, inc, cstub_stsx2)
+#define XT_SSX2XP(d, p, inc)                CSTUB_ST_IP(d, p, inc, cstub_stsx2)
+#define AE_SSX2IP                           XT_SSX2IP
+#define AE_SSX2X2_I(d0, d1, p, off)         CSTUB_ST2_I(d0, d1, p, off, cstub_stsx2)
+#define AE_SSX2X2_IP(d0, d1, p, inc)        CSTUB_ST2_IP(d0, d1, p, inc, cstub_stsx2)
+
+#define XT_SASX2IP(d, a, p)                 CSTUB_ST_IP(d, p, 8, cstub_stsx2)
+#define XT_SASX2POSFP(a, p)                 ((void)(a))
+#define AE_SASX2X2_IP(d0, d1, a, p)         CSTUB_ST2_IP(d0, d1, p, 16, cstub_stsx2)
+
+} /* extern "C++" */
+
+#endif /* __XA_NNLIB_CSTUB_LDST_H__ */
@@ -0,0 +1,507 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host emulation of the HiFi5 multiply and multiply-accumulate operations.
+ *
+ * Unless noted otherwise, 32-bit accumulators wrap around and 64-bit
+ * accumulators wrap around. The 8-bit "UUZB" forms treat both operands as
+ * unsigned and add the zero biases programmed with AE_MOVZBVCDR: the
+ * coefficient operand (matrix row / kernel) is offset by AE_BIASC8 and the
+ * data operand (vector / input) by AE_BIASV8.
+ */
+#ifndef __XA_NNLIB_CSTUB_MAC_H__
+#define __XA_NNLIB_CSTUB_MAC_H__
+
+#include "xa_nnlib_cstub_ops.h"
+
+extern "C++" {
+
+static inline int32_t cstub_wrap32(int64_t x) { return (int32_t)(uint32_t)(uint64_t)x; }
+static inline void cstub_acc32(int32_t &a, int64_t x) { a = cstub_wrap32((int64_t)a + x); }
+static inline void cstub_acc64(ae_int64 &a, int64_t x) { a.v = (int64_t)((uint64_t)a.v + (uint64_t)x); }
+
+/* 8-bit operands, signed or unsigned with zero bias */
+static inline int64_t cstub_c8(int8_t x, int uu) { return uu ? (int64_t)(uint8_t)x - xa_nnlib_cstub_biasc8 : x; }
+static inline int64_t cstub_v8(int8_t x, int uu) { return uu ? (int64_t)(uint8_t)x - xa_nnlib_cstub_biasv8 : x; }
+
+/*---------------------------------------------------------------------------
+ * 8x8-bit: four rows times one vector
+ *-------------------------------------------------------------------------*/
+static inline int64_t cstub_dot8(const ae_int8x8 &c, const ae_int8x8 &v, int uu)
+{
+  int64_t s = 0;
+  for(int i = 0; i < 8; i++)
+    s += cstub_c8(c.v[i], uu) * cstub_v8(v.v[i], uu);
+  return s;
+}
+
+static inline void cstub_mula8q8x8(ae_int32x2 &a0, ae_int32x2 &a1, const ae_int8x8 &c0, const ae_int8x8 &c1,
+                                   const ae_int8x8 &c2, const ae_int8x8 &c3, const ae_int8x8 &v, int uu, int zero)
+{
+  int64_t s0 = cstub_dot8(c0, v, uu), s1 = cstub_dot8(c1, v, uu);
+  int64_t s2 = cstub_dot8(c2, v, uu), s3 = cstub_dot8(c3, v, uu);
+  if(zero)
+    a0 = a1 = AE_ZERO32();
+  cstub_acc32(a0.lane(1), s0);
+  cstub_acc32(a0.lane(0), s1);
+  cstub_acc32(a1.lane(1), s2);
+  cstub_acc32(a1.lane(0), s3);
+}
+
+#define AE_MULA8Q8X8(a0, a1, c0, c1, c2, c3, v)     cstub_mula8q8x8((a0), (a1), (c0), (c1), (c2), (c3), (v), 0, 0)
+#define AE_MUL8Q8X8(a0, a1, c0, c1, c2, c3, v)      cstub_mula8q8x8((a0), (a1), (c0), (c1), (c2), (c3), (v), 0, 1)
+#define AE_MULAUUZB8Q8X8(a0, a1, c0, c1, c2, c3, v) cstub_mula8q8x8((a0), (a1), (c0), (c1), (c2), (c3), (v), 1, 0)
+
+/* Four outputs per row pair: rows d0..d3 against the upper (a0, a1) and lower
+ * (a2, a3) four lanes of k */
+static inline void cstub_mula4o8x8(ae_int32x2 &a0, ae_int32x2 &a1, ae_int32x2 &a2, ae_int32x2 &a3,
+                                   const ae_int8x8 &d0, const ae_int8x8 &d1, const ae_int8x8 &d2,
+                                   const ae_int8x8 &d3, const ae_int8x8 &k)
+{
+  const ae_int8x8 *d[4] = { &d0, &d1, &d2, &d3 };
+  int64_t hi[4] = { 0 }, lo[4] = { 0 };
+  for(int r = 0; r < 4; r++)
+    for(int i = 0; i < 4; i++)
+    {
+      hi[r] += (int64_t)d[r]->v[i] * k.v[i];
+      lo[r] += (int64_t)d[r]->v[4 + i] * k.v[4 + i];
+    }
+  cstub_acc32(a0.lane(1), hi[0]);
+  cstub_acc32(a0.lane(0), hi[1]);
+  cstub_acc32(a1.lane(1), hi[2]);
+  cstub_acc32(a1.lane(0), hi[3]);
+  cstub_acc32(a2.lane(1), lo[0]);
+  cstub_acc32(a2.lane(0), lo[1]);
+  cstub_acc32(a3.lane(1), lo[2]);
+  cstub_acc32(a3.lane(0), lo[3]);
+}
+
+#define AE_MULA4O8X8(a0, a1, a2, a3, d0, d1, d2, d3, k) \
+  cstub_mula4o8x8((a0), (a1), (a2), (a3), (d0), (d1), (d2), (d3), (k))
+
+/*---------------------------------------------------------------------------
+ * 8x8-bit convolutions. Taps k[t] and samples x[n] are in memory order;
+ * output n accumulates into element n of {a0, a1[, a2, a3]}.
+ *-------------------------------------------------------------------------*/
+static inline void cstub_acc_out(ae_int32x2 *const a[], const int64_t *out, int n)
+{
+  for(int i = 0; i < n; i++)
+    cstub_acc32(a[i >> 1]->v[i & 1], out[i]);
+}
+
+static inline void cstub_cnv8(ae_int32x2 &a0, ae_int32x2 &a1, const ae_int8x8 &k, const ae_int8x8 &x0,
+                              const ae_int8x8 &x1, int start, int uu)
+{
+  int8_t x[16];
+  int64_t out[4] = { 0 };
+  ae_int32x2 *a[2] = { &a0, &a1 };
+  memcpy(x, x0.v, 8);
+  memcpy(x + 8, x1.v, 8);
+  for(int n = 0; n < 4; n++)
+    for(int t = 0; t < 8; t++)
+      out[n] += cstub_c8(k.v[t], uu) * cstub_v8(x[start + n + t], uu);
+  cstub_acc_out(a, out, 4);
+}
+
+static inline void cstub_cnv2x4(ae_int32x2 &a0, ae_int32x2 &a1, const ae_int8x8 &k, const ae_int8x8 &r0a,
+                                const ae_int8x8 &r0b, const ae_int8x8 &r1a, const ae_int8x8 &r1b, int start, int uu)
+{
+  int8_t r0[16], r1[16];
+  int64_t out[4] = { 0 };
+  ae_int32x2 *a[2] = { &a0, &a1 };
+  memcpy(r0, r0a.v, 8);
+  memcpy(r0 + 8, r0b.v, 8);
+  memcpy(r1, r1a.v, 8);
+  memcpy(r1 + 8, r1b.v, 8);
+  for(int n = 0; n < 4; n++)
+    for(int t = 0; t < 4; t++)
+      out[n] += cstub_c8(k.v[t], uu) * cstub_v8(r0[start + n + t], uu) +
+                cstub_c8(k.v[4 + t], uu) * cstub_v8(r1[start + n + t], uu);
+  cstub_acc_out(a, out, 4);
+}
+
+static inline void cstub_cnv4o(ae_int32x2 &a0, ae_int32x2 &a1, ae_int32x2 &a2, ae_int32x2 &a3,
+                               const ae_int8x8 &k, const ae_int8x8 &x0, const ae_int8x8 &x1, int tap0, int uu)
+{
+  int8_t x[16];
+  int64_t out[8] = { 0 };
+  ae_int32x2 *a[4] = { &a0, &a1, &a2, &a3 };
+  memcpy(x, x0.v, 8);
+  memcpy(x + 8, x1.v, 8);
+  for(int n = 0; n < 8; n++)
+    for(int t = 0; t < 4; t++)
+      out[n] += cstub_c8(k.v[tap0 + t], uu) * cstub_v8(x[n + t], uu);
+  cstub_acc_out(a, out, 8);
+}
+
+#define AE_MULA8Q8X8CNV_H(a0, a1, k, x0, x1)            cstub_cnv8((a0), (a1), (k), (x0), (x1), 0, 0)
+#define AE_MULA8Q8X8CNV_L(a0, a1, k, x0, x1)            cstub_cnv8((a0), (a1), (k), (x0), (x1), 4, 0)
+#define AE_MULAUUZB8Q8X8CNV_H(a0, a1, k, x0, x1)        cstub_cnv8((a0), (a1), (k), (x0), (x1), 0, 1)
+#define AE_MULAUUZB8Q8X8CNV_L(a0, a1, k, x0, x1)        cstub_cnv8((a0), (a1), (k), (x0), (x1), 4, 1)
+#define AE_MULA2X4Q8X8CNV_H(a0, a1, k, r0, r1)          cstub_cnv2x4((a0), (a1), (k), (r0), (r0), (r1), (r1), 0, 0)
+#define AE_MULA2X4Q8X8CNV_L(a0, a1, k, r0a, r0b, r1a, r1b) \
+  cstub_cnv2x4((a0), (a1), (k), (r0a), (r0b), (r1a), (r1b), 4, 0)
+#define AE_MULAUUZB2X4Q8X8CNV_H(a0, a1, k, r0, r1)      cstub_cnv2x4((a0), (a1), (k), (r0), (r0), (r1), (r1), 0, 1)
+#define AE_MULAUUZB2X4Q8X8CNV_L(a0, a1, k, r0a, r0b, r1a, r1b) \
+  cstub_cnv2x4((a0), (a1), (k), (r0a), (r0b), (r1a), (r1b), 4, 1)
+#define AE_MULA4O8X8CNV_H(a0, a1, a2, a3, k, x0, x1)     cstub_cnv4o((a0), (a1), (a2), (a3), (k), (x0), (x1), 0, 0)
+#define AE_MULA4O8X8CNV_L(a0, a1, a2, a3, k, x0, x1)     cstub_cnv4o((a0), (a1), (a2), (a3), (k), (x0), (x1), 4, 0)
+#define AE_MULAUUZB4O8X8CNV_H(a0, a1, a2, a3, k, x0, x1) cstub_cnv4o((a0), (a1), (a2), (a3), (k), (x0), (x1), 0, 1)
+#define AE_MULAUUZB4O8X8CNV_L(a0, a1, a2, a3, k, x0, x1) cstub_cnv4o((a0), (a1), (a2), (a3), (k), (x0), (x1), 4, 1)
+
+/*---------------------------------------------------------------------------
+ * 8x16-bit
+ *-------------------------------------------------------------------------*/
+/* Row m (8 lanes) against the 8 16-bit samples {v0, v1} */
+static inline int64_t cstub_dot8x16(const ae_int8x8 &m, const ae_int16x4 &v0, const ae_int16x4 &v1)
+{
+  int64_t s = 0;
+  for(int i = 0; i < 4; i++)
+    s += (int64_t)m.v[i] * v0.v[i] + (int64_t)m.v[4 + i] * v1.v[i];
+  return s;
+}
+
+static inline void cstub_mula8q8x16(ae_int32x2 &a0, ae_int32x2 &a1, const ae_int8x8 &m0, const ae_int8x8 &m1,
+                                    const ae_int8x8 &m2, const ae_int8x8 &m3, const ae_int16x4 &v0, const ae_int16x4 &v1)
+{
+  int64_t s0 = cstub_dot8x16(m0, v0, v1), s1 = cstub_dot8x16(m1, v0, v1);
+  int64_t s2 = cstub_dot8x16(m2, v0, v1), s3 = cstub_dot8x16(m3, v0, v1);
+  cstub_acc32(a0.lane(1), s0);
+  cstub_acc32(a0.lane(0), s1);
+  cstub_acc32(a1.lane(1), s2);
+  cstub_acc32(a1.lane(0), s3);
+}
+
+static inline void cstub_mula8qw8x16(ae_int64 &q0, ae_int64 &q1, ae_int64 &q2, ae_int64 &q3,
+                                     const ae_int8x8 &m0, const ae_int8x8 &m1, const ae_int8x8 &m2,
+                                     const ae_int8x8 &m3, const ae_int16x4 &v0, const ae_int16x4 &v1)
+{
+  cstub_acc64(q0, cstub_dot8x16(m0, v0, v1));
+  cstub_acc64(q1, cstub_dot8x16(m1, v0, v1));
+  cstub_acc64(q2, cstub_dot8x16(m2, v0, v1));
+  cstub_acc64(q3, cstub_dot8x16(m3, v0, v1));
+}
+
+#define AE_MULA8Q8X16(a0, a1, m0, m1, m2, m3, v0, v1) \
+  cstub_mula8q8x16((a0), (a1), (m0), (m1), (m2), (m3), (v0), (v1))
+#define AE_MULA8QW8X16(q0, q1, q2, q3, m0, m1, m2, m3, v0, v1) \
+  cstub_mula8qw8x16((q0), (q1), (q2), (q3), (m0), (m1), (m2), (m3), (v0), (v1))
+
+static inline void cstub_mula8q8x16cnv(ae_int32x2 &a0, ae_int32x2 &a1, const ae_int8x8 &k,
+                                       const ae_int16x4 &i0, const ae_int16x4 &i1, const ae_int16x4 &i2)
+{
+  int16_t x[12];
+  int64_t out[4] = { 0 };
+  ae_int32x2 *a[2] = { &a0, &a1 };
+  memcpy(x, i0.v, 8);
+  memcpy(x + 4, i1.v, 8);
+  memcpy(x + 8, i2.v, 8);
+  for(int n = 0; n < 4; n++)
+    for(int t = 0; t < 8; t++)
+      out[n] += (int64_t)k.v[t] * x[n + t];
+  cstub_acc_out(a, out, 4);
+}
+
+static inline void cstub_mula2x4q8x16cnv(ae_int32x2 &a0, ae_int32x2 &a1, const ae_int8x8 &k,
+                                         const ae_int16x4 &x0a, const ae_int16x4 &x0b,
+                                         const ae_int16x4 &x1a, const ae_int16x4 &x1b)
+{
+  int16_t x0[8], x1[8];
+  int64_t out[4] = { 0 };
+  ae_int32x2 *a[2] = { &a0, &a1 };
+  memcpy(x0, x0a.v, 8);
+  memcpy(x0 + 4, x0b.v, 8);
+  memcpy(x1, x1a.v, 8);
+  memcpy(x1 + 4, x1b.v, 8);
+  for(int n = 0; n < 4; n++)
+    for(int t = 0; t < 4; t++)
+      out[n] += (int64_t)k.v[t] * x0[n + t] + (int64_t)k.v[4 + t] * x1[n + t];
+  cstub_acc_out(a, out, 4);
+}
+
+#define AE_MULA8Q8X16CNV(a0, a1, k, i0, i1, i2) \
+  cstub_mula8q8x16cnv((a0), (a1), (k), (i0), (i1), (i2))
+#define AE_MULA2X4Q8X16CNV(a0, a1, k, x0a, x0b, x1a, x1b) \
+  cstub_mula2x4q8x16cnv((a0), (a1), (k), (x0a), (x0b), (x1a), (x1b))
+
+/*---------------------------------------------------------------------------
+ * 16x16-bit
+ *-------------------------------------------------------------------------*/
+static inline int64_t cstub_dot16(const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  int64_t s = 0;
+  for(int i = 0; i < 4; i++)
+    s += (int64_t)a.v[i] * b.v[i];
+  return s;
+}
+
+static inline void cstub_mulaaaa2q16(ae_int64 &q0, ae_int64 &q1, const ae_int16x4 &a0, const ae_int16x4 &a1,
+                                     const ae_int16x4 &b0, const ae_int16x4 &b1, int zero)
+{
+  if(zero)
+    q0 = q1 = AE_ZERO64();
+  cstub_acc64(q0, cstub_dot16(a0, b0));
+  cstub_acc64(q1, cstub_dot16(a1, b1));
+}
+
+#define AE_MULAAAA2Q16(q0, q1, a0, a1, b0, b1)   cstub_mulaaaa2q16((q0), (q1), (a0), (a1), (b0), (b1), 0)
+#define AE_MULZAAAA2Q16(q0, q1, a0, a1, b0, b1)  cstub_mulaaaa2q16((q0), (q1), (a0), (a1), (b0), (b1), 1)
+
+/* m0 against the upper and m1 against the lower four lanes of v */
+static inline void cstub_mulaaaa2q16x8(ae_int64 &q0, ae_int64 &q1, const ae_int16x4 &m0,
+                                       const ae_int16x4 &m1, const ae_int8x8 &v)
+{
+  int64_t s0 = 0, s1 = 0;
+  for(int i = 0; i < 4; i++)
+  {
+    s0 += (int64_t)m0.v[i] * v.v[i];
+    s1 += (int64_t)m1.v[i] * v.v[4 + i];
+  }
+  cstub_acc64(q0, s0);
+  cstub_acc64(q1, s1);
+}
+
+#define AE_MULAAAA2Q16X8(q0, q1, m0, m1, v)  cstub_mulaaaa2q16x8((q0), (q1), (m0), (m1), (v))
+
+static inline void cstub_mulaaaa2q8(ae_int64 &q0, ae_int64 &q1, const ae_int8x8 &a, const ae_int8x8 &b)
+{
+  int64_t s0 = 0, s1 = 0;
+  for(int i = 0; i < 4; i++)
+  {
+    s0 += (int64_t)a.v[i] * b.v[i];
+    s1 += (int64_t)a.v[4 + i] * b.v[4 + i];
+  }
+  cstub_acc64(q0, s0);
+  cstub_acc64(q1, s1);
+}
+
+#define AE_MULAAAA2Q8(q0, q1, a, b)  cstub_mulaaaa2q8((q0), (q1), (a), (b))
+
+static inline void cstub_mulaaaaq16(ae_int64 &q, const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  cstub_acc64(q, cstub_dot16(a, b));
+}
+
+static inline void cstub_mula16_00(ae_int64 &q, const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  cstub_acc64(q, (int64_t)a.lane(0) * b.lane(0));
+}
+
+#define AE_MULAAAAQ16(q, a, b)  cstub_mulaaaaq16((q), (a), (b))
+#define AE_MULA16_00(q, a, b)   cstub_mula16_00((q), (a), (b))
+
+/* q += a.H * b.lane0 + a.L * b.lane1 */
+static inline void cstub_mulaad32x16_h0_l1(ae_int64 &q, const ae_int32x2 &a, const ae_int16x4 &b)
+{
+  cstub_acc64(q, (int64_t)a.lane(1) * b.lane(0) + (int64_t)a.lane(0) * b.lane(1));
+}
+
+#define AE_MULAAD32X16_H0_L1(q, a, b)  cstub_mulaad32x16_h0_l1((q), (a), (b))
+
+/* Two-output Q15 FIR step: taps k against the windows of {d0, d1} starting
+ * at element off and off + 1; products are doubled */
+static inline void cstub_mulafq16x2_fir(ae_int64 &q0, ae_int64 &q1, const ae_int16x4 &d0, const ae_int16x4 &d1,
+                                        const ae_int16x4 &k, int off)
+{
+  int16_t x[8];
+  int64_t s0 = 0, s1 = 0;
+  memcpy(x, d0.v, 8);
+  memcpy(x + 4, d1.v, 8);
+  for(int t = 0; t < 4; t++)
+  {
+    s0 += 2 * (int64_t)k.v[t] * x[off + t];
+    s1 += 2 * (int64_t)k.v[t] * x[off + 1 + t];
+  }
+  cstub_acc64(q0, s0);
+  cstub_acc64(q1, s1);
+}
+
+#define AE_MULAFQ16X2_FIR_3(q0, q1, d0, d1, k)  cstub_mulafq16x2_fir((q0), (q1), (d0), (d1), (k), 0)
+#define AE_MULAFQ16X2_FIR_2(q0, q1, d0, d1, k)  cstub_mulafq16x2_fir((q0), (q1), (d0), (d1), (k), 1)
+#define AE_MULAFQ16X2_FIR_1(q0, q1, d0, d1, k)  cstub_mulafq16x2_fir((q0), (q1), (d0), (d1), (k), 2)
+#define AE_MULAFQ16X2_FIR_0(q0, q1, d0, d1, k)  cstub_mulafq16x2_fir((q0), (q1), (d0), (d1), (k), 3)
+
+/* d0 = {a3 b3, a2 b2}, d1 = {a1 b1, a0 b0} */
+static inline void cstub_mul16x4(ae_int32x2 &d0, ae_int32x2 &d1, const ae_int16x4 &a, const ae_int16x4 &b, int acc)
+{
+  ae_int32x2 p0 = AE_MOVDA32X2(a.lane(3) * b.lane(3), a.lane(2) * b.lane(2));
+  ae_int32x2 p1 = AE_MOVDA32X2(a.lane(1) * b.lane(1), a.lane(0) * b.lane(0));
+  d0 = acc ? AE_ADD32(d0, p0) : p0;
+  d1 = acc ? AE_ADD32(d1, p1) : p1;
+}
+
+#define AE_MUL16X4(d0, d1, a, b)   cstub_mul16x4((d0), (d1), (a), (b), 0)
+#define AE_MULA16X4(d0, d1, a, b)  cstub_mul16x4((d0), (d1), (a), (b), 1)
+
+static inline ae_int32x2 AE_MUL16S(const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  return ae_int32x2((int32_t)a.lane(0) * b.lane(0));
+}
+
+/* Q15 x Q15 -> Q31 with saturation */
+static inline void cstub_mulf16x4ss(ae_int32x2 &d0, ae_int32x2 &d1, const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  int32_t p[4];
+  for(int k = 0; k < 4; k++)
+    p[k] = cstub_sat32(2 * (int64_t)a.lane(k) * b.lane(k));
+  d0 = AE_MOVDA32X2(p[3], p[2]);
+  d1 = AE_MOVDA32X2(p[1], p[0]);
+}
+
+#define AE_MULF16X4SS(d0, d1, a, b)  cstub_mulf16x4ss((d0), (d1), (a), (b))
+
+/* Q15 x Q15 -> Q15, truncated and saturated */
+static inline ae_f16x4 AE_MULFP16X4S(const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  CSTUB_MAP2(ae_f16x4, 4, a, b, cstub_sat16((x * y) >> 15))
+}
+
+/* Q15 x Q15 -> Q15, rounded half up and saturated */
+static inline ae_f16x4 AE_MULFP16X4RAS(const ae_int16x4 &a, const ae_int16x4 &b)
+{
+  CSTUB_MAP2(ae_f16x4, 4, a, b, cstub_sat16((x * y + (1 << 14)) >> 15))
+}
+
+/*---------------------------------------------------------------------------
+ * 32x16-bit and 32x32-bit
+ *-------------------------------------------------------------------------*/
+static inline ae_int64 AE_MUL32X16_L0(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(0) * b.lane(0); }
+static inline ae_int64 AE_MUL32X16_L1(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(0) * b.lane(1); }
+static inline ae_int64 AE_MUL32X16_L2(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(0) * b.lane(2); }
+static inline ae_int64 AE_MUL32X16_L3(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(0) * b.lane(3); }
+static inline ae_int64 AE_MUL32X16_H0(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(1) * b.lane(0); }
+static inline ae_int64 AE_MUL32X16_H1(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(1) * b.lane(1); }
+static inline ae_int64 AE_MUL32X16_H2(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(1) * b.lane(2); }
+static inline ae_int64 AE_MUL32X16_H3(const ae_int32x2 &a, const ae_int16x4 &b) { return (int64_t)a.lane(1) * b.lane(3); }
+
+#define AE_MULA32X16_L0(q, a, b)  cstub_acc64((q), AE_MUL32X16_L0((a), (b)).v)
+#define AE_MULA32X16_L1(q, a, b)  cstub_acc64((q), AE_MUL32X16_L1((a), (b)).v)
+#define AE_MULA32X16_L2(q, a, b)  cstub_acc64((q), AE_MUL32X16_L2((a), (b)).v)
+#define AE_MULA32X16_L3(q, a, b)  cstub_acc64((q), AE_MUL32X16_L3((a), (b)).v)
+#define AE_MULA32X16_H0(q, a, b)  cstub_acc64((q), AE_MUL32X16_H0((a), (b)).v)
+#define AE_MULA32X16_H1(q, a, b)  cstub_acc64((q), AE_MUL32X16_H1((a), (b)).v)
+#define AE_MULA32X16_H2(q, a, b)  cstub_acc64((q), AE_MUL32X16_H2((a), (b)).v)
+#define AE_MULA32X16_H3(q, a, b)  cstub_acc64((q), AE_MUL32X16_H3((a), (b)).v)
+
+static inline ae_int64 AE_MUL32_HH(const ae_int32x2 &a, const ae_int32x2 &b) { return (int64_t)a.lane(1) * b.lane(1); }
+static inline ae_int64 AE_MUL32_LL(const ae_int32x2 &a, const ae_int32x2 &b) { return (int64_t)a.lane(0) * b.lane(0); }
+static inline ae_int64 AE_MUL32U_LL(const ae_int32x2 &a, const ae_int32x2 &b)
+{
+  return (int64_t)((uint64_t)(uint32_t)a.lane(0) * (uint32_t)b.lane(0));
+}
+
+#define AE_MULA32_LL(q, a, b)  cstub_acc64((q), AE_MUL32_LL((a), (b)).v)
+#define AE_MULA32_HH(q, a, b)  cstub_acc64((q), AE_MUL32_HH((a), (b)).v)
+
+#define AE_MUL32X2S_HH_LL(h, l, a, b)  { (h) = AE_MUL32_HH((a), (b)); (l) = AE_MUL32_LL((a), (b)); }
+
+/* Q31 x Q31 -> Q63 with saturation */
+static inline ae_f64 AE_MULF32S_HH(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_sat64(2 * (__int128)a.lane(1) * b.lane(1)); }
+static inline ae_f64 AE_MULF32S_LL(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_sat64(2 * (__int128)a.lane(0) * b.lane(0)); }
+
+/* Q31 x Q31 -> Q31: asymmetric (RAS) or symmetric (RS) rounding */
+static inline int32_t cstub_mulf32_ras(int64_t x, int64_t y) { return cstub_sat32((int64_t)cstub_sra_rnd((__int128)x * y, 31)); }
+static inline int32_t cstub_mulf32_rs(int64_t x, int64_t y) { return cstub_sat32((int64_t)cstub_sra_sym((__int128)x * y, 31)); }
+
+static inline ae_f32x2 AE_MULFP32X2RAS(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_f32x2, 2, a, b, cstub_mulf32_ras(x, y)) }
+static inline ae_f32x2 AE_MULFP32X2RS(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_f32x2, 2, a, b, cstub_mulf32_rs(x, y)) }
+
+static inline ae_f32x2 cstub_mulaf32(const ae_int32x2 &d, const ae_int32x2 &a, const ae_int32x2 &b, int sym, int sub)
+{
+  ae_f32x2 r;
+  for(int k = 0; k < 2; k++)
+  {
+    int64_t p = sym ? cstub_mulf32_rs(a.lane(k), b.lane(k)) : cstub_mulf32_ras(a.lane(k), b.lane(k));
+    r.lane(k) = cstub_sat32((int64_t)d.lane(k) + (sub ? -p : p));
+  }
+  return r;
+}
+
+#define AE_MULAFP32X2RAS(d, a, b)  { (d) = cstub_mulaf32((d), (a), (b), 0, 0); }
+#define AE_MULSFP32X2RAS(d, a, b)  { (d) = cstub_mulaf32((d), (a), (b), 0, 1); }
+#define AE_MULAFP32X2RS(d, a, b)   { (d) = cstub_mulaf32((d), (a), (b), 1, 0); }
+#define AE_MULSFP32X2RS(d, a, b)   { (d) = cstub_mulaf32((d), (a), (b), 1, 1); }
+
+static inline ae_f32x2 AE_MULADDF32RAS(const ae_int32x2 &d, const ae_int32x2 &a, const ae_int32x2 &b)
+{
+  return cstub_mulaf32(d, a, b, 0, 0);
+}
+
+#define AE_MULF2P32X4RAS(d0, d1, a0, a1, b0, b1) \
+  { ae_f32x2 t0_ = AE_MULFP32X2RAS((a0), (b0)), t1_ = AE_MULFP32X2RAS((a1), (b1)); (d0) = t0_; (d1) = t1_; }
+#define AE_MULF2P32X4RS(d0, d1, a0, a1, b0, b1) \
+  { ae_f32x2 t0_ = AE_MULFP32X2RS((a0), (b0)), t1_ = AE_MULFP32X2RS((a1), (b1)); (d0) = t0_; (d1) = t1_; }
+#define AE_MULAF2P32X4RAS(d0, d1, a0, a1, b0, b1) \
+  { ae_f32x2 t0_ = cstub_mulaf32((d0), (a0), (b0), 0, 0), t1_ = cstub_mulaf32((d1), (a1), (b1), 0, 0); (d0) = t0_; (d1) = t1_; }
+#define AE_MULSF2P32X4RAS(d0, d1, a0, a1, b0, b1) \
+  { ae_f32x2 t0_ = cstub_mulaf32((d0), (a0), (b0), 0, 1), t1_ = cstub_mulaf32((d1), (a1), (b1), 0, 1); (d0) = t0_; (d1) = t1_; }
+#define AE_MULAF2P32X4RS(d0, d1, a0, a1, b0, b1) \
+  { ae_f32x2 t0_ = cstub_mulaf32((d0), (a0), (b0), 1, 0), t1_ = cstub_mulaf32((d1), (a1), (b1), 1, 0); (d0) = t0_; (d1) = t1_; }
+#define AE_MULSF2P32X4RS(d0, d1, a0, a1, b0, b1) \
+  { ae_f32x2 t0_ = cstub_mulaf32((d0), (a0), (b0), 1, 1), t1_ = cstub_mulaf32((d1), (a1), (b1), 1, 1); (d0) = t0_; (d1) = t1_; }
+
+/* Integer 32x32 products: high word (T) or saturated low word (S) */
+static inline ae_int32x2 cstub_mul32_t(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_int32x2, 2, a, b, (int32_t)((x * y) >> 32)) }
+static inline ae_int32x2 cstub_mul32_s(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_int32x2, 2, a, b, cstub_sat32(cstub_sat64((__int128)x * y))) }
+
+#define AE_MUL2P32X4T(d0, d1, a0, a1, b0, b1) \
+  { ae_int32x2 t0_ = cstub_mul32_t((a0), (b0)), t1_ = cstub_mul32_t((a1), (b1)); (d0) = t0_; (d1) = t1_; }
+#define AE_MUL2P32X4S(d0, d1, a0, a1, b0, b1) \
+  { ae_int32x2 t0_ = cstub_mul32_s((a0), (b0)), t1_ = cstub_mul32_s((a1), (b1)); (d0) = t0_; (d1) = t1_; }
+
+/* Q31 x Q15 -> Q31 with symmetric rounding */
+static inline ae_f32x2 AE_MULFP32X16X2RS_H(const ae_int32x2 &a, const ae_int16x4 &b)
+{
+  ae_f32x2 r;
+  r.lane(1) = cstub_sat32((int64_t)cstub_sra_sym((int64_t)a.lane(1) * b.lane(3), 15));
+  r.lane(0) = cstub_sat32((int64_t)cstub_sra_sym((int64_t)a.lane(0) * b.lane(2), 15));
+  return r;
+}
+
+static inline ae_f32x2 AE_MULFP32X16X2RS_L(const ae_int32x2 &a, const ae_int16x4 &b)
+{
+  ae_f32x2 r;
+  r.lane(1) = cstub_sat32((int64_t)cstub_sra_sym((int64_t)a.lane(1) * b.lane(1), 15));
+  r.lane(0) = cstub_sat32((int64_t)cstub_sra_sym((int64_t)a.lane(0) * b.lane(0), 15));
+  return r;
+}
+
+/* Q23 x Q23 -> Q23 on the low 24 bits of each lane, rounded */
+static inline int32_t cstub_sext24(int32_t x) { return (int32_t)((uint32_t)x << 8) >> 8; }
+
+static inline ae_f24x2 cstub_mulaf24(const ae_int32x2 &d, const ae_int32x2 &a, const ae_int32x2 &b, int sub)
+{
+  ae_f24x2 r;
+  for(int k = 0; k < 2; k++)
+  {
+    int64_t p = (int64_t)cstub_sra_rnd((int64_t)cstub_sext24(a.lane(k)) * cstub_sext24(b.lane(k)), 23);
+    r.lane(k) = cstub_wrap32((int64_t)d.lane(k) + (sub ? -p : p));
+  }
+  return r;
+}
+
+#define AE_MULAFP24X2RA(d, a, b)  { (d) = cstub_mulaf24((d), (a), (b), 0); }
+#define AE_MULSFP24X2RA(d, a, b)  { (d) = cstub_mulaf24((d), (a), (b), 1); }
+
+} /* extern "C++" */
+
+#endif /* __XA_NNLIB_CSTUB_MAC_H__ */
@@ -0,0 +1,664 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host emulation of the HiFi5 register-to-register operations: state
+ * registers, moves and reinterpretations, arithmetic, shifts, selects and
+ * the saturating/rounding conversions.
+ */
+#ifndef __XA_NNLIB_CSTUB_OPS_H__
+#define __XA_NNLIB_CSTUB_OPS_H__
+
+#include "xa_nnlib_cstub_common.h"
+
+extern "C++" {
+
+/*---------------------------------------------------------------------------
+ * State registers
+ *-------------------------------------------------------------------------*/
+static inline void WUR_AE_SAR(int x) { xa_nnlib_cstub_sar = x; }
+static inline void WAE_SAR(int x) { xa_nnlib_cstub_sar = x; }
+static inline int RUR_AE_SAR(void) { return xa_nnlib_cstub_sar; }
+
+static inline void AE_SETCBEGIN0(const void *p) { xa_nnlib_cstub_cbegin0 = (void *)p; }
+static inline void AE_SETCEND0(const void *p) { xa_nnlib_cstub_cend0 = (void *)p; }
+
+/* H half: AE_BIASV8, L half: AE_BIASC8 */
+static inline void AE_MOVZBVCDR(ae_int64 x)
+{
+  xa_nnlib_cstub_biasv8 = (int8_t)(x.v >> 32);
+  xa_nnlib_cstub_biasc8 = (int8_t)x.v;
+}
+
+static inline unsigned XT_RUR_FSR(void) { return xa_nnlib_cstub_fsr; }
+static inline void XT_WUR_FSR(unsigned x) { xa_nnlib_cstub_fsr = x; }
+
+static inline ae_valign AE_ZALIGN64(void) { ae_valign a = { 0 }; return a; }
+static inline ae_valignx2 AE_ZALIGN128(void) { ae_valignx2 a = { 0 }; return a; }
+
+/*---------------------------------------------------------------------------
+ * 64-bit register image of the vector types
+ *-------------------------------------------------------------------------*/
+static inline uint64_t cstub_img(const ae_int32x2 &x)
+{
+  return ((uint64_t)(uint32_t)x.lane(1) << 32) | (uint32_t)x.lane(0);
+}
+
+static inline uint64_t cstub_img(const ae_int16x4 &x)
+{
+  uint64_t r = 0;
+  for(int k = 3; k >= 0; k--)
+    r = (r << 16) | (uint16_t)x.lane(k);
+  return r;
+}
+
+static inline uint64_t cstub_img(const ae_int8x8 &x)
+{
+  uint64_t r = 0;
+  for(int k = 7; k >= 0; k--)
+    r = (r << 8) | (uint8_t)x.lane(k);
+  return r;
+}
+
+static inline ae_int32x2 cstub_int32x2(uint64_t r)
+{
+  ae_int32x2 x;
+  x.lane(1) = (int32_t)(r >> 32);
+  x.lane(0) = (int32_t)r;
+  return x;
+}
+
+static inline ae_int16x4 cstub_int16x4(uint64_t r)
+{
+  ae_int16x4 x;
+  for(int k = 0; k < 4; k++, r >>= 16)
+    x.lane(k) = (int16_t)r;
+  return x;
+}
+
+static inline ae_int8x8 cstub_int8x8(uint64_t r)
+{
+  ae_int8x8 x;
+  for(int k = 0; k < 8; k++, r >>= 8)
+    x.lane(k) = (int8_t)r;
+  return x;
+}
+
+/*---------------------------------------------------------------------------
+ * Moves and reinterpretations
+ *-------------------------------------------------------------------------*/
+static inline ae_int16x4 AE_ZERO16(void) { return ae_int16x4(0); }
+static inline ae_int32x2 AE_ZERO32(void) { return ae_int32x2(0); }
+static inline ae_int64 AE_ZERO64(void) { return ae_int64(0); }
+static inline ae_int8x8 AE_ZERO8(void) { return ae_int8x8(0); }
+
+static inline ae_int8x8 AE_MOVDA8(int x) { return ae_int8x8(x); }
+static inline ae_int16x4 AE_MOVDA16(int x) { return ae_int16x4(x); }
+static inline ae_int32x2 AE_MOVDA32(int x) { return ae_int32x2((int32_t)x); }
+static inline ae_int64 AE_MOVDA64(int x) { return ae_int64(x); }
+
+static inline ae_int32x2 AE_MOVDA32X2(int h, int l)
+{
+  ae_int32x2 x;
+  x.lane(1) = h;
+  x.lane(0) = l;
+  return x;
+}
+
+static inline int AE_MOVAD32_H(const ae_int32x2 &x) { return x.lane(1); }
+static inline int AE_MOVAD32_L(const ae_int32x2 &x) { return x.lane(0); }
+static inline int16_t AE_MOVAD16_0(const ae_int16x4 &x) { return x.lane(0); }
+static inline int16_t AE_MOVAD16_1(const ae_int16x4 &x) { return x.lane(1); }
+static inline int16_t AE_MOVAD16_2(const ae_int16x4 &x) { return x.lane(2); }
+static inline int16_t AE_MOVAD16_3(const ae_int16x4 &x) { return x.lane(3); }
+static inline int8_t AE_MOVAD8(const ae_int8x8 &x, int k) { return x.lane(k & 7); }
+
+static inline ae_int32 ae_int32x2_rtor_int32(const ae_int32x2 &x) { return ae_int32(x); }
+static inline ae_int32 ae_f32_rtor_int32(const ae_int32 &x) { return x; }
+
+static inline ae_int64 AE_MOVINT64_FROMINT32X2(const ae_int32x2 &x) { return (int64_t)cstub_img(x); }
+static inline ae_int64 AE_MOVINT64_FROMINT16X4(const ae_int16x4 &x) { return (int64_t)cstub_img(x); }
+static inline ae_int64 AE_MOVINT64_FROMINT8X8(const ae_int8x8 &x) { return (int64_t)cstub_img(x); }
+static inline ae_int64 AE_MOVINT64_FROMINT16(const ae_int16x4 &x) { return (int64_t)cstub_img(x); }
+static inline ae_int32x2 AE_MOVINT32X2_FROMINT64(const ae_int64 &x) { return cstub_int32x2(x.v); }
+static inline ae_int32x2 AE_MOVINT32X2_FROMINT16X4(const ae_int16x4 &x) { return cstub_int32x2(cstub_img(x)); }
+static inline ae_int32x2 AE_MOVINT32X2_FROMINT8X8(const ae_int8x8 &x) { return cstub_int32x2(cstub_img(x)); }
+static inline ae_int16x4 AE_MOVINT16X4_FROMINT64(const ae_int64 &x) { return cstub_int16x4(x.v); }
+static inline ae_int16x4 AE_MOVINT16X4_FROMINT32X2(const ae_int32x2 &x) { return cstub_int16x4(cstub_img(x)); }
+static inline ae_int16x4 AE_MOVINT16X4_FROMINT8X8(const ae_int8x8 &x) { return cstub_int16x4(cstub_img(x)); }
+static inline ae_int8x8 AE_MOVINT8X8_FROMINT64(const ae_int64 &x) { return cstub_int8x8(x.v); }
+static inline ae_int8x8 AE_MOVINT8X8_FROMINT32X2(const ae_int32x2 &x) { return cstub_int8x8(cstub_img(x)); }
+static inline ae_int8x8 AE_MOVINT8X8_FROMINT16X4(const ae_int16x4 &x) { return cstub_int8x8(cstub_img(x)); }
+static inline ae_int8x8 AE_MOVINT8X8_FROMINT32(const ae_int32 &x) { return cstub_int8x8(cstub_img(ae_int32x2(x))); }
+static inline ae_int16 AE_MOVINT16_FROMINT32(const ae_int32 &x) { return (int16_t)x.v; }
+static inline ae_int8 AE_MOVINT8_FROMINT8X8(const ae_int8x8 &x) { return ae_int8(x); }
+
+static inline ae_f64 AE_MOVF64_FROMF32X2(const ae_int32x2 &x) { return (int64_t)cstub_img(x); }
+static inline ae_f64 AE_MOVF64_FROMF16X4(const ae_int16x4 &x) { return (int64_t)cstub_img(x); }
+static inline ae_f16x4 AE_MOVF16X4_FROMF64(const ae_int64 &x) { return cstub_int16x4(x.v); }
+static inline ae_f32x2 AE_MOVF32X2_FROMINT32X2(const ae_int32x2 &x) { return x; }
+static inline ae_f24x2 AE_MOVF24X2_FROMINT32X2(const ae_int32x2 &x) { return x; }
+
+/*---------------------------------------------------------------------------
+ * Lane-wise helpers
+ *-------------------------------------------------------------------------*/
+#define CSTUB_MAP2(T, N, a, b, expr)                                          \
+  T r;                                                                        \
+  for(int k = 0; k < N; k++)                                                  \
+  {                                                                           \
+    int64_t x = (a).lane(k), y = (b).lane(k);                                 \
+    (void)y;                                                                  \
+    r.lane(k) = (expr);                                                       \
+  }                                                                           \
+  return r;
+
+/*---------------------------------------------------------------------------
+ * Arithmetic
+ *-------------------------------------------------------------------------*/
+static inline ae_int32x2 AE_ADD32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_int32x2, 2, a, b, (int32_t)(x + y)) }
+static inline ae_int32x2 AE_SUB32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_int32x2, 2, a, b, (int32_t)(x - y)) }
+static inline ae_f32x2 AE_ADD32S(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_f32x2, 2, a, b, cstub_sat32(x + y)) }
+static inline ae_f32x2 AE_SUB32S(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_f32x2, 2, a, b, cstub_sat32(x - y)) }
+static inline ae_int32x2 AE_NEG32(const ae_int32x2 &a) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)-x) }
+static inline ae_f32x2 AE_NEG32S(const ae_int32x2 &a) { CSTUB_MAP2(ae_f32x2, 2, a, a, cstub_sat32(-x)) }
+static inline ae_int32x2 AE_ABS32(const ae_int32x2 &a) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)(x < 0 ? -x : x)) }
+static inline ae_f32x2 AE_ABS32S(const ae_int32x2 &a) { CSTUB_MAP2(ae_f32x2, 2, a, a, cstub_sat32(x < 0 ? -x : x)) }
+static inline ae_int32x2 AE_MAX32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_int32x2, 2, a, b, (int32_t)(x > y ? x : y)) }
+static inline ae_int32x2 AE_MIN32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_MAP2(ae_int32x2, 2, a, b, (int32_t)(x < y ? x : y)) }
+
+static inline ae_int16x4 AE_ADD16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_MAP2(ae_int16x4, 4, a, b, (int16_t)(x + y)) }
+static inline ae_int16x4 AE_SUB16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_MAP2(ae_int16x4, 4, a, b, (int16_t)(x - y)) }
+static inline ae_f16x4 AE_ADD16S(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_MAP2(ae_f16x4, 4, a, b, cstub_sat16(x + y)) }
+static inline ae_f16x4 AE_SUB16S(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_MAP2(ae_f16x4, 4, a, b, cstub_sat16(x - y)) }
+static inline ae_f16x4 AE_NEG16S(const ae_int16x4 &a) { CSTUB_MAP2(ae_f16x4, 4, a, a, cstub_sat16(-x)) }
+static inline ae_int16x4 AE_MAX16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_MAP2(ae_int16x4, 4, a, b, (int16_t)(x > y ? x : y)) }
+static inline ae_int16x4 AE_MIN16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_MAP2(ae_int16x4, 4, a, b, (int16_t)(x < y ? x : y)) }
+
+static inline ae_int8x8 AE_ADD8(const ae_int8x8 &a, const ae_int8x8 &b) { CSTUB_MAP2(ae_int8x8, 8, a, b, (int8_t)(x + y)) }
+static inline ae_int8x8 AE_SUB8(const ae_int8x8 &a, const ae_int8x8 &b) { CSTUB_MAP2(ae_int8x8, 8, a, b, (int8_t)(x - y)) }
+static inline ae_int8x8 AE_MAX8(const ae_int8x8 &a, const ae_int8x8 &b) { CSTUB_MAP2(ae_int8x8, 8, a, b, (int8_t)(x > y ? x : y)) }
+static inline ae_int8x8 AE_MIN8(const ae_int8x8 &a, const ae_int8x8 &b) { CSTUB_MAP2(ae_int8x8, 8, a, b, (int8_t)(x < y ? x : y)) }
+
+static inline ae_int64 AE_ADD64(const ae_int64 &a, const ae_int64 &b) { return (int64_t)((uint64_t)a.v + (uint64_t)b.v); }
+static inline ae_int64 AE_SUB64(const ae_int64 &a, const ae_int64 &b) { return (int64_t)((uint64_t)a.v - (uint64_t)b.v); }
+static inline ae_f64 AE_ADD64S(const ae_int64 &a, const ae_int64 &b) { return cstub_sat64((__int128)a.v + b.v); }
+static inline ae_f64 AE_SUB64S(const ae_int64 &a, const ae_int64 &b) { return cstub_sat64((__int128)a.v - b.v); }
+
+#define AE_MINMAX16(x, mn, mx)  { (x) = AE_MIN16(AE_MAX16((x), (mn)), (mx)); }
+#define AE_MINMAX32(x, mn, mx)  { (x) = AE_MIN32(AE_MAX32((x), (mn)), (mx)); }
+
+/* Negate d where the sign of t is set */
+static inline ae_f32x2 AE_MOVNEG32S_T(const ae_int32x2 &d, const ae_int32x2 &t)
+{
+  CSTUB_MAP2(ae_f32x2, 2, d, t, cstub_sat32(y < 0 ? -x : x))
+}
+
+/* Sign extension of the 16-bit halves */
+static inline ae_int32x2 AE_SEXT32X2D16_32(const ae_int16x4 &a)
+{
+  ae_int32x2 r;
+  r.lane(1) = a.lane(3);
+  r.lane(0) = a.lane(2);
+  return r;
+}
+
+static inline ae_int32x2 AE_SEXT32X2D16_10(const ae_int16x4 &a)
+{
+  ae_int32x2 r;
+  r.lane(1) = a.lane(1);
+  r.lane(0) = a.lane(0);
+  return r;
+}
+
+/* (x & (2^w - 1)) << s */
+static inline ae_int32x2 AE_MOVDEXT(const ae_int32x2 &a, int w, int s)
+{
+  CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)((uint32_t)(x & ((1LL << w) - 1)) << s))
+}
+
+/*---------------------------------------------------------------------------
+ * Logic
+ *-------------------------------------------------------------------------*/
+static inline ae_int16x4 AE_AND16(const ae_int16x4 &a, const ae_int16x4 &b) { return a & b; }
+static inline ae_int16x4 AE_OR16(const ae_int16x4 &a, const ae_int16x4 &b) { return a | b; }
+static inline ae_int32x2 AE_AND32(const ae_int32x2 &a, const ae_int32x2 &b) { return a & b; }
+static inline ae_int32x2 AE_OR32(const ae_int32x2 &a, const ae_int32x2 &b) { return a | b; }
+static inline ae_int64 AE_AND(const ae_int64 &a, const ae_int64 &b) { return a & b; }
+static inline ae_int64 AE_OR(const ae_int64 &a, const ae_int64 &b) { return a | b; }
+static inline ae_int64 AE_XOR(const ae_int64 &a, const ae_int64 &b) { return a ^ b; }
+
+/*---------------------------------------------------------------------------
+ * Shifts. A negative amount on the _A(mount) forms reverses the direction.
+ *-------------------------------------------------------------------------*/
+static inline int64_t cstub_slaa(int64_t x, int s, int bits, int sat)
+{
+  if(s < 0)
+    return (int64_t)cstub_sra(x, -s);
+  if(sat)
+    return cstub_shift_sat(x, s, bits);
+  return s >= bits ? 0 : (int64_t)((uint64_t)x << s);
+}
+
+static inline int64_t cstub_sraa(int64_t x, int s, int bits, int sat)
+{
+  return cstub_slaa(x, -s, bits, sat);
+}
+
+static inline ae_int32x2 AE_SLAI32(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)cstub_slaa(x, s, 32, 0)) }
+static inline ae_f32x2 AE_SLAI32S(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_f32x2, 2, a, a, (int32_t)cstub_slaa(x, s, 32, 1)) }
+static inline ae_int32x2 AE_SLAA32(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)cstub_slaa(x, s, 32, 0)) }
+static inline ae_f32x2 AE_SLAA32S(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_f32x2, 2, a, a, (int32_t)cstub_slaa(x, s, 32, 1)) }
+static inline ae_int32x2 AE_SLLI32(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)((uint32_t)x << s)) }
+static inline ae_int32x2 AE_SRLI32(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)((uint32_t)x >> s)) }
+static inline ae_int32x2 AE_SRAI32(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)(x >> s)) }
+static inline ae_int32x2 AE_SRAA32(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)cstub_sraa(x, s, 32, 0)) }
+static inline ae_int32x2 AE_SRAI32R(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_int32x2, 2, a, a, (int32_t)cstub_sra_rnd(x, s)) }
+
+static inline int32_t cstub_sraa32_rs(int64_t x, int s)
+{
+  if(s <= 0)
+    return (int32_t)cstub_shift_sat(x, -s, 32);
+  return cstub_sat32((int64_t)cstub_sra_rnd(x, s));
+}
+
+static inline int32_t cstub_sraa32_syms(int64_t x, int s)
+{
+  if(s <= 0)
+    return (int32_t)cstub_shift_sat(x, -s, 32);
+  return cstub_sat32((int64_t)cstub_sra_sym(x, s));
+}
+
+static inline ae_f32x2 AE_SRAA32RS(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_f32x2, 2, a, a, cstub_sraa32_rs(x, s)) }
+static inline ae_f32x2 AE_SRAA32SYMS(const ae_int32x2 &a, int s) { CSTUB_MAP2(ae_f32x2, 2, a, a, cstub_sraa32_syms(x, s)) }
+static inline ae_f32x2 AE_SRAV32RS(const ae_int32x2 &a, const ae_int32x2 &s) { CSTUB_MAP2(ae_f32x2, 2, a, s, cstub_sraa32_rs(x, (int)y)) }
+static inline ae_f32x2 AE_SLAS32(const ae_int32x2 &a) { CSTUB_MAP2(ae_f32x2, 2, a, a, (int32_t)cstub_slaa(x, xa_nnlib_cstub_sar, 32, 1)) }
+
+static inline ae_f16x4 AE_SLAI16S(const ae_int16x4 &a, int s) { CSTUB_MAP2(ae_f16x4, 4, a, a, (int16_t)cstub_slaa(x, s, 16, 1)) }
+static inline ae_f16x4 AE_SLAA16S(const ae_int16x4 &a, int s) { CSTUB_MAP2(ae_f16x4, 4, a, a, (int16_t)cstub_slaa(x, s, 16, 1)) }
+static inline ae_f16x4 AE_SRAA16S(const ae_int16x4 &a, int s) { CSTUB_MAP2(ae_f16x4, 4, a, a, (int16_t)cstub_sraa(x, s, 16, 1)) }
+static inline ae_int16x4 AE_SRAI16(const ae_int16x4 &a, int s) { CSTUB_MAP2(ae_int16x4, 4, a, a, (int16_t)(x >> s)) }
+
+static inline ae_int64 AE_SLAI64(const ae_int64 &a, int s) { return cstub_shift_wrap(a.v, s); }
+static inline ae_int64 AE_SLLI64(const ae_int64 &a, int s) { return cstub_shift_wrap(a.v, s); }
+static inline ae_int64 AE_SLAA64(const ae_int64 &a, int s) { return cstub_shift_wrap(a.v, s); }
+static inline ae_f64 AE_SLAI64S(const ae_int64 &a, int s) { return cstub_slaa(a.v, s, 64, 1); }
+static inline ae_f64 AE_SLAA64S(const ae_int64 &a, int s) { return cstub_slaa(a.v, s, 64, 1); }
+static inline ae_f64 AE_SLAS64S(const ae_int64 &a) { return cstub_slaa(a.v, xa_nnlib_cstub_sar, 64, 1); }
+static inline ae_int64 AE_SRAI64(const ae_int64 &a, int s) { return cstub_shift_wrap(a.v, -s); }
+static inline ae_int64 AE_SRAA64(const ae_int64 &a, int s) { return cstub_shift_wrap(a.v, -s); }
+
+static inline ae_int64 AE_SRLI64(const ae_int64 &a, int s)
+{
+  return s > 63 ? 0 : (int64_t)((uint64_t)a.v >> s);
+}
+
+static inline ae_int64 AE_SRLA64(const ae_int64 &a, int s)
+{
+  if(s < 0)
+    return cstub_shift_wrap(a.v, -s);
+  return AE_SRLI64(a, s);
+}
+
+/*---------------------------------------------------------------------------
+ * Comparisons and conditional moves
+ *-------------------------------------------------------------------------*/
+#define CSTUB_CMP(T, N, BT, a, b, cond)                                       \
+  BT r = { 0 };                                                               \
+  for(int k = 0; k < N; k++)                                                  \
+  {                                                                           \
+    int64_t x = (a).lane(k), y = (b).lane(k);                                 \
+    if(cond) r.v |= 1u << k;                                                  \
+  }                                                                           \
+  return r;
+
+static inline xtbool2 AE_EQ32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_CMP(ae_int32x2, 2, xtbool2, a, b, x == y) }
+static inline xtbool2 AE_LT32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_CMP(ae_int32x2, 2, xtbool2, a, b, x < y) }
+static inline xtbool2 AE_LE32(const ae_int32x2 &a, const ae_int32x2 &b) { CSTUB_CMP(ae_int32x2, 2, xtbool2, a, b, x <= y) }
+static inline xtbool4 AE_LT16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_CMP(ae_int16x4, 4, xtbool4, a, b, x < y) }
+static inline xtbool4 AE_LE16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_CMP(ae_int16x4, 4, xtbool4, a, b, x <= y) }
+static inline xtbool4 AE_EQ16(const ae_int16x4 &a, const ae_int16x4 &b) { CSTUB_CMP(ae_int16x4, 4, xtbool4, a, b, x == y) }
+
+static inline xtbool AE_LE64(const ae_int64 &a, const ae_int64 &b) { xtbool r = { a.v <= b.v }; return r; }
+static inline xtbool AE_LT64(const ae_int64 &a, const ae_int64 &b) { xtbool r = { a.v < b.v }; return r; }
+static inline xtbool AE_EQ64(const ae_int64 &a, const ae_int64 &b) { xtbool r = { a.v == b.v }; return r; }
+
+static inline xtbool AE_MOVBA(unsigned x) { xtbool r = { x & 1 }; return r; }
+#define AE_MOVBA AE_MOVBA
+static inline xtbool xtbool2_extract_0(xtbool2 b) { xtbool r = { b.v & 1 }; return r; }
+static inline xtbool xtbool2_extract_1(xtbool2 b) { xtbool r = { (b.v >> 1) & 1 }; return r; }
+static inline xtbool xtbool2_extract_0(xtbool b) { return b; }
+
+template <class T> static inline void cstub_movt(T &d, const T &s, unsigned b, int n)
+{
+  for(int k = 0; k < n; k++)
+    if((b >> k) & 1)
+      d.lane(k) = s.lane(k);
+}
+
+static inline void cstub_movt32x2(ae_int32x2 &d, const ae_int32x2 &s, unsigned b) { cstub_movt(d, s, b, 2); }
+static inline void cstub_movt16x4(ae_int16x4 &d, const ae_int16x4 &s, unsigned b) { cstub_movt(d, s, b, 4); }
+
+#define AE_MOVT32X2(d, s, b)  cstub_movt32x2((d), (s), (b).v)
+#define AE_MOVF32X2(d, s, b)  cstub_movt32x2((d), (s), ~(b).v)
+#define AE_MOVT16X4(d, s, b)  cstub_movt16x4((d), (s), (b).v)
+#define AE_MOVF16X4(d, s, b)  cstub_movt16x4((d), (s), ~(b).v)
+#define AE_MOVT64(d, s, b)    { if((b).v & 1) (d) = (s); }
+#define AE_MOVF64(d, s, b)    { if(!((b).v & 1)) (d) = (s); }
+
+/*---------------------------------------------------------------------------
+ * Selects
+ *-------------------------------------------------------------------------*/
+static inline ae_int32x2 AE_SEL32_HH(const ae_int32x2 &a, const ae_int32x2 &b) { return AE_MOVDA32X2(a.lane(1), b.lane(1)); }
+static inline ae_int32x2 AE_SEL32_HL(const ae_int32x2 &a, const ae_int32x2 &b) { return AE_MOVDA32X2(a.lane(1), b.lane(0)); }
+static inline ae_int32x2 AE_SEL32_LH(const ae_int32x2 &a, const ae_int32x2 &b) { return AE_MOVDA32X2(a.lane(0), b.lane(1)); }
+static inline ae_int32x2 AE_SEL32_LL(const ae_int32x2 &a, const ae_int32x2 &b) { return AE_MOVDA32X2(a.lane(0), b.lane(0)); }
+#define AE_SEL32_LH_SX2 XT_SEL32_LH_SX2
+
+static inline ae_int16x4 AE_SHORTSWAP(const ae_int16x4 &a)
+{
+  ae_int16x4 r;
+  for(int k = 0; k < 4; k++)
+    r.lane(k) = a.lane(3 - k);
+  return r;
+}
+
+/* Output lanes 3..0 take src[A], src[B], src[C], src[D] of {a, b} */
+static inline ae_int16x4 cstub_sel16(const ae_int16x4 &a, const ae_int16x4 &b, int s3, int s2, int s1, int s0)
+{
+  int16_t src[8];
+  int sel[4] = { s0, s1, s2, s3 };
+  ae_int16x4 r;
+  for(int k = 0; k < 4; k++)
+  {
+    src[k] = b.lane(k);
+    src[4 + k] = a.lane(k);
+  }
+  for(int k = 0; k < 4; k++)
+    r.lane(k) = src[sel[k]];
+  return r;
+}
+
+static inline ae_int16x4 AE_SEL16_2301(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_sel16(a, b, 2, 3, 0, 1); }
+static inline ae_int16x4 AE_SEL16_5432(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_sel16(a, b, 5, 4, 3, 2); }
+static inline ae_int16x4 AE_SEL16_6420(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_sel16(a, b, 6, 4, 2, 0); }
+static inline ae_int16x4 AE_SEL16_6543(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_sel16(a, b, 6, 5, 4, 3); }
+static inline ae_int16x4 AE_SEL16_7362(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_sel16(a, b, 7, 3, 6, 2); }
+static inline ae_int16x4 AE_SEL16_7531(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_sel16(a, b, 7, 5, 3, 1); }
+#define AE_SEL16_7531 AE_SEL16_7531
+
+/* Byte select: index 15..8 are lanes 7..0 of a, 7..0 are lanes 7..0 of b */
+static inline int8_t cstub_sel_src(const ae_int8x8 &a, const ae_int8x8 &b, int idx)
+{
+  idx &= 0xf;
+  return idx >= 8 ? a.lane(idx - 8) : b.lane(idx);
+}
+
+static inline ae_int8x8 AE_SEL8X8(const ae_int8x8 &a, const ae_int8x8 &b, const ae_int8x8 &sel)
+{
+  ae_int8x8 r;
+  for(int k = 0; k < 8; k++)
+    r.lane(k) = cstub_sel_src(a, b, sel.lane(k));
+  return r;
+}
+
+#define AE_DSEL8X8(o0, o1, a, b, sel) cstub_dsel8x8((o0), (o1), (a), (b), (sel))
+static inline void cstub_dsel8x8(ae_int8x8 &o0, ae_int8x8 &o1, const ae_int8x8 &a, const ae_int8x8 &b, const ae_int8x8 &sel)
+{
+  ae_int8x8 r0, r1;
+  for(int k = 0; k < 8; k++)
+  {
+    r0.lane(k) = cstub_sel_src(a, b, (uint8_t)sel.lane(k) >> 4);
+    r1.lane(k) = cstub_sel_src(a, b, sel.lane(k) & 0xf);
+  }
+  o0 = r0;
+  o1 = r1;
+}
+
+static inline ae_int8x8 AE_SEL8X8I(const ae_int8x8 &a, const ae_int8x8 &b, int imm)
+{
+  ae_int8x8 r;
+  int k;
+  switch(imm)
+  {
+    case 3:   /* {a3..a0, b3..b0} */
+      for(k = 0; k < 4; k++)
+      {
+        r.lane(4 + k) = a.lane(k);
+        r.lane(k) = b.lane(k);
+      }
+      break;
+    case 19:  /* {a, b} >> 8 */
+      for(k = 0; k < 8; k++)
+        r.lane(k) = cstub_sel_src(a, b, k + 1);
+      break;
+    case 25:  /* even lanes */
+      for(k = 0; k < 4; k++)
+      {
+        r.lane(4 + k) = a.lane(2 * k);
+        r.lane(k) = b.lane(2 * k);
+      }
+      break;
+    case 26:  /* odd lanes */
+      for(k = 0; k < 4; k++)
+      {
+        r.lane(4 + k) = a.lane(2 * k + 1);
+        r.lane(k) = b.lane(2 * k + 1);
+      }
+      break;
+    default:
+      assert(!"AE_SEL8X8I: selection not emulated");
+      r = a;
+      break;
+  }
+  return r;
+}
+
+/* Only selection 8 is used: the low 16 bits of each 32-bit lane */
+static inline ae_int32x2 AE_SEL32I(const ae_int32x2 &a, const ae_int32x2 &b, int imm)
+{
+  assert(imm == 8);
+  (void)imm;
+  return AE_MOVINT32X2_FROMINT16X4(cstub_sel16(AE_MOVINT16X4_FROMINT32X2(a), AE_MOVINT16X4_FROMINT32X2(b), 6, 4, 2, 0));
+}
+
+/*---------------------------------------------------------------------------
+ * Saturation, rounding, truncation and conversions
+ *-------------------------------------------------------------------------*/
+static inline ae_int16x4 cstub_pack16(const ae_int32x2 &a, const ae_int32x2 &b, int16_t (*f)(int64_t))
+{
+  ae_int16x4 r;
+  r.lane(3) = f(a.lane(1));
+  r.lane(2) = f(a.lane(0));
+  r.lane(1) = f(b.lane(1));
+  r.lane(0) = f(b.lane(0));
+  return r;
+}
+
+static inline int16_t cstub_f_sat16(int64_t x) { return cstub_sat16(x); }
+static inline int16_t cstub_f_satu16(int64_t x) { return (int16_t)cstub_satu(x, 16); }
+static inline int16_t cstub_f_wrap16(int64_t x) { return (int16_t)x; }
+static inline int16_t cstub_f_hi16(int64_t x) { return (int16_t)(x >> 16); }
+static inline int16_t cstub_f_rnd16_sym(int64_t x) { return cstub_sat16((int64_t)cstub_sra_sym(x, 16)); }
+static inline int16_t cstub_f_rnd16_asym(int64_t x) { return cstub_sat16((int64_t)cstub_sra_rnd(x, 16)); }
+
+static inline ae_f16x4 AE_SAT16X4(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack16(a, b, cstub_f_sat16); }
+static inline ae_int16x4 AE_SATU16X4(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack16(a, b, cstub_f_satu16); }
+static inline ae_int16x4 AE_CVT16X4(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack16(a, b, cstub_f_wrap16); }
+static inline ae_f16x4 AE_TRUNC16X4F32(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack16(a, b, cstub_f_hi16); }
+static inline ae_f16x4 AE_ROUND16X4F32SSYM(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack16(a, b, cstub_f_rnd16_sym); }
+static inline ae_f16x4 AE_ROUND16X4F32SASYM(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack16(a, b, cstub_f_rnd16_asym); }
+
+/* sat32(x << s) >> 16 per lane */
+static inline ae_f16x4 AE_TRUNCA16X4F32S(const ae_int32x2 &a, const ae_int32x2 &b, int s)
+{
+  ae_int16x4 r;
+  r.lane(3) = (int16_t)(cstub_slaa(a.lane(1), s, 32, 1) >> 16);
+  r.lane(2) = (int16_t)(cstub_slaa(a.lane(0), s, 32, 1) >> 16);
+  r.lane(1) = (int16_t)(cstub_slaa(b.lane(1), s, 32, 1) >> 16);
+  r.lane(0) = (int16_t)(cstub_slaa(b.lane(0), s, 32, 1) >> 16);
+  return r;
+}
+
+/* 16x4 + 16x4 -> 8x8 */
+static inline ae_int8x8 cstub_pack8(const ae_int16x4 &a, const ae_int16x4 &b, int8_t (*f)(int64_t))
+{
+  ae_int8x8 r;
+  for(int k = 0; k < 4; k++)
+  {
+    r.lane(4 + k) = f(a.lane(k));
+    r.lane(k) = f(b.lane(k));
+  }
+  return r;
+}
+
+static inline int8_t cstub_f_sat8(int64_t x) { return cstub_sat8(x); }
+static inline int8_t cstub_f_satu8(int64_t x) { return (int8_t)cstub_satu(x, 8); }
+static inline int8_t cstub_f_rnd8_sym(int64_t x) { return cstub_sat8((int64_t)cstub_sra_sym(x, 8)); }
+
+static inline ae_int8x8 AE_SAT8X8X16(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_pack8(a, b, cstub_f_sat8); }
+static inline ae_int8x8 AE_SATU8X8X16(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_pack8(a, b, cstub_f_satu8); }
+static inline ae_int8x8 AE_ROUND8X8F16SSYM(const ae_int16x4 &a, const ae_int16x4 &b) { return cstub_pack8(a, b, cstub_f_rnd8_sym); }
+
+/* 32x2 + 32x2 -> lanes 3..0 of an 8x8, replicated into lanes 7..4 */
+static inline ae_int8x8 cstub_pack8x4(const ae_int32x2 &a, const ae_int32x2 &b, int8_t (*f)(int64_t))
+{
+  ae_int8x8 r;
+  r.lane(3) = r.lane(7) = f(a.lane(1));
+  r.lane(2) = r.lane(6) = f(a.lane(0));
+  r.lane(1) = r.lane(5) = f(b.lane(1));
+  r.lane(0) = r.lane(4) = f(b.lane(0));
+  return r;
+}
+
+static inline int8_t cstub_f_rnd8_asym24(int64_t x) { return cstub_sat8((int64_t)cstub_sra_rnd(x, 24)); }
+
+static inline ae_int8x8 AE_SAT8X4X32_L(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack8x4(a, b, cstub_f_sat8); }
+static inline ae_int8x8 AE_SATU8X4X32_L(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack8x4(a, b, cstub_f_satu8); }
+static inline ae_int8x8 AE_ROUND8X4F32SASYM_L(const ae_int32x2 &a, const ae_int32x2 &b) { return cstub_pack8x4(a, b, cstub_f_rnd8_asym24); }
+
+/* 64 -> 32 */
+static inline int32_t cstub_rnd32f64_sym(int64_t x) { return cstub_sat32((int64_t)cstub_sra_sym(x, 32)); }
+static inline int32_t cstub_trunc32f64(int64_t x, int s) { return (int32_t)(cstub_slaa(x, s, 64, 1) >> 32); }
+
+static inline ae_f32x2 AE_ROUND32F64SSYM(const ae_int64 &a) { return ae_int32x2(cstub_rnd32f64_sym(a.v)); }
+static inline ae_f32x2 AE_ROUND32X2F64SSYM(const ae_int64 &a, const ae_int64 &b) { return AE_MOVDA32X2(cstub_rnd32f64_sym(a.v), cstub_rnd32f64_sym(b.v)); }
+static inline ae_f32x2 AE_TRUNCA32F64S(const ae_int64 &a, int s) { return ae_int32x2(cstub_trunc32f64(a.v, s)); }
+static inline ae_f32x2 AE_TRUNCA32X2F64S(const ae_int64 &a, const ae_int64 &b, int s) { return AE_MOVDA32X2(cstub_trunc32f64(a.v, s), cstub_trunc32f64(b.v, s)); }
+static inline ae_f32x2 AE_TRUNCI32X2F64S(const ae_int64 &a, const ae_int64 &b, int s) { return AE_MOVDA32X2(cstub_trunc32f64(a.v, s), cstub_trunc32f64(b.v, s)); }
+static inline ae_f32x2 AE_SAT32X2(const ae_int64 &a, const ae_int64 &b) { return AE_MOVDA32X2(cstub_sat32(a.v), cstub_sat32(b.v)); }
+
+/* 32 -> 64 */
+static inline ae_int64 AE_CVT64A32(const ae_int32 &a) { return (int64_t)a.v; }
+static inline ae_f64 AE_CVT64F32_H(const ae_int32x2 &a) { return (int64_t)((uint64_t)(int64_t)a.lane(1) << 32); }
+static inline ae_f64 AE_CVT64F32_L(const ae_int32x2 &a) { return (int64_t)((uint64_t)(int64_t)a.lane(0) << 32); }
+static inline ae_q56s AE_CVTQ48A32S(int a) { return (int64_t)a * 65536; }
+
+/* Widening conversions; the immediate/amount is a left shift */
+#define AE_CVTI32X4F16(o0, o1, a, i)    cstub_cvt32x4f16((o0), (o1), (a), (i), 0)
+#define AE_CVTA32X4F16S(o0, o1, a, s)   cstub_cvt32x4f16((o0), (o1), (a), (s), 1)
+#define AE_CVTA32X4F8_L(o0, o1, a, s)   cstub_cvt32x4f8_l((o0), (o1), (a), (s))
+#define AE_CVTI16X4X2F8(o0, o1, a, i)   cstub_cvt16x4x2f8((o0), (o1), (a), (i))
+
+static inline void cstub_cvt32x4f16(ae_int32x2 &o0, ae_int32x2 &o1, const ae_int16x4 &a, int s, int sat)
+{
+  o0 = AE_MOVDA32X2((int32_t)cstub_slaa(a.lane(3), s, 32, sat), (int32_t)cstub_slaa(a.lane(2), s, 32, sat));
+  o1 = AE_MOVDA32X2((int32_t)cstub_slaa(a.lane(1), s, 32, sat), (int32_t)cstub_slaa(a.lane(0), s, 32, sat));
+}
+
+static inline void cstub_cvt32x4f8_l(ae_int32x2 &o0, ae_int32x2 &o1, const ae_int8x8 &a, int s)
+{
+  o0 = AE_MOVDA32X2((int32_t)cstub_slaa(a.lane(3), s, 32, 1), (int32_t)cstub_slaa(a.lane(2), s, 32, 1));
+  o1 = AE_MOVDA32X2((int32_t)cstub_slaa(a.lane(1), s, 32, 1), (int32_t)cstub_slaa(a.lane(0), s, 32, 1));
+}
+
+static inline void cstub_cvt16x4x2f8(ae_int16x4 &o0, ae_int16x4 &o1, const ae_int8x8 &a, int s)
+{
+  ae_int16x4 r0, r1;
+  for(int k = 0; k < 4; k++)
+  {
+    r0.lane(k) = (int16_t)(a.lane(4 + k) << s);
+    r1.lane(k) = (int16_t)(a.lane(k) << s);
+  }
+  o0 = r0;
+  o1 = r1;
+}
+
+/*---------------------------------------------------------------------------
+ * Widening add/subtract: the H output takes the upper half of the lanes
+ *-------------------------------------------------------------------------*/
+#define CSTUB_WIDEN(name, TO, TI, NO, lanefn, expr, acc)                      \
+static inline void name(TO &o0, TO &o1, const TI &a, const TI &b)             \
+{                                                                             \
+  TO r0 = acc ? o0 : TO(0), r1 = acc ? o1 : TO(0);                            \
+  for(int k = 0; k < NO; k++)                                                 \
+  {                                                                           \
+    int64_t xh = lanefn(a.lane(NO + k)), yh = lanefn(b.lane(NO + k));         \
+    int64_t xl = lanefn(a.lane(k)), yl = lanefn(b.lane(k));                   \
+    { int64_t x = xh, y = yh; r0.lane(k) += (expr); }                         \
+    { int64_t x = xl, y = yl; r1.lane(k) += (expr); }                         \
+  }                                                                           \
+  o0 = r0;                                                                    \
+  o1 = r1;                                                                    \
+}
+
+#define CSTUB_SX(x)   ((int64_t)(x))
+#define CSTUB_UX8(x)  ((int64_t)(uint8_t)(x))
+
+CSTUB_WIDEN(cstub_addw8,   ae_int16x4, ae_int8x8, 4, CSTUB_SX,  x + y, 0)
+CSTUB_WIDEN(cstub_addw8u,  ae_int16x4, ae_int8x8, 4, CSTUB_UX8, x + y, 0)
+CSTUB_WIDEN(cstub_subw8,   ae_int16x4, ae_int8x8, 4, CSTUB_SX,  x - y, 0)
+CSTUB_WIDEN(cstub_subw8u,  ae_int16x4, ae_int8x8, 4, CSTUB_UX8, x - y, 0)
+CSTUB_WIDEN(cstub_accw8,   ae_int16x4, ae_int8x8, 4, CSTUB_SX,  x + y, 1)
+CSTUB_WIDEN(cstub_accw8u,  ae_int16x4, ae_int8x8, 4, CSTUB_UX8, x + y, 1)
+CSTUB_WIDEN(cstub_addw16,  ae_int32x2, ae_int16x4, 2, CSTUB_SX, x + y, 0)
+CSTUB_WIDEN(cstub_subw16,  ae_int32x2, ae_int16x4, 2, CSTUB_SX, x - y, 0)
+CSTUB_WIDEN(cstub_accw16,  ae_int32x2, ae_int16x4, 2, CSTUB_SX, x + y, 1)
+
+#define AE_ADDW8(o0, o1, a, b)    cstub_addw8((o0), (o1), (a), (b))
+#define AE_ADDW8U(o0, o1, a, b)   cstub_addw8u((o0), (o1), (a), (b))
+#define AE_SUBW8(o0, o1, a, b)    cstub_subw8((o0), (o1), (a), (b))
+#define AE_SUBW8U(o0, o1, a, b)   cstub_subw8u((o0), (o1), (a), (b))
+#define AE_ACCW8(o0, o1, a, b)    cstub_accw8((o0), (o1), (a), (b))
+#define AE_ACCW8U(o0, o1, a, b)   cstub_accw8u((o0), (o1), (a), (b))
+#define AE_ADDW16(o0, o1, a, b)   cstub_addw16((o0), (o1), (a), (b))
+#define AE_SUBW16(o0, o1, a, b)   cstub_subw16((o0), (o1), (a), (b))
+#define AE_ACCW16(o0, o1, a, b)   cstub_accw16((o0), (o1), (a), (b))
+
+#define AE_ADDW32(q0, q1, a, b)   cstub_addw32((q0), (q1), (a), (b), 0)
+#define AE_ACCW32(q0, q1, a, b)   cstub_addw32((q0), (q1), (a), (b), 1)
+static inline void cstub_addw32(ae_int64 &q0, ae_int64 &q1, const ae_int32x2 &a, const ae_int32x2 &b, int acc)
+{
+  int64_t h = (int64_t)a.lane(1) + b.lane(1);
+  int64_t l = (int64_t)a.lane(0) + b.lane(0);
+  q0 = acc ? AE_ADD64(q0, h) : ae_int64(h);
+  q1 = acc ? AE_ADD64(q1, l) : ae_int64(l);
+}
+
+/*---------------------------------------------------------------------------
+ * Normalization
+ *-------------------------------------------------------------------------*/
+static inline int AE_NSA64(const ae_int64 &a) { return __builtin_clrsbll(a.v); }
+static inline int AE_NSAQ56S(const ae_int64 &a) { return __builtin_clrsbll(a.v) - 8; }
+static inline int AE_NSAZ32_L(const ae_int32x2 &a) { return a.lane(0) == 0 ? 0 : __builtin_clrsb(a.lane(0)); }
+
+} /* extern "C++" */
+
+#endif /* __XA_NNLIB_CSTUB_OPS_H__ */
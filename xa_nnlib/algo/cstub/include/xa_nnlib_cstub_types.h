@@ -0,0 +1,282 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host emulation of the HiFi5 register types.
+ *
+ * Vector types keep their elements in memory order, i.e. exactly as an
+ * aligned AE_L*X* load would fetch them, so that dereferencing an
+ * (ae_int32x2 *) or (ae_f16x4 *) pointer behaves as on the core. Lane k
+ * (k = 0 being the L / least significant lane) of an N-lane vector is
+ * therefore element N-1-k. The 64-bit register image used by the
+ * AE_MOVINT* reinterpretations has lane N-1 in the most significant bits.
+ */
+#ifndef __XA_NNLIB_CSTUB_TYPES_H__
+#define __XA_NNLIB_CSTUB_TYPES_H__
+
+#ifndef __cplusplus
+#error "HiFi5 host emulation must be compiled as C++ (see build/makefile, CPU=x86)"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C++" {
+
+struct ae_int32x2;
+struct ae_int16x4;
+struct ae_int8x8;
+struct xtfloatx2;
+
+/* Scalar register types. Reading a scalar out of a vector (including the
+ * implicit conversions to C scalars) takes lane 0. */
+struct ae_int64
+{
+  int64_t v;
+  ae_int64() = default;
+  ae_int64(long long x) : v(x) {}
+  operator long long() const { return v; }
+};
+
+struct ae_int32
+{
+  int32_t v;
+  ae_int32() = default;
+  ae_int32(int32_t x) : v(x) {}
+  inline ae_int32(const ae_int32x2 &x);
+  operator int32_t() const { return v; }
+};
+
+struct ae_int16
+{
+  int16_t v;
+  ae_int16() = default;
+  ae_int16(int16_t x) : v(x) {}
+  inline ae_int16(const ae_int16x4 &x);
+  operator int16_t() const { return v; }
+};
+
+struct ae_int8
+{
+  int8_t v;
+  ae_int8() = default;
+  ae_int8(int8_t x) : v(x) {}
+  inline ae_int8(const ae_int8x8 &x);
+  operator int8_t() const { return v; }
+};
+
+/* 64-bit vector register types (memory order, see above) */
+struct ae_int32x2
+{
+  int32_t v[2];
+  ae_int32x2() = default;
+  ae_int32x2(int32_t x) { v[0] = v[1] = x; }
+  ae_int32x2(const ae_int32 &x) { v[0] = v[1] = x.v; }
+  inline ae_int32x2(const xtfloatx2 &x);
+  operator int32_t() const { return v[1]; }
+  int32_t &lane(int k) { return v[1 - k]; }
+  int32_t lane(int k) const { return v[1 - k]; }
+};
+
+struct ae_int16x4
+{
+  int16_t v[4];
+  ae_int16x4() = default;
+  ae_int16x4(int x) { v[0] = v[1] = v[2] = v[3] = (int16_t)x; }
+  ae_int16x4(const ae_int16 &x) { v[0] = v[1] = v[2] = v[3] = x.v; }
+  operator int16_t() const { return v[3]; }
+  int16_t &lane(int k) { return v[3 - k]; }
+  int16_t lane(int k) const { return v[3 - k]; }
+};
+
+struct ae_int8x8
+{
+  int8_t v[8];
+  ae_int8x8() = default;
+  ae_int8x8(int x) { for(int i = 0; i < 8; i++) v[i] = (int8_t)x; }
+  ae_int8x8(const ae_int8 &x) { for(int i = 0; i < 8; i++) v[i] = x.v; }
+  int8_t &lane(int k) { return v[7 - k]; }
+  int8_t lane(int k) const { return v[7 - k]; }
+};
+
+/* Fractional views: same storage, saturating +/- operators */
+struct ae_f64 : ae_int64
+{
+  ae_f64() = default;
+  ae_f64(long long x) : ae_int64(x) {}
+  ae_f64(const ae_int64 &x) : ae_int64(x) {}
+};
+typedef ae_f64 ae_q56s;
+
+struct ae_f32 : ae_int32
+{
+  ae_f32() = default;
+  ae_f32(int32_t x) : ae_int32(x) {}
+  ae_f32(const ae_int32 &x) : ae_int32(x) {}
+  ae_f32(const ae_int32x2 &x) : ae_int32(x) {}
+};
+
+struct ae_f16 : ae_int16
+{
+  ae_f16() = default;
+  ae_f16(int16_t x) : ae_int16(x) {}
+  ae_f16(const ae_int16 &x) : ae_int16(x) {}
+  ae_f16(const ae_int16x4 &x) : ae_int16(x) {}
+};
+
+struct ae_f32x2 : ae_int32x2
+{
+  ae_f32x2() = default;
+  ae_f32x2(int32_t x) : ae_int32x2(x) {}
+  ae_f32x2(const ae_int32 &x) : ae_int32x2(x) {}
+  ae_f32x2(const ae_int32x2 &x) : ae_int32x2(x) {}
+};
+
+struct ae_f24x2 : ae_int32x2
+{
+  ae_f24x2() = default;
+  ae_f24x2(int32_t x) : ae_int32x2(x) {}
+  ae_f24x2(const ae_int32x2 &x) : ae_int32x2(x) {}
+};
+typedef ae_f24x2 ae_int24x2;
+
+struct ae_f16x4 : ae_int16x4
+{
+  ae_f16x4() = default;
+  ae_f16x4(int x) : ae_int16x4(x) {}
+  ae_f16x4(const ae_int16 &x) : ae_int16x4(x) {}
+  ae_f16x4(const ae_int16x4 &x) : ae_int16x4(x) {}
+};
+
+inline ae_int32::ae_int32(const ae_int32x2 &x) : v(x.lane(0)) {}
+inline ae_int16::ae_int16(const ae_int16x4 &x) : v(x.lane(0)) {}
+inline ae_int8::ae_int8(const ae_int8x8 &x) : v(x.lane(0)) {}
+
+/* Integer operators wrap around */
+#define CSTUB_INT_OPS(T, N, E)                                                \
+static inline T operator+(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = (E)((uint64_t)a.v[i] + (uint64_t)b.v[i]); return r; } \
+static inline T operator-(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = (E)((uint64_t)a.v[i] - (uint64_t)b.v[i]); return r; } \
+static inline T operator-(const T &a)                                         \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = (E)(0 - (uint64_t)a.v[i]); return r; } \
+static inline T operator&(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = a.v[i] & b.v[i]; return r; }       \
+static inline T operator|(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = a.v[i] | b.v[i]; return r; }       \
+static inline T operator^(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = a.v[i] ^ b.v[i]; return r; }       \
+static inline T &operator+=(T &a, const T &b) { return a = a + b; }           \
+static inline T &operator-=(T &a, const T &b) { return a = a - b; }
+
+CSTUB_INT_OPS(ae_int32x2, 2, int32_t)
+CSTUB_INT_OPS(ae_int16x4, 4, int16_t)
+CSTUB_INT_OPS(ae_int8x8, 8, int8_t)
+
+static inline ae_int64 operator+(const ae_int64 &a, const ae_int64 &b) { return (int64_t)((uint64_t)a.v + (uint64_t)b.v); }
+static inline ae_int64 operator-(const ae_int64 &a, const ae_int64 &b) { return (int64_t)((uint64_t)a.v - (uint64_t)b.v); }
+static inline ae_int64 operator-(const ae_int64 &a) { return (int64_t)(0 - (uint64_t)a.v); }
+static inline ae_int64 operator&(const ae_int64 &a, const ae_int64 &b) { return a.v & b.v; }
+static inline ae_int64 operator|(const ae_int64 &a, const ae_int64 &b) { return a.v | b.v; }
+static inline ae_int64 operator^(const ae_int64 &a, const ae_int64 &b) { return a.v ^ b.v; }
+static inline ae_int64 &operator+=(ae_int64 &a, const ae_int64 &b) { return a = a + b; }
+static inline ae_int64 &operator-=(ae_int64 &a, const ae_int64 &b) { return a = a - b; }
+
+/* Fractional operators saturate */
+#define CSTUB_FRAC_OPS(T, N, BITS)                                            \
+static inline T operator+(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = cstub_sat_op((int64_t)a.v[i] + b.v[i], BITS); return r; } \
+static inline T operator-(const T &a, const T &b)                             \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = cstub_sat_op((int64_t)a.v[i] - b.v[i], BITS); return r; } \
+static inline T operator-(const T &a)                                         \
+{ T r; for(int i = 0; i < N; i++) r.v[i] = cstub_sat_op(-(int64_t)a.v[i], BITS); return r; } \
+static inline T &operator+=(T &a, const T &b) { return a = a + b; }           \
+static inline T &operator-=(T &a, const T &b) { return a = a - b; }
+
+static inline int64_t cstub_sat_op(int64_t x, int bits)
+{
+  int64_t mx = (int64_t)((((uint64_t)1) << (bits - 1)) - 1);
+  return x > mx ? mx : (x < -mx - 1 ? -mx - 1 : x);
+}
+
+CSTUB_FRAC_OPS(ae_f32x2, 2, 32)
+CSTUB_FRAC_OPS(ae_f16x4, 4, 16)
+
+static inline ae_f64 operator+(const ae_f64 &a, const ae_f64 &b)
+{
+  int64_t r;
+  if(__builtin_add_overflow(a.v, b.v, &r)) r = a.v < 0 ? INT64_MIN : INT64_MAX;
+  return r;
+}
+static inline ae_f64 operator-(const ae_f64 &a, const ae_f64 &b)
+{
+  int64_t r;
+  if(__builtin_sub_overflow(a.v, b.v, &r)) r = a.v < 0 ? INT64_MIN : INT64_MAX;
+  return r;
+}
+
+/* 128-bit types; only used as pointer targets of the X2 loads/stores */
+struct ae_int8x16  { int8_t  v[16]; };
+struct ae_int16x8  { int16_t v[8]; };
+struct ae_int32x4  { int32_t v[4]; };
+struct ae_int64x2  { int64_t v[2]; };
+
+/* Floating point */
+typedef float xtfloat;
+
+struct xtfloatx2
+{
+  float v[2];
+  xtfloatx2() = default;
+  xtfloatx2(float x) { v[0] = v[1] = x; }
+  inline xtfloatx2(const ae_int32x2 &x);
+  operator float() const { return v[1]; }
+  float &lane(int k) { return v[1 - k]; }
+  float lane(int k) const { return v[1 - k]; }
+};
+
+/* The AE register file holds both: conversions reinterpret the bits */
+inline xtfloatx2::xtfloatx2(const ae_int32x2 &x) { memcpy(v, x.v, 8); }
+inline ae_int32x2::ae_int32x2(const xtfloatx2 &x) { memcpy(v, x.v, 8); }
+
+struct xtfloatx4 { float v[4]; };
+
+/* Alignment registers. Unaligned accesses are done directly, so these
+ * carry no state. */
+struct ae_valign   { int unused; };
+struct ae_valignx2 { int unused; };
+
+/* Boolean registers: bit k holds the result for lane k. The single
+ * boolean also converts to and from C truth values. */
+struct xtbool
+{
+  unsigned v;
+  xtbool() = default;
+  xtbool(unsigned x) : v(x != 0) {}
+  operator bool() const { return v & 1; }
+};
+struct xtbool2 { unsigned v; };
+struct xtbool4 { unsigned v; };
+struct xtbool8 { unsigned v; };
+
+} /* extern "C++" */
+
+#endif /* __XA_NNLIB_CSTUB_TYPES_H__ */
@@ -0,0 +1,168 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host (x86) SIMD paths of the HiFi5 kernels.
+ *
+ * With XA_NNLIB_HOST_SIMD, the hottest matXvec/matmul kernels hand their
+ * work to AVX2 or AVX-512 code once their argument checks have passed. The
+ * host paths are bit-exact with the kernels: they reproduce the 64-bit
+ * accumulation and, for the requantizing kernels, the rounding sequence the
+ * kernel uses for each row/vector of a given shape. A host kernel returns 0
+ * when it has produced the output and non-zero when it declines (no usable
+ * ISA, or arguments it does not handle), in which case the kernel runs on
+ * the intrinsic emulation.
+ *
+ * The ISA is chosen once from CPUID. XA_NNLIB_HOST_SIMD=none|avx2|avx512 in
+ * the environment caps it, e.g. to compare against the emulated path.
+ */
+#ifndef __XA_NNLIB_HOST_SIMD_H__
+#define __XA_NNLIB_HOST_SIMD_H__
+
+#include "xa_type_def.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+typedef enum _xa_nnlib_host_simd_t
+{
+  XA_NNLIB_HOST_SIMD_NONE = 0,
+  XA_NNLIB_HOST_SIMD_AVX2,
+  XA_NNLIB_HOST_SIMD_AVX512
+} xa_nnlib_host_simd_t;
+
+xa_nnlib_host_simd_t xa_nnlib_host_simd_level(void);
+
+/* acc_shift is the 64-bit accumulator shift, i.e. already offset by 32 and
+   limited by the caller */
+WORD32 xa_nn_matXvec_16x16_16_host(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_vec2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 acc_shift,
+    WORD32 bias_shift);
+
+WORD32 xa_nn_matXvec_8x16_16_host(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_vec2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 acc_shift,
+    WORD32 bias_shift);
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_host(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_host(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
+
+/* p_packed is the 16-byte aligned layout of xa_nn_pack_weights_8 */
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_packed_host(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+/* p_folded_bias is the output of xa_nn_fold_zero_bias_asym8uxasym8u */
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u_folded_host(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_folded_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+/* One block of xa_nn_matmul_*_blocked: p_a and p_b hold 4 x 16 interleaved
+   panels of mc rows and nc vectors, p_acc the mc x nc accumulator tile */
+WORD32 xa_nn_matmul_8x8_blocked_tile_host(
+    WORD32 * __restrict__ p_acc,
+    const WORD8 * __restrict__ p_a,
+    const WORD8 * __restrict__ p_b,
+    WORD32 mc,
+    WORD32 nc,
+    WORD32 kc);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* __XA_NNLIB_HOST_SIMD_H__ */
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Core configuration seen by the library when it is built for the host
+ * (CPU=x86). Only the options tested by the library sources are described;
+ * they match a HiFi5 core with the single precision vector FPU.
+ */
+#ifndef __XA_CSTUB_CORE_ISA_H__
+#define __XA_CSTUB_CORE_ISA_H__
+
+#define XCHAL_HAVE_BE               0
+#define XCHAL_HAVE_NSA              1
+#define XCHAL_HAVE_MUL16            1
+#define XCHAL_HAVE_MUL32            1
+#define XCHAL_HAVE_FP               1
+#define XCHAL_HAVE_HIFI2            1
+#define XCHAL_HAVE_HIFI3            1
+#define XCHAL_HAVE_HIFI4            1
+#define XCHAL_HAVE_HIFI5            1
+#define XCHAL_HAVE_HIFI3_VFPU       1
+#define XCHAL_HAVE_HIFI3Z_VFPU      1
+#define XCHAL_HAVE_HIFI4_VFPU       1
+#define XCHAL_HAVE_HIFI5_VFPU       1
+#define XCHAL_DATA_WIDTH            16
+
+#endif /* __XA_CSTUB_CORE_ISA_H__ */
@@ -0,0 +1,36 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Host stand-in for the HiFi5 TIE intrinsics header (CPU=x86 builds).
+ */
+#ifndef __XA_CSTUB_XT_HIFI2_H__
+#define __XA_CSTUB_XT_HIFI2_H__
+
+#include <xtensa/config/core-isa.h>
+#include "xa_nnlib_cstub_types.h"
+#include "xa_nnlib_cstub_common.h"
+#include "xa_nnlib_cstub_ops.h"
+#include "xa_nnlib_cstub_ldst.h"
+#include "xa_nnlib_cstub_mac.h"
+#include "xa_nnlib_cstub_fp.h"
+
+#endif /* __XA_CSTUB_XT_HIFI2_H__ */
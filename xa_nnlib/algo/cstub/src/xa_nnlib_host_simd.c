@@ -0,0 +1,65 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * ISA selection for the host SIMD kernel paths (see xa_nnlib_host_simd.h).
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "xa_nnlib_host_simd.h"
+
+static xa_nnlib_host_simd_t host_simd_detect(void)
+{
+  xa_nnlib_host_simd_t level = XA_NNLIB_HOST_SIMD_NONE;
+  xa_nnlib_host_simd_t cap = XA_NNLIB_HOST_SIMD_AVX512;
+  const char *env;
+
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx2"))
+    level = XA_NNLIB_HOST_SIMD_AVX2;
+  if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    level = XA_NNLIB_HOST_SIMD_AVX512;
+
+  env = getenv("XA_NNLIB_HOST_SIMD");
+  if(env != NULL)
+  {
+    if(!strcmp(env, "none") || !strcmp(env, "0"))
+      cap = XA_NNLIB_HOST_SIMD_NONE;
+    else if(!strcmp(env, "avx2"))
+      cap = XA_NNLIB_HOST_SIMD_AVX2;
+  }
+
+  return level < cap ? level : cap;
+}
+
+xa_nnlib_host_simd_t xa_nnlib_host_simd_level(void)
+{
+  /* Racing first calls store the same value */
+  static int s_level = -1;
+  int level = __atomic_load_n(&s_level, __ATOMIC_RELAXED);
+
+  if(level < 0)
+  {
+    level = (int)host_simd_detect();
+    __atomic_store_n(&s_level, level, __ATOMIC_RELAXED);
+  }
+  return (xa_nnlib_host_simd_t)level;
+}
@@ -22,6 +22,7 @@
 #include "xa_type_def.h"
 #include "common.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
 
 #define MAX_WORD16 (int)0x00007fff
 #define MIN_WORD16 (int)0xffff8000
@@ -178,3 +179,193 @@ WORD32 xa_nn_vec_relu_std_16_16(
                                       vec_length);
 	return 0;
 }
+
+/* 16 bit fixed point logistic and tanh, following the gemmlowp
+   FixedPoint<int16_t, integer_bits> implementation used by the TFLite
+   integer LSTM, four lanes at a time. Additions wrap and products are
+   saturating rounding doubling high multiplies (AE_MULFP16X4RAS rounds
+   half up, as gemmlowp does). */
+
+/* gemmlowp constants rounded to 16 bits */
+#define FIX16_EXP_MINUS_1_OVER_8   28918   /* exp(-1/8), Q0.15 */
+#define FIX16_ONE_OVER_3           10923   /* 1/3, Q0.15 */
+#define FIX16_48_OVER_17           23130   /* 48/17, Q2.13 */
+#define FIX16_NEG_32_OVER_17      -15420   /* -32/17, Q2.13 */
+
+/* exp(-2^k) for k = -2..4, Q0.15 */
+static const WORD16 fix16_exp_barrel[7] = {25520, 19875, 12055, 4435, 600, 11, 0};
+
+/* Right shift rounding half away from zero */
+static inline ae_int16x4 fix16x4_rounding_div_by_pot(ae_int16x4 x, int exponent)
+{
+  ae_int32x2 x32 = AE_SRAA32SYMS(AE_SEXT32X2D16_32(x), exponent);
+  ae_int32x2 x10 = AE_SRAA32SYMS(AE_SEXT32X2D16_10(x), exponent);
+  return AE_SAT16X4(x32, x10);
+}
+
+static inline ae_int16x4 fix16x4_exp_on_interval(ae_int16x4 a)
+{
+  ae_int16x4 x, x2, x3, x4, x4_over_4, poly;
+
+  x = AE_ADD16(a, AE_MOVDA16(1 << 12));
+  x2 = AE_MULFP16X4RAS(x, x);
+  x3 = AE_MULFP16X4RAS(x2, x);
+  x4 = AE_MULFP16X4RAS(x2, x2);
+  x4_over_4 = fix16x4_rounding_div_by_pot(x4, 2);
+  poly = AE_ADD16(AE_MULFP16X4RAS(AE_ADD16(x4_over_4, x3), AE_MOVDA16(FIX16_ONE_OVER_3)), x2);
+  poly = fix16x4_rounding_div_by_pot(poly, 1);
+  return AE_ADD16S(AE_MOVDA16(FIX16_EXP_MINUS_1_OVER_8),
+      AE_MULFP16X4RAS(AE_MOVDA16(FIX16_EXP_MINUS_1_OVER_8), AE_ADD16(x, poly)));
+}
+
+/* exp(a) for a <= 0 with integer_bits (0-13) integer bits, Q0.15 out */
+static inline ae_int16x4 fix16x4_exp_on_negative_values(ae_int16x4 a, int integer_bits)
+{
+  int frac_bits = 15 - integer_bits;
+  ae_int16x4 zero = AE_ZERO16();
+  ae_int16x4 a_mod_quarter_minus_one_quarter, remainder, result, barrel;
+  xtbool4 bit_set;
+  int k;
+
+  a_mod_quarter_minus_one_quarter = AE_SUB16(AE_AND16(a, AE_MOVDA16((1 << (frac_bits - 2)) - 1)),
+      AE_MOVDA16(1 << (frac_bits - 2)));
+  result = fix16x4_exp_on_interval(AE_SLAA16S(a_mod_quarter_minus_one_quarter, integer_bits));
+  remainder = AE_SUB16(a_mod_quarter_minus_one_quarter, a);
+
+  for(k = -2; k <= 4 && k < integer_bits; k++)
+  {
+    bit_set = AE_LT16(zero, AE_AND16(remainder, AE_MOVDA16(1 << (frac_bits + k))));
+    barrel = AE_MULFP16X4RAS(result, AE_MOVDA16(fix16_exp_barrel[k + 2]));
+    AE_MOVT16X4(result, barrel, bit_set);
+  }
+
+  if(integer_bits > 5)
+    AE_MOVT16X4(result, zero, AE_LT16(a, AE_MOVDA16(-(1 << (20 - integer_bits)))));
+  AE_MOVT16X4(result, AE_MOVDA16(32767), AE_EQ16(a, zero));
+
+  return result;
+}
+
+/* Newton-Raphson estimate of 2/(1+a) for a in [0, 1], Q2.13 */
+static inline ae_int16x4 fix16x4_two_over_one_plus_x(ae_int16x4 a)
+{
+  /* (a + 1) / 2 rounded half away from zero; a >= 0 */
+  ae_int16x4 half_denominator = AE_ADD16(AE_SRAI16(a, 1), AE_MOVDA16(16384));
+  ae_int16x4 x, one_minus_half_denominator_times_x;
+  int k;
+
+  x = AE_ADD16(AE_MOVDA16(FIX16_48_OVER_17), AE_MULFP16X4RAS(half_denominator, AE_MOVDA16(FIX16_NEG_32_OVER_17)));
+  for(k = 0; k < 3; k++)
+  {
+    one_minus_half_denominator_times_x = AE_SUB16(AE_MOVDA16(1 << 13), AE_MULFP16X4RAS(half_denominator, x));
+    x = AE_ADD16(x, AE_SLAA16S(AE_MULFP16X4RAS(x, one_minus_half_denominator_times_x), 2));
+  }
+  return x;
+}
+
+/* Q(integer_bits) in, Q0.15 out */
+static inline ae_int16x4 fix16x4_logistic(ae_int16x4 a, int integer_bits)
+{
+  ae_int16x4 zero = AE_ZERO16();
+  ae_int16x4 neg_abs_a = a, result;
+
+  AE_MOVT16X4(neg_abs_a, AE_SUB16(zero, a), AE_LT16(zero, a));
+  result = fix16x4_exp_on_negative_values(neg_abs_a, integer_bits);
+  /* 1/(1+x) is half of 2/(1+x), from Q2.13 to Q0.15 */
+  result = AE_SLAA16S(fix16x4_two_over_one_plus_x(result), 1);
+
+  AE_MOVT16X4(result, AE_SUB16(AE_MOVDA16(32767), result), AE_LE16(a, zero));
+  AE_MOVT16X4(result, AE_MOVDA16(16384), AE_EQ16(a, zero));
+  return result;
+}
+
+/* Q(integer_bits) in, 0-12 integer bits, Q0.15 out */
+static inline ae_int16x4 fix16x4_tanh(ae_int16x4 a, int integer_bits)
+{
+  ae_int16x4 zero = AE_ZERO16();
+  ae_int16x4 neg_abs_a = a, result;
+
+  AE_MOVT16X4(neg_abs_a, AE_SUB16(zero, a), AE_LT16(zero, a));
+  result = fix16x4_exp_on_negative_values(neg_abs_a, integer_bits + 1);
+  /* (1-x)/(1+x) = 2/(1+x) - 1 */
+  result = AE_SLAA16S(AE_SUB16(fix16x4_two_over_one_plus_x(result), AE_MOVDA16(1 << 13)), 2);
+
+  AE_MOVT16X4(result, AE_SUB16(zero, result), AE_LT16(a, zero));
+  AE_MOVT16X4(result, zero, AE_EQ16(a, zero));
+  return result;
+}
+
+/* Applies FN to vec_length elements four at a time; the tail goes through
+   a zero padded vector. p_out may be p_vec: every load runs ahead of the
+   store that could overwrite it. */
+#define FIX16X4_ACTIVATION_LOOP(FN)                                     \
+{                                                                       \
+    const ae_int16x4 *p_x = (const ae_int16x4 *)p_vec;                  \
+    ae_int16x4 *p_y = (ae_int16x4 *)p_out;                              \
+    ae_valign align_x = AE_LA64_PP(p_x);                                \
+    ae_valign align_y = AE_ZALIGN64();                                  \
+    ae_int16x4 x, tail;                                                 \
+    WORD16 *p_tail = (WORD16 *)&tail;                                   \
+                                                                        \
+    for(i = 0; i < (vec_length >> 2); i++)                              \
+    {                                                                   \
+        AE_LA16X4_IP(x, align_x, p_x);                                  \
+        AE_SA16X4_IP(FN(x, integer_bits), align_y, p_y);                \
+    }                                                                   \
+    AE_SA64POS_FP(align_y, p_y);                                        \
+                                                                        \
+    tail = AE_ZERO16();                                                 \
+    for(i = 0; i < (vec_length & 3); i++)                               \
+        p_tail[i] = p_vec[(vec_length & ~3) + i];                       \
+    tail = FN(tail, integer_bits);                                      \
+    for(i = 0; i < (vec_length & 3); i++)                               \
+        p_out[(vec_length & ~3) + i] = p_tail[i];                       \
+}
+
+/*
+ * Sigmoid 16-bit: Q(integer_bits) in, Q0.15 out; p_out may be p_vec
+ */
+WORD32 xa_nn_vec_sigmoid_16_16(
+    WORD16       *p_out,
+    const WORD16 *p_vec,
+    WORD32       integer_bits,
+    WORD32       vec_length)
+{
+    int i;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((integer_bits < 0 || integer_bits > 13), -1);
+
+    FIX16X4_ACTIVATION_LOOP(fix16x4_logistic)
+
+    return 0;
+}
+
+/*
+ * Tanh 16-bit: Q(integer_bits) in, Q0.15 out; p_out may be p_vec
+ */
+WORD32 xa_nn_vec_tanh_16_16(
+    WORD16       *p_out,
+    const WORD16 *p_vec,
+    WORD32       integer_bits,
+    WORD32       vec_length)
+{
+    int i;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((integer_bits < 0 || integer_bits > 12), -1);
+
+    FIX16X4_ACTIVATION_LOOP(fix16x4_tanh)
+
+    return 0;
+}
@@ -52,6 +52,7 @@
 #include "xtensa/tie/xt_hifi2.h"
 #include "NatureDSP_Signal_math.h"
 #include "xa_type_def.h"
+#include "xa_nnlib_kernels_api.h"
 /*-------------------------------------------------------------------------
   Sigmoid
   The functions compute the sigmoid of input argument. 32-bit fixed-point 
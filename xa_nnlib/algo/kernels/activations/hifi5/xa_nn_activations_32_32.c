@@ -21,6 +21,7 @@
 ******************************************************************************/
 #include "xa_type_def.h"
 #include "NatureDSP_Signal_math.h"
+#include "xa_nnlib_kernels_api.h"
 
 WORD32 xa_nn_vec_sigmoid_32_32(
     WORD32       * __restrict__ p_out,         /* result, Q16.15 */
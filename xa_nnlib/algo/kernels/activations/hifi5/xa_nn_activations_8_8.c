@@ -22,6 +22,7 @@
 #include "xa_type_def.h"
 #include "common.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
 
 #define LIMIT(out, inp, min, max){\
         out = AE_MIN8(inp, max);\
@@ -24,6 +24,7 @@
 #include "xa_type_def.h"
 #include "NatureDSP_Signal_math.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
 #include <math.h>
 
 #define ALIGNMENT   16   /* 16 bytes alignment */
@@ -0,0 +1,230 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Elementwise steps of the fully integer LSTM cell, on Q0.15 activations
+   and a 16 bit cell state. */
+
+/*
+ * p_out = saturate16(p_inp1 + p_inp2); p_out may be p_inp1 or p_inp2
+ */
+WORD32 xa_nn_elm_add_sat_16x16_16(
+    WORD16       *p_out,
+    const WORD16 *p_inp1,
+    const WORD16 *p_inp2,
+    WORD32       num_elm)
+{
+    int i;
+    ae_int16x4 x0, x1, y0, y1;
+    ae_valignx2 align_x, align_y, align_out;
+    const ae_int16x8 *p_x = (const ae_int16x8 *)p_inp1;
+    const ae_int16x8 *p_y = (const ae_int16x8 *)p_inp2;
+    ae_int16x8 *p_o = (ae_int16x8 *)p_out;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp2, -1);
+
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+
+    align_x = AE_LA128_PP(p_x);
+    align_y = AE_LA128_PP(p_y);
+    align_out = AE_ZALIGN128();
+
+    for(i = 0; i < (num_elm >> 3); i++)
+    {
+        AE_LA16X4X2_IP(x0, x1, align_x, p_x);
+        AE_LA16X4X2_IP(y0, y1, align_y, p_y);
+        AE_SA16X4X2_IP(AE_ADD16S(x0, y0), AE_ADD16S(x1, y1), align_out, p_o);
+    }
+    AE_SA128POS_FP(align_out, p_o);
+
+    for(i = 0; i < (num_elm & 7); i++)
+    {
+        AE_L16_IP(x0, (ae_int16 *)p_x, sizeof(ae_int16));
+        AE_L16_IP(y0, (ae_int16 *)p_y, sizeof(ae_int16));
+        AE_S16_0_IP(AE_ADD16S(x0, y0), (ae_int16 *)p_o, sizeof(ae_int16));
+    }
+
+    return 0;
+}
+
+/*
+ * p_cell = saturate16(rounding_div_by_pot(f * p_cell, 15) +
+ *                     rounding_div_by_pot(i * c_hat, 30 - cell_Qformat)),
+ * f, i and c_hat in Q0.15, p_cell in Q(15 - cell_Qformat).cell_Qformat;
+ * shifts round half away from zero.
+ */
+WORD32 xa_nn_lstm_cell_update_16x16_16(
+    WORD16       *p_cell,
+    const WORD16 *p_forget_gate,
+    const WORD16 *p_input_gate,
+    const WORD16 *p_cell_gate,
+    WORD32       cell_Qformat,
+    WORD32       num_elm)
+{
+    int i, ic_shift;
+    ae_int16x4 f, c, in, c_hat;
+    ae_int32x2 fc_0, fc_1, ic_0, ic_1;
+    ae_valign align_f, align_c, align_i, align_c_hat, align_out;
+    const ae_int16x4 *p_f = (const ae_int16x4 *)p_forget_gate;
+    const ae_int16x4 *p_c = (const ae_int16x4 *)p_cell;
+    const ae_int16x4 *p_i = (const ae_int16x4 *)p_input_gate;
+    const ae_int16x4 *p_c_hat = (const ae_int16x4 *)p_cell_gate;
+    ae_int16x4 *p_o = (ae_int16x4 *)p_cell;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_cell, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_forget_gate, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_input_gate, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_cell_gate, -1);
+
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cell_Qformat < 0 || cell_Qformat > 15), -1);
+
+    ic_shift = 30 - cell_Qformat;
+
+    align_f = AE_LA64_PP(p_f);
+    align_c = AE_LA64_PP(p_c);
+    align_i = AE_LA64_PP(p_i);
+    align_c_hat = AE_LA64_PP(p_c_hat);
+    align_out = AE_ZALIGN64();
+
+    for(i = 0; i < (num_elm >> 2); i++)
+    {
+        AE_LA16X4_IP(f, align_f, p_f);
+        AE_LA16X4_IP(c, align_c, p_c);
+        AE_LA16X4_IP(in, align_i, p_i);
+        AE_LA16X4_IP(c_hat, align_c_hat, p_c_hat);
+
+        AE_MUL16X4(fc_0, fc_1, f, c);
+        AE_MUL16X4(ic_0, ic_1, in, c_hat);
+        fc_0 = AE_ADD32(AE_SRAA32SYMS(fc_0, 15), AE_SRAA32SYMS(ic_0, ic_shift));
+        fc_1 = AE_ADD32(AE_SRAA32SYMS(fc_1, 15), AE_SRAA32SYMS(ic_1, ic_shift));
+
+        AE_SA16X4_IP(AE_SAT16X4(fc_0, fc_1), align_out, p_o);
+    }
+    AE_SA64POS_FP(align_out, p_o);
+
+    for(i = 0; i < (num_elm & 3); i++)
+    {
+        AE_L16_IP(f, (ae_int16 *)p_f, sizeof(ae_int16));
+        AE_L16_IP(c, (ae_int16 *)p_c, sizeof(ae_int16));
+        AE_L16_IP(in, (ae_int16 *)p_i, sizeof(ae_int16));
+        AE_L16_IP(c_hat, (ae_int16 *)p_c_hat, sizeof(ae_int16));
+
+        AE_MUL16X4(fc_0, fc_1, f, c);
+        AE_MUL16X4(ic_0, ic_1, in, c_hat);
+        fc_1 = AE_ADD32(AE_SRAA32SYMS(fc_1, 15), AE_SRAA32SYMS(ic_1, ic_shift));
+
+        AE_S16_0_IP(AE_SAT16X4(fc_1, fc_1), (ae_int16 *)p_o, sizeof(ae_int16));
+    }
+
+    return 0;
+}
+
+/*
+ * p_out = clamp8(requantize(o * tanh_c) + out_zero_bias), o and tanh_c in
+ * Q0.15; the Q0.30 product is scaled by out_multiplier and out_shift
+ * (TFLite convention) with symmetric rounding.
+ */
+WORD32 xa_nn_lstm_hidden_16x16_asym8s(
+    WORD8        *p_out,
+    const WORD16 *p_output_gate,
+    const WORD16 *p_tanh_cell,
+    WORD32       out_multiplier,
+    WORD32       out_shift,
+    WORD32       out_zero_bias,
+    WORD32       num_elm)
+{
+    int i, left_shift, right_shift;
+    ae_int16x4 o0, o1, t0, t1;
+    ae_int32x2 h0, h1, h2, h3, zero_bias;
+    ae_valignx2 align_o, align_t;
+    ae_valign align_out;
+    const ae_int16x8 *p_o = (const ae_int16x8 *)p_output_gate;
+    const ae_int16x8 *p_t = (const ae_int16x8 *)p_tanh_cell;
+    ae_int8x8 *p_h = (ae_int8x8 *)p_out;
+
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_output_gate, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_tanh_cell, -1);
+
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+    XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+    left_shift = out_shift < 0 ? 0 : out_shift;
+    right_shift = out_shift > 0 ? 0 : -out_shift;
+    zero_bias = AE_MOVDA32(out_zero_bias);
+
+    align_o = AE_LA128_PP(p_o);
+    align_t = AE_LA128_PP(p_t);
+    align_out = AE_ZALIGN64();
+
+    for(i = 0; i < (num_elm >> 3); i++)
+    {
+        AE_LA16X4X2_IP(o0, o1, align_o, p_o);
+        AE_LA16X4X2_IP(t0, t1, align_t, p_t);
+
+        AE_MUL16X4(h0, h1, o0, t0);
+        AE_MUL16X4(h2, h3, o1, t1);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2(h0, out_multiplier, left_shift, right_shift);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2(h1, out_multiplier, left_shift, right_shift);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2(h2, out_multiplier, left_shift, right_shift);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2(h3, out_multiplier, left_shift, right_shift);
+        h0 = AE_ADD32S(h0, zero_bias);
+        h1 = AE_ADD32S(h1, zero_bias);
+        h2 = AE_ADD32S(h2, zero_bias);
+        h3 = AE_ADD32S(h3, zero_bias);
+
+        AE_SA8X8_IP(AE_SAT8X8X16(AE_SAT16X4(h0, h1), AE_SAT16X4(h2, h3)), align_out, p_h);
+    }
+    AE_SA64POS_FP(align_out, p_h);
+
+    for(i = 0; i < (num_elm & 7); i++)
+    {
+        AE_L16_IP(o0, (ae_int16 *)p_o, sizeof(ae_int16));
+        AE_L16_IP(t0, (ae_int16 *)p_t, sizeof(ae_int16));
+
+        AE_MUL16X4(h0, h1, o0, t0);
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X2(h1, out_multiplier, left_shift, right_shift);
+        h1 = AE_ADD32S(h1, zero_bias);
+
+        AE_S8_0_IP(AE_SAT8X8X16(AE_SAT16X4(h1, h1), AE_SAT16X4(h1, h1)), (ae_int8 *)p_h, sizeof(WORD8));
+    }
+
+    return 0;
+}
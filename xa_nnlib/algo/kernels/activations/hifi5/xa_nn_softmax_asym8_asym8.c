@@ -32,7 +32,7 @@
 
 #define ALIGNMENT   16   /* 16 bytes alignment */
 #define ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
-#define ALIGN_PTR(x, bytes)     ((((unsigned)(x))+(bytes-1))&(~(bytes-1)))
+#define ALIGN_PTR(x, bytes)     ((((uintptr_t)(x))+(bytes-1))&(~(bytes-1)))
 
 #define SUB_128(inp){\
         ae_int64 temp;\
@@ -26,7 +26,7 @@
 #define ALIGNMENT   8   /* 8 bytes alignment */
 
 #define ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
-#define ALIGN_PTR(x, bytes)     ((((unsigned)(x))+(bytes-1))&(~(bytes-1)))
+#define ALIGN_PTR(x, bytes)     ((((uintptr_t)(x))+(bytes-1))&(~(bytes-1)))
 
 #define LIMIT(input, min, max) \
     input = XT_MAX(min, XT_MIN(max, input));
@@ -91,7 +91,7 @@ WORD32 xa_nn_elm_add_asym8xasym8_asym8(UWORD8 * __restrict__ p_out,
     activation_min = AE_MOVDA32(out_activation_min);
     activation_max = AE_MOVDA32(out_activation_max);
 
-    if(((((unsigned)p_i1)&3) == 0) && ((((unsigned)p_i2)&3) == 0))
+    if(((((uintptr_t)p_i1)&3) == 0) && ((((uintptr_t)p_i2)&3) == 0))
     {
         for(i=0;i < num_elm>>2;i++)
         {
@@ -331,8 +331,8 @@ WORD32 xa_nn_elm_add_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
     ae_int32x2 out0_1, out2_3, out4_5, out6_7;
 
 
-    const unsigned int num_simd8_ops = num_elm/8;
-    const unsigned int num_scalar_ops = num_elm%8;
+    const int num_simd8_ops = num_elm/8;
+    const int num_scalar_ops = num_elm%8;
 
     if(io_pointers_aligned){
         for(i=0; i<num_simd8_ops; i++){
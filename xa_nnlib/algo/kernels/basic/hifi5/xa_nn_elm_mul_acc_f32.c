@@ -54,7 +54,7 @@ WORD32 xa_nn_elm_mul_acc_f32xf32_f32(FLOAT32 * __restrict__ p_out,
     /* Basic Parameter checks */
     XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1);
 
-    if(((((unsigned)p_out)&7) == 0) && ((((unsigned)p_inp1)&7) == 0) && ((((unsigned)p_inp2)&7) == 0))
+    if(((((uintptr_t)p_out)&7) == 0) && ((((uintptr_t)p_inp1)&7) == 0) && ((((uintptr_t)p_inp2)&7) == 0))
     {
         int i;
         xtfloatx2 *inp1  = (xtfloatx2 *)p_inp1;
@@ -81,7 +81,7 @@ WORD32 xa_nn_elm_mul_asym8xasym8_asym8(UWORD8 * __restrict__ p_out,
     activation_min = AE_MOVDA32X2(out_activation_min, out_activation_min);
     activation_max = AE_MOVDA32X2(out_activation_max, out_activation_max);
 
-    if(((((unsigned)p_i1)&3) == 0) && ((((unsigned)p_i2)&3) == 0))
+    if(((((uintptr_t)p_i1)&3) == 0) && ((((uintptr_t)p_i2)&3) == 0))
     {
         for(i=0;i < num_elm>>2;i++)
         {
@@ -249,8 +249,8 @@ WORD32 xa_nn_elm_mul_asym8sxasym8s_asym8s(
 
 	xtbool io_pointers_aligned = ((uintptr_t)in1%4 == 0) && ((uintptr_t)in2%4==0) && ((uintptr_t)p_out%8==0);
 
-	unsigned int num_simd8_ops = num_elm/8;
-	unsigned int num_scalar_ops = num_elm%8;
+	int num_simd8_ops = num_elm/8;
+	int num_scalar_ops = num_elm%8;
 
 	if(io_pointers_aligned){
 		for(i=0; i<num_simd8_ops; i++){
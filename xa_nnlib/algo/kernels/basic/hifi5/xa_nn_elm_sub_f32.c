@@ -60,7 +60,7 @@ WORD32 xa_nn_elm_sub_f32xf32_f32(FLOAT32 * __restrict__ p_out,
     xtfloatx2 *out =  (xtfloatx2 *)p_out;
     xtfloatx2 x1, x2, y;
 
-    if(((((unsigned)p_out)&7) == 0) && ((((unsigned)p_inp1)&7) == 0) && ((((unsigned)p_inp2)&7) == 0))
+    if(((((uintptr_t)p_out)&7) == 0) && ((((uintptr_t)p_inp1)&7) == 0) && ((((uintptr_t)p_inp2)&7) == 0))
     {
         for(i=0;i < num_elm>>1;i++)
         {
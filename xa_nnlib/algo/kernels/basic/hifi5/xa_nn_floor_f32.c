@@ -54,7 +54,7 @@ WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 * __restrict__ p_out,
   xtfloatx4 *out = (xtfloatx4 *)p_out;
   xtfloatx2 x1, x2, x3, x4, y1, y2, y3, y4;
 
-  if(((((unsigned)p_out) & 15) == 0) && ((((unsigned)p_inp) & 15) == 0))
+  if(((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_inp) & 15) == 0))
   {
 #pragma no_unroll
     for(i = 0; i < (num_elm >> 3); i++)
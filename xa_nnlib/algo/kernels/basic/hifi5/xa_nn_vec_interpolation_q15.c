@@ -22,6 +22,7 @@
 #include "xa_type_def.h"
 #include "xa_nnlib_err_chk.h"
 #include "xtensa/tie/xt_hifi2.h"
+#include "xa_nnlib_kernels_api.h"
 
 WORD32 xa_nn_vec_interpolation_q15(WORD16 * __restrict__ p_out,
          const WORD16 * __restrict__ p_ifact,
@@ -564,7 +564,10 @@ void xa_nn_circ_buf_nhwc_add_cols(
 }
 
 /* Currently only 8-bit data types are supported */
-void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
+/* Same as xa_nn_circ_buf_nhwc_add_cols_with_pad_val, but consecutive columns
+   of the circular buffer are x_dilation input columns apart and consecutive
+   rows y_dilation input rows apart; input_height is the number of rows gathered */
+void xa_nn_dilated_circ_buf_nhwc_add_cols_with_pad_val(
     xa_nn_circ_buf_t *__restrict__ p_circ_buf,
     const VOID *__restrict__ p_inp,
     WORD32 top_padding,
@@ -580,6 +583,8 @@ void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
     WORD32 n_cols,
     WORD32 left_pad,
     WORD32 right_pad,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
     pVOID  p_pad_val)
 {
     int i, j, k;
@@ -624,8 +629,7 @@ void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
                     p_ae_dst[k] = AE_MOVDA8(pad_val);
                 AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, p_circ_buf->row_offset*circ_buf_width);
             }
-            pWORD8 p_src1 = (pWORD8)(&p_src[i*input_channels]);
-#pragma loop_count min=1
+            pWORD8 p_src1 = (pWORD8)(&p_src[i*x_dilation*input_channels]);
             for(j = 0; j < input_height; j++)
             {
                 ae_int8x8 *p_ae_dst, *p_ae_src1, d_src;
@@ -646,7 +650,7 @@ void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
                 {
                     *p_uae_dst++ = *p_uae_src1++;
                 }
-                p_src1 += input_width*input_channels;
+                p_src1 += y_dilation*input_width*input_channels;
                 AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, p_circ_buf->row_offset*circ_buf_width);
             }
             for(j = 0; j < (circ_buf_height-input_height-top_padding); j++)
@@ -679,7 +683,7 @@ void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
                 pWORD8 p_dst1 = p_dst;
                 for(k = 0; k < input_channels; k++)
                 {
-                    WORD8 val = p_src1[(j*input_width + i)*input_channels + k];
+                    WORD8 val = p_src1[(j*y_dilation*input_width + i*x_dilation)*input_channels + k];
                     WORD32 cm;
                     for(cm = 0; cm < channels_multiplier; cm++)
                     {
@@ -716,3 +720,42 @@ void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
     /* Update current pointer for circular buffer */
     AE_ADDCIRC16X4_XC((ae_int16x4 *)p_circ_buf->p_curr, (n_cols-circ_buf_width)*p_circ_buf->row_offset);
 }
+
+void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
+    xa_nn_circ_buf_t *__restrict__ p_circ_buf,
+    const VOID *__restrict__ p_inp,
+    WORD32 top_padding,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 circ_buf_width,
+    WORD32 channels_multiplier,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 output_height,
+    WORD32 n_cols,
+    WORD32 left_pad,
+    WORD32 right_pad,
+    pVOID  p_pad_val)
+{
+    xa_nn_dilated_circ_buf_nhwc_add_cols_with_pad_val(p_circ_buf
+                            ,p_inp
+                            ,top_padding
+                            ,input_height
+                            ,input_width
+                            ,input_channels
+                            ,kernel_height
+                            ,circ_buf_width
+                            ,channels_multiplier
+                            ,y_stride
+                            ,y_padding
+                            ,output_height
+                            ,n_cols
+                            ,left_pad
+                            ,right_pad
+                            ,1
+                            ,1
+                            ,p_pad_val
+                            );
+}
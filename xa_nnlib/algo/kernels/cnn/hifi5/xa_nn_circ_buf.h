@@ -29,7 +29,7 @@
 #define ALIGNMENT   8   /* 8 bytes alignment */
 
 #define ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
-#define ALIGN_PTR(x, bytes)     ((((unsigned)(x))+(bytes-1))&(~(bytes-1)))
+#define ALIGN_PTR(x, bytes)     ((((uintptr_t)(x))+(bytes-1))&(~(bytes-1)))
 
 #define LIMIT(input, min, max) \
     input = XT_MAX(min, XT_MIN(max, input));
@@ -329,6 +329,64 @@ in horizontal direction */
                             ); \
     UPDATE_COLS_ADDED(cols_added, cols_to_add) \
 
+/* Dilated versions of the above: input_height and input_width are the sizes of
+   the sub-image of every y_dilation-th row and x_dilation-th column that is
+   gathered, input_row_width the width of the input itself */
+#define CIRC_BUF_ADD_COLS_INIT_DILATED_WITH_PAD_VAL(cols_added, cols_to_add, left_pad, right_pad, input_col, \
+    input_height, input_width, input_row_width, input_channels, kernel_width, channels_multiplier, x_stride, \
+    x_padding, y_padding, x_dilation, y_dilation, output_height, p_circ_buf, pt_inp, p_pad_val) \
+    INIT_COLS_ADDED(cols_added, x_padding) \
+    INIT_COLS_TO_ADD(cols_to_add, kernel_width, x_stride) \
+    CALC_PADDINGS_LR(left_pad, right_pad, cols_added, cols_to_add, input_width) \
+    CALC_INP_COL(input_col, cols_added, input_width) \
+    xa_nn_dilated_circ_buf_nhwc_add_cols_with_pad_val(p_circ_buf \
+                            ,&(pt_inp)[input_col*x_dilation*input_channels] \
+                            ,y_padding \
+                            ,input_height \
+                            ,input_row_width \
+                            ,input_channels \
+                            ,kernel_height \
+                            ,kernel_width \
+                            ,channels_multiplier \
+                            ,y_stride \
+                            ,y_padding \
+                            ,output_height \
+                            ,cols_to_add \
+                            ,left_pad \
+                            ,right_pad \
+                            ,x_dilation \
+                            ,y_dilation \
+                            ,p_pad_val \
+                            ); \
+    UPDATE_COLS_ADDED(cols_added, cols_to_add) \
+
+#define CIRC_BUF_ADD_COLS_DILATED_WITH_PAD_VAL(cols_added, cols_to_add, left_pad, right_pad, input_col, \
+    input_height, input_width, input_row_width, input_channels, kernel_width, channels_multiplier, x_stride, \
+    x_padding, y_padding, x_dilation, y_dilation, output_height, p_circ_buf, pt_inp, p_pad_val) \
+    CALC_COLS_TO_ADD(cols_to_add, x_stride) \
+    CALC_PADDINGS_LR(left_pad, right_pad, cols_added, cols_to_add, input_width) \
+    CALC_INP_COL(input_col, cols_added, input_width) \
+    xa_nn_dilated_circ_buf_nhwc_add_cols_with_pad_val(p_circ_buf \
+                            ,&(pt_inp)[input_col*x_dilation*input_channels] \
+                            ,y_padding \
+                            ,input_height \
+                            ,input_row_width \
+                            ,input_channels \
+                            ,kernel_height \
+                            ,kernel_width \
+                            ,channels_multiplier \
+                            ,y_stride \
+                            ,y_padding \
+                            ,output_height \
+                            ,cols_to_add \
+                            ,left_pad \
+                            ,right_pad \
+                            ,x_dilation \
+                            ,y_dilation \
+                            ,p_pad_val \
+                            ); \
+    UPDATE_COLS_ADDED(cols_added, cols_to_add) \
+
 WORD32 xa_nn_circ_buf_nhwc_getsize(
     WORD32 bytewidth,
     WORD32 input_height,
@@ -388,4 +446,24 @@ void xa_nn_circ_buf_nhwc_add_cols_with_pad_val(
     WORD32 right_pad,
     pVOID  p_pad_val);
 
+void xa_nn_dilated_circ_buf_nhwc_add_cols_with_pad_val(
+    xa_nn_circ_buf_t *p_circ_buf,
+    const VOID *p_inp,
+    WORD32 top_padding,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 circ_buf_width,
+    WORD32 channels_multiplier,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 output_height,
+    WORD32 n_cols,
+    WORD32 left_pad,
+    WORD32 right_pad,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    pVOID  p_pad_val);
+
 #endif /* #ifndef __XA_NN_CIRC_BUF_H__ */
@@ -197,7 +197,7 @@ WORD32 xa_nn_conv1d_std_16x16(
     xa_nn_matXvec_16x16_16_circ_nb
       (p_out /* output */
        ,p_kernel /* mat: rows x cols */
-       ,p_state->cir_buf.p_curr/* vec: cols */
+       ,(WORD16 *)p_state->cir_buf.p_curr/* vec: cols */
        ,p_bias /* bias */
        ,out_channels /* rows */
        ,input_channelsXwidth_pad * kernel_height /* cols */
@@ -205,7 +205,7 @@ WORD32 xa_nn_conv1d_std_8x8(
     xa_nn_matXvec_8x8_8_circ_nb
       (p_out /* output */
        ,p_kernel /* mat: rows x cols */
-       ,p_state->cir_buf.p_curr/* vec: cols */
+       ,(WORD8 *)p_state->cir_buf.p_curr/* vec: cols */
        ,p_bias /* bias */
        ,out_channels /* rows */
        ,input_channelsXwidth_pad * kernel_height /* cols */
@@ -211,7 +211,7 @@ WORD32 xa_nn_conv1d_std_asym8xasym8(
     xa_nn_matXvec_asym8xasym8_asym8_circ_nb
       (p_out /* output */
        ,p_kernel /* mat: rows x cols */
-       ,p_state->cir_buf.p_curr/* vec: cols */
+       ,(UWORD8 *)p_state->cir_buf.p_curr/* vec: cols */
        ,p_bias /* bias */
        ,out_channels /* rows */
        ,input_channelsXwidth_pad * kernel_height /* cols */
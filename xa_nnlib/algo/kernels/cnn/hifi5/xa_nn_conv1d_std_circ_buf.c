@@ -24,6 +24,7 @@
 #include "common.h"
 #include "xa_nn_conv1d_std_state.h"
 #include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
 
 WORD32 xa_nn_conv1d_std_getsize(
     WORD32 kernel_height,
@@ -39,7 +40,7 @@ WORD32 xa_nn_conv1d_std_getsize(
   WORD32 input_size;
   WORD32 align_size;
 
-  mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), ALIGNMENT);
+  mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), 16); /* ALIGNED_ADDR aligns to 16 */
   switch(input_precision)
   {
     case 8:
@@ -114,10 +115,10 @@ VOID xa_nn_conv1d_std_init_state(
   }
 
   p_mem += sizeof(xa_nn_conv_state_t);
-  p_mem = ALIGNED_ADDR(p_mem, ALIGNMENT);
+  p_mem = (WORD8 *)ALIGNED_ADDR(p_mem, ALIGNMENT);
 
 
-  if(((UWORD32)p_kernel & BUS_WIDTH_MASK) == ((UWORD32)p_mem & BUS_WIDTH_MASK))
+  if(((uintptr_t)p_kernel & BUS_WIDTH_MASK) == ((uintptr_t)p_mem & BUS_WIDTH_MASK))
   {
     p_mem += BUS_WIDTH; /* Add a offset to avoid banking stall */
   }
@@ -151,7 +152,7 @@ VOID conv1d_std_init_cir_buf(
     xa_nn_conv_state_t *p_state)
 {
   WORD32 k;
-  VOID *p_inp = *pp_inp;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
   WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
   AE_ADDCIRC16X4_XC((ae_int16x4*)p_dst, y_stride * input_channelsXwidth_pad * input_bytewidth);
 
@@ -199,7 +200,7 @@ VOID conv1d_std_update_cir_buf(
     xa_nn_conv_state_t *p_state)
 {
   WORD32 k;
-  VOID *p_inp = *pp_inp;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
 
   // Copy 'y_stride' planes of data to circular buffer
   AE_ADDCIRC16X4_XC(p_state->cir_buf.p_curr, y_stride * input_channelsXwidth_pad * input_bytewidth);
@@ -265,7 +266,7 @@ VOID conv1d_std_init_cir_buf_asym8(
     WORD32 pad_val)
 {
   WORD32 k;
-  VOID *p_inp = *pp_inp;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
   WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
   UWORD8 pad_val_u8 = (UWORD8)pad_val;
   AE_ADDCIRC16X4_XC((ae_int16x4*)p_dst, y_stride * input_channelsXwidth_pad * input_bytewidth);
@@ -315,7 +316,7 @@ VOID conv1d_std_update_cir_buf_asym8(
     WORD32 pad_val)
 {
   WORD32 k;
-  VOID *p_inp = *pp_inp;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
   UWORD8 pad_val_u8 = (UWORD8)pad_val;
 
   // Copy 'y_stride' planes of data to circular buffer
@@ -367,3 +368,289 @@ VOID conv1d_std_update_cir_buf_asym8(
 
   *pp_inp = p_inp;
 }
+
+WORD32 xa_nn_conv1d_std_stream_getsize(
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+
+  WORD32 input_size;
+  WORD32 align_size;
+
+  switch(input_precision)
+  {
+    case 8:
+      input_size = sizeof(WORD8);
+      align_size = ALIGNMENT>>1;
+      break;
+    case 16:
+      input_size = sizeof(WORD16);
+      align_size = ALIGNMENT>>1;
+      break;
+    case -1:
+      input_size = sizeof(WORD32);
+      align_size = ALIGNMENT>>2;
+      break;
+    default:
+      return -1;
+      break;
+  }
+
+  WORD32 input_channelsXwidth_pad = PADDED_SIZE(input_channels*input_width, align_size);
+
+  /* State followed by a circular buffer of kernel_height rows */
+  return ALIGNED_SIZE(sizeof(xa_nn_conv1d_stream_state_t), 16) + /* ALIGNED_ADDR aligns to 16 */
+         kernel_height * input_channelsXwidth_pad * input_size;
+}
+
+WORD32 xa_nn_conv1d_std_stream_init(
+    VOID *p_handle,
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 input_precision)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_handle, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_handle, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_width <= 0 || input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || y_stride > kernel_height), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || y_padding >= kernel_height), -1);
+
+  WORD32 handle_size = xa_nn_conv1d_std_stream_getsize(kernel_height, input_width, input_channels, input_precision);
+  XA_NNLIB_ARG_CHK_COND((handle_size < 0), -1);
+
+  xa_nn_conv1d_stream_state_t *p_state = (xa_nn_conv1d_stream_state_t *)p_handle;
+  WORD8 *p_mem = (WORD8 *)p_handle + sizeof(xa_nn_conv1d_stream_state_t);
+  p_mem = (WORD8 *)ALIGNED_ADDR(p_mem, ALIGNMENT);
+
+  p_state->handle_size = handle_size;
+  p_state->kernel_height = kernel_height;
+  p_state->input_channels = input_channels;
+  p_state->input_width = input_width;
+  p_state->input_bytewidth = input_precision == -1 ? sizeof(FLOAT32) : input_precision / 8;
+  p_state->input_channelsXwidth_pad = PADDED_SIZE(input_channels*input_width, (input_precision == -1) ? (ALIGNMENT>>2) : (ALIGNMENT>>1));
+  p_state->y_stride = y_stride;
+  p_state->y_padding = y_padding;
+
+  p_state->conv_state.cir_buf.p_begin = p_mem;
+  p_state->conv_state.cir_buf.p_end = p_mem + kernel_height * p_state->input_channelsXwidth_pad * p_state->input_bytewidth;
+
+  return xa_nn_conv1d_std_stream_reset(p_handle);
+}
+
+WORD32 xa_nn_conv1d_std_stream_reset(
+    VOID *p_handle)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_handle, -1);
+
+  xa_nn_conv1d_stream_state_t *p_state = (xa_nn_conv1d_stream_state_t *)p_handle;
+  circular_buf_t *p_cir_buf = &p_state->conv_state.cir_buf;
+
+  /* History of y_padding zero rows */
+  memset(p_cir_buf->p_begin, 0, (WORD8 *)p_cir_buf->p_end - (WORD8 *)p_cir_buf->p_begin);
+  p_cir_buf->p_curr = p_cir_buf->p_begin;
+  p_state->rows_filled = p_state->y_padding;
+
+  return 0;
+}
+
+WORD32 xa_nn_conv1d_std_stream_copy(
+    VOID *p_dst_handle,
+    const VOID *p_src_handle)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_dst_handle, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_src_handle, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_dst_handle, ALIGNMENT, -1);
+
+  const xa_nn_conv1d_stream_state_t *p_src = (const xa_nn_conv1d_stream_state_t *)p_src_handle;
+  xa_nn_conv1d_stream_state_t *p_dst = (xa_nn_conv1d_stream_state_t *)p_dst_handle;
+  const circular_buf_t *p_src_buf = &p_src->conv_state.cir_buf;
+  WORD32 buf_size = (WORD8 *)p_src_buf->p_end - (WORD8 *)p_src_buf->p_begin;
+  WORD32 curr_offset = (WORD8 *)p_src_buf->p_curr - (WORD8 *)p_src_buf->p_begin;
+
+  if(p_dst_handle == p_src_handle)
+    return 0;
+
+  /* The buffer pointers are rebased on the destination handle */
+  memcpy(p_dst, p_src, sizeof(xa_nn_conv1d_stream_state_t));
+  WORD8 *p_mem = (WORD8 *)ALIGNED_ADDR((WORD8 *)p_dst_handle + sizeof(xa_nn_conv1d_stream_state_t), ALIGNMENT);
+  p_dst->conv_state.cir_buf.p_begin = p_mem;
+  p_dst->conv_state.cir_buf.p_end = p_mem + buf_size;
+  p_dst->conv_state.cir_buf.p_curr = p_mem + curr_offset;
+  memcpy(p_mem, p_src_buf->p_begin, buf_size);
+
+  return 0;
+}
+
+// Circular buffer registers for the stream; they are shared with other kernels
+VOID conv1d_std_stream_set_cir_buf(
+    xa_nn_conv1d_stream_state_t *p_state)
+{
+  AE_SETCBEGIN0(p_state->conv_state.cir_buf.p_begin);
+  AE_SETCEND0(p_state->conv_state.cir_buf.p_end);
+}
+
+// Append one input row to the window; returns 1 when the window is complete
+WORD32 conv1d_std_stream_push_row(
+    xa_nn_conv1d_stream_state_t *p_state,
+    const VOID **pp_inp)
+{
+  WORD32 row_bytes = p_state->input_channels * p_state->input_width * p_state->input_bytewidth;
+  WORD32 row_pad_bytes = p_state->input_channelsXwidth_pad * p_state->input_bytewidth;
+  WORD8 *p_dst = (WORD8 *)p_state->conv_state.cir_buf.p_curr;
+
+  AE_ADDCIRC16X4_XC((ae_int16x4*)p_dst, p_state->rows_filled * row_pad_bytes);
+  memcpy(p_dst, *pp_inp, row_bytes);
+  memset(&p_dst[row_bytes], 0, row_pad_bytes - row_bytes);
+  *pp_inp = (const WORD8 *)*pp_inp + row_bytes;
+
+  p_state->rows_filled++;
+  return p_state->rows_filled == p_state->kernel_height;
+}
+
+// Slide the window by y_stride rows once its output is computed
+VOID conv1d_std_stream_advance(
+    xa_nn_conv1d_stream_state_t *p_state)
+{
+  AE_ADDCIRC16X4_XC(p_state->conv_state.cir_buf.p_curr, p_state->y_stride * p_state->input_channelsXwidth_pad * p_state->input_bytewidth);
+  p_state->rows_filled -= p_state->y_stride;
+}
+
+WORD32 xa_nn_dilated_conv1d_std_getsize(
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_dilation,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((y_dilation <= 0), -1);
+
+  WORD32 mem_req = 0;
+  WORD32 input_size;
+  WORD32 align_size;
+
+  switch(input_precision)
+  {
+    case 8:
+      input_size = sizeof(WORD8);
+      align_size = ALIGNMENT>>1;
+      break;
+    case 16:
+      input_size = sizeof(WORD16);
+      align_size = ALIGNMENT>>1;
+      break;
+    case -1:
+      input_size = sizeof(WORD32);
+      align_size = ALIGNMENT>>2;
+      break;
+    default:
+      return -1;
+      break;
+  }
+
+  WORD32 input_channelsXwidth_pad = PADDED_SIZE(input_channels*input_width, align_size);
+
+  /* State and the y_dilation circular buffer descriptors */
+  mem_req += ALIGNED_SIZE(sizeof(xa_nn_dilated_conv1d_state_t) + y_dilation * sizeof(circular_buf_t), 16);
+  /* One circular buffer of kernel_height rows per row phase */
+  mem_req += y_dilation * PADDED_SIZE(kernel_height * input_channelsXwidth_pad * input_size, 16);
+  mem_req += 16; /* ALIGNED_ADDR of the first buffer */
+
+  return mem_req;
+}
+
+VOID xa_nn_dilated_conv1d_std_init_state(
+    VOID *p_scratch,
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_dilation,
+    WORD32 input_precision)
+{
+  WORD32 i;
+  xa_nn_dilated_conv1d_state_t *p_state = (xa_nn_dilated_conv1d_state_t *)p_scratch;
+  WORD8 *p_mem = (WORD8 *)p_scratch + sizeof(xa_nn_dilated_conv1d_state_t);
+
+  p_state->input_bytewidth = input_precision == -1 ? sizeof(FLOAT32) : input_precision / 8;
+  p_state->input_channelsXwidth_pad = PADDED_SIZE(input_channels*input_width, (input_precision == -1) ? (ALIGNMENT>>2) : (ALIGNMENT>>1));
+  p_state->y_dilation = y_dilation;
+  p_state->kernel_height = kernel_height;
+  p_state->input_channels = input_channels;
+  p_state->input_width = input_width;
+  p_state->rows_added = 0;
+
+  p_mem = (WORD8 *)ALIGNED_ADDR(p_mem, ALIGNMENT);
+  p_state->p_cir_buf = (circular_buf_t *)p_mem;
+  p_mem += y_dilation * sizeof(circular_buf_t);
+  p_mem = (WORD8 *)ALIGNED_ADDR(p_mem, 16);
+
+  WORD32 cir_buf_size_bytes = kernel_height * p_state->input_channelsXwidth_pad * p_state->input_bytewidth;
+  for(i=0;i<y_dilation;i++)
+  {
+    /* Rows older than the first ones added are the zeros of the top padding */
+    memset(p_mem, 0, cir_buf_size_bytes);
+    p_state->p_cir_buf[i].p_begin = p_mem;
+    p_state->p_cir_buf[i].p_curr = p_mem;
+    p_state->p_cir_buf[i].p_end = p_mem + cir_buf_size_bytes;
+    p_mem += PADDED_SIZE(cir_buf_size_bytes, 16);
+  }
+}
+
+// Add padded input rows up to the last dilated tap of the output row starting at
+// idx_beg_inp_height_pad; returns the circular buffer of that row phase, with p_curr
+// at the first tap and the circular registers set on it
+circular_buf_t *conv1d_dilated_std_update_cir_buf(
+    xa_nn_dilated_conv1d_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 idx_beg_inp_height_pad)
+{
+  WORD32 row_bytes = p_state->input_channels * p_state->input_width * p_state->input_bytewidth;
+  WORD32 row_pad_bytes = p_state->input_channelsXwidth_pad * p_state->input_bytewidth;
+  WORD32 idx_end_inp_height_pad = idx_beg_inp_height_pad + (p_state->kernel_height - 1) * p_state->y_dilation;
+  circular_buf_t *p_cir_buf;
+
+  for(; p_state->rows_added <= idx_end_inp_height_pad; p_state->rows_added++)
+  {
+    WORD32 inp_row = p_state->rows_added - y_padding;
+    p_cir_buf = &p_state->p_cir_buf[p_state->rows_added % p_state->y_dilation];
+    WORD8 *p_dst = (WORD8 *)p_cir_buf->p_curr;
+
+    // The oldest row of the phase is replaced, p_curr moves to the next oldest
+    if(inp_row < 0 || inp_row >= input_height)
+    {
+      memset(p_dst, 0, row_pad_bytes);
+    }
+    else
+    {
+      memcpy(p_dst, (const WORD8 *)p_inp + inp_row * row_bytes, row_bytes);
+      memset(&p_dst[row_bytes], 0, row_pad_bytes - row_bytes);
+    }
+    p_dst += row_pad_bytes;
+    p_cir_buf->p_curr = p_dst == (WORD8 *)p_cir_buf->p_end ? p_cir_buf->p_begin : (VOID *)p_dst;
+  }
+
+  p_cir_buf = &p_state->p_cir_buf[idx_beg_inp_height_pad % p_state->y_dilation];
+  AE_SETCBEGIN0(p_cir_buf->p_begin);
+  AE_SETCEND0(p_cir_buf->p_end);
+
+  return p_cir_buf;
+}
@@ -178,7 +178,7 @@ WORD32 xa_nn_conv1d_std_f32(
     xa_nn_matXvec_f32_circ_nb
       (p_out /* output */
        ,p_kernel /* mat: rows x cols */
-       ,p_state->cir_buf.p_curr/* vec: cols */
+       ,(FLOAT32 *)p_state->cir_buf.p_curr/* vec: cols */
        ,p_bias /* bias */
        ,out_channels /* rows */
        ,input_channelsXwidth_pad * kernel_height /* cols */
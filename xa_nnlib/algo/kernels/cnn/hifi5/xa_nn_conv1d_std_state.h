@@ -24,6 +24,63 @@
 
 #include "xa_nn_conv2d_std_state.h"
 
+/* Persistent state of the streaming conv1d: a circular buffer of
+   kernel_height input rows that survives between calls. p_curr of the
+   buffer is the oldest row of the current window; rows_filled rows from
+   there hold data. */
+typedef struct _xa_nn_conv1d_stream_state_t{
+  xa_nn_conv_state_t conv_state;
+  WORD32 handle_size;
+  WORD32 kernel_height;
+  WORD32 input_channels;
+  WORD32 input_width;
+  WORD32 input_channelsXwidth_pad;
+  WORD32 input_bytewidth;
+  WORD32 y_stride;
+  WORD32 y_padding;
+  WORD32 rows_filled;
+} xa_nn_conv1d_stream_state_t;
+
+VOID conv1d_std_stream_set_cir_buf(
+    xa_nn_conv1d_stream_state_t *p_state);
+
+WORD32 conv1d_std_stream_push_row(
+    xa_nn_conv1d_stream_state_t *p_state,
+    const VOID **pp_inp);
+
+VOID conv1d_std_stream_advance(
+    xa_nn_conv1d_stream_state_t *p_state);
+
+/* State of the dilated conv1d: one circular buffer of kernel_height rows
+   per input row phase (row index modulo y_dilation). The dilated taps of an
+   output row are consecutive rows of a single phase, so each buffer feeds
+   the matXvec directly. */
+typedef struct _xa_nn_dilated_conv1d_state_t{
+  circular_buf_t *p_cir_buf;
+  WORD32 y_dilation;
+  WORD32 kernel_height;
+  WORD32 input_channels;
+  WORD32 input_width;
+  WORD32 input_channelsXwidth_pad;
+  WORD32 input_bytewidth;
+  WORD32 rows_added;
+} xa_nn_dilated_conv1d_state_t;
+
+VOID xa_nn_dilated_conv1d_std_init_state(
+    VOID *p_scratch,
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_dilation,
+    WORD32 input_precision);
+
+circular_buf_t *conv1d_dilated_std_update_cir_buf(
+    xa_nn_dilated_conv1d_state_t *p_state,
+    const VOID *p_inp,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 idx_beg_inp_height_pad);
+
 VOID xa_nn_conv1d_std_init_state(
     VOID *p_handle,
     VOID *p_kernel,
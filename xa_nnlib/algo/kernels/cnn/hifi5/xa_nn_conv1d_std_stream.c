@@ -0,0 +1,235 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv1d_std_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Streaming conv1d: each call appends input_rows rows to the persistent
+   circular buffer of p_handle and computes every output row whose window
+   completes, in [n][out_channels] order. Returns the number of output rows
+   written, at most (input_rows + y_stride - 1) / y_stride. p_out needs no
+   alignment, so that rows can be appended to one output buffer. */
+
+#define CHK_STREAM_ARGS(bytewidth) \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_handle, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_handle, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT, -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((input_rows < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((((xa_nn_conv1d_stream_state_t *)p_handle)->input_bytewidth != (bytewidth)), -1);
+
+#define CHK_STREAM_SHIFTS \
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1); \
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1); \
+  /* Same effective shifts as the batch conv1d kernels */ \
+  bias_shift = bias_shift > 63 ? 63 : bias_shift < -63 ? -63 : bias_shift; \
+  acc_shift = acc_shift + 32; \
+  acc_shift = acc_shift > 63 ? 63 : acc_shift < -63 ? -63 : acc_shift;
+
+WORD32 xa_nn_conv1d_std_stream_8x16(
+    VOID *p_handle,
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD8 * __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift)
+{
+  CHK_STREAM_ARGS(sizeof(WORD16))
+  CHK_STREAM_SHIFTS
+
+  WORD32 i, out_rows = 0;
+  const VOID *pp_inp = (const VOID *)p_inp;
+  xa_nn_conv1d_stream_state_t *p_state = (xa_nn_conv1d_stream_state_t *)p_handle;
+
+  conv1d_std_stream_set_cir_buf(p_state);
+
+  for(i=0;i<input_rows;i++)
+  {
+    if(!conv1d_std_stream_push_row(p_state, &pp_inp))
+      continue;
+
+    // Convolution using matXvec with vec as circular buffer
+    xa_nn_matXvec_8x16_16_circ_nb
+      (p_out /* output */
+       ,p_kernel /* mat: rows x cols */
+       ,(WORD16 *)p_state->conv_state.cir_buf.p_curr /* vec: cols */
+       ,p_bias /* bias */
+       ,out_channels /* rows */
+       ,p_state->input_channelsXwidth_pad * p_state->kernel_height /* cols */
+       ,1
+       ,bias_shift
+       ,acc_shift
+      );
+
+    conv1d_std_stream_advance(p_state);
+    p_out += out_channels;
+    out_rows++;
+  }
+
+  return out_rows;
+}
+
+WORD32 xa_nn_conv1d_std_stream_8x8(
+    VOID *p_handle,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift)
+{
+  CHK_STREAM_ARGS(sizeof(WORD8))
+  CHK_STREAM_SHIFTS
+
+  WORD32 i, out_rows = 0;
+  const VOID *pp_inp = (const VOID *)p_inp;
+  xa_nn_conv1d_stream_state_t *p_state = (xa_nn_conv1d_stream_state_t *)p_handle;
+
+  conv1d_std_stream_set_cir_buf(p_state);
+
+  for(i=0;i<input_rows;i++)
+  {
+    if(!conv1d_std_stream_push_row(p_state, &pp_inp))
+      continue;
+
+    xa_nn_matXvec_8x8_8_circ_nb
+      (p_out
+       ,p_kernel
+       ,(WORD8 *)p_state->conv_state.cir_buf.p_curr
+       ,p_bias
+       ,out_channels
+       ,p_state->input_channelsXwidth_pad * p_state->kernel_height
+       ,1
+       ,bias_shift
+       ,acc_shift
+      );
+
+    conv1d_std_stream_advance(p_state);
+    p_out += out_channels;
+    out_rows++;
+  }
+
+  return out_rows;
+}
+
+WORD32 xa_nn_conv1d_std_stream_16x16(
+    VOID *p_handle,
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift)
+{
+  CHK_STREAM_ARGS(sizeof(WORD16))
+  CHK_STREAM_SHIFTS
+
+  WORD32 i, out_rows = 0;
+  const VOID *pp_inp = (const VOID *)p_inp;
+  xa_nn_conv1d_stream_state_t *p_state = (xa_nn_conv1d_stream_state_t *)p_handle;
+
+  conv1d_std_stream_set_cir_buf(p_state);
+
+  for(i=0;i<input_rows;i++)
+  {
+    if(!conv1d_std_stream_push_row(p_state, &pp_inp))
+      continue;
+
+    xa_nn_matXvec_16x16_16_circ_nb
+      (p_out
+       ,p_kernel
+       ,(WORD16 *)p_state->conv_state.cir_buf.p_curr
+       ,p_bias
+       ,out_channels
+       ,p_state->input_channelsXwidth_pad * p_state->kernel_height
+       ,1
+       ,bias_shift
+       ,acc_shift
+      );
+
+    conv1d_std_stream_advance(p_state);
+    p_out += out_channels;
+    out_rows++;
+  }
+
+  return out_rows;
+}
+
+#if HAVE_VFPU
+WORD32 xa_nn_conv1d_std_stream_f32(
+    VOID *p_handle,
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    FLOAT32* __restrict__ p_kernel,
+    FLOAT32* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels)
+{
+  CHK_STREAM_ARGS(sizeof(FLOAT32))
+
+  WORD32 i, out_rows = 0;
+  const VOID *pp_inp = (const VOID *)p_inp;
+  xa_nn_conv1d_stream_state_t *p_state = (xa_nn_conv1d_stream_state_t *)p_handle;
+
+  conv1d_std_stream_set_cir_buf(p_state);
+
+  for(i=0;i<input_rows;i++)
+  {
+    if(!conv1d_std_stream_push_row(p_state, &pp_inp))
+      continue;
+
+    xa_nn_matXvec_f32_circ_nb
+      (p_out
+       ,p_kernel
+       ,(FLOAT32 *)p_state->conv_state.cir_buf.p_curr
+       ,p_bias
+       ,out_channels
+       ,p_state->input_channelsXwidth_pad * p_state->kernel_height
+       ,1
+      );
+
+    conv1d_std_stream_advance(p_state);
+    p_out += out_channels;
+    out_rows++;
+  }
+
+  return out_rows;
+}
+#endif /* HAVE_VFPU */
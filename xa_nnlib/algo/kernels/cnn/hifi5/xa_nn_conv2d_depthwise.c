@@ -117,7 +117,7 @@ static VOID xa_nn_conv2d_depthwise_nchw_init
 {
     WORD32 circ_buf_height = (kernel_height + ((OUT_HEIGHT_PER_ITER - 1) * y_stride));
 
-    pWORD8 p_mem = p_scratch;
+    pWORD8 p_mem = (pWORD8)p_scratch;
     xa_nn_conv2d_dw_state_t *p_state = (xa_nn_conv2d_dw_state_t *)p_mem;
     int state_size, circ_buf_size;
     state_size = sizeof(xa_nn_conv2d_dw_state_t);
@@ -137,7 +137,7 @@ static VOID xa_nn_conv2d_depthwise_nchw_init
                         ,p_pad_val
                         );
 
-    circ_buf_size = (int)((unsigned)p_state->circ_buf.p_end - (unsigned)p_state->circ_buf.p_begin);
+    circ_buf_size = (int)((uintptr_t)p_state->circ_buf.p_end - (uintptr_t)p_state->circ_buf.p_begin);
     /* Get aligned size so as to have next memory pointer aligned */
 
     /* Every row of circular buffer is 8 byte aligned so don't need ALIGNED_SIZE for circular
@@ -233,7 +233,7 @@ static VOID xa_nn_conv2d_depthwise_nhwc_init
  )
 
 {
-    pWORD8 p_mem = p_scratch;
+    pWORD8 p_mem = (pWORD8)p_scratch;
     xa_nn_circ_buf_t *p_state = (xa_nn_circ_buf_t *)p_mem;
     int state_size;
     state_size = ALIGNED_SIZE(sizeof(xa_nn_circ_buf_t), ALIGNMENT);
@@ -432,6 +432,85 @@ WORD32 xa_nn_conv2d_depthwise_getsize
     return total_size_generic_case;
 }
 
+/* Dilated depthwise convolution runs one undilated convolution per dilation
+   phase on the sub-image of the phase; the scratch fits the largest one */
+WORD32 xa_nn_dilated_conv2d_depthwise_getsize
+(WORD32 input_height
+ ,WORD32 input_width
+ ,WORD32 input_channels
+ ,WORD32 kernel_height
+ ,WORD32 kernel_width
+ ,WORD32 channels_multiplier
+ ,WORD32 x_stride
+ ,WORD32 y_stride
+ ,WORD32 x_padding
+ ,WORD32 y_padding
+ ,WORD32 x_dilation
+ ,WORD32 y_dilation
+ ,WORD32 output_height
+ ,WORD32 output_width
+ ,WORD32 circ_buf_precision
+ ,WORD32 inp_data_format
+ )
+{
+  XA_NNLIB_CHK_COND((x_dilation <= 0 || y_dilation <= 0), -1);
+
+  if(x_dilation == 1 && y_dilation == 1)
+  {
+    return xa_nn_conv2d_depthwise_getsize
+      (input_height
+       ,input_width
+       ,input_channels
+       ,kernel_height
+       ,kernel_width
+       ,channels_multiplier
+       ,x_stride
+       ,y_stride
+       ,x_padding
+       ,y_padding
+       ,output_height
+       ,output_width
+       ,circ_buf_precision
+       ,inp_data_format
+      );
+  }
+
+  XA_NNLIB_CHK_COND((input_height <= 0), -1);
+  XA_NNLIB_CHK_COND((input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((channels_multiplier <= 0), -1);
+  XA_NNLIB_CHK_COND((x_stride <= 0 || x_stride > kernel_width), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0 || y_stride > kernel_height), -1);
+  XA_NNLIB_CHK_COND((x_dilation > 1 && x_stride != 1), -1);
+  XA_NNLIB_CHK_COND((y_dilation > 1 && y_stride != 1), -1);
+  XA_NNLIB_CHK_COND((x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0), -1);
+  XA_NNLIB_CHK_COND((output_height <= 0), -1);
+  XA_NNLIB_CHK_COND((output_width <= 0), -1);
+  /* Only NHWC sym8sxasym8s is supported */
+  XA_NNLIB_CHK_COND((circ_buf_precision != PREC_ASYM8S), -1);
+  XA_NNLIB_CHK_COND((inp_data_format != 0), -1);
+
+  return xa_nn_conv2d_depthwise_getsize_generic
+    ((input_height + y_dilation - 1) / y_dilation
+     ,(input_width + x_dilation - 1) / x_dilation
+     ,input_channels
+     ,kernel_height
+     ,kernel_width
+     ,channels_multiplier
+     ,x_stride
+     ,y_stride
+     ,(x_padding + x_dilation - 1) / x_dilation
+     ,(y_padding + y_dilation - 1) / y_dilation
+     ,(output_height + y_dilation - 1) / y_dilation
+     ,(output_width + x_dilation - 1) / x_dilation
+     ,circ_buf_precision
+     ,inp_data_format
+    );
+}
+
 VOID xa_nn_conv2d_depthwise_init
 (pVOID p_scratch
  ,WORD32 input_height
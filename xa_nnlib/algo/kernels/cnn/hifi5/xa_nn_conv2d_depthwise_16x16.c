@@ -977,7 +977,7 @@ static void xa_nn_conv2d_depthwise_nhwc_16x16
              ,y_stride
              ,acc_shift
              ,bias_shift
-             ,p_scratch
+             ,(pWORD32)p_scratch
             );
     }
 }
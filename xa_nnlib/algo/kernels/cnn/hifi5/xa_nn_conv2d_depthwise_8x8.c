@@ -804,7 +804,7 @@ static void xa_nn_conv2d_depthwise_nhwc_8x8
       ,y_stride
       ,acc_shift
       ,bias_shift
-      ,p_scratch
+      ,(pWORD32)p_scratch
       );
   }
 }
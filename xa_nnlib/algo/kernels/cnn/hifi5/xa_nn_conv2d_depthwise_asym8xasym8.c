@@ -905,7 +905,7 @@ static void xa_nn_conv2d_depthwise_nhwc_asym8xasym8
       ,out_multiplier
       ,out_shift
       ,out_zero_bias
-      ,p_scratch
+      ,(pWORD32)p_scratch
       );
   }
 }
@@ -902,7 +902,7 @@ static void xa_nn_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s
       ,p_out_multiplier
       ,p_out_shift
       ,out_zero_bias
-      ,p_scratch
+      ,(pWORD32)p_scratch
       );
   }
 }
@@ -2398,7 +2398,7 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
     pWORD8 p_kernel_nchw;
     p_scratch = (void *)ALIGN_PTR(p_scratch, ALIGNMENT_16);
     p_kernel_nchw = (pWORD8)p_scratch;
-    p_scratch += ALIGNED_SIZE(channels_multiplier * kernel_height * kernel_width, ALIGNMENT_16);
+    p_scratch = (pWORD8)p_scratch + ALIGNED_SIZE(channels_multiplier * kernel_height * kernel_width, ALIGNMENT_16);
 
     /* Rearrange the kernel in NCHW format */
     xa_nn_rearrange_hwc_to_chw(p_kernel_nchw, p_kernel, kernel_height, kernel_width, channels_multiplier);
@@ -2496,3 +2496,284 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
       );
   }
 }
+
+/* Dilated NHWC depthwise convolution: outputs are split in x_dilation x
+   y_dilation phases, the outputs of a phase only read the sub-image of every
+   x_dilation-th column and y_dilation-th row of the input, with which they
+   form an undilated convolution. The circular buffer gathers the sub-image
+   directly from the input. */
+static void xa_nn_dilated_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  x_dilation
+  ,WORD32  y_dilation
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32  *p_out_multiplier
+  ,const WORD32  *p_out_shift
+  ,WORD32  out_zero_bias
+  ,pVOID p_scratch
+  )
+{
+  UWORD8 input_zero_bias_neg = -input_zero_bias;
+  xa_nn_circ_buf_t *p_circ_buf = (xa_nn_circ_buf_t *)p_scratch;
+  int itr_py, itr_px, itr_ow;
+  int cols_to_add, left_pad, right_pad, cols_added;
+  int input_col;
+  const WORD8 *pt_inp;
+  pWORD8 p_inp_circ;
+
+  for(itr_py = 0; itr_py < y_dilation; itr_py++)
+  {
+    /* Geometry of the rows of the phase, in units of y_dilation input rows */
+    int out_height_phase = (out_height - itr_py + y_dilation - 1) / y_dilation;
+    int y_padding_phase = y_padding > itr_py ? (y_padding - itr_py + y_dilation - 1) / y_dilation : 0;
+    int input_row_phase = itr_py + y_padding_phase * y_dilation - y_padding;
+    int input_height_phase = input_height > input_row_phase ? (input_height - input_row_phase + y_dilation - 1) / y_dilation : 0;
+
+    if(out_height_phase <= 0)
+      continue;
+
+    for(itr_px = 0; itr_px < x_dilation; itr_px++)
+    {
+      int out_width_phase = (out_width - itr_px + x_dilation - 1) / x_dilation;
+      int x_padding_phase = x_padding > itr_px ? (x_padding - itr_px + x_dilation - 1) / x_dilation : 0;
+      int input_col_phase = itr_px + x_padding_phase * x_dilation - x_padding;
+      int input_width_phase = input_width > input_col_phase ? (input_width - input_col_phase + x_dilation - 1) / x_dilation : 0;
+
+      if(out_width_phase <= 0)
+        continue;
+
+      xa_nn_conv2d_depthwise_init
+        (p_scratch
+        ,input_height_phase
+        ,input_width_phase
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,channels_multiplier
+        ,x_stride
+        ,y_stride
+        ,x_padding_phase
+        ,y_padding_phase
+        ,out_height_phase
+        ,out_width_phase
+        ,8
+        ,0
+        ,(pVOID)(&input_zero_bias_neg)
+        );
+
+      AE_SETCBEGIN0(p_circ_buf->p_begin);
+      AE_SETCEND0(p_circ_buf->p_end);
+
+      pt_inp = &p_inp[(input_row_phase * input_width + input_col_phase) * input_channels];
+
+      CIRC_BUF_ADD_COLS_INIT_DILATED_WITH_PAD_VAL
+        (cols_added
+        ,cols_to_add
+        ,left_pad
+        ,right_pad
+        ,input_col
+        ,input_height_phase
+        ,input_width_phase
+        ,input_width
+        ,input_channels
+        ,kernel_width
+        ,channels_multiplier
+        ,x_stride
+        ,x_padding_phase
+        ,y_padding_phase
+        ,x_dilation
+        ,y_dilation
+        ,out_height_phase
+        ,p_circ_buf
+        ,pt_inp
+        ,&input_zero_bias_neg
+        );
+
+#pragma loop_count min=1
+      for(itr_ow = 0; itr_ow < out_width_phase; itr_ow++)
+      {
+        CIRC_BUF_ADD_COLS_DILATED_WITH_PAD_VAL
+          (cols_added
+          ,cols_to_add
+          ,left_pad
+          ,right_pad
+          ,input_col
+          ,input_height_phase
+          ,input_width_phase
+          ,input_width
+          ,input_channels
+          ,kernel_width
+          ,channels_multiplier
+          ,x_stride
+          ,x_padding_phase
+          ,y_padding_phase
+          ,x_dilation
+          ,y_dilation
+          ,out_height_phase
+          ,p_circ_buf
+          ,pt_inp
+          ,&input_zero_bias_neg
+          );
+
+        p_inp_circ = (WORD8 *)p_circ_buf->p_curr;
+
+        /* Output rows of the phase are y_dilation output rows apart */
+        conv2d_nhwc_per_chan_sym8sxasym8s
+          ((pWORD8)(&p_out[(itr_py * out_width + itr_px + itr_ow * x_dilation) * input_channels * channels_multiplier])
+          ,p_kernel
+          ,p_inp_circ
+          ,p_bias
+          ,kernel_height
+          ,kernel_width
+          ,out_height_phase
+          ,out_width * y_dilation
+          ,(input_channels * channels_multiplier)
+          ,x_stride
+          ,y_stride
+          ,input_zero_bias
+          ,p_out_multiplier
+          ,p_out_shift
+          ,out_zero_bias
+          ,(pWORD32)p_scratch
+          );
+      }
+    }
+  }
+}
+
+WORD32 xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  x_dilation
+  ,WORD32  y_dilation
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  )
+{
+  int i;
+  XA_NNLIB_ARG_CHK_COND((x_dilation <= 0 || y_dilation <= 0), -1);
+
+  if(x_dilation == 1 && y_dilation == 1)
+  {
+    return xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
+      (p_out
+      ,p_kernel
+      ,p_inp
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,channels_multiplier
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,inp_data_format
+      ,out_data_format
+      ,p_scratch
+      );
+  }
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT_16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((channels_multiplier <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias > 128 || input_zero_bias < -127), -1);
+  for(i = 0; i < input_channels*channels_multiplier; i++)
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[i] < -31 || p_out_shift[i] > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND((inp_data_format != 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_dilation > 1 && y_stride != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((x_dilation > 1 && x_stride != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride > kernel_height), -1);
+  XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
+
+  xa_nn_dilated_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,x_dilation
+    ,y_dilation
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,p_scratch
+    );
+
+  return 0;
+}
@@ -217,7 +217,7 @@ WORD32 xa_nn_conv2d_std_8x16(
     // Convolution using matXvec with matrix as circular buffer
     xa_nn_matXvec_8x16_16_circ
       (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+       ,(WORD16 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
        ,p_kernel /* vec: cols */
        ,p_bias /* bias */
        ,out_height /* rows */
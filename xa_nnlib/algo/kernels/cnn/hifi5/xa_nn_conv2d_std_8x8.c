@@ -223,7 +223,7 @@ WORD32 xa_nn_conv2d_std_8x8(
     // Convolution using matXvec with matrix as circular buffer
     xa_nn_matXvec_8x8_8_circ
       (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+       ,(WORD8 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
        ,p_kernel /* vec: cols */
        ,p_bias /* bias */
        ,out_height /* rows */
@@ -228,7 +228,7 @@ WORD32 xa_nn_conv2d_std_asym8uxasym8u(
     // Convolution using matXvec with matrix as circular buffer
     xa_nn_matXvec_asym8xasym8_asym8_circ
       (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+       ,(UWORD8 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
        ,p_kernel /* vec: cols */
        ,p_bias /* bias */
        ,out_height /* rows */
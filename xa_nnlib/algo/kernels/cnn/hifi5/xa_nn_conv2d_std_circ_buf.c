@@ -47,7 +47,7 @@ WORD32 xa_nn_conv2d_std_getsize(
   WORD32 align_size;
   WORD32 input_channels_pad;
 
-  mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), ALIGNMENT);
+  mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), 16); /* ALIGNED_ADDR aligns to 16 */
   /* Input precision is checked here */
   switch(input_precision)
   {
@@ -138,10 +138,10 @@ VOID xa_nn_conv2d_std_init_state(
   }
 
   p_mem += sizeof(xa_nn_conv_state_t);
-  p_mem = ALIGNED_ADDR(p_mem, ALIGNMENT);
+  p_mem = (WORD8 *)ALIGNED_ADDR(p_mem, ALIGNMENT);
 
 
-  if(((UWORD32)p_kernel & BUS_WIDTH_MASK) == ((UWORD32)p_mem & BUS_WIDTH_MASK))
+  if(((uintptr_t)p_kernel & BUS_WIDTH_MASK) == ((uintptr_t)p_mem & BUS_WIDTH_MASK))
   {
     p_mem += BUS_WIDTH; /* Add a offset to avoid banking stall */
   }
@@ -174,8 +174,14 @@ VOID xa_nn_conv2d_std_init_state(
 
 }
 
-VOID conv2d_std_init_cir_buf(
+// Consecutive input pixels are input_channels_stride elements apart and consecutive
+// input rows input_row_stride: input_channels and input_width * input_channels for a
+// dense input. One group of a grouped convolution steps pixels by the total channel
+// count, one phase of a dilated convolution steps x_dilation pixels and y_dilation rows
+VOID conv2d_std_init_cir_buf_stride(
     WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
     WORD32 input_channels_pad,
     WORD32 input_bytewidth,
     WORD32 input_width,
@@ -246,11 +252,11 @@ VOID conv2d_std_init_cir_buf(
       }
       for(k=0;k<copy_inp_width;k++)
       {
-        AE_L8_IP(inp_val, (ae_int8 *)p_inp, 1);
+        AE_L8_XP(inp_val, (ae_int8 *)p_inp, input_channels_stride);
         AE_S8_0_XC(inp_val, (ae_int8 *)p_dst, 1);
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep);
-      p_inp += (input_width - copy_inp_width);
+      p_inp += input_row_stride - copy_inp_width * input_channels_stride;
     }
     // Set last 'y_b_pad' rows of cir_buf to zero
     for(i=0;i<y_b_pad;i++)
@@ -261,7 +267,7 @@ VOID conv2d_std_init_cir_buf(
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep);
     }
-    p_inp += (-input_height * input_width + copy_inp_width);
+    p_inp += -input_height * input_row_stride + copy_inp_width * input_channels_stride;
     *pp_inp = (VOID *)p_inp;
   }
   else
@@ -278,10 +284,10 @@ VOID conv2d_std_init_cir_buf(
         memcpy(p_dst, p_inp, input_channels * input_bytewidth);
         memset(&p_dst[input_channels * input_bytewidth], 0, (input_channels_pad - input_channels) * input_bytewidth);
         AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, input_channels_pad * input_bytewidth);
-        p_inp += input_channels * input_bytewidth;
+        p_inp += input_channels_stride * input_bytewidth;
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * input_channels_pad * input_bytewidth);
-      p_inp += (input_width - copy_inp_width) * input_channels * input_bytewidth;
+      p_inp += (input_row_stride - copy_inp_width * input_channels_stride) * input_bytewidth;
     }
 
     // Set last 'y_b_pad' rows of cir_buf to zero
@@ -294,14 +300,33 @@ VOID conv2d_std_init_cir_buf(
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * input_channels_pad * input_bytewidth);
     }
-    p_inp += (-input_height * input_width + copy_inp_width) * input_channels * input_bytewidth;
+    p_inp += (-input_height * input_row_stride + copy_inp_width * input_channels_stride) * input_bytewidth;
     *pp_inp = (VOID *)p_inp;
   }
 }
 
+VOID conv2d_std_init_cir_buf(
+    WORD32 input_channels,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state)
+{
+  conv2d_std_init_cir_buf_stride(input_channels, input_channels, input_width * input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding, kernel_width, x_stride, pp_inp, p_state);
+}
+
 // Add x_stride (but not more than kernel_width) x (input_height x input_channels) new planes to circular buffer
-VOID conv2d_std_update_cir_buf(
+VOID conv2d_std_update_cir_buf_stride(
     WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
     WORD32 input_channels_pad,
     WORD32 input_bytewidth,
     WORD32 input_width,
@@ -363,7 +388,7 @@ VOID conv2d_std_update_cir_buf(
         /* Input height */
         for(i = 0; i < input_height; i++)
         {
-          AE_L8_XP(inp_val, (ae_int8 *)p_inp_temp, input_width);
+          AE_L8_XP(inp_val, (ae_int8 *)p_inp_temp, input_row_stride);
           AE_S8_0_XC(inp_val, (ae_int8 *)p_dst_temp, kernel_width);
         }
 
@@ -372,7 +397,7 @@ VOID conv2d_std_update_cir_buf(
         {
           AE_S8_0_XC(zero_pad, (ae_int8 *)p_dst_temp, kernel_width);
         }
-        p_inp += input_channels * input_bytewidth;
+        p_inp += input_channels_stride * input_bytewidth;
       }
 
       /* Update the index and destination frame pointer */
@@ -409,7 +434,7 @@ VOID conv2d_std_update_cir_buf(
         for(i = 0; i < input_height; i++)
         {
           memcpy(p_dst_temp, p_inp_temp, input_channels * input_bytewidth);
-          p_inp_temp += input_width * input_channels * input_bytewidth;
+          p_inp_temp += input_row_stride * input_bytewidth;
           memset(&p_dst_temp[input_channels * input_bytewidth], 0, (input_channels_pad - input_channels) * input_bytewidth);
           AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * input_channels_pad * input_bytewidth);
         }
@@ -420,7 +445,7 @@ VOID conv2d_std_update_cir_buf(
           memset(p_dst_temp, 0, input_channels_pad * input_bytewidth);
           AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * input_channels_pad * input_bytewidth);
         }
-        p_inp += input_channels * input_bytewidth;
+        p_inp += input_channels_stride * input_bytewidth;
       }
 
       /* Update the index and destination frame pointer */
@@ -430,12 +455,32 @@ VOID conv2d_std_update_cir_buf(
   }
 
   /* Skip required number of input frames */
-  p_inp += to_skip_inp_width * input_channels * input_bytewidth;
+  p_inp += to_skip_inp_width * input_channels_stride * input_bytewidth;
   *pp_inp = (VOID *)p_inp;
 }
 
-VOID conv2d_std_init_cir_buf_asym8(
+VOID conv2d_std_update_cir_buf(
+    WORD32 input_channels,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state)
+{
+  conv2d_std_update_cir_buf_stride(input_channels, input_channels, input_width * input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding, kernel_width, x_stride, pp_inp, idx_beg_inp_width_pad, p_state);
+}
+
+VOID conv2d_std_init_cir_buf_asym8_stride(
     WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
     WORD32 input_channels_pad,
     WORD32 input_bytewidth,
     WORD32 input_width,
@@ -509,11 +554,11 @@ VOID conv2d_std_init_cir_buf_asym8(
       }
       for(k=0;k<copy_inp_width;k++)
       {
-        AE_L8_IP(inp_val, (ae_int8 *)p_inp, 1);
+        AE_L8_XP(inp_val, (ae_int8 *)p_inp, input_channels_stride);
         AE_S8_0_XC(inp_val, (ae_int8 *)p_dst, 1);
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep);
-      p_inp += (input_width - copy_inp_width);
+      p_inp += input_row_stride - copy_inp_width * input_channels_stride;
     }
     // Set last 'y_b_pad' rows of cir_buf to zero
     for(i=0;i<y_b_pad;i++)
@@ -524,7 +569,7 @@ VOID conv2d_std_init_cir_buf_asym8(
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep);
     }
-    p_inp += (-input_height * input_width + copy_inp_width);
+    p_inp += -input_height * input_row_stride + copy_inp_width * input_channels_stride;
     *pp_inp = (VOID *)p_inp;
   }
   else
@@ -541,10 +586,10 @@ VOID conv2d_std_init_cir_buf_asym8(
         memcpy(p_dst, p_inp, input_channels);
         memset(&p_dst[input_channels], pad_val_u8, (input_channels_pad - input_channels));
         AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, input_channels_pad);
-        p_inp += input_channels;
+        p_inp += input_channels_stride;
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * input_channels_pad);
-      p_inp += (input_width - copy_inp_width) * input_channels;
+      p_inp += input_row_stride - copy_inp_width * input_channels_stride;
     }
 
     // Set last 'y_b_pad' rows of cir_buf to zero
@@ -557,14 +602,34 @@ VOID conv2d_std_init_cir_buf_asym8(
       }
       AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * input_channels_pad);
     }
-    p_inp += (-input_height * input_width + copy_inp_width) * input_channels;
+    p_inp += -input_height * input_row_stride + copy_inp_width * input_channels_stride;
     *pp_inp = (VOID *)p_inp;
   }
 }
 
+VOID conv2d_std_init_cir_buf_asym8(
+    WORD32 input_channels,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val)
+{
+  conv2d_std_init_cir_buf_asym8_stride(input_channels, input_channels, input_width * input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding, kernel_width, x_stride, pp_inp, p_state, pad_val);
+}
+
 // Add x_stride (but not more than kernel_width) x (input_height x input_channels) new planes to circular buffer
-VOID conv2d_std_update_cir_buf_asym8(
+VOID conv2d_std_update_cir_buf_asym8_stride(
     WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
     WORD32 input_channels_pad,
     WORD32 input_bytewidth,
     WORD32 input_width,
@@ -629,7 +694,7 @@ VOID conv2d_std_update_cir_buf_asym8(
         /* Input height */
         for(i = 0; i < input_height; i++)
         {
-          AE_L8_XP(inp_val, (ae_int8 *)p_inp_temp, input_width);
+          AE_L8_XP(inp_val, (ae_int8 *)p_inp_temp, input_row_stride);
           AE_S8_0_XC(inp_val, (ae_int8 *)p_dst_temp, kernel_width);
         }
 
@@ -638,7 +703,7 @@ VOID conv2d_std_update_cir_buf_asym8(
         {
           AE_S8_0_XC(zero_pad, (ae_int8 *)p_dst_temp, kernel_width);
         }
-        p_inp += input_channels;
+        p_inp += input_channels_stride;
       }
 
       /* Update the index and destination frame pointer */
@@ -675,7 +740,7 @@ VOID conv2d_std_update_cir_buf_asym8(
         for(i = 0; i < input_height; i++)
         {
           memcpy(p_dst_temp, p_inp_temp, input_channels);
-          p_inp_temp += input_width * input_channels;
+          p_inp_temp += input_row_stride;
           memset(&p_dst_temp[input_channels], pad_val_8, (input_channels_pad - input_channels));
           AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * input_channels_pad);
         }
@@ -686,7 +751,7 @@ VOID conv2d_std_update_cir_buf_asym8(
           memset(p_dst_temp, pad_val_8, input_channels_pad);
           AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst_temp, kernel_width * input_channels_pad);
         }
-        p_inp += input_channels;
+        p_inp += input_channels_stride;
       }
 
       /* Update the index and destination frame pointer */
@@ -696,7 +761,26 @@ VOID conv2d_std_update_cir_buf_asym8(
   }
 
   /* Skip required number of input frames */
-  p_inp += to_skip_inp_width * input_channels;
+  p_inp += to_skip_inp_width * input_channels_stride;
   *pp_inp = (VOID *)p_inp;
 
 }
+
+VOID conv2d_std_update_cir_buf_asym8(
+    WORD32 input_channels,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val)
+{
+  conv2d_std_update_cir_buf_asym8_stride(input_channels, input_channels, input_width * input_channels, input_channels_pad, input_bytewidth, input_width, input_height, y_padding, y_b_pad, x_padding, kernel_width, x_stride, pp_inp, idx_beg_inp_width_pad, p_state, pad_val);
+}
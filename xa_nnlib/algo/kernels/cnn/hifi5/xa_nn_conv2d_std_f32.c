@@ -211,7 +211,7 @@ WORD32 xa_nn_conv2d_std_f32(
     // Convolution using matXvec with matrix as circular buffer
     xa_nn_matXvec_f32_circ
       (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+       ,(FLOAT32 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
        ,(FLOAT32 *)p_kernel /* vec: cols */
        ,(FLOAT32 *)p_bias /* bias */
        ,out_height /* rows */
@@ -29,7 +29,7 @@
 
 
 #define ALIGNED_ADDR( addr, align ) \
-  (void*)( ( (UWORD32)(addr) + ( (16) - 1 ) ) & ~( (16) - 1 ) )
+  (void*)( ( (uintptr_t)(addr) + ( (16) - 1 ) ) & ~( (16) - 1 ) )
 
 
 #define ALIGNED_SIZE( size, align ) \
@@ -165,6 +165,22 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
     WORD32 * p_out_shift,
     WORD32 out_offset);
 
+WORD32 xa_nn_matXvec_sym8sxasym16s_asym16s_circ(
+    WORD16 * __restrict__ p_out,
+    WORD16 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD64 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_stride,
+    WORD32 out_col_offset,
+    WORD32 out_row_offset,
+    const WORD32 * p_out_multiplier,
+    const WORD32 * p_out_shift,
+    WORD32 out_offset);
+
 VOID conv2d_std_init_cir_buf(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -179,6 +195,24 @@ VOID conv2d_std_init_cir_buf(
     VOID **pp_inp,
     xa_nn_conv_state_t *p_state);
 
+/* _stride variants read input pixels input_channels_stride and input rows
+   input_row_stride elements apart, the plain ones a dense input */
+VOID conv2d_std_init_cir_buf_stride(
+    WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state);
+
 VOID conv2d_std_update_cir_buf(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -194,6 +228,23 @@ VOID conv2d_std_update_cir_buf(
     WORD32 idx_beg_inp_width_pad,
     xa_nn_conv_state_t *p_state);
 
+VOID conv2d_std_update_cir_buf_stride(
+    WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state);
+
 VOID conv2d_std_init_cir_buf_asym8(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -209,6 +260,23 @@ VOID conv2d_std_init_cir_buf_asym8(
     xa_nn_conv_state_t *p_state,
     WORD32 pad_val);
 
+VOID conv2d_std_init_cir_buf_asym8_stride(
+    WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val);
+
 VOID conv2d_std_update_cir_buf_asym8(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -225,5 +293,23 @@ VOID conv2d_std_update_cir_buf_asym8(
     xa_nn_conv_state_t *p_state,
     WORD32 pad_val);
 
+VOID conv2d_std_update_cir_buf_asym8_stride(
+    WORD32 input_channels,
+    WORD32 input_channels_stride,
+    WORD32 input_row_stride,
+    WORD32 input_channels_pad,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val);
+
 #endif /* __XA_NN_CONV2D_STD_STATE_H__ */
 
@@ -229,7 +229,7 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     // Convolution using matXvec with matrix as circular buffer
     xa_nn_matXvec_sym8sxasym8s_asym8s_circ
       (p_out /* output */
-       ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+       ,(WORD8 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
        ,p_kernel /* vec: cols */
        ,p_bias /* bias */
        ,out_height /* rows */
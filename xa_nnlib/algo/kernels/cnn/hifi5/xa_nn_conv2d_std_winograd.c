@@ -0,0 +1,762 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "common_fpu.h"
+#include "xa_nn_conv2d_std_state.h"
+
+/* Winograd conv2d_std for 3x3 kernels with unit stride.
+
+   Each m x m output tile is computed from the (m+2) x (m+2) input tile d
+   around it as Y = A^T [ sum over input channels of U . V ] A, where
+   U = G g G^T is the transformed kernel and V = B^T d B the transformed
+   input tile. For every tile position xi the sum over input channels is a
+   matrix multiply of U[xi] (out_channels x input_channels) with V[xi] of a
+   block of tiles, which runs on the batch matXvec kernels.
+
+   The kernel is transformed once at init (xa_nn_conv2d_std_winograd_transform_kernel_*)
+   and reused by every call. f32 uses F(4x4,3x3). The 16x16 and sym8sxasym8s
+   variants use F(2x2,3x3) with G scaled by 2, so all transforms are integral,
+   the 64 bit sums are exact and 4 times the direct sums: the outputs are bit
+   exact with xa_nn_conv2d_std_16x16 and xa_nn_conv2d_std_per_chan_sym8sxasym8s. */
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Tiles per matrix multiply; keeps the scratch independent of the image size */
+#define WG_TILE_BLOCK 8
+/* Smallest input and output channel counts for which the transforms pay off */
+#define WG_MIN_CHANNELS 16
+
+#define WG_F43_TILE 4
+#define WG_F43_POS 36
+#define WG_F23_TILE 2
+#define WG_F23_POS 16
+
+/* F(4x4,3x3) kernel transform matrix G (6x3) */
+static const FLOAT32 wg_f43_g[6][3] = {
+  { 1.0f/4,       0.0f,       0.0f},
+  {-1.0f/6,  -1.0f/6,   -1.0f/6},
+  {-1.0f/6,   1.0f/6,   -1.0f/6},
+  { 1.0f/24,  1.0f/12,   1.0f/6},
+  { 1.0f/24, -1.0f/12,   1.0f/6},
+  {    0.0f,     0.0f,     1.0f}
+};
+
+/* F(2x2,3x3) kernel transform matrix 2G (4x3) */
+static const WORD32 wg_f23_g2[4][3] = {
+  {2,  0, 0},
+  {1,  1, 1},
+  {1, -1, 1},
+  {0,  0, 2}
+};
+
+/* Input channels of the transformed kernel and input rows, padded for the
+   matrix multiply kernel of each precision */
+static WORD32 wg_input_channels_pad(WORD32 input_channels, WORD32 input_precision)
+{
+  switch(input_precision)
+  {
+    case -1:
+      return PADDED_SIZE(input_channels, 4);
+    case 16:
+      return PADDED_SIZE(input_channels, 2);
+    case -4:
+      return PADDED_SIZE(input_channels, 8);
+    default:
+      return -1;
+  }
+}
+
+WORD32 xa_nn_conv2d_std_winograd_select(
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 input_precision)
+{
+#if !HAVE_VFPU
+  if(input_precision == -1)
+    return 0;
+#endif
+  if(wg_input_channels_pad(1, input_precision) < 0)
+    return 0;
+  if(kernel_height != 3 || kernel_width != 3 || x_stride != 1 || y_stride != 1)
+    return 0;
+  return (input_channels >= WG_MIN_CHANNELS) && (out_channels >= WG_MIN_CHANNELS);
+}
+
+WORD32 xa_nn_conv2d_std_winograd_kernel_getsize(
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+
+  WORD32 input_channels_pad = wg_input_channels_pad(input_channels, input_precision);
+  XA_NNLIB_CHK_COND((input_channels_pad < 0), -1);
+
+  switch(input_precision)
+  {
+    case -1:
+      return WG_F43_POS * out_channels * input_channels_pad * sizeof(FLOAT32);
+    case 16:
+      return WG_F23_POS * out_channels * input_channels_pad * sizeof(WORD32);
+    default:
+      return WG_F23_POS * out_channels * input_channels_pad * sizeof(WORD16);
+  }
+}
+
+WORD32 xa_nn_conv2d_std_winograd_getsize(
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+
+  WORD32 input_channels_pad = wg_input_channels_pad(input_channels, input_precision);
+  XA_NNLIB_CHK_COND((input_channels_pad < 0), -1);
+
+  WORD32 num_pos, inp_bytes, acc_bytes, bias_bytes;
+  switch(input_precision)
+  {
+    case -1:
+      num_pos = WG_F43_POS; inp_bytes = sizeof(FLOAT32); acc_bytes = sizeof(FLOAT32); bias_bytes = sizeof(FLOAT32);
+      break;
+    case 16:
+      num_pos = WG_F23_POS; inp_bytes = sizeof(WORD32); acc_bytes = sizeof(WORD64); bias_bytes = 0;
+      break;
+    default:
+      num_pos = WG_F23_POS; inp_bytes = sizeof(WORD16); acc_bytes = sizeof(WORD64); bias_bytes = sizeof(WORD16);
+      break;
+  }
+
+  /* Transformed input tiles, products, zero bias and the batch pointers */
+  return ALIGNED_SIZE(0, 16) /* ALIGNED_ADDR aligns to 16 */ +
+         PADDED_SIZE(num_pos * WG_TILE_BLOCK * input_channels_pad * inp_bytes, 16) +
+         PADDED_SIZE(num_pos * WG_TILE_BLOCK * out_channels * acc_bytes, 16) +
+         PADDED_SIZE(out_channels * bias_bytes, 16) +
+         PADDED_SIZE(2 * WG_TILE_BLOCK * sizeof(VOID *), 16);
+}
+
+#define CHK_WINOGRAD_KERNEL_ARGS \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_wg, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel_wg, 16, -1); \
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+
+/* Kernel rows are [out_channels][3][3][input_channels_pad] as for
+   xa_nn_conv2d_std_*; the transformed kernel is [xi][out_channels][ic_pad]
+   with zeros in the padded channels. */
+#if HAVE_VFPU
+WORD32 xa_nn_conv2d_std_winograd_transform_kernel_f32(
+    VOID *p_kernel_wg,
+    const FLOAT32 *p_kernel,
+    WORD32 input_channels,
+    WORD32 out_channels)
+{
+  CHK_WINOGRAD_KERNEL_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(FLOAT32), -1);
+
+  WORD32 ic_pad = wg_input_channels_pad(input_channels, -1);
+  WORD32 kernel_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>2));
+  FLOAT32 *p_u = (FLOAT32 *)p_kernel_wg;
+  WORD32 oc, ic, i, j, k;
+
+  memset(p_u, 0, WG_F43_POS * out_channels * ic_pad * sizeof(FLOAT32));
+  for(oc = 0; oc < out_channels; oc++)
+  {
+    for(ic = 0; ic < input_channels; ic++)
+    {
+      const FLOAT32 *p_g = &p_kernel[oc * 9 * kernel_channels_pad + ic];
+      FLOAT32 tmp[6][3];
+      /* tmp = G g */
+      for(i = 0; i < 6; i++)
+        for(j = 0; j < 3; j++)
+        {
+          FLOAT32 sum = 0.0f;
+          for(k = 0; k < 3; k++)
+            sum += wg_f43_g[i][k] * p_g[(k * 3 + j) * kernel_channels_pad];
+          tmp[i][j] = sum;
+        }
+      /* U = tmp G^T */
+      for(i = 0; i < 6; i++)
+        for(j = 0; j < 6; j++)
+        {
+          FLOAT32 sum = 0.0f;
+          for(k = 0; k < 3; k++)
+            sum += tmp[i][k] * wg_f43_g[j][k];
+          p_u[((i * 6 + j) * out_channels + oc) * ic_pad + ic] = sum;
+        }
+    }
+  }
+  return 0;
+}
+#endif /* HAVE_VFPU */
+
+#define WG_F23_TRANSFORM_KERNEL(p_u, p_kernel, kernel_channels_pad) \
+  for(oc = 0; oc < out_channels; oc++) \
+  { \
+    for(ic = 0; ic < input_channels; ic++) \
+    { \
+      WORD32 g[3][3], tmp[4][3]; \
+      for(i = 0; i < 3; i++) \
+        for(j = 0; j < 3; j++) \
+          g[i][j] = p_kernel[(oc * 9 + i * 3 + j) * kernel_channels_pad + ic]; \
+      /* tmp = 2G g, U = tmp (2G)^T */ \
+      for(i = 0; i < 4; i++) \
+        for(j = 0; j < 3; j++) \
+          tmp[i][j] = wg_f23_g2[i][0] * g[0][j] + wg_f23_g2[i][1] * g[1][j] + wg_f23_g2[i][2] * g[2][j]; \
+      for(i = 0; i < 4; i++) \
+        for(j = 0; j < 4; j++) \
+          p_u[((i * 4 + j) * out_channels + oc) * ic_pad + ic] = \
+            tmp[i][0] * wg_f23_g2[j][0] + tmp[i][1] * wg_f23_g2[j][1] + tmp[i][2] * wg_f23_g2[j][2]; \
+    } \
+  }
+
+WORD32 xa_nn_conv2d_std_winograd_transform_kernel_16x16(
+    VOID *p_kernel_wg,
+    const WORD16 *p_kernel,
+    WORD32 input_channels,
+    WORD32 out_channels)
+{
+  CHK_WINOGRAD_KERNEL_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(WORD16), -1);
+
+  WORD32 ic_pad = wg_input_channels_pad(input_channels, 16);
+  WORD32 *p_u = (WORD32 *)p_kernel_wg;
+  WORD32 oc, ic, i, j;
+
+  memset(p_u, 0, WG_F23_POS * out_channels * ic_pad * sizeof(WORD32));
+  WG_F23_TRANSFORM_KERNEL(p_u, p_kernel, PADDED_SIZE(input_channels, (ALIGNMENT>>1)));
+  return 0;
+}
+
+WORD32 xa_nn_conv2d_std_winograd_transform_kernel_sym8s(
+    VOID *p_kernel_wg,
+    const WORD8 *p_kernel,
+    WORD32 input_channels,
+    WORD32 out_channels)
+{
+  CHK_WINOGRAD_KERNEL_ARGS
+
+  WORD32 ic_pad = wg_input_channels_pad(input_channels, -4);
+  WORD16 *p_u = (WORD16 *)p_kernel_wg;
+  WORD32 oc, ic, i, j;
+
+  /* |U| <= 9 * 128 fits 16 bits */
+  memset(p_u, 0, WG_F23_POS * out_channels * ic_pad * sizeof(WORD16));
+  WG_F23_TRANSFORM_KERNEL(p_u, p_kernel, input_channels);
+  return 0;
+}
+
+/* Common argument checks of the Winograd convolutions */
+#define CHK_WINOGRAD_CONV_ARGS \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_wg, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel_wg, 16, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((input_height < 3 || input_width < 3), -1); \
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+/* Scratch layout: transformed input tiles [xi][tile][ic_pad], products
+   [xi][tile][out_channels], a zero bias and the batch pointer arrays */
+#define WG_SETUP_SCRATCH(inp_type, acc_type, bias_type, num_pos) \
+  WORD32 ic_pad = wg_input_channels_pad(input_channels, input_precision); \
+  inp_type *p_v = (inp_type *)ALIGNED_ADDR(p_scratch, 16); \
+  acc_type *p_m = (acc_type *)((WORD8 *)p_v + PADDED_SIZE(num_pos * WG_TILE_BLOCK * ic_pad * sizeof(inp_type), 16)); \
+  bias_type *p_zero_bias = (bias_type *)((WORD8 *)p_m + PADDED_SIZE(num_pos * WG_TILE_BLOCK * out_channels * sizeof(acc_type), 16)); \
+  VOID **pp_vec = (VOID **)((WORD8 *)p_zero_bias + PADDED_SIZE(out_channels * sizeof(bias_type), 16)); \
+  VOID **pp_acc = pp_vec + WG_TILE_BLOCK; \
+  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1; \
+  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels; \
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels; \
+  WORD32 tiles_h, tiles_w, ty, tx, t, nt, xi, oc;
+
+/* Loads the input tile of size TILE with its top left corner at input
+   row iy, column ix, channel ic; padding reads as PAD_VAL */
+#define WG_LOAD_INPUT_TILE(d, TILE, PAD_VAL, ZERO_BIAS) \
+  { \
+    WORD32 r, c; \
+    for(r = 0; r < TILE; r++) \
+      for(c = 0; c < TILE; c++) \
+      { \
+        WORD32 y = iy + r, x = ix + c; \
+        d[r][c] = (y < 0 || y >= input_height || x < 0 || x >= input_width) ? PAD_VAL : \
+                  p_inp[(y * input_width + x) * input_channels + ic] + ZERO_BIAS; \
+      } \
+  }
+
+/* V = B^T d B for F(2x2,3x3) */
+#define WG_F23_INPUT_TRANSFORM(v, d) \
+  { \
+    WORD32 r; \
+    for(r = 0; r < 4; r++) \
+    { \
+      WORD32 t0 = d[0][r] - d[2][r], t1 = d[1][r] + d[2][r]; \
+      WORD32 t2 = d[2][r] - d[1][r], t3 = d[1][r] - d[3][r]; \
+      d[0][r] = t0; d[1][r] = t1; d[2][r] = t2; d[3][r] = t3; \
+    } \
+    for(r = 0; r < 4; r++) \
+    { \
+      v[r * 4 + 0] = d[r][0] - d[r][2]; \
+      v[r * 4 + 1] = d[r][1] + d[r][2]; \
+      v[r * 4 + 2] = d[r][2] - d[r][1]; \
+      v[r * 4 + 3] = d[r][1] - d[r][3]; \
+    } \
+  }
+
+/* Y = A^T M A for F(2x2,3x3), M given per tile position */
+#define WG_F23_OUTPUT_TRANSFORM(y, m) \
+  { \
+    WORD64 s0 = m[0] + m[1] + m[2],   s1 = m[1] - m[2] - m[3]; \
+    WORD64 s4 = m[4] + m[5] + m[6],   s5 = m[5] - m[6] - m[7]; \
+    WORD64 s8 = m[8] + m[9] + m[10],  s9 = m[9] - m[10] - m[11]; \
+    WORD64 s12 = m[12] + m[13] + m[14], s13 = m[13] - m[14] - m[15]; \
+    y[0][0] = s0 + s4 + s8;  y[0][1] = s1 + s5 + s9; \
+    y[1][0] = s4 - s8 - s12; y[1][1] = s5 - s9 - s13; \
+  }
+
+/* Stores the valid outputs of an m x m tile at output row oy, column ox */
+#define WG_STORE_TILE(TILE, STORE) \
+  { \
+    WORD32 r, c; \
+    for(r = 0; r < TILE && oy + r < out_height; r++) \
+      for(c = 0; c < TILE && ox + c < out_width; c++) \
+      { \
+        WORD32 out_idx = (oy + r) * out_height_offset + (ox + c) * out_width_offset + oc * out_channels_offset; \
+        STORE; \
+      } \
+  }
+
+#if HAVE_VFPU
+WORD32 xa_nn_conv2d_std_winograd_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_wg,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_WINOGRAD_CONV_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+
+  WORD32 input_precision = -1;
+  WG_SETUP_SCRATCH(FLOAT32, FLOAT32, FLOAT32, WG_F43_POS)
+  const FLOAT32 *p_u = (const FLOAT32 *)p_kernel_wg;
+
+  memset(p_zero_bias, 0, out_channels * sizeof(FLOAT32));
+  memset(p_v, 0, WG_F43_POS * WG_TILE_BLOCK * ic_pad * sizeof(FLOAT32));
+
+  tiles_h = (out_height + WG_F43_TILE - 1) / WG_F43_TILE;
+  tiles_w = (out_width + WG_F43_TILE - 1) / WG_F43_TILE;
+  for(ty = 0; ty < tiles_h; ty++)
+  {
+    for(tx = 0; tx < tiles_w; tx += WG_TILE_BLOCK)
+    {
+      nt = (tiles_w - tx) < WG_TILE_BLOCK ? (tiles_w - tx) : WG_TILE_BLOCK;
+
+      /* Transform the input tiles of the block */
+      for(t = 0; t < nt; t++)
+      {
+        WORD32 iy = ty * WG_F43_TILE - y_padding;
+        WORD32 ix = (tx + t) * WG_F43_TILE - x_padding;
+        WORD32 ic, r;
+        for(ic = 0; ic < input_channels; ic++)
+        {
+          FLOAT32 d[6][6];
+          FLOAT32 *p_vt = &p_v[t * ic_pad + ic];
+          WG_LOAD_INPUT_TILE(d, 6, 0.0f, 0.0f);
+          /* B^T d, then (B^T d) B */
+          for(r = 0; r < 6; r++)
+          {
+            FLOAT32 x0 = d[0][r], x1 = d[1][r], x2 = d[2][r], x3 = d[3][r], x4 = d[4][r], x5 = d[5][r];
+            d[0][r] = 4.0f * x0 - 5.0f * x2 + x4;
+            d[1][r] = -4.0f * (x1 + x2) + x3 + x4;
+            d[2][r] = 4.0f * (x1 - x2) - x3 + x4;
+            d[3][r] = 2.0f * (x3 - x1) - x2 + x4;
+            d[4][r] = 2.0f * (x1 - x3) - x2 + x4;
+            d[5][r] = 4.0f * x1 - 5.0f * x3 + x5;
+          }
+          for(r = 0; r < 6; r++)
+          {
+            FLOAT32 x0 = d[r][0], x1 = d[r][1], x2 = d[r][2], x3 = d[r][3], x4 = d[r][4], x5 = d[r][5];
+            p_vt[(r * 6 + 0) * WG_TILE_BLOCK * ic_pad] = 4.0f * x0 - 5.0f * x2 + x4;
+            p_vt[(r * 6 + 1) * WG_TILE_BLOCK * ic_pad] = -4.0f * (x1 + x2) + x3 + x4;
+            p_vt[(r * 6 + 2) * WG_TILE_BLOCK * ic_pad] = 4.0f * (x1 - x2) - x3 + x4;
+            p_vt[(r * 6 + 3) * WG_TILE_BLOCK * ic_pad] = 2.0f * (x3 - x1) - x2 + x4;
+            p_vt[(r * 6 + 4) * WG_TILE_BLOCK * ic_pad] = 2.0f * (x1 - x3) - x2 + x4;
+            p_vt[(r * 6 + 5) * WG_TILE_BLOCK * ic_pad] = 4.0f * x1 - 5.0f * x3 + x5;
+          }
+        }
+      }
+
+      /* Sum over input channels per tile position */
+      for(xi = 0; xi < WG_F43_POS; xi++)
+      {
+        for(t = 0; t < nt; t++)
+        {
+          pp_vec[t] = &p_v[(xi * WG_TILE_BLOCK + t) * ic_pad];
+          pp_acc[t] = &p_m[(xi * WG_TILE_BLOCK + t) * out_channels];
+        }
+        xa_nn_matXvec_batch_f32xf32_f32
+          ((FLOAT32 **)pp_acc
+           ,(FLOAT32 *)&p_u[xi * out_channels * ic_pad]
+           ,(FLOAT32 **)pp_vec
+           ,p_zero_bias
+           ,out_channels
+           ,ic_pad
+           ,ic_pad
+           ,nt
+          );
+      }
+
+      /* Inverse transform and bias */
+      for(t = 0; t < nt; t++)
+      {
+        WORD32 oy = ty * WG_F43_TILE, ox = (tx + t) * WG_F43_TILE;
+        for(oc = 0; oc < out_channels; oc++)
+        {
+          const FLOAT32 *p_mt = &p_m[t * out_channels + oc];
+          FLOAT32 s[6][4], y[4][4];
+          WORD32 r;
+          /* M A, then A^T (M A) */
+          for(r = 0; r < 6; r++)
+          {
+            FLOAT32 m0 = p_mt[(r * 6 + 0) * WG_TILE_BLOCK * out_channels];
+            FLOAT32 m1 = p_mt[(r * 6 + 1) * WG_TILE_BLOCK * out_channels];
+            FLOAT32 m2 = p_mt[(r * 6 + 2) * WG_TILE_BLOCK * out_channels];
+            FLOAT32 m3 = p_mt[(r * 6 + 3) * WG_TILE_BLOCK * out_channels];
+            FLOAT32 m4 = p_mt[(r * 6 + 4) * WG_TILE_BLOCK * out_channels];
+            FLOAT32 m5 = p_mt[(r * 6 + 5) * WG_TILE_BLOCK * out_channels];
+            s[r][0] = m0 + m1 + m2 + m3 + m4;
+            s[r][1] = m1 - m2 + 2.0f * (m3 - m4);
+            s[r][2] = m1 + m2 + 4.0f * (m3 + m4);
+            s[r][3] = m1 - m2 + 8.0f * (m3 - m4) + m5;
+          }
+          for(r = 0; r < 4; r++)
+          {
+            y[0][r] = s[0][r] + s[1][r] + s[2][r] + s[3][r] + s[4][r];
+            y[1][r] = s[1][r] - s[2][r] + 2.0f * (s[3][r] - s[4][r]);
+            y[2][r] = s[1][r] + s[2][r] + 4.0f * (s[3][r] + s[4][r]);
+            y[3][r] = s[1][r] - s[2][r] + 8.0f * (s[3][r] - s[4][r]) + s[5][r];
+          }
+          WG_STORE_TILE(WG_F43_TILE, p_out[out_idx] = y[r][c] + p_bias[oc]);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+#endif /* HAVE_VFPU */
+
+/* 64 bit sums of 32 bit transformed kernel and input rows:
+   p_out[vec * rows + row] = sum of p_mat[row][col] * p_vec[vec][col].
+   Unlike the sym8s transforms, which fit in 16 bits and go through
+   xa_nn_matXvec_batch_16x16_64, the F(2x2,3x3) transforms of 16 bit data
+   need 32 bits, and the library has no 32x32 -> 64 bit matXvec to reuse.
+   xa_nn_benchmark measures conv2d_std_winograd_16x16, which spends most
+   of its time here, against xa_nn_conv2d_std_16x16. */
+static VOID wg_matmul_32x32_64(
+    ae_int64 * __restrict__ p_out,
+    const WORD32 * __restrict__ p_mat,
+    const WORD32 * __restrict__ p_vec,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_count)
+{
+  WORD32 vec, row, col;
+
+  for(vec = 0; vec < vec_count; vec++)
+  {
+    for(row = 0; row < (rows & ~1); row += 2)
+    {
+      ae_int64 acc0 = AE_ZERO64(), acc1 = AE_ZERO64();
+      const ae_int32x2 *p_m0 = (const ae_int32x2 *)&p_mat[row * cols];
+      const ae_int32x2 *p_m1 = (const ae_int32x2 *)&p_mat[(row + 1) * cols];
+      const ae_int32x2 *p_v = (const ae_int32x2 *)&p_vec[vec * cols];
+      for(col = 0; col < (cols >> 1); col++)
+      {
+        ae_int32x2 m0, m1, v;
+        AE_L32X2_IP(m0, p_m0, 8);
+        AE_L32X2_IP(m1, p_m1, 8);
+        AE_L32X2_IP(v, p_v, 8);
+        AE_MULA32_HH(acc0, m0, v);
+        AE_MULA32_LL(acc0, m0, v);
+        AE_MULA32_HH(acc1, m1, v);
+        AE_MULA32_LL(acc1, m1, v);
+      }
+      p_out[vec * rows + row] = acc0;
+      p_out[vec * rows + row + 1] = acc1;
+    }
+    if(rows & 1)
+    {
+      ae_int64 acc0 = AE_ZERO64();
+      const ae_int32x2 *p_m0 = (const ae_int32x2 *)&p_mat[row * cols];
+      const ae_int32x2 *p_v = (const ae_int32x2 *)&p_vec[vec * cols];
+      for(col = 0; col < (cols >> 1); col++)
+      {
+        ae_int32x2 m0, v;
+        AE_L32X2_IP(m0, p_m0, 8);
+        AE_L32X2_IP(v, p_v, 8);
+        AE_MULA32_HH(acc0, m0, v);
+        AE_MULA32_LL(acc0, m0, v);
+      }
+      p_out[vec * rows + row] = acc0;
+    }
+  }
+}
+
+WORD32 xa_nn_conv2d_std_winograd_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_wg,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_WINOGRAD_CONV_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+
+  WORD32 input_precision = 16;
+  WG_SETUP_SCRATCH(WORD32, ae_int64, WORD16, WG_F23_POS)
+  const WORD32 *p_u = (const WORD32 *)p_kernel_wg;
+  (VOID)p_zero_bias; (VOID)pp_acc;
+
+  /* Same effective shifts as xa_nn_conv2d_std_16x16 */
+  bias_shift = bias_shift > 63 ? 63 : bias_shift < -63 ? -63 : bias_shift;
+  acc_shift = acc_shift + 32;
+  acc_shift = acc_shift > 63 ? 63 : acc_shift < -63 ? -63 : acc_shift;
+
+  memset(p_v, 0, WG_F23_POS * WG_TILE_BLOCK * ic_pad * sizeof(WORD32));
+
+  tiles_h = (out_height + WG_F23_TILE - 1) / WG_F23_TILE;
+  tiles_w = (out_width + WG_F23_TILE - 1) / WG_F23_TILE;
+  for(ty = 0; ty < tiles_h; ty++)
+  {
+    for(tx = 0; tx < tiles_w; tx += WG_TILE_BLOCK)
+    {
+      nt = (tiles_w - tx) < WG_TILE_BLOCK ? (tiles_w - tx) : WG_TILE_BLOCK;
+
+      for(t = 0; t < nt; t++)
+      {
+        WORD32 iy = ty * WG_F23_TILE - y_padding;
+        WORD32 ix = (tx + t) * WG_F23_TILE - x_padding;
+        WORD32 ic;
+        for(ic = 0; ic < input_channels; ic++)
+        {
+          WORD32 d[4][4], v[16];
+          WG_LOAD_INPUT_TILE(d, 4, 0, 0);
+          WG_F23_INPUT_TRANSFORM(v, d);
+          for(xi = 0; xi < WG_F23_POS; xi++)
+            p_v[(xi * WG_TILE_BLOCK + t) * ic_pad + ic] = v[xi];
+        }
+      }
+
+      for(xi = 0; xi < WG_F23_POS; xi++)
+      {
+        wg_matmul_32x32_64
+          (&p_m[xi * WG_TILE_BLOCK * out_channels]
+           ,&p_u[xi * out_channels * ic_pad]
+           ,&p_v[xi * WG_TILE_BLOCK * ic_pad]
+           ,out_channels
+           ,ic_pad
+           ,nt
+          );
+      }
+
+      for(t = 0; t < nt; t++)
+      {
+        WORD32 oy = ty * WG_F23_TILE, ox = (tx + t) * WG_F23_TILE;
+        for(oc = 0; oc < out_channels; oc++)
+        {
+          WORD64 m[16], y[2][2];
+          ae_int64 bias = AE_SLAA64S((ae_int64)p_bias[oc], bias_shift);
+          for(xi = 0; xi < WG_F23_POS; xi++)
+            m[xi] = p_m[(xi * WG_TILE_BLOCK + t) * out_channels + oc];
+          WG_F23_OUTPUT_TRANSFORM(y, m);
+          /* Sums are exact multiples of 4; rounding as xa_nn_matXvec_16x16_16_circ */
+          WG_STORE_TILE(WG_F23_TILE,
+            ae_int64 acc = AE_SLAA64S(AE_ADD64(bias, (ae_int64)(y[r][c] >> 2)), acc_shift);
+            ae_int32x2 out32 = AE_ROUND32X2F64SSYM(acc, acc);
+            p_out[out_idx] = AE_MOVAD16_0(AE_SAT16X4(out32, out32)));
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_conv2d_std_winograd_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_wg,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_WINOGRAD_CONV_ARGS
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  WORD32 input_precision = -4;
+  WG_SETUP_SCRATCH(WORD16, ae_int64, WORD16, WG_F23_POS)
+  const WORD16 *p_u = (const WORD16 *)p_kernel_wg;
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+
+  memset(p_zero_bias, 0, out_channels * sizeof(WORD16));
+  memset(p_v, 0, WG_F23_POS * WG_TILE_BLOCK * ic_pad * sizeof(WORD16));
+
+  tiles_h = (out_height + WG_F23_TILE - 1) / WG_F23_TILE;
+  tiles_w = (out_width + WG_F23_TILE - 1) / WG_F23_TILE;
+  for(ty = 0; ty < tiles_h; ty++)
+  {
+    for(tx = 0; tx < tiles_w; tx += WG_TILE_BLOCK)
+    {
+      nt = (tiles_w - tx) < WG_TILE_BLOCK ? (tiles_w - tx) : WG_TILE_BLOCK;
+
+      /* Inputs are widened with the zero bias, the padding is zero after it;
+         |V| <= 4 * 255 fits 16 bits */
+      for(t = 0; t < nt; t++)
+      {
+        WORD32 iy = ty * WG_F23_TILE - y_padding;
+        WORD32 ix = (tx + t) * WG_F23_TILE - x_padding;
+        WORD32 ic;
+        for(ic = 0; ic < input_channels; ic++)
+        {
+          WORD32 d[4][4], v[16];
+          WG_LOAD_INPUT_TILE(d, 4, 0, input_zero_bias);
+          WG_F23_INPUT_TRANSFORM(v, d);
+          for(xi = 0; xi < WG_F23_POS; xi++)
+            p_v[(xi * WG_TILE_BLOCK + t) * ic_pad + ic] = (WORD16)v[xi];
+        }
+      }
+
+      for(xi = 0; xi < WG_F23_POS; xi++)
+      {
+        for(t = 0; t < nt; t++)
+        {
+          pp_vec[t] = &p_v[(xi * WG_TILE_BLOCK + t) * ic_pad];
+          pp_acc[t] = &p_m[(xi * WG_TILE_BLOCK + t) * out_channels];
+        }
+        xa_nn_matXvec_batch_16x16_64
+          ((WORD64 **)pp_acc
+           ,(WORD16 *)&p_u[xi * out_channels * ic_pad]
+           ,(WORD16 **)pp_vec
+           ,p_zero_bias
+           ,out_channels
+           ,ic_pad
+           ,ic_pad
+           ,0
+           ,0
+           ,nt
+          );
+      }
+
+      for(t = 0; t < nt; t++)
+      {
+        WORD32 oy = ty * WG_F23_TILE, ox = (tx + t) * WG_F23_TILE;
+        for(oc = 0; oc < out_channels; oc++)
+        {
+          WORD64 m[16], y[2][2];
+          WORD32 left_shift  = p_out_shift[oc] < 0 ? 0 : p_out_shift[oc];
+          WORD32 right_shift = p_out_shift[oc] > 0 ? 0 : -p_out_shift[oc];
+          for(xi = 0; xi < WG_F23_POS; xi++)
+            m[xi] = p_m[(xi * WG_TILE_BLOCK + t) * out_channels + oc];
+          WG_F23_OUTPUT_TRANSFORM(y, m);
+          /* Sums are exact multiples of 4 and wrap to 32 bits as in the direct kernel */
+          WG_STORE_TILE(WG_F23_TILE,
+            ae_int32x2 acc = AE_MOVDA32((WORD32)((UWORD32)(y[r][c] >> 2) + (UWORD32)p_bias[oc]));
+            MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc, p_out_multiplier[oc], left_shift, right_shift);
+            acc = AE_ADD32S(acc, AE_MOVDA32(out_zero_bias));
+            AE_MINMAX32(acc, min_int8, max_int8);
+            p_out[out_idx] = (WORD8)AE_MOVAD32_L(acc));
+        }
+      }
+    }
+  }
+
+  return 0;
+}
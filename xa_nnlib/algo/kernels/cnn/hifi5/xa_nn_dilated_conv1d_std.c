@@ -0,0 +1,270 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv1d_std_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Dilated conv1d: kernel row k of output row j is applied to padded input row
+   j * y_stride + k * y_dilation. The taps are gathered by the per phase
+   circular buffers of the state, so no zero expanded kernel is needed. */
+
+#define CHK_DILATED_CONV1D_ARGS \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_dilation <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+#define CHK_DILATED_CONV1D_SHIFTS \
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1); \
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1); \
+  /* Same effective shifts as the conv1d kernels */ \
+  bias_shift = bias_shift > 63 ? 63 : bias_shift < -63 ? -63 : bias_shift; \
+  acc_shift = acc_shift + 32; \
+  acc_shift = acc_shift > 63 ? 63 : acc_shift < -63 ? -63 : acc_shift;
+
+WORD32 xa_nn_dilated_conv1d_std_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8 * __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV1D_ARGS
+  CHK_DILATED_CONV1D_SHIFTS
+
+  WORD32 j;
+  WORD32 out_channels_offset = out_data_format ? out_height : 1;
+  WORD32 out_height_offset = out_data_format ? 1 : out_channels;
+  xa_nn_dilated_conv1d_state_t *p_state = (xa_nn_dilated_conv1d_state_t *)p_scratch;
+  circular_buf_t *p_cir_buf;
+
+  xa_nn_dilated_conv1d_std_init_state(p_scratch, kernel_height, input_width, input_channels, y_dilation, 16);
+
+  // Process Loop to compute one output line [out_channels] per iteration
+  for(j=0;j<out_height;j++)
+  {
+    p_cir_buf = conv1d_dilated_std_update_cir_buf(p_state, p_inp, input_height, y_padding, j * y_stride);
+
+    // Convolution using matXvec with vec as circular buffer
+    xa_nn_matXvec_8x16_16_circ_nb
+      (p_out /* output */
+       ,p_kernel /* mat: rows x cols */
+       ,(WORD16 *)p_cir_buf->p_curr /* vec: cols */
+       ,p_bias /* bias */
+       ,out_channels /* rows */
+       ,p_state->input_channelsXwidth_pad * kernel_height /* cols */
+       ,out_channels_offset
+       ,bias_shift
+       ,acc_shift
+      );
+
+    p_out += out_height_offset;
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_dilated_conv1d_std_8x8(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV1D_ARGS
+  CHK_DILATED_CONV1D_SHIFTS
+
+  WORD32 j;
+  WORD32 out_channels_offset = out_data_format ? out_height : 1;
+  WORD32 out_height_offset = out_data_format ? 1 : out_channels;
+  xa_nn_dilated_conv1d_state_t *p_state = (xa_nn_dilated_conv1d_state_t *)p_scratch;
+  circular_buf_t *p_cir_buf;
+
+  xa_nn_dilated_conv1d_std_init_state(p_scratch, kernel_height, input_width, input_channels, y_dilation, 8);
+
+  for(j=0;j<out_height;j++)
+  {
+    p_cir_buf = conv1d_dilated_std_update_cir_buf(p_state, p_inp, input_height, y_padding, j * y_stride);
+
+    xa_nn_matXvec_8x8_8_circ_nb
+      (p_out
+       ,p_kernel
+       ,(WORD8 *)p_cir_buf->p_curr
+       ,p_bias
+       ,out_channels
+       ,p_state->input_channelsXwidth_pad * kernel_height
+       ,out_channels_offset
+       ,bias_shift
+       ,acc_shift
+      );
+
+    p_out += out_height_offset;
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_dilated_conv1d_std_16x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV1D_ARGS
+  CHK_DILATED_CONV1D_SHIFTS
+
+  WORD32 j;
+  WORD32 out_channels_offset = out_data_format ? out_height : 1;
+  WORD32 out_height_offset = out_data_format ? 1 : out_channels;
+  xa_nn_dilated_conv1d_state_t *p_state = (xa_nn_dilated_conv1d_state_t *)p_scratch;
+  circular_buf_t *p_cir_buf;
+
+  xa_nn_dilated_conv1d_std_init_state(p_scratch, kernel_height, input_width, input_channels, y_dilation, 16);
+
+  for(j=0;j<out_height;j++)
+  {
+    p_cir_buf = conv1d_dilated_std_update_cir_buf(p_state, p_inp, input_height, y_padding, j * y_stride);
+
+    xa_nn_matXvec_16x16_16_circ_nb
+      (p_out
+       ,p_kernel
+       ,(WORD16 *)p_cir_buf->p_curr
+       ,p_bias
+       ,out_channels
+       ,p_state->input_channelsXwidth_pad * kernel_height
+       ,out_channels_offset
+       ,bias_shift
+       ,acc_shift
+      );
+
+    p_out += out_height_offset;
+  }
+
+  return 0;
+}
+
+#if HAVE_VFPU
+WORD32 xa_nn_dilated_conv1d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    FLOAT32* __restrict__ p_inp,
+    FLOAT32* __restrict__ p_kernel,
+    FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV1D_ARGS
+
+  WORD32 j;
+  WORD32 out_channels_offset = out_data_format ? out_height : 1;
+  WORD32 out_height_offset = out_data_format ? 1 : out_channels;
+  xa_nn_dilated_conv1d_state_t *p_state = (xa_nn_dilated_conv1d_state_t *)p_scratch;
+  circular_buf_t *p_cir_buf;
+
+  xa_nn_dilated_conv1d_std_init_state(p_scratch, kernel_height, input_width, input_channels, y_dilation, -1);
+
+  for(j=0;j<out_height;j++)
+  {
+    p_cir_buf = conv1d_dilated_std_update_cir_buf(p_state, p_inp, input_height, y_padding, j * y_stride);
+
+    xa_nn_matXvec_f32_circ_nb
+      (p_out
+       ,p_kernel
+       ,(FLOAT32 *)p_cir_buf->p_curr
+       ,p_bias
+       ,out_channels
+       ,p_state->input_channelsXwidth_pad * kernel_height
+       ,out_channels_offset
+      );
+
+    p_out += out_height_offset;
+  }
+
+  return 0;
+}
+#endif /* HAVE_VFPU */
@@ -0,0 +1,515 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "common.h"
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv2d_std_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/*
+ * Dilated convolution: kernel tap (ky, kx) of output (oy, ox) reads padded
+ * input row oy + ky * y_dilation and column ox + kx * x_dilation, so outputs
+ * with oy % y_dilation == q and ox % x_dilation == p only see every
+ * y_dilation-th row and x_dilation-th column of the input, starting at phase
+ * (q, p). Each phase is a plain conv2d_std of that input subsampling; a
+ * dilated dimension has unit stride, an undilated one keeps its stride.
+ *
+ * All phases run through one circular buffer in the scratch: the buffer is
+ * filled straight from the phase's rows and columns of the dense input (pixel
+ * stride x_dilation * input_channels, row stride y_dilation rows) and the
+ * matXvec writes straight into the phase's rows and columns of the output, so
+ * the kernel is never expanded with zeros.
+ */
+
+/* Undilated conv of one phase of a dilated dimension: its padding, the first
+   input index it reads, and its input and output sizes */
+static void dilated_conv2d_std_phase(
+    WORD32 phase,
+    WORD32 dilation,
+    WORD32 padding,
+    WORD32 input_size,
+    WORD32 out_size,
+    WORD32 *p_padding,
+    WORD32 *p_first,
+    WORD32 *p_input_size,
+    WORD32 *p_out_size)
+{
+  WORD32 pad = padding > phase ? (padding - phase + dilation - 1) / dilation : 0;
+  WORD32 first = phase + pad * dilation - padding;
+
+  *p_padding = pad;
+  *p_first = first;
+  *p_input_size = first < input_size ? (input_size - first + dilation - 1) / dilation : 0;
+  *p_out_size = phase < out_size ? (out_size - phase + dilation - 1) / dilation : 0;
+}
+
+WORD32 xa_nn_dilated_conv2d_std_getsize(
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((y_dilation <= 0), -1);
+  if(y_dilation == 1)
+  {
+    return xa_nn_conv2d_std_getsize(input_height, input_channels, kernel_height, kernel_width,
+        y_stride, y_padding, out_height, input_precision);
+  }
+  XA_NNLIB_CHK_COND((y_stride != 1), -1);
+  XA_NNLIB_CHK_COND((input_height <= 0 || y_padding < 0 || out_height <= 0), -1);
+
+  /* Phase 0 has the most padded input rows and output rows */
+  return xa_nn_conv2d_std_getsize((y_padding + input_height + y_dilation - 1) / y_dilation,
+      input_channels, kernel_height, kernel_width, 1, 0,
+      (out_height + y_dilation - 1) / y_dilation, input_precision);
+}
+
+#define CHK_DILATED_CONV2D_STD_ARGS \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_dilation <= 0 || x_dilation <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((y_dilation > 1 && y_stride != 1) || (x_dilation > 1 && x_stride != 1)), -1); \
+  XA_NNLIB_ARG_CHK_COND(((kernel_height - 1) * y_dilation + 1 > input_height), -1); \
+  XA_NNLIB_ARG_CHK_COND(((kernel_width - 1) * x_dilation + 1 > input_width), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+#define DILATED_CONV2D_STD_SETUP \
+  WORD32 q, p, j; \
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch; \
+  \
+  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1; \
+  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels; \
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+/* Sizes of phase (q, p), skips the phase when it has no outputs */
+#define DILATED_CONV2D_STD_PHASE \
+  WORD32 y_padding_phase, y_first, input_height_phase, out_height_phase; \
+  WORD32 x_padding_phase, x_first, input_width_phase, out_width_phase; \
+  dilated_conv2d_std_phase(q, y_dilation, y_padding, input_height, out_height, \
+      &y_padding_phase, &y_first, &input_height_phase, &out_height_phase); \
+  dilated_conv2d_std_phase(p, x_dilation, x_padding, input_width, out_width, \
+      &x_padding_phase, &x_first, &input_width_phase, &out_width_phase); \
+  if(out_height_phase <= 0 || out_width_phase <= 0) \
+    continue; \
+  \
+  WORD32 inp_offset = (y_first * input_width + x_first) * input_channels; \
+  WORD32 out_offset = q * out_height_offset + p * out_width_offset; \
+  WORD32 input_channels_stride = x_dilation * input_channels; \
+  WORD32 input_row_stride = y_dilation * input_width * input_channels; \
+  \
+  /* Determine y-bottom padding */ \
+  WORD32 y_b_pad = kernel_height + (out_height_phase - 1) * y_stride - (y_padding_phase + input_height_phase); \
+  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+#if HAVE_VFPU
+WORD32 xa_nn_dilated_conv2d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV2D_STD_ARGS
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(FLOAT32), -1);
+
+  if(x_dilation == 1 && y_dilation == 1)
+  {
+    return xa_nn_conv2d_std_f32(p_out, p_inp, p_kernel, p_bias, input_height, input_width,
+        input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride,
+        x_padding, y_padding, out_height, out_width, out_data_format, p_scratch);
+  }
+
+  DILATED_CONV2D_STD_SETUP
+  WORD32 input_bytewidth = sizeof(*p_inp);
+  WORD32 input_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>2));
+  WORD32 kernel_size = input_channels_pad * kernel_width * kernel_height;
+
+  for(q = 0; q < y_dilation; q++)
+  {
+    for(p = 0; p < x_dilation; p++)
+    {
+      DILATED_CONV2D_STD_PHASE
+      VOID *pp_inp = (VOID *)(p_inp + inp_offset);
+      FLOAT32 *p_out_phase = p_out + out_offset;
+
+      // Reuse the same circular buffer for every phase
+      xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height_phase,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding_phase,out_height_phase,-1);
+
+      conv2d_std_init_cir_buf_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, p_state);
+
+      // Index to padded input width
+      WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+
+      for(j=0;j<out_width_phase;j++)
+      {
+        conv2d_std_update_cir_buf_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state);
+
+        idx_beg_inp_width_pad += x_stride;
+
+        xa_nn_matXvec_f32_circ
+          (p_out_phase + j * x_dilation * out_width_offset /* output */
+           ,(FLOAT32 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
+           ,(FLOAT32 *)p_kernel /* vec: cols */
+           ,(FLOAT32 *)p_bias /* bias */
+           ,out_height_phase /* rows */
+           ,kernel_size /* cols */
+           ,input_channels_pad * kernel_width * y_stride/* row_offset */
+           ,out_channels /* vec_count */
+           ,kernel_size /* vec_offset */
+           ,out_channels_offset /* out_col_offset */
+           ,y_dilation * out_height_offset /* out_row_offset */
+          );
+      }
+    }
+  }
+
+  return 0;
+}
+#endif /* HAVE_VFPU */
+
+WORD32 xa_nn_dilated_conv2d_std_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV2D_STD_ARGS
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
+
+  if(x_dilation == 1 && y_dilation == 1)
+  {
+    return xa_nn_conv2d_std_8x16(p_out, p_inp, p_kernel, p_bias, input_height, input_width,
+        input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride,
+        x_padding, y_padding, out_height, out_width, bias_shift, acc_shift,
+        out_data_format, p_scratch);
+  }
+
+  DILATED_CONV2D_STD_SETUP
+  WORD32 input_bytewidth = sizeof(*p_inp);
+  WORD32 input_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>1));
+  WORD32 kernel_size = input_channels_pad * kernel_width * kernel_height;
+
+  // Limit effective bias_shift and acc_shift to [-63 ... 63]
+  bias_shift = bias_shift > 63 ? 63 : bias_shift < -63 ? -63 : bias_shift;
+  acc_shift = acc_shift + 32;
+  acc_shift = acc_shift > 63 ? 63 : acc_shift < -63 ? -63 : acc_shift;
+
+  for(q = 0; q < y_dilation; q++)
+  {
+    for(p = 0; p < x_dilation; p++)
+    {
+      DILATED_CONV2D_STD_PHASE
+      VOID *pp_inp = (VOID *)(p_inp + inp_offset);
+      WORD16 *p_out_phase = p_out + out_offset;
+
+      // Reuse the same circular buffer for every phase
+      xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height_phase,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding_phase,out_height_phase,input_bytewidth*8);
+
+      conv2d_std_init_cir_buf_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, p_state);
+
+      // Index to padded input width
+      WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+
+      for(j=0;j<out_width_phase;j++)
+      {
+        conv2d_std_update_cir_buf_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state);
+
+        idx_beg_inp_width_pad += x_stride;
+
+        xa_nn_matXvec_8x16_16_circ
+          (p_out_phase + j * x_dilation * out_width_offset /* output */
+           ,(WORD16 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
+           ,p_kernel /* vec: cols */
+           ,p_bias /* bias */
+           ,out_height_phase /* rows */
+           ,kernel_size /* cols */
+           ,input_channels_pad * kernel_width * y_stride/* row_offset */
+           ,out_channels /* vec_count */
+           ,kernel_size /* vec_offset */
+           ,out_channels_offset /* out_col_offset */
+           ,y_dilation * out_height_offset /* out_row_offset */
+           ,bias_shift
+           ,acc_shift
+          );
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_dilated_conv2d_std_16x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV2D_STD_ARGS
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND((x_stride > kernel_width), -1);
+
+  if(x_dilation == 1 && y_dilation == 1)
+  {
+    return xa_nn_conv2d_std_16x16(p_out, p_inp, p_kernel, p_bias, input_height, input_width,
+        input_channels, kernel_height, kernel_width, out_channels, x_stride, y_stride,
+        x_padding, y_padding, out_height, out_width, bias_shift, acc_shift,
+        out_data_format, p_scratch);
+  }
+
+  DILATED_CONV2D_STD_SETUP
+  WORD32 input_bytewidth = sizeof(*p_inp);
+  WORD32 input_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>1));
+  WORD32 kernel_size = input_channels_pad * kernel_width * kernel_height;
+
+  // Limit effective bias_shift and acc_shift to [-63 ... 63]
+  bias_shift = bias_shift > 63 ? 63 : bias_shift < -63 ? -63 : bias_shift;
+  acc_shift = acc_shift + 32;
+  acc_shift = acc_shift > 63 ? 63 : acc_shift < -63 ? -63 : acc_shift;
+
+  for(q = 0; q < y_dilation; q++)
+  {
+    for(p = 0; p < x_dilation; p++)
+    {
+      DILATED_CONV2D_STD_PHASE
+      VOID *pp_inp = (VOID *)(p_inp + inp_offset);
+      WORD16 *p_out_phase = p_out + out_offset;
+
+      // Reuse the same circular buffer for every phase
+      xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height_phase,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding_phase,out_height_phase,input_bytewidth*8);
+
+      conv2d_std_init_cir_buf_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, p_state);
+
+      // Index to padded input width
+      WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+
+      for(j=0;j<out_width_phase;j++)
+      {
+        conv2d_std_update_cir_buf_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state);
+
+        idx_beg_inp_width_pad += x_stride;
+
+        xa_nn_matXvec_16x16_16_circ
+          (p_out_phase + j * x_dilation * out_width_offset /* output */
+           ,(WORD16 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
+           ,p_kernel /* vec: cols */
+           ,p_bias /* bias */
+           ,out_height_phase /* rows */
+           ,kernel_size /* cols */
+           ,input_channels_pad * kernel_width * y_stride/* row_offset */
+           ,out_channels /* vec_count */
+           ,kernel_size /* vec_offset */
+           ,out_channels_offset /* out_col_offset */
+           ,y_dilation * out_height_offset /* out_row_offset */
+           ,bias_shift
+           ,acc_shift
+          );
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_DILATED_CONV2D_STD_ARGS
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  if(x_dilation == 1 && y_dilation == 1)
+  {
+    return xa_nn_conv2d_std_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias, input_height,
+        input_width, input_channels, kernel_height, kernel_width, out_channels, x_stride,
+        y_stride, x_padding, y_padding, out_height, out_width, input_zero_bias,
+        p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch);
+  }
+
+  int itr;
+  for(itr=0;itr<out_channels;itr++){
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  DILATED_CONV2D_STD_SETUP
+  WORD32 input_bytewidth = 1;
+  WORD32 input_channels_pad = input_channels;
+  WORD32 kernel_size = input_channels_pad * kernel_width * kernel_height;
+
+  for(q = 0; q < y_dilation; q++)
+  {
+    for(p = 0; p < x_dilation; p++)
+    {
+      DILATED_CONV2D_STD_PHASE
+      VOID *pp_inp = (VOID *)(p_inp + inp_offset);
+      WORD8 *p_out_phase = p_out + out_offset;
+
+      // Reuse the same circular buffer for every phase
+      xa_nn_conv2d_std_init_state((void*)p_state,(void*)p_kernel,input_height_phase,input_channels,kernel_height,kernel_width,x_stride,y_stride,y_padding_phase,out_height_phase,-4);
+
+      conv2d_std_init_cir_buf_asym8_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, p_state, -input_zero_bias);
+
+      // Index to padded input width
+      WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+      idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
+
+      for(j=0;j<out_width_phase;j++)
+      {
+        conv2d_std_update_cir_buf_asym8_stride(input_channels, input_channels_stride, input_row_stride, input_channels_pad, input_bytewidth, input_width_phase, input_height_phase, y_padding_phase, y_b_pad, x_padding_phase, kernel_width, x_stride, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
+
+        idx_beg_inp_width_pad += x_stride;
+
+        xa_nn_matXvec_sym8sxasym8s_asym8s_circ
+          (p_out_phase + j * x_dilation * out_width_offset /* output */
+           ,(WORD8 *)p_state->cir_buf.p_curr/* matrix: rows x cols */
+           ,p_kernel /* vec: cols */
+           ,p_bias /* bias */
+           ,out_height_phase /* rows */
+           ,kernel_size /* cols */
+           ,input_channels_pad * kernel_width * y_stride/* row_offset */
+           ,out_channels /* vec_count */
+           ,kernel_size /* vec_stride */
+           ,out_channels_offset /* out_col_offset */
+           ,y_dilation * out_height_offset /* out_row_offset */
+           ,input_zero_bias
+           ,p_out_multiplier
+           ,p_out_shift
+           ,out_zero_bias
+          );
+      }
+    }
+  }
+
+  return 0;
+}
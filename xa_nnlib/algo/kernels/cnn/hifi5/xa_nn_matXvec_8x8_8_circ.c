@@ -240,7 +240,7 @@ static inline void _xa_nn_dot_product_4_rows_4_vecs_offset_aligned
   ae_int8x8 mat1_row2_0, mat1_row2_1;
   ae_int8x8 mat1_row3_0, mat1_row3_1;
 
-  int align_offset = ((unsigned int)p_vec_0 & 0x7);
+  int align_offset = ((uintptr_t)p_vec_0 & 0x7);
   pre_loop_count = 8 - align_offset;
   pre_loop_shift = align_offset * 8;
   AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat1_0, -align_offset);
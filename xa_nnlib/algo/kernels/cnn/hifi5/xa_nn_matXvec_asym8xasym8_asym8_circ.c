@@ -372,7 +372,7 @@ static inline void _xa_nn_dot_product_4_rows_4_vecs_offset_aligned
   ae_int8x8 mat1_row2_0, mat1_row2_1;
   ae_int8x8 mat1_row3_0, mat1_row3_1;
 
-  int align_offset = ((unsigned int)p_vec_0 & 0x7);
+  int align_offset = ((uintptr_t)p_vec_0 & 0x7);
   pre_loop_count = 8 - align_offset;
   //pre_loop_shift = align_offset * 8;
   ae_int8x8 pre_sel1 = AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(pre_loop_sel_pattern[2 * (align_offset % 8)], pre_loop_sel_pattern[2 * (align_offset % 8) + 1])); 
@@ -1130,7 +1130,7 @@ WORD32 xa_nn_matXvec_asym8xasym8_asym8_circ(
       }
     }
   }
-  else if(((((unsigned)p_mat1) & 7) == 0) && ((((unsigned)p_vec1) & 7) == 0) && ((((unsigned)p_bias) & 3) == 0) &&
+  else if(((((uintptr_t)p_mat1) & 7) == 0) && ((((uintptr_t)p_vec1) & 7) == 0) && ((((uintptr_t)p_bias) & 3) == 0) &&
      ((row_stride1 & 15) == 0) && (vec_stride & 15) == 0) 
   {
     m_itr = 0, vec_itr = 0;
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_conv2d_std_state.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+/* TFLite's 64 bit MultiplyByQuantizedMultiplier */
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_64(out, acc, multiplier, shift) \
+{ \
+  WORD64 reduced_mult = (multiplier) < 0x7FFF0000 ? (((multiplier) + (1 << 15)) >> 16) : 0x7FFF; \
+  WORD32 total_shift = 15 - (shift); \
+  out = (WORD32)(((WORD64)(acc) * reduced_mult + ((WORD64)1 << (total_shift - 1))) >> total_shift); \
+}
+
+#define STORE_ROW_64(acc, row, vec) \
+{ \
+  WORD32 out; \
+  ae_int32x2 out32; \
+  acc = AE_SRAI64(acc, 8); \
+  MULTIPLYBYQUANTIZEDMULTIPLIER_64(out, (WORD64)acc + (p_bias ? p_bias[vec] : 0), p_out_multiplier[vec], p_out_shift[vec]); \
+  out32 = AE_ADD32S(AE_MOVDA32(out), AE_MOVDA32(out_offset)); \
+  AE_MINMAX32(out32, min_int16, max_int16); \
+  p_out[(vec) * out_col_offset + (row) * out_row_offset] = (WORD16)AE_MOVAD32_L(out32); \
+}
+
+/* Matrix (16 bit activations) in the circular buffer, vectors (8 bit
+   kernels) of cols1 elements, cols1 a multiple of 4. Two vectors share
+   every row load. The kernel is loaded 8 bit shifted left by 8
+   (AE_L8X4F), removed from the 64 bit sums before requantization. */
+WORD32 xa_nn_matXvec_sym8sxasym16s_asym16s_circ(
+    WORD16 * __restrict__ p_out,
+    WORD16 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD64 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_stride,
+    WORD32 out_col_offset,
+    WORD32 out_row_offset,
+    const WORD32 * p_out_multiplier,
+    const WORD32 * p_out_shift,
+    WORD32 out_offset)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((cols1 & 3) != 0), -1);
+
+  ae_int32x2 max_int16 = AE_MOVDA32(32767);
+  ae_int32x2 min_int16 = AE_MOVDA32(-32768);
+  int vec_itr, m_itr, c_itr;
+
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr += 2)
+  {
+    /* An odd last vector is computed twice */
+    int vec_itr_1 = vec_itr + 1 < vec_count ? vec_itr + 1 : vec_itr;
+
+    for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+    {
+      ae_int64 acc_0_0 = ZERO64, acc_0_1 = ZERO64, acc_0_2 = ZERO64, acc_0_3 = ZERO64;
+      ae_int64 acc_1_0 = ZERO64, acc_1_1 = ZERO64, acc_1_2 = ZERO64, acc_1_3 = ZERO64;
+      ae_int16x4 vec_0, vec_1, mat_0, mat_1, mat_2, mat_3;
+      WORD8 *p_vec_0 = (WORD8 *)(p_vec1 + vec_itr * vec_stride);
+      WORD8 *p_vec_1 = (WORD8 *)(p_vec1 + vec_itr_1 * vec_stride);
+      ae_int16x4 *p_mat_0 = (ae_int16x4 *)p_mat1;
+      ae_int16x4 *p_mat_1 = (ae_int16x4 *)p_mat1;
+      ae_int16x4 *p_mat_2 = (ae_int16x4 *)p_mat1;
+      ae_int16x4 *p_mat_3 = (ae_int16x4 *)p_mat1;
+      AE_ADDCIRC16X4_XC(p_mat_0, m_itr * row_stride1 * sizeof(WORD16));
+      AE_ADDCIRC16X4_XC(p_mat_1, (m_itr + 1) * row_stride1 * sizeof(WORD16));
+      AE_ADDCIRC16X4_XC(p_mat_2, (m_itr + 2) * row_stride1 * sizeof(WORD16));
+      AE_ADDCIRC16X4_XC(p_mat_3, (m_itr + 3) * row_stride1 * sizeof(WORD16));
+
+      for(c_itr = 0; c_itr < cols1; c_itr += 4)
+      {
+        AE_L8X4F_IP(vec_0, p_vec_0, 4);
+        AE_L8X4F_IP(vec_1, p_vec_1, 4);
+        AE_L16X4_XC(mat_0, p_mat_0, sizeof(ae_int16x4));
+        AE_L16X4_XC(mat_1, p_mat_1, sizeof(ae_int16x4));
+        AE_L16X4_XC(mat_2, p_mat_2, sizeof(ae_int16x4));
+        AE_L16X4_XC(mat_3, p_mat_3, sizeof(ae_int16x4));
+        AE_MULAAAAQ16(acc_0_0, vec_0, mat_0);
+        AE_MULAAAAQ16(acc_0_1, vec_0, mat_1);
+        AE_MULAAAAQ16(acc_0_2, vec_0, mat_2);
+        AE_MULAAAAQ16(acc_0_3, vec_0, mat_3);
+        AE_MULAAAAQ16(acc_1_0, vec_1, mat_0);
+        AE_MULAAAAQ16(acc_1_1, vec_1, mat_1);
+        AE_MULAAAAQ16(acc_1_2, vec_1, mat_2);
+        AE_MULAAAAQ16(acc_1_3, vec_1, mat_3);
+      }
+
+      STORE_ROW_64(acc_0_0, m_itr, vec_itr);
+      STORE_ROW_64(acc_0_1, m_itr + 1, vec_itr);
+      STORE_ROW_64(acc_0_2, m_itr + 2, vec_itr);
+      STORE_ROW_64(acc_0_3, m_itr + 3, vec_itr);
+      STORE_ROW_64(acc_1_0, m_itr, vec_itr_1);
+      STORE_ROW_64(acc_1_1, m_itr + 1, vec_itr_1);
+      STORE_ROW_64(acc_1_2, m_itr + 2, vec_itr_1);
+      STORE_ROW_64(acc_1_3, m_itr + 3, vec_itr_1);
+    }
+
+    for(; m_itr < rows; m_itr++)
+    {
+      ae_int64 acc_0_0 = ZERO64, acc_1_0 = ZERO64;
+      ae_int16x4 vec_0, vec_1, mat_0;
+      WORD8 *p_vec_0 = (WORD8 *)(p_vec1 + vec_itr * vec_stride);
+      WORD8 *p_vec_1 = (WORD8 *)(p_vec1 + vec_itr_1 * vec_stride);
+      ae_int16x4 *p_mat_0 = (ae_int16x4 *)p_mat1;
+      AE_ADDCIRC16X4_XC(p_mat_0, m_itr * row_stride1 * sizeof(WORD16));
+
+      for(c_itr = 0; c_itr < cols1; c_itr += 4)
+      {
+        AE_L8X4F_IP(vec_0, p_vec_0, 4);
+        AE_L8X4F_IP(vec_1, p_vec_1, 4);
+        AE_L16X4_XC(mat_0, p_mat_0, sizeof(ae_int16x4));
+        AE_MULAAAAQ16(acc_0_0, vec_0, mat_0);
+        AE_MULAAAAQ16(acc_1_0, vec_1, mat_0);
+      }
+
+      STORE_ROW_64(acc_0_0, m_itr, vec_itr);
+      STORE_ROW_64(acc_1_0, m_itr, vec_itr_1);
+    }
+  }
+
+  return 0;
+}
@@ -65,6 +65,19 @@
     out = AE_ADD16S(AE_MOVDA16(out_off), out); \
     AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); 
 
+/* MULTIPLYBYQUANTIZEDMULTIPLIER_X4 with a multiplier and shift per lane: inp1
+   holds vectors 0 and 1, inp2 vectors 2 and 3 of one row. */
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X4_per_lane(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, right_shift, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  inp1 = AE_SEL32_HL(AE_SRAA32SYMS(inp1, right_shift[0]), AE_SRAA32SYMS(inp1, right_shift[1])); \
+  inp2 = AE_SEL32_HL(AE_SRAA32SYMS(inp2, right_shift[2]), AE_SRAA32SYMS(inp2, right_shift[3])); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
 #define PACK_32X2(dst1, src1, src2) \
 dst1 = AE_SEL8X8(AE_MOVINT8X8_FROMINT16X4(src1), AE_MOVINT8X8_FROMINT16X4(src2), AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(0x080a0c0e, 0x00020406)));
 
@@ -387,7 +400,7 @@ static inline void _xa_nn_dot_product_4_rows_4_vecs_offset_aligned
   ae_int8x8 mat1_row2_0, mat1_row2_1;
   ae_int8x8 mat1_row3_0, mat1_row3_1;
 
-  int align_offset = ((unsigned int)p_vec_0 & 0x7);
+  int align_offset = ((uintptr_t)p_vec_0 & 0x7);
   pre_loop_count = 8 - align_offset;
   pre_loop_shift = align_offset * 8;
   AE_ADDCIRC16X4_XC((ae_int16x4 *)p_mat1_0, -align_offset);
@@ -1642,7 +1655,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
       }
     }
   }
-  else if(((((unsigned)p_mat1) & 7) == 0) && ((((unsigned)p_vec1) & 7) == 0) && ((((unsigned)p_bias) & 3) == 0) &&
+  else if(((((uintptr_t)p_mat1) & 7) == 0) && ((((uintptr_t)p_vec1) & 7) == 0) && ((((uintptr_t)p_bias) & 3) == 0) &&
      ((row_stride1 & 15) == 0) && (vec_stride & 15) == 0) 
   {
     ae_int32x2 acc_buffer[4];
@@ -1743,11 +1756,9 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
       ae_int32x2 l_mult01 = AE_MOVDA32X2((1 << AE_MOVAD32_H(temp_2)),(1 << AE_MOVAD32_L(temp_2)));
       ae_int32x2 l_mult23 = AE_MOVDA32X2((1 << AE_MOVAD32_H(temp_3)),(1 << AE_MOVAD32_L(temp_3)));
 
-      ae_int32x2 r_mult01 = AE_MOVDA32X2( (-1 << (31 - p_right_shift[0])), (-1 << (31 - p_right_shift[1])));
-      ae_int32x2 r_mult23 = AE_MOVDA32X2( (-1 << (31 - p_right_shift[2])), (-1 << (31 - p_right_shift[3]))); 
 
-      ae_int32x2 p_out_mult01 = AE_MOVDA32X2(-p_out_multiplier[vec_itr + 0], -p_out_multiplier[vec_itr + 1]);
-      ae_int32x2 p_out_mult23 = AE_MOVDA32X2(-p_out_multiplier[vec_itr + 2], -p_out_multiplier[vec_itr + 3]);
+      ae_int32x2 p_out_mult01 = AE_MOVDA32X2(p_out_multiplier[vec_itr + 0], p_out_multiplier[vec_itr + 1]);
+      ae_int32x2 p_out_mult23 = AE_MOVDA32X2(p_out_multiplier[vec_itr + 2], p_out_multiplier[vec_itr + 3]);
 
       for (m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
       {
@@ -1834,7 +1845,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
           );
 
         ae_int16x4 out_0;
-        MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, p_out_mult23, p_out_mult01, l_mult23, l_mult01, r_mult23, r_mult01, out_zero_bias); 
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X4_per_lane(out_0, acc_row0_vec0, acc_row1_vec0, p_out_mult23, p_out_mult01, l_mult23, l_mult01, p_right_shift, out_zero_bias); 
 
         AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, out_stride);
         AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_1, out_stride);
@@ -2027,11 +2038,9 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
         ae_int32x2 l_mult23 = AE_MOVDA32X2( 1 << p_left_shift[2], 1 << p_left_shift[3]); 
         ae_int32x2 l_mult01 = AE_MOVDA32X2( 1 << p_left_shift[0], 1 << p_left_shift[1]);
 
-        ae_int32x2 r_mult23 = AE_MOVDA32X2( (-1 << (31 - p_right_shift[2])), (-1 << (31 - p_right_shift[3]))); 
-        ae_int32x2 r_mult01 = AE_MOVDA32X2( (-1 << (31 - p_right_shift[0])), (-1 << (31 - p_right_shift[1])));
 
-        ae_int32x2 p_out_mult01 = AE_MOVDA32X2(-p_out_multiplier[vec_itr + ii + 0], -p_out_multiplier[vec_itr + ii + 8]);
-        ae_int32x2 p_out_mult23 = AE_MOVDA32X2(-p_out_multiplier[vec_itr + ii + 16], -p_out_multiplier[vec_itr + ii + 24]);
+        ae_int32x2 p_out_mult01 = AE_MOVDA32X2(p_out_multiplier[vec_itr + ii + 0], p_out_multiplier[vec_itr + ii + 8]);
+        ae_int32x2 p_out_mult23 = AE_MOVDA32X2(p_out_multiplier[vec_itr + ii + 16], p_out_multiplier[vec_itr + ii + 24]);
 
         for (m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
         {
@@ -2119,7 +2128,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
             );
 
           ae_int16x4 out_0;
-          MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, p_out_mult23, p_out_mult01, l_mult23, l_mult01, r_mult23, r_mult01, out_zero_bias); 
+          MULTIPLYBYQUANTIZEDMULTIPLIER_X4_per_lane(out_0, acc_row0_vec0, acc_row1_vec0, p_out_mult23, p_out_mult01, l_mult23, l_mult01, p_right_shift, out_zero_bias); 
 
           AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, out_stride);
           AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_1, out_stride);
@@ -2206,11 +2215,9 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
       ae_int32x2 l_mult23 = AE_MOVDA32X2( 1 << p_left_shift[2], 1 << p_left_shift[3]); 
       ae_int32x2 l_mult01 = AE_MOVDA32X2( 1 << p_left_shift[0], 1 << p_left_shift[1]);
 
-      ae_int32x2 r_mult23 = AE_MOVDA32X2( (-1 << (31 - p_right_shift[2])), (-1 << (31 - p_right_shift[3]))); 
-      ae_int32x2 r_mult01 = AE_MOVDA32X2( (-1 << (31 - p_right_shift[0])), (-1 << (31 - p_right_shift[1])));
 
-      ae_int32x2 p_out_mult01 = AE_MOVDA32X2(-p_out_multiplier[vec_itr + 0], -p_out_multiplier[vec_itr + 1]);
-      ae_int32x2 p_out_mult23 = AE_MOVDA32X2(-p_out_multiplier[vec_itr + 2], -p_out_multiplier[vec_itr + 3]);
+      ae_int32x2 p_out_mult01 = AE_MOVDA32X2(p_out_multiplier[vec_itr + 0], p_out_multiplier[vec_itr + 1]);
+      ae_int32x2 p_out_mult23 = AE_MOVDA32X2(p_out_multiplier[vec_itr + 2], p_out_multiplier[vec_itr + 3]);
 
       for (m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
       {
@@ -2297,7 +2304,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_circ(
           );
 
         ae_int16x4 out_0;
-        MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row0_vec0, acc_row1_vec0, p_out_mult23, p_out_mult01, l_mult23, l_mult01, r_mult23, r_mult01, out_zero_bias); 
+        MULTIPLYBYQUANTIZEDMULTIPLIER_X4_per_lane(out_0, acc_row0_vec0, acc_row1_vec0, p_out_mult23, p_out_mult01, l_mult23, l_mult01, p_right_shift, out_zero_bias); 
 
         AE_SW_S8_6_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_0, out_stride);
         AE_SW_S8_4_XP(AE_MOVINT8X8_FROMINT16X4(out_0), (ae_int8 *) p_dst_1, out_stride);
@@ -0,0 +1,552 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_type_def.h"
+#include "common.h"
+#include "common_fpu.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_conv2d_std_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Transposed conv2d in sub-pixel form: output (y, x) receives input (iy, ix)
+   through kernel tap (y + y_padding - iy * y_stride, x + x_padding - ix * x_stride).
+   The outputs of one phase ((y + y_padding) % y_stride, (x + x_padding) % x_stride)
+   use the same taps, so each phase is a stride 1 xa_nn_conv2d_std_* of the
+   input with the flipped sub-kernel of those taps. Its output is scattered
+   to every y_stride-th row and x_stride-th column; no zero is multiplied.
+
+   Kernel rows are [out_channels][kernel_height][kernel_width][input_channels_pad]
+   with the input channel padding of xa_nn_conv2d_std_* of the same precision. */
+
+typedef struct _transpose_conv_phase_t
+{
+  WORD32 first;   /* first output row / column of the phase */
+  WORD32 count;   /* outputs of the phase */
+  WORD32 taps;    /* kernel taps of the phase */
+  WORD32 taps_eff;/* sub-kernel size, taps plus leading zero taps */
+  WORD32 padding; /* padding of the sub-kernel convolution */
+} transpose_conv_phase_t;
+
+/* Phase `phase` of one dimension; taps_eff grows past taps only when the
+   padding exceeds the kernel reach, as xa_nn_conv2d_std_* takes no negative
+   padding */
+static VOID transpose_conv_phase(
+    transpose_conv_phase_t *p_phase,
+    WORD32 phase,
+    WORD32 kernel_size,
+    WORD32 stride,
+    WORD32 padding,
+    WORD32 out_size)
+{
+  WORD32 first = ((phase - padding) % stride + stride) % stride;
+  WORD32 first_inp = (first + padding) / stride;
+
+  p_phase->first = first;
+  p_phase->count = first < out_size ? (out_size - first + stride - 1) / stride : 0;
+  p_phase->taps = phase < kernel_size ? (kernel_size - phase + stride - 1) / stride : 0;
+  p_phase->taps_eff = p_phase->taps > first_inp + 1 ? p_phase->taps : first_inp + 1;
+  p_phase->padding = p_phase->taps_eff - 1 - first_inp;
+}
+
+static WORD32 transpose_conv_element_size(WORD32 input_precision)
+{
+  switch(input_precision)
+  {
+    case -1:
+      return sizeof(FLOAT32);
+    case 16:
+      return sizeof(WORD16);
+    case -4:
+      return sizeof(WORD8);
+    default:
+      return -1;
+  }
+}
+
+static WORD32 transpose_conv_channels_pad(WORD32 input_channels, WORD32 input_precision)
+{
+  switch(input_precision)
+  {
+    case -1:
+      return PADDED_SIZE(input_channels, (ALIGNMENT>>2));
+    case -4:
+      return input_channels;
+    default:
+      return PADDED_SIZE(input_channels, (ALIGNMENT>>1));
+  }
+}
+
+WORD32 xa_nn_transpose_conv2d_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_precision)
+{
+  XA_NNLIB_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+
+  /* 8x16 and 16x16 share input precision 16, the 16 bit kernel is sized */
+  WORD32 element_size = transpose_conv_element_size(input_precision);
+  XA_NNLIB_CHK_COND((element_size < 0), -1);
+  WORD32 input_channels_pad = transpose_conv_channels_pad(input_channels, input_precision);
+
+  WORD32 kernel_bytes = 0, out_bytes = 0, conv_bytes = 0;
+  WORD32 phase_y, phase_x;
+  for(phase_y = 0; phase_y < y_stride; phase_y++)
+  {
+    transpose_conv_phase_t ph_y;
+    transpose_conv_phase(&ph_y, phase_y, kernel_height, y_stride, y_padding, out_height);
+    if(ph_y.count == 0)
+      continue;
+    for(phase_x = 0; phase_x < x_stride; phase_x++)
+    {
+      transpose_conv_phase_t ph_x;
+      transpose_conv_phase(&ph_x, phase_x, kernel_width, x_stride, x_padding, out_width);
+      if(ph_x.count == 0)
+        continue;
+      XA_NNLIB_CHK_COND((ph_y.taps_eff > input_height || ph_x.taps_eff > input_width), -1);
+
+      WORD32 size = out_channels * ph_y.taps_eff * ph_x.taps_eff * input_channels_pad * element_size;
+      kernel_bytes = kernel_bytes > size ? kernel_bytes : size;
+      size = ph_y.count * ph_x.count * out_channels * element_size;
+      out_bytes = out_bytes > size ? out_bytes : size;
+      size = xa_nn_conv2d_std_getsize(input_height, input_channels, ph_y.taps_eff, ph_x.taps_eff,
+          1, ph_y.padding, ph_y.count, input_precision);
+      XA_NNLIB_CHK_COND((size < 0), -1);
+      conv_bytes = conv_bytes > size ? conv_bytes : size;
+    }
+  }
+
+  return ALIGNED_SIZE(0, 16) /* ALIGNED_ADDR aligns to 16 */ +
+         PADDED_SIZE(kernel_bytes, 16) +
+         PADDED_SIZE(out_bytes, 16) +
+         conv_bytes;
+}
+
+#define CHK_TRANSPOSE_CONV2D_ARGS \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+/* Gathers the flipped sub-kernel of a phase, zeros for the leading taps */
+static VOID transpose_conv_sub_kernel(
+    WORD8 *p_sub_kernel,
+    const WORD8 *p_kernel,
+    const transpose_conv_phase_t *p_ph_y,
+    const transpose_conv_phase_t *p_ph_x,
+    WORD32 phase_y,
+    WORD32 phase_x,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 out_channels,
+    WORD32 row_bytes)
+{
+  WORD32 oc, ty, tx;
+  for(oc = 0; oc < out_channels; oc++)
+  {
+    for(ty = 0; ty < p_ph_y->taps_eff; ty++)
+    {
+      WORD32 jy = p_ph_y->taps_eff - 1 - ty;
+      for(tx = 0; tx < p_ph_x->taps_eff; tx++)
+      {
+        WORD32 jx = p_ph_x->taps_eff - 1 - tx;
+        WORD8 *p_dst = &p_sub_kernel[((oc * p_ph_y->taps_eff + ty) * p_ph_x->taps_eff + tx) * row_bytes];
+        if(jy < p_ph_y->taps && jx < p_ph_x->taps)
+        {
+          WORD32 kh = phase_y + jy * y_stride;
+          WORD32 kw = phase_x + jx * x_stride;
+          memcpy(p_dst, &p_kernel[((oc * kernel_height + kh) * kernel_width + kw) * row_bytes], row_bytes);
+        }
+        else
+        {
+          memset(p_dst, 0, row_bytes);
+        }
+      }
+    }
+  }
+}
+
+/* Writes the [count_y][count_x][out_channels] phase output to its rows and
+   columns of the output */
+static VOID transpose_conv_scatter(
+    WORD8 *p_out,
+    const WORD8 *p_phase_out,
+    const transpose_conv_phase_t *p_ph_y,
+    const transpose_conv_phase_t *p_ph_x,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_channels,
+    WORD32 out_data_format,
+    WORD32 element_size)
+{
+  WORD32 i, j, oc;
+  for(i = 0; i < p_ph_y->count; i++)
+  {
+    WORD32 y = p_ph_y->first + i * y_stride;
+    for(j = 0; j < p_ph_x->count; j++)
+    {
+      WORD32 x = p_ph_x->first + j * x_stride;
+      const WORD8 *p_src = &p_phase_out[(i * p_ph_x->count + j) * out_channels * element_size];
+      if(out_data_format == 0)
+      {
+        memcpy(&p_out[(y * out_width + x) * out_channels * element_size], p_src, out_channels * element_size);
+      }
+      else
+      {
+        for(oc = 0; oc < out_channels; oc++)
+          memcpy(&p_out[((oc * out_height + y) * out_width + x) * element_size], &p_src[oc * element_size], element_size);
+      }
+    }
+  }
+}
+
+/* Runs CONV_CALL, a xa_nn_conv2d_std_* call on p_sub_kernel and p_phase_out,
+   for every phase */
+#define TRANSPOSE_CONV2D_PHASES(KERNEL_TYPE, OUT_TYPE, INPUT_PRECISION, CONV_CALL) \
+  { \
+    WORD32 element_size = sizeof(OUT_TYPE); \
+    WORD32 row_bytes = transpose_conv_channels_pad(input_channels, INPUT_PRECISION) * sizeof(KERNEL_TYPE); \
+    WORD32 kernel_bytes = 0, out_bytes = 0; \
+    WORD32 phase_y, phase_x; \
+    for(phase_y = 0; phase_y < y_stride; phase_y++) \
+    { \
+      transpose_conv_phase_t ph_y; \
+      transpose_conv_phase(&ph_y, phase_y, kernel_height, y_stride, y_padding, out_height); \
+      for(phase_x = 0; phase_x < x_stride; phase_x++) \
+      { \
+        transpose_conv_phase_t ph_x; \
+        transpose_conv_phase(&ph_x, phase_x, kernel_width, x_stride, x_padding, out_width); \
+        WORD32 size = out_channels * ph_y.taps_eff * ph_x.taps_eff * row_bytes; \
+        kernel_bytes = kernel_bytes > size ? kernel_bytes : size; \
+        size = ph_y.count * ph_x.count * out_channels * element_size; \
+        out_bytes = out_bytes > size ? out_bytes : size; \
+      } \
+    } \
+    KERNEL_TYPE *p_sub_kernel = (KERNEL_TYPE *)ALIGNED_ADDR(p_scratch, 16); \
+    OUT_TYPE *p_phase_out = (OUT_TYPE *)((WORD8 *)p_sub_kernel + PADDED_SIZE(kernel_bytes, 16)); \
+    VOID *p_conv_scratch = (VOID *)((WORD8 *)p_phase_out + PADDED_SIZE(out_bytes, 16)); \
+    for(phase_y = 0; phase_y < y_stride; phase_y++) \
+    { \
+      transpose_conv_phase_t ph_y; \
+      transpose_conv_phase(&ph_y, phase_y, kernel_height, y_stride, y_padding, out_height); \
+      if(ph_y.count == 0) \
+        continue; \
+      for(phase_x = 0; phase_x < x_stride; phase_x++) \
+      { \
+        transpose_conv_phase_t ph_x; \
+        WORD32 ret; \
+        transpose_conv_phase(&ph_x, phase_x, kernel_width, x_stride, x_padding, out_width); \
+        if(ph_x.count == 0) \
+          continue; \
+        transpose_conv_sub_kernel((WORD8 *)p_sub_kernel, (const WORD8 *)p_kernel, &ph_y, &ph_x, \
+            phase_y, phase_x, kernel_height, kernel_width, x_stride, y_stride, out_channels, row_bytes); \
+        ret = CONV_CALL; \
+        if(ret != 0) \
+          return ret; \
+        transpose_conv_scatter((WORD8 *)p_out, (const WORD8 *)p_phase_out, &ph_y, &ph_x, \
+            x_stride, y_stride, out_height, out_width, out_channels, out_data_format, element_size); \
+      } \
+    } \
+  }
+
+#if HAVE_VFPU
+WORD32 xa_nn_transpose_conv2d_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_TRANSPOSE_CONV2D_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(FLOAT32), -1);
+
+  TRANSPOSE_CONV2D_PHASES(FLOAT32, FLOAT32, -1,
+      xa_nn_conv2d_std_f32(p_phase_out, p_inp, p_sub_kernel, p_bias,
+        input_height, input_width, input_channels, ph_y.taps_eff, ph_x.taps_eff, out_channels,
+        1, 1, ph_x.padding, ph_y.padding, ph_y.count, ph_x.count, 0, p_conv_scratch))
+
+  return 0;
+}
+#endif /* HAVE_VFPU */
+
+WORD32 xa_nn_transpose_conv2d_8x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_TRANSPOSE_CONV2D_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+
+  TRANSPOSE_CONV2D_PHASES(WORD8, WORD16, 16,
+      xa_nn_conv2d_std_8x16(p_phase_out, (WORD16 *)p_inp, p_sub_kernel, (WORD16 *)p_bias,
+        input_height, input_width, input_channels, ph_y.taps_eff, ph_x.taps_eff, out_channels,
+        1, 1, ph_x.padding, ph_y.padding, ph_y.count, ph_x.count, bias_shift, acc_shift, 0, p_conv_scratch))
+
+  return 0;
+}
+
+WORD32 xa_nn_transpose_conv2d_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_TRANSPOSE_CONV2D_ARGS
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(WORD16), -1);
+
+  TRANSPOSE_CONV2D_PHASES(WORD16, WORD16, 16,
+      xa_nn_conv2d_std_16x16(p_phase_out, (WORD16 *)p_inp, p_sub_kernel, (WORD16 *)p_bias,
+        input_height, input_width, input_channels, ph_y.taps_eff, ph_x.taps_eff, out_channels,
+        1, 1, ph_x.padding, ph_y.padding, ph_y.count, ph_x.count, bias_shift, acc_shift, 0, p_conv_scratch))
+
+  return 0;
+}
+
+WORD32 xa_nn_transpose_conv2d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  CHK_TRANSPOSE_CONV2D_ARGS
+
+  TRANSPOSE_CONV2D_PHASES(WORD8, WORD8, -4,
+      xa_nn_conv2d_std_per_chan_sym8sxasym8s(p_phase_out, p_inp, p_sub_kernel, p_bias,
+        input_height, input_width, input_channels, ph_y.taps_eff, ph_x.taps_eff, out_channels,
+        1, 1, ph_x.padding, ph_y.padding, ph_y.count, ph_x.count,
+        input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, 0, p_conv_scratch))
+
+  return 0;
+}
+
+/* Transposed conv1d: rows of input_width * input_channels, as the transposed
+   conv2d of a single column. Kernel rows are
+   [out_channels][kernel_height][input_width * input_channels padded as in
+   xa_nn_conv1d_std_*; not padded for sym8sxasym8s], output [out_height][out_channels]
+   or [out_channels][out_height]. */
+WORD32 xa_nn_transpose_conv1d_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_precision)
+{
+  return xa_nn_transpose_conv2d_getsize(input_height, 1, input_width * input_channels,
+      kernel_height, 1, out_channels, 1, y_stride, 0, y_padding, out_height, 1, input_precision);
+}
+
+#if HAVE_VFPU
+WORD32 xa_nn_transpose_conv1d_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return xa_nn_transpose_conv2d_f32(p_out, p_inp, p_kernel, p_bias,
+      input_height, 1, input_width * input_channels, kernel_height, 1, out_channels,
+      1, y_stride, 0, y_padding, out_height, 1, out_data_format, p_scratch);
+}
+#endif /* HAVE_VFPU */
+
+WORD32 xa_nn_transpose_conv1d_8x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return xa_nn_transpose_conv2d_8x16(p_out, p_inp, p_kernel, p_bias,
+      input_height, 1, input_width * input_channels, kernel_height, 1, out_channels,
+      1, y_stride, 0, y_padding, out_height, 1, bias_shift, acc_shift, out_data_format, p_scratch);
+}
+
+WORD32 xa_nn_transpose_conv1d_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return xa_nn_transpose_conv2d_16x16(p_out, p_inp, p_kernel, p_bias,
+      input_height, 1, input_width * input_channels, kernel_height, 1, out_channels,
+      1, y_stride, 0, y_padding, out_height, 1, bias_shift, acc_shift, out_data_format, p_scratch);
+}
+
+WORD32 xa_nn_transpose_conv1d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return xa_nn_transpose_conv2d_per_chan_sym8sxasym8s(p_out, p_inp, p_kernel, p_bias,
+      input_height, 1, input_width * input_channels, kernel_height, 1, out_channels,
+      1, y_stride, 0, y_padding, out_height, 1,
+      input_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, p_scratch);
+}
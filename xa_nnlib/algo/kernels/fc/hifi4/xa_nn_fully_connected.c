@@ -339,3 +339,197 @@ WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s
     );
   return ret;
 }
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_sparse
+  (WORD8 *__restrict__ p_out
+   ,const VOID *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_weight, 16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sym8sxasym8s_asym8s_sparse
+    (p_out
+     ,p_weight
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,input_zero_bias
+     ,out_multiplier
+     ,out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
+
+/* Weights are sym4s nibbles as written by xa_nn_pack_weights_sym4s, rows of
+   (weight_depth + 1) / 2 bytes */
+WORD32 xa_nn_fully_connected_sym4sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matXvec_sym4sxasym8s_asym8s
+    (p_out
+     ,p_weight
+     ,0
+     ,p_inp
+     ,0
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,0
+     ,(weight_depth + 1) & ~1
+     ,0
+     ,input_zero_bias
+     ,0
+     ,out_multiplier
+     ,out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
+
+WORD32 xa_nn_fully_connected_per_chan_sym4sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matmul_per_chan_sym4sxasym8s_asym8s
+    (p_out
+     ,p_weight
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,(weight_depth + 1) & ~1
+     ,1
+     ,weight_depth
+     ,1
+     ,1
+     ,input_zero_bias
+     ,p_out_multiplier
+     ,p_out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
+
+WORD32 xa_nn_fully_connected_per_chan_sym8sxasym16s_asym16s
+  (WORD16 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD16 *__restrict__ p_inp
+   ,const WORD64 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD64), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -32767 || input_zero_bias > 32768), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -32768 || out_zero_bias > 32767), -1);
+
+  WORD32 ret = 0;
+  ret = xa_nn_matmul_per_chan_sym8sxasym16s_asym16s
+    (p_out
+     ,p_weight
+     ,p_inp
+     ,p_bias
+     ,out_depth
+     ,weight_depth
+     ,weight_depth
+     ,1
+     ,weight_depth
+     ,1
+     ,1
+     ,input_zero_bias
+     ,p_out_multiplier
+     ,p_out_shift
+     ,out_zero_bias
+    );
+  return ret;
+}
@@ -24,6 +24,10 @@
 #include <xa_nnlib_kernels_api.h>
 #include "xa_nnlib_common_macros_hifi5.h"
 
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
 /* Helper functions for 16x16 matrix-vector multiplication */
 
 /* Multiply four rows and one vector, aligned access case, continuous row accesses in four streams */
@@ -373,6 +377,14 @@ WORD32 xa_nn_matXvec_16x16_16(
 
   acc_shift = acc_shift +32;
   LIMIT_ACC_LSH
+
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matXvec_16x16_16_host(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2,
+      row_stride1, row_stride2, acc_shift, bias_shift) == 0)
+  {
+    return 0;
+  }
+#endif
   
   if (p_mat1 && p_vec1 && p_mat2 && p_vec2 && (cols1% 16 ==0) && (cols2% 16 ==0) && row_stride1 % 8 ==0 && row_stride2 %8==0)
   {
@@ -22,6 +22,11 @@
 #include "xa_type_def.h"
 #include "xtensa/tie/xt_hifi2.h"
 #include <xa_nnlib_kernels_api.h>
+
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
 /* Uncomment the line below to enable row_unroll 16*/ 
 //#define UNROLL_16
 
@@ -563,6 +568,15 @@ WORD32 xa_nn_matXvec_8x16_16(
 
   acc_shift=32+acc_shift;
   LIMIT_ACC_LSH
+
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matXvec_8x16_16_host(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2,
+      row_stride1, row_stride2, acc_shift, bias_shift) == 0)
+  {
+    return 0;
+  }
+#endif
+
   if (p_mat1 && p_vec1 && p_mat2 && p_vec2 && cols1%16==0 && cols2%16==0 && row_stride1%16==0 && row_stride2%16==0)
   {
     /* All four pointers are non-null */
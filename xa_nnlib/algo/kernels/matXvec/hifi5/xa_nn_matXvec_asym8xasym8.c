@@ -418,8 +418,8 @@ WORD32 xa_nn_matXvec_asym8xasym8_asym8(
   ae_int32x2 max_uint8 = AE_MOVDA32(255);
   ae_int32x2 min_uint8 = AE_MOVDA32(0);
   
-  if(p_mat2 && p_vec2 && ((((unsigned)p_out) & 15) == 0) && ((((unsigned)p_mat1) & 15) == 0) && ((((unsigned)p_mat2) & 15) == 0) &&
-     ((((unsigned)p_vec1) & 15) == 0) && ((((unsigned)p_vec2) & 15) == 0) && ((((unsigned)p_bias) & 3) == 0) &&
+  if(p_mat2 && p_vec2 && ((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_mat1) & 15) == 0) && ((((uintptr_t)p_mat2) & 15) == 0) &&
+     ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_vec2) & 15) == 0) && ((((uintptr_t)p_bias) & 3) == 0) &&
      ((row_stride1 & 15) == 0) && ((row_stride2 & 15) == 0))
   {
     for(m_itr = 0; m_itr < (rows & ~(8 - 1)); m_itr += 8)
@@ -641,8 +641,8 @@ WORD32 xa_nn_matXvec_asym8xasym8_asym8(
       *p_out++ = (UWORD8)AE_MOVAD32_L(acc_row0_vec0);
     }
   }
-  else if(((((unsigned)p_out) & 15) == 0) && ((((unsigned)p_mat1) & 15) == 0) &&
-    ((((unsigned)p_vec1) & 15) == 0) && ((((unsigned)p_bias) & 3) == 0) &&
+  else if(((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_mat1) & 15) == 0) &&
+    ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_bias) & 3) == 0) &&
     ((row_stride1 & 15) == 0))
   {
     AE_MOVZBVCDR(biasvc1);
@@ -0,0 +1,277 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * asym8u matXvec/matmul with the zero bias terms folded into the bias.
+ *
+ * With z_m = mat1_zero_bias and z_v = vec1_zero_bias, each output is
+ *
+ *   bias[r] + sum_c (m[r][c] + z_m) * (v[c] + z_v)
+ *     = bias[r] + z_v * sum_c m[r][c] + cols * z_m * z_v    (weights only)
+ *       + z_m * sum_c v[c]                                   (once per vector)
+ *       + sum_c m[r][c] * v[c]                               (plain u8 x u8)
+ *
+ * xa_nn_fold_zero_bias_asym8uxasym8u computes the first line once, at model
+ * load, from the weight row sums. The *_folded kernels then run the plain
+ * unsigned dot product with both zero biases programmed to 0 and add z_m
+ * times the vector sum, which costs one pass over each vector rather than
+ * one per row. All terms are summed with 32-bit wraparound like the
+ * accumulators, so the output is identical to xa_nn_matmul_asym8uxasym8u_asym8u.
+ */
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out, inp1, inp2, multiplier, l_shift, r_shift, out_off) \
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift, l_shift); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, AE_MOVDA32(multiplier), AE_MOVDA32(multiplier)); \
+  inp1 = AE_SRAA32SYMS(inp1, r_shift); \
+  inp2 = AE_SRAA32SYMS(inp2, r_shift); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_ZERO16(), AE_MOVDA16(255));
+
+WORD32 xa_nn_fold_zero_bias_asym8uxasym8u(
+    WORD32 * __restrict__ p_folded_bias,
+    const UWORD8 * __restrict__ p_mat1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_folded_bias, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_folded_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((mat1_zero_bias < -255 || mat1_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -255 || vec1_zero_bias > 0), -1);
+
+  int m_itr, c_itr;
+  /* Wraps around like the 32-bit accumulators of the kernels */
+  UWORD32 zb_term = (UWORD32)cols1 * (UWORD32)mat1_zero_bias * (UWORD32)vec1_zero_bias;
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const UWORD8 *p_row = p_mat1 + m_itr * row_stride1;
+    UWORD32 row_sum = 0;
+    for(c_itr = 0; c_itr < cols1; c_itr++)
+    {
+      row_sum += p_row[c_itr];
+    }
+    UWORD32 bias = p_bias ? (UWORD32)p_bias[m_itr] : 0;
+    p_folded_bias[m_itr] = (WORD32)(bias + row_sum * (UWORD32)vec1_zero_bias + zb_term);
+  }
+
+  return 0;
+}
+
+/* Vector length rounded down to 16; the last (cols1 % 16) elements are
+   copied, zero padded, to p_tail */
+static inline WORD32 copy_vec_tail(
+    ae_int8x16 *p_tail,
+    const UWORD8 *p_vec,
+    WORD32 cols1)
+{
+  UWORD8 *p_dst = (UWORD8 *)p_tail;
+  int rem = cols1 & 15;
+  int ii;
+
+  for(ii = 0; ii < 16; ii++)
+  {
+    p_dst[ii] = (ii < rem) ? p_vec[cols1 - rem + ii] : 0;
+  }
+
+  return cols1 - rem;
+}
+
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u_folded(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_folded_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_folded_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_folded_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((mat1_zero_bias < -255 || mat1_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
+
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matmul_asym8uxasym8u_asym8u_folded_host(p_out, p_mat1, p_vec1, p_folded_bias, rows, cols1,
+      row_stride1, vec_count, vec_offset, out_offset, out_stride, mat1_zero_bias, out_multiplier,
+      out_shift, out_zero_bias) == 0)
+  {
+    return 0;
+  }
+#endif
+
+  int m_itr, c_itr, vec_itr;
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 l_mult = AE_MOVDA32(1 << left_shift);
+  ae_int8x16 vec_tail;
+  ae_int8x8 ones = AE_MOVDA8(1);
+
+  /* Plain unsigned products: both zero biases are in the folded bias */
+  AE_MOVZBVCDR(AE_ZERO64());
+
+  ae_int8x8 mat_row0_0, mat_row0_1;
+  ae_int8x8 mat_row1_0, mat_row1_1;
+  ae_int8x8 mat_row2_0, mat_row2_1;
+  ae_int8x8 mat_row3_0, mat_row3_1;
+  ae_int8x8 vec_0, vec_1;
+
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+  {
+    const UWORD8 *p_vec_cur = p_vec1 + vec_itr * vec_offset;
+    int cols_count = copy_vec_tail(&vec_tail, p_vec_cur, cols1);
+    UWORD8 *p_dst = p_out + vec_itr * out_offset;
+
+    /* mat1_zero_bias * sum(vec), shared by all rows */
+    ae_int32x2 vec_sum = ZERO32, vec_sum_1 = ZERO32;
+    ae_int8x16 *p_vec_0 = (ae_int8x16 *)p_vec_cur;
+    ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+    for(c_itr = 0; c_itr < (cols_count >> 4); c_itr++)
+    {
+      AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec_0, p_vec_0);
+      AE_MULAUUZB8Q8X8(vec_sum, vec_sum_1, vec_0, vec_1, vec_0, vec_1, ones);
+    }
+    AE_L8X8X2_I(vec_0, vec_1, &vec_tail, 0);
+    AE_MULAUUZB8Q8X8(vec_sum, vec_sum_1, vec_0, vec_1, vec_0, vec_1, ones);
+    WORD32 zb_term = (WORD32)((UWORD32)mat1_zero_bias *
+        ((UWORD32)AE_MOVAD32_H(vec_sum) + (UWORD32)AE_MOVAD32_L(vec_sum)));
+    ae_int32x2 zb_term_x2 = AE_MOVDA32(zb_term);
+
+    for(m_itr = 0; m_itr < rows; m_itr += 4)
+    {
+      /* Rows past the end repeat row 0 and are not stored */
+      const UWORD8 *p_row0 = p_mat1 + m_itr * row_stride1;
+      const UWORD8 *p_row1 = (m_itr + 1) < rows ? p_row0 + row_stride1 : p_row0;
+      const UWORD8 *p_row2 = (m_itr + 2) < rows ? p_row0 + 2 * row_stride1 : p_row0;
+      const UWORD8 *p_row3 = (m_itr + 3) < rows ? p_row0 + 3 * row_stride1 : p_row0;
+
+      ae_int32x2 acc_row01 = AE_MOVDA32X2(p_folded_bias[m_itr], (m_itr + 1) < rows ? p_folded_bias[m_itr + 1] : 0);
+      ae_int32x2 acc_row23 = AE_MOVDA32X2((m_itr + 2) < rows ? p_folded_bias[m_itr + 2] : 0, (m_itr + 3) < rows ? p_folded_bias[m_itr + 3] : 0);
+      acc_row01 = AE_ADD32(acc_row01, zb_term_x2);
+      acc_row23 = AE_ADD32(acc_row23, zb_term_x2);
+
+      ae_int8x16 *p_mat_0 = (ae_int8x16 *)p_row0;
+      ae_int8x16 *p_mat_1 = (ae_int8x16 *)p_row1;
+      ae_int8x16 *p_mat_2 = (ae_int8x16 *)p_row2;
+      ae_int8x16 *p_mat_3 = (ae_int8x16 *)p_row3;
+      ae_valignx2 align_p_mat_0 = AE_LA128_PP(p_mat_0);
+      ae_valignx2 align_p_mat_1 = AE_LA128_PP(p_mat_1);
+      ae_valignx2 align_p_mat_2 = AE_LA128_PP(p_mat_2);
+      ae_valignx2 align_p_mat_3 = AE_LA128_PP(p_mat_3);
+      p_vec_0 = (ae_int8x16 *)p_vec_cur;
+      align_p_vec_0 = AE_LA128_PP(p_vec_0);
+
+      for(c_itr = 0; c_itr < (cols_count >> 4); c_itr++)
+      {
+        AE_LA8X8X2_IP(mat_row0_0, mat_row0_1, align_p_mat_0, p_mat_0);
+        AE_LA8X8X2_IP(mat_row1_0, mat_row1_1, align_p_mat_1, p_mat_1);
+        AE_LA8X8X2_IP(mat_row2_0, mat_row2_1, align_p_mat_2, p_mat_2);
+        AE_LA8X8X2_IP(mat_row3_0, mat_row3_1, align_p_mat_3, p_mat_3);
+        AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec_0, p_vec_0);
+
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, vec_0);
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, vec_1);
+      }
+
+      /* Remainder: the zero padded vector tail masks the extra weights */
+      if(cols_count != cols1)
+      {
+        AE_LA8X8X2_IP(mat_row0_0, mat_row0_1, align_p_mat_0, p_mat_0);
+        AE_LA8X8X2_IP(mat_row1_0, mat_row1_1, align_p_mat_1, p_mat_1);
+        AE_LA8X8X2_IP(mat_row2_0, mat_row2_1, align_p_mat_2, p_mat_2);
+        AE_LA8X8X2_IP(mat_row3_0, mat_row3_1, align_p_mat_3, p_mat_3);
+        AE_L8X8X2_I(vec_0, vec_1, &vec_tail, 0);
+
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, vec_0);
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, vec_1);
+      }
+
+      /* Apply quantization */
+      ae_int16x4 out_0;
+      MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_0, acc_row01, acc_row23, out_multiplier, l_mult, right_shift, out_zero_bias);
+
+      p_dst[m_itr * out_stride] = (UWORD8)AE_MOVAD16_3(out_0);
+      if(m_itr + 1 < rows) p_dst[(m_itr + 1) * out_stride] = (UWORD8)AE_MOVAD16_2(out_0);
+      if(m_itr + 2 < rows) p_dst[(m_itr + 2) * out_stride] = (UWORD8)AE_MOVAD16_1(out_0);
+      if(m_itr + 3 < rows) p_dst[(m_itr + 3) * out_stride] = (UWORD8)AE_MOVAD16_0(out_0);
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_asym8uxasym8u_asym8u_folded(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_folded_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 mat1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  return xa_nn_matmul_asym8uxasym8u_asym8u_folded(p_out, p_mat1, p_vec1, p_folded_bias, rows, cols1,
+      row_stride1, 1, cols1, rows, 1, mat1_zero_bias, out_multiplier, out_shift, out_zero_bias);
+}
@@ -0,0 +1,438 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+******************************************************************************/
+/*
+ * sym8sxasym8s matXvec/matmul with a fused epilogue.
+ *
+ * The epilogue is applied to each group of 4 requantized outputs while
+ * they are still in AE registers, before the single store to p_out:
+ *
+ *  - activation: XA_NNLIB_ACT_RELU clamps at the output zero point and
+ *    XA_NNLIB_ACT_CLAMP to [act_min, act_max], which is how relu6 and
+ *    relu_n1_to_1 are given once the caller has mapped their bounds to
+ *    the output domain. Both narrow the -128..127 saturation, so they
+ *    cost nothing.
+ *  - residual: adds p_residual, laid out as p_out, with the arithmetic of
+ *    xa_nn_elm_add_asym8sxasym8s_asym8s taking the activated matmul output
+ *    as inp1 with inp1_zero_bias = -out_zero_bias.
+ *
+ * The output equals the unfused kernel followed by the clamp and the
+ * quantized add, without writing and reading back the intermediate. The
+ * per tensor matXvec requantizes as xa_nn_matXvec_sym8sxasym8s_asym8s,
+ * the per channel matmul as xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define EPI_ROWS  4
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+/* As in the elementwise add */
+#define MultiplyByQuantizedMultiplierSmallerThanOneExp(prod, val, multiplier, lsh) {\
+    ae_int64 temp64_h, temp64_l;\
+    prod = AE_MULFP32X2RAS(val, multiplier);\
+    temp64_h = AE_MOVINT64_FROMINT32X2(AE_SEL32_HH(prod, ZERO));\
+    temp64_l = AE_MOVINT64_FROMINT32X2(AE_SEL32_LL(prod, ZERO));\
+    temp64_h = AE_SLAA64S(temp64_h, lsh);\
+    temp64_l = AE_SLAA64S(temp64_l, lsh);\
+    prod = AE_ROUND32X2F64SSYM(temp64_h, temp64_l);\
+}
+
+/* sum(mat * (vec + vec_zero_bias)) of 4 rows over cols columns; row
+   pointers can repeat for the rows past the end of the matrix */
+static inline void dot_4_rows(
+    ae_int32x2 *p_acc_row01,
+    ae_int32x2 *p_acc_row23,
+    const WORD8 *p_row_0,
+    const WORD8 *p_row_1,
+    const WORD8 *p_row_2,
+    const WORD8 *p_row_3,
+    const WORD8 *p_vec,
+    WORD32 cols,
+    WORD32 vec_zero_bias)
+{
+  ae_int32x2 acc_row01 = ZERO32;
+  ae_int32x2 acc_row23 = ZERO32;
+  ae_int8x8 neg_vec_bias = AE_MOVDA8((WORD8)-vec_zero_bias);
+  ae_int8x8 vec_0, vec_1;
+  ae_int16x4 wvec_0_0, wvec_0_1, wvec_1_0, wvec_1_1;
+  ae_int8x8 mat_0_0, mat_0_1, mat_1_0, mat_1_1, mat_2_0, mat_2_1, mat_3_0, mat_3_1;
+  int c_itr;
+
+  ae_valignx2 align_p_row_0 = AE_LA128_PP(p_row_0);
+  ae_valignx2 align_p_row_1 = AE_LA128_PP(p_row_1);
+  ae_valignx2 align_p_row_2 = AE_LA128_PP(p_row_2);
+  ae_valignx2 align_p_row_3 = AE_LA128_PP(p_row_3);
+  ae_valignx2 align_p_vec = AE_LA128_PP(p_vec);
+
+  for(c_itr = 0; c_itr < (cols & ~(16 - 1)); c_itr += 16)
+  {
+    AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec, p_vec);
+    AE_SUBW8(wvec_0_0, wvec_0_1, vec_0, neg_vec_bias);
+    AE_SUBW8(wvec_1_0, wvec_1_1, vec_1, neg_vec_bias);
+
+    AE_LA8X8X2_IP(mat_0_0, mat_0_1, align_p_row_0, p_row_0);
+    AE_LA8X8X2_IP(mat_1_0, mat_1_1, align_p_row_1, p_row_1);
+    AE_LA8X8X2_IP(mat_2_0, mat_2_1, align_p_row_2, p_row_2);
+    AE_LA8X8X2_IP(mat_3_0, mat_3_1, align_p_row_3, p_row_3);
+
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_0, mat_1_0, mat_2_0, mat_3_0, wvec_0_0, wvec_0_1);
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_1, mat_1_1, mat_2_1, mat_3_1, wvec_1_0, wvec_1_1);
+  }
+
+  /* Column tail: the matrix is zero padded */
+  if(c_itr < cols)
+  {
+    int rem_cols = cols - c_itr;
+    ae_int8x8 vec_tail[2];
+    ae_int8x8 mat_tail[2 * EPI_ROWS];
+
+    memset(vec_tail, 0, sizeof(vec_tail));
+    memcpy(vec_tail, p_vec, rem_cols);
+    memset(mat_tail, 0, sizeof(mat_tail));
+    memcpy(&mat_tail[0], p_row_0, rem_cols);
+    memcpy(&mat_tail[2], p_row_1, rem_cols);
+    memcpy(&mat_tail[4], p_row_2, rem_cols);
+    memcpy(&mat_tail[6], p_row_3, rem_cols);
+
+    AE_SUBW8(wvec_0_0, wvec_0_1, AE_L8X8_I(vec_tail, 0), neg_vec_bias);
+    AE_SUBW8(wvec_1_0, wvec_1_1, AE_L8X8_I(vec_tail, 8), neg_vec_bias);
+
+    AE_MULA8Q8X16(acc_row01, acc_row23, AE_L8X8_I(mat_tail, 0), AE_L8X8_I(mat_tail, 16),
+        AE_L8X8_I(mat_tail, 32), AE_L8X8_I(mat_tail, 48), wvec_0_0, wvec_0_1);
+    AE_MULA8Q8X16(acc_row01, acc_row23, AE_L8X8_I(mat_tail, 8), AE_L8X8_I(mat_tail, 24),
+        AE_L8X8_I(mat_tail, 40), AE_L8X8_I(mat_tail, 56), wvec_1_0, wvec_1_1);
+  }
+
+  *p_acc_row01 = acc_row01;
+  *p_acc_row23 = acc_row23;
+}
+
+/* Activation bounds in the output domain */
+static void get_act_range(
+    WORD32 *p_act_min,
+    WORD32 *p_act_max,
+    const xa_nnlib_epilogue_t *p_epilogue,
+    WORD32 out_zero_bias)
+{
+  *p_act_min = -128;
+  *p_act_max = 127;
+  if(p_epilogue == NULL)
+    return;
+
+  if(p_epilogue->act_type == XA_NNLIB_ACT_RELU)
+  {
+    *p_act_min = out_zero_bias;
+  }
+  else if(p_epilogue->act_type == XA_NNLIB_ACT_CLAMP)
+  {
+    *p_act_min = p_epilogue->act_min;
+    *p_act_max = p_epilogue->act_max;
+  }
+}
+
+/* Quantized add of the residual to the activated outputs of 4 rows; rows
+   past nrows read residual row 0 and are not stored */
+static inline void add_residual_4_rows(
+    ae_int32x2 *p_out_row01,
+    ae_int32x2 *p_out_row23,
+    const WORD8 *p_res,
+    WORD32 res_stride,
+    WORD32 nrows,
+    WORD32 out_zero_bias,
+    const xa_nnlib_epilogue_t *p_epilogue)
+{
+  const ae_int32x2 ZERO = AE_ZERO32();
+  ae_int32x2 res_row01, res_row23;
+  ae_int32x2 shifted_a01, shifted_a23, shifted_b01, shifted_b23;
+  ae_int32x2 scaled_a01, scaled_a23, scaled_b01, scaled_b23;
+  ae_int32x2 raw_sum01, raw_sum23, out_row01, out_row23;
+  const ae_int32x2 ma = AE_MOVDA32(p_epilogue->inp1_multiplier);
+  const ae_int32x2 mb = AE_MOVDA32(p_epilogue->res_multiplier);
+  const ae_int32x2 mc = AE_MOVDA32(p_epilogue->add_out_multiplier);
+  WORD32 left_shift = p_epilogue->left_shift;
+
+  res_row01 = AE_MOVDA32X2(p_res[0], p_res[(nrows > 1) ? res_stride : 0]);
+  res_row23 = AE_MOVDA32X2(p_res[(nrows > 2) ? 2 * res_stride : 0], p_res[(nrows > 3) ? 3 * res_stride : 0]);
+
+  /* Add zero biases, left shift and scale each input */
+  shifted_a01 = AE_SLAA32S(AE_SUB32(*p_out_row01, AE_MOVDA32(out_zero_bias)), left_shift);
+  shifted_a23 = AE_SLAA32S(AE_SUB32(*p_out_row23, AE_MOVDA32(out_zero_bias)), left_shift);
+  shifted_b01 = AE_SLAA32S(AE_ADD32(res_row01, AE_MOVDA32(p_epilogue->res_zero_bias)), left_shift);
+  shifted_b23 = AE_SLAA32S(AE_ADD32(res_row23, AE_MOVDA32(p_epilogue->res_zero_bias)), left_shift);
+
+  MultiplyByQuantizedMultiplierSmallerThanOneExp(scaled_a01, shifted_a01, ma, p_epilogue->inp1_left_shift);
+  MultiplyByQuantizedMultiplierSmallerThanOneExp(scaled_a23, shifted_a23, ma, p_epilogue->inp1_left_shift);
+  MultiplyByQuantizedMultiplierSmallerThanOneExp(scaled_b01, shifted_b01, mb, p_epilogue->res_left_shift);
+  MultiplyByQuantizedMultiplierSmallerThanOneExp(scaled_b23, shifted_b23, mb, p_epilogue->res_left_shift);
+
+  raw_sum01 = AE_ADD32S(scaled_a01, scaled_b01);
+  raw_sum23 = AE_ADD32S(scaled_a23, scaled_b23);
+
+  MultiplyByQuantizedMultiplierSmallerThanOneExp(out_row01, raw_sum01, mc, p_epilogue->add_out_left_shift);
+  MultiplyByQuantizedMultiplierSmallerThanOneExp(out_row23, raw_sum23, mc, p_epilogue->add_out_left_shift);
+  out_row01 = AE_ADD32S(out_row01, AE_MOVDA32(p_epilogue->add_out_zero_bias));
+  out_row23 = AE_ADD32S(out_row23, AE_MOVDA32(p_epilogue->add_out_zero_bias));
+  AE_MINMAX32(out_row01, AE_MOVDA32(p_epilogue->add_act_min), AE_MOVDA32(p_epilogue->add_act_max));
+  AE_MINMAX32(out_row23, AE_MOVDA32(p_epilogue->add_act_min), AE_MOVDA32(p_epilogue->add_act_max));
+
+  *p_out_row01 = out_row01;
+  *p_out_row23 = out_row23;
+}
+
+static WORD32 check_epilogue(const xa_nnlib_epilogue_t *p_epilogue)
+{
+  if(p_epilogue == NULL)
+    return 0;
+
+  XA_NNLIB_ARG_CHK_COND((p_epilogue->act_type != XA_NNLIB_ACT_NONE &&
+      p_epilogue->act_type != XA_NNLIB_ACT_RELU && p_epilogue->act_type != XA_NNLIB_ACT_CLAMP), -1);
+  if(p_epilogue->act_type == XA_NNLIB_ACT_CLAMP)
+  {
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->act_min < -128) || (p_epilogue->act_min > 127)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->act_max < -128) || (p_epilogue->act_max > 127)), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->act_max < p_epilogue->act_min), -1);
+  }
+  if(p_epilogue->p_residual)
+  {
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->left_shift < 0) || (p_epilogue->left_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->inp1_left_shift < -31) || (p_epilogue->inp1_left_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->res_zero_bias < -127) || (p_epilogue->res_zero_bias > 128)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->res_left_shift < -31) || (p_epilogue->res_left_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->add_out_zero_bias < -128) || (p_epilogue->add_out_zero_bias > 127)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->add_out_left_shift < -31) || (p_epilogue->add_out_left_shift > 31)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->add_act_min < -128) || (p_epilogue->add_act_min > 127)), -1);
+    XA_NNLIB_ARG_CHK_COND(((p_epilogue->add_act_max < -128) || (p_epilogue->add_act_max > 127)), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->add_act_max < p_epilogue->add_act_min), -1);
+  }
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_epilogue(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_epilogue_t * __restrict__ p_epilogue)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  if(check_epilogue(p_epilogue) != 0)
+    return -1;
+
+  int m_itr, last = rows - 1;
+  WORD32 act_min, act_max;
+  const WORD8 *p_res = p_epilogue ? p_epilogue->p_residual : NULL;
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+
+  get_act_range(&act_min, &act_max, p_epilogue, out_zero_bias);
+  ae_int32x2 min_out = AE_MOVDA32(act_min);
+  ae_int32x2 max_out = AE_MOVDA32(act_max);
+
+  for(m_itr = 0; m_itr < rows; m_itr += EPI_ROWS)
+  {
+    int nrows = XT_MIN(EPI_ROWS, rows - m_itr);
+    ae_int32x2 acc_row01, acc_row23;
+
+    dot_4_rows(&acc_row01, &acc_row23,
+        p_mat1 + m_itr * row_stride1,
+        p_mat1 + XT_MIN(m_itr + 1, last) * row_stride1,
+        p_mat1 + XT_MIN(m_itr + 2, last) * row_stride1,
+        p_mat1 + XT_MIN(m_itr + 3, last) * row_stride1,
+        p_vec1, cols1, vec1_zero_bias);
+
+    if(p_bias)
+    {
+      acc_row01 = AE_ADD32(acc_row01, AE_MOVDA32X2(p_bias[m_itr], p_bias[XT_MIN(m_itr + 1, last)]));
+      acc_row23 = AE_ADD32(acc_row23, AE_MOVDA32X2(p_bias[XT_MIN(m_itr + 2, last)], p_bias[XT_MIN(m_itr + 3, last)]));
+    }
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row01, out_multiplier, left_shift, right_shift);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row23, out_multiplier, left_shift, right_shift);
+    acc_row01 = AE_ADD32S(acc_row01, out_zero_bias);
+    acc_row23 = AE_ADD32S(acc_row23, out_zero_bias);
+    /* int8 saturation and the activation */
+    AE_MINMAX32(acc_row01, min_out, max_out);
+    AE_MINMAX32(acc_row23, min_out, max_out);
+
+    if(p_res)
+    {
+      add_residual_4_rows(&acc_row01, &acc_row23, p_res + m_itr, 1, nrows, out_zero_bias, p_epilogue);
+    }
+
+    p_out[m_itr] = (WORD8)AE_MOVAD32_H(acc_row01);
+    if(nrows > 1) p_out[m_itr + 1] = (WORD8)AE_MOVAD32_L(acc_row01);
+    if(nrows > 2) p_out[m_itr + 2] = (WORD8)AE_MOVAD32_H(acc_row23);
+    if(nrows > 3) p_out[m_itr + 3] = (WORD8)AE_MOVAD32_L(acc_row23);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_epilogue(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_epilogue_t * __restrict__ p_epilogue)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  if(check_epilogue(p_epilogue) != 0)
+    return -1;
+
+  int m_itr, vec_itr, ii, last = rows - 1;
+  WORD32 act_min, act_max;
+  const WORD8 *p_res = p_epilogue ? p_epilogue->p_residual : NULL;
+
+  for(ii = 0; ii < rows; ii++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[ii] < -31 || p_out_shift[ii] > 31), -1);
+  }
+
+  get_act_range(&act_min, &act_max, p_epilogue, out_zero_bias);
+  ae_int16x4 min_out = AE_MOVDA16(act_min);
+  ae_int16x4 max_out = AE_MOVDA16(act_max);
+
+  for(m_itr = 0; m_itr < rows; m_itr += EPI_ROWS)
+  {
+    int nrows = XT_MIN(EPI_ROWS, rows - m_itr);
+    const WORD8 *p_row_0 = p_mat1 + m_itr * row_stride1;
+    const WORD8 *p_row_1 = p_mat1 + XT_MIN(m_itr + 1, last) * row_stride1;
+    const WORD8 *p_row_2 = p_mat1 + XT_MIN(m_itr + 2, last) * row_stride1;
+    const WORD8 *p_row_3 = p_mat1 + XT_MIN(m_itr + 3, last) * row_stride1;
+    WORD32 p_bias_row[EPI_ROWS];
+    int p_left_mult[EPI_ROWS], p_right_mult[EPI_ROWS], p_out_mult[EPI_ROWS];
+    ae_int32x2 l_mult_23, l_mult_01, r_mult_23, r_mult_01;
+    ae_int32x2 out_multiplier_01, out_multiplier_23;
+
+    /* Padding rows get a zero multiplier */
+    for(ii = 0; ii < EPI_ROWS; ii++)
+    {
+      int valid = ii < nrows;
+      int shift = valid ? p_out_shift[m_itr + ii] : 0;
+
+      p_bias_row[ii] = (valid && p_bias) ? p_bias[m_itr + ii] : 0;
+      p_left_mult[ii] = shift < 0 ? 1 : (1 << shift);
+      p_right_mult[ii] = shift > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + shift));
+      p_out_mult[ii] = valid ? -p_out_multiplier[m_itr + ii] : 0;
+    }
+    AE_L32X2X2_I(l_mult_01, l_mult_23, (ae_int32x4 *)p_left_mult, 0);
+    AE_L32X2X2_I(r_mult_01, r_mult_23, (ae_int32x4 *)p_right_mult, 0);
+    AE_L32X2X2_I(out_multiplier_01, out_multiplier_23, (ae_int32x4 *)p_out_mult, 0);
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+      WORD8 *p_dst = p_out + m_itr * out_stride + vec_itr * out_offset;
+      ae_int32x2 acc_row01, acc_row23;
+      ae_int16x4 out_0;
+
+      dot_4_rows(&acc_row01, &acc_row23, p_row_0, p_row_1, p_row_2, p_row_3,
+          p_vec1 + vec_itr * vec_offset, cols1, vec1_zero_bias);
+      acc_row01 = AE_ADD32(acc_row01, AE_MOVDA32X2(p_bias_row[0], p_bias_row[1]));
+      acc_row23 = AE_ADD32(acc_row23, AE_MOVDA32X2(p_bias_row[2], p_bias_row[3]));
+
+      MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row01, acc_row23, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+      AE_MINMAX16(out_0, min_out, max_out);
+
+      if(p_res)
+      {
+        acc_row01 = AE_MOVDA32X2(AE_MOVAD16_3(out_0), AE_MOVAD16_2(out_0));
+        acc_row23 = AE_MOVDA32X2(AE_MOVAD16_1(out_0), AE_MOVAD16_0(out_0));
+        add_residual_4_rows(&acc_row01, &acc_row23, p_res + m_itr * out_stride + vec_itr * out_offset,
+            out_stride, nrows, out_zero_bias, p_epilogue);
+        out_0 = AE_SAT16X4(acc_row01, acc_row23);
+      }
+
+      p_dst[0] = (WORD8)AE_MOVAD16_3(out_0);
+      if(nrows > 1) p_dst[out_stride] = (WORD8)AE_MOVAD16_2(out_0);
+      if(nrows > 2) p_dst[2 * out_stride] = (WORD8)AE_MOVAD16_1(out_0);
+      if(nrows > 3) p_dst[3 * out_stride] = (WORD8)AE_MOVAD16_0(out_0);
+    }
+  }
+
+  return 0;
+}
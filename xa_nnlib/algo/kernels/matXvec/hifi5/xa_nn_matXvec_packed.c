@@ -0,0 +1,505 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Pre-packed weights for the 8-bit matXvec/matmul kernels.
+ *
+ * xa_nn_pack_weights_8/_asym8u rewrite a rows x cols matrix once, offline or
+ * at model load, into the layout the *_packed kernels stream through:
+ * rows are taken in blocks of 4 and, within a block, the 4 rows are stored
+ * 16 columns at a time (row 0 cols 0-15, row 1 cols 0-15, ..., row 3 cols
+ * 0-15, row 0 cols 16-31, ...). Rows are padded to a multiple of 4 and
+ * columns to a multiple of 16, so every block is a whole number of 64 byte
+ * chunks read with aligned 128-bit loads and the kernels need neither
+ * alignment checks nor column tails on the matrix side. Padding is 0 for
+ * symmetric weights and -mat_zero_bias for asym8u weights, so padded taps
+ * add nothing to the accumulators.
+ *
+ * The packed kernels produce the same output as the unpacked kernels for a
+ * single matrix (p_mat2 = NULL).
+ */
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
+#define PACK_ROWS 4
+#define PACK_COLS 16
+
+#define PACKED_ROWS(rows) (((rows) + PACK_ROWS - 1) & ~(PACK_ROWS - 1))
+#define PACKED_COLS(cols) (((cols) + PACK_COLS - 1) & ~(PACK_COLS - 1))
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out, inp1, inp2, multiplier, l_shift, r_shift, out_off) \
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift, l_shift); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, AE_MOVDA32(multiplier), AE_MOVDA32(multiplier)); \
+  inp1 = AE_SRAA32SYMS(inp1, r_shift); \
+  inp2 = AE_SRAA32SYMS(inp2, r_shift); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_ZERO16(), AE_MOVDA16(255));
+
+/* 8bx8b accumulator pair to the 64 bit output stage of xa_nn_matXvec_8x8_8:
+   sign extension, bias addition, shift and symmetric rounding */
+#define ADD_BIAS_8b_PACKED(acc64_h, acc64_l, acc32, p_b, r) \
+  acc64_h = AE_SRAA64(AE_MOVF64_FROMF32X2(AE_SEL32_HH(acc32, ZERO32)), 32); \
+  acc64_l = AE_SRAA64(AE_MOVF64_FROMF32X2(AE_SEL32_LL(acc32, ZERO32)), 32); \
+  acc64_h = AE_ADD64S(acc64_h, AE_SLAA64S(AE_SRAI64(AE_MOVF64_FROMF32X2(AE_SEL32_LL(AE_MOVDA32(p_b[(r)]), ZERO32)), 32), bias_shift)); \
+  acc64_l = AE_ADD64S(acc64_l, AE_SLAA64S(AE_SRAI64(AE_MOVF64_FROMF32X2(AE_SEL32_LL(AE_MOVDA32(p_b[(r) + 1]), ZERO32)), 32), bias_shift));
+
+WORD32 xa_nn_get_packed_weights_size_8(
+    WORD32 rows,
+    WORD32 cols)
+{
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+
+  return PACKED_ROWS(rows) * PACKED_COLS(cols);
+}
+
+static void pack_weights_8(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD8 pad)
+{
+  int m_itr, c_itr, r, ii;
+
+  for(m_itr = 0; m_itr < PACKED_ROWS(rows); m_itr += PACK_ROWS)
+  {
+    for(c_itr = 0; c_itr < PACKED_COLS(cols); c_itr += PACK_COLS)
+    {
+      for(r = 0; r < PACK_ROWS; r++)
+      {
+        const WORD8 *p_row = p_mat + (m_itr + r) * row_stride;
+        for(ii = 0; ii < PACK_COLS; ii++)
+        {
+          *p_packed++ = ((m_itr + r) < rows && (c_itr + ii) < cols) ? p_row[c_itr + ii] : pad;
+        }
+      }
+    }
+  }
+}
+
+WORD32 xa_nn_pack_weights_8(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, 16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+
+  pack_weights_8(p_packed, p_mat, rows, cols, row_stride, 0);
+
+  return 0;
+}
+
+WORD32 xa_nn_pack_weights_asym8u(
+    UWORD8 * __restrict__ p_packed,
+    const UWORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 mat_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, 16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+  XA_NNLIB_ARG_CHK_COND((mat_zero_bias < -255 || mat_zero_bias > 0), -1);
+
+  pack_weights_8((WORD8 *)p_packed, (const WORD8 *)p_mat, rows, cols, row_stride, (WORD8)(UWORD8)(-mat_zero_bias));
+
+  return 0;
+}
+
+/* Last (cols % 16) vector elements, padded with pad, for the final column
+   chunk; returns 0 if cols is a multiple of 16 */
+static inline WORD32 copy_vec_tail(
+    ae_int8x16 *p_tail,
+    const WORD8 *p_vec,
+    WORD32 cols,
+    WORD8 pad)
+{
+  WORD8 *p_dst = (WORD8 *)p_tail;
+  int rem = cols & (PACK_COLS - 1);
+  int ii;
+
+  for(ii = 0; ii < PACK_COLS; ii++)
+  {
+    p_dst[ii] = (ii < rem) ? p_vec[cols - rem + ii] : pad;
+  }
+
+  return rem;
+}
+
+WORD32 xa_nn_matXvec_8x8_8_packed(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec,
+    const WORD8 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 acc_shift,
+    WORD32 bias_shift)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, 16, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+
+  int m_itr, c_itr;
+  int cols_packed = PACKED_COLS(cols);
+  ae_int8x16 vec_tail;
+  int rem_cols = copy_vec_tail(&vec_tail, p_vec, cols, 0);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  ae_int8x8 mat_row0_0, mat_row0_1;
+  ae_int8x8 mat_row1_0, mat_row1_1;
+  ae_int8x8 mat_row2_0, mat_row2_1;
+  ae_int8x8 mat_row3_0, mat_row3_1;
+  ae_int8x8 vec_0, vec_1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += PACK_ROWS)
+  {
+    ae_int32x2 acc_row01 = ZERO32;
+    ae_int32x2 acc_row23 = ZERO32;
+
+    ae_int8x16 *p_mat_0 = (ae_int8x16 *)(p_packed + m_itr * cols_packed);
+    ae_int8x16 *p_vec_0 = (ae_int8x16 *)p_vec;
+    ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+
+    for(c_itr = 0; c_itr < (cols >> 4); c_itr++)
+    {
+      AE_L8X8X2_IP(mat_row0_0, mat_row0_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row1_0, mat_row1_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row2_0, mat_row2_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row3_0, mat_row3_1, p_mat_0, 16);
+      AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec_0, p_vec_0);
+
+      AE_MULA8Q8X8(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, vec_0);
+      AE_MULA8Q8X8(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, vec_1);
+    }
+
+    if(rem_cols)
+    {
+      AE_L8X8X2_IP(mat_row0_0, mat_row0_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row1_0, mat_row1_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row2_0, mat_row2_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row3_0, mat_row3_1, p_mat_0, 16);
+      AE_L8X8X2_I(vec_0, vec_1, &vec_tail, 0);
+
+      AE_MULA8Q8X8(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, vec_0);
+      AE_MULA8Q8X8(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, vec_1);
+    }
+
+    /* Rows past the end of the matrix take the last bias and are not stored */
+    WORD8 bias[PACK_ROWS];
+    int ii;
+    for(ii = 0; ii < PACK_ROWS; ii++)
+    {
+      bias[ii] = p_bias[(m_itr + ii) < rows ? (m_itr + ii) : (rows - 1)];
+    }
+
+    ae_int64 acc64_0, acc64_1, acc64_2, acc64_3;
+    ADD_BIAS_8b_PACKED(acc64_0, acc64_1, acc_row01, bias, 0);
+    ADD_BIAS_8b_PACKED(acc64_2, acc64_3, acc_row23, bias, 2);
+
+    ae_int32x2 temp32_1, temp32_2;
+    acc64_0 = AE_SLAA64S(acc64_0, acc_shift);
+    acc64_1 = AE_SLAA64S(acc64_1, acc_shift);
+    acc64_2 = AE_SLAA64S(acc64_2, acc_shift);
+    acc64_3 = AE_SLAA64S(acc64_3, acc_shift);
+    temp32_1 = AE_ROUND32X2F64SSYM(acc64_0, acc64_1);
+    temp32_2 = AE_ROUND32X2F64SSYM(acc64_2, acc64_3);
+    temp32_1 = AE_SLAI32S(temp32_1, 24);
+    temp32_1 = AE_SRAI32(temp32_1, 24);
+    temp32_2 = AE_SLAI32S(temp32_2, 24);
+    temp32_2 = AE_SRAI32(temp32_2, 24);
+
+    p_out[m_itr] = (WORD8)AE_MOVAD32_H(temp32_1);
+    if(m_itr + 1 < rows) p_out[m_itr + 1] = (WORD8)AE_MOVAD32_L(temp32_1);
+    if(m_itr + 2 < rows) p_out[m_itr + 2] = (WORD8)AE_MOVAD32_H(temp32_2);
+    if(m_itr + 3 < rows) p_out[m_itr + 3] = (WORD8)AE_MOVAD32_L(temp32_2);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_packed(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, 16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_zero_bias < -127 || vec_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matXvec_sym8sxasym8s_asym8s_packed_host(p_out, p_packed, p_vec, p_bias, rows, cols,
+      vec_zero_bias, out_multiplier, out_shift, out_zero_bias) == 0)
+  {
+    return 0;
+  }
+#endif
+
+  int m_itr, c_itr;
+  int cols_packed = PACKED_COLS(cols);
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int8x16 vec_tail;
+  int rem_cols = copy_vec_tail(&vec_tail, p_vec, cols, 0);
+
+  ae_int8x8 neg_vec_bias = AE_MOVDA8((WORD8)-vec_zero_bias);
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+
+  ae_int8x8 mat_row0_0, mat_row0_1;
+  ae_int8x8 mat_row1_0, mat_row1_1;
+  ae_int8x8 mat_row2_0, mat_row2_1;
+  ae_int8x8 mat_row3_0, mat_row3_1;
+  ae_int8x8 vec_0, vec_1;
+  ae_int16x4 wvec_0_0, wvec_0_1;
+  ae_int16x4 wvec_1_0, wvec_1_1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += PACK_ROWS)
+  {
+    ae_int32x2 acc_row01 = ZERO32;
+    ae_int32x2 acc_row23 = ZERO32;
+
+    if(p_bias)
+    {
+      /* Load bias in the accumulator */
+      acc_row01 = AE_MOVDA32X2(p_bias[m_itr], (m_itr + 1) < rows ? p_bias[m_itr + 1] : 0);
+      acc_row23 = AE_MOVDA32X2((m_itr + 2) < rows ? p_bias[m_itr + 2] : 0, (m_itr + 3) < rows ? p_bias[m_itr + 3] : 0);
+    }
+
+    ae_int8x16 *p_mat_0 = (ae_int8x16 *)(p_packed + m_itr * cols_packed);
+    ae_int8x16 *p_vec_0 = (ae_int8x16 *)p_vec;
+    ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+
+    for(c_itr = 0; c_itr < (cols >> 4); c_itr++)
+    {
+      AE_L8X8X2_IP(mat_row0_0, mat_row0_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row1_0, mat_row1_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row2_0, mat_row2_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row3_0, mat_row3_1, p_mat_0, 16);
+      AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec_0, p_vec_0);
+
+      AE_SUBW8(wvec_0_0, wvec_0_1, vec_0, neg_vec_bias);
+      AE_SUBW8(wvec_1_0, wvec_1_1, vec_1, neg_vec_bias);
+
+      AE_MULA8Q8X16(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, wvec_0_0, wvec_0_1);
+      AE_MULA8Q8X16(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, wvec_1_0, wvec_1_1);
+    }
+
+    if(rem_cols)
+    {
+      AE_L8X8X2_IP(mat_row0_0, mat_row0_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row1_0, mat_row1_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row2_0, mat_row2_1, p_mat_0, 16);
+      AE_L8X8X2_IP(mat_row3_0, mat_row3_1, p_mat_0, 16);
+      AE_L8X8X2_I(vec_0, vec_1, &vec_tail, 0);
+
+      AE_SUBW8(wvec_0_0, wvec_0_1, vec_0, neg_vec_bias);
+      AE_SUBW8(wvec_1_0, wvec_1_1, vec_1, neg_vec_bias);
+
+      AE_MULA8Q8X16(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, wvec_0_0, wvec_0_1);
+      AE_MULA8Q8X16(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, wvec_1_0, wvec_1_1);
+    }
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row01, out_multiplier, left_shift, right_shift);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row23, out_multiplier, left_shift, right_shift);
+    acc_row01 = AE_ADD32S(acc_row01, out_zero_bias);
+    acc_row23 = AE_ADD32S(acc_row23, out_zero_bias);
+    AE_MINMAX32(acc_row01, min_int8, max_int8);
+    AE_MINMAX32(acc_row23, min_int8, max_int8);
+
+    p_out[m_itr] = (WORD8)AE_MOVAD32_H(acc_row01);
+    if(m_itr + 1 < rows) p_out[m_itr + 1] = (WORD8)AE_MOVAD32_L(acc_row01);
+    if(m_itr + 2 < rows) p_out[m_itr + 2] = (WORD8)AE_MOVAD32_H(acc_row23);
+    if(m_itr + 3 < rows) p_out[m_itr + 3] = (WORD8)AE_MOVAD32_L(acc_row23);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u_packed(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_packed,
+    const UWORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_packed, 16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((mat_zero_bias < -255 || mat_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_zero_bias < -255 || vec_zero_bias > 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < 0 || out_zero_bias > 255), -1);
+
+  int m_itr, c_itr, vec_itr;
+  int cols_packed = PACKED_COLS(cols);
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 l_mult = AE_MOVDA32(1 << left_shift);
+  ae_int8x16 vec_tail;
+
+  /* Load AE_BIASV8 and AE_BIASC8 state registers with mat and vec zero bias values */
+  ae_int64 biasvc1 = AE_MOVINT64_FROMINT32X2(AE_MOVDA32X2(-vec_zero_bias, -mat_zero_bias));
+  AE_MOVZBVCDR(biasvc1);
+
+  ae_int8x8 mat_row0_0, mat_row0_1;
+  ae_int8x8 mat_row1_0, mat_row1_1;
+  ae_int8x8 mat_row2_0, mat_row2_1;
+  ae_int8x8 mat_row3_0, mat_row3_1;
+  ae_int8x8 vec_0, vec_1;
+
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+  {
+    const UWORD8 *p_vec_cur = p_vec + vec_itr * vec_offset;
+    int rem_cols = copy_vec_tail(&vec_tail, (const WORD8 *)p_vec_cur, cols, (WORD8)(UWORD8)(-vec_zero_bias));
+    UWORD8 *p_dst = p_out + vec_itr * out_offset;
+
+    for(m_itr = 0; m_itr < rows; m_itr += PACK_ROWS)
+    {
+      ae_int32x2 acc_row01 = ZERO32;
+      ae_int32x2 acc_row23 = ZERO32;
+
+      if(p_bias)
+      {
+        /* Load bias in the accumulator */
+        acc_row01 = AE_MOVDA32X2(p_bias[m_itr], (m_itr + 1) < rows ? p_bias[m_itr + 1] : 0);
+        acc_row23 = AE_MOVDA32X2((m_itr + 2) < rows ? p_bias[m_itr + 2] : 0, (m_itr + 3) < rows ? p_bias[m_itr + 3] : 0);
+      }
+
+      ae_int8x16 *p_mat_0 = (ae_int8x16 *)(p_packed + m_itr * cols_packed);
+      ae_int8x16 *p_vec_0 = (ae_int8x16 *)p_vec_cur;
+      ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+
+      for(c_itr = 0; c_itr < (cols >> 4); c_itr++)
+      {
+        AE_L8X8X2_IP(mat_row0_0, mat_row0_1, p_mat_0, 16);
+        AE_L8X8X2_IP(mat_row1_0, mat_row1_1, p_mat_0, 16);
+        AE_L8X8X2_IP(mat_row2_0, mat_row2_1, p_mat_0, 16);
+        AE_L8X8X2_IP(mat_row3_0, mat_row3_1, p_mat_0, 16);
+        AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec_0, p_vec_0);
+
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, vec_0);
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, vec_1);
+      }
+
+      if(rem_cols)
+      {
+        AE_L8X8X2_IP(mat_row0_0, mat_row0_1, p_mat_0, 16);
+        AE_L8X8X2_IP(mat_row1_0, mat_row1_1, p_mat_0, 16);
+        AE_L8X8X2_IP(mat_row2_0, mat_row2_1, p_mat_0, 16);
+        AE_L8X8X2_IP(mat_row3_0, mat_row3_1, p_mat_0, 16);
+        AE_L8X8X2_I(vec_0, vec_1, &vec_tail, 0);
+
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_0, mat_row1_0, mat_row2_0, mat_row3_0, vec_0);
+        AE_MULAUUZB8Q8X8(acc_row01, acc_row23, mat_row0_1, mat_row1_1, mat_row2_1, mat_row3_1, vec_1);
+      }
+
+      /* Apply quantization */
+      ae_int16x4 out_0;
+      MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_0, acc_row01, acc_row23, out_multiplier, l_mult, right_shift, out_zero_bias);
+
+      p_dst[m_itr * out_stride] = (UWORD8)AE_MOVAD16_3(out_0);
+      if(m_itr + 1 < rows) p_dst[(m_itr + 1) * out_stride] = (UWORD8)AE_MOVAD16_2(out_0);
+      if(m_itr + 2 < rows) p_dst[(m_itr + 2) * out_stride] = (UWORD8)AE_MOVAD16_1(out_0);
+      if(m_itr + 3 < rows) p_dst[(m_itr + 3) * out_stride] = (UWORD8)AE_MOVAD16_0(out_0);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,597 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+******************************************************************************/
+/*
+ * Partitioned (multi-core) execution of the sym8sxasym8s matXvec/matmul.
+ *
+ * The library creates no threads: the caller passes an xa_nnlib_workers_t
+ * whose run callback executes a task function once per task index,
+ * possibly on different cores, and returns when all tasks are done.
+ *
+ *  - XA_NNLIB_SPLIT_ROWS: every task runs the single-core kernel on its own
+ *    range of output rows. Ranges are multiples of 16 rows, so every row
+ *    goes through the same code path as in the single-core call and the
+ *    output is identical.
+ *  - XA_NNLIB_SPLIT_K: every task accumulates the dot products of all rows
+ *    over its own range of columns into a 32 bit partial sum in p_scratch.
+ *    A second pass, split by rows, adds the partial sums in task order,
+ *    adds the bias and requantizes. Integer sums do not depend on the
+ *    order, so the accumulators are those of the single-core kernel. The
+ *    single-core kernels round differently on their special and tail paths,
+ *    so every output is requantized with the macro the single-core kernel
+ *    uses for it, and the output is identical.
+ *
+ * Only the sym8sxasym8s kernels have parallel variants.
+ * Split K is for shapes with few rows and many columns, where a row split
+ * leaves cores idle.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define SPLIT_ROWS_ALIGN  16
+#define SPLIT_COLS_ALIGN  16
+#define PART_ROWS         4
+#define ALIGNMENT         16
+
+#define ROUND_UP(x, n)  (((x) + (n) - 1) / (n) * (n))
+#define ALIGN_PTR(x, bytes) ((((uintptr_t)(x)) + (bytes - 1)) & ~(bytes - 1))
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out, inp1, inp2, multiplier, l_shift, r_shift, out_off) \
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift, l_shift); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, AE_MOVDA32(multiplier), AE_MOVDA32(multiplier)); \
+  inp1 = AE_SRAA32SYMS(inp1, r_shift); \
+  inp2 = AE_SRAA32SYMS(inp2, r_shift); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127));
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+typedef struct _parallel_task_t
+{
+  WORD8 *p_out;
+  const WORD8 *p_mat1;
+  const WORD8 *p_vec1;
+  const WORD32 *p_bias;
+  WORD32 rows;
+  WORD32 cols1;
+  WORD32 row_stride1;
+  WORD32 vec_count;
+  WORD32 vec_offset;
+  WORD32 out_offset;
+  WORD32 out_stride;
+  WORD32 vec1_zero_bias;
+  WORD32 out_multiplier;
+  WORD32 out_shift;
+  const WORD32 *p_out_multiplier;     /* NULL for the per tensor matXvec */
+  const WORD32 *p_out_shift;
+  WORD32 out_zero_bias;
+  WORD32 chunk;                       /* rows per task */
+  WORD32 chunk_k;                     /* columns per split K task */
+  WORD32 num_parts;                   /* number of split K tasks */
+  WORD32 num_tasks;
+  WORD32 rows_pad;
+  WORD32 *p_partial;                  /* [num_tasks][vec_count][rows_pad] */
+  WORD32 x2_x2_start;                 /* per tensor: rows the single-core kernel */
+  WORD32 x2_x2_end;                   /* requantizes with _X2_X2, others _X2 */
+  WORD32 per_chan_all;                /* per channel: special case of the single-core
+                                         kernel, _per_chan_X2_X2 for all outputs */
+  WORD32 err[XA_NNLIB_MAX_WORKERS];
+} parallel_task_t;
+
+/* Splits n into at most num_workers ranges of a multiple of align */
+static inline WORD32 split_chunk(WORD32 n, WORD32 num_workers, WORD32 align, WORD32 *p_num_tasks)
+{
+  WORD32 chunk = ROUND_UP((n + num_workers - 1) / num_workers, align);
+  *p_num_tasks = (n + chunk - 1) / chunk;
+  return chunk;
+}
+
+static WORD32 run_tasks(
+    const xa_nnlib_workers_t *p_workers,
+    xa_nnlib_task_fn_t fn,
+    parallel_task_t *p_task)
+{
+  int ii;
+
+  memset(p_task->err, 0, sizeof(p_task->err));
+  if(p_workers == NULL || p_task->num_tasks == 1)
+  {
+    for(ii = 0; ii < p_task->num_tasks; ii++)
+      fn(p_task, ii);
+  }
+  else if(p_workers->run(p_workers->p_ctx, fn, p_task, p_task->num_tasks) != 0)
+  {
+    return -1;
+  }
+
+  for(ii = 0; ii < p_task->num_tasks; ii++)
+  {
+    if(p_task->err[ii])
+      return -1;
+  }
+  return 0;
+}
+
+static void task_rows(VOID *p_arg, WORD32 task)
+{
+  parallel_task_t *p_task = (parallel_task_t *)p_arg;
+  WORD32 m_start = task * p_task->chunk;
+  WORD32 m_cnt = XT_MIN(p_task->chunk, p_task->rows - m_start);
+  const WORD32 *p_bias = p_task->p_bias ? p_task->p_bias + m_start : NULL;
+
+  if(p_task->p_out_multiplier == NULL)
+  {
+    p_task->err[task] = xa_nn_matXvec_sym8sxasym8s_asym8s(
+        p_task->p_out + m_start, p_task->p_mat1 + m_start * p_task->row_stride1, NULL,
+        p_task->p_vec1, NULL, p_bias, m_cnt, p_task->cols1, 0, p_task->row_stride1, 0,
+        p_task->vec1_zero_bias, 0, p_task->out_multiplier, p_task->out_shift, p_task->out_zero_bias);
+  }
+  else
+  {
+    p_task->err[task] = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
+        p_task->p_out + m_start * p_task->out_stride, p_task->p_mat1 + m_start * p_task->row_stride1,
+        p_task->p_vec1, p_bias, m_cnt, p_task->cols1, p_task->row_stride1, p_task->vec_count,
+        p_task->vec_offset, p_task->out_offset, p_task->out_stride, p_task->vec1_zero_bias,
+        p_task->p_out_multiplier + m_start, p_task->p_out_shift + m_start, p_task->out_zero_bias);
+  }
+}
+
+/* sum(mat * (vec + vec_zero_bias)) of 4 rows over cols columns; row
+   pointers can repeat for the rows past the end of the matrix */
+static inline void dot_4_rows_partial(
+    ae_int32x2 *p_acc_row01,
+    ae_int32x2 *p_acc_row23,
+    const WORD8 *p_row_0,
+    const WORD8 *p_row_1,
+    const WORD8 *p_row_2,
+    const WORD8 *p_row_3,
+    const WORD8 *p_vec,
+    WORD32 cols,
+    WORD32 vec_zero_bias)
+{
+  ae_int32x2 acc_row01 = ZERO32;
+  ae_int32x2 acc_row23 = ZERO32;
+  ae_int8x8 neg_vec_bias = AE_MOVDA8((WORD8)-vec_zero_bias);
+  ae_int8x8 vec_0, vec_1;
+  ae_int16x4 wvec_0_0, wvec_0_1, wvec_1_0, wvec_1_1;
+  ae_int8x8 mat_0_0, mat_0_1, mat_1_0, mat_1_1, mat_2_0, mat_2_1, mat_3_0, mat_3_1;
+  int c_itr;
+
+  ae_valignx2 align_p_row_0 = AE_LA128_PP(p_row_0);
+  ae_valignx2 align_p_row_1 = AE_LA128_PP(p_row_1);
+  ae_valignx2 align_p_row_2 = AE_LA128_PP(p_row_2);
+  ae_valignx2 align_p_row_3 = AE_LA128_PP(p_row_3);
+  ae_valignx2 align_p_vec = AE_LA128_PP(p_vec);
+
+  for(c_itr = 0; c_itr < (cols & ~(16 - 1)); c_itr += 16)
+  {
+    AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec, p_vec);
+    AE_SUBW8(wvec_0_0, wvec_0_1, vec_0, neg_vec_bias);
+    AE_SUBW8(wvec_1_0, wvec_1_1, vec_1, neg_vec_bias);
+
+    AE_LA8X8X2_IP(mat_0_0, mat_0_1, align_p_row_0, p_row_0);
+    AE_LA8X8X2_IP(mat_1_0, mat_1_1, align_p_row_1, p_row_1);
+    AE_LA8X8X2_IP(mat_2_0, mat_2_1, align_p_row_2, p_row_2);
+    AE_LA8X8X2_IP(mat_3_0, mat_3_1, align_p_row_3, p_row_3);
+
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_0, mat_1_0, mat_2_0, mat_3_0, wvec_0_0, wvec_0_1);
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_1, mat_1_1, mat_2_1, mat_3_1, wvec_1_0, wvec_1_1);
+  }
+
+  /* Column tail: the matrix is zero padded */
+  if(c_itr < cols)
+  {
+    int rem_cols = cols - c_itr;
+    ae_int8x8 vec_tail[2];
+    ae_int8x8 mat_tail[2 * PART_ROWS];
+
+    memset(vec_tail, 0, sizeof(vec_tail));
+    memcpy(vec_tail, p_vec, rem_cols);
+    memset(mat_tail, 0, sizeof(mat_tail));
+    memcpy(&mat_tail[0], p_row_0, rem_cols);
+    memcpy(&mat_tail[2], p_row_1, rem_cols);
+    memcpy(&mat_tail[4], p_row_2, rem_cols);
+    memcpy(&mat_tail[6], p_row_3, rem_cols);
+
+    AE_SUBW8(wvec_0_0, wvec_0_1, AE_L8X8_I(vec_tail, 0), neg_vec_bias);
+    AE_SUBW8(wvec_1_0, wvec_1_1, AE_L8X8_I(vec_tail, 8), neg_vec_bias);
+
+    AE_MULA8Q8X16(acc_row01, acc_row23, AE_L8X8_I(mat_tail, 0), AE_L8X8_I(mat_tail, 16),
+        AE_L8X8_I(mat_tail, 32), AE_L8X8_I(mat_tail, 48), wvec_0_0, wvec_0_1);
+    AE_MULA8Q8X16(acc_row01, acc_row23, AE_L8X8_I(mat_tail, 8), AE_L8X8_I(mat_tail, 24),
+        AE_L8X8_I(mat_tail, 40), AE_L8X8_I(mat_tail, 56), wvec_1_0, wvec_1_1);
+  }
+
+  *p_acc_row01 = acc_row01;
+  *p_acc_row23 = acc_row23;
+}
+
+static void task_k_partial(VOID *p_arg, WORD32 task)
+{
+  parallel_task_t *p_task = (parallel_task_t *)p_arg;
+  WORD32 c_start = task * p_task->chunk_k;
+  WORD32 c_cnt = XT_MIN(p_task->chunk_k, p_task->cols1 - c_start);
+  WORD32 *p_partial = p_task->p_partial + task * p_task->vec_count * p_task->rows_pad;
+  int m_itr, vec_itr;
+  int last = p_task->rows - 1;
+
+  /* The 4 rows of the column range stay in cache across the vectors */
+  for(m_itr = 0; m_itr < p_task->rows; m_itr += PART_ROWS)
+  {
+    const WORD8 *p_row_0 = p_task->p_mat1 + m_itr * p_task->row_stride1 + c_start;
+    const WORD8 *p_row_1 = p_task->p_mat1 + XT_MIN(m_itr + 1, last) * p_task->row_stride1 + c_start;
+    const WORD8 *p_row_2 = p_task->p_mat1 + XT_MIN(m_itr + 2, last) * p_task->row_stride1 + c_start;
+    const WORD8 *p_row_3 = p_task->p_mat1 + XT_MIN(m_itr + 3, last) * p_task->row_stride1 + c_start;
+
+    for(vec_itr = 0; vec_itr < p_task->vec_count; vec_itr++)
+    {
+      ae_int32x2 acc_row01, acc_row23;
+
+      dot_4_rows_partial(&acc_row01, &acc_row23, p_row_0, p_row_1, p_row_2, p_row_3,
+          p_task->p_vec1 + vec_itr * p_task->vec_offset + c_start, c_cnt, p_task->vec1_zero_bias);
+
+      AE_S32X2X2_I(acc_row01, acc_row23, (ae_int32x4 *)(p_partial + vec_itr * p_task->rows_pad + m_itr), 0);
+    }
+  }
+}
+
+/* Requantizes one accumulator as MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2 or
+   MULTIPLYBYQUANTIZEDMULTIPLIER_X2 of the single-core kernels */
+static inline WORD8 requant_row(WORD32 acc, WORD32 out_multiplier, WORD32 out_shift, WORD32 out_zero_bias, int x2_x2)
+{
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 acc_0 = AE_MOVDA32(acc);
+
+  if(x2_x2)
+  {
+    ae_int32x2 acc_1 = acc_0;
+    ae_int16x4 out_0;
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2(out_0, acc_0, acc_1, out_multiplier, AE_MOVDA32(1 << left_shift), right_shift, out_zero_bias);
+    return (WORD8)AE_MOVAD16_0(out_0);
+  }
+
+  MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_0, out_multiplier, left_shift, right_shift);
+  acc_0 = AE_ADD32S(acc_0, out_zero_bias);
+  AE_MINMAX32(acc_0, AE_MOVDA32(-128), AE_MOVDA32(127));
+  return (WORD8)AE_MOVAD32_L(acc_0);
+}
+
+/* Adds the partial sums of a range of rows in task order, adds the bias
+   and requantizes */
+static void task_k_reduce(VOID *p_arg, WORD32 task)
+{
+  parallel_task_t *p_task = (parallel_task_t *)p_arg;
+  WORD32 m_start = task * p_task->chunk;
+  WORD32 m_end = XT_MIN(m_start + p_task->chunk, p_task->rows);
+  WORD32 part_stride = p_task->vec_count * p_task->rows_pad;
+  WORD32 out_zero_bias = p_task->out_zero_bias;
+  WORD32 rows_x4 = p_task->rows & ~(PART_ROWS - 1);
+  WORD32 vecs_x4 = p_task->vec_count & ~(4 - 1);
+  int m_itr, vec_itr, ii, part;
+
+  for(m_itr = m_start; m_itr < m_end; m_itr += PART_ROWS)
+  {
+    int nrows = XT_MIN(PART_ROWS, m_end - m_itr);
+    WORD32 p_bias[PART_ROWS];
+    int p_left_mult[PART_ROWS], p_right_mult[PART_ROWS], p_out_mult[PART_ROWS];
+    ae_int32x2 l_mult_23, l_mult_01, r_mult_23, r_mult_01;
+    ae_int32x2 out_multiplier_01, out_multiplier_23;
+
+    for(ii = 0; ii < PART_ROWS; ii++)
+    {
+      int valid = ii < nrows;
+      p_bias[ii] = (valid && p_task->p_bias) ? p_task->p_bias[m_itr + ii] : 0;
+    }
+
+    if(p_task->p_out_multiplier)
+    {
+      /* Padding rows get a zero multiplier */
+      for(ii = 0; ii < PART_ROWS; ii++)
+      {
+        int valid = ii < nrows;
+        int shift = valid ? p_task->p_out_shift[m_itr + ii] : 0;
+
+        p_left_mult[ii] = shift < 0 ? 1 : (1 << shift);
+        p_right_mult[ii] = shift > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + shift));
+        p_out_mult[ii] = valid ? -p_task->p_out_multiplier[m_itr + ii] : 0;
+      }
+      AE_L32X2X2_I(l_mult_01, l_mult_23, (ae_int32x4 *)p_left_mult, 0);
+      AE_L32X2X2_I(r_mult_01, r_mult_23, (ae_int32x4 *)p_right_mult, 0);
+      AE_L32X2X2_I(out_multiplier_01, out_multiplier_23, (ae_int32x4 *)p_out_mult, 0);
+    }
+
+    for(vec_itr = 0; vec_itr < p_task->vec_count; vec_itr++)
+    {
+      const WORD32 *p_part = p_task->p_partial + vec_itr * p_task->rows_pad + m_itr;
+      ae_int32x2 acc_row01 = AE_MOVDA32X2(p_bias[0], p_bias[1]);
+      ae_int32x2 acc_row23 = AE_MOVDA32X2(p_bias[2], p_bias[3]);
+      WORD8 *p_dst = p_task->p_out + m_itr * p_task->out_stride + vec_itr * p_task->out_offset;
+      ae_int32x2 part_row01, part_row23;
+      WORD32 acc[PART_ROWS];
+
+      for(part = 0; part < p_task->num_parts; part++)
+      {
+        AE_L32X2X2_I(part_row01, part_row23, (ae_int32x4 *)(p_part + part * part_stride), 0);
+        acc_row01 = AE_ADD32(acc_row01, part_row01);
+        acc_row23 = AE_ADD32(acc_row23, part_row23);
+      }
+
+      if(p_task->p_out_multiplier == NULL)
+      {
+        acc[0] = AE_MOVAD32_H(acc_row01); acc[1] = AE_MOVAD32_L(acc_row01);
+        acc[2] = AE_MOVAD32_H(acc_row23); acc[3] = AE_MOVAD32_L(acc_row23);
+        for(ii = 0; ii < nrows; ii++)
+        {
+          int x2_x2 = (m_itr + ii) >= p_task->x2_x2_start && (m_itr + ii) < p_task->x2_x2_end;
+          p_dst[ii] = requant_row(acc[ii], p_task->out_multiplier, p_task->out_shift, out_zero_bias, x2_x2);
+        }
+      }
+      /* The single-core kernel uses _per_chan_X2_X2 in its special cases
+         and for the last vec_count % 4 vectors of full groups of four rows */
+      else if(p_task->per_chan_all || (m_itr < rows_x4 && vec_itr >= vecs_x4))
+      {
+        ae_int16x4 out_0;
+
+        MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row01, acc_row23, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+
+        p_dst[0] = (WORD8)AE_MOVAD16_3(out_0);
+        if(nrows > 1) p_dst[p_task->out_stride] = (WORD8)AE_MOVAD16_2(out_0);
+        if(nrows > 2) p_dst[2 * p_task->out_stride] = (WORD8)AE_MOVAD16_1(out_0);
+        if(nrows > 3) p_dst[3 * p_task->out_stride] = (WORD8)AE_MOVAD16_0(out_0);
+      }
+      else
+      {
+        /* _X2_X2 for groups of four vectors, _X2 for the remaining ones */
+        acc[0] = AE_MOVAD32_H(acc_row01); acc[1] = AE_MOVAD32_L(acc_row01);
+        acc[2] = AE_MOVAD32_H(acc_row23); acc[3] = AE_MOVAD32_L(acc_row23);
+        for(ii = 0; ii < nrows; ii++)
+        {
+          p_dst[ii * p_task->out_stride] = requant_row(acc[ii], p_task->p_out_multiplier[m_itr + ii],
+              p_task->p_out_shift[m_itr + ii], out_zero_bias, vec_itr < vecs_x4);
+        }
+      }
+    }
+  }
+}
+
+static WORD32 run_parallel(
+    parallel_task_t *p_task,
+    WORD32 split,
+    const xa_nnlib_workers_t *p_workers,
+    VOID *p_scratch)
+{
+  WORD32 num_workers = p_workers ? p_workers->num_workers : 1;
+
+  if(split == XA_NNLIB_SPLIT_ROWS)
+  {
+    p_task->chunk = split_chunk(p_task->rows, num_workers, SPLIT_ROWS_ALIGN, &p_task->num_tasks);
+    return run_tasks(p_workers, task_rows, p_task);
+  }
+
+  /* Phase 1: partial sums over column ranges */
+  p_task->rows_pad = ROUND_UP(p_task->rows, PART_ROWS);
+  p_task->p_partial = (WORD32 *)ALIGN_PTR(p_scratch, ALIGNMENT);
+  p_task->chunk_k = split_chunk(p_task->cols1, num_workers, SPLIT_COLS_ALIGN, &p_task->num_parts);
+  p_task->num_tasks = p_task->num_parts;
+  if(run_tasks(p_workers, task_k_partial, p_task) != 0)
+    return -1;
+
+  /* Phase 2: reduction and requantization over row ranges */
+  p_task->chunk = split_chunk(p_task->rows, num_workers, PART_ROWS, &p_task->num_tasks);
+  return run_tasks(p_workers, task_k_reduce, p_task);
+}
+
+WORD32 xa_nn_matmul_parallel_getsize(
+    WORD32 rows,
+    WORD32 vec_count,
+    WORD32 split,
+    WORD32 num_workers)
+{
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((split != XA_NNLIB_SPLIT_ROWS && split != XA_NNLIB_SPLIT_K), -1);
+  XA_NNLIB_ARG_CHK_COND((num_workers <= 0 || num_workers > XA_NNLIB_MAX_WORKERS), -1);
+
+  if(split == XA_NNLIB_SPLIT_ROWS)
+    return 0;
+
+  return num_workers * vec_count * ROUND_UP(rows, PART_ROWS) * sizeof(WORD32) + ALIGNMENT;
+}
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_parallel(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 split,
+    const xa_nnlib_workers_t *p_workers,
+    VOID * __restrict__ p_scratch)
+{
+  parallel_task_t task;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((split != XA_NNLIB_SPLIT_ROWS && split != XA_NNLIB_SPLIT_K), -1);
+  if(p_workers)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_workers->run, -1);
+    XA_NNLIB_ARG_CHK_COND((p_workers->num_workers <= 0 || p_workers->num_workers > XA_NNLIB_MAX_WORKERS), -1);
+  }
+  if(split == XA_NNLIB_SPLIT_K)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  }
+
+  memset(&task, 0, sizeof(task));
+  task.p_out = p_out;
+  task.p_mat1 = p_mat1;
+  task.p_vec1 = p_vec1;
+  task.p_bias = p_bias;
+  task.rows = rows;
+  task.cols1 = cols1;
+  task.row_stride1 = row_stride1;
+  task.vec_count = 1;
+  task.out_stride = 1;
+  task.vec1_zero_bias = vec1_zero_bias;
+  task.out_multiplier = out_multiplier;
+  task.out_shift = out_shift;
+  task.out_zero_bias = out_zero_bias;
+
+  /* Rows of xa_nn_matXvec_sym8sxasym8s_asym8s requantized with _X2_X2 */
+  if(ALIGNED_PTR(p_out, 16) && ALIGNED_PTR(p_mat1, 16) && ALIGNED_PTR(p_vec1, 16) &&
+     ALIGNED_PTR(p_bias, 16) && ((row_stride1 & 15) == 0))
+  {
+    task.x2_x2_start = task.x2_x2_end = 0;
+  }
+  else if((cols1 == 64) && (row_stride1 == 64) && ((rows & 0x3) == 0) && ALIGNED_PTR(p_out, 4))
+  {
+    task.x2_x2_start = 0;
+    task.x2_x2_end = rows;
+  }
+  else
+  {
+    task.x2_x2_start = rows & ~(64 - 1);
+    task.x2_x2_end = rows & ~(4 - 1);
+  }
+
+  return run_parallel(&task, split, p_workers, p_scratch);
+}
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_parallel(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 split,
+    const xa_nnlib_workers_t *p_workers,
+    VOID * __restrict__ p_scratch)
+{
+  parallel_task_t task;
+  int ii;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((split != XA_NNLIB_SPLIT_ROWS && split != XA_NNLIB_SPLIT_K), -1);
+  for(ii = 0; ii < rows; ii++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[ii] < -31 || p_out_shift[ii] > 31), -1);
+  }
+  if(p_workers)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_workers->run, -1);
+    XA_NNLIB_ARG_CHK_COND((p_workers->num_workers <= 0 || p_workers->num_workers > XA_NNLIB_MAX_WORKERS), -1);
+  }
+  if(split == XA_NNLIB_SPLIT_K)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  }
+
+  memset(&task, 0, sizeof(task));
+  task.p_out = p_out;
+  task.p_mat1 = p_mat1;
+  task.p_vec1 = p_vec1;
+  task.p_bias = p_bias;
+  task.rows = rows;
+  task.cols1 = cols1;
+  task.row_stride1 = row_stride1;
+  task.vec_count = vec_count;
+  task.vec_offset = vec_offset;
+  task.out_offset = out_offset;
+  task.out_stride = out_stride;
+  task.vec1_zero_bias = vec1_zero_bias;
+  task.p_out_multiplier = p_out_multiplier;
+  task.p_out_shift = p_out_shift;
+  task.out_zero_bias = out_zero_bias;
+
+  /* Special cases of xa_nn_matmul_per_chan_sym8sxasym8s_asym8s */
+  task.per_chan_all = ALIGNED_PTR(p_vec1, 16) && ALIGNED_PTR(p_out, 4) &&
+      (out_stride == 1) && ((out_offset & 0x3) == 0) && ((rows & 0x3) == 0) &&
+      ((((cols1 == 8) || (cols1 == 16) || (cols1 == 24) || (cols1 == 32)) &&
+        (row_stride1 == cols1) && (vec_offset == cols1) && ((vec_count & 0x3) == 0)) ||
+       (((cols1 & 0x1f) == 0) && (cols1 <= 256) &&
+        ((row_stride1 & 0x1f) == 0) && ((vec_offset & 0x1f) == 0)));
+
+  return run_parallel(&task, split, p_workers, p_scratch);
+}
@@ -0,0 +1,693 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Structured-sparse weights for the sym8sxasym8s matXvec.
+ *
+ * xa_nn_pack_sparse_weights_8 compresses a pruned rows x cols matrix once,
+ * offline or at model load, and xa_nn_matXvec_sym8sxasym8s_asym8s_sparse
+ * then multiplies only the weights that were kept:
+ *
+ *  - XA_NNLIB_SPARSE_2_4: each aligned group of 4 columns of a row has at
+ *    most 2 nonzeros. For every 16 columns of a row the 8 kept values are
+ *    stored with 2 bytes of metadata, a 2-bit column index per value and a
+ *    nibble per group. The kernel turns the metadata into an AE_SEL8X8
+ *    pattern that gathers the 8 matching vector elements out of the 16 and
+ *    multiplies them with one 8-way AE_MULAAAA2Q8.
+ *  - XA_NNLIB_SPARSE_BLOCK_1X4: all-zero blocks of 1 row x 4 columns are
+ *    dropped. Kept blocks are taken two at a time, so each AE_MULAAAA2Q8 is
+ *    an 8-way MAC on one row.
+ *  - XA_NNLIB_SPARSE_BLOCK_4X4: all-zero blocks of 4 rows x 4 columns are
+ *    dropped. The 4 rows of a block share their vector elements, so a pair
+ *    of blocks is one AE_MULA8Q8X8 for 4 rows.
+ *
+ * Block positions are given either by a bitmask, one bit per column block
+ * of each row (group), or in CSR form: a block row pointer and a column
+ * block index per kept block. The kept blocks of a row (group) are padded
+ * to an even count with a zero block.
+ *
+ * The vector zero bias is applied as vec_zero_bias times the sum of the
+ * row, which the converter stores, so the MACs stay 8x8 bit. The output is
+ * identical to xa_nn_matXvec_sym8sxasym8s_asym8s on the pruned dense
+ * matrix (single matrix, p_mat2 = NULL).
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define SP24_COLS     16      /* columns per 2:4 chunk */
+#define SP24_VALUES   8       /* kept values per 2:4 chunk */
+#define SP24_META     2       /* metadata bytes per 2:4 chunk */
+#define BLK_COLS      4
+
+#define ROUND_UP(x, n)  (((x) + (n) - 1) / (n) * (n))
+#define ALIGNED_SIZE(x) ROUND_UP((x), 16)
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Layout of the compressed buffer; offsets are from its start */
+typedef struct _sparse_hdr_t
+{
+  WORD32 format;
+  WORD32 index_type;
+  WORD32 rows;
+  WORD32 cols;
+  WORD32 values_offset;
+  WORD32 index_offset;      /* 2:4 metadata, bitmask or CSR column indices */
+  WORD32 row_ptr_offset;    /* CSR block row pointer */
+  WORD32 row_sum_offset;
+} sparse_hdr_t;
+
+/* AE_SEL8X8 indices of the 2 values of group g of a 2:4 chunk, by metadata
+   nibble i0 | i1 << 2: column c of the 16 is index 15 - c, i.e.
+   4 * (3 - g) + 3 - i */
+#define SEL_2_4(b) \
+  {(b) + 3, (b) + 3}, {(b) + 2, (b) + 3}, {(b) + 1, (b) + 3}, {(b), (b) + 3}, \
+  {(b) + 3, (b) + 2}, {(b) + 2, (b) + 2}, {(b) + 1, (b) + 2}, {(b), (b) + 2}, \
+  {(b) + 3, (b) + 1}, {(b) + 2, (b) + 1}, {(b) + 1, (b) + 1}, {(b), (b) + 1}, \
+  {(b) + 3, (b)},     {(b) + 2, (b)},     {(b) + 1, (b)},     {(b), (b)}
+
+static const WORD8 sel_2_4[4][16][2] =
+{
+  {SEL_2_4(12)}, {SEL_2_4(8)}, {SEL_2_4(4)}, {SEL_2_4(0)}
+};
+
+static inline WORD32 blk_rows_of(WORD32 format)
+{
+  return (format == XA_NNLIB_SPARSE_BLOCK_4X4) ? 4 : 1;
+}
+
+static WORD32 block_is_zero(
+    const WORD8 *p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 row,
+    WORD32 blk,
+    WORD32 blk_rows)
+{
+  int r, c;
+
+  for(r = row; r < row + blk_rows && r < rows; r++)
+  {
+    for(c = blk * BLK_COLS; c < (blk + 1) * BLK_COLS && c < cols; c++)
+    {
+      if(p_mat[r * row_stride + c] != 0)
+        return 0;
+    }
+  }
+  return 1;
+}
+
+/* Fills the header and returns the size of the compressed buffer, -1 if
+   the matrix does not fit the format */
+static WORD32 sparse_layout(
+    sparse_hdr_t *p_hdr,
+    const WORD8 *p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 format,
+    WORD32 index_type)
+{
+  WORD32 values_size, index_size, row_ptr_size = 0;
+  int row, blk, c, ii;
+
+  if(format == XA_NNLIB_SPARSE_2_4)
+  {
+    WORD32 n_chunks = (cols + SP24_COLS - 1) / SP24_COLS;
+
+    for(row = 0; row < rows; row++)
+    {
+      for(c = 0; c < cols; c += 4)
+      {
+        int nz = 0;
+        for(ii = c; ii < c + 4 && ii < cols; ii++)
+          nz += (p_mat[row * row_stride + ii] != 0);
+        if(nz > 2)
+          return -1;
+      }
+    }
+    values_size = rows * n_chunks * SP24_VALUES;
+    index_size = rows * n_chunks * SP24_META;
+  }
+  else
+  {
+    WORD32 blk_rows = blk_rows_of(format);
+    WORD32 n_blk_cols = (cols + BLK_COLS - 1) / BLK_COLS;
+    WORD32 n_kept = 0, n_stored = 0;
+
+    for(row = 0; row < rows; row += blk_rows)
+    {
+      WORD32 n_row = 0;
+      for(blk = 0; blk < n_blk_cols; blk++)
+        n_row += !block_is_zero(p_mat, rows, cols, row_stride, row, blk, blk_rows);
+      n_kept += n_row;
+      n_stored += ROUND_UP(n_row, 2);
+    }
+    values_size = n_stored * blk_rows * BLK_COLS;
+    if(index_type == XA_NNLIB_SPARSE_INDEX_CSR)
+    {
+      index_size = n_kept * sizeof(UWORD16);
+      row_ptr_size = ((rows + blk_rows - 1) / blk_rows + 1) * sizeof(WORD32);
+    }
+    else
+    {
+      index_size = ((rows + blk_rows - 1) / blk_rows) * ((n_blk_cols + 7) / 8);
+    }
+  }
+
+  p_hdr->format = format;
+  p_hdr->index_type = index_type;
+  p_hdr->rows = rows;
+  p_hdr->cols = cols;
+  p_hdr->values_offset = ALIGNED_SIZE(sizeof(sparse_hdr_t));
+  p_hdr->index_offset = p_hdr->values_offset + ALIGNED_SIZE(values_size);
+  p_hdr->row_ptr_offset = p_hdr->index_offset + ALIGNED_SIZE(index_size);
+  p_hdr->row_sum_offset = p_hdr->row_ptr_offset + ALIGNED_SIZE(row_ptr_size);
+
+  return p_hdr->row_sum_offset + ALIGNED_SIZE(rows * sizeof(WORD32));
+}
+
+static WORD32 check_sparse_args(
+    const WORD8 *p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 format,
+    WORD32 index_type)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+  XA_NNLIB_ARG_CHK_COND((format != XA_NNLIB_SPARSE_2_4 && format != XA_NNLIB_SPARSE_BLOCK_1X4 &&
+                         format != XA_NNLIB_SPARSE_BLOCK_4X4), -1);
+  XA_NNLIB_ARG_CHK_COND((index_type != XA_NNLIB_SPARSE_INDEX_BITMASK && index_type != XA_NNLIB_SPARSE_INDEX_CSR), -1);
+  /* CSR column block indices are 16 bit */
+  XA_NNLIB_ARG_CHK_COND((cols > 65536 * BLK_COLS), -1);
+
+  return 0;
+}
+
+WORD32 xa_nn_get_sparse_weights_size_8(
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 format,
+    WORD32 index_type)
+{
+  sparse_hdr_t hdr;
+
+  if(check_sparse_args(p_mat, rows, cols, row_stride, format, index_type))
+    return -1;
+
+  return sparse_layout(&hdr, p_mat, rows, cols, row_stride, format, index_type);
+}
+
+static void pack_sparse_2_4(
+    WORD8 *p_values,
+    UWORD8 *p_meta,
+    const WORD8 *p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride)
+{
+  WORD32 n_chunks = (cols + SP24_COLS - 1) / SP24_COLS;
+  int row, g, ii;
+
+  for(row = 0; row < rows; row++)
+  {
+    const WORD8 *p_row = p_mat + row * row_stride;
+    for(g = 0; g < n_chunks * (SP24_COLS / 4); g++)
+    {
+      /* Nonzero positions first, then unused ones, in column order */
+      int idx[2], n_idx = 0;
+      for(ii = 0; ii < 4 && n_idx < 2; ii++)
+      {
+        if(4 * g + ii < cols && p_row[4 * g + ii] != 0)
+          idx[n_idx++] = ii;
+      }
+      for(ii = 0; ii < 4 && n_idx < 2; ii++)
+      {
+        if(!(4 * g + ii < cols && p_row[4 * g + ii] != 0) && (n_idx == 0 || idx[0] != ii))
+          idx[n_idx++] = ii;
+      }
+      if(idx[0] > idx[1])
+      {
+        int tmp = idx[0];
+        idx[0] = idx[1];
+        idx[1] = tmp;
+      }
+      for(ii = 0; ii < 2; ii++)
+      {
+        int c = 4 * g + idx[ii];
+        *p_values++ = (c < cols) ? p_row[c] : 0;
+      }
+      if(g & 1)
+        *p_meta++ |= (UWORD8)((idx[0] | (idx[1] << 2)) << 4);
+      else
+        *p_meta = (UWORD8)(idx[0] | (idx[1] << 2));
+    }
+  }
+}
+
+static void pack_sparse_blocks(
+    const sparse_hdr_t *p_hdr,
+    WORD8 *p_buf,
+    const WORD8 *p_mat,
+    WORD32 row_stride)
+{
+  WORD32 rows = p_hdr->rows, cols = p_hdr->cols;
+  WORD32 blk_rows = blk_rows_of(p_hdr->format);
+  WORD32 n_blk_cols = (cols + BLK_COLS - 1) / BLK_COLS;
+  WORD32 mask_bytes = (n_blk_cols + 7) / 8;
+  WORD8 *p_values = p_buf + p_hdr->values_offset;
+  UWORD8 *p_mask = (UWORD8 *)(p_buf + p_hdr->index_offset);
+  UWORD16 *p_idx = (UWORD16 *)(p_buf + p_hdr->index_offset);
+  WORD32 *p_row_ptr = (WORD32 *)(p_buf + p_hdr->row_ptr_offset);
+  WORD32 n_kept = 0;
+  int row, blk, r, c;
+
+  if(p_hdr->index_type == XA_NNLIB_SPARSE_INDEX_BITMASK)
+    memset(p_mask, 0, ((rows + blk_rows - 1) / blk_rows) * mask_bytes);
+
+  for(row = 0; row < rows; row += blk_rows)
+  {
+    WORD32 n_row = 0;
+    WORD32 pair[2];
+
+    if(p_hdr->index_type == XA_NNLIB_SPARSE_INDEX_CSR)
+      *p_row_ptr++ = n_kept;
+
+    for(blk = 0; blk <= n_blk_cols; blk++)
+    {
+      /* blk == n_blk_cols flushes an odd block with a zero one */
+      if(blk < n_blk_cols)
+      {
+        if(block_is_zero(p_mat, rows, cols, row_stride, row, blk, blk_rows))
+          continue;
+        if(p_hdr->index_type == XA_NNLIB_SPARSE_INDEX_CSR)
+          p_idx[n_kept] = (UWORD16)blk;
+        else
+          p_mask[(row / blk_rows) * mask_bytes + (blk >> 3)] |= (UWORD8)(1 << (blk & 7));
+        n_kept++;
+        pair[n_row++ & 1] = blk;
+        if(n_row & 1)
+          continue;
+      }
+      else if(n_row & 1)
+      {
+        pair[1] = -1;
+      }
+      else
+      {
+        break;
+      }
+
+      /* Row r of a pair is 4 values of the first block, then 4 of the second */
+      for(r = 0; r < blk_rows; r++)
+      {
+        for(c = 0; c < 2 * BLK_COLS; c++)
+        {
+          int b = pair[c / BLK_COLS];
+          int col = b * BLK_COLS + (c % BLK_COLS);
+          *p_values++ = (b >= 0 && row + r < rows && col < cols) ? p_mat[(row + r) * row_stride + col] : 0;
+        }
+      }
+    }
+  }
+  if(p_hdr->index_type == XA_NNLIB_SPARSE_INDEX_CSR)
+    *p_row_ptr = n_kept;
+}
+
+WORD32 xa_nn_pack_sparse_weights_8(
+    VOID * __restrict__ p_sparse,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 format,
+    WORD32 index_type)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_sparse, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_sparse, 16, -1);
+  /* Basic Parameter checks */
+  if(check_sparse_args(p_mat, rows, cols, row_stride, format, index_type))
+    return -1;
+
+  sparse_hdr_t *p_hdr = (sparse_hdr_t *)p_sparse;
+  WORD8 *p_buf = (WORD8 *)p_sparse;
+  WORD32 *p_row_sum;
+  int row, c;
+
+  if(sparse_layout(p_hdr, p_mat, rows, cols, row_stride, format, index_type) < 0)
+    return -1;
+
+  if(format == XA_NNLIB_SPARSE_2_4)
+  {
+    pack_sparse_2_4(p_buf + p_hdr->values_offset, (UWORD8 *)(p_buf + p_hdr->index_offset),
+        p_mat, rows, cols, row_stride);
+  }
+  else
+  {
+    pack_sparse_blocks(p_hdr, p_buf, p_mat, row_stride);
+  }
+
+  p_row_sum = (WORD32 *)(p_buf + p_hdr->row_sum_offset);
+  for(row = 0; row < rows; row++)
+  {
+    WORD32 sum = 0;
+    for(c = 0; c < cols; c++)
+      sum += p_mat[row * row_stride + c];
+    p_row_sum[row] = sum;
+  }
+
+  return 0;
+}
+
+/* Kept column blocks of a row (group), from a bitmask or CSR indices */
+typedef struct _blk_iter_t
+{
+  const UWORD8 *p_mask;
+  const UWORD16 *p_idx;
+  WORD32 n;         /* column blocks (bitmask) or kept blocks (CSR) */
+  WORD32 pos;
+} blk_iter_t;
+
+static inline void blk_iter_init(
+    blk_iter_t *p_it,
+    const sparse_hdr_t *p_hdr,
+    WORD32 grp)
+{
+  const WORD8 *p_buf = (const WORD8 *)p_hdr;
+  WORD32 n_blk_cols = (p_hdr->cols + BLK_COLS - 1) / BLK_COLS;
+
+  if(p_hdr->index_type == XA_NNLIB_SPARSE_INDEX_CSR)
+  {
+    const WORD32 *p_row_ptr = (const WORD32 *)(p_buf + p_hdr->row_ptr_offset);
+    p_it->p_mask = NULL;
+    p_it->p_idx = (const UWORD16 *)(p_buf + p_hdr->index_offset) + p_row_ptr[grp];
+    p_it->n = p_row_ptr[grp + 1] - p_row_ptr[grp];
+  }
+  else
+  {
+    p_it->p_mask = (const UWORD8 *)(p_buf + p_hdr->index_offset) + grp * ((n_blk_cols + 7) / 8);
+    p_it->p_idx = NULL;
+    p_it->n = n_blk_cols;
+  }
+  p_it->pos = 0;
+}
+
+/* Next kept column block, -1 at the end of the row (group) */
+static inline WORD32 blk_iter_next(blk_iter_t *p_it)
+{
+  if(p_it->p_mask == NULL)
+    return (p_it->pos < p_it->n) ? p_it->p_idx[p_it->pos++] : -1;
+
+  while(p_it->pos < p_it->n)
+  {
+    WORD32 b = p_it->pos;
+    UWORD8 bits = p_it->p_mask[b >> 3] >> (b & 7);
+    if(bits == 0)
+    {
+      p_it->pos = (b | 7) + 1;
+      continue;
+    }
+    p_it->pos++;
+    if(bits & 1)
+      return b;
+  }
+  return -1;
+}
+
+/* Vector elements of two column blocks; the last, partial block is read from
+   a zero padded copy */
+static inline ae_int8x8 gather_2_blocks(
+    const WORD8 *p_vec,
+    const WORD8 *p_vec_tail,
+    WORD32 tail_blk,
+    WORD32 blk0,
+    WORD32 blk1)
+{
+  ae_int8x8 vec_g;
+  WORD8 *p_g = (WORD8 *)&vec_g;
+
+  memcpy(p_g, (blk0 == tail_blk) ? p_vec_tail : p_vec + blk0 * BLK_COLS, BLK_COLS);
+  memcpy(p_g + BLK_COLS, (blk1 == tail_blk) ? p_vec_tail : p_vec + blk1 * BLK_COLS, BLK_COLS);
+
+  return AE_L8X8_I(&vec_g, 0);
+}
+
+/* Low 32 bits of the sum of an AE_MULAAAA2Q8 accumulator pair, as the
+   32-bit accumulation of the dense kernel */
+static inline WORD32 sum_q_32(ae_int64 q0, ae_int64 q1)
+{
+  return AE_MOVAD32_L(AE_MOVINT32X2_FROMINT64(AE_ADD64(q0, q1)));
+}
+
+static void dot_rows_2_4(
+    WORD32 *acc,
+    const sparse_hdr_t *p_hdr,
+    const WORD8 *p_vec,
+    WORD32 m_itr,
+    WORD32 nrows)
+{
+  const WORD8 *p_buf = (const WORD8 *)p_hdr;
+  WORD32 cols = p_hdr->cols;
+  WORD32 n_chunks = (cols + SP24_COLS - 1) / SP24_COLS;
+  const ae_int8x8 *p_mat_r[4];
+  const UWORD8 *p_meta_r[4];
+  ae_int64 q0[4], q1[4];
+  ae_int8x16 vec_tail;
+  ae_int8x8 sel_buf;
+  WORD8 *p_sel = (WORD8 *)&sel_buf;
+  int rem_cols = cols & (SP24_COLS - 1);
+  int r, c_itr, ii;
+
+  /* Zero padded last chunk of the vector */
+  for(ii = 0; ii < SP24_COLS; ii++)
+    ((WORD8 *)&vec_tail)[ii] = (ii < rem_cols) ? p_vec[cols - rem_cols + ii] : 0;
+
+  for(r = 0; r < nrows; r++)
+  {
+    p_mat_r[r] = (const ae_int8x8 *)(p_buf + p_hdr->values_offset) + (m_itr + r) * n_chunks;
+    p_meta_r[r] = (const UWORD8 *)(p_buf + p_hdr->index_offset) + (m_itr + r) * n_chunks * SP24_META;
+    q0[r] = q1[r] = AE_ZERO64();
+  }
+
+  ae_int8x16 *p_vec_0 = (ae_int8x16 *)p_vec;
+  ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+  ae_int8x8 vec_0, vec_1, vec_g, mat_0;
+
+  /* The 16 vector elements of a chunk are loaded once for the rows */
+  for(c_itr = 0; c_itr < n_chunks; c_itr++)
+  {
+    if(c_itr < (cols >> 4))
+    {
+      AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec_0, p_vec_0);
+    }
+    else
+    {
+      AE_L8X8X2_I(vec_0, vec_1, &vec_tail, 0);
+    }
+
+    for(r = 0; r < nrows; r++)
+    {
+      const UWORD8 *p_meta = p_meta_r[r] + c_itr * SP24_META;
+      memcpy(p_sel, sel_2_4[0][p_meta[0] & 0xf], 2);
+      memcpy(p_sel + 2, sel_2_4[1][p_meta[0] >> 4], 2);
+      memcpy(p_sel + 4, sel_2_4[2][p_meta[1] & 0xf], 2);
+      memcpy(p_sel + 6, sel_2_4[3][p_meta[1] >> 4], 2);
+
+      vec_g = AE_SEL8X8(vec_0, vec_1, AE_L8X8_I(&sel_buf, 0));
+      AE_L8X8_IP(mat_0, p_mat_r[r], 8);
+      AE_MULAAAA2Q8(q0[r], q1[r], mat_0, vec_g);
+    }
+  }
+
+  for(r = 0; r < nrows; r++)
+    acc[r] = sum_q_32(q0[r], q1[r]);
+}
+
+static void dot_rows_1x4(
+    WORD32 *acc,
+    const sparse_hdr_t *p_hdr,
+    const ae_int8x8 **pp_mat,
+    const WORD8 *p_vec,
+    const WORD8 *p_vec_tail,
+    WORD32 tail_blk,
+    WORD32 m_itr,
+    WORD32 nrows)
+{
+  const ae_int8x8 *p_mat_0 = *pp_mat;
+  ae_int8x8 mat_0, vec_g;
+  blk_iter_t it;
+  int r;
+
+  for(r = 0; r < nrows; r++)
+  {
+    ae_int64 q0 = AE_ZERO64(), q1 = AE_ZERO64();
+    WORD32 blk0, blk1;
+
+    blk_iter_init(&it, p_hdr, m_itr + r);
+    while((blk0 = blk_iter_next(&it)) >= 0)
+    {
+      /* The zero block padding an odd row reuses the vector of the first */
+      blk1 = blk_iter_next(&it);
+      blk1 = (blk1 < 0) ? blk0 : blk1;
+
+      vec_g = gather_2_blocks(p_vec, p_vec_tail, tail_blk, blk0, blk1);
+      AE_L8X8_IP(mat_0, p_mat_0, 8);
+      AE_MULAAAA2Q8(q0, q1, mat_0, vec_g);
+    }
+    acc[r] = sum_q_32(q0, q1);
+  }
+  *pp_mat = p_mat_0;
+}
+
+static void dot_rows_4x4(
+    WORD32 *acc,
+    const sparse_hdr_t *p_hdr,
+    const ae_int8x8 **pp_mat,
+    const WORD8 *p_vec,
+    const WORD8 *p_vec_tail,
+    WORD32 tail_blk,
+    WORD32 m_itr)
+{
+  const ae_int8x8 *p_mat_0 = *pp_mat;
+  ae_int8x8 mat_row0, mat_row1, mat_row2, mat_row3, vec_g;
+  ae_int32x2 acc_row01 = ZERO32;
+  ae_int32x2 acc_row23 = ZERO32;
+  WORD32 blk0, blk1;
+  blk_iter_t it;
+
+  blk_iter_init(&it, p_hdr, m_itr / 4);
+  while((blk0 = blk_iter_next(&it)) >= 0)
+  {
+    blk1 = blk_iter_next(&it);
+    blk1 = (blk1 < 0) ? blk0 : blk1;
+
+    vec_g = gather_2_blocks(p_vec, p_vec_tail, tail_blk, blk0, blk1);
+    AE_L8X8_IP(mat_row0, p_mat_0, 8);
+    AE_L8X8_IP(mat_row1, p_mat_0, 8);
+    AE_L8X8_IP(mat_row2, p_mat_0, 8);
+    AE_L8X8_IP(mat_row3, p_mat_0, 8);
+    AE_MULA8Q8X8(acc_row01, acc_row23, mat_row0, mat_row1, mat_row2, mat_row3, vec_g);
+  }
+
+  acc[0] = AE_MOVAD32_H(acc_row01);
+  acc[1] = AE_MOVAD32_L(acc_row01);
+  acc[2] = AE_MOVAD32_H(acc_row23);
+  acc[3] = AE_MOVAD32_L(acc_row23);
+  *pp_mat = p_mat_0;
+}
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_sparse(
+    WORD8 * __restrict__ p_out,
+    const VOID * __restrict__ p_sparse,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_sparse, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_sparse, 16, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_zero_bias < -127 || vec_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  const sparse_hdr_t *p_hdr = (const sparse_hdr_t *)p_sparse;
+  XA_NNLIB_ARG_CHK_COND((p_hdr->rows != rows || p_hdr->cols != cols), -1);
+  XA_NNLIB_ARG_CHK_COND((p_hdr->format != XA_NNLIB_SPARSE_2_4 && p_hdr->format != XA_NNLIB_SPARSE_BLOCK_1X4 &&
+                         p_hdr->format != XA_NNLIB_SPARSE_BLOCK_4X4), -1);
+
+  const WORD32 *p_row_sum = (const WORD32 *)((const WORD8 *)p_sparse + p_hdr->row_sum_offset);
+  const ae_int8x8 *p_mat_0 = (const ae_int8x8 *)((const WORD8 *)p_sparse + p_hdr->values_offset);
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+  WORD32 tail_blk = (cols & (BLK_COLS - 1)) ? (cols / BLK_COLS) : -1;
+  WORD8 vec_tail[BLK_COLS] = {0, 0, 0, 0};
+  WORD32 acc[4];
+  int m_itr, ii;
+
+  if(tail_blk >= 0)
+    memcpy(vec_tail, p_vec + tail_blk * BLK_COLS, cols & (BLK_COLS - 1));
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int nrows = (rows - m_itr) < 4 ? (rows - m_itr) : 4;
+
+    acc[0] = acc[1] = acc[2] = acc[3] = 0;
+    if(p_hdr->format == XA_NNLIB_SPARSE_2_4)
+      dot_rows_2_4(acc, p_hdr, p_vec, m_itr, nrows);
+    else if(p_hdr->format == XA_NNLIB_SPARSE_BLOCK_1X4)
+      dot_rows_1x4(acc, p_hdr, &p_mat_0, p_vec, vec_tail, tail_blk, m_itr, nrows);
+    else
+      dot_rows_4x4(acc, p_hdr, &p_mat_0, p_vec, vec_tail, tail_blk, m_itr);
+
+    /* Bias and the vector zero bias term */
+    for(ii = 0; ii < nrows; ii++)
+    {
+      acc[ii] += vec_zero_bias * p_row_sum[m_itr + ii];
+      if(p_bias)
+        acc[ii] += p_bias[m_itr + ii];
+    }
+
+    ae_int32x2 acc_row01 = AE_MOVDA32X2(acc[0], acc[1]);
+    ae_int32x2 acc_row23 = AE_MOVDA32X2(acc[2], acc[3]);
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row01, out_multiplier, left_shift, right_shift);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row23, out_multiplier, left_shift, right_shift);
+    acc_row01 = AE_ADD32S(acc_row01, out_zero_bias);
+    acc_row23 = AE_ADD32S(acc_row23, out_zero_bias);
+    AE_MINMAX32(acc_row01, min_int8, max_int8);
+    AE_MINMAX32(acc_row23, min_int8, max_int8);
+
+    p_out[m_itr] = (WORD8)AE_MOVAD32_H(acc_row01);
+    if(m_itr + 1 < rows) p_out[m_itr + 1] = (WORD8)AE_MOVAD32_L(acc_row01);
+    if(m_itr + 2 < rows) p_out[m_itr + 2] = (WORD8)AE_MOVAD32_H(acc_row23);
+    if(m_itr + 3 < rows) p_out[m_itr + 3] = (WORD8)AE_MOVAD32_L(acc_row23);
+  }
+
+  return 0;
+}
@@ -0,0 +1,456 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+******************************************************************************/
+/*
+ * 4-bit symmetric (sym4s) weights for the sym8sxasym8s matXvec, matmul and
+ * fully connected kernels.
+ *
+ * Weights are two's complement nibbles in -8..7, two per byte: column 2k in
+ * the low nibble and column 2k+1 in the high nibble, which is the TFLite
+ * int4 layout. row_stride counts weights, not bytes, and has to be even so
+ * every row starts on a byte. xa_nn_pack_weights_sym4s converts an 8-bit
+ * matrix that already holds 4-bit values into this layout.
+ *
+ * The kernels stream 8 bytes (16 weights) per row and unpack them in
+ * registers. Flipping the sign bit of every nibble turns w into the unsigned
+ * w + 8, so the low and high nibbles are one AND and one shift+AND away
+ * from an int8x8 of even and of odd columns. The vector is split into its
+ * even and odd columns to match, once per 16 columns for 4 rows, and the
+ * 8-way 8x16 bit MACs run unchanged. The + 8 on the weights adds
+ * 8 * sum(vec + vec_zero_bias) to every row, which is subtracted from the
+ * bias up front.
+ *
+ * xa_nn_matXvec_sym4sxasym8s_asym8s gives the same output as
+ * xa_nn_matXvec_sym8sxasym8s_asym8s on the unpacked weights.
+ * xa_nn_matmul_per_chan_sym4sxasym8s_asym8s applies the per channel
+ * requantization of the NHWC paths of
+ * xa_nn_matmul_per_chan_sym8sxasym8s_asym8s, as
+ * xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked does.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define SYM4S_COLS    16      /* weights per 8 byte load */
+#define SYM4S_ROWS    4
+#define VEC_GROUP     8       /* vectors per weight pass in the matmul */
+
+#define SYM4S_BYTES(cols) (((cols) + 1) >> 1)
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+/* 16 packed weights to w + 8 of the even (lo) and odd (hi) columns */
+#define UNPACK_SYM4S(lo, hi, packed) \
+{\
+  ae_int64 w64 = AE_XOR(AE_MOVINT64_FROMINT8X8(packed), nib_sign); \
+  lo = AE_MOVINT8X8_FROMINT64(AE_AND(w64, nib_mask)); \
+  hi = AE_MOVINT8X8_FROMINT64(AE_AND(AE_SRLI64(w64, 4), nib_mask)); \
+}
+
+static inline WORD8 sym4s_weight(const WORD8 *p_row, int col)
+{
+  WORD8 b = p_row[col >> 1];
+  return (col & 1) ? (WORD8)(b >> 4) : (WORD8)((WORD8)(b << 4) >> 4);
+}
+
+WORD32 xa_nn_pack_weights_sym4s(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride)
+{
+  int m_itr, c_itr;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_packed, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const WORD8 *p_row = p_mat + m_itr * row_stride;
+    for(c_itr = 0; c_itr < cols; c_itr++)
+    {
+      XA_NNLIB_ARG_CHK_COND((p_row[c_itr] < -8 || p_row[c_itr] > 7), -1);
+    }
+  }
+
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    const WORD8 *p_row = p_mat + m_itr * row_stride;
+    for(c_itr = 0; c_itr < cols; c_itr += 2)
+    {
+      WORD32 hi = (c_itr + 1) < cols ? p_row[c_itr + 1] : 0;
+      *p_packed++ = (WORD8)((p_row[c_itr] & 0xf) | ((hi & 0xf) << 4));
+    }
+  }
+
+  return 0;
+}
+
+/* 8 * sum(vec + vec_zero_bias), the offset the unsigned nibbles add to every
+   row */
+static inline WORD32 sym4s_vec_offset(
+    const WORD8 *p_vec,
+    WORD32 cols,
+    WORD32 vec_zero_bias)
+{
+  WORD32 sum = 0;
+  int c_itr;
+
+  for(c_itr = 0; c_itr < cols; c_itr++)
+    sum += p_vec[c_itr];
+
+  return 8 * (sum + cols * vec_zero_bias);
+}
+
+/* Accumulates 4 rows of sym4s weights times (vec + vec_zero_bias) into
+   acc_row01/acc_row23, with the weights offset by 8. Row pointers can
+   repeat for the rows past the end of the matrix. */
+static inline void dot_4_rows_sym4s(
+    ae_int32x2 *p_acc_row01,
+    ae_int32x2 *p_acc_row23,
+    const WORD8 *p_row_0,
+    const WORD8 *p_row_1,
+    const WORD8 *p_row_2,
+    const WORD8 *p_row_3,
+    const WORD8 *p_vec,
+    WORD32 cols,
+    WORD32 vec_zero_bias)
+{
+  ae_int32x2 acc_row01 = *p_acc_row01;
+  ae_int32x2 acc_row23 = *p_acc_row23;
+  ae_int64 nib_sign = AE_MOVINT64_FROMINT8X8(AE_MOVDA8(0x88));
+  ae_int64 nib_mask = AE_MOVINT64_FROMINT8X8(AE_MOVDA8(0x0f));
+  ae_int8x8 neg_vec_bias = AE_MOVDA8((WORD8)-vec_zero_bias);
+  ae_int8x8 vec_0, vec_1, vec_even, vec_odd;
+  ae_int16x4 wvec_even_0, wvec_even_1, wvec_odd_0, wvec_odd_1;
+  ae_int8x8 mat_0, mat_1, mat_2, mat_3;
+  ae_int8x8 mat_0_lo, mat_1_lo, mat_2_lo, mat_3_lo;
+  ae_int8x8 mat_0_hi, mat_1_hi, mat_2_hi, mat_3_hi;
+  int c_itr;
+
+  ae_valign align_p_row_0 = AE_LA64_PP(p_row_0);
+  ae_valign align_p_row_1 = AE_LA64_PP(p_row_1);
+  ae_valign align_p_row_2 = AE_LA64_PP(p_row_2);
+  ae_valign align_p_row_3 = AE_LA64_PP(p_row_3);
+  ae_valignx2 align_p_vec = AE_LA128_PP(p_vec);
+
+  for(c_itr = 0; c_itr < (cols & ~(SYM4S_COLS - 1)); c_itr += SYM4S_COLS)
+  {
+    AE_LA8X8X2_IP(vec_0, vec_1, align_p_vec, p_vec);
+    vec_even = AE_SEL8X8I(vec_0, vec_1, 26);
+    vec_odd = AE_SEL8X8I(vec_0, vec_1, 25);
+    AE_SUBW8(wvec_even_0, wvec_even_1, vec_even, neg_vec_bias);
+    AE_SUBW8(wvec_odd_0, wvec_odd_1, vec_odd, neg_vec_bias);
+
+    AE_LA8X8_IP(mat_0, align_p_row_0, p_row_0);
+    AE_LA8X8_IP(mat_1, align_p_row_1, p_row_1);
+    AE_LA8X8_IP(mat_2, align_p_row_2, p_row_2);
+    AE_LA8X8_IP(mat_3, align_p_row_3, p_row_3);
+
+    UNPACK_SYM4S(mat_0_lo, mat_0_hi, mat_0);
+    UNPACK_SYM4S(mat_1_lo, mat_1_hi, mat_1);
+    UNPACK_SYM4S(mat_2_lo, mat_2_hi, mat_2);
+    UNPACK_SYM4S(mat_3_lo, mat_3_hi, mat_3);
+
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_lo, mat_1_lo, mat_2_lo, mat_3_lo, wvec_even_0, wvec_even_1);
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_hi, mat_1_hi, mat_2_hi, mat_3_hi, wvec_odd_0, wvec_odd_1);
+  }
+
+  /* Column tail: the vector is padded with -vec_zero_bias so the padding
+     multiplies to zero whatever the weight bytes past the row hold */
+  if(c_itr < cols)
+  {
+    int rem_cols = cols - c_itr;
+    int rem_bytes = SYM4S_BYTES(rem_cols);
+    ae_int8x8 vec_tail[2];
+    ae_int8x8 mat_tail[SYM4S_ROWS];
+
+    memset(vec_tail, (WORD8)-vec_zero_bias, sizeof(vec_tail));
+    memcpy(vec_tail, p_vec, rem_cols);
+    memset(mat_tail, 0, sizeof(mat_tail));
+    memcpy(&mat_tail[0], p_row_0, rem_bytes);
+    memcpy(&mat_tail[1], p_row_1, rem_bytes);
+    memcpy(&mat_tail[2], p_row_2, rem_bytes);
+    memcpy(&mat_tail[3], p_row_3, rem_bytes);
+
+    vec_0 = AE_L8X8_I(vec_tail, 0);
+    vec_1 = AE_L8X8_I(vec_tail, 8);
+    vec_even = AE_SEL8X8I(vec_0, vec_1, 26);
+    vec_odd = AE_SEL8X8I(vec_0, vec_1, 25);
+    AE_SUBW8(wvec_even_0, wvec_even_1, vec_even, neg_vec_bias);
+    AE_SUBW8(wvec_odd_0, wvec_odd_1, vec_odd, neg_vec_bias);
+
+    UNPACK_SYM4S(mat_0_lo, mat_0_hi, AE_L8X8_I(mat_tail, 0));
+    UNPACK_SYM4S(mat_1_lo, mat_1_hi, AE_L8X8_I(mat_tail, 8));
+    UNPACK_SYM4S(mat_2_lo, mat_2_hi, AE_L8X8_I(mat_tail, 16));
+    UNPACK_SYM4S(mat_3_lo, mat_3_hi, AE_L8X8_I(mat_tail, 24));
+
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_lo, mat_1_lo, mat_2_lo, mat_3_lo, wvec_even_0, wvec_even_1);
+    AE_MULA8Q8X16(acc_row01, acc_row23, mat_0_hi, mat_1_hi, mat_2_hi, mat_3_hi, wvec_odd_0, wvec_odd_1);
+  }
+
+  *p_acc_row01 = acc_row01;
+  *p_acc_row23 = acc_row23;
+}
+
+/* Accumulators for rows m_itr..m_itr+3 over one matrix/vector pair, the
+   weight offset already taken out */
+static inline void acc_4_rows_sym4s(
+    ae_int32x2 *p_acc_row01,
+    ae_int32x2 *p_acc_row23,
+    const WORD8 *p_mat,
+    const WORD8 *p_vec,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 vec_zero_bias,
+    WORD32 vec_offset_sum,
+    int m_itr)
+{
+  int row_bytes = row_stride >> 1;
+  int last = rows - 1;
+  const WORD8 *p_row_0 = p_mat + m_itr * row_bytes;
+  const WORD8 *p_row_1 = p_mat + XT_MIN(m_itr + 1, last) * row_bytes;
+  const WORD8 *p_row_2 = p_mat + XT_MIN(m_itr + 2, last) * row_bytes;
+  const WORD8 *p_row_3 = p_mat + XT_MIN(m_itr + 3, last) * row_bytes;
+
+  *p_acc_row01 = AE_SUB32(*p_acc_row01, AE_MOVDA32(vec_offset_sum));
+  *p_acc_row23 = AE_SUB32(*p_acc_row23, AE_MOVDA32(vec_offset_sum));
+
+  dot_4_rows_sym4s(p_acc_row01, p_acc_row23, p_row_0, p_row_1, p_row_2, p_row_3,
+      p_vec, cols, vec_zero_bias);
+}
+
+WORD32 xa_nn_matXvec_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 & 1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 & 1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec2_zero_bias < -127 || vec2_zero_bias > 128), -1);
+  }
+
+  int m_itr;
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+
+  WORD32 vec1_offset_sum = sym4s_vec_offset(p_vec1, cols1, vec1_zero_bias);
+  WORD32 vec2_offset_sum = p_mat2 ? sym4s_vec_offset(p_vec2, cols2, vec2_zero_bias) : 0;
+
+  for(m_itr = 0; m_itr < rows; m_itr += SYM4S_ROWS)
+  {
+    ae_int32x2 acc_row01 = ZERO32;
+    ae_int32x2 acc_row23 = ZERO32;
+
+    if(p_bias)
+    {
+      acc_row01 = AE_MOVDA32X2(p_bias[m_itr], p_bias[XT_MIN(m_itr + 1, rows - 1)]);
+      acc_row23 = AE_MOVDA32X2(p_bias[XT_MIN(m_itr + 2, rows - 1)], p_bias[XT_MIN(m_itr + 3, rows - 1)]);
+    }
+
+    acc_4_rows_sym4s(&acc_row01, &acc_row23, p_mat1, p_vec1, rows, cols1, row_stride1,
+        vec1_zero_bias, vec1_offset_sum, m_itr);
+    if(p_mat2)
+    {
+      acc_4_rows_sym4s(&acc_row01, &acc_row23, p_mat2, p_vec2, rows, cols2, row_stride2,
+          vec2_zero_bias, vec2_offset_sum, m_itr);
+    }
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row01, out_multiplier, left_shift, right_shift);
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_row23, out_multiplier, left_shift, right_shift);
+    acc_row01 = AE_ADD32S(acc_row01, out_zero_bias);
+    acc_row23 = AE_ADD32S(acc_row23, out_zero_bias);
+    AE_MINMAX32(acc_row01, min_int8, max_int8);
+    AE_MINMAX32(acc_row23, min_int8, max_int8);
+
+    p_out[m_itr] = (WORD8)AE_MOVAD32_H(acc_row01);
+    if(m_itr + 1 < rows) p_out[m_itr + 1] = (WORD8)AE_MOVAD32_L(acc_row01);
+    if(m_itr + 2 < rows) p_out[m_itr + 2] = (WORD8)AE_MOVAD32_H(acc_row23);
+    if(m_itr + 3 < rows) p_out[m_itr + 3] = (WORD8)AE_MOVAD32_L(acc_row23);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_per_chan_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 & 1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  int m_itr, vec_itr, ii;
+  for(m_itr = 0; m_itr < rows; m_itr++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[m_itr] < -31 || p_out_shift[m_itr] > 31), -1);
+  }
+
+  /* Vectors are taken VEC_GROUP at a time so their offsets are computed
+     once and the 4 weight rows stay in cache across the group */
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr += VEC_GROUP)
+  {
+    int vec_cnt = XT_MIN(VEC_GROUP, vec_count - vec_itr);
+    WORD32 p_vec_offset_sum[VEC_GROUP];
+
+    for(ii = 0; ii < vec_cnt; ii++)
+    {
+      p_vec_offset_sum[ii] = sym4s_vec_offset(p_vec1 + (vec_itr + ii) * vec_offset, cols1, vec1_zero_bias);
+    }
+
+    for(m_itr = 0; m_itr < rows; m_itr += SYM4S_ROWS)
+    {
+      WORD32 p_bias_4[4];
+      int p_left_mult[4], p_right_mult[4], p_out_mult[4];
+
+      /* Padding rows get a zero multiplier */
+      for(ii = 0; ii < SYM4S_ROWS; ii++)
+      {
+        int m = m_itr + ii;
+        int valid = m < rows;
+        int shift = valid ? p_out_shift[m] : 0;
+
+        p_bias_4[ii] = (valid && p_bias) ? p_bias[m] : 0;
+        p_left_mult[ii] = shift < 0 ? 1 : (1 << shift);
+        p_right_mult[ii] = shift > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + shift));
+        p_out_mult[ii] = valid ? -p_out_multiplier[m] : 0;
+      }
+
+      ae_int32x2 bias_01 = AE_MOVDA32X2(p_bias_4[0], p_bias_4[1]);
+      ae_int32x2 bias_23 = AE_MOVDA32X2(p_bias_4[2], p_bias_4[3]);
+
+      ae_int32x2 l_mult_23, l_mult_01, r_mult_23, r_mult_01;
+      ae_int32x2 out_multiplier_01, out_multiplier_23;
+      AE_L32X2X2_I(l_mult_01, l_mult_23, (ae_int32x4 *)p_left_mult, 0);
+      AE_L32X2X2_I(r_mult_01, r_mult_23, (ae_int32x4 *)p_right_mult, 0);
+      AE_L32X2X2_I(out_multiplier_01, out_multiplier_23, (ae_int32x4 *)p_out_mult, 0);
+
+      for(ii = 0; ii < vec_cnt; ii++)
+      {
+        const WORD8 *p_vec_0 = p_vec1 + (vec_itr + ii) * vec_offset;
+        WORD8 *p_dst = p_out + m_itr * out_stride + (vec_itr + ii) * out_offset;
+        ae_int32x2 acc_row01 = bias_01;
+        ae_int32x2 acc_row23 = bias_23;
+        ae_int16x4 out_0;
+
+        acc_4_rows_sym4s(&acc_row01, &acc_row23, p_mat1, p_vec_0, rows, cols1, row_stride1,
+            vec1_zero_bias, p_vec_offset_sum[ii], m_itr);
+
+        MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row01, acc_row23, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+
+        p_dst[0] = (WORD8)AE_MOVAD16_3(out_0);
+        if(m_itr + 1 < rows) p_dst[out_stride] = (WORD8)AE_MOVAD16_2(out_0);
+        if(m_itr + 2 < rows) p_dst[2 * out_stride] = (WORD8)AE_MOVAD16_1(out_0);
+        if(m_itr + 3 < rows) p_dst[3 * out_stride] = (WORD8)AE_MOVAD16_0(out_0);
+      }
+    }
+  }
+
+  return 0;
+}
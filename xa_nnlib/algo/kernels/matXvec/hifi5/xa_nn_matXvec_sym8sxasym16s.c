@@ -0,0 +1,289 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Per channel sym8s weights with 16 bit activations and outputs, the 16x8
+ * quantization mode of TFLite: out = requant(bias + sum(mat * (vec +
+ * vec1_zero_bias))) + out_zero_bias, saturated to 16 bits.
+ *
+ * A sum of 8 bit x 16 bit products overflows 32 bits after ~500 columns,
+ * so the products accumulate in 64 bits (AE_MULAAAA2Q16 on widened
+ * weights) and the bias is 64 bit. vec1_zero_bias is applied as
+ * vec1_zero_bias * sum(row), which keeps (vec + vec1_zero_bias) out of the
+ * 16 bit multiplier inputs. The requantization is TFLite's 64 bit
+ * MultiplyByQuantizedMultiplier: the multiplier is rounded to 16 bits and
+ * the product is shifted right by 15 - out_shift with rounding.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define TILE_ROWS  4
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_64(out, acc, multiplier, shift) \
+{ \
+  WORD64 reduced_mult = (multiplier) < 0x7FFF0000 ? (((multiplier) + (1 << 15)) >> 16) : 0x7FFF; \
+  WORD32 total_shift = 15 - (shift); \
+  out = (WORD32)(((WORD64)(acc) * reduced_mult + ((WORD64)1 << (total_shift - 1))) >> total_shift); \
+}
+
+/* Loads 8 weights of a row as two 16 bit quads */
+#define LOAD_ROW_8(w0, w1, align, p_row) \
+{ \
+  ae_int8x8 mat_8; \
+  AE_LA8X8_IP(mat_8, align, (ae_int8x8 *)p_row); \
+  AE_ADDW8(w0, w1, mat_8, AE_MOVDA8(0)); \
+}
+
+/* 64 bit dot products of 4 rows against 2 vectors, added to p_acc as
+   {vec 0 rows 0..3, vec 1 rows 0..3} */
+static inline void dot_4_rows_2_vecs(
+    ae_int64 *p_acc,
+    const WORD8 *p_row_0,
+    const WORD8 *p_row_1,
+    const WORD8 *p_row_2,
+    const WORD8 *p_row_3,
+    const WORD16 *p_vec_0,
+    const WORD16 *p_vec_1,
+    WORD32 cols)
+{
+  ae_int64 acc_0_0 = p_acc[0], acc_0_1 = p_acc[1], acc_0_2 = p_acc[2], acc_0_3 = p_acc[3];
+  ae_int64 acc_1_0 = p_acc[4], acc_1_1 = p_acc[5], acc_1_2 = p_acc[6], acc_1_3 = p_acc[7];
+  ae_int16x4 mat_0_0, mat_0_1, mat_1_0, mat_1_1, mat_2_0, mat_2_1, mat_3_0, mat_3_1;
+  ae_int16x4 vec_0_0, vec_0_1, vec_1_0, vec_1_1;
+  int c_itr;
+
+  ae_valign align_p_row_0 = AE_LA64_PP(p_row_0);
+  ae_valign align_p_row_1 = AE_LA64_PP(p_row_1);
+  ae_valign align_p_row_2 = AE_LA64_PP(p_row_2);
+  ae_valign align_p_row_3 = AE_LA64_PP(p_row_3);
+  ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+  ae_valignx2 align_p_vec_1 = AE_LA128_PP(p_vec_1);
+
+  for(c_itr = 0; c_itr < (cols & ~7); c_itr += 8)
+  {
+    AE_LA16X4X2_IP(vec_0_0, vec_0_1, align_p_vec_0, (ae_int16x8 *)p_vec_0);
+    AE_LA16X4X2_IP(vec_1_0, vec_1_1, align_p_vec_1, (ae_int16x8 *)p_vec_1);
+    LOAD_ROW_8(mat_0_0, mat_0_1, align_p_row_0, p_row_0);
+    LOAD_ROW_8(mat_1_0, mat_1_1, align_p_row_1, p_row_1);
+    LOAD_ROW_8(mat_2_0, mat_2_1, align_p_row_2, p_row_2);
+    LOAD_ROW_8(mat_3_0, mat_3_1, align_p_row_3, p_row_3);
+
+    AE_MULAAAA2Q16(acc_0_0, acc_0_1, mat_0_0, mat_1_0, vec_0_0, vec_0_0);
+    AE_MULAAAA2Q16(acc_0_2, acc_0_3, mat_2_0, mat_3_0, vec_0_0, vec_0_0);
+    AE_MULAAAA2Q16(acc_0_0, acc_0_1, mat_0_1, mat_1_1, vec_0_1, vec_0_1);
+    AE_MULAAAA2Q16(acc_0_2, acc_0_3, mat_2_1, mat_3_1, vec_0_1, vec_0_1);
+    AE_MULAAAA2Q16(acc_1_0, acc_1_1, mat_0_0, mat_1_0, vec_1_0, vec_1_0);
+    AE_MULAAAA2Q16(acc_1_2, acc_1_3, mat_2_0, mat_3_0, vec_1_0, vec_1_0);
+    AE_MULAAAA2Q16(acc_1_0, acc_1_1, mat_0_1, mat_1_1, vec_1_1, vec_1_1);
+    AE_MULAAAA2Q16(acc_1_2, acc_1_3, mat_2_1, mat_3_1, vec_1_1, vec_1_1);
+  }
+
+  /* Column tail: the matrix is zero padded */
+  if(c_itr < cols)
+  {
+    int rem_cols = cols - c_itr;
+    WORD16 vec_tail[2][8];
+    WORD8 mat_tail[TILE_ROWS][8];
+    const WORD16 *p_vec_tail;
+    const WORD8 *p_mat_tail;
+
+    memset(vec_tail, 0, sizeof(vec_tail));
+    memcpy(vec_tail[0], p_vec_0, rem_cols * sizeof(WORD16));
+    memcpy(vec_tail[1], p_vec_1, rem_cols * sizeof(WORD16));
+    memset(mat_tail, 0, sizeof(mat_tail));
+    memcpy(mat_tail[0], p_row_0, rem_cols);
+    memcpy(mat_tail[1], p_row_1, rem_cols);
+    memcpy(mat_tail[2], p_row_2, rem_cols);
+    memcpy(mat_tail[3], p_row_3, rem_cols);
+
+    p_vec_tail = &vec_tail[0][0];
+    align_p_vec_0 = AE_LA128_PP(p_vec_tail);
+    AE_LA16X4X2_IP(vec_0_0, vec_0_1, align_p_vec_0, (ae_int16x8 *)p_vec_tail);
+    AE_LA16X4X2_IP(vec_1_0, vec_1_1, align_p_vec_0, (ae_int16x8 *)p_vec_tail);
+    p_mat_tail = &mat_tail[0][0];
+    align_p_row_0 = AE_LA64_PP(p_mat_tail);
+    LOAD_ROW_8(mat_0_0, mat_0_1, align_p_row_0, p_mat_tail);
+    LOAD_ROW_8(mat_1_0, mat_1_1, align_p_row_0, p_mat_tail);
+    LOAD_ROW_8(mat_2_0, mat_2_1, align_p_row_0, p_mat_tail);
+    LOAD_ROW_8(mat_3_0, mat_3_1, align_p_row_0, p_mat_tail);
+
+    AE_MULAAAA2Q16(acc_0_0, acc_0_1, mat_0_0, mat_1_0, vec_0_0, vec_0_0);
+    AE_MULAAAA2Q16(acc_0_2, acc_0_3, mat_2_0, mat_3_0, vec_0_0, vec_0_0);
+    AE_MULAAAA2Q16(acc_0_0, acc_0_1, mat_0_1, mat_1_1, vec_0_1, vec_0_1);
+    AE_MULAAAA2Q16(acc_0_2, acc_0_3, mat_2_1, mat_3_1, vec_0_1, vec_0_1);
+    AE_MULAAAA2Q16(acc_1_0, acc_1_1, mat_0_0, mat_1_0, vec_1_0, vec_1_0);
+    AE_MULAAAA2Q16(acc_1_2, acc_1_3, mat_2_0, mat_3_0, vec_1_0, vec_1_0);
+    AE_MULAAAA2Q16(acc_1_0, acc_1_1, mat_0_1, mat_1_1, vec_1_1, vec_1_1);
+    AE_MULAAAA2Q16(acc_1_2, acc_1_3, mat_2_1, mat_3_1, vec_1_1, vec_1_1);
+  }
+
+  p_acc[0] = acc_0_0; p_acc[1] = acc_0_1; p_acc[2] = acc_0_2; p_acc[3] = acc_0_3;
+  p_acc[4] = acc_1_0; p_acc[5] = acc_1_1; p_acc[6] = acc_1_2; p_acc[7] = acc_1_3;
+}
+
+/* Sum of each of the 4 rows */
+static inline void sum_4_rows(
+    WORD64 *p_row_sum,
+    const WORD8 *p_row_0,
+    const WORD8 *p_row_1,
+    const WORD8 *p_row_2,
+    const WORD8 *p_row_3,
+    WORD32 cols)
+{
+  WORD16 ones[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+  ae_int64 acc[2 * TILE_ROWS];
+  int ii, c_itr;
+
+  for(ii = 0; ii < 2 * TILE_ROWS; ii++)
+    acc[ii] = ZERO64;
+  /* Vectors of 8 ones, shorter for the column tail */
+  for(c_itr = 0; c_itr < cols; c_itr += 8)
+  {
+    WORD32 n = XT_MIN(8, cols - c_itr);
+    dot_4_rows_2_vecs(acc, p_row_0 + c_itr, p_row_1 + c_itr, p_row_2 + c_itr, p_row_3 + c_itr, ones, ones, n);
+  }
+  for(ii = 0; ii < TILE_ROWS; ii++)
+    p_row_sum[ii] = acc[ii];
+}
+
+static inline void store_4_rows(
+    WORD16 *p_dst,
+    WORD32 out_stride,
+    const ae_int64 *p_acc,
+    const WORD64 *p_row_off,
+    const WORD32 *p_out_multiplier,
+    const WORD32 *p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 nrows)
+{
+  ae_int32x2 max_int16 = AE_MOVDA32(32767);
+  ae_int32x2 min_int16 = AE_MOVDA32(-32768);
+  int ii;
+
+  for(ii = 0; ii < nrows; ii++)
+  {
+    WORD32 out;
+    ae_int32x2 out32;
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_64(out, (WORD64)p_acc[ii] + p_row_off[ii], p_out_multiplier[ii], p_out_shift[ii]);
+    out32 = AE_ADD32S(AE_MOVDA32(out), AE_MOVDA32(out_zero_bias));
+    AE_MINMAX32(out32, min_int16, max_int16);
+    p_dst[ii * out_stride] = (WORD16)AE_MOVAD32_L(out32);
+  }
+}
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym16s_asym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD64 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD64), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -32767 || vec1_zero_bias > 32768), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -32768 || out_zero_bias > 32767), -1);
+
+  int m_itr, vec_itr, ii, last = rows - 1;
+
+  /* 15 - out_shift is the rounding shift of the requantization */
+  for(ii = 0; ii < rows; ii++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[ii] < -31 || p_out_shift[ii] > 14), -1);
+  }
+
+  for(m_itr = 0; m_itr < rows; m_itr += TILE_ROWS)
+  {
+    int nrows = XT_MIN(TILE_ROWS, rows - m_itr);
+    const WORD8 *p_row_0 = p_mat1 + m_itr * row_stride1;
+    const WORD8 *p_row_1 = p_mat1 + XT_MIN(m_itr + 1, last) * row_stride1;
+    const WORD8 *p_row_2 = p_mat1 + XT_MIN(m_itr + 2, last) * row_stride1;
+    const WORD8 *p_row_3 = p_mat1 + XT_MIN(m_itr + 3, last) * row_stride1;
+    WORD64 row_off[TILE_ROWS];
+
+    /* Bias and vec1_zero_bias * sum(row), shared by all the vectors */
+    if(vec1_zero_bias != 0)
+    {
+      sum_4_rows(row_off, p_row_0, p_row_1, p_row_2, p_row_3, cols1);
+      for(ii = 0; ii < TILE_ROWS; ii++)
+        row_off[ii] *= vec1_zero_bias;
+    }
+    else
+    {
+      for(ii = 0; ii < TILE_ROWS; ii++)
+        row_off[ii] = 0;
+    }
+    if(p_bias != NULL)
+    {
+      for(ii = 0; ii < nrows; ii++)
+        row_off[ii] += p_bias[m_itr + ii];
+    }
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr += 2)
+    {
+      /* An odd last vector is computed twice */
+      int vec_itr_1 = XT_MIN(vec_itr + 1, vec_count - 1);
+      WORD16 *p_dst = p_out + m_itr * out_stride;
+      ae_int64 acc[2 * TILE_ROWS];
+
+      for(ii = 0; ii < 2 * TILE_ROWS; ii++)
+        acc[ii] = ZERO64;
+      dot_4_rows_2_vecs(acc, p_row_0, p_row_1, p_row_2, p_row_3,
+          p_vec1 + vec_itr * vec_offset, p_vec1 + vec_itr_1 * vec_offset, cols1);
+
+      store_4_rows(p_dst + vec_itr * out_offset, out_stride, &acc[0], row_off,
+          p_out_multiplier + m_itr, p_out_shift + m_itr, out_zero_bias, nrows);
+      if(vec_itr_1 != vec_itr)
+        store_4_rows(p_dst + vec_itr_1 * out_offset, out_stride, &acc[TILE_ROWS], row_off,
+            p_out_multiplier + m_itr, p_out_shift + m_itr, out_zero_bias, nrows);
+    }
+  }
+
+  return 0;
+}
@@ -22,6 +22,10 @@
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
 
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
 #define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
     inp = AE_SLAA32(inp, left_shift); \
     inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
@@ -359,7 +363,7 @@ static inline void _xa_nn_dot_product_4_rows_1_vecs_offset_aligned
   int pre_loop_count, loop_count, post_loop_count;
   int c_itr;
 
-  int align_offset = ((unsigned int)p_mat1_0 & 0xf);
+  int align_offset = ((uintptr_t)p_mat1_0 & 0xf);
   pre_loop_count = 16 - align_offset;
   int pre_rem_g8 = (align_offset > 8)?1:0;
   ae_int8x8 pre_sel1 = AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(pre_loop_sel_pattern[2 * (align_offset % 8) * !pre_rem_g8], pre_loop_sel_pattern[2 * (align_offset % 8) * !pre_rem_g8 + 1])); 
@@ -718,6 +722,15 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
     XA_NNLIB_ARG_CHK_COND((vec2_zero_bias < -127 || vec2_zero_bias > 128), -1);
   }
 
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matXvec_sym8sxasym8s_asym8s_host(p_out, p_mat1, p_mat2, p_vec1, p_vec2, p_bias, rows, cols1, cols2,
+      row_stride1, row_stride2, vec1_zero_bias, vec2_zero_bias, out_multiplier,
+      out_shift, out_zero_bias) == 0)
+  {
+    return 0;
+  }
+#endif
+
   /* Iterators used in for loops */
   int m_itr, ii;
   /* Assign initial value so this value will be used in trailing loop */
@@ -743,8 +756,8 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
   ae_int32x2 max_int8 = AE_MOVDA32(127);
   ae_int32x2 min_int8 = AE_MOVDA32(-128);
   
-  if(p_mat2 && p_vec2 && ((((unsigned)p_out) & 15) == 0) && ((((unsigned)p_mat1) & 15) == 0) && ((((unsigned)p_mat2) & 15) == 0) &&
-     ((((unsigned)p_vec1) & 15) == 0) && ((((unsigned)p_vec2) & 15) == 0) && ((((unsigned)p_bias) & 15) == 0) &&
+  if(p_mat2 && p_vec2 && ((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_mat1) & 15) == 0) && ((((uintptr_t)p_mat2) & 15) == 0) &&
+     ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_vec2) & 15) == 0) && ((((uintptr_t)p_bias) & 15) == 0) &&
      ((row_stride1 & 15) == 0) && ((row_stride2 & 15) == 0))
   {
     for(m_itr = 0; m_itr < (rows & ~(8 - 1)); m_itr += 8)
@@ -965,8 +978,8 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
     }
   }
 
-  else if(((((unsigned)p_out) & 15) == 0) && ((((unsigned)p_mat1) & 15) == 0) &&
-    ((((unsigned)p_vec1) & 15) == 0) && ((((unsigned)p_bias) & 15) == 0) &&
+  else if(((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_mat1) & 15) == 0) &&
+    ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_bias) & 15) == 0) &&
     ((row_stride1 & 15) == 0))
   {
     for(m_itr = 0; m_itr < (rows & ~(8 - 1)); m_itr += 8)
@@ -1057,7 +1070,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
     }
   }
 
-  else if((cols1 == 64) && (row_stride1 == 64) && ((rows & 0x3) == 0) && p_mat1 && p_vec1 && ((((unsigned)p_out) & 3) == 0))
+  else if((cols1 == 64) && (row_stride1 == 64) && ((rows & 0x3) == 0) && p_mat1 && p_vec1 && ((((uintptr_t)p_out) & 3) == 0))
   {
     special_function_for_cols_mul_32_unaligned
       (p_out,
@@ -1253,7 +1266,7 @@ WORD32 xa_nn_matXvec_out_stride_sym8sxasym8s_16(
   ae_int32x2 max_int16 = AE_MOVDA32(0x7fff);
   ae_int32x2 min_int16 = AE_MOVDA32(0xffff8000L);
 
-  if(((((unsigned)p_vec1) & 15) == 0) && ((row_stride1 & 15) == 0) && ((rows&3) == 0) && ((cols1 & 15) == 0))
+  if(((((uintptr_t)p_vec1) & 15) == 0) && ((row_stride1 & 15) == 0) && ((rows&3) == 0) && ((cols1 & 15) == 0))
   {
     ae_valignx2 align_bias;
     if(bias_flag)
@@ -1297,8 +1310,8 @@ WORD32 xa_nn_matXvec_out_stride_sym8sxasym8s_16(
       AE_S16_0_XP(out16_1, (ae_int16 *) p_out, out_stride_by_2);
     }
   }
-  else if(((((unsigned)p_out) & 15) == 0) && ((((unsigned)p_mat1) & 15) == 0) &&
-      ((((unsigned)p_vec1) & 15) == 0) && ((((unsigned)p_bias) & 15) == 0) &&
+  else if(((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_mat1) & 15) == 0) &&
+      ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_bias) & 15) == 0) &&
       ((row_stride1 & 15) == 0))
   {
     for(m_itr = 0; m_itr < (rows & ~(8 - 1)); m_itr += 8)
@@ -0,0 +1,758 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Transposed-weight matXvec/matmul.
+ *
+ * The _t and _tn kernels take mat1 stored transposed, as cols1 rows of
+ * `rows` elements each, row_stride1 >= rows apart, and compute
+ *   out[m] = sum_k mat1[k][m] * vec1[k]
+ * so weights kept in K x N order need no transpose copy. Every step loads a
+ * run of consecutive outputs of one stored row with a wide load:
+ *  - 16x16 and 8x16 transpose 4x4 blocks of 16 bit weights in registers and
+ *    reduce them with AE_MULAAAAQ16 into 64 bit accumulators, so the output
+ *    is that of xa_nn_matXvec_16x16_16 / xa_nn_matXvec_8x16_16 on the
+ *    untransposed matrix.
+ *  - sym8sxasym8s multiplies 16 consecutive weights by the broadcast
+ *    vec1[k] + vec1_zero_bias into 32 bit accumulators. The requantization
+ *    is that of xa_nn_matXvec_sym8sxasym8s_asym8s (per tensor) and of
+ *    xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked (per channel).
+ *
+ * The _nt matmuls take mat1 as rows x cols and mat2 as vec_count rows of
+ * cols (out = mat1 * mat2^T, e.g. Q * K^T). This is the layout of the
+ * existing matmul kernels; xa_nn_matmul_nt_per_chan_sym8sxasym8s_asym8s is
+ * xa_nn_matmul_per_chan_sym8sxasym8s_asym8s under that name.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define T_COLS_16     8
+#define T_COLS_8      16
+#define NT_ROWS       4
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+/* c_j = {r0[j], r1[j], r2[j], r3[j]} */
+#define TRANSPOSE_4X4_16(c0, c1, c2, c3, r0, r1, r2, r3) \
+{\
+  ae_int16x4 t0_, t1_, t2_, t3_; \
+  t0_ = AE_SEL16_7531(r0, r1); \
+  t1_ = AE_SEL16_6420(r0, r1); \
+  t2_ = AE_SEL16_7531(r2, r3); \
+  t3_ = AE_SEL16_6420(r2, r3); \
+  c0 = AE_SEL16_7531(t0_, t2_); \
+  c1 = AE_SEL16_7531(t1_, t3_); \
+  c2 = AE_SEL16_6420(t0_, t2_); \
+  c3 = AE_SEL16_6420(t1_, t3_); \
+}
+
+/* Load the first ncols (1..8) elements of a row as 16 bit, zero padded */
+static inline void load_cols_16(ae_int16x4 *p_d0, ae_int16x4 *p_d1, const WORD16 *p_row, WORD32 ncols)
+{
+  if(ncols == 8)
+  {
+    ae_int16x8 *p_r = (ae_int16x8 *)p_row;
+    ae_valignx2 align_r = AE_LA128_PP(p_r);
+    AE_LA16X4X2_IP(*p_d0, *p_d1, align_r, p_r);
+  }
+  else
+  {
+    ae_int16x4 row_tail[2];
+
+    memset(row_tail, 0, sizeof(row_tail));
+    memcpy(row_tail, p_row, ncols * sizeof(WORD16));
+    AE_L16X4X2_I(*p_d0, *p_d1, (ae_int16x8 *)row_tail, 0);
+  }
+}
+
+static inline void load_cols_8(ae_int16x4 *p_d0, ae_int16x4 *p_d1, const WORD8 *p_row, WORD32 ncols)
+{
+  ae_int8x8 mat;
+
+  if(ncols == 8)
+  {
+    ae_int8x8 *p_r = (ae_int8x8 *)p_row;
+    ae_valign align_r = AE_LA64_PP(p_r);
+    AE_LA8X8_IP(mat, align_r, p_r);
+  }
+  else
+  {
+    ae_int8x8 row_tail;
+
+    memset(&row_tail, 0, sizeof(row_tail));
+    memcpy(&row_tail, p_row, ncols);
+    mat = AE_L8X8_I(&row_tail, 0);
+  }
+  AE_ADDW8(*p_d0, *p_d1, mat, AE_MOVDA8(0));
+}
+
+/* Loads vec[0..n) into a quad, zero padded */
+static inline ae_int16x4 load_vec_tail_16(const WORD16 *p_vec, WORD32 n)
+{
+  ae_int16x4 vec_tail;
+
+  memset(&vec_tail, 0, sizeof(vec_tail));
+  memcpy(&vec_tail, p_vec, n * sizeof(WORD16));
+  return AE_L16X4_I(&vec_tail, 0);
+}
+
+#define MULA_T_8COLS(r00, r01, r10, r11, r20, r21, r30, r31, vq) \
+{\
+  ae_int16x4 c0, c1, c2, c3, c4, c5, c6, c7; \
+  TRANSPOSE_4X4_16(c0, c1, c2, c3, r00, r10, r20, r30); \
+  TRANSPOSE_4X4_16(c4, c5, c6, c7, r01, r11, r21, r31); \
+  AE_MULAAAAQ16(acc0, c0, vq); \
+  AE_MULAAAAQ16(acc1, c1, vq); \
+  AE_MULAAAAQ16(acc2, c2, vq); \
+  AE_MULAAAAQ16(acc3, c3, vq); \
+  AE_MULAAAAQ16(acc4, c4, vq); \
+  AE_MULAAAAQ16(acc5, c5, vq); \
+  AE_MULAAAAQ16(acc6, c6, vq); \
+  AE_MULAAAAQ16(acc7, c7, vq); \
+}
+
+/* Adds sum_k p_mat[k][j] * p_vec[k] to p_acc[j] for j < ncols. The stored
+   rows past cols in the last step are clamped to the last one and meet a
+   zero vector element. TYPE is WORD16 or WORD8, LOAD its row loader. */
+#define DEFINE_DOT_T_8COLS(name, TYPE, LOAD) \
+static void name( \
+    ae_int64 *p_acc, \
+    const TYPE *p_mat, \
+    WORD32 row_stride, \
+    WORD32 cols, \
+    const WORD16 *p_vec, \
+    WORD32 ncols) \
+{ \
+  ae_int64 acc0 = p_acc[0], acc1 = p_acc[1], acc2 = p_acc[2], acc3 = p_acc[3]; \
+  ae_int64 acc4 = p_acc[4], acc5 = p_acc[5], acc6 = p_acc[6], acc7 = p_acc[7]; \
+  ae_int16x4 r00, r01, r10, r11, r20, r21, r30, r31, vq; \
+  ae_int16x4 *p_v = (ae_int16x4 *)p_vec; \
+  ae_valign align_v = AE_LA64_PP(p_v); \
+  int k; \
+ \
+  for(k = 0; k < (cols & ~3); k += 4) \
+  { \
+    const TYPE *p_row = p_mat + k * row_stride; \
+    LOAD(&r00, &r01, p_row, ncols); \
+    LOAD(&r10, &r11, p_row + row_stride, ncols); \
+    LOAD(&r20, &r21, p_row + 2 * row_stride, ncols); \
+    LOAD(&r30, &r31, p_row + 3 * row_stride, ncols); \
+    AE_LA16X4_IP(vq, align_v, p_v); \
+    MULA_T_8COLS(r00, r01, r10, r11, r20, r21, r30, r31, vq); \
+  } \
+ \
+  if(k < cols) \
+  { \
+    int rem = cols - k; \
+    const TYPE *p_row = p_mat + k * row_stride; \
+    LOAD(&r00, &r01, p_row, ncols); \
+    LOAD(&r10, &r11, p_row + (rem > 1 ? row_stride : 0), ncols); \
+    LOAD(&r20, &r21, p_row + (rem > 2 ? 2 * row_stride : 0), ncols); \
+    LOAD(&r30, &r31, p_row, ncols); \
+    vq = load_vec_tail_16(p_vec + k, rem); \
+    MULA_T_8COLS(r00, r01, r10, r11, r20, r21, r30, r31, vq); \
+  } \
+ \
+  p_acc[0] = acc0; p_acc[1] = acc1; p_acc[2] = acc2; p_acc[3] = acc3; \
+  p_acc[4] = acc4; p_acc[5] = acc5; p_acc[6] = acc6; p_acc[7] = acc7; \
+}
+
+DEFINE_DOT_T_8COLS(dot_t_16x16_8cols, WORD16, load_cols_16)
+DEFINE_DOT_T_8COLS(dot_t_8x16_8cols, WORD8, load_cols_8)
+
+/* Rounds ncols 64 bit accumulators to 16 bit as xa_nn_matXvec_16x16_16 */
+static inline void store_acc64_16(WORD16 *p_out, WORD32 out_stride, ae_int64 *p_acc, WORD32 ncols, WORD32 acc_shift)
+{
+  int j;
+
+  for(j = 0; j < ncols; j += 4)
+  {
+    ae_int64 acc0 = AE_SLAA64S(p_acc[j + 0], acc_shift);
+    ae_int64 acc1 = AE_SLAA64S(p_acc[j + 1], acc_shift);
+    ae_int64 acc2 = AE_SLAA64S(p_acc[j + 2], acc_shift);
+    ae_int64 acc3 = AE_SLAA64S(p_acc[j + 3], acc_shift);
+    ae_int16x4 out_16 = AE_SAT16X4(AE_ROUND32X2F64SSYM(acc0, acc1), AE_ROUND32X2F64SSYM(acc2, acc3));
+    WORD16 *p_dst = p_out + j * out_stride;
+
+    p_dst[0] = AE_MOVAD16_3(out_16);
+    if(j + 1 < ncols) p_dst[out_stride] = AE_MOVAD16_2(out_16);
+    if(j + 2 < ncols) p_dst[2 * out_stride] = AE_MOVAD16_1(out_16);
+    if(j + 3 < ncols) p_dst[3 * out_stride] = AE_MOVAD16_0(out_16);
+  }
+}
+
+#define DEFINE_MATMUL_T_16(name, TYPE, DOT) \
+static void name( \
+    WORD16 *p_out, \
+    const TYPE *p_mat1, \
+    const WORD16 *p_vec1, \
+    const WORD16 *p_bias, \
+    WORD32 rows, \
+    WORD32 cols1, \
+    WORD32 row_stride1, \
+    WORD32 acc_shift, \
+    WORD32 bias_shift, \
+    WORD32 vec_count, \
+    WORD32 vec_offset, \
+    WORD32 out_offset, \
+    WORD32 out_stride) \
+{ \
+  int m_itr, vec_itr, j; \
+ \
+  for(m_itr = 0; m_itr < rows; m_itr += T_COLS_16) \
+  { \
+    int ncols = XT_MIN(T_COLS_16, rows - m_itr); \
+ \
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++) \
+    { \
+      ae_int64 acc[T_COLS_16]; \
+ \
+      for(j = 0; j < T_COLS_16; j++) \
+        acc[j] = AE_SLAA64S(p_bias[m_itr + XT_MIN(j, ncols - 1)], bias_shift); \
+ \
+      DOT(acc, p_mat1 + m_itr, row_stride1, cols1, p_vec1 + vec_itr * vec_offset, ncols); \
+      store_acc64_16(p_out + m_itr * out_stride + vec_itr * out_offset, out_stride, acc, ncols, acc_shift); \
+    } \
+  } \
+}
+
+DEFINE_MATMUL_T_16(matmul_t_16x16_16, WORD16, dot_t_16x16_8cols)
+DEFINE_MATMUL_T_16(matmul_t_8x16_16, WORD8, dot_t_8x16_8cols)
+
+/* Adds sum_k p_mat[k][j] * (p_vec[k] + vec_zero_bias) to the 32 bit
+   accumulators of columns j < ncols (1..16), two per ae_int32x2 */
+static void dot_t_sym8s_16cols(
+    ae_int32x2 *p_acc,
+    const WORD8 *p_mat,
+    WORD32 row_stride,
+    WORD32 cols,
+    const WORD8 *p_vec,
+    WORD32 vec_zero_bias,
+    WORD32 ncols)
+{
+  ae_int32x2 acc01 = p_acc[0], acc23 = p_acc[1], acc45 = p_acc[2], acc67 = p_acc[3];
+  ae_int32x2 acc89 = p_acc[4], acc1011 = p_acc[5], acc1213 = p_acc[6], acc1415 = p_acc[7];
+  ae_int8x8 zero_8 = AE_MOVDA8(0);
+  ae_int8x8 mat_0, mat_1;
+  ae_int16x4 wmat_0, wmat_1, wmat_2, wmat_3, wvec;
+  int k;
+
+  for(k = 0; k < cols; k++)
+  {
+    const WORD8 *p_row = p_mat + k * row_stride;
+
+    if(ncols == T_COLS_8)
+    {
+      ae_int8x16 *p_r = (ae_int8x16 *)p_row;
+      ae_valignx2 align_r = AE_LA128_PP(p_r);
+      AE_LA8X8X2_IP(mat_0, mat_1, align_r, p_r);
+    }
+    else
+    {
+      ae_int8x8 row_tail[2];
+
+      memset(row_tail, 0, sizeof(row_tail));
+      memcpy(row_tail, p_row, ncols);
+      AE_L8X8X2_I(mat_0, mat_1, (ae_int8x16 *)row_tail, 0);
+    }
+
+    wvec = AE_MOVDA16(p_vec[k] + vec_zero_bias);
+    AE_ADDW8(wmat_0, wmat_1, mat_0, zero_8);
+    AE_ADDW8(wmat_2, wmat_3, mat_1, zero_8);
+
+    AE_MULA16X4(acc01, acc23, wmat_0, wvec);
+    AE_MULA16X4(acc45, acc67, wmat_1, wvec);
+    AE_MULA16X4(acc89, acc1011, wmat_2, wvec);
+    AE_MULA16X4(acc1213, acc1415, wmat_3, wvec);
+  }
+
+  p_acc[0] = acc01; p_acc[1] = acc23; p_acc[2] = acc45; p_acc[3] = acc67;
+  p_acc[4] = acc89; p_acc[5] = acc1011; p_acc[6] = acc1213; p_acc[7] = acc1415;
+}
+
+static void matmul_t_sym8sxasym8s(
+    WORD8 *p_out,
+    const WORD8 *p_mat1,
+    const WORD8 *p_vec1,
+    const WORD32 *p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    const WORD32 *p_out_multiplier,
+    WORD32 out_shift,
+    const WORD32 *p_out_shift,
+    WORD32 out_zero_bias)
+{
+  /* Shifts to match with Tensorflow */
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  int m_itr, vec_itr, j, ii;
+
+  for(m_itr = 0; m_itr < rows; m_itr += T_COLS_8)
+  {
+    int ncols = XT_MIN(T_COLS_8, rows - m_itr);
+    WORD32 p_bias_col[T_COLS_8];
+    int p_left_mult[T_COLS_8], p_right_mult[T_COLS_8], p_out_mult[T_COLS_8];
+
+    /* Padding columns get a zero multiplier */
+    for(j = 0; j < T_COLS_8; j++)
+    {
+      int valid = j < ncols;
+
+      p_bias_col[j] = (valid && p_bias) ? p_bias[m_itr + j] : 0;
+      if(p_out_multiplier)
+      {
+        int shift = valid ? p_out_shift[m_itr + j] : 0;
+
+        p_left_mult[j] = shift < 0 ? 1 : (1 << shift);
+        p_right_mult[j] = shift > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + shift));
+        p_out_mult[j] = valid ? -p_out_multiplier[m_itr + j] : 0;
+      }
+    }
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc[T_COLS_8 / 2];
+      WORD8 *p_dst = p_out + m_itr * out_stride + vec_itr * out_offset;
+
+      for(j = 0; j < T_COLS_8 / 2; j++)
+        acc[j] = AE_MOVDA32X2(p_bias_col[2 * j], p_bias_col[2 * j + 1]);
+
+      dot_t_sym8s_16cols(acc, p_mat1 + m_itr, row_stride1, cols1, p_vec1 + vec_itr * vec_offset, vec1_zero_bias, ncols);
+
+      for(j = 0; j < ncols; j += 4)
+      {
+        ae_int32x2 acc_01 = acc[j / 2], acc_23 = acc[j / 2 + 1];
+        WORD32 out[4];
+
+        if(p_out_multiplier)
+        {
+          ae_int32x2 l_mult_23, l_mult_01, r_mult_23, r_mult_01;
+          ae_int32x2 out_multiplier_01, out_multiplier_23;
+          ae_int16x4 out_0;
+
+          AE_L32X2X2_I(l_mult_01, l_mult_23, (ae_int32x4 *)&p_left_mult[j], 0);
+          AE_L32X2X2_I(r_mult_01, r_mult_23, (ae_int32x4 *)&p_right_mult[j], 0);
+          AE_L32X2X2_I(out_multiplier_01, out_multiplier_23, (ae_int32x4 *)&p_out_mult[j], 0);
+          MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_01, acc_23, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+          out[0] = AE_MOVAD16_3(out_0);
+          out[1] = AE_MOVAD16_2(out_0);
+          out[2] = AE_MOVAD16_1(out_0);
+          out[3] = AE_MOVAD16_0(out_0);
+        }
+        else
+        {
+          MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_01, out_multiplier, left_shift, right_shift);
+          MULTIPLYBYQUANTIZEDMULTIPLIER_X2(acc_23, out_multiplier, left_shift, right_shift);
+          acc_01 = AE_ADD32S(acc_01, out_zero_bias);
+          acc_23 = AE_ADD32S(acc_23, out_zero_bias);
+          AE_MINMAX32(acc_01, AE_MOVDA32(-128), AE_MOVDA32(127));
+          AE_MINMAX32(acc_23, AE_MOVDA32(-128), AE_MOVDA32(127));
+          out[0] = AE_MOVAD32_H(acc_01);
+          out[1] = AE_MOVAD32_L(acc_01);
+          out[2] = AE_MOVAD32_H(acc_23);
+          out[3] = AE_MOVAD32_L(acc_23);
+        }
+
+        for(ii = 0; ii < 4 && j + ii < ncols; ii++)
+          p_dst[(j + ii) * out_stride] = (WORD8)out[ii];
+      }
+    }
+  }
+}
+
+/* Adds the dot products of rows p_row_0..3 with p_vec to acc0..3 */
+#define DEFINE_DOT_NT_4ROWS(name, TYPE, LOAD) \
+static void name( \
+    ae_int64 *p_acc, \
+    const TYPE *p_row_0, \
+    const TYPE *p_row_1, \
+    const TYPE *p_row_2, \
+    const TYPE *p_row_3, \
+    const WORD16 *p_vec, \
+    WORD32 cols) \
+{ \
+  ae_int64 acc0 = p_acc[0], acc1 = p_acc[1], acc2 = p_acc[2], acc3 = p_acc[3]; \
+  ae_int16x4 mat_00, mat_01, mat_10, mat_11, mat_20, mat_21, mat_30, mat_31; \
+  ae_int16x4 vec_0, vec_1; \
+  ae_int16x8 *p_v = (ae_int16x8 *)p_vec; \
+  ae_valignx2 align_v = AE_LA128_PP(p_v); \
+  int c_itr; \
+ \
+  for(c_itr = 0; c_itr < (cols & ~7); c_itr += 8) \
+  { \
+    LOAD(&mat_00, &mat_01, p_row_0 + c_itr, 8); \
+    LOAD(&mat_10, &mat_11, p_row_1 + c_itr, 8); \
+    LOAD(&mat_20, &mat_21, p_row_2 + c_itr, 8); \
+    LOAD(&mat_30, &mat_31, p_row_3 + c_itr, 8); \
+    AE_LA16X4X2_IP(vec_0, vec_1, align_v, p_v); \
+    AE_MULAAAA2Q16(acc0, acc1, mat_00, mat_10, vec_0, vec_0); \
+    AE_MULAAAA2Q16(acc2, acc3, mat_20, mat_30, vec_0, vec_0); \
+    AE_MULAAAA2Q16(acc0, acc1, mat_01, mat_11, vec_1, vec_1); \
+    AE_MULAAAA2Q16(acc2, acc3, mat_21, mat_31, vec_1, vec_1); \
+  } \
+ \
+  /* Column tail: the vector is zero padded */ \
+  if(c_itr < cols) \
+  { \
+    int rem = cols - c_itr; \
+    LOAD(&mat_00, &mat_01, p_row_0 + c_itr, rem); \
+    LOAD(&mat_10, &mat_11, p_row_1 + c_itr, rem); \
+    LOAD(&mat_20, &mat_21, p_row_2 + c_itr, rem); \
+    LOAD(&mat_30, &mat_31, p_row_3 + c_itr, rem); \
+    vec_0 = load_vec_tail_16(p_vec + c_itr, XT_MIN(rem, 4)); \
+    vec_1 = rem > 4 ? load_vec_tail_16(p_vec + c_itr + 4, rem - 4) : AE_MOVDA16(0); \
+    AE_MULAAAA2Q16(acc0, acc1, mat_00, mat_10, vec_0, vec_0); \
+    AE_MULAAAA2Q16(acc2, acc3, mat_20, mat_30, vec_0, vec_0); \
+    AE_MULAAAA2Q16(acc0, acc1, mat_01, mat_11, vec_1, vec_1); \
+    AE_MULAAAA2Q16(acc2, acc3, mat_21, mat_31, vec_1, vec_1); \
+  } \
+ \
+  p_acc[0] = acc0; p_acc[1] = acc1; p_acc[2] = acc2; p_acc[3] = acc3; \
+}
+
+DEFINE_DOT_NT_4ROWS(dot_nt_16x16_4rows, WORD16, load_cols_16)
+DEFINE_DOT_NT_4ROWS(dot_nt_8x16_4rows, WORD8, load_cols_8)
+
+#define DEFINE_MATMUL_NT_16(name, TYPE, DOT) \
+static void name( \
+    WORD16 *p_out, \
+    const TYPE *p_mat1, \
+    const WORD16 *p_mat2, \
+    const WORD16 *p_bias, \
+    WORD32 rows, \
+    WORD32 cols, \
+    WORD32 row_stride, \
+    WORD32 acc_shift, \
+    WORD32 bias_shift, \
+    WORD32 vec_count, \
+    WORD32 vec_offset, \
+    WORD32 out_offset, \
+    WORD32 out_stride) \
+{ \
+  int m_itr, vec_itr, j, last = rows - 1; \
+ \
+  for(m_itr = 0; m_itr < rows; m_itr += NT_ROWS) \
+  { \
+    int nrows = XT_MIN(NT_ROWS, rows - m_itr); \
+    const TYPE *p_row_0 = p_mat1 + m_itr * row_stride; \
+    const TYPE *p_row_1 = p_mat1 + XT_MIN(m_itr + 1, last) * row_stride; \
+    const TYPE *p_row_2 = p_mat1 + XT_MIN(m_itr + 2, last) * row_stride; \
+    const TYPE *p_row_3 = p_mat1 + XT_MIN(m_itr + 3, last) * row_stride; \
+ \
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++) \
+    { \
+      ae_int64 acc[NT_ROWS]; \
+ \
+      for(j = 0; j < NT_ROWS; j++) \
+        acc[j] = AE_SLAA64S(p_bias[XT_MIN(m_itr + j, last)], bias_shift); \
+ \
+      DOT(acc, p_row_0, p_row_1, p_row_2, p_row_3, p_mat2 + vec_itr * vec_offset, cols); \
+      store_acc64_16(p_out + m_itr * out_stride + vec_itr * out_offset, out_stride, acc, nrows, acc_shift); \
+    } \
+  } \
+}
+
+DEFINE_MATMUL_NT_16(matmul_nt_16x16_16, WORD16, dot_nt_16x16_4rows)
+DEFINE_MATMUL_NT_16(matmul_nt_8x16_16, WORD8, dot_nt_8x16_4rows)
+
+#define CHK_ARGS_16(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, row_len) \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD16), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1); \
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < row_len), -1);
+
+#define CHK_MATMUL_ARGS(vec_count, vec_offset, out_offset, out_stride) \
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+
+WORD32 xa_nn_matXvec_t_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 acc_shift,
+    WORD32 bias_shift)
+{
+  CHK_ARGS_16(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, rows);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(WORD16), -1);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  matmul_t_16x16_16(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      acc_shift, bias_shift, 1, cols1, 1, 1);
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_t_8x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 acc_shift,
+    WORD32 bias_shift)
+{
+  CHK_ARGS_16(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1, rows);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  matmul_t_8x16_16(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      acc_shift, bias_shift, 1, cols1, 1, 1);
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_t_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < rows), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  matmul_t_sym8sxasym8s(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      1, cols1, 1, 1, vec1_zero_bias, out_multiplier, NULL, out_shift, NULL, out_zero_bias);
+  return 0;
+}
+
+WORD32 xa_nn_matmul_tn_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride)
+{
+  CHK_ARGS_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, rows);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(WORD16), -1);
+  CHK_MATMUL_ARGS(vec_count, vec_offset, out_offset, out_stride);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  matmul_t_16x16_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride,
+      acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride);
+  return 0;
+}
+
+WORD32 xa_nn_matmul_tn_8x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride)
+{
+  CHK_ARGS_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, rows);
+  CHK_MATMUL_ARGS(vec_count, vec_offset, out_offset, out_stride);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  matmul_t_8x16_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride,
+      acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride);
+  return 0;
+}
+
+WORD32 xa_nn_matmul_tn_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  int ii;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < rows), -1);
+  CHK_MATMUL_ARGS(vec_count, vec_offset, out_offset, out_stride);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  for(ii = 0; ii < rows; ii++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[ii] < -31 || p_out_shift[ii] > 31), -1);
+  }
+
+  matmul_t_sym8sxasym8s(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, 0, p_out_multiplier, 0, p_out_shift, out_zero_bias);
+  return 0;
+}
+
+WORD32 xa_nn_matmul_nt_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride)
+{
+  CHK_ARGS_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, cols);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(WORD16), -1);
+  CHK_MATMUL_ARGS(vec_count, vec_offset, out_offset, out_stride);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  matmul_nt_16x16_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride,
+      acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride);
+  return 0;
+}
+
+WORD32 xa_nn_matmul_nt_8x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride)
+{
+  CHK_ARGS_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride, cols);
+  CHK_MATMUL_ARGS(vec_count, vec_offset, out_offset, out_stride);
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  matmul_nt_8x16_16(p_out, p_mat1, p_mat2, p_bias, rows, cols, row_stride,
+      acc_shift, bias_shift, vec_count, vec_offset, out_offset, out_stride);
+  return 0;
+}
+
+WORD32 xa_nn_matmul_nt_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias, p_out_multiplier, p_out_shift, out_zero_bias);
+}
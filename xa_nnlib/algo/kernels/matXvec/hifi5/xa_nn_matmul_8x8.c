@@ -22,6 +22,8 @@
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
 
+extern const long long g_sel_pattern[16];
+
 const long long g_sel_pattern[16] = {
  0xf7e6d5c4L, 0xb3a29180L,
  0xe7d6c5b4L, 0xa3928170L,
@@ -62,7 +64,7 @@ static inline void _xa_nn_dot_product_4_rows_4_vecs_offset_aligned
   ae_int8x8 mat1_row2_0, mat1_row2_1;
   ae_int8x8 mat1_row3_0, mat1_row3_1;
 
-  int align_offset = ((unsigned int)p_mat1_0 & 0x7);
+  int align_offset = ((uintptr_t)p_mat1_0 & 0x7);
   pre_loop_count = 8 - align_offset;
   pre_loop_shift = align_offset * 8;
   p_mat1_0 = (ae_int8x8 *)((ae_int8 *)p_mat1_0 - align_offset);
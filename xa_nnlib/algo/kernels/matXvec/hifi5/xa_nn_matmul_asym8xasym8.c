@@ -44,6 +44,8 @@
   dst1 = AE_SEL8X8(AE_MOVINT8X8_FROMINT16X4(src1), AE_MOVINT8X8_FROMINT16X4(src2), AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(0x080a0c0e, 0x00020406)));
 
 extern const long long g_sel_pattern[16];
+extern const long long pre_loop_sel_pattern[16];
+extern const long long post_loop_sel_pattern[16];
 
 const long long pre_loop_sel_pattern[16] = {
  0x00000000L, 0x00000000L,
@@ -477,7 +479,7 @@ static inline void _xa_nn_dot_product_4_rows_4_vecs_offset_aligned
   ae_int8x8 mat1_row2_0, mat1_row2_1;
   ae_int8x8 mat1_row3_0, mat1_row3_1;
 
-  int align_offset = ((unsigned int)p_mat1_0 & 0x7);
+  int align_offset = ((uintptr_t)p_mat1_0 & 0x7);
   pre_loop_count = 8 - align_offset;
   ae_int8x8 pre_sel1 = AE_MOVINT8X8_FROMINT32X2(AE_MOVDA32X2(pre_loop_sel_pattern[2 * (align_offset & 7)], pre_loop_sel_pattern[2 * (align_offset & 7) + 1])); 
   p_mat1_0 = (ae_int8x8 *)((ae_int8 *)p_mat1_0 - align_offset);
@@ -0,0 +1,476 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Strided batched matmul (BMM): batch_count independent products with the
+ * layout of the single matmul kernels, out = mat1 * mat2^T with the
+ * vectors vec_offset apart. Batch b uses mat1, vec1 and out advanced by
+ * b times the batch strides of xa_nnlib_batch_desc_t, and the per row
+ * bias, multiplier and shift advanced by b * chan_batch_stride.
+ *
+ * Attention heads and grouped FC layers are many small products (e.g.
+ * 16 x 64 x 16), where a call per batch spends much of its time in
+ * argument checks and per row setup. Here the checks run once, and the
+ * loop visits 4-row tiles with the batches innermost, so with shared per
+ * row parameters (chan_batch_stride = 0) the requantization constants of a
+ * tile are set up once for the whole batch. Every tile produces 2 vectors
+ * at a time from the same 4 matrix rows.
+ *
+ * The outputs are those of xa_nn_matmul_per_chan_sym8sxasym8s_asym8s and
+ * of xa_nn_matXvec_16x16_16 applied per batch and per vector.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#define TILE_ROWS  4
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+typedef struct _tile_quant_t
+{
+  ae_int32x2 bias_01, bias_23;
+  ae_int32x2 l_mult_01, l_mult_23;
+  ae_int32x2 r_mult_01, r_mult_23;
+  ae_int32x2 out_mult_01, out_mult_23;
+} tile_quant_t;
+
+/* Requantization constants of rows m_itr.. of one batch; padding rows get
+   a zero multiplier */
+static void set_tile_quant(
+    tile_quant_t *p_q,
+    const WORD32 *p_bias,
+    const WORD32 *p_out_multiplier,
+    const WORD32 *p_out_shift,
+    WORD32 m_itr,
+    WORD32 nrows)
+{
+  WORD32 p_bias_row[TILE_ROWS];
+  int p_left_mult[TILE_ROWS], p_right_mult[TILE_ROWS], p_out_mult[TILE_ROWS];
+  int ii;
+
+  for(ii = 0; ii < TILE_ROWS; ii++)
+  {
+    int valid = ii < nrows;
+    int shift = valid ? p_out_shift[m_itr + ii] : 0;
+
+    p_bias_row[ii] = (valid && p_bias) ? p_bias[m_itr + ii] : 0;
+    p_left_mult[ii] = shift < 0 ? 1 : (1 << shift);
+    p_right_mult[ii] = shift > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + shift));
+    p_out_mult[ii] = valid ? -p_out_multiplier[m_itr + ii] : 0;
+  }
+  p_q->bias_01 = AE_MOVDA32X2(p_bias_row[0], p_bias_row[1]);
+  p_q->bias_23 = AE_MOVDA32X2(p_bias_row[2], p_bias_row[3]);
+  AE_L32X2X2_I(p_q->l_mult_01, p_q->l_mult_23, (ae_int32x4 *)p_left_mult, 0);
+  AE_L32X2X2_I(p_q->r_mult_01, p_q->r_mult_23, (ae_int32x4 *)p_right_mult, 0);
+  AE_L32X2X2_I(p_q->out_mult_01, p_q->out_mult_23, (ae_int32x4 *)p_out_mult, 0);
+}
+
+/* sum(mat * (vec + vec_zero_bias)) of 4 rows against 2 vectors, added to
+   the accumulators; row pointers can repeat past the end of the matrix */
+static inline void dot_4_rows_2_vecs(
+    ae_int32x2 *p_acc,
+    const WORD8 *p_row_0,
+    const WORD8 *p_row_1,
+    const WORD8 *p_row_2,
+    const WORD8 *p_row_3,
+    const WORD8 *p_vec_0,
+    const WORD8 *p_vec_1,
+    WORD32 cols,
+    WORD32 vec_zero_bias)
+{
+  ae_int32x2 acc_0_row01 = p_acc[0], acc_0_row23 = p_acc[1];
+  ae_int32x2 acc_1_row01 = p_acc[2], acc_1_row23 = p_acc[3];
+  ae_int8x8 neg_vec_bias = AE_MOVDA8((WORD8)-vec_zero_bias);
+  ae_int8x8 vec_0_0, vec_0_1, vec_1_0, vec_1_1;
+  ae_int16x4 wvec_0_0, wvec_0_1, wvec_0_2, wvec_0_3;
+  ae_int16x4 wvec_1_0, wvec_1_1, wvec_1_2, wvec_1_3;
+  ae_int8x8 mat_0_0, mat_0_1, mat_1_0, mat_1_1, mat_2_0, mat_2_1, mat_3_0, mat_3_1;
+  int c_itr;
+
+  ae_valignx2 align_p_row_0 = AE_LA128_PP(p_row_0);
+  ae_valignx2 align_p_row_1 = AE_LA128_PP(p_row_1);
+  ae_valignx2 align_p_row_2 = AE_LA128_PP(p_row_2);
+  ae_valignx2 align_p_row_3 = AE_LA128_PP(p_row_3);
+  ae_valignx2 align_p_vec_0 = AE_LA128_PP(p_vec_0);
+  ae_valignx2 align_p_vec_1 = AE_LA128_PP(p_vec_1);
+
+  for(c_itr = 0; c_itr < (cols & ~(16 - 1)); c_itr += 16)
+  {
+    AE_LA8X8X2_IP(vec_0_0, vec_0_1, align_p_vec_0, p_vec_0);
+    AE_LA8X8X2_IP(vec_1_0, vec_1_1, align_p_vec_1, p_vec_1);
+    AE_SUBW8(wvec_0_0, wvec_0_1, vec_0_0, neg_vec_bias);
+    AE_SUBW8(wvec_0_2, wvec_0_3, vec_0_1, neg_vec_bias);
+    AE_SUBW8(wvec_1_0, wvec_1_1, vec_1_0, neg_vec_bias);
+    AE_SUBW8(wvec_1_2, wvec_1_3, vec_1_1, neg_vec_bias);
+
+    AE_LA8X8X2_IP(mat_0_0, mat_0_1, align_p_row_0, p_row_0);
+    AE_LA8X8X2_IP(mat_1_0, mat_1_1, align_p_row_1, p_row_1);
+    AE_LA8X8X2_IP(mat_2_0, mat_2_1, align_p_row_2, p_row_2);
+    AE_LA8X8X2_IP(mat_3_0, mat_3_1, align_p_row_3, p_row_3);
+
+    AE_MULA8Q8X16(acc_0_row01, acc_0_row23, mat_0_0, mat_1_0, mat_2_0, mat_3_0, wvec_0_0, wvec_0_1);
+    AE_MULA8Q8X16(acc_0_row01, acc_0_row23, mat_0_1, mat_1_1, mat_2_1, mat_3_1, wvec_0_2, wvec_0_3);
+    AE_MULA8Q8X16(acc_1_row01, acc_1_row23, mat_0_0, mat_1_0, mat_2_0, mat_3_0, wvec_1_0, wvec_1_1);
+    AE_MULA8Q8X16(acc_1_row01, acc_1_row23, mat_0_1, mat_1_1, mat_2_1, mat_3_1, wvec_1_2, wvec_1_3);
+  }
+
+  /* Column tail: the matrix is zero padded */
+  if(c_itr < cols)
+  {
+    int rem_cols = cols - c_itr;
+    ae_int8x8 vec_tail[4];
+    ae_int8x8 mat_tail[2 * TILE_ROWS];
+
+    memset(vec_tail, 0, sizeof(vec_tail));
+    memcpy(&vec_tail[0], p_vec_0, rem_cols);
+    memcpy(&vec_tail[2], p_vec_1, rem_cols);
+    memset(mat_tail, 0, sizeof(mat_tail));
+    memcpy(&mat_tail[0], p_row_0, rem_cols);
+    memcpy(&mat_tail[2], p_row_1, rem_cols);
+    memcpy(&mat_tail[4], p_row_2, rem_cols);
+    memcpy(&mat_tail[6], p_row_3, rem_cols);
+
+    AE_SUBW8(wvec_0_0, wvec_0_1, AE_L8X8_I(vec_tail, 0), neg_vec_bias);
+    AE_SUBW8(wvec_0_2, wvec_0_3, AE_L8X8_I(vec_tail, 8), neg_vec_bias);
+    AE_SUBW8(wvec_1_0, wvec_1_1, AE_L8X8_I(vec_tail, 16), neg_vec_bias);
+    AE_SUBW8(wvec_1_2, wvec_1_3, AE_L8X8_I(vec_tail, 24), neg_vec_bias);
+
+    mat_0_0 = AE_L8X8_I(mat_tail, 0);  mat_0_1 = AE_L8X8_I(mat_tail, 8);
+    mat_1_0 = AE_L8X8_I(mat_tail, 16); mat_1_1 = AE_L8X8_I(mat_tail, 24);
+    mat_2_0 = AE_L8X8_I(mat_tail, 32); mat_2_1 = AE_L8X8_I(mat_tail, 40);
+    mat_3_0 = AE_L8X8_I(mat_tail, 48); mat_3_1 = AE_L8X8_I(mat_tail, 56);
+
+    AE_MULA8Q8X16(acc_0_row01, acc_0_row23, mat_0_0, mat_1_0, mat_2_0, mat_3_0, wvec_0_0, wvec_0_1);
+    AE_MULA8Q8X16(acc_0_row01, acc_0_row23, mat_0_1, mat_1_1, mat_2_1, mat_3_1, wvec_0_2, wvec_0_3);
+    AE_MULA8Q8X16(acc_1_row01, acc_1_row23, mat_0_0, mat_1_0, mat_2_0, mat_3_0, wvec_1_0, wvec_1_1);
+    AE_MULA8Q8X16(acc_1_row01, acc_1_row23, mat_0_1, mat_1_1, mat_2_1, mat_3_1, wvec_1_2, wvec_1_3);
+  }
+
+  p_acc[0] = acc_0_row01; p_acc[1] = acc_0_row23;
+  p_acc[2] = acc_1_row01; p_acc[3] = acc_1_row23;
+}
+
+static inline void store_tile_8(
+    WORD8 *p_dst,
+    WORD32 out_stride,
+    ae_int32x2 acc_row01,
+    ae_int32x2 acc_row23,
+    const tile_quant_t *p_q,
+    WORD32 out_zero_bias,
+    WORD32 nrows)
+{
+  ae_int16x4 out_0;
+
+  MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row01, acc_row23, p_q->out_mult_23, p_q->out_mult_01,
+      p_q->l_mult_23, p_q->l_mult_01, p_q->r_mult_23, p_q->r_mult_01, out_zero_bias);
+
+  p_dst[0] = (WORD8)AE_MOVAD16_3(out_0);
+  if(nrows > 1) p_dst[out_stride] = (WORD8)AE_MOVAD16_2(out_0);
+  if(nrows > 2) p_dst[2 * out_stride] = (WORD8)AE_MOVAD16_1(out_0);
+  if(nrows > 3) p_dst[3 * out_stride] = (WORD8)AE_MOVAD16_0(out_0);
+}
+
+/* 64 bit dot products of 4 rows against 2 vectors, added to p_acc as
+   {vec 0 rows 0..3, vec 1 rows 0..3} */
+static inline void dot_4_rows_2_vecs_16x16(
+    ae_int64 *p_acc,
+    const WORD16 *p_row_0,
+    const WORD16 *p_row_1,
+    const WORD16 *p_row_2,
+    const WORD16 *p_row_3,
+    const WORD16 *p_vec_0,
+    const WORD16 *p_vec_1,
+    WORD32 cols)
+{
+  ae_int64 acc_0_0 = p_acc[0], acc_0_1 = p_acc[1], acc_0_2 = p_acc[2], acc_0_3 = p_acc[3];
+  ae_int64 acc_1_0 = p_acc[4], acc_1_1 = p_acc[5], acc_1_2 = p_acc[6], acc_1_3 = p_acc[7];
+  ae_int16x4 mat_0, mat_1, mat_2, mat_3, vec_0, vec_1;
+  int c_itr;
+
+  ae_valign align_p_row_0 = AE_LA64_PP(p_row_0);
+  ae_valign align_p_row_1 = AE_LA64_PP(p_row_1);
+  ae_valign align_p_row_2 = AE_LA64_PP(p_row_2);
+  ae_valign align_p_row_3 = AE_LA64_PP(p_row_3);
+  ae_valign align_p_vec_0 = AE_LA64_PP(p_vec_0);
+  ae_valign align_p_vec_1 = AE_LA64_PP(p_vec_1);
+
+  for(c_itr = 0; c_itr < (cols & ~3); c_itr += 4)
+  {
+    AE_LA16X4_IP(vec_0, align_p_vec_0, (ae_int16x4 *)p_vec_0);
+    AE_LA16X4_IP(vec_1, align_p_vec_1, (ae_int16x4 *)p_vec_1);
+    AE_LA16X4_IP(mat_0, align_p_row_0, (ae_int16x4 *)p_row_0);
+    AE_LA16X4_IP(mat_1, align_p_row_1, (ae_int16x4 *)p_row_1);
+    AE_LA16X4_IP(mat_2, align_p_row_2, (ae_int16x4 *)p_row_2);
+    AE_LA16X4_IP(mat_3, align_p_row_3, (ae_int16x4 *)p_row_3);
+
+    AE_MULAAAA2Q16(acc_0_0, acc_0_1, mat_0, mat_1, vec_0, vec_0);
+    AE_MULAAAA2Q16(acc_0_2, acc_0_3, mat_2, mat_3, vec_0, vec_0);
+    AE_MULAAAA2Q16(acc_1_0, acc_1_1, mat_0, mat_1, vec_1, vec_1);
+    AE_MULAAAA2Q16(acc_1_2, acc_1_3, mat_2, mat_3, vec_1, vec_1);
+  }
+
+  /* Column tail: the matrix is zero padded */
+  if(c_itr < cols)
+  {
+    int rem_cols = cols - c_itr;
+    ae_int16x4 vec_tail[2];
+    ae_int16x4 mat_tail[TILE_ROWS];
+
+    memset(vec_tail, 0, sizeof(vec_tail));
+    memcpy(&vec_tail[0], p_vec_0, rem_cols * sizeof(WORD16));
+    memcpy(&vec_tail[1], p_vec_1, rem_cols * sizeof(WORD16));
+    memset(mat_tail, 0, sizeof(mat_tail));
+    memcpy(&mat_tail[0], p_row_0, rem_cols * sizeof(WORD16));
+    memcpy(&mat_tail[1], p_row_1, rem_cols * sizeof(WORD16));
+    memcpy(&mat_tail[2], p_row_2, rem_cols * sizeof(WORD16));
+    memcpy(&mat_tail[3], p_row_3, rem_cols * sizeof(WORD16));
+
+    vec_0 = AE_L16X4_I(vec_tail, 0);  vec_1 = AE_L16X4_I(vec_tail, 8);
+    mat_0 = AE_L16X4_I(mat_tail, 0);  mat_1 = AE_L16X4_I(mat_tail, 8);
+    mat_2 = AE_L16X4_I(mat_tail, 16); mat_3 = AE_L16X4_I(mat_tail, 24);
+
+    AE_MULAAAA2Q16(acc_0_0, acc_0_1, mat_0, mat_1, vec_0, vec_0);
+    AE_MULAAAA2Q16(acc_0_2, acc_0_3, mat_2, mat_3, vec_0, vec_0);
+    AE_MULAAAA2Q16(acc_1_0, acc_1_1, mat_0, mat_1, vec_1, vec_1);
+    AE_MULAAAA2Q16(acc_1_2, acc_1_3, mat_2, mat_3, vec_1, vec_1);
+  }
+
+  p_acc[0] = acc_0_0; p_acc[1] = acc_0_1; p_acc[2] = acc_0_2; p_acc[3] = acc_0_3;
+  p_acc[4] = acc_1_0; p_acc[5] = acc_1_1; p_acc[6] = acc_1_2; p_acc[7] = acc_1_3;
+}
+
+/* Rounds 4 64 bit accumulators to 16 bit as xa_nn_matXvec_16x16_16 */
+static inline void store_tile_16(
+    WORD16 *p_dst,
+    WORD32 out_stride,
+    const ae_int64 *p_acc,
+    WORD32 acc_shift,
+    WORD32 nrows)
+{
+  ae_int64 acc_0 = AE_SLAA64S(p_acc[0], acc_shift);
+  ae_int64 acc_1 = AE_SLAA64S(p_acc[1], acc_shift);
+  ae_int64 acc_2 = AE_SLAA64S(p_acc[2], acc_shift);
+  ae_int64 acc_3 = AE_SLAA64S(p_acc[3], acc_shift);
+  ae_int16x4 out_16 = AE_SAT16X4(AE_ROUND32X2F64SSYM(acc_0, acc_1), AE_ROUND32X2F64SSYM(acc_2, acc_3));
+
+  p_dst[0] = AE_MOVAD16_3(out_16);
+  if(nrows > 1) p_dst[out_stride] = AE_MOVAD16_2(out_16);
+  if(nrows > 2) p_dst[2 * out_stride] = AE_MOVAD16_1(out_16);
+  if(nrows > 3) p_dst[3 * out_stride] = AE_MOVAD16_0(out_16);
+}
+
+static WORD32 check_batch_desc(const xa_nnlib_batch_desc_t *p_batch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_batch, -1);
+  XA_NNLIB_ARG_CHK_COND((p_batch->batch_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((p_batch->chan_batch_stride < 0), -1);
+  return 0;
+}
+
+WORD32 xa_nn_batch_matmul_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_batch_desc_t * __restrict__ p_batch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  if(check_batch_desc(p_batch) != 0)
+    return -1;
+
+  WORD32 batch_count = p_batch->batch_count;
+  WORD32 chan_stride = p_batch->chan_batch_stride;
+  WORD32 n_chan = chan_stride ? (batch_count - 1) * chan_stride + rows : rows;
+  int m_itr, batch, vec_itr, ii, last = rows - 1;
+
+  for(ii = 0; ii < n_chan; ii++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[ii] < -31 || p_out_shift[ii] > 31), -1);
+  }
+
+  for(m_itr = 0; m_itr < rows; m_itr += TILE_ROWS)
+  {
+    int nrows = XT_MIN(TILE_ROWS, rows - m_itr);
+    WORD32 row_off_1 = XT_MIN(m_itr + 1, last) * row_stride1;
+    WORD32 row_off_2 = XT_MIN(m_itr + 2, last) * row_stride1;
+    WORD32 row_off_3 = XT_MIN(m_itr + 3, last) * row_stride1;
+    tile_quant_t quant;
+
+    set_tile_quant(&quant, p_bias, p_out_multiplier, p_out_shift, m_itr, nrows);
+
+    for(batch = 0; batch < batch_count; batch++)
+    {
+      const WORD8 *p_mat = p_mat1 + batch * p_batch->mat1_batch_stride;
+      const WORD8 *p_vec = p_vec1 + batch * p_batch->vec1_batch_stride;
+      WORD8 *p_dst = p_out + batch * p_batch->out_batch_stride + m_itr * out_stride;
+
+      if(chan_stride != 0 && batch > 0)
+      {
+        WORD32 chan_off = batch * chan_stride;
+        set_tile_quant(&quant, p_bias ? p_bias + chan_off : NULL, p_out_multiplier + chan_off,
+            p_out_shift + chan_off, m_itr, nrows);
+      }
+
+      for(vec_itr = 0; vec_itr < vec_count; vec_itr += 2)
+      {
+        /* An odd last vector is computed twice */
+        int vec_itr_1 = XT_MIN(vec_itr + 1, vec_count - 1);
+        ae_int32x2 acc[4];
+
+        acc[0] = acc[2] = quant.bias_01;
+        acc[1] = acc[3] = quant.bias_23;
+        dot_4_rows_2_vecs(acc, p_mat + m_itr * row_stride1, p_mat + row_off_1, p_mat + row_off_2, p_mat + row_off_3,
+            p_vec + vec_itr * vec_offset, p_vec + vec_itr_1 * vec_offset, cols1, vec1_zero_bias);
+
+        store_tile_8(p_dst + vec_itr * out_offset, out_stride, acc[0], acc[1], &quant, out_zero_bias, nrows);
+        if(vec_itr_1 != vec_itr)
+          store_tile_8(p_dst + vec_itr_1 * out_offset, out_stride, acc[2], acc[3], &quant, out_zero_bias, nrows);
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_batch_matmul_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    const xa_nnlib_batch_desc_t * __restrict__ p_batch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat2, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat2, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0 || cols <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride < cols), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  if(check_batch_desc(p_batch) != 0)
+    return -1;
+
+  acc_shift = acc_shift + 32;
+  LIMIT_ACC_LSH
+
+  WORD32 batch_count = p_batch->batch_count;
+  int m_itr, batch, vec_itr, ii, last = rows - 1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += TILE_ROWS)
+  {
+    int nrows = XT_MIN(TILE_ROWS, rows - m_itr);
+    WORD32 row_off_1 = XT_MIN(m_itr + 1, last) * row_stride;
+    WORD32 row_off_2 = XT_MIN(m_itr + 2, last) * row_stride;
+    WORD32 row_off_3 = XT_MIN(m_itr + 3, last) * row_stride;
+    ae_int64 bias[TILE_ROWS];
+
+    for(ii = 0; ii < TILE_ROWS; ii++)
+      bias[ii] = AE_SLAA64S(p_bias[XT_MIN(m_itr + ii, last)], bias_shift);
+
+    for(batch = 0; batch < batch_count; batch++)
+    {
+      const WORD16 *p_mat = p_mat1 + batch * p_batch->mat1_batch_stride;
+      const WORD16 *p_vec = p_mat2 + batch * p_batch->vec1_batch_stride;
+      WORD16 *p_dst = p_out + batch * p_batch->out_batch_stride + m_itr * out_stride;
+
+      if(p_batch->chan_batch_stride != 0 && batch > 0)
+      {
+        const WORD16 *p_bias_b = p_bias + batch * p_batch->chan_batch_stride;
+        for(ii = 0; ii < TILE_ROWS; ii++)
+          bias[ii] = AE_SLAA64S(p_bias_b[XT_MIN(m_itr + ii, last)], bias_shift);
+      }
+
+      for(vec_itr = 0; vec_itr < vec_count; vec_itr += 2)
+      {
+        /* An odd last vector is computed twice */
+        int vec_itr_1 = XT_MIN(vec_itr + 1, vec_count - 1);
+        ae_int64 acc[2 * TILE_ROWS];
+
+        for(ii = 0; ii < TILE_ROWS; ii++)
+          acc[ii] = acc[TILE_ROWS + ii] = bias[ii];
+        dot_4_rows_2_vecs_16x16(acc, p_mat + m_itr * row_stride, p_mat + row_off_1, p_mat + row_off_2, p_mat + row_off_3,
+            p_vec + vec_itr * vec_offset, p_vec + vec_itr_1 * vec_offset, cols);
+
+        store_tile_16(p_dst + vec_itr * out_offset, out_stride, &acc[0], acc_shift, nrows);
+        if(vec_itr_1 != vec_itr)
+          store_tile_16(p_dst + vec_itr_1 * out_offset, out_stride, &acc[TILE_ROWS], acc_shift, nrows);
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,550 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Cache-blocked GEMM for the 8-bit matmul kernels.
+ *
+ * xa_nn_matmul_8x8_8 and xa_nn_matmul_per_chan_sym8sxasym8s_asym8s stream
+ * every group of mat1 rows against every group of vectors over the full
+ * cols1, so once the matrix or the vectors outgrow the data cache each
+ * pass fetches them again from memory. The *_blocked kernels split the
+ * product into blocks of
+ *
+ *   nc vectors x mc rows x kc columns
+ *
+ * (xa_nn_matmul_get_blocking picks the sizes from a cache descriptor). For
+ * every block the mat1 rows and the vectors are copied to scratch as 4 x 16
+ * byte interleaved panels, the layout of xa_nn_pack_weights_8, zero padded
+ * to whole panels. A 4 row x 4 vector micro-kernel runs over the panels
+ * with aligned loads and no column tails and adds into an mc x nc tile of
+ * 32-bit accumulators, which goes through the output stage of the unblocked
+ * kernel after the last kc block. The accumulators wrap in 32 bits as on
+ * the unblocked kernels, so splitting cols1 does not change the result.
+ *
+ * xa_nn_matmul_8x8_8_blocked gives the same output as xa_nn_matmul_8x8_8.
+ * xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked applies the per channel
+ * requantization of the NHWC paths of xa_nn_matmul_per_chan_sym8sxasym8s_asym8s
+ * to every output; the other paths of that kernel round ties of the
+ * multiplier product and saturate positive shifts differently, so outputs
+ * can differ in those corner cases.
+ */
+#include <string.h>
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros_hifi5.h"
+
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
+#define BLK_ROWS 4
+#define BLK_COLS 16
+
+#define ROUND_UP(x, n)  (((x) + (n) - 1) & ~((n) - 1))
+#define ALIGNED_SIZE(x) ROUND_UP((x), 16)
+#define ALIGN_PTR(x, bytes) ((((uintptr_t)(x)) + (bytes - 1)) & ~(bytes - 1))
+
+/* Default descriptor: 32 KB of L1 data cache backed by 256 KB of L2 or
+   local data memory */
+#define DEFAULT_L1_SIZE (32 * 1024)
+#define DEFAULT_L2_SIZE (256 * 1024)
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out, inp1, inp2, multiplier_23, multiplier_01, l_shift_23, l_shift_01, r_shift_23, r_shift_01, out_off) \
+{\
+  AE_MUL2P32X4S(inp1, inp2, inp1, inp2, l_shift_01, l_shift_23); \
+  AE_MULF2P32X4RAS(inp1, inp2, inp1, inp2, multiplier_01, multiplier_23); \
+  AE_MULF2P32X4RS(inp1, inp2, inp1, inp2, r_shift_01, r_shift_23); \
+  out = AE_SAT16X4(inp1, inp2); \
+  out = AE_ADD16S(AE_MOVDA16(out_off), out); \
+  AE_MINMAX16(out, AE_MOVDA16(-128), AE_MOVDA16(127)); \
+}
+
+/* Splits n into the fewest blocks of at most max_blk, rounded up to a
+   multiple of align, so that the last block is not a short tail */
+static WORD32 balance_block(WORD32 n, WORD32 max_blk, WORD32 align)
+{
+  WORD32 n_blocks;
+
+  max_blk = max_blk & ~(align - 1);
+  if(max_blk < align)
+    max_blk = align;
+  n_blocks = (n + max_blk - 1) / max_blk;
+
+  return ROUND_UP((n + n_blocks - 1) / n_blocks, align);
+}
+
+WORD32 xa_nn_matmul_get_blocking(
+    xa_nnlib_gemm_blocking_t * __restrict__ p_blocking,
+    const xa_nnlib_cache_desc_t * __restrict__ p_cache,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 vec_count)
+{
+  WORD32 l1_size, l2_size;
+
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_blocking, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+
+  l1_size = p_cache ? p_cache->l1_size : DEFAULT_L1_SIZE;
+  l2_size = p_cache ? p_cache->l2_size : DEFAULT_L2_SIZE;
+  XA_NNLIB_ARG_CHK_COND((l1_size < 1024), -1);
+  XA_NNLIB_ARG_CHK_COND((l2_size < 0), -1);
+  if(l2_size < l1_size)
+    l2_size = l1_size;
+
+  /* The micro-kernel streams one 4 x kc panel of each operand: both fit
+     in half of L1, leaving the rest for the accumulators and outputs */
+  p_blocking->kc = balance_block(cols1, (l1_size / 2) / (2 * BLK_ROWS), BLK_COLS);
+
+  /* The mc x kc block of mat1 is reused for every vector of the block */
+  p_blocking->mc = balance_block(rows, (l2_size / 2) / p_blocking->kc, BLK_ROWS);
+
+  /* The kc x nc vector block and the mc x nc accumulator tile share the
+     other half of L2 */
+  p_blocking->nc = balance_block(vec_count,
+      (l2_size / 2) / (p_blocking->kc + p_blocking->mc * (WORD32)sizeof(WORD32)), BLK_ROWS);
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_blocked_getsize(
+    const xa_nnlib_gemm_blocking_t * __restrict__ p_blocking)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_blocking, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((p_blocking->mc <= 0 || (p_blocking->mc & (BLK_ROWS - 1))), -1);
+  XA_NNLIB_ARG_CHK_COND((p_blocking->nc <= 0 || (p_blocking->nc & (BLK_ROWS - 1))), -1);
+  XA_NNLIB_ARG_CHK_COND((p_blocking->kc <= 0 || (p_blocking->kc & (BLK_COLS - 1))), -1);
+
+  /* mat1 panels, vector panels, accumulator tile, per row terms */
+  return ALIGNED_SIZE(p_blocking->mc * p_blocking->kc) +
+         ALIGNED_SIZE(p_blocking->nc * p_blocking->kc) +
+         ALIGNED_SIZE(p_blocking->mc * p_blocking->nc * sizeof(WORD32)) +
+         ALIGNED_SIZE(p_blocking->mc * sizeof(ae_int64)) +
+         16;
+}
+
+/* nrows x ncols from p_src to 4 x 16 interleaved panels; with p_row_sum
+   the row sums are accumulated as well */
+static void pack_panels_8(
+    WORD8 * __restrict__ p_dst,
+    const WORD8 * __restrict__ p_src,
+    WORD32 nrows,
+    WORD32 ncols,
+    WORD32 stride,
+    UWORD32 * __restrict__ p_row_sum)
+{
+  int m_itr, c_itr, r, ii;
+
+  for(m_itr = 0; m_itr < ROUND_UP(nrows, BLK_ROWS); m_itr += BLK_ROWS)
+  {
+    for(c_itr = 0; c_itr < ROUND_UP(ncols, BLK_COLS); c_itr += BLK_COLS)
+    {
+      for(r = 0; r < BLK_ROWS; r++)
+      {
+        const WORD8 *p_row = p_src + (m_itr + r) * stride;
+        int valid = (m_itr + r) < nrows;
+        UWORD32 sum = 0;
+        for(ii = 0; ii < BLK_COLS; ii++)
+        {
+          WORD8 val = (valid && (c_itr + ii) < ncols) ? p_row[c_itr + ii] : 0;
+          *p_dst++ = val;
+          sum += (UWORD32)(WORD32)val;
+        }
+        if(p_row_sum && valid)
+          p_row_sum[m_itr + r] += sum;
+      }
+    }
+  }
+}
+
+/* p_acc[mc x nc] += p_a[mc x kc] * p_b[nc x kc]'; the tile holds the four
+   rows of a row group next to each other for every vector */
+static void gemm_block_8x8(
+    WORD32 * __restrict__ p_acc,
+    const WORD8 * __restrict__ p_a,
+    const WORD8 * __restrict__ p_b,
+    WORD32 mc,
+    WORD32 nc,
+    WORD32 kc)
+{
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matmul_8x8_blocked_tile_host(p_acc, p_a, p_b, mc, nc, kc) == 0)
+  {
+    return;
+  }
+#endif
+
+  int m_itr, vec_itr, c_itr;
+
+  ae_int8x8 mat1_row0_0, mat1_row0_1;
+  ae_int8x8 mat1_row1_0, mat1_row1_1;
+  ae_int8x8 mat1_row2_0, mat1_row2_1;
+  ae_int8x8 mat1_row3_0, mat1_row3_1;
+  ae_int8x8 vec0_batch_0, vec0_batch_1;
+  ae_int8x8 vec1_batch_0, vec1_batch_1;
+  ae_int8x8 vec2_batch_0, vec2_batch_1;
+  ae_int8x8 vec3_batch_0, vec3_batch_1;
+
+  for(m_itr = 0; m_itr < mc; m_itr += BLK_ROWS)
+  {
+    for(vec_itr = 0; vec_itr < nc; vec_itr += BLK_ROWS)
+    {
+      ae_int32x4 *p_acc_0 = (ae_int32x4 *)(p_acc + m_itr * nc + vec_itr * BLK_ROWS);
+      ae_int8x16 *p_mat1_0 = (ae_int8x16 *)(p_a + m_itr * kc);
+      ae_int8x16 *p_vec_0 = (ae_int8x16 *)(p_b + vec_itr * kc);
+
+      ae_int32x2 acc_row0_vec0, acc_row1_vec0;
+      ae_int32x2 acc_row0_vec1, acc_row1_vec1;
+      ae_int32x2 acc_row0_vec2, acc_row1_vec2;
+      ae_int32x2 acc_row0_vec3, acc_row1_vec3;
+
+      AE_L32X2X2_I(acc_row0_vec0, acc_row1_vec0, p_acc_0, 0);
+      AE_L32X2X2_I(acc_row0_vec1, acc_row1_vec1, p_acc_0, 16);
+      AE_L32X2X2_I(acc_row0_vec2, acc_row1_vec2, p_acc_0, 32);
+      AE_L32X2X2_I(acc_row0_vec3, acc_row1_vec3, p_acc_0, 48);
+
+      for(c_itr = 0; c_itr < (kc >> 4); c_itr++)
+      {
+        AE_L8X8X2_IP(mat1_row0_0, mat1_row0_1, p_mat1_0, 16);
+        AE_L8X8X2_IP(mat1_row1_0, mat1_row1_1, p_mat1_0, 16);
+        AE_L8X8X2_IP(mat1_row2_0, mat1_row2_1, p_mat1_0, 16);
+        AE_L8X8X2_IP(mat1_row3_0, mat1_row3_1, p_mat1_0, 16);
+
+        AE_L8X8X2_IP(vec0_batch_0, vec0_batch_1, p_vec_0, 16);
+        AE_L8X8X2_IP(vec1_batch_0, vec1_batch_1, p_vec_0, 16);
+        AE_L8X8X2_IP(vec2_batch_0, vec2_batch_1, p_vec_0, 16);
+        AE_L8X8X2_IP(vec3_batch_0, vec3_batch_1, p_vec_0, 16);
+
+        AE_MULA8Q8X8(acc_row0_vec0, acc_row1_vec0, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec0_batch_0);
+        AE_MULA8Q8X8(acc_row0_vec1, acc_row1_vec1, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec1_batch_0);
+        AE_MULA8Q8X8(acc_row0_vec2, acc_row1_vec2, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec2_batch_0);
+        AE_MULA8Q8X8(acc_row0_vec3, acc_row1_vec3, mat1_row0_0, mat1_row1_0, mat1_row2_0, mat1_row3_0, vec3_batch_0);
+
+        AE_MULA8Q8X8(acc_row0_vec0, acc_row1_vec0, mat1_row0_1, mat1_row1_1, mat1_row2_1, mat1_row3_1, vec0_batch_1);
+        AE_MULA8Q8X8(acc_row0_vec1, acc_row1_vec1, mat1_row0_1, mat1_row1_1, mat1_row2_1, mat1_row3_1, vec1_batch_1);
+        AE_MULA8Q8X8(acc_row0_vec2, acc_row1_vec2, mat1_row0_1, mat1_row1_1, mat1_row2_1, mat1_row3_1, vec2_batch_1);
+        AE_MULA8Q8X8(acc_row0_vec3, acc_row1_vec3, mat1_row0_1, mat1_row1_1, mat1_row2_1, mat1_row3_1, vec3_batch_1);
+      }
+
+      AE_S32X2X2_I(acc_row0_vec0, acc_row1_vec0, p_acc_0, 0);
+      AE_S32X2X2_I(acc_row0_vec1, acc_row1_vec1, p_acc_0, 16);
+      AE_S32X2X2_I(acc_row0_vec2, acc_row1_vec2, p_acc_0, 32);
+      AE_S32X2X2_I(acc_row0_vec3, acc_row1_vec3, p_acc_0, 48);
+    }
+  }
+}
+
+typedef struct _gemm_scratch_t
+{
+  WORD8 *p_a;
+  WORD8 *p_b;
+  WORD32 *p_acc;
+  void *p_row;
+} gemm_scratch_t;
+
+static void gemm_scratch_init(
+    gemm_scratch_t *p_s,
+    const xa_nnlib_gemm_blocking_t *p_blocking,
+    void *p_scratch)
+{
+  WORD8 *p_base = (WORD8 *)ALIGN_PTR(p_scratch, 16);
+
+  p_s->p_a = p_base;
+  p_base += ALIGNED_SIZE(p_blocking->mc * p_blocking->kc);
+  p_s->p_b = p_base;
+  p_base += ALIGNED_SIZE(p_blocking->nc * p_blocking->kc);
+  p_s->p_acc = (WORD32 *)p_base;
+  p_base += ALIGNED_SIZE(p_blocking->mc * p_blocking->nc * sizeof(WORD32));
+  p_s->p_row = (void *)p_base;
+}
+
+/* Accumulator tile of rows [ic, ic + mc_cur) x vectors [jc, jc + nc_cur)
+   over all of cols1, with the mat1 row sums in p_row_sum if not NULL */
+static void gemm_tile_8x8(
+    gemm_scratch_t *p_s,
+    const WORD8 *p_mat1,
+    const WORD8 *p_vec1,
+    WORD32 mc_cur,
+    WORD32 nc_cur,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_offset,
+    WORD32 kc,
+    UWORD32 *p_row_sum)
+{
+  int mc_pad = ROUND_UP(mc_cur, BLK_ROWS);
+  int nc_pad = ROUND_UP(nc_cur, BLK_ROWS);
+  int pc, ii;
+
+  memset(p_s->p_acc, 0, mc_pad * nc_pad * sizeof(WORD32));
+  if(p_row_sum)
+  {
+    for(ii = 0; ii < mc_pad; ii++)
+      p_row_sum[ii] = 0;
+  }
+
+  for(pc = 0; pc < cols1; pc += kc)
+  {
+    int kc_cur = cols1 - pc < kc ? cols1 - pc : kc;
+
+    pack_panels_8(p_s->p_a, p_mat1 + pc, mc_cur, kc_cur, row_stride1, p_row_sum);
+    pack_panels_8(p_s->p_b, p_vec1 + pc, nc_cur, kc_cur, vec_offset, NULL);
+    gemm_block_8x8(p_s->p_acc, p_s->p_a, p_s->p_b, mc_pad, nc_pad, ROUND_UP(kc_cur, BLK_COLS));
+  }
+}
+
+static WORD32 check_blocking(
+    const xa_nnlib_gemm_blocking_t *p_blocking)
+{
+  return xa_nn_matmul_blocked_getsize(p_blocking) < 0 ? -1 : 0;
+}
+
+WORD32 xa_nn_matmul_8x8_8_blocked(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    const xa_nnlib_gemm_blocking_t * __restrict__ p_blocking,
+    VOID * __restrict__ p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blocking, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((check_blocking(p_blocking) != 0), -1);
+
+  gemm_scratch_t scratch;
+  ae_int64 *p_bias64;
+  int ic, jc, m_itr, vec_itr, ii;
+
+  /* Bias as in xa_nn_matmul_8x8_8: right shifts saturate in 16 bits, left
+     shifts widen to 64 bits */
+  int neg_bias = (bias_shift <= 0) ? 1 : 0;
+  int rshift_bias = neg_bias ? XT_MIN(16, -bias_shift) : -1;
+  ae_int32x2 lshift_mul_bias = neg_bias ? AE_MOVDA32(1) : AE_MOVDA32(1 << (bias_shift - 1));
+
+  acc_shift = acc_shift + 32;
+
+  gemm_scratch_init(&scratch, p_blocking, p_scratch);
+  p_bias64 = (ae_int64 *)scratch.p_row;
+
+  for(jc = 0; jc < vec_count; jc += p_blocking->nc)
+  {
+    int nc_cur = XT_MIN(p_blocking->nc, vec_count - jc);
+    int nc_pad = ROUND_UP(nc_cur, BLK_ROWS);
+
+    for(ic = 0; ic < rows; ic += p_blocking->mc)
+    {
+      int mc_cur = XT_MIN(p_blocking->mc, rows - ic);
+
+      gemm_tile_8x8(&scratch, p_mat1 + ic * row_stride1, p_vec1 + jc * vec_offset,
+          mc_cur, nc_cur, cols1, row_stride1, vec_offset, p_blocking->kc, NULL);
+
+      for(ii = 0; ii < ROUND_UP(mc_cur, BLK_ROWS); ii++)
+      {
+        ae_int16x4 bias16 = AE_MOVDA16((p_bias && ii < mc_cur) ? p_bias[ic + ii] : 0);
+        bias16 = AE_SRAA16S(bias16, rshift_bias);
+        p_bias64[ii] = AE_MUL32X16_L0(lshift_mul_bias, bias16);
+      }
+
+      for(m_itr = 0; m_itr < mc_cur; m_itr += BLK_ROWS)
+      {
+        ae_int32x4 *p_acc_0 = (ae_int32x4 *)(scratch.p_acc + m_itr * nc_pad);
+        WORD8 *p_dst = p_out + (ic + m_itr) * out_stride + jc * out_offset;
+
+        for(vec_itr = 0; vec_itr < nc_cur; vec_itr++)
+        {
+          ae_int32x2 acc_row01, acc_row23;
+          ae_int64 acc64_0, acc64_1, acc64_2, acc64_3;
+          ae_int8x8 temp_vec0;
+
+          AE_L32X2X2_IP(acc_row01, acc_row23, p_acc_0, 16);
+
+          acc64_0 = p_bias64[m_itr + 0];
+          acc64_1 = p_bias64[m_itr + 1];
+          acc64_2 = p_bias64[m_itr + 2];
+          acc64_3 = p_bias64[m_itr + 3];
+
+          AE_ACCW32(acc64_0, acc64_1, acc_row01, ZERO32);
+          AE_ACCW32(acc64_2, acc64_3, acc_row23, ZERO32);
+
+          acc_row01 = AE_ROUND32X2F64SSYM(AE_SLAA64S(acc64_0, acc_shift), AE_SLAA64S(acc64_1, acc_shift));
+          acc_row23 = AE_ROUND32X2F64SSYM(AE_SLAA64S(acc64_2, acc_shift), AE_SLAA64S(acc64_3, acc_shift));
+
+          temp_vec0 = AE_SAT8X4X32_L(acc_row01, acc_row23);
+
+          p_dst[vec_itr * out_offset] = (WORD8)AE_MOVAD8(temp_vec0, 3);
+          if(m_itr + 1 < mc_cur) p_dst[vec_itr * out_offset + out_stride] = (WORD8)AE_MOVAD8(temp_vec0, 2);
+          if(m_itr + 2 < mc_cur) p_dst[vec_itr * out_offset + 2 * out_stride] = (WORD8)AE_MOVAD8(temp_vec0, 1);
+          if(m_itr + 3 < mc_cur) p_dst[vec_itr * out_offset + 3 * out_stride] = (WORD8)AE_MOVAD8(temp_vec0, 0);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_gemm_blocking_t * __restrict__ p_blocking,
+    VOID * __restrict__ p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_multiplier, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shift, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_blocking, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_multiplier, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shift, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((check_blocking(p_blocking) != 0), -1);
+
+  int itr = 0;
+  for(itr=0; itr<rows; itr++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
+  }
+
+  gemm_scratch_t scratch;
+  UWORD32 *p_row_sum;
+  int ic, jc, m_itr, vec_itr, ii;
+
+  gemm_scratch_init(&scratch, p_blocking, p_scratch);
+  p_row_sum = (UWORD32 *)scratch.p_row;
+
+  for(jc = 0; jc < vec_count; jc += p_blocking->nc)
+  {
+    int nc_cur = XT_MIN(p_blocking->nc, vec_count - jc);
+    int nc_pad = ROUND_UP(nc_cur, BLK_ROWS);
+
+    for(ic = 0; ic < rows; ic += p_blocking->mc)
+    {
+      int mc_cur = XT_MIN(p_blocking->mc, rows - ic);
+
+      gemm_tile_8x8(&scratch, p_mat1 + ic * row_stride1, p_vec1 + jc * vec_offset,
+          mc_cur, nc_cur, cols1, row_stride1, vec_offset, p_blocking->kc, p_row_sum);
+
+      for(m_itr = 0; m_itr < mc_cur; m_itr += BLK_ROWS)
+      {
+        ae_int32x4 *p_acc_0 = (ae_int32x4 *)(scratch.p_acc + m_itr * nc_pad);
+        WORD8 *p_dst = p_out + (ic + m_itr) * out_stride + jc * out_offset;
+        WORD32 p_bias_sub[4], p_zb_sum[4];
+        int p_left_mult[4], p_right_mult[4], p_out_mult[4];
+
+        /* bias - sum(mat1 * -vec1_zero_bias), saturated as in the
+           unblocked kernel; padding rows get a zero multiplier */
+        for(ii = 0; ii < BLK_ROWS; ii++)
+        {
+          int m = ic + m_itr + ii;
+          int valid = (m_itr + ii) < mc_cur;
+          int shift = valid ? p_out_shift[m] : 0;
+
+          p_bias_sub[ii] = (valid && p_bias) ? p_bias[m] : 0;
+          p_zb_sum[ii] = valid ? (WORD32)(p_row_sum[m_itr + ii] * (UWORD32)(-vec1_zero_bias)) : 0;
+          p_left_mult[ii] = shift < 0 ? 1 : (1 << shift);
+          p_right_mult[ii] = shift > 0 ? (0xFFFFFFFF << 31) : (0xFFFFFFFF << (31 + shift));
+          p_out_mult[ii] = valid ? -p_out_multiplier[m] : 0;
+        }
+
+        ae_int32x2 bias_01 = AE_SUB32S(AE_MOVDA32X2(p_bias_sub[0], p_bias_sub[1]), AE_MOVDA32X2(p_zb_sum[0], p_zb_sum[1]));
+        ae_int32x2 bias_23 = AE_SUB32S(AE_MOVDA32X2(p_bias_sub[2], p_bias_sub[3]), AE_MOVDA32X2(p_zb_sum[2], p_zb_sum[3]));
+
+        ae_int32x2 l_mult_23, l_mult_01, r_mult_23, r_mult_01;
+        ae_int32x2 out_multiplier_01, out_multiplier_23;
+        AE_L32X2X2_I(l_mult_01, l_mult_23, (ae_int32x4 *)p_left_mult, 0);
+        AE_L32X2X2_I(r_mult_01, r_mult_23, (ae_int32x4 *)p_right_mult, 0);
+        AE_L32X2X2_I(out_multiplier_01, out_multiplier_23, (ae_int32x4 *)p_out_mult, 0);
+
+        for(vec_itr = 0; vec_itr < nc_cur; vec_itr++)
+        {
+          ae_int32x2 acc_row01, acc_row23;
+          ae_int16x4 out_0;
+
+          AE_L32X2X2_IP(acc_row01, acc_row23, p_acc_0, 16);
+          acc_row01 = AE_ADD32(acc_row01, bias_01);
+          acc_row23 = AE_ADD32(acc_row23, bias_23);
+
+          MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2(out_0, acc_row01, acc_row23, out_multiplier_23, out_multiplier_01, l_mult_23, l_mult_01, r_mult_23, r_mult_01, out_zero_bias);
+
+          p_dst[vec_itr * out_offset] = (WORD8)AE_MOVAD16_3(out_0);
+          if(m_itr + 1 < mc_cur) p_dst[vec_itr * out_offset + out_stride] = (WORD8)AE_MOVAD16_2(out_0);
+          if(m_itr + 2 < mc_cur) p_dst[vec_itr * out_offset + 2 * out_stride] = (WORD8)AE_MOVAD16_1(out_0);
+          if(m_itr + 3 < mc_cur) p_dst[vec_itr * out_offset + 3 * out_stride] = (WORD8)AE_MOVAD16_0(out_0);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
@@ -22,6 +22,10 @@
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros_hifi5.h"
 
+#if XA_NNLIB_HOST_SIMD
+#include "xa_nnlib_host_simd.h"
+#endif
+
 #define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
   inp = AE_SLAA32(inp, left_shift); \
   inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
@@ -592,7 +596,7 @@ static inline void _xa_nn_dot_product_4_rows_4_vecs_offset_aligned
   ae_int8x8 mat1_row2_0, mat1_row2_1;
   ae_int8x8 mat1_row3_0, mat1_row3_1;
 
-  int align_offset = ((unsigned int)p_mat1_0 & 0x7);
+  int align_offset = ((uintptr_t)p_mat1_0 & 0x7);
   pre_loop_count = 8 - align_offset;
   pre_loop_shift = align_offset * 8;
   p_mat1_0 = (ae_int8x8 *)((ae_int8 *)p_mat1_0 - align_offset);
@@ -1096,6 +1100,15 @@ WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
     XA_NNLIB_ARG_CHK_COND((p_out_shift[itr] < -31 || p_out_shift[itr] > 31), -1);
   }
 
+#if XA_NNLIB_HOST_SIMD
+  if(xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_host(p_out, p_mat1, p_vec1, p_bias, rows, cols1, row_stride1,
+      vec_count, vec_offset, out_offset, out_stride, vec1_zero_bias,
+      p_out_multiplier, p_out_shift, out_zero_bias) == 0)
+  {
+    return 0;
+  }
+#endif
+
   ae_int32x2 acc_buffer[4];
   WORD8 * __restrict__ p_dst_0;
   ae_int8* __restrict__ p_vec_0;
@@ -1738,10 +1751,11 @@ WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
     ae_int8x8 mat1_row3_0, mat1_row3_1;
 
     int rem_cols = cols1 & 15;
-    int rem_cols_shift_0 = ((rem_cols) <= 8)?(8 - (rem_cols)) * 8:0;
-    int rem_cols_shift_1 = ((rem_cols) > 8)?(16 - (rem_cols)) * 8:64;
     for(m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
     {
+      /* Per group of rows: the remainder loop below advances rem_cols_shift_0 */
+      int rem_cols_shift_0 = ((rem_cols) <= 8)?(8 - (rem_cols)) * 8:0;
+      int rem_cols_shift_1 = ((rem_cols) > 8)?(16 - (rem_cols)) * 8:64;
       ae_int8x8 *p_mat1_0 = (ae_int8x8 *) &p_mat1[(m_itr + 0) * row_stride1];
       ae_int8x8 *p_mat1_1 = (ae_int8x8*)((WORD8 *)p_mat1_0 + row_stride1); 
       ae_int8x8 *p_mat1_2 = (ae_int8x8*)((WORD8 *)p_mat1_1 + row_stride1); 
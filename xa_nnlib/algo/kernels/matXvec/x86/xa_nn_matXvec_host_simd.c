@@ -0,0 +1,876 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * AVX2/AVX-512 host paths of the 16x16, 8x16 and sym8sxasym8s
+ * matXvec/matmul kernels (see xa_nnlib_host_simd.h).
+ *
+ * The dot products are exact: 16-bit products are widened to the 64-bit
+ * accumulators of the HiFi5 kernels, 8-bit products keep the wrapping
+ * 32-bit accumulation. Outputs are then produced with the same saturation
+ * and rounding helpers the intrinsic emulation uses, following the
+ * requantization sequence the HiFi5 kernel applies to each output.
+ */
+#include <stdint.h>
+#include <immintrin.h>
+#include "xtensa/tie/xt_hifi2.h"
+#include "xa_nnlib_host_simd.h"
+
+#define HOST_AVX2   __attribute__((target("avx2")))
+#define HOST_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+
+#define MIN(a, b)   ((a) < (b) ? (a) : (b))
+
+/*-----------------------------------------------------------------------------
+ * Dot products of up to four rows, row_stride elements apart, with one
+ * vector. Rows beyond nrows repeat the last row and are not stored. Results
+ * are added to acc[].
+ *---------------------------------------------------------------------------*/
+
+/* Sign-extend the 32-bit lanes of x and add them to the 64-bit lanes of acc;
+   only the horizontal sum of acc is used, so the lane order is irrelevant */
+HOST_AVX2 static inline __m256i add_epi32_epi64_avx2(__m256i acc, __m256i x)
+{
+  __m256i s = _mm256_srai_epi32(x, 31);
+  acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(x, s));
+  return _mm256_add_epi64(acc, _mm256_unpackhi_epi32(x, s));
+}
+
+HOST_AVX2 static inline int64_t hsum_epi64_avx2(__m256i x)
+{
+  __m128i s = _mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+  return (int64_t)((uint64_t)_mm_cvtsi128_si64(s) + (uint64_t)_mm_extract_epi64(s, 1));
+}
+
+HOST_AVX2 static inline int32_t hsum_epi32_avx2(__m256i x)
+{
+  __m128i s = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4e));
+  s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xb1));
+  return _mm_cvtsi128_si32(s);
+}
+
+HOST_AVX512 static inline __m512i add_epi32_epi64_avx512(__m512i acc, __m512i x)
+{
+  __m512i s = _mm512_srai_epi32(x, 31);
+  acc = _mm512_add_epi64(acc, _mm512_unpacklo_epi32(x, s));
+  return _mm512_add_epi64(acc, _mm512_unpackhi_epi32(x, s));
+}
+
+/*
+ * 16x16: madd_epi16 wraps only when both pairs are -32768 * -32768, so each
+ * pair sum is biased by -1 to keep it exact in 32 bits. The bias, one per
+ * pair of columns, is added back after the reduction.
+ */
+HOST_AVX2 static void dot_16x16_avx2(int64_t *acc, const WORD16 *p_mat, int row_stride, int nrows,
+                                     const WORD16 *p_vec, int cols)
+{
+  const WORD16 *m0 = p_mat;
+  const WORD16 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const WORD16 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const WORD16 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+  int c;
+
+  for(c = 0; c + 16 <= cols; c += 16)
+  {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(p_vec + c));
+    a0 = add_epi32_epi64_avx2(a0, _mm256_sub_epi32(_mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)(m0 + c)), v), one));
+    a1 = add_epi32_epi64_avx2(a1, _mm256_sub_epi32(_mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)(m1 + c)), v), one));
+    a2 = add_epi32_epi64_avx2(a2, _mm256_sub_epi32(_mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)(m2 + c)), v), one));
+    a3 = add_epi32_epi64_avx2(a3, _mm256_sub_epi32(_mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)(m3 + c)), v), one));
+  }
+  int64_t s0 = hsum_epi64_avx2(a0) + (c >> 1);
+  int64_t s1 = hsum_epi64_avx2(a1) + (c >> 1);
+  int64_t s2 = hsum_epi64_avx2(a2) + (c >> 1);
+  int64_t s3 = hsum_epi64_avx2(a3) + (c >> 1);
+  for(; c < cols; c++)
+  {
+    s0 += (int32_t)m0[c] * p_vec[c];
+    s1 += (int32_t)m1[c] * p_vec[c];
+    s2 += (int32_t)m2[c] * p_vec[c];
+    s3 += (int32_t)m3[c] * p_vec[c];
+  }
+  acc[0] += s0; acc[1] += s1; acc[2] += s2; acc[3] += s3;
+}
+
+HOST_AVX512 static void dot_16x16_avx512(int64_t *acc, const WORD16 *p_mat, int row_stride, int nrows,
+                                         const WORD16 *p_vec, int cols)
+{
+  const WORD16 *m0 = p_mat;
+  const WORD16 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const WORD16 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const WORD16 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  const __m512i one = _mm512_set1_epi32(1);
+  __m512i a0 = _mm512_setzero_si512(), a1 = a0, a2 = a0, a3 = a0;
+  int c;
+
+  for(c = 0; c + 32 <= cols; c += 32)
+  {
+    __m512i v = _mm512_loadu_si512(p_vec + c);
+    a0 = add_epi32_epi64_avx512(a0, _mm512_sub_epi32(_mm512_madd_epi16(_mm512_loadu_si512(m0 + c), v), one));
+    a1 = add_epi32_epi64_avx512(a1, _mm512_sub_epi32(_mm512_madd_epi16(_mm512_loadu_si512(m1 + c), v), one));
+    a2 = add_epi32_epi64_avx512(a2, _mm512_sub_epi32(_mm512_madd_epi16(_mm512_loadu_si512(m2 + c), v), one));
+    a3 = add_epi32_epi64_avx512(a3, _mm512_sub_epi32(_mm512_madd_epi16(_mm512_loadu_si512(m3 + c), v), one));
+  }
+  int64_t s0 = _mm512_reduce_add_epi64(a0) + (c >> 1);
+  int64_t s1 = _mm512_reduce_add_epi64(a1) + (c >> 1);
+  int64_t s2 = _mm512_reduce_add_epi64(a2) + (c >> 1);
+  int64_t s3 = _mm512_reduce_add_epi64(a3) + (c >> 1);
+  for(; c < cols; c++)
+  {
+    s0 += (int32_t)m0[c] * p_vec[c];
+    s1 += (int32_t)m1[c] * p_vec[c];
+    s2 += (int32_t)m2[c] * p_vec[c];
+    s3 += (int32_t)m3[c] * p_vec[c];
+  }
+  acc[0] += s0; acc[1] += s1; acc[2] += s2; acc[3] += s3;
+}
+
+/*
+ * 8x16: a pair sum is below 2^23 in magnitude, so up to 2^7 steps are
+ * accumulated in 32 bits before widening.
+ */
+#define DOT_8X16_BLOCK  2048
+
+HOST_AVX2 static void dot_8x16_avx2(int64_t *acc, const WORD8 *p_mat, int row_stride, int nrows,
+                                    const WORD16 *p_vec, int cols)
+{
+  const WORD8 *m0 = p_mat;
+  const WORD8 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const WORD8 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const WORD8 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+  int c = 0;
+
+  while(c + 16 <= cols)
+  {
+    int c_end = MIN(cols, c + DOT_8X16_BLOCK);
+    __m256i b0 = _mm256_setzero_si256(), b1 = b0, b2 = b0, b3 = b0;
+    for(; c + 16 <= c_end; c += 16)
+    {
+      __m256i v = _mm256_loadu_si256((const __m256i *)(p_vec + c));
+      b0 = _mm256_add_epi32(b0, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m0 + c))), v));
+      b1 = _mm256_add_epi32(b1, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m1 + c))), v));
+      b2 = _mm256_add_epi32(b2, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m2 + c))), v));
+      b3 = _mm256_add_epi32(b3, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m3 + c))), v));
+    }
+    a0 = add_epi32_epi64_avx2(a0, b0);
+    a1 = add_epi32_epi64_avx2(a1, b1);
+    a2 = add_epi32_epi64_avx2(a2, b2);
+    a3 = add_epi32_epi64_avx2(a3, b3);
+  }
+  int64_t s0 = hsum_epi64_avx2(a0);
+  int64_t s1 = hsum_epi64_avx2(a1);
+  int64_t s2 = hsum_epi64_avx2(a2);
+  int64_t s3 = hsum_epi64_avx2(a3);
+  for(; c < cols; c++)
+  {
+    s0 += (int32_t)m0[c] * p_vec[c];
+    s1 += (int32_t)m1[c] * p_vec[c];
+    s2 += (int32_t)m2[c] * p_vec[c];
+    s3 += (int32_t)m3[c] * p_vec[c];
+  }
+  acc[0] += s0; acc[1] += s1; acc[2] += s2; acc[3] += s3;
+}
+
+HOST_AVX512 static void dot_8x16_avx512(int64_t *acc, const WORD8 *p_mat, int row_stride, int nrows,
+                                        const WORD16 *p_vec, int cols)
+{
+  const WORD8 *m0 = p_mat;
+  const WORD8 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const WORD8 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const WORD8 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  __m512i a0 = _mm512_setzero_si512(), a1 = a0, a2 = a0, a3 = a0;
+  int c = 0;
+
+  while(c + 32 <= cols)
+  {
+    int c_end = MIN(cols, c + 2 * DOT_8X16_BLOCK);
+    __m512i b0 = _mm512_setzero_si512(), b1 = b0, b2 = b0, b3 = b0;
+    for(; c + 32 <= c_end; c += 32)
+    {
+      __m512i v = _mm512_loadu_si512(p_vec + c);
+      b0 = _mm512_add_epi32(b0, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m0 + c))), v));
+      b1 = _mm512_add_epi32(b1, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m1 + c))), v));
+      b2 = _mm512_add_epi32(b2, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m2 + c))), v));
+      b3 = _mm512_add_epi32(b3, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m3 + c))), v));
+    }
+    a0 = add_epi32_epi64_avx512(a0, b0);
+    a1 = add_epi32_epi64_avx512(a1, b1);
+    a2 = add_epi32_epi64_avx512(a2, b2);
+    a3 = add_epi32_epi64_avx512(a3, b3);
+  }
+  int64_t s0 = _mm512_reduce_add_epi64(a0);
+  int64_t s1 = _mm512_reduce_add_epi64(a1);
+  int64_t s2 = _mm512_reduce_add_epi64(a2);
+  int64_t s3 = _mm512_reduce_add_epi64(a3);
+  for(; c < cols; c++)
+  {
+    s0 += (int32_t)m0[c] * p_vec[c];
+    s1 += (int32_t)m1[c] * p_vec[c];
+    s2 += (int32_t)m2[c] * p_vec[c];
+    s3 += (int32_t)m3[c] * p_vec[c];
+  }
+  acc[0] += s0; acc[1] += s1; acc[2] += s2; acc[3] += s3;
+}
+
+/*
+ * 8x8 with the vector zero bias folded into the vector: products of a
+ * [-128, 127] weight and a [-255, 255] input cannot overflow a pair sum,
+ * and the 32-bit accumulation wraps as on the core.
+ */
+HOST_AVX2 static void dot_8x8_avx2(WORD32 *acc, const WORD8 *p_mat, int row_stride, int nrows,
+                                   const WORD8 *p_vec, int vec_zero_bias, int cols)
+{
+  const WORD8 *m0 = p_mat;
+  const WORD8 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const WORD8 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const WORD8 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  const __m256i zb = _mm256_set1_epi16((short)vec_zero_bias);
+  __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+  int c;
+
+  for(c = 0; c + 16 <= cols; c += 16)
+  {
+    __m256i v = _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(p_vec + c))), zb);
+    a0 = _mm256_add_epi32(a0, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m0 + c))), v));
+    a1 = _mm256_add_epi32(a1, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m1 + c))), v));
+    a2 = _mm256_add_epi32(a2, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m2 + c))), v));
+    a3 = _mm256_add_epi32(a3, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(m3 + c))), v));
+  }
+  uint32_t s0 = (uint32_t)hsum_epi32_avx2(a0);
+  uint32_t s1 = (uint32_t)hsum_epi32_avx2(a1);
+  uint32_t s2 = (uint32_t)hsum_epi32_avx2(a2);
+  uint32_t s3 = (uint32_t)hsum_epi32_avx2(a3);
+  for(; c < cols; c++)
+  {
+    int v = p_vec[c] + vec_zero_bias;
+    s0 += (uint32_t)(m0[c] * v);
+    s1 += (uint32_t)(m1[c] * v);
+    s2 += (uint32_t)(m2[c] * v);
+    s3 += (uint32_t)(m3[c] * v);
+  }
+  acc[0] = (WORD32)((uint32_t)acc[0] + s0);
+  acc[1] = (WORD32)((uint32_t)acc[1] + s1);
+  acc[2] = (WORD32)((uint32_t)acc[2] + s2);
+  acc[3] = (WORD32)((uint32_t)acc[3] + s3);
+}
+
+HOST_AVX512 static void dot_8x8_avx512(WORD32 *acc, const WORD8 *p_mat, int row_stride, int nrows,
+                                       const WORD8 *p_vec, int vec_zero_bias, int cols)
+{
+  const WORD8 *m0 = p_mat;
+  const WORD8 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const WORD8 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const WORD8 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  const __m512i zb = _mm512_set1_epi16((short)vec_zero_bias);
+  __m512i a0 = _mm512_setzero_si512(), a1 = a0, a2 = a0, a3 = a0;
+  int c;
+
+  for(c = 0; c + 32 <= cols; c += 32)
+  {
+    __m512i v = _mm512_add_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(p_vec + c))), zb);
+    a0 = _mm512_add_epi32(a0, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m0 + c))), v));
+    a1 = _mm512_add_epi32(a1, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m1 + c))), v));
+    a2 = _mm512_add_epi32(a2, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m2 + c))), v));
+    a3 = _mm512_add_epi32(a3, _mm512_madd_epi16(_mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)(m3 + c))), v));
+  }
+  uint32_t s0 = (uint32_t)_mm512_reduce_add_epi32(a0);
+  uint32_t s1 = (uint32_t)_mm512_reduce_add_epi32(a1);
+  uint32_t s2 = (uint32_t)_mm512_reduce_add_epi32(a2);
+  uint32_t s3 = (uint32_t)_mm512_reduce_add_epi32(a3);
+  for(; c < cols; c++)
+  {
+    int v = p_vec[c] + vec_zero_bias;
+    s0 += (uint32_t)(m0[c] * v);
+    s1 += (uint32_t)(m1[c] * v);
+    s2 += (uint32_t)(m2[c] * v);
+    s3 += (uint32_t)(m3[c] * v);
+  }
+  acc[0] = (WORD32)((uint32_t)acc[0] + s0);
+  acc[1] = (WORD32)((uint32_t)acc[1] + s1);
+  acc[2] = (WORD32)((uint32_t)acc[2] + s2);
+  acc[3] = (WORD32)((uint32_t)acc[3] + s3);
+}
+
+static inline void dot_16x16(xa_nnlib_host_simd_t isa, int64_t *acc, const WORD16 *p_mat, int row_stride,
+                             int nrows, const WORD16 *p_vec, int cols)
+{
+  if(isa == XA_NNLIB_HOST_SIMD_AVX512)
+    dot_16x16_avx512(acc, p_mat, row_stride, nrows, p_vec, cols);
+  else
+    dot_16x16_avx2(acc, p_mat, row_stride, nrows, p_vec, cols);
+}
+
+static inline void dot_8x16(xa_nnlib_host_simd_t isa, int64_t *acc, const WORD8 *p_mat, int row_stride,
+                            int nrows, const WORD16 *p_vec, int cols)
+{
+  if(isa == XA_NNLIB_HOST_SIMD_AVX512)
+    dot_8x16_avx512(acc, p_mat, row_stride, nrows, p_vec, cols);
+  else
+    dot_8x16_avx2(acc, p_mat, row_stride, nrows, p_vec, cols);
+}
+
+static inline void dot_8x8(xa_nnlib_host_simd_t isa, WORD32 *acc, const WORD8 *p_mat, int row_stride,
+                           int nrows, const WORD8 *p_vec, int vec_zero_bias, int cols)
+{
+  if(isa == XA_NNLIB_HOST_SIMD_AVX512)
+    dot_8x8_avx512(acc, p_mat, row_stride, nrows, p_vec, vec_zero_bias, cols);
+  else
+    dot_8x8_avx2(acc, p_mat, row_stride, nrows, p_vec, vec_zero_bias, cols);
+}
+
+/*
+ * 8x8 on a block of four rows packed by xa_nn_pack_weights_8: the rows are
+ * interleaved 16 columns at a time and padded with zero weights, so the
+ * last partial chunk reads the vector from a zero-filled copy.
+ */
+HOST_AVX2 static void dot_8x8_packed_avx2(WORD32 *acc, const WORD8 *p_blk, const WORD8 *p_vec,
+                                          int vec_zero_bias, int cols)
+{
+  const __m256i zb = _mm256_set1_epi16((short)vec_zero_bias);
+  __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+  WORD8 tail[16];
+  int c, ii;
+
+  for(c = 0; c < cols; c += 16, p_blk += 64)
+  {
+    const WORD8 *p_v = p_vec + c;
+    if(c + 16 > cols)
+    {
+      for(ii = 0; ii < 16; ii++)
+        tail[ii] = (c + ii < cols) ? p_vec[c + ii] : 0;
+      p_v = tail;
+    }
+    __m256i v = _mm256_add_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)p_v)), zb);
+    a0 = _mm256_add_epi32(a0, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_blk +  0))), v));
+    a1 = _mm256_add_epi32(a1, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_blk + 16))), v));
+    a2 = _mm256_add_epi32(a2, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_blk + 32))), v));
+    a3 = _mm256_add_epi32(a3, _mm256_madd_epi16(_mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_blk + 48))), v));
+  }
+  acc[0] = (WORD32)((uint32_t)acc[0] + (uint32_t)hsum_epi32_avx2(a0));
+  acc[1] = (WORD32)((uint32_t)acc[1] + (uint32_t)hsum_epi32_avx2(a1));
+  acc[2] = (WORD32)((uint32_t)acc[2] + (uint32_t)hsum_epi32_avx2(a2));
+  acc[3] = (WORD32)((uint32_t)acc[3] + (uint32_t)hsum_epi32_avx2(a3));
+}
+
+/*
+ * One block of the cache-blocked matmul on 4 x 16 interleaved panels. Two
+ * vectors share each widened row chunk, which keeps the 8 accumulators,
+ * 4 rows and 2 vectors within the 16 ymm registers.
+ */
+HOST_AVX2 static void gemm_tile_8x8_avx2(WORD32 *p_acc, const WORD8 *p_a, const WORD8 *p_b,
+                                         int mc, int nc, int kc)
+{
+  int m, v, c;
+
+  for(m = 0; m < mc; m += 4)
+  {
+    const WORD8 *p_rows = p_a + m * kc;
+    for(v = 0; v < nc; v += 2)
+    {
+      const WORD8 *p_vecs = p_b + (v & ~3) * kc + (v & 3) * 16;
+      WORD32 *p_tile = p_acc + m * nc + v * 4;
+      __m256i a00 = _mm256_setzero_si256(), a10 = a00, a20 = a00, a30 = a00;
+      __m256i a01 = a00, a11 = a00, a21 = a00, a31 = a00;
+
+      for(c = 0; c < kc * 4; c += 64)
+      {
+        __m256i v0 = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_vecs + c)));
+        __m256i v1 = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_vecs + c + 16)));
+        __m256i r0 = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_rows + c)));
+        __m256i r1 = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_rows + c + 16)));
+        __m256i r2 = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_rows + c + 32)));
+        __m256i r3 = _mm256_cvtepi8_epi16(_mm_load_si128((const __m128i *)(p_rows + c + 48)));
+        a00 = _mm256_add_epi32(a00, _mm256_madd_epi16(r0, v0));
+        a10 = _mm256_add_epi32(a10, _mm256_madd_epi16(r1, v0));
+        a20 = _mm256_add_epi32(a20, _mm256_madd_epi16(r2, v0));
+        a30 = _mm256_add_epi32(a30, _mm256_madd_epi16(r3, v0));
+        a01 = _mm256_add_epi32(a01, _mm256_madd_epi16(r0, v1));
+        a11 = _mm256_add_epi32(a11, _mm256_madd_epi16(r1, v1));
+        a21 = _mm256_add_epi32(a21, _mm256_madd_epi16(r2, v1));
+        a31 = _mm256_add_epi32(a31, _mm256_madd_epi16(r3, v1));
+      }
+      p_tile[0] = (WORD32)((uint32_t)p_tile[0] + (uint32_t)hsum_epi32_avx2(a00));
+      p_tile[1] = (WORD32)((uint32_t)p_tile[1] + (uint32_t)hsum_epi32_avx2(a10));
+      p_tile[2] = (WORD32)((uint32_t)p_tile[2] + (uint32_t)hsum_epi32_avx2(a20));
+      p_tile[3] = (WORD32)((uint32_t)p_tile[3] + (uint32_t)hsum_epi32_avx2(a30));
+      p_tile[4] = (WORD32)((uint32_t)p_tile[4] + (uint32_t)hsum_epi32_avx2(a01));
+      p_tile[5] = (WORD32)((uint32_t)p_tile[5] + (uint32_t)hsum_epi32_avx2(a11));
+      p_tile[6] = (WORD32)((uint32_t)p_tile[6] + (uint32_t)hsum_epi32_avx2(a21));
+      p_tile[7] = (WORD32)((uint32_t)p_tile[7] + (uint32_t)hsum_epi32_avx2(a31));
+    }
+  }
+}
+
+/*
+ * u8 x u8 with no zero biases (the folded asym8u kernels): both operands
+ * zero-extend to 16 bits, a pair sum of 255 * 255 products fits in 32 bits
+ * and the 32-bit accumulation wraps as on the core.
+ */
+HOST_AVX2 static void dot_u8xu8_avx2(WORD32 *acc, const UWORD8 *p_mat, int row_stride, int nrows,
+                                     const UWORD8 *p_vec, int cols)
+{
+  const UWORD8 *m0 = p_mat;
+  const UWORD8 *m1 = p_mat + MIN(1, nrows - 1) * row_stride;
+  const UWORD8 *m2 = p_mat + MIN(2, nrows - 1) * row_stride;
+  const UWORD8 *m3 = p_mat + MIN(3, nrows - 1) * row_stride;
+  __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+  int c;
+
+  for(c = 0; c + 16 <= cols; c += 16)
+  {
+    __m256i v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(p_vec + c)));
+    a0 = _mm256_add_epi32(a0, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(m0 + c))), v));
+    a1 = _mm256_add_epi32(a1, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(m1 + c))), v));
+    a2 = _mm256_add_epi32(a2, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(m2 + c))), v));
+    a3 = _mm256_add_epi32(a3, _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(m3 + c))), v));
+  }
+  uint32_t s0 = (uint32_t)hsum_epi32_avx2(a0);
+  uint32_t s1 = (uint32_t)hsum_epi32_avx2(a1);
+  uint32_t s2 = (uint32_t)hsum_epi32_avx2(a2);
+  uint32_t s3 = (uint32_t)hsum_epi32_avx2(a3);
+  for(; c < cols; c++)
+  {
+    uint32_t v = p_vec[c];
+    s0 += m0[c] * v;
+    s1 += m1[c] * v;
+    s2 += m2[c] * v;
+    s3 += m3[c] * v;
+  }
+  acc[0] = (WORD32)((uint32_t)acc[0] + s0);
+  acc[1] = (WORD32)((uint32_t)acc[1] + s1);
+  acc[2] = (WORD32)((uint32_t)acc[2] + s2);
+  acc[3] = (WORD32)((uint32_t)acc[3] + s3);
+}
+
+/*-----------------------------------------------------------------------------
+ * Output stages
+ *---------------------------------------------------------------------------*/
+
+/* STORE_ACC_*_AT_OUT_16b: AE_SLAA64S, AE_ROUND32F64SSYM, AE_SAT16X4 */
+static inline WORD16 store_64_16(int64_t acc, int acc_shift)
+{
+  return cstub_sat16(cstub_rnd32f64_sym(cstub_slaa(acc, acc_shift, 64, 1)));
+}
+
+static inline WORD8 clamp_8(WORD32 x)
+{
+  return (WORD8)(x < -128 ? -128 : (x > 127 ? 127 : x));
+}
+
+/* MULTIPLYBYQUANTIZEDMULTIPLIER_X2, AE_ADD32S, clamp */
+static inline WORD8 requant_x2(WORD32 acc, WORD32 mult, int left_shift, int right_shift, WORD32 zero_bias)
+{
+  WORD32 t = (WORD32)cstub_slaa(acc, left_shift, 32, 0);
+  t = cstub_mulf32_ras(t, mult);
+  t = cstub_sraa32_syms(t, right_shift);
+  return clamp_8(cstub_sat32((int64_t)t + zero_bias));
+}
+
+/* MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2: saturating left multiply, 16-bit
+   zero bias addition */
+static inline WORD8 requant_x2_x2(WORD32 acc, WORD32 mult, WORD32 left_mult, int right_shift, WORD32 zero_bias)
+{
+  WORD32 t = cstub_sat32(cstub_sat64((__int128)acc * left_mult));
+  t = cstub_mulf32_ras(t, mult);
+  t = cstub_sraa32_syms(t, right_shift);
+  return clamp_8(cstub_sat16((int64_t)cstub_sat16(t) + zero_bias));
+}
+
+/* MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2 of the asym8u kernels: clamp to
+   [0, 255] */
+static inline UWORD8 requant_x2_x2_u8(WORD32 acc, WORD32 mult, WORD32 left_mult, int right_shift, WORD32 zero_bias)
+{
+  WORD32 t = cstub_sat32(cstub_sat64((__int128)acc * left_mult));
+  t = cstub_mulf32_ras(t, mult);
+  t = cstub_sraa32_syms(t, right_shift);
+  t = cstub_sat16((int64_t)cstub_sat16(t) + zero_bias);
+  return (UWORD8)(t < 0 ? 0 : (t > 255 ? 255 : t));
+}
+
+/* MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2: negated multiplier, right
+   shift as a symmetric-rounding Q31 multiply */
+static inline WORD8 requant_per_chan(WORD32 acc, WORD32 neg_mult, WORD32 left_mult, WORD32 right_mult, WORD32 zero_bias)
+{
+  WORD32 t = cstub_sat32(cstub_sat64((__int128)acc * left_mult));
+  t = cstub_mulf32_ras(t, neg_mult);
+  t = cstub_mulf32_rs(t, right_mult);
+  return clamp_8(cstub_sat16((int64_t)cstub_sat16(t) + zero_bias));
+}
+
+/*-----------------------------------------------------------------------------
+ * Kernels
+ *---------------------------------------------------------------------------*/
+
+WORD32 xa_nn_matXvec_16x16_16_host(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_vec2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 acc_shift,
+    WORD32 bias_shift)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+  int mat2 = (p_mat2 && p_vec2);
+  int m_itr, ii;
+
+  if(isa == XA_NNLIB_HOST_SIMD_NONE || !p_bias || !p_mat1 || !p_vec1)
+    return -1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int nrows = MIN(4, rows - m_itr);
+    int64_t acc[4];
+    for(ii = 0; ii < 4; ii++)
+      acc[ii] = cstub_slaa(p_bias[MIN(m_itr + ii, rows - 1)], bias_shift, 64, 1);
+
+    dot_16x16(isa, acc, p_mat1 + m_itr * row_stride1, row_stride1, nrows, p_vec1, cols1);
+    if(mat2)
+      dot_16x16(isa, acc, p_mat2 + m_itr * row_stride2, row_stride2, nrows, p_vec2, cols2);
+
+    for(ii = 0; ii < nrows; ii++)
+      p_out[m_itr + ii] = store_64_16(acc[ii], acc_shift);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_8x16_16_host(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_vec2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 acc_shift,
+    WORD32 bias_shift)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+  int mat2 = (p_mat2 && p_vec2);
+  int m_itr, ii;
+
+  if(isa == XA_NNLIB_HOST_SIMD_NONE || !p_bias || !p_mat1 || !p_vec1)
+    return -1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int nrows = MIN(4, rows - m_itr);
+    int64_t acc[4] = {0, 0, 0, 0};
+
+    dot_8x16(isa, acc, p_mat1 + m_itr * row_stride1, row_stride1, nrows, p_vec1, cols1);
+    if(mat2)
+      dot_8x16(isa, acc, p_mat2 + m_itr * row_stride2, row_stride2, nrows, p_vec2, cols2);
+
+    /* ADD_BIAS_16b_ACC_FOR_8bx16b: the bias is added with saturation */
+    for(ii = 0; ii < nrows; ii++)
+    {
+      int64_t bias = cstub_slaa(p_bias[m_itr + ii], bias_shift, 64, 1);
+      p_out[m_itr + ii] = store_64_16(cstub_sat64((__int128)acc[ii] + bias), acc_shift);
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_host(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  WORD32 left_mult = (WORD32)(1u << left_shift);
+  int m_itr, ii;
+  /* Rows the HiFi5 kernel requantizes with MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2;
+     the others go through MULTIPLYBYQUANTIZEDMULTIPLIER_X2 */
+  int x2_x2_start = 0, x2_x2_end = 0;
+
+  if(isa == XA_NNLIB_HOST_SIMD_NONE)
+    return -1;
+
+  if(!p_mat2)
+  {
+    int aligned = ((((uintptr_t)p_out) & 15) == 0) && ((((uintptr_t)p_mat1) & 15) == 0) &&
+                  ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_bias) & 15) == 0) &&
+                  ((row_stride1 & 15) == 0);
+    if(aligned)
+      ;
+    else if((cols1 == 64) && (row_stride1 == 64) && ((rows & 0x3) == 0) && ((((uintptr_t)p_out) & 3) == 0))
+      x2_x2_end = rows;
+    else
+    {
+      x2_x2_start = rows & ~(64 - 1);
+      x2_x2_end = rows & ~(4 - 1);
+    }
+  }
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int nrows = MIN(4, rows - m_itr);
+    WORD32 acc[4] = {0, 0, 0, 0};
+    if(p_bias)
+      for(ii = 0; ii < nrows; ii++)
+        acc[ii] = p_bias[m_itr + ii];
+
+    dot_8x8(isa, acc, p_mat1 + m_itr * row_stride1, row_stride1, nrows, p_vec1, vec1_zero_bias, cols1);
+    if(p_mat2)
+      dot_8x8(isa, acc, p_mat2 + m_itr * row_stride2, row_stride2, nrows, p_vec2, vec2_zero_bias, cols2);
+
+    for(ii = 0; ii < nrows; ii++)
+    {
+      int m = m_itr + ii;
+      if(m >= x2_x2_start && m < x2_x2_end)
+        p_out[m] = requant_x2_x2(acc[ii], out_multiplier, left_mult, right_shift, out_zero_bias);
+      else
+        p_out[m] = requant_x2(acc[ii], out_multiplier, left_shift, right_shift, out_zero_bias);
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_host(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+  int m_itr, vec_itr, ii, c;
+  /* The special cases of the HiFi5 kernel (NHWC outputs with cols1 a
+     multiple of 8 or 32) use MULTIPLYBYQUANTIZEDMULTIPLIER_per_chan_X2_X2
+     throughout. The generic paths use it only for the last vec_count % 4
+     vectors of a group of four rows; other full groups of four vectors go
+     through MULTIPLYBYQUANTIZEDMULTIPLIER_X2_X2, and the last vec_count % 4
+     vectors of the last rows % 4 rows through MULTIPLYBYQUANTIZEDMULTIPLIER_X2. */
+  int nhwc = ((((uintptr_t)p_vec1) & 15) == 0) && ((((uintptr_t)p_out) & 3) == 0) &&
+             (out_stride == 1) && ((out_offset & 0x3) == 0) && ((rows & 0x3) == 0);
+  int special = nhwc &&
+                ((((cols1 == 8) || (cols1 == 16) || (cols1 == 24) || (cols1 == 32)) &&
+                  (row_stride1 == cols1) && (vec_offset == cols1) && ((vec_count & 0x3) == 0)) ||
+                 (((cols1 & 0x1f) == 0) && (cols1 <= 256) &&
+                  ((row_stride1 & 0x1f) == 0) && ((vec_offset & 0x1f) == 0)));
+  int rows_x4 = rows & ~(4 - 1);
+  int vecs_x4 = vec_count & ~(4 - 1);
+
+  /* The HiFi5 kernel reads the bias unconditionally */
+  if(isa == XA_NNLIB_HOST_SIMD_NONE || !p_bias)
+    return -1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int nrows = MIN(4, rows - m_itr);
+    WORD32 base[4];
+    WORD32 neg_mult[4], left_mult[4], right_mult[4];
+    int left_shift[4], right_shift[4];
+
+    for(ii = 0; ii < nrows; ii++)
+    {
+      int m = m_itr + ii;
+      int shift = p_out_shift[m];
+      const WORD8 *p_row = p_mat1 + m * row_stride1;
+      uint32_t row_sum = 0;
+
+      /* bias - sum(mat * -vec1_zero_bias), saturated as AE_SUB32S */
+      for(c = 0; c < cols1; c++)
+        row_sum += (uint32_t)p_row[c];
+      base[ii] = cstub_sat32((int64_t)p_bias[m] - (WORD32)(row_sum * (uint32_t)(-vec1_zero_bias)));
+
+      left_shift[ii] = shift < 0 ? 0 : shift;
+      right_shift[ii] = shift > 0 ? 0 : -shift;
+      left_mult[ii] = (WORD32)(1u << left_shift[ii]);
+      right_mult[ii] = (WORD32)(shift > 0 ? (0xFFFFFFFFu << 31) : (0xFFFFFFFFu << (31 + shift)));
+      neg_mult[ii] = (WORD32)(0u - (uint32_t)p_out_multiplier[m]);
+    }
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+      WORD32 acc[4] = {0, 0, 0, 0};
+
+      dot_8x8(isa, acc, p_mat1 + m_itr * row_stride1, row_stride1, nrows,
+              p_vec1 + vec_itr * vec_offset, 0, cols1);
+
+      for(ii = 0; ii < nrows; ii++)
+      {
+        int m = m_itr + ii;
+        WORD32 a = (WORD32)((uint32_t)base[ii] + (uint32_t)acc[ii]);
+        WORD8 *p_dst = p_out + m * out_stride + vec_itr * out_offset;
+
+        if(special || (m < rows_x4 && vec_itr >= vecs_x4))
+          *p_dst = requant_per_chan(a, neg_mult[ii], left_mult[ii], right_mult[ii], out_zero_bias);
+        else if(vec_itr < vecs_x4)
+          *p_dst = requant_x2_x2(a, p_out_multiplier[m], left_mult[ii], right_shift[ii], out_zero_bias);
+        else
+          *p_dst = requant_x2(a, p_out_multiplier[m], left_shift[ii], right_shift[ii], out_zero_bias);
+      }
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_packed_host(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  int cols_packed = (cols + 15) & ~15;
+  int m_itr, ii;
+
+  if(isa == XA_NNLIB_HOST_SIMD_NONE)
+    return -1;
+
+  for(m_itr = 0; m_itr < rows; m_itr += 4)
+  {
+    int nrows = MIN(4, rows - m_itr);
+    WORD32 acc[4] = {0, 0, 0, 0};
+    if(p_bias)
+      for(ii = 0; ii < nrows; ii++)
+        acc[ii] = p_bias[m_itr + ii];
+
+    dot_8x8_packed_avx2(acc, p_packed + m_itr * cols_packed, p_vec, vec_zero_bias, cols);
+
+    for(ii = 0; ii < nrows; ii++)
+      p_out[m_itr + ii] = requant_x2(acc[ii], out_multiplier, left_shift, right_shift, out_zero_bias);
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u_folded_host(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_folded_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+  int left_shift = out_shift < 0 ? 0 : out_shift;
+  int right_shift = out_shift > 0 ? 0 : -out_shift;
+  WORD32 left_mult = 1 << left_shift;
+  int vec_itr, m_itr, c_itr, ii;
+
+  if(isa == XA_NNLIB_HOST_SIMD_NONE)
+    return -1;
+
+  for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+  {
+    const UWORD8 *p_vec = p_vec1 + vec_itr * vec_offset;
+    UWORD8 *p_dst = p_out + vec_itr * out_offset;
+    uint32_t vec_sum = 0;
+    for(c_itr = 0; c_itr < cols1; c_itr++)
+      vec_sum += p_vec[c_itr];
+    uint32_t zb_term = (uint32_t)mat1_zero_bias * vec_sum;
+
+    for(m_itr = 0; m_itr < rows; m_itr += 4)
+    {
+      int nrows = MIN(4, rows - m_itr);
+      WORD32 acc[4] = {0, 0, 0, 0};
+      for(ii = 0; ii < nrows; ii++)
+        acc[ii] = (WORD32)((uint32_t)p_folded_bias[m_itr + ii] + zb_term);
+
+      dot_u8xu8_avx2(acc, p_mat1 + m_itr * row_stride1, row_stride1, nrows, p_vec, cols1);
+
+      for(ii = 0; ii < nrows; ii++)
+        p_dst[(m_itr + ii) * out_stride] = requant_x2_x2_u8(acc[ii], out_multiplier, left_mult, right_shift, out_zero_bias);
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_matmul_8x8_blocked_tile_host(
+    WORD32 * __restrict__ p_acc,
+    const WORD8 * __restrict__ p_a,
+    const WORD8 * __restrict__ p_b,
+    WORD32 mc,
+    WORD32 nc,
+    WORD32 kc)
+{
+  xa_nnlib_host_simd_t isa = xa_nnlib_host_simd_level();
+
+  if(isa == XA_NNLIB_HOST_SIMD_NONE)
+    return -1;
+
+  gemm_tile_8x8_avx2(p_acc, p_a, p_b, mc, nc, kc);
+
+  return 0;
+}
@@ -268,7 +268,7 @@ VOID xa_nn_avgpool_init(
     WORD32 out_height,
     WORD32 out_width)
 {
-    pWORD8 p_mem = (pVOID)p_scratch;
+    pWORD8 p_mem = (pWORD8)p_scratch;
     xa_nn_avgpool_state_t *p_state = (xa_nn_avgpool_state_t *)p_mem;
     int state_size;
     int inp_bytewidth;
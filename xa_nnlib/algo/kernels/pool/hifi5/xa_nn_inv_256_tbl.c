@@ -23,6 +23,7 @@
 #define FIX_INV_Q31(x)  (unsigned int)(((unsigned int)1<<31)/((float)x))
 
 /* 1/num in Q31 format for num = 0 - 256 */
+extern const unsigned int inv_256_tbl[257];
 const unsigned int inv_256_tbl[257] = {
     0,
     FIX_INV_Q31(  1), FIX_INV_Q31(  2), FIX_INV_Q31(  3), FIX_INV_Q31(  4),
@@ -214,7 +214,7 @@ WORD32 xa_nn_maxpool_init(
     WORD32 x_padding,
     WORD32 out_width)
 {
-    pWORD8 p_mem = (pVOID)p_scratch;
+    pWORD8 p_mem = (pWORD8)p_scratch;
     xa_nn_maxpool_state_t *p_state = (xa_nn_maxpool_state_t *)p_mem;
     int state_size;
     int inp_bytewidth;
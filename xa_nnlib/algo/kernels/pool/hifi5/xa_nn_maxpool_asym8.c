@@ -126,7 +126,7 @@ static void maxpool_asym8_hw(
 
             p_dst_temp = p_dst;
             p_src2_temp = p_src2;
-            loop_count = 4 - ((WORD32)p_src2_temp & 3);
+            loop_count = 4 - ((uintptr_t)p_src2_temp & 3);
 
             for(i = 0; i < loop_count; i++)
             {
@@ -166,7 +166,7 @@ static void maxpool_asym8_hw(
                 p_dst_temp = p_dst;
                 p_src1_temp = p_dst;
                 p_src2_temp = p_src2;
-                loop_count = 4 - ((WORD32)p_src2_temp & 3);
+                loop_count = 4 - ((uintptr_t)p_src2_temp & 3);
 
                 for(i = 0; i < loop_count; i++)
                 {
@@ -25,11 +25,11 @@
 #include "xa_nnlib_cnn_api.h"
 #include "xa_nnlib_api.h"
 
-#define ALIGN_MEM(_sptr) (((unsigned)((_sptr)+7))&(~7))
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+7))&(~7))
 #define ALIGN_SIZE(n) (((n)+7)&(~7))
 #define scratch_alloc(_sptr, p, type, sz) { p = (type *)_sptr; _sptr += ALIGN_MEM(sz * sizeof(type));}
 #define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
-#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((uintptr_t)(ptr))&(alignment-1)) != 0) return err;
 
 #define  IO_PRECISION_BITS(prec) ((prec == XA_NNLIB_CNN_16bx16b || prec == XA_NNLIB_CNN_8bx16b) ? 16 : ((prec == XA_NNLIB_CNN_8bx8b)   ?  8 : -1))
 #define KER_PRECISION_BITS(prec) ((prec == XA_NNLIB_CNN_8bx8b   || prec == XA_NNLIB_CNN_8bx16b) ?  8 : ((prec == XA_NNLIB_CNN_16bx16b) ? 16 : -1))
@@ -612,10 +612,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
     {
       case XA_NNLIB_CNN_16bx16b:
       {
-        err = xa_nn_conv1d_std_16x16(output,
-                                     input,
-                                     cnn->kernel_std,
-                                     cnn->bias_std,
+        err = xa_nn_conv1d_std_16x16((WORD16 *)output,
+                                     (WORD16 *)input,
+                                     (WORD16 *)cnn->kernel_std,
+                                     (WORD16 *)cnn->bias_std,
                                      config->input_shape.dim.cube.height,
                                      config->input_shape.dim.cube.width,
                                      config->input_shape.dim.cube.depth,
@@ -632,10 +632,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       break;
       case XA_NNLIB_CNN_8bx16b:
       {
-        err = xa_nn_conv1d_std_8x16(output,
-                                    input,
-                                    cnn->kernel_std,
-                                    cnn->bias_std,
+        err = xa_nn_conv1d_std_8x16((WORD16 *)output,
+                                    (WORD16 *)input,
+                                    (WORD8 *)cnn->kernel_std,
+                                    (WORD16 *)cnn->bias_std,
                                     config->input_shape.dim.cube.height,
                                     config->input_shape.dim.cube.width,
                                     config->input_shape.dim.cube.depth,
@@ -652,10 +652,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       break;
       case XA_NNLIB_CNN_8bx8b:
       {
-        err = xa_nn_conv1d_std_8x8(output,
-                                   input,
-                                   cnn->kernel_std,
-                                   cnn->bias_std,
+        err = xa_nn_conv1d_std_8x8((WORD8 *)output,
+                                   (WORD8 *)input,
+                                   (WORD8 *)cnn->kernel_std,
+                                   (WORD8 *)cnn->bias_std,
                                    config->input_shape.dim.cube.height,
                                    config->input_shape.dim.cube.width,
                                    config->input_shape.dim.cube.depth,
@@ -673,10 +673,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 #if HAVE_VFPU
       case XA_NNLIB_CNN_f32xf32:
       {
-        err = xa_nn_conv1d_std_f32(output,
-                                   input,
-                                   cnn->kernel_std,
-                                   cnn->bias_std,
+        err = xa_nn_conv1d_std_f32((FLOAT32 *)output,
+                                   (FLOAT32 *)input,
+                                   (FLOAT32 *)cnn->kernel_std,
+                                   (FLOAT32 *)cnn->bias_std,
                                    config->input_shape.dim.cube.height,
                                    config->input_shape.dim.cube.width,
                                    config->input_shape.dim.cube.depth,
@@ -703,10 +703,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
     {
       case XA_NNLIB_CNN_16bx16b:
       {
-        err = xa_nn_conv2d_std_16x16(output,
-                                     input,
-                                     cnn->kernel_std,
-                                     cnn->bias_std,
+        err = xa_nn_conv2d_std_16x16((WORD16 *)output,
+                                     (WORD16 *)input,
+                                     (WORD16 *)cnn->kernel_std,
+                                     (WORD16 *)cnn->bias_std,
                                      config->input_shape.dim.cube.height,
                                      config->input_shape.dim.cube.width,
                                      config->input_shape.dim.cube.depth,
@@ -727,10 +727,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       break;
       case XA_NNLIB_CNN_8bx16b:
       {
-        err = xa_nn_conv2d_std_8x16(output,
-                                    input,
-                                    cnn->kernel_std,
-                                    cnn->bias_std,
+        err = xa_nn_conv2d_std_8x16((WORD16 *)output,
+                                    (WORD16 *)input,
+                                    (WORD8 *)cnn->kernel_std,
+                                    (WORD16 *)cnn->bias_std,
                                     config->input_shape.dim.cube.height,
                                     config->input_shape.dim.cube.width,
                                     config->input_shape.dim.cube.depth,
@@ -751,10 +751,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       break;
       case XA_NNLIB_CNN_8bx8b:
       {
-        err = xa_nn_conv2d_std_8x8(output,
-                                   input,
-                                   cnn->kernel_std,
-                                   cnn->bias_std,
+        err = xa_nn_conv2d_std_8x8((WORD8 *)output,
+                                   (WORD8 *)input,
+                                   (WORD8 *)cnn->kernel_std,
+                                   (WORD8 *)cnn->bias_std,
                                    config->input_shape.dim.cube.height,
                                    config->input_shape.dim.cube.width,
                                    config->input_shape.dim.cube.depth,
@@ -776,10 +776,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 #if HAVE_VFPU
       case XA_NNLIB_CNN_f32xf32:
       {
-        err = xa_nn_conv2d_std_f32(output,
-                                   input,
-                                   cnn->kernel_std,
-                                   cnn->bias_std,
+        err = xa_nn_conv2d_std_f32((FLOAT32 *)output,
+                                   (const FLOAT32 *)input,
+                                   (const FLOAT32 *)cnn->kernel_std,
+                                   (const FLOAT32 *)cnn->bias_std,
                                    config->input_shape.dim.cube.height,
                                    config->input_shape.dim.cube.width,
                                    config->input_shape.dim.cube.depth,
@@ -830,10 +830,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
     {
       case XA_NNLIB_CNN_16bx16b:
       {
-        err = xa_nn_conv2d_depthwise_16x16(depthwise_out_scratch,
-                                           cnn->kernel_ds_depth,
-                                           input,
-                                           cnn->bias_ds_depth,
+        err = xa_nn_conv2d_depthwise_16x16((pWORD16)depthwise_out_scratch,
+                                           (const WORD16 *)cnn->kernel_ds_depth,
+                                           (const WORD16 *)input,
+                                           (const WORD16 *)cnn->bias_ds_depth,
                                            config->input_shape.dim.cube.height,
                                            config->input_shape.dim.cube.width,
                                            config->input_shape.dim.cube.depth,
@@ -854,10 +854,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 
         if (err) break;
 
-        err = xa_nn_conv2d_pointwise_16x16(output,
-                                           cnn->kernel_ds_point,
-                                           depthwise_out_scratch,
-                                           cnn->bias_ds_point,
+        err = xa_nn_conv2d_pointwise_16x16((pWORD16)output,
+                                           (pWORD16)cnn->kernel_ds_point,
+                                           (pWORD16)depthwise_out_scratch,
+                                           (pWORD16)cnn->bias_ds_point,
                                            cnn->output_shape.dim.cube.height,
                                            cnn->output_shape.dim.cube.width,
                                            config->input_shape.dim.cube.depth*config->channels_multiplier,
@@ -869,10 +869,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       break;
       case XA_NNLIB_CNN_8bx16b:
       {
-        err = xa_nn_conv2d_depthwise_8x16(depthwise_out_scratch,
-                                          cnn->kernel_ds_depth,
-                                          input,
-                                          cnn->bias_ds_depth,
+        err = xa_nn_conv2d_depthwise_8x16((pWORD16)depthwise_out_scratch,
+                                          (const WORD8 *)cnn->kernel_ds_depth,
+                                          (const WORD16 *)input,
+                                          (const WORD16 *)cnn->bias_ds_depth,
                                           config->input_shape.dim.cube.height,
                                           config->input_shape.dim.cube.width,
                                           config->input_shape.dim.cube.depth,
@@ -893,10 +893,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 
         if (err) break;
 
-        err = xa_nn_conv2d_pointwise_8x16(output,
-                                          cnn->kernel_ds_point,
-                                          depthwise_out_scratch,
-                                          cnn->bias_ds_point,
+        err = xa_nn_conv2d_pointwise_8x16((pWORD16)output,
+                                          (pWORD8)cnn->kernel_ds_point,
+                                          (pWORD16)depthwise_out_scratch,
+                                          (pWORD16)cnn->bias_ds_point,
                                           cnn->output_shape.dim.cube.height,
                                           cnn->output_shape.dim.cube.width,
                                           config->input_shape.dim.cube.depth*config->channels_multiplier,
@@ -908,10 +908,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
       break;
       case XA_NNLIB_CNN_8bx8b:
       {
-        err = xa_nn_conv2d_depthwise_8x8(depthwise_out_scratch,
-                                         cnn->kernel_ds_depth,
-                                         input,
-                                         cnn->bias_ds_depth,
+        err = xa_nn_conv2d_depthwise_8x8((pWORD8)depthwise_out_scratch,
+                                         (const WORD8 *)cnn->kernel_ds_depth,
+                                         (const WORD8 *)input,
+                                         (const WORD8 *)cnn->bias_ds_depth,
                                          config->input_shape.dim.cube.height,
                                          config->input_shape.dim.cube.width,
                                          config->input_shape.dim.cube.depth,
@@ -932,10 +932,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 
         if (err) break;
 
-        err = xa_nn_conv2d_pointwise_8x8(output,
-                                         cnn->kernel_ds_point,
-                                         depthwise_out_scratch,
-                                         cnn->bias_ds_point,
+        err = xa_nn_conv2d_pointwise_8x8((pWORD8)output,
+                                         (pWORD8)cnn->kernel_ds_point,
+                                         (pWORD8)depthwise_out_scratch,
+                                         (pWORD8)cnn->bias_ds_point,
                                          cnn->output_shape.dim.cube.height,
                                          cnn->output_shape.dim.cube.width,
                                          config->input_shape.dim.cube.depth*config->channels_multiplier,
@@ -948,10 +948,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 #if HAVE_VFPU
       case XA_NNLIB_CNN_f32xf32:
       {
-        err = xa_nn_conv2d_depthwise_f32(depthwise_out_scratch,
-                                         cnn->kernel_ds_depth,
-                                         input,
-                                         cnn->bias_ds_depth,
+        err = xa_nn_conv2d_depthwise_f32((FLOAT32 *)depthwise_out_scratch,
+                                         (const FLOAT32 *)cnn->kernel_ds_depth,
+                                         (const FLOAT32 *)input,
+                                         (const FLOAT32 *)cnn->bias_ds_depth,
                                          config->input_shape.dim.cube.height,
                                          config->input_shape.dim.cube.width,
                                          config->input_shape.dim.cube.depth,
@@ -970,10 +970,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 
         if (err) break;
 
-        err = xa_nn_conv2d_pointwise_f32(output,
-                                         cnn->kernel_ds_point,
-                                         depthwise_out_scratch,
-                                         cnn->bias_ds_point,
+        err = xa_nn_conv2d_pointwise_f32((FLOAT32 *)output,
+                                         (FLOAT32 *)cnn->kernel_ds_point,
+                                         (FLOAT32 *)depthwise_out_scratch,
+                                         (FLOAT32 *)cnn->bias_ds_point,
                                          cnn->output_shape.dim.cube.height,
                                          cnn->output_shape.dim.cube.width,
                                          config->input_shape.dim.cube.depth*config->channels_multiplier,
@@ -27,18 +27,18 @@
 
 #ifdef hifi4
 #define XA_PAD_BYTES   8 
-#define ALIGN_MEM(_sptr) (((unsigned)((_sptr)+7))&(~7))
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+7))&(~7))
 #define ALIGN_SIZE(n) (((n)+7)&(~7))
 #endif
 #ifdef hifi5
 #define XA_PAD_BYTES   16 
-#define ALIGN_MEM(_sptr) (((unsigned)((_sptr)+15))&(~15))
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+15))&(~15))
 #define ALIGN_SIZE(n) (((n)+15)&(~15))
 #endif
 
 #define scratch_alloc(_sptr, p, type, sz) { p = (type *)_sptr; _sptr += ALIGN_MEM(sz * sizeof(type));}
 #define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
-#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((uintptr_t)(ptr))&(alignment-1)) != 0) return err;
 
 #define CHECK_MTX_SHAPE(p_shape, rows_shape, cols_shape)      \
 {                                                             \
@@ -83,15 +83,22 @@ typedef struct _gru_state_t
   vect_t *prev_h;
   xa_nnlib_gru_weights_t weights;
   xa_nnlib_gru_biases_t biases;
+  xa_nnlib_gru_biases32_t biases32;
+  xa_nnlib_gru_quant_params_t quant;
+  int quant_set;
   int in_feats;
   int out_feats;
   int pad;
   int precision;
+  int batch;
   int bias_shift;
   int matmul_lsh;
   int tanh_lsh;
 } gru_state_t;
 
+/* Element size of prev_h, 8 bits for 8bx8b */
+#define GRU_H_SIZE(gru) (((gru)->precision == XA_NNLIB_GRU_8bx8b) ? sizeof(WORD8) : sizeof(vect_t))
+
 typedef struct _temp_mem_t 
 {
   Int32 *vec;
@@ -105,6 +112,37 @@ typedef struct _scratch_mem_t
   temp_mem_t temp_mem;
 } scratch_mem_t;
 
+#define GRU_BATCH(config) (((config)->batch > 0) ? (config)->batch : 1)
+
+/* Additional scratch of xa_nnlib_gru_process with batch > 1 */
+typedef struct _batch_scratch_mem_t
+{
+  WORD64 *x_proj;         /* W*x + bias of one gate, batch x out_feats */
+  WORD64 *h_proj;         /* U*h (or U*(r.h)) of one gate, batch x out_feats */
+  vect_t *z_or_r;         /* batch x out_feats */
+  vect_t *r_x_prev_h;     /* batch x out_feats */
+  vect_t *h;              /* batch x out_feats */
+  WORD16 *zero_bias;      /* out_feats zeros, bias of the U products */
+  WORD64 **pp_x_proj;
+  WORD64 **pp_h_proj;
+  WORD16 **pp_input;
+  WORD16 **pp_vec;
+} batch_scratch_mem_t;
+
+#define MULTIPLYBYQUANTIZEDMULTIPLIER_X2(inp, multiplier, left_shift, right_shift) \
+    inp = AE_SLAA32(inp, left_shift); \
+    inp = AE_MULFP32X2RAS(inp, AE_MOVDA32(multiplier)); \
+    inp = AE_SRAA32SYMS(inp, right_shift);
+
+/* Right shift rounding half away from zero */
+static inline WORD32 gru_rounding_div_by_pot(WORD32 x, int exponent)
+{
+  WORD32 mask = (1 << exponent) - 1;
+  WORD32 remainder = x & mask;
+  WORD32 threshold = (mask >> 1) + ((x < 0) ? 1 : 0);
+  return (x >> exponent) + ((remainder > threshold) ? 1 : 0);
+}
+
 static Int32 validate_config(xa_nnlib_gru_init_config_t *config)
 {
   if(config->in_feats < 4 || config->in_feats > 2048 || (config->in_feats&3) != 0)
@@ -113,7 +151,8 @@ static Int32 validate_config(xa_nnlib_gru_init_config_t *config)
   if(config->out_feats < 4 || config->out_feats > 2048 || (config->out_feats&3) != 0)
     return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_OUT_FEATS;
 
-  if((config->precision != XA_NNLIB_GRU_16bx16b) && (config->precision != XA_NNLIB_GRU_8bx16b))
+  if((config->precision != XA_NNLIB_GRU_16bx16b) && (config->precision != XA_NNLIB_GRU_8bx16b) &&
+     (config->precision != XA_NNLIB_GRU_8bx8b))
     return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_PRECISION;
 
   if(config->coeff_Qformat < 0 || config->coeff_Qformat > 15)
@@ -125,6 +164,12 @@ static Int32 validate_config(xa_nnlib_gru_init_config_t *config)
   if((config->pad !=0) && (config->pad != 1))
     return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_MEMBANK_PADDING;
 
+  if(config->batch < 0 || config->batch > XA_NNLIB_GRU_MAX_BATCH)
+    return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_BATCH;
+
+  if(config->precision == XA_NNLIB_GRU_8bx8b && GRU_BATCH(config) > 1)
+    return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_BATCH;
+
   return XA_NNLIB_NO_ERROR;
 }
 
@@ -156,6 +201,19 @@ static void apply_inplace_lsh(Int16 *dst_src, Int32 len, Int32 lsh)
   }
 }
 
+/* 32 bit gate pre-activation from the unshifted W*x + bias and U*h
+   accumulators, rounded like xa_nn_matXvec_16x16_32 */
+static void gru_add_acc64_32(Int32 * __restrict__ output, WORD64 * __restrict__ x_proj, WORD64 * __restrict__ h_proj, int acc_shift, int num_elm)
+{
+  int i;
+  ae_int64 *p_x = (ae_int64 *)x_proj, *p_h = (ae_int64 *)h_proj;
+  for(i=0;i<num_elm;i++)
+  {
+    ae_int64 acc = AE_SLAA64S(AE_ADD64(p_x[i], p_h[i]), acc_shift);
+    output[i] = AE_MOVAD32_L(AE_ROUND32X2F64SSYM(acc, acc));
+  }
+}
+
 Int32 xa_nnlib_gru_get_persistent_fast(
      xa_nnlib_gru_init_config_t *config )
 {
@@ -167,7 +225,7 @@ Int32 xa_nnlib_gru_get_persistent_fast(
     return ret;
 
   persistent_size  = ALIGN_SIZE(sizeof(gru_state_t));
-  persistent_size += ALIGN_SIZE(config->out_feats * sizeof(vect_t));
+  persistent_size += ALIGN_SIZE(GRU_BATCH(config) * config->out_feats * sizeof(vect_t));
 
   return persistent_size;
 }
@@ -190,6 +248,17 @@ Int32 xa_nnlib_gru_get_scratch_fast(
   scratch_size += ALIGN_SIZE(1 * config->out_feats * sizeof(Int32));    //vect scratch
 #endif
 
+  if(GRU_BATCH(config) > 1)
+  {
+    int batch = GRU_BATCH(config);
+    scratch_size += ALIGN_SIZE(sizeof(batch_scratch_mem_t));
+    scratch_size += 2 * ALIGN_SIZE(batch * config->out_feats * sizeof(WORD64));
+    scratch_size += 3 * ALIGN_SIZE(batch * config->out_feats * sizeof(vect_t));
+    scratch_size += ALIGN_SIZE(config->out_feats * sizeof(WORD16));
+    scratch_size += 2 * ALIGN_SIZE(batch * sizeof(WORD64 *));
+    scratch_size += 2 * ALIGN_SIZE(batch * sizeof(WORD16 *));
+  }
+
   return scratch_size;
 }
 
@@ -215,12 +284,13 @@ int xa_nnlib_gru_init(
   gru->out_feats  = config->out_feats;
   gru->pad        = config->pad;
   gru->precision  = config->precision;
+  gru->batch      = GRU_BATCH(config);
   gru->bias_shift   = (config->io_Qformat + config->coeff_Qformat) - 15;
   gru->matmul_lsh = 25 - (config->coeff_Qformat + config->io_Qformat);  // Input to sigmoid function should be 6.25
   gru->tanh_lsh   = config->io_Qformat - 15;  // For Q15 to io_Qformat conversion
 
   gru->prev_h = (vect_t *)ALIGN_MEM((char *)handle + sizeof(gru_state_t));
-  memset(gru->prev_h,0, config->out_feats * sizeof(vect_t));
+  memset(gru->prev_h,0, gru->batch * config->out_feats * sizeof(vect_t));
 
   return XA_NNLIB_NO_ERROR;
 }
@@ -263,7 +333,7 @@ int xa_nnlib_gru_set_config(
           gru->weights.weights16.w_h = p_weights->weights16.w_h;
           gru->weights.weights16.u_h = p_weights->weights16.u_h;
       }
-      else if(gru->precision == XA_NNLIB_GRU_8bx16b)
+      else if(gru->precision == XA_NNLIB_GRU_8bx16b || gru->precision == XA_NNLIB_GRU_8bx8b)
       {
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_z, gru->out_feats, gru->in_feats)
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_r, gru->out_feats, gru->in_feats)
@@ -287,6 +357,21 @@ int xa_nnlib_gru_set_config(
     {
       xa_nnlib_gru_biases_t *p_biases;
       p_biases = (xa_nnlib_gru_biases_t *)params;
+
+      if(gru->precision == XA_NNLIB_GRU_8bx8b)
+      {
+        xa_nnlib_gru_biases32_t *p_biases32;
+        p_biases32 = (xa_nnlib_gru_biases32_t *)params;
+
+        CHECK_VEC_SHAPE(p_biases32->shape_b_z, gru->out_feats)
+        CHECK_VEC_SHAPE(p_biases32->shape_b_r, gru->out_feats)
+        CHECK_VEC_SHAPE(p_biases32->shape_b_h, gru->out_feats)
+
+        gru->biases32.b_z = p_biases32->b_z;
+        gru->biases32.b_r = p_biases32->b_r;
+        gru->biases32.b_h = p_biases32->b_h;
+        break;
+      }
   
       CHECK_VEC_SHAPE(p_biases->shape_b_z, gru->out_feats)
       CHECK_VEC_SHAPE(p_biases->shape_b_r, gru->out_feats)
@@ -298,12 +383,35 @@ int xa_nnlib_gru_set_config(
     }
     break;
     
-    case XA_NNLIB_GRU_RESTORE_CONTEXT:
+    case XA_NNLIB_GRU_QUANT_PARAMS:
     {
-      vect_t *prev_h;
-      prev_h = (vect_t *)params;
+      xa_nnlib_gru_quant_params_t *p_quant;
+      int gate;
+      p_quant = (xa_nnlib_gru_quant_params_t *)params;
+
+      if(gru->precision != XA_NNLIB_GRU_8bx8b)
+        return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_PARAM_ID;
+
+      if(p_quant->input_zero_bias < -127 || p_quant->input_zero_bias > 128 ||
+         p_quant->hidden_zero_bias < -127 || p_quant->hidden_zero_bias > 128 ||
+         p_quant->hidden_shift < -31 || p_quant->hidden_shift > 31)
+        return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_QUANT_PARAMS;
+
+      for(gate = 0; gate < 3; gate++)
+      {
+        if(p_quant->x_shift[gate] < -31 || p_quant->x_shift[gate] > 31 ||
+           p_quant->h_shift[gate] < -31 || p_quant->h_shift[gate] > 31)
+          return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_QUANT_PARAMS;
+      }
+
+      memcpy(&gru->quant, p_quant, sizeof(xa_nnlib_gru_quant_params_t));
+      gru->quant_set = 1;
+    }
+    break;
 
-      memcpy(gru->prev_h,prev_h,gru->out_feats * sizeof(vect_t));
+    case XA_NNLIB_GRU_RESTORE_CONTEXT:
+    {
+      memcpy(gru->prev_h,params,gru->batch * gru->out_feats * GRU_H_SIZE(gru));
     }
     break;
     
@@ -352,7 +460,7 @@ int xa_nnlib_gru_get_config(
           p_weights->weights16.w_h = gru->weights.weights16.w_h;
           p_weights->weights16.u_h = gru->weights.weights16.u_h;
       }
-      else if(gru->precision == XA_NNLIB_GRU_8bx16b)
+      else if(gru->precision == XA_NNLIB_GRU_8bx16b || gru->precision == XA_NNLIB_GRU_8bx8b)
       {
           memcpy(&(p_weights->weights8.shape_w_z), &(gru->weights.weights8.shape_w_z), sizeof(xa_nnlib_shape_t));
           memcpy(&(p_weights->weights8.shape_u_z), &(gru->weights.weights8.shape_u_z), sizeof(xa_nnlib_shape_t));
@@ -376,6 +484,21 @@ int xa_nnlib_gru_get_config(
       xa_nnlib_gru_biases_t *p_biases;
       p_biases = (xa_nnlib_gru_biases_t *)params;
 
+      if(gru->precision == XA_NNLIB_GRU_8bx8b)
+      {
+        xa_nnlib_gru_biases32_t *p_biases32;
+        p_biases32 = (xa_nnlib_gru_biases32_t *)params;
+
+        memcpy(&(p_biases32->shape_b_z), &(gru->biases32.shape_b_z), sizeof(xa_nnlib_shape_t));
+        memcpy(&(p_biases32->shape_b_r), &(gru->biases32.shape_b_r), sizeof(xa_nnlib_shape_t));
+        memcpy(&(p_biases32->shape_b_h), &(gru->biases32.shape_b_h), sizeof(xa_nnlib_shape_t));
+
+        p_biases32->b_z = gru->biases32.b_z;
+        p_biases32->b_r = gru->biases32.b_r;
+        p_biases32->b_h = gru->biases32.b_h;
+        break;
+      }
+
       memcpy(&(p_biases->shape_b_z), &(gru->biases.shape_b_z), sizeof(xa_nnlib_shape_t));
       memcpy(&(p_biases->shape_b_r), &(gru->biases.shape_b_r), sizeof(xa_nnlib_shape_t));
       memcpy(&(p_biases->shape_b_h), &(gru->biases.shape_b_h), sizeof(xa_nnlib_shape_t));
@@ -392,7 +515,7 @@ int xa_nnlib_gru_get_config(
       inp_shape = (xa_nnlib_shape_t *)params;
       inp_shape->dim.vector.length = gru->in_feats;
       inp_shape->shape_type = SHAPE_VECTOR_T;
-      inp_shape->n_shapes = 1;
+      inp_shape->n_shapes = gru->batch;
       inp_shape->shape_offset = -1;
     }
     break;
@@ -403,17 +526,23 @@ int xa_nnlib_gru_get_config(
       out_shape = (xa_nnlib_shape_t *)params;
       out_shape->dim.vector.length = gru->out_feats;
       out_shape->shape_type = SHAPE_VECTOR_T;
-      out_shape->n_shapes = 1;
+      out_shape->n_shapes = gru->batch;
       out_shape->shape_offset = -1;
     }
     break;
     
-    case XA_NNLIB_GRU_RESTORE_CONTEXT:
+    case XA_NNLIB_GRU_QUANT_PARAMS:
     {
-      vect_t *prev_h;
-      prev_h = (vect_t *)params;
+      if(gru->precision != XA_NNLIB_GRU_8bx8b)
+        return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_PARAM_ID;
 
-      memcpy(prev_h,gru->prev_h,gru->out_feats * sizeof(vect_t));
+      memcpy(params, &gru->quant, sizeof(xa_nnlib_gru_quant_params_t));
+    }
+    break;
+
+    case XA_NNLIB_GRU_RESTORE_CONTEXT:
+    {
+      memcpy(params,gru->prev_h,gru->batch * gru->out_feats * GRU_H_SIZE(gru));
     }
     break;
 
@@ -424,6 +553,204 @@ int xa_nnlib_gru_get_config(
   return XA_NNLIB_NO_ERROR;
 }  
 
+/* W*x + bias into x_proj and U*vec into h_proj for all streams, then the
+   rounded 32 bit pre-activation of stream b is left in temp_mem */
+#define GRU_BATCH_GATE(w, u, b_gate)                                            \
+{                                                                               \
+  if(gru->precision == XA_NNLIB_GRU_16bx16b)                                    \
+  {                                                                             \
+    err = xa_nn_matXvec_batch_16x16_64(batch_mem->pp_x_proj,                    \
+        gru->weights.weights16.w, batch_mem->pp_input, gru->biases.b_gate,      \
+        out_feats, gru->in_feats, gru->in_feats + gru->pad*XA_PAD_BYTES,        \
+        0, gru->bias_shift, gru->batch);                                        \
+    err |= xa_nn_matXvec_batch_16x16_64(batch_mem->pp_h_proj,                   \
+        gru->weights.weights16.u, batch_mem->pp_vec, batch_mem->zero_bias,      \
+        out_feats, out_feats, out_feats + gru->pad*XA_PAD_BYTES,                \
+        0, 0, gru->batch);                                                      \
+  }                                                                             \
+  else if(gru->precision == XA_NNLIB_GRU_8bx16b)                                \
+  {                                                                             \
+    err = xa_nn_matXvec_batch_8x16_64(batch_mem->pp_x_proj,                     \
+        gru->weights.weights8.w, batch_mem->pp_input, gru->biases.b_gate,       \
+        out_feats, gru->in_feats, gru->in_feats + gru->pad*XA_PAD_BYTES,        \
+        0, gru->bias_shift, gru->batch);                                        \
+    err |= xa_nn_matXvec_batch_8x16_64(batch_mem->pp_h_proj,                    \
+        gru->weights.weights8.u, batch_mem->pp_vec, batch_mem->zero_bias,       \
+        out_feats, out_feats, out_feats + gru->pad*XA_PAD_BYTES,                \
+        0, 0, gru->batch);                                                      \
+  }                                                                             \
+  if(err)                                                                       \
+    return err;                                                                 \
+}
+
+/* One frame of every stream, each weight matrix is read once per call by
+   the batch kernels. The unshifted accumulators are added and rounded
+   exactly as in the single stream matXvec kernels. */
+static Int32 gru_process_batch(gru_state_t *gru,
+    scratch_mem_t *scratch_mem,
+    batch_scratch_mem_t *batch_mem,
+    vect_t *input,
+    vect_t *output,
+    int in_stride,
+    int out_stride)
+{
+  int out_feats = gru->out_feats;
+  int b, err = 0;
+
+  for(b = 0; b < gru->batch; b++)
+  {
+    batch_mem->pp_input[b] = input + b * in_stride;
+    batch_mem->pp_vec[b] = gru->prev_h + b * out_feats;
+    batch_mem->pp_x_proj[b] = batch_mem->x_proj + b * out_feats;
+    batch_mem->pp_h_proj[b] = batch_mem->h_proj + b * out_feats;
+  }
+  memset(batch_mem->zero_bias, 0, out_feats * sizeof(WORD16));
+
+  GRU_BATCH_GATE(w_r, u_r, b_r)
+  for(b = 0; b < gru->batch; b++)
+  {
+    gru_add_acc64_32(scratch_mem->temp_mem.vec, batch_mem->pp_x_proj[b], batch_mem->pp_h_proj[b], gru->matmul_lsh + 32, out_feats);
+    xa_nn_vec_sigmoid_32_16(batch_mem->z_or_r + b * out_feats, scratch_mem->temp_mem.vec, out_feats);
+    xa_nn_elm_mul_16x16_16(batch_mem->r_x_prev_h + b * out_feats, batch_mem->z_or_r + b * out_feats, gru->prev_h + b * out_feats, out_feats);
+    batch_mem->pp_vec[b] = batch_mem->r_x_prev_h + b * out_feats;
+  }
+
+  GRU_BATCH_GATE(w_h, u_h, b_h)
+  for(b = 0; b < gru->batch; b++)
+  {
+    gru_add_acc64_32(scratch_mem->temp_mem.vec, batch_mem->pp_x_proj[b], batch_mem->pp_h_proj[b], gru->matmul_lsh + 32, out_feats);
+    xa_nn_vec_tanh_32_16(batch_mem->h + b * out_feats, scratch_mem->temp_mem.vec, out_feats);
+    apply_inplace_lsh(batch_mem->h + b * out_feats, out_feats, gru->tanh_lsh);
+    batch_mem->pp_vec[b] = gru->prev_h + b * out_feats;
+  }
+
+  GRU_BATCH_GATE(w_z, u_z, b_z)
+  for(b = 0; b < gru->batch; b++)
+  {
+    gru_add_acc64_32(scratch_mem->temp_mem.vec, batch_mem->pp_x_proj[b], batch_mem->pp_h_proj[b], gru->matmul_lsh + 32, out_feats);
+    xa_nn_vec_sigmoid_32_16(batch_mem->z_or_r + b * out_feats, scratch_mem->temp_mem.vec, out_feats);
+
+    //h_t step
+    xa_nn_vec_interpolation_q15(output + b * out_stride,
+        batch_mem->z_or_r + b * out_feats,
+        gru->prev_h + b * out_feats,
+        batch_mem->h + b * out_feats,
+        out_feats);
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* One gate of XA_NNLIB_GRU_8bx8b: the W*x + b and U*vec products are
+   requantized to Q3.12 by the 16 bit output matXvec kernel, added with
+   saturation and activated in place in p_gate. */
+static Int32 gru_gate_8x8(gru_state_t *gru,
+    WORD16 *p_gate,
+    WORD16 *p_h_part,
+    const WORD8 *input,
+    const WORD8 *vec,
+    const coeff8_t *w,
+    const coeff8_t *u,
+    const Int32 *bias,
+    int gate,
+    int is_tanh)
+{
+  xa_nnlib_gru_quant_params_t *p_quant = &gru->quant;
+  int k, err;
+
+  err = xa_nn_matXvec_out_stride_sym8sxasym8s_16(
+      p_gate,
+      w,
+      input,
+      bias,
+      gru->out_feats,
+      gru->in_feats,
+      gru->in_feats + gru->pad*XA_PAD_BYTES,
+      1,
+      p_quant->input_zero_bias,
+      p_quant->x_multiplier[gate],
+      p_quant->x_shift[gate]);
+
+  err |= xa_nn_matXvec_out_stride_sym8sxasym8s_16(
+      p_h_part,
+      u,
+      vec,
+      NULL,
+      gru->out_feats,
+      gru->out_feats,
+      gru->out_feats + gru->pad*XA_PAD_BYTES,
+      1,
+      p_quant->hidden_zero_bias,
+      p_quant->h_multiplier[gate],
+      p_quant->h_shift[gate]);
+
+  if(err)
+    return err;
+
+  for(k = 0; k < gru->out_feats; k++)
+  {
+    WORD32 acc = (WORD32)p_gate[k] + p_h_part[k];
+    p_gate[k] = (WORD16)((acc > 32767) ? 32767 : (acc < -32768) ? -32768 : acc);
+  }
+
+  if(is_tanh)
+    return xa_nn_vec_tanh_16_16(p_gate, p_gate, 3, gru->out_feats);
+
+  return xa_nn_vec_sigmoid_16_16(p_gate, p_gate, 3, gru->out_feats);
+}
+
+/* Fully integer GRU step: 8 bit input, weights and hidden state, Q3.12
+   gates and Q0.15 activations. r.h is kept in the quantization of prev_h,
+   the interpolation z*h + (1-z)*h~ is done on the dequantized prev_h
+   and the requantized (1-z)*h~. */
+static Int32 gru_process_8x8(gru_state_t *gru,
+    scratch_mem_t *scratch_mem,
+    const WORD8 *input,
+    WORD8 *output)
+{
+  xa_nnlib_gru_quant_params_t *p_quant = &gru->quant;
+  WORD16 *z_or_r = scratch_mem->z_or_r;
+  WORD16 *h = scratch_mem->h;
+  WORD8 *r_x_prev_h = (WORD8 *)scratch_mem->r_x_prev_h;
+  WORD16 *h_part = (WORD16 *)scratch_mem->temp_mem.vec;
+  WORD8 *prev_h = (WORD8 *)gru->prev_h;
+  int zero_bias = p_quant->hidden_zero_bias;
+  int left_shift, right_shift, k, err;
+
+  err = gru_gate_8x8(gru, z_or_r, h_part, input, prev_h, gru->weights.weights8.w_r, gru->weights.weights8.u_r, gru->biases32.b_r, 1, 0);
+  if(err)
+    return err;
+
+  // r.h, Q0.15 x prev_h in the quantization of prev_h
+  for(k = 0; k < gru->out_feats; k++)
+  {
+    WORD32 rh = gru_rounding_div_by_pot((WORD32)z_or_r[k] * (prev_h[k] + zero_bias), 15) - zero_bias;
+    r_x_prev_h[k] = (WORD8)((rh > 127) ? 127 : (rh < -128) ? -128 : rh);
+  }
+
+  err = gru_gate_8x8(gru, h, h_part, input, r_x_prev_h, gru->weights.weights8.w_h, gru->weights.weights8.u_h, gru->biases32.b_h, 2, 1);
+  err |= gru_gate_8x8(gru, z_or_r, h_part, input, prev_h, gru->weights.weights8.w_z, gru->weights.weights8.u_z, gru->biases32.b_z, 0, 0);
+  if(err)
+    return err;
+
+  left_shift = p_quant->hidden_shift < 0 ? 0 : p_quant->hidden_shift;
+  right_shift = p_quant->hidden_shift > 0 ? 0 : -p_quant->hidden_shift;
+
+  //h_t step
+  for(k = 0; k < gru->out_feats; k++)
+  {
+    ae_int32x2 one_minus_z_x_h = AE_MOVDA32((32768 - (WORD32)z_or_r[k]) * h[k]);
+    WORD32 h32;
+
+    MULTIPLYBYQUANTIZEDMULTIPLIER_X2(one_minus_z_x_h, p_quant->hidden_multiplier, left_shift, right_shift);
+    h32 = gru_rounding_div_by_pot((WORD32)z_or_r[k] * (prev_h[k] + zero_bias), 15) +
+          AE_MOVAD32_L(one_minus_z_x_h) - zero_bias;
+    output[k] = (WORD8)((h32 > 127) ? 127 : (h32 < -128) ? -128 : h32);
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
 int xa_nnlib_gru_process(xa_nnlib_handle_t handle, 
     void *scratch,
     void *input,
@@ -433,6 +760,8 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
 {
   gru_state_t *gru;
   scratch_mem_t *scratch_mem;
+  batch_scratch_mem_t *batch_mem = NULL;
+  int in_stride = 0, out_stride = 0;
 
   CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
   CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
@@ -463,6 +792,32 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
     return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA;
   }
 
+  if(gru->batch > 1)
+  {
+    in_stride = (p_in_shape->shape_offset == -1) ? gru->in_feats : p_in_shape->shape_offset;
+    out_stride = (p_out_shape->shape_offset == -1) ? gru->out_feats : p_out_shape->shape_offset;
+
+    // Streams must stay 8 bytes aligned
+    if(in_stride < gru->in_feats || (in_stride&3) != 0 ||
+       out_stride < gru->out_feats || (out_stride&3) != 0)
+    {
+      return XA_NNLIB_FATAL_INVALID_SHAPE;
+    }
+
+    if(p_out_shape->n_shapes < gru->batch)
+    {
+      return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+    }
+
+    if(p_in_shape->n_shapes < gru->batch)
+    {
+      return XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA;
+    }
+
+    p_in_shape->n_shapes = gru->batch;
+    p_out_shape->n_shapes = gru->batch;
+  }
+
   p_in_shape->dim.vector.length = gru->in_feats;
   p_out_shape->dim.vector.length = gru->out_feats;
 
@@ -483,17 +838,52 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
     scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, gru->out_feats);
   
 #endif
+
+    if(gru->batch > 1)
+    {
+      scratch_alloc(sptr, batch_mem, batch_scratch_mem_t, 1);
+      scratch_alloc(sptr, batch_mem->x_proj, WORD64, gru->batch * gru->out_feats);
+      scratch_alloc(sptr, batch_mem->h_proj, WORD64, gru->batch * gru->out_feats);
+      scratch_alloc(sptr, batch_mem->z_or_r, vect_t, gru->batch * gru->out_feats);
+      scratch_alloc(sptr, batch_mem->r_x_prev_h, vect_t, gru->batch * gru->out_feats);
+      scratch_alloc(sptr, batch_mem->h, vect_t, gru->batch * gru->out_feats);
+      scratch_alloc(sptr, batch_mem->zero_bias, WORD16, gru->out_feats);
+      scratch_alloc(sptr, batch_mem->pp_x_proj, WORD64 *, gru->batch);
+      scratch_alloc(sptr, batch_mem->pp_h_proj, WORD64 *, gru->batch);
+      scratch_alloc(sptr, batch_mem->pp_input, WORD16 *, gru->batch);
+      scratch_alloc(sptr, batch_mem->pp_vec, WORD16 *, gru->batch);
+    }
   }
 
 #ifdef MODEL_INT16
-  if(gru->precision == XA_NNLIB_GRU_16bx16b)
+  if(gru->precision == XA_NNLIB_GRU_8bx8b)
+  {
+    if(!gru->quant_set)
+    {
+      return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_QUANT_PARAMS;
+    }
+
+    if(XA_NNLIB_NO_ERROR != gru_process_8x8(gru, scratch_mem, (WORD8 *)input, (WORD8 *)output))
+    {
+      return XA_NNLIB_FATAL_INVALID_SHAPE;
+    }
+  }
+  else if(gru->batch > 1)
+  {
+    if(XA_NNLIB_NO_ERROR != gru_process_batch(gru, scratch_mem, batch_mem,
+          (vect_t *)input, (vect_t *)output, in_stride, out_stride))
+    {
+      return XA_NNLIB_FATAL_INVALID_SHAPE;
+    }
+  }
+  else if(gru->precision == XA_NNLIB_GRU_16bx16b)
   {
 
     xa_nn_matXvec_16x16_16_sigmoid(
         scratch_mem->z_or_r,
         gru->weights.weights16.w_r,
         gru->weights.weights16.u_r,
-        input,
+        (WORD16 *)input,
         gru->prev_h,
         gru->biases.b_r,
         gru->out_feats,
@@ -512,7 +902,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         scratch_mem->h,
         gru->weights.weights16.w_h,
         gru->weights.weights16.u_h,
-        input,
+        (WORD16 *)input,
         scratch_mem->r_x_prev_h,
         gru->biases.b_h,
         gru->out_feats,
@@ -531,7 +921,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         scratch_mem->z_or_r,
         gru->weights.weights16.w_z,
         gru->weights.weights16.u_z,
-        input,
+        (WORD16 *)input,
         gru->prev_h,
         gru->biases.b_z,
         gru->out_feats,
@@ -558,7 +948,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         scratch_mem->z_or_r,
         gru->weights.weights8.w_r,
         gru->weights.weights8.u_r,
-        input,
+        (WORD16 *)input,
         gru->prev_h,
         gru->biases.b_r,
         gru->out_feats,
@@ -576,7 +966,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         scratch_mem->h,
         gru->weights.weights8.w_h,
         gru->weights.weights8.u_h,
-        input,
+        (WORD16 *)input,
         scratch_mem->r_x_prev_h,
         gru->biases.b_h,
         gru->out_feats,
@@ -595,7 +985,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
         scratch_mem->z_or_r,
         gru->weights.weights8.w_z,
         gru->weights.weights8.u_z,
-        input,
+        (WORD16 *)input,
         gru->prev_h,
         gru->biases.b_z,
         gru->out_feats,
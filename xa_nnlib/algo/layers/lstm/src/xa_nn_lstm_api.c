@@ -28,18 +28,18 @@
 
 #ifdef hifi4
 #define XA_PAD_BYTES   8
-#define ALIGN_MEM(_sptr) (((unsigned)((_sptr)+7))&(~7))
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+7))&(~7))
 #define ALIGN_SIZE(n) (((n)+7)&(~7))
 #endif
 #ifdef hifi5
 #define XA_PAD_BYTES   16
-#define ALIGN_MEM(_sptr) (((unsigned)((_sptr)+15))&(~15))
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+15))&(~15))
 #define ALIGN_SIZE(n) (((n)+15)&(~15))
 #endif
 
-#define scratch_alloc(_sptr, p, type, sz) { p = (type *)_sptr; _sptr += ALIGN_MEM(sz * sizeof(type));}
+#define scratch_alloc(_sptr, p, type, sz) { p = (type *)_sptr; _sptr += ALIGN_MEM((sz) * sizeof(type));}
 #define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
-#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((uintptr_t)(ptr))&(alignment-1)) != 0) return err;
 
 #define CHECK_MTX_SHAPE(p_shape, rows_shape, cols_shape)      \
 {                                                             \
@@ -83,8 +83,14 @@ typedef struct _lstm_state_t
   int *prev_c;
   xa_nnlib_lstm_weights_t weights;
   xa_nnlib_lstm_biases_t biases;
+  xa_nnlib_lstm_biases32_t biases32;
+  xa_nnlib_lstm_quant_params_t quant;
+  int quant_set;
+  void *packed_weights;
   int in_feats;
   int out_feats;
+  int batch;
+  int max_seq_frames;
   int pad;
   int precision;
   int bias_shift;
@@ -92,8 +98,13 @@ typedef struct _lstm_state_t
   int h_lsh;
   int fXprev_c_lsh;
   int iXc_hat_lsh;
+  int cell_Qformat;
 } lstm_state_t;
 
+/* Element sizes of prev_h and prev_c, 8 and 16 bits for 8bx8b */
+#define LSTM_H_SIZE(lstm) (((lstm)->precision == XA_NNLIB_LSTM_8bx8b) ? sizeof(WORD8) : sizeof(vect_t))
+#define LSTM_C_SIZE(lstm) (((lstm)->precision == XA_NNLIB_LSTM_8bx8b) ? sizeof(WORD16) : sizeof(int))
+
 typedef struct _temp_mem_t
 {
   Int32 *vec;
@@ -105,9 +116,37 @@ typedef struct _scratch_mem_t
   vect_t *i_f_or_o_f;
   vect_t *c_hat_f_or_tanh_c_f;
   temp_mem_t temp_mem;
+  vect_t *xh;
+  Int32 *gate;            /* f, i, c, o pre-activations of the fused step */
 } scratch_mem_t;
 
-static void vec_elem_mul_16x32plus16x16_16(Int32 * __restrict__ output, Int16 * __restrict__ input_1, Int32 * __restrict__ input_2, Int16 * __restrict__ input_3, Int16 * __restrict__ input_4, int fXprev_c_lsh, int iXc_hat_lsh, int num_elm)
+/* Additional scratch of xa_nnlib_lstm_process_seq */
+typedef struct _seq_scratch_mem_t
+{
+  WORD64 *x_proj[4];      /* W_x*x + bias per gate (f, i, c, o), frames x out_feats */
+  WORD64 **pp_x_proj;     /* frame pointers into x_proj[gate] for the batch kernel */
+  WORD16 **pp_input;      /* frame pointers into input */
+} seq_scratch_mem_t;
+
+#define LSTM_BATCH(config) (((config)->batch > 0) ? (config)->batch : 1)
+#define LSTM_SEQ_FRAMES(config) (((config)->max_seq_frames > 0) ? (config)->max_seq_frames : 1)
+
+/* Additional scratch of xa_nnlib_lstm_process with batch > 1 */
+typedef struct _batch_scratch_mem_t
+{
+  WORD64 *x_proj;         /* W_x*x + bias of one gate, batch x out_feats */
+  WORD64 *h_proj;         /* W_h*h of one gate, batch x out_feats */
+  vect_t *gate[4];        /* f, i, c_hat (then tanh(c)), o, batch x out_feats */
+  WORD16 *zero_bias;      /* out_feats zeros, bias of the W_h products */
+  WORD64 **pp_x_proj;
+  WORD64 **pp_h_proj;
+  WORD16 **pp_input;
+  WORD16 **pp_prev_h;
+} batch_scratch_mem_t;
+
+/* output = input_1*input_2 + input_3*input_4; called in place on prev_c, so
+   output and input_2 may alias */
+static void vec_elem_mul_16x32plus16x16_16(Int32 *output, Int16 * __restrict__ input_1, Int32 *input_2, Int16 * __restrict__ input_3, Int16 * __restrict__ input_4, int fXprev_c_lsh, int iXc_hat_lsh, int num_elm)
 {
 #pragma aligned(output, 8)
 #pragma aligned(input_1, 8)
@@ -146,6 +185,152 @@ static void lstm_output_kernel_16x16_16(Int16 * __restrict__ output, Int16 * __r
   }
 }
 
+/* 32 bit gate pre-activation from the unshifted W_x*x + bias and W_h*h
+   accumulators, rounded like xa_nn_matXvec_16x16_32 */
+static void lstm_add_acc64_32(Int32 * __restrict__ output, WORD64 * __restrict__ x_proj, WORD64 * __restrict__ h_proj, int acc_shift, int num_elm)
+{
+  int i;
+  ae_int64 *p_x = (ae_int64 *)x_proj, *p_h = (ae_int64 *)h_proj;
+  for(i=0;i<num_elm;i++)
+  {
+    ae_int64 acc = AE_SLAA64S(AE_ADD64(p_x[i], p_h[i]), acc_shift);
+    output[i] = AE_MOVAD32_L(AE_ROUND32X2F64SSYM(acc, acc));
+  }
+}
+
+/* Gate pre-activations of the fused step on gate interleaved weights (see
+   lstm_pack_weights): W*[x, h] + bias of the f, i, c and o gates in one
+   pass over xh = [input, prev_h]. A block of two output rows needs eight 64
+   bit accumulators, which fit in the register file alongside the x and w
+   operands. Rounded to 32 bits like xa_nn_matXvec_16x16_32, into
+   gate[0..3 * out_feats]. */
+static void lstm_fused_gates_16x16_32(Int32 * __restrict__ gate,
+    const Int16 * __restrict__ p_packed,
+    const Int16 * __restrict__ xh,
+    xa_nnlib_lstm_biases_t *p_biases,
+    int out_feats,
+    int cols,
+    int acc_shift,
+    int bias_shift)
+{
+#pragma aligned(gate, 8)
+#pragma aligned(p_packed, 8)
+#pragma aligned(xh, 8)
+  const ae_int16x4 *p_w = (const ae_int16x4 *)p_packed;
+  int row, c_itr, k;
+
+  for(row = 0; row < out_feats; row += 2)
+  {
+    const ae_int16x4 *p_x = (const ae_int16x4 *)xh;
+    ae_int64 acc[8];
+
+    for(k = 0; k < 2; k++)
+    {
+      acc[0 + k] = AE_SLAA64S(p_biases->b_f[row + k], bias_shift);
+      acc[2 + k] = AE_SLAA64S(p_biases->b_i[row + k], bias_shift);
+      acc[4 + k] = AE_SLAA64S(p_biases->b_c[row + k], bias_shift);
+      acc[6 + k] = AE_SLAA64S(p_biases->b_o[row + k], bias_shift);
+    }
+
+    for(c_itr = 0; c_itr < (cols >> 2); c_itr++)
+    {
+      ae_int16x4 x, w;
+      AE_L16X4_IP(x, p_x, 8);
+      for(k = 0; k < 8; k++)
+      {
+        AE_L16X4_IP(w, p_w, 8);
+        AE_MULAAAAQ16(acc[k], w, x);
+      }
+    }
+
+    for(k = 0; k < 4; k++)
+    {
+      *(ae_int32x2 *)&gate[k * out_feats + row] =
+          AE_ROUND32X2F64SSYM(AE_SLAA64S(acc[2*k], acc_shift), AE_SLAA64S(acc[2*k + 1], acc_shift));
+    }
+  }
+}
+
+static void lstm_fused_gates_8x16_32(Int32 * __restrict__ gate,
+    const WORD8 * __restrict__ p_packed,
+    const Int16 * __restrict__ xh,
+    xa_nnlib_lstm_biases_t *p_biases,
+    int out_feats,
+    int cols,
+    int acc_shift,
+    int bias_shift)
+{
+#pragma aligned(gate, 8)
+#pragma aligned(p_packed, 4)
+#pragma aligned(xh, 8)
+  const WORD8 *p_w = p_packed;
+  int row, c_itr, k;
+
+  for(row = 0; row < out_feats; row += 2)
+  {
+    const ae_int16x4 *p_x = (const ae_int16x4 *)xh;
+    ae_int64 acc[8];
+
+    for(k = 0; k < 2; k++)
+    {
+      acc[0 + k] = AE_SLAA64S(p_biases->b_f[row + k], bias_shift);
+      acc[2 + k] = AE_SLAA64S(p_biases->b_i[row + k], bias_shift);
+      acc[4 + k] = AE_SLAA64S(p_biases->b_c[row + k], bias_shift);
+      acc[6 + k] = AE_SLAA64S(p_biases->b_o[row + k], bias_shift);
+    }
+
+    for(c_itr = 0; c_itr < (cols >> 2); c_itr++)
+    {
+      ae_int16x4 x, w;
+      AE_L16X4_IP(x, p_x, 8);
+      for(k = 0; k < 8; k++)
+      {
+        AE_L8X4S_IP(w, p_w, 4);
+        AE_MULAAAAQ16(acc[k], w, x);
+      }
+    }
+
+    for(k = 0; k < 4; k++)
+    {
+      *(ae_int32x2 *)&gate[k * out_feats + row] =
+          AE_ROUND32X2F64SSYM(AE_SLAA64S(acc[2*k], acc_shift), AE_SLAA64S(acc[2*k + 1], acc_shift));
+    }
+  }
+}
+
+/* Activations and state update of the fused step from its gate
+   pre-activations; the same kernels in the same order as the unfused path */
+static void lstm_fused_update(lstm_state_t *lstm, scratch_mem_t *scratch_mem, vect_t *output)
+{
+  Int32 *gate = scratch_mem->gate;
+  int n = lstm->out_feats;
+
+  xa_nn_vec_sigmoid_32_16(scratch_mem->f_f, gate, n);
+  xa_nn_vec_sigmoid_32_16(scratch_mem->i_f_or_o_f, gate + n, n);
+  xa_nn_vec_tanh_32_16(scratch_mem->c_hat_f_or_tanh_c_f, gate + 2 * n, n);
+
+  vec_elem_mul_16x32plus16x16_16(
+      lstm->prev_c,
+      scratch_mem->f_f,
+      lstm->prev_c,
+      scratch_mem->i_f_or_o_f,
+      scratch_mem->c_hat_f_or_tanh_c_f,
+      lstm->fXprev_c_lsh,
+      lstm->iXc_hat_lsh,
+      n);
+
+  xa_nn_vec_sigmoid_32_16(scratch_mem->i_f_or_o_f, gate + 3 * n, n);
+  xa_nn_vec_tanh_32_16(scratch_mem->c_hat_f_or_tanh_c_f, lstm->prev_c, n);
+
+  lstm_output_kernel_16x16_16(
+      output,
+      lstm->prev_h,
+      scratch_mem->i_f_or_o_f,
+      scratch_mem->c_hat_f_or_tanh_c_f,
+      lstm->h_lsh,
+      n);
+}
+
 static Int32 validate_config(xa_nnlib_lstm_init_config_t *config)
 {
   if(config->in_feats < 4 || config->in_feats > 2048 || (config->in_feats&3) != 0)
@@ -154,7 +339,8 @@ static Int32 validate_config(xa_nnlib_lstm_init_config_t *config)
   if(config->out_feats < 4 || config->out_feats > 2048 || (config->out_feats&3) != 0)
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_OUT_FEATS;
 
-  if((config->precision != XA_NNLIB_LSTM_16bx16b) && (config->precision != XA_NNLIB_LSTM_8bx16b))
+  if((config->precision != XA_NNLIB_LSTM_16bx16b) && (config->precision != XA_NNLIB_LSTM_8bx16b) &&
+     (config->precision != XA_NNLIB_LSTM_8bx8b))
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PRECISION;
 
   if(config->coeff_Qformat < 0 || config->coeff_Qformat > 15)
@@ -163,12 +349,25 @@ static Int32 validate_config(xa_nnlib_lstm_init_config_t *config)
   if(config->cell_Qformat < 0 || config->cell_Qformat > 25)
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_CELL_QFORMAT;
 
+  // 16 bit cell state, at most 12 integer bits for the tanh of 8bx8b
+  if(config->precision == XA_NNLIB_LSTM_8bx8b && (config->cell_Qformat < 3 || config->cell_Qformat > 15))
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_CELL_QFORMAT;
+
   if(config->io_Qformat < 0 || config->io_Qformat > 15)
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_IO_QFORMAT;
 
   if((config->pad !=0) && (config->pad != 1))
     return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING;
 
+  if(config->batch < 0 || config->batch > XA_NNLIB_LSTM_MAX_BATCH)
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_BATCH;
+
+  if(config->precision == XA_NNLIB_LSTM_8bx8b && LSTM_BATCH(config) > 1)
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_BATCH;
+
+  if(config->max_seq_frames < 0 || config->max_seq_frames > XA_NNLIB_LSTM_MAX_SEQ_FRAMES)
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_FRAMES;
+
   return XA_NNLIB_NO_ERROR;
 }
 
@@ -183,9 +382,9 @@ Int32 xa_nnlib_lstm_get_persistent_fast(
     return ret;
 
   persistent_size  = ALIGN_SIZE(sizeof(lstm_state_t));
-  // Size of prev_h and prev_c
-  persistent_size += ALIGN_SIZE(config->out_feats * sizeof(vect_t));
-  persistent_size += ALIGN_SIZE(config->out_feats * sizeof(int));
+  // Size of prev_h and prev_c of every stream
+  persistent_size += ALIGN_SIZE(LSTM_BATCH(config) * config->out_feats * sizeof(vect_t));
+  persistent_size += ALIGN_SIZE(LSTM_BATCH(config) * config->out_feats * sizeof(int));
 
   return persistent_size;
 }
@@ -207,10 +406,61 @@ Int32 xa_nnlib_lstm_get_scratch_fast(
 #elif MODEL_INT16
   scratch_size += ALIGN_SIZE(1 * config->out_feats * sizeof(Int32));    //vect scratch
 #endif
+  // input and prev_h side by side for the fused kernel
+  scratch_size += ALIGN_SIZE((config->in_feats + config->out_feats) * sizeof(vect_t));
+  scratch_size += ALIGN_SIZE(4 * config->out_feats * sizeof(Int32));
+
+  if(LSTM_BATCH(config) > 1)
+  {
+    int batch = LSTM_BATCH(config);
+    scratch_size += ALIGN_SIZE(sizeof(batch_scratch_mem_t));
+    scratch_size += 2 * ALIGN_SIZE(batch * config->out_feats * sizeof(WORD64));
+    scratch_size += 4 * ALIGN_SIZE(batch * config->out_feats * sizeof(vect_t));
+    scratch_size += ALIGN_SIZE(config->out_feats * sizeof(WORD16));
+    scratch_size += 2 * ALIGN_SIZE(batch * sizeof(WORD64 *));
+    scratch_size += 2 * ALIGN_SIZE(batch * sizeof(WORD16 *));
+  }
+
+  return scratch_size;
+}
+
+Int32 xa_nnlib_lstm_get_scratch_seq_fast(
+       xa_nnlib_lstm_init_config_t *config )
+{
+  int scratch_size, max_frames;
+
+  scratch_size = xa_nnlib_lstm_get_scratch_fast(config);
+  if(scratch_size < 0)
+    return scratch_size;
+
+  max_frames = LSTM_SEQ_FRAMES(config);
+
+  scratch_size += ALIGN_SIZE(sizeof(seq_scratch_mem_t));
+  scratch_size += 4 * ALIGN_SIZE(max_frames * config->out_feats * sizeof(WORD64));
+  scratch_size += ALIGN_SIZE(max_frames * sizeof(WORD64 *));
+  scratch_size += ALIGN_SIZE(max_frames * sizeof(WORD16 *));
 
   return scratch_size;
 }
 
+Int32 xa_nnlib_lstm_get_packed_weights_size(
+       xa_nnlib_lstm_init_config_t *config )
+{
+  int ret, elem_size;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = validate_config(config);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  if(config->precision == XA_NNLIB_LSTM_8bx8b)
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PRECISION;
+
+  elem_size = (config->precision == XA_NNLIB_LSTM_8bx16b) ? sizeof(coeff8_t) : sizeof(coeff_t);
+
+  return ALIGN_SIZE(4 * config->out_feats * (config->in_feats + config->out_feats) * elem_size);
+}
+
 int xa_nnlib_lstm_init(
     xa_nnlib_handle_t handle,
     xa_nnlib_lstm_init_config_t *config )
@@ -233,17 +483,20 @@ int xa_nnlib_lstm_init(
   lstm->out_feats  = config->out_feats;
   lstm->pad        = config->pad;
   lstm->precision  = config->precision;
+  lstm->batch      = LSTM_BATCH(config);
+  lstm->max_seq_frames = LSTM_SEQ_FRAMES(config);
   lstm->bias_shift   = (config->io_Qformat + config->coeff_Qformat) - 15;
   lstm->matmul_lsh = 25 - (config->coeff_Qformat + config->io_Qformat);  // Input to sigmoid function should be 6.25
   lstm->fXprev_c_lsh = config->cell_Qformat - (15 + config->cell_Qformat);  // For Q15xQ25 to cell_Qformat conversion
   lstm->iXc_hat_lsh = config->cell_Qformat - (15 + 15);  // For Q15xQ15 to cell_Qformat conversion
   lstm->h_lsh = config->io_Qformat - 15;  // For Q15 to io_Qformat conversion
+  lstm->cell_Qformat = config->cell_Qformat;
 
   lstm->prev_h = (vect_t *)ALIGN_MEM((char *)handle + sizeof(lstm_state_t));
-  memset(lstm->prev_h,0, config->out_feats * sizeof(vect_t));
+  memset(lstm->prev_h,0, lstm->batch * config->out_feats * sizeof(vect_t));
 
-  lstm->prev_c = (int *)ALIGN_MEM((char *)lstm->prev_h + config->out_feats * sizeof(vect_t));
-  memset(lstm->prev_c,0, config->out_feats * sizeof(int));
+  lstm->prev_c = (int *)ALIGN_MEM((char *)lstm->prev_h + lstm->batch * config->out_feats * sizeof(vect_t));
+  memset(lstm->prev_c,0, lstm->batch * config->out_feats * sizeof(int));
 
   return XA_NNLIB_NO_ERROR;
 }
@@ -269,6 +522,8 @@ int xa_nnlib_lstm_set_config(
       xa_nnlib_lstm_weights_t *p_weights;
       p_weights = (xa_nnlib_lstm_weights_t *)params;
 
+      lstm->packed_weights = NULL;
+
       if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
       {
           CHECK_MTX_SHAPE(p_weights->weights16.shape_w_xf, lstm->out_feats, lstm->in_feats)
@@ -291,7 +546,7 @@ int xa_nnlib_lstm_set_config(
           lstm->weights.weights16.w_hc = p_weights->weights16.w_hc;
           lstm->weights.weights16.w_ho = p_weights->weights16.w_ho;
       }
-      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b || lstm->precision == XA_NNLIB_LSTM_8bx8b)
       {
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xf, lstm->out_feats, lstm->in_feats)
           CHECK_MTX_SHAPE(p_weights->weights8.shape_w_xi, lstm->out_feats, lstm->in_feats)
@@ -321,6 +576,23 @@ int xa_nnlib_lstm_set_config(
       xa_nnlib_lstm_biases_t *p_biases;
       p_biases = (xa_nnlib_lstm_biases_t *)params;
 
+      if(lstm->precision == XA_NNLIB_LSTM_8bx8b)
+      {
+        xa_nnlib_lstm_biases32_t *p_biases32;
+        p_biases32 = (xa_nnlib_lstm_biases32_t *)params;
+
+        CHECK_VEC_SHAPE(p_biases32->shape_b_f, lstm->out_feats)
+        CHECK_VEC_SHAPE(p_biases32->shape_b_i, lstm->out_feats)
+        CHECK_VEC_SHAPE(p_biases32->shape_b_c, lstm->out_feats)
+        CHECK_VEC_SHAPE(p_biases32->shape_b_o, lstm->out_feats)
+
+        lstm->biases32.b_f = p_biases32->b_f;
+        lstm->biases32.b_i = p_biases32->b_i;
+        lstm->biases32.b_c = p_biases32->b_c;
+        lstm->biases32.b_o = p_biases32->b_o;
+        break;
+      }
+
       CHECK_VEC_SHAPE(p_biases->shape_b_f, lstm->out_feats)
       CHECK_VEC_SHAPE(p_biases->shape_b_i, lstm->out_feats)
       CHECK_VEC_SHAPE(p_biases->shape_b_c, lstm->out_feats)
@@ -333,21 +605,41 @@ int xa_nnlib_lstm_set_config(
     }
     break;
 
-    case XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT:
+    case XA_NNLIB_LSTM_QUANT_PARAMS:
     {
-      vect_t *prev_h;
-      prev_h = (vect_t *)params;
+      xa_nnlib_lstm_quant_params_t *p_quant;
+      int gate;
+      p_quant = (xa_nnlib_lstm_quant_params_t *)params;
+
+      if(lstm->precision != XA_NNLIB_LSTM_8bx8b)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
 
-      memcpy(lstm->prev_h,prev_h,lstm->out_feats * sizeof(vect_t));
+      if(p_quant->input_zero_bias < -127 || p_quant->input_zero_bias > 128 ||
+         p_quant->hidden_zero_bias < -127 || p_quant->hidden_zero_bias > 128 ||
+         p_quant->hidden_shift < -31 || p_quant->hidden_shift > 31)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_QUANT_PARAMS;
+
+      for(gate = 0; gate < 4; gate++)
+      {
+        if(p_quant->x_shift[gate] < -31 || p_quant->x_shift[gate] > 31 ||
+           p_quant->h_shift[gate] < -31 || p_quant->h_shift[gate] > 31)
+          return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_QUANT_PARAMS;
+      }
+
+      memcpy(&lstm->quant, p_quant, sizeof(xa_nnlib_lstm_quant_params_t));
+      lstm->quant_set = 1;
     }
     break;
 
-    case XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL:
+    case XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT:
     {
-      int *prev_c;
-      prev_c = (int *)params;
+      memcpy(lstm->prev_h,params,lstm->batch * lstm->out_feats * LSTM_H_SIZE(lstm));
+    }
+    break;
 
-      memcpy(lstm->prev_c,prev_c,lstm->out_feats * sizeof(int));
+    case XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL:
+    {
+      memcpy(lstm->prev_c,params,lstm->batch * lstm->out_feats * LSTM_C_SIZE(lstm));
     }
     break;
 
@@ -402,7 +694,7 @@ int xa_nnlib_lstm_get_config(
           p_weights->weights16.w_hc = lstm->weights.weights16.w_hc;
           p_weights->weights16.w_ho = lstm->weights.weights16.w_ho;
       }
-      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b || lstm->precision == XA_NNLIB_LSTM_8bx8b)
       {
           memcpy(&(p_weights->weights8.shape_w_xf), &(lstm->weights.weights8.shape_w_xf), sizeof(xa_nnlib_shape_t));
           memcpy(&(p_weights->weights8.shape_w_xi), &(lstm->weights.weights8.shape_w_xi), sizeof(xa_nnlib_shape_t));
@@ -432,6 +724,23 @@ int xa_nnlib_lstm_get_config(
       xa_nnlib_lstm_biases_t *p_biases;
       p_biases = (xa_nnlib_lstm_biases_t *)params;
 
+      if(lstm->precision == XA_NNLIB_LSTM_8bx8b)
+      {
+        xa_nnlib_lstm_biases32_t *p_biases32;
+        p_biases32 = (xa_nnlib_lstm_biases32_t *)params;
+
+        memcpy(&(p_biases32->shape_b_f), &(lstm->biases32.shape_b_f), sizeof(xa_nnlib_shape_t));
+        memcpy(&(p_biases32->shape_b_i), &(lstm->biases32.shape_b_i), sizeof(xa_nnlib_shape_t));
+        memcpy(&(p_biases32->shape_b_c), &(lstm->biases32.shape_b_c), sizeof(xa_nnlib_shape_t));
+        memcpy(&(p_biases32->shape_b_o), &(lstm->biases32.shape_b_o), sizeof(xa_nnlib_shape_t));
+
+        p_biases32->b_f = lstm->biases32.b_f;
+        p_biases32->b_i = lstm->biases32.b_i;
+        p_biases32->b_c = lstm->biases32.b_c;
+        p_biases32->b_o = lstm->biases32.b_o;
+        break;
+      }
+
       memcpy(&(p_biases->shape_b_f), &(lstm->biases.shape_b_f), sizeof(xa_nnlib_shape_t));
       memcpy(&(p_biases->shape_b_i), &(lstm->biases.shape_b_i), sizeof(xa_nnlib_shape_t));
       memcpy(&(p_biases->shape_b_c), &(lstm->biases.shape_b_c), sizeof(xa_nnlib_shape_t));
@@ -450,7 +759,7 @@ int xa_nnlib_lstm_get_config(
       inp_shape = (xa_nnlib_shape_t *)params;
       inp_shape->dim.vector.length = lstm->in_feats;
       inp_shape->shape_type = SHAPE_VECTOR_T;
-      inp_shape->n_shapes = 1;
+      inp_shape->n_shapes = lstm->batch;
       inp_shape->shape_offset = -1;
     }
     break;
@@ -461,26 +770,29 @@ int xa_nnlib_lstm_get_config(
       out_shape = (xa_nnlib_shape_t *)params;
       out_shape->dim.vector.length = lstm->out_feats;
       out_shape->shape_type = SHAPE_VECTOR_T;
-      out_shape->n_shapes = 1;
+      out_shape->n_shapes = lstm->batch;
       out_shape->shape_offset = -1;
     }
     break;
 
-    case XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT:
+    case XA_NNLIB_LSTM_QUANT_PARAMS:
     {
-      vect_t *prev_h;
-      prev_h = (vect_t *)params;
+      if(lstm->precision != XA_NNLIB_LSTM_8bx8b)
+        return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID;
 
-      memcpy(prev_h,lstm->prev_h,lstm->out_feats * sizeof(vect_t));
+      memcpy(params, &lstm->quant, sizeof(xa_nnlib_lstm_quant_params_t));
     }
     break;
 
-    case XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL:
+    case XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT:
     {
-      int *prev_c;
-      prev_c = (int *)params;
+      memcpy(params,lstm->prev_h,lstm->batch * lstm->out_feats * LSTM_H_SIZE(lstm));
+    }
+    break;
 
-      memcpy(prev_c,lstm->prev_c,lstm->out_feats * sizeof(int));
+    case XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL:
+    {
+      memcpy(params,lstm->prev_c,lstm->batch * lstm->out_feats * LSTM_C_SIZE(lstm));
     }
     break;
 
@@ -491,6 +803,322 @@ int xa_nnlib_lstm_get_config(
   return XA_NNLIB_NO_ERROR;
 }
 
+/* Packed layout: for every block of two output rows and every group of
+   four columns of [W_x, W_h], the 2x4 weights of the f, i, c and o gates
+   follow each other, so the fused kernel reads the weights of a block as
+   one sequential stream. */
+#define LSTM_PACK_GATES(type, w)                                                        \
+{                                                                                       \
+  type *p_dst = (type *)p_packed;                                                       \
+  type *w_x[4], *w_h[4];                                                                \
+  int row, col, gate, k;                                                                \
+  w_x[0] = lstm->weights.w.w_xf; w_h[0] = lstm->weights.w.w_hf;                         \
+  w_x[1] = lstm->weights.w.w_xi; w_h[1] = lstm->weights.w.w_hi;                         \
+  w_x[2] = lstm->weights.w.w_xc; w_h[2] = lstm->weights.w.w_hc;                         \
+  w_x[3] = lstm->weights.w.w_xo; w_h[3] = lstm->weights.w.w_ho;                         \
+  for(gate = 0; gate < 4; gate++)                                                       \
+  {                                                                                     \
+    CHECK_PTR(w_x[gate], XA_NNLIB_FATAL_MEM_ALLOC);                                     \
+    CHECK_PTR(w_h[gate], XA_NNLIB_FATAL_MEM_ALLOC);                                     \
+  }                                                                                     \
+  for(row = 0; row < lstm->out_feats; row += 2)                                         \
+  {                                                                                     \
+    for(col = 0; col < lstm->in_feats + lstm->out_feats; col += 4)                      \
+    {                                                                                   \
+      for(gate = 0; gate < 4; gate++)                                                   \
+      {                                                                                 \
+        for(k = 0; k < 2; k++)                                                          \
+        {                                                                               \
+          type *p_src = (col < lstm->in_feats) ?                                        \
+              &w_x[gate][(row + k) * x_stride + col] :                                  \
+              &w_h[gate][(row + k) * h_stride + col - lstm->in_feats];                  \
+          memcpy(p_dst, p_src, 4 * sizeof(type));                                       \
+          p_dst += 4;                                                                   \
+        }                                                                               \
+      }                                                                                 \
+    }                                                                                   \
+  }                                                                                     \
+}
+
+int xa_nnlib_lstm_pack_weights(
+  xa_nnlib_handle_t handle,
+  void *p_packed )
+{
+  lstm_state_t *lstm;
+  int x_stride, h_stride;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_packed, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_packed, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  lstm = (lstm_state_t *) handle;
+
+  if(lstm->precision == XA_NNLIB_LSTM_8bx8b)
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PRECISION;
+
+  x_stride = lstm->in_feats + lstm->pad*XA_PAD_BYTES;
+  h_stride = lstm->out_feats + lstm->pad*XA_PAD_BYTES;
+
+  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  {
+    LSTM_PACK_GATES(coeff_t, weights16)
+  }
+  else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+  {
+    LSTM_PACK_GATES(coeff8_t, weights8)
+  }
+
+  lstm->packed_weights = p_packed;
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* One frame of every stream. For each gate the W_x and W_h products of all
+   streams are computed by the batch kernels, so every weight matrix is
+   read once per call; the unshifted accumulators are added and rounded
+   exactly as in the single stream matXvec kernels. */
+static Int32 lstm_process_batch(lstm_state_t *lstm,
+    scratch_mem_t *scratch_mem,
+    batch_scratch_mem_t *batch_mem,
+    vect_t *input,
+    vect_t *output,
+    int in_stride,
+    int out_stride)
+{
+  coeff_t *w_x16[4], *w_h16[4], *bias[4];
+  coeff8_t *w_x8[4], *w_h8[4];
+  int out_feats = lstm->out_feats;
+  int gate, b, err = 0;
+
+  w_x16[0] = lstm->weights.weights16.w_xf; w_h16[0] = lstm->weights.weights16.w_hf;
+  w_x16[1] = lstm->weights.weights16.w_xi; w_h16[1] = lstm->weights.weights16.w_hi;
+  w_x16[2] = lstm->weights.weights16.w_xc; w_h16[2] = lstm->weights.weights16.w_hc;
+  w_x16[3] = lstm->weights.weights16.w_xo; w_h16[3] = lstm->weights.weights16.w_ho;
+
+  w_x8[0] = lstm->weights.weights8.w_xf; w_h8[0] = lstm->weights.weights8.w_hf;
+  w_x8[1] = lstm->weights.weights8.w_xi; w_h8[1] = lstm->weights.weights8.w_hi;
+  w_x8[2] = lstm->weights.weights8.w_xc; w_h8[2] = lstm->weights.weights8.w_hc;
+  w_x8[3] = lstm->weights.weights8.w_xo; w_h8[3] = lstm->weights.weights8.w_ho;
+
+  bias[0] = lstm->biases.b_f;
+  bias[1] = lstm->biases.b_i;
+  bias[2] = lstm->biases.b_c;
+  bias[3] = lstm->biases.b_o;
+
+  for(b = 0; b < lstm->batch; b++)
+  {
+    batch_mem->pp_input[b] = input + b * in_stride;
+    batch_mem->pp_prev_h[b] = lstm->prev_h + b * out_feats;
+    batch_mem->pp_x_proj[b] = batch_mem->x_proj + b * out_feats;
+    batch_mem->pp_h_proj[b] = batch_mem->h_proj + b * out_feats;
+  }
+  memset(batch_mem->zero_bias, 0, out_feats * sizeof(WORD16));
+
+  for(gate = 0; gate < 4; gate++)
+  {
+    if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+    {
+      err = xa_nn_matXvec_batch_16x16_64(
+          batch_mem->pp_x_proj,
+          w_x16[gate],
+          batch_mem->pp_input,
+          bias[gate],
+          out_feats,
+          lstm->in_feats,
+          lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->bias_shift,
+          lstm->batch);
+
+      err |= xa_nn_matXvec_batch_16x16_64(
+          batch_mem->pp_h_proj,
+          w_h16[gate],
+          batch_mem->pp_prev_h,
+          batch_mem->zero_bias,
+          out_feats,
+          out_feats,
+          out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          0,
+          lstm->batch);
+    }
+    else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+    {
+      err = xa_nn_matXvec_batch_8x16_64(
+          batch_mem->pp_x_proj,
+          w_x8[gate],
+          batch_mem->pp_input,
+          bias[gate],
+          out_feats,
+          lstm->in_feats,
+          lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->bias_shift,
+          lstm->batch);
+
+      err |= xa_nn_matXvec_batch_8x16_64(
+          batch_mem->pp_h_proj,
+          w_h8[gate],
+          batch_mem->pp_prev_h,
+          batch_mem->zero_bias,
+          out_feats,
+          out_feats,
+          out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          0,
+          lstm->batch);
+    }
+    if(err)
+      return err;
+
+    for(b = 0; b < lstm->batch; b++)
+    {
+      lstm_add_acc64_32(
+          scratch_mem->temp_mem.vec,
+          batch_mem->pp_x_proj[b],
+          batch_mem->pp_h_proj[b],
+          lstm->matmul_lsh + 32,
+          out_feats);
+
+      if(gate == 2)
+      {
+        xa_nn_vec_tanh_32_16(batch_mem->gate[gate] + b * out_feats, scratch_mem->temp_mem.vec, out_feats);
+      }
+      else
+      {
+        xa_nn_vec_sigmoid_32_16(batch_mem->gate[gate] + b * out_feats, scratch_mem->temp_mem.vec, out_feats);
+      }
+    }
+  }
+
+  for(b = 0; b < lstm->batch; b++)
+  {
+    int offset = b * out_feats;
+
+    vec_elem_mul_16x32plus16x16_16(
+        lstm->prev_c + offset,
+        batch_mem->gate[0] + offset,
+        lstm->prev_c + offset,
+        batch_mem->gate[1] + offset,
+        batch_mem->gate[2] + offset,
+        lstm->fXprev_c_lsh,
+        lstm->iXc_hat_lsh,
+        out_feats);
+
+    xa_nn_vec_tanh_32_16(
+        batch_mem->gate[2] + offset,
+        lstm->prev_c + offset,
+        out_feats);
+
+    lstm_output_kernel_16x16_16(
+        output + b * out_stride,
+        lstm->prev_h + offset,
+        batch_mem->gate[3] + offset,
+        batch_mem->gate[2] + offset,
+        lstm->h_lsh,
+        out_feats);
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* One gate of XA_NNLIB_LSTM_8bx8b: the W_x*x + b and W_h*h products are
+   requantized to Q3.12 by the 16 bit output matXvec kernel, added with
+   saturation and activated in place in p_gate. */
+static Int32 lstm_gate_8x8(lstm_state_t *lstm,
+    WORD16 *p_gate,
+    WORD16 *p_h_part,
+    const WORD8 *input,
+    const coeff8_t *w_x,
+    const coeff8_t *w_h,
+    const Int32 *bias,
+    int gate,
+    int is_tanh)
+{
+  xa_nnlib_lstm_quant_params_t *p_quant = &lstm->quant;
+  int err;
+
+  err = xa_nn_matXvec_out_stride_sym8sxasym8s_16(
+      p_gate,
+      w_x,
+      input,
+      bias,
+      lstm->out_feats,
+      lstm->in_feats,
+      lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+      1,
+      p_quant->input_zero_bias,
+      p_quant->x_multiplier[gate],
+      p_quant->x_shift[gate]);
+
+  err |= xa_nn_matXvec_out_stride_sym8sxasym8s_16(
+      p_h_part,
+      w_h,
+      (const WORD8 *)lstm->prev_h,
+      NULL,
+      lstm->out_feats,
+      lstm->out_feats,
+      lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+      1,
+      p_quant->hidden_zero_bias,
+      p_quant->h_multiplier[gate],
+      p_quant->h_shift[gate]);
+
+  err |= xa_nn_elm_add_sat_16x16_16(p_gate, p_gate, p_h_part, lstm->out_feats);
+  if(err)
+    return err;
+
+  if(is_tanh)
+    return xa_nn_vec_tanh_16_16(p_gate, p_gate, 3, lstm->out_feats);
+
+  return xa_nn_vec_sigmoid_16_16(p_gate, p_gate, 3, lstm->out_feats);
+}
+
+/* Fully integer LSTM step: 8 bit input, weights and hidden state, Q3.12
+   gates, Q0.15 activations and 16 bit cell state. */
+static Int32 lstm_process_8x8(lstm_state_t *lstm,
+    scratch_mem_t *scratch_mem,
+    const WORD8 *input,
+    WORD8 *output)
+{
+  xa_nnlib_lstm_quant_params_t *p_quant = &lstm->quant;
+  WORD16 *f = scratch_mem->f_f;
+  WORD16 *i_or_o = scratch_mem->i_f_or_o_f;
+  WORD16 *c_hat_or_tanh_c = scratch_mem->c_hat_f_or_tanh_c_f;
+  WORD16 *h_part = (WORD16 *)scratch_mem->temp_mem.vec;
+  WORD16 *prev_c = (WORD16 *)lstm->prev_c;
+  WORD8 *prev_h = (WORD8 *)lstm->prev_h;
+  int err;
+
+  err = lstm_gate_8x8(lstm, f, h_part, input, lstm->weights.weights8.w_xf, lstm->weights.weights8.w_hf, lstm->biases32.b_f, 0, 0);
+  err |= lstm_gate_8x8(lstm, i_or_o, h_part, input, lstm->weights.weights8.w_xi, lstm->weights.weights8.w_hi, lstm->biases32.b_i, 1, 0);
+  err |= lstm_gate_8x8(lstm, c_hat_or_tanh_c, h_part, input, lstm->weights.weights8.w_xc, lstm->weights.weights8.w_hc, lstm->biases32.b_c, 2, 1);
+  if(err)
+    return err;
+
+  // c = f*c + i*c_hat, Q0.15 x cell_Qformat and Q0.15 x Q0.15 to cell_Qformat
+  err = xa_nn_lstm_cell_update_16x16_16(prev_c, f, i_or_o, c_hat_or_tanh_c, lstm->cell_Qformat, lstm->out_feats);
+  err |= lstm_gate_8x8(lstm, i_or_o, h_part, input, lstm->weights.weights8.w_xo, lstm->weights.weights8.w_ho, lstm->biases32.b_o, 3, 0);
+  if(err)
+    return err;
+
+  err = xa_nn_vec_tanh_16_16(c_hat_or_tanh_c, prev_c, 15 - lstm->cell_Qformat, lstm->out_feats);
+  if(err)
+    return err;
+
+  // h = o*tanh(c), Q0.30 requantized to the output
+  err = xa_nn_lstm_hidden_16x16_asym8s(prev_h, i_or_o, c_hat_or_tanh_c, p_quant->hidden_multiplier,
+      p_quant->hidden_shift, -p_quant->hidden_zero_bias, lstm->out_feats);
+  if(err)
+    return err;
+
+  memcpy(output, prev_h, lstm->out_feats * sizeof(WORD8));
+
+  return XA_NNLIB_NO_ERROR;
+}
+
 int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     void *scratch,
     void *input,
@@ -500,6 +1128,8 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
 {
   lstm_state_t *lstm;
   scratch_mem_t *scratch_mem;
+  batch_scratch_mem_t *batch_mem = NULL;
+  int in_stride = 0, out_stride = 0;
 
   CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
   CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
@@ -530,6 +1160,32 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
   }
 
+  if(lstm->batch > 1)
+  {
+    in_stride = (p_in_shape->shape_offset == -1) ? lstm->in_feats : p_in_shape->shape_offset;
+    out_stride = (p_out_shape->shape_offset == -1) ? lstm->out_feats : p_out_shape->shape_offset;
+
+    // Streams must stay 8 bytes aligned
+    if(in_stride < lstm->in_feats || (in_stride&3) != 0 ||
+       out_stride < lstm->out_feats || (out_stride&3) != 0)
+    {
+      return XA_NNLIB_FATAL_INVALID_SHAPE;
+    }
+
+    if(p_out_shape->n_shapes < lstm->batch)
+    {
+      return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+    }
+
+    if(p_in_shape->n_shapes < lstm->batch)
+    {
+      return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
+    }
+
+    p_in_shape->n_shapes = lstm->batch;
+    p_out_shape->n_shapes = lstm->batch;
+  }
+
   p_in_shape->dim.vector.length = lstm->in_feats;
   p_out_shape->dim.vector.length = lstm->out_feats;
 
@@ -550,17 +1206,89 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
 
 #endif
+    scratch_alloc(sptr, scratch_mem->xh, vect_t, lstm->in_feats + lstm->out_feats);
+    scratch_alloc(sptr, scratch_mem->gate, Int32, 4 * lstm->out_feats);
+
+    if(lstm->batch > 1)
+    {
+      int gate;
+
+      scratch_alloc(sptr, batch_mem, batch_scratch_mem_t, 1);
+      scratch_alloc(sptr, batch_mem->x_proj, WORD64, lstm->batch * lstm->out_feats);
+      scratch_alloc(sptr, batch_mem->h_proj, WORD64, lstm->batch * lstm->out_feats);
+      for(gate = 0; gate < 4; gate++)
+      {
+        scratch_alloc(sptr, batch_mem->gate[gate], vect_t, lstm->batch * lstm->out_feats);
+      }
+      scratch_alloc(sptr, batch_mem->zero_bias, WORD16, lstm->out_feats);
+      scratch_alloc(sptr, batch_mem->pp_x_proj, WORD64 *, lstm->batch);
+      scratch_alloc(sptr, batch_mem->pp_h_proj, WORD64 *, lstm->batch);
+      scratch_alloc(sptr, batch_mem->pp_input, WORD16 *, lstm->batch);
+      scratch_alloc(sptr, batch_mem->pp_prev_h, WORD16 *, lstm->batch);
+    }
   }
 
 #ifdef MODEL_INT16
-  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  if(lstm->precision == XA_NNLIB_LSTM_8bx8b)
+  {
+    if(!lstm->quant_set)
+    {
+      return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_QUANT_PARAMS;
+    }
+
+    if(XA_NNLIB_NO_ERROR != lstm_process_8x8(lstm, scratch_mem, (WORD8 *)input, (WORD8 *)output))
+    {
+      return XA_NNLIB_FATAL_INVALID_SHAPE;
+    }
+  }
+  else if(lstm->batch > 1)
+  {
+    if(XA_NNLIB_NO_ERROR != lstm_process_batch(lstm, scratch_mem, batch_mem,
+          (vect_t *)input, (vect_t *)output, in_stride, out_stride))
+    {
+      return XA_NNLIB_FATAL_INVALID_SHAPE;
+    }
+  }
+  else if(lstm->packed_weights != NULL)
+  {
+    memcpy(scratch_mem->xh, input, lstm->in_feats * sizeof(vect_t));
+    memcpy(scratch_mem->xh + lstm->in_feats, lstm->prev_h, lstm->out_feats * sizeof(vect_t));
+
+    if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+    {
+      lstm_fused_gates_16x16_32(
+          scratch_mem->gate,
+          (coeff_t *)lstm->packed_weights,
+          scratch_mem->xh,
+          &lstm->biases,
+          lstm->out_feats,
+          lstm->in_feats + lstm->out_feats,
+          lstm->matmul_lsh + 32,
+          lstm->bias_shift);
+    }
+    else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+    {
+      lstm_fused_gates_8x16_32(
+          scratch_mem->gate,
+          (coeff8_t *)lstm->packed_weights,
+          scratch_mem->xh,
+          &lstm->biases,
+          lstm->out_feats,
+          lstm->in_feats + lstm->out_feats,
+          lstm->matmul_lsh + 32,
+          lstm->bias_shift);
+    }
+
+    lstm_fused_update(lstm, scratch_mem, (vect_t*)output);
+  }
+  else if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
   {
 
     xa_nn_matXvec_16x16_16_sigmoid(
         scratch_mem->f_f,
         lstm->weights.weights16.w_xf,
         lstm->weights.weights16.w_hf,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_f,
         lstm->out_feats,
@@ -577,7 +1305,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights16.w_xi,
         lstm->weights.weights16.w_hi,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_i,
         lstm->out_feats,
@@ -594,7 +1322,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->c_hat_f_or_tanh_c_f,
         lstm->weights.weights16.w_xc,
         lstm->weights.weights16.w_hc,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_c,
         lstm->out_feats,
@@ -621,7 +1349,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights16.w_xo,
         lstm->weights.weights16.w_ho,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_o,
         lstm->out_feats,
@@ -655,7 +1383,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->f_f,
         lstm->weights.weights8.w_xf,
         lstm->weights.weights8.w_hf,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_f,
         lstm->out_feats,
@@ -672,7 +1400,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights8.w_xi,
         lstm->weights.weights8.w_hi,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_i,
         lstm->out_feats,
@@ -689,7 +1417,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->c_hat_f_or_tanh_c_f,
         lstm->weights.weights8.w_xc,
         lstm->weights.weights8.w_hc,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_c,
         lstm->out_feats,
@@ -716,7 +1444,7 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
         scratch_mem->i_f_or_o_f,
         lstm->weights.weights8.w_xo,
         lstm->weights.weights8.w_ho,
-        input,
+        (WORD16 *)input,
         lstm->prev_h,
         lstm->biases.b_o,
         lstm->out_feats,
@@ -747,3 +1475,358 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
 
   return XA_NNLIB_NO_ERROR;
 }
+
+/* x_proj[gate] = (bias << bias_shift) + W_x * x for all frames. The 64 bit
+   accumulators are kept unshifted, so adding W_h * h in the recurrent step
+   gives bit-exact the same result as the two matrix matXvec of process. */
+static Int32 lstm_input_projection(lstm_state_t *lstm,
+    seq_scratch_mem_t *seq_mem,
+    int frames)
+{
+  coeff_t *w_x16[4], *bias[4];
+  coeff8_t *w_x8[4];
+  int gate, t, err = 0;
+
+  w_x16[0] = lstm->weights.weights16.w_xf; w_x8[0] = lstm->weights.weights8.w_xf; bias[0] = lstm->biases.b_f;
+  w_x16[1] = lstm->weights.weights16.w_xi; w_x8[1] = lstm->weights.weights8.w_xi; bias[1] = lstm->biases.b_i;
+  w_x16[2] = lstm->weights.weights16.w_xc; w_x8[2] = lstm->weights.weights8.w_xc; bias[2] = lstm->biases.b_c;
+  w_x16[3] = lstm->weights.weights16.w_xo; w_x8[3] = lstm->weights.weights8.w_xo; bias[3] = lstm->biases.b_o;
+
+  for(gate = 0; gate < 4; gate++)
+  {
+    for(t = 0; t < frames; t++)
+    {
+      seq_mem->pp_x_proj[t] = seq_mem->x_proj[gate] + t * lstm->out_feats;
+    }
+
+    if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+    {
+      err = xa_nn_matXvec_batch_16x16_64(
+          seq_mem->pp_x_proj,
+          w_x16[gate],
+          seq_mem->pp_input,
+          bias[gate],
+          lstm->out_feats,
+          lstm->in_feats,
+          lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->bias_shift,
+          frames);
+    }
+    else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+    {
+      err = xa_nn_matXvec_batch_8x16_64(
+          seq_mem->pp_x_proj,
+          w_x8[gate],
+          seq_mem->pp_input,
+          bias[gate],
+          lstm->out_feats,
+          lstm->in_feats,
+          lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->bias_shift,
+          frames);
+    }
+    if(err)
+      return err;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+int xa_nnlib_lstm_process_seq(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape)
+{
+  lstm_state_t *lstm;
+  scratch_mem_t *scratch_mem;
+  seq_scratch_mem_t *seq_mem;
+  int frames, in_stride, out_stride;
+  int t, err;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  lstm = (lstm_state_t *) handle;
+
+  if(lstm->batch > 1)
+  {
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_BATCH;
+  }
+
+  if(lstm->precision == XA_NNLIB_LSTM_8bx8b)
+  {
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PRECISION;
+  }
+
+  frames = p_in_shape->n_shapes;
+  in_stride = (p_in_shape->shape_offset == -1) ? lstm->in_feats : p_in_shape->shape_offset;
+  out_stride = (p_out_shape->shape_offset == -1) ? lstm->out_feats : p_out_shape->shape_offset;
+
+  // The scratch is sized for max_seq_frames frames
+  if(frames < 1 || frames > lstm->max_seq_frames)
+  {
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+  }
+
+  // Frames must stay 8 bytes aligned
+  if(in_stride < lstm->in_feats || (in_stride&3) != 0 ||
+     out_stride < lstm->out_feats || (out_stride&3) != 0)
+  {
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+  }
+
+  if(p_out_shape->dim.vector.length < lstm->out_feats || p_out_shape->n_shapes < frames)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+
+  if(p_in_shape->dim.vector.length < lstm->in_feats)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  p_in_shape->dim.vector.length = lstm->in_feats;
+  p_out_shape->dim.vector.length = lstm->out_feats;
+  p_out_shape->n_shapes = frames;
+
+  //setup scratch
+  {
+    char *sptr = (char *)scratch;
+    int gate;
+
+    scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
+
+    scratch_alloc(sptr, scratch_mem->f_f, vect_t, lstm->out_feats);
+    scratch_alloc(sptr, scratch_mem->i_f_or_o_f, vect_t, lstm->out_feats);
+    scratch_alloc(sptr, scratch_mem->c_hat_f_or_tanh_c_f, vect_t, lstm->out_feats);
+
+#ifdef MODEL_FLT64
+    scratch_mem->temp_mem.vec = NULL ;
+
+#elif MODEL_INT16
+    scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
+
+#endif
+
+    scratch_alloc(sptr, seq_mem, seq_scratch_mem_t, 1);
+    for(gate = 0; gate < 4; gate++)
+    {
+      scratch_alloc(sptr, seq_mem->x_proj[gate], WORD64, frames * lstm->out_feats);
+    }
+    scratch_alloc(sptr, seq_mem->pp_x_proj, WORD64 *, frames);
+    scratch_alloc(sptr, seq_mem->pp_input, WORD16 *, frames);
+  }
+
+#ifdef MODEL_INT16
+  for(t = 0; t < frames; t++)
+  {
+    seq_mem->pp_input[t] = (WORD16 *)input + t * in_stride;
+  }
+
+  err = lstm_input_projection(lstm, seq_mem, frames);
+  if(err != XA_NNLIB_NO_ERROR)
+  {
+    return err;
+  }
+
+  for(t = 0; t < frames; t++)
+  {
+    int offset = t * lstm->out_feats;
+    vect_t *p_out = (vect_t *)output + t * out_stride;
+
+    if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+    {
+      xa_nn_matXvec_16x16_16_sigmoid(
+          scratch_mem->f_f,
+          lstm->weights.weights16.w_hf,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[0] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+
+      xa_nn_matXvec_16x16_16_sigmoid(
+          scratch_mem->i_f_or_o_f,
+          lstm->weights.weights16.w_hi,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[1] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+
+      xa_nn_matXvec_16x16_16_tanh(
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->weights.weights16.w_hc,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[2] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+
+      vec_elem_mul_16x32plus16x16_16(
+          lstm->prev_c,
+          scratch_mem->f_f,
+          lstm->prev_c,
+          scratch_mem->i_f_or_o_f,
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->fXprev_c_lsh,
+          lstm->iXc_hat_lsh,
+          lstm->out_feats);
+
+      xa_nn_matXvec_16x16_16_sigmoid(
+          scratch_mem->i_f_or_o_f,
+          lstm->weights.weights16.w_ho,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[3] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+    }
+    else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+    {
+      xa_nn_matXvec_8x16_16_sigmoid(
+          scratch_mem->f_f,
+          lstm->weights.weights8.w_hf,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[0] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+
+      xa_nn_matXvec_8x16_16_sigmoid(
+          scratch_mem->i_f_or_o_f,
+          lstm->weights.weights8.w_hi,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[1] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+
+      xa_nn_matXvec_8x16_16_tanh(
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->weights.weights8.w_hc,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[2] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+
+      vec_elem_mul_16x32plus16x16_16(
+          lstm->prev_c,
+          scratch_mem->f_f,
+          lstm->prev_c,
+          scratch_mem->i_f_or_o_f,
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->fXprev_c_lsh,
+          lstm->iXc_hat_lsh,
+          lstm->out_feats);
+
+      xa_nn_matXvec_8x16_16_sigmoid(
+          scratch_mem->i_f_or_o_f,
+          lstm->weights.weights8.w_ho,
+          NULL,
+          lstm->prev_h,
+          NULL,
+          seq_mem->x_proj[3] + offset,
+          lstm->out_feats,
+          lstm->out_feats,
+          0,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          0,
+          lstm->matmul_lsh,
+          0,
+          64,
+          scratch_mem->temp_mem.vec);
+    }
+
+    xa_nn_vec_tanh_32_16(
+        scratch_mem->c_hat_f_or_tanh_c_f,
+        lstm->prev_c,
+        lstm->out_feats);
+
+    lstm_output_kernel_16x16_16(
+        p_out,
+        lstm->prev_h,
+        scratch_mem->i_f_or_o_f,
+        scratch_mem->c_hat_f_or_tanh_c_f,
+        lstm->h_lsh,
+        lstm->out_feats);
+  }
+#endif
+
+  return XA_NNLIB_NO_ERROR;
+}
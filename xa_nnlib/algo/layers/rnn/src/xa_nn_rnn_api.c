@@ -0,0 +1,577 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include <xtensa/tie/xt_hifi2.h>
+#include "xa_nnlib_rnn_api.h"
+#include "xa_nnlib_api.h"
+
+#ifdef hifi4
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+7))&(~7))
+#define ALIGN_SIZE(n) (((n)+7)&(~7))
+#endif
+#ifdef hifi5
+#define ALIGN_MEM(_sptr) (((uintptr_t)((_sptr)+15))&(~15))
+#define ALIGN_SIZE(n) (((n)+15)&(~15))
+#endif
+
+#define scratch_alloc(_sptr, p, type, sz) { p = (type *)_sptr; _sptr += ALIGN_MEM(sz * sizeof(type));}
+#define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
+#define CHECK_PTR_ALIGN(ptr, alignment, err) if((((uintptr_t)(ptr))&(alignment-1)) != 0) return err;
+
+#define CHECK_IO_SHAPE(p_shape)                               \
+{                                                             \
+  if(!(p_shape->shape_type == SHAPE_VECTOR_T))                \
+  {                                                           \
+    return XA_NNLIB_FATAL_INVALID_SHAPE;                      \
+  }                                                           \
+}
+
+/* Per layer fields of the lstm/gru configuration */
+#define LAYER_CFG(config, l, field) \
+  (((config)->cell == XA_NNLIB_RNN_CELL_LSTM) ? (config)->layer[l].lstm.field : (config)->layer[l].gru.field)
+
+/* Precision is compared within the cell's own enum, lstm and gru differ */
+#define SAME_PRECISION(config, l, m) \
+  (((config)->cell == XA_NNLIB_RNN_CELL_LSTM) ? ((config)->layer[l].lstm.precision == (config)->layer[m].lstm.precision) : \
+                                               ((config)->layer[l].gru.precision == (config)->layer[m].gru.precision))
+
+#define IS_8BX8B(config) \
+  (((config)->cell == XA_NNLIB_RNN_CELL_LSTM) ? ((config)->layer[0].lstm.precision == XA_NNLIB_LSTM_8bx8b) : \
+                                               ((config)->layer[0].gru.precision == XA_NNLIB_GRU_8bx8b))
+
+typedef struct _rnn_state_t
+{
+  xa_nnlib_handle_t cells[XA_NNLIB_RNN_MAX_LAYERS][2];
+  Int32 *zero_context;    /* out_feats zeros, initial context of the backward cells */
+  int cell;
+  int n_layers;
+  int n_dirs;
+  int window;
+  int elem_size;          /* bytes of one input/output element */
+  int use_seq;            /* forward cells run with xa_nnlib_lstm_process_seq */
+  int in_feats[XA_NNLIB_RNN_MAX_LAYERS];
+  int out_feats[XA_NNLIB_RNN_MAX_LAYERS];
+} rnn_state_t;
+
+/* Input/output of the layers inside the stack, window x (dirs x out_feats) */
+typedef struct _scratch_mem_t
+{
+  char *layer_io[2];
+  void *cell_scratch;
+} scratch_mem_t;
+
+static int rnn_max_out_feats(xa_nnlib_rnn_init_config_t *config)
+{
+  int l, max_feats = 0;
+  for(l = 0; l < config->n_layers; l++)
+  {
+    if(LAYER_CFG(config, l, out_feats) > max_feats)
+      max_feats = LAYER_CFG(config, l, out_feats);
+  }
+  return max_feats;
+}
+
+/* lstm config of layer l, process_seq runs up to a window of frames */
+static void rnn_lstm_config(xa_nnlib_rnn_init_config_t *config, int l, xa_nnlib_lstm_init_config_t *lstm_config)
+{
+  *lstm_config = config->layer[l].lstm;
+  lstm_config->max_seq_frames = config->window;
+}
+
+static Int32 rnn_cell_persistent(xa_nnlib_rnn_init_config_t *config, int l)
+{
+  if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+  {
+    xa_nnlib_lstm_init_config_t lstm_config;
+    rnn_lstm_config(config, l, &lstm_config);
+    return xa_nnlib_lstm_get_persistent_fast(&lstm_config);
+  }
+
+  return xa_nnlib_gru_get_persistent_fast(&config->layer[l].gru);
+}
+
+/* Cell scratch, sized for xa_nnlib_lstm_process_seq over a window if used */
+static Int32 rnn_cell_scratch(xa_nnlib_rnn_init_config_t *config, int l)
+{
+  if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+  {
+    xa_nnlib_lstm_init_config_t lstm_config;
+    rnn_lstm_config(config, l, &lstm_config);
+
+    if(IS_8BX8B(config))
+      return xa_nnlib_lstm_get_scratch_fast(&lstm_config);
+
+    return xa_nnlib_lstm_get_scratch_seq_fast(&lstm_config);
+  }
+
+  return xa_nnlib_gru_get_scratch_fast(&config->layer[l].gru);
+}
+
+static Int32 validate_config(xa_nnlib_rnn_init_config_t *config)
+{
+  int l, n_dirs, ret;
+
+  if(config->cell != XA_NNLIB_RNN_CELL_LSTM && config->cell != XA_NNLIB_RNN_CELL_GRU)
+    return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_CELL;
+
+  if(config->n_layers < 1 || config->n_layers > XA_NNLIB_RNN_MAX_LAYERS)
+    return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYERS;
+
+  if((config->bidirectional != 0) && (config->bidirectional != 1))
+    return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_BIDIRECTIONAL;
+
+  if(config->window < 1 || config->window > XA_NNLIB_RNN_MAX_WINDOW)
+    return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_WINDOW;
+
+  n_dirs = config->bidirectional + 1;
+
+  for(l = 0; l < config->n_layers; l++)
+  {
+    ret = rnn_cell_persistent(config, l);
+    if(ret < 0)
+      return ret;
+
+    if(LAYER_CFG(config, l, batch) > 1 ||
+       !SAME_PRECISION(config, l, 0))
+      return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYER_CONFIG;
+
+    if(l > 0 && LAYER_CFG(config, l, in_feats) != n_dirs * LAYER_CFG(config, l - 1, out_feats))
+      return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYER_CONFIG;
+
+    // 8 bit frames and backward halves must stay 8 bytes aligned
+    if(IS_8BX8B(config) && (LAYER_CFG(config, l, out_feats)&7) != 0)
+      return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYER_CONFIG;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+Int32 xa_nnlib_rnn_get_persistent_fast(
+     xa_nnlib_rnn_init_config_t *config )
+{
+  int persistent_size, ret, l;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = validate_config(config);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  persistent_size = ALIGN_SIZE(sizeof(rnn_state_t));
+  for(l = 0; l < config->n_layers; l++)
+  {
+    persistent_size += (config->bidirectional + 1) * ALIGN_SIZE(rnn_cell_persistent(config, l));
+  }
+  if(config->bidirectional)
+  {
+    persistent_size += ALIGN_SIZE(rnn_max_out_feats(config) * sizeof(Int32));
+  }
+
+  return persistent_size;
+}
+
+Int32 xa_nnlib_rnn_get_scratch_fast(
+       xa_nnlib_rnn_init_config_t *config )
+{
+  int scratch_size, cell_scratch_size, ret, l;
+  int elem_size;
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  ret = validate_config(config);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  elem_size = IS_8BX8B(config) ? sizeof(WORD8) : sizeof(vect_t);
+
+  scratch_size = ALIGN_SIZE(sizeof(scratch_mem_t));
+  if(config->n_layers > 1)
+  {
+    scratch_size += 2 * ALIGN_SIZE(config->window * (config->bidirectional + 1) * rnn_max_out_feats(config) * elem_size);
+  }
+
+  // The layers run one after the other and share the cell scratch
+  cell_scratch_size = 0;
+  for(l = 0; l < config->n_layers; l++)
+  {
+    ret = rnn_cell_scratch(config, l);
+    if(ret < 0)
+      return ret;
+    if(ret > cell_scratch_size)
+      cell_scratch_size = ret;
+  }
+  scratch_size += ALIGN_SIZE(cell_scratch_size);
+
+  return scratch_size;
+}
+
+int xa_nnlib_rnn_init(
+    xa_nnlib_handle_t handle,
+    xa_nnlib_rnn_init_config_t *config )
+{
+  rnn_state_t *rnn;
+  char *pptr;
+  int ret, l, d;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  ret = validate_config(config);
+  if(ret != XA_NNLIB_NO_ERROR)
+    return ret;
+
+  rnn = (rnn_state_t *) handle;
+  memset(rnn, 0, sizeof(rnn_state_t));
+
+  rnn->cell      = config->cell;
+  rnn->n_layers  = config->n_layers;
+  rnn->n_dirs    = config->bidirectional + 1;
+  rnn->window    = config->window;
+  rnn->elem_size = IS_8BX8B(config) ? sizeof(WORD8) : sizeof(vect_t);
+  rnn->use_seq   = (config->cell == XA_NNLIB_RNN_CELL_LSTM) && !IS_8BX8B(config);
+
+  pptr = (char *)handle + ALIGN_SIZE(sizeof(rnn_state_t));
+  for(l = 0; l < rnn->n_layers; l++)
+  {
+    rnn->in_feats[l]  = LAYER_CFG(config, l, in_feats);
+    rnn->out_feats[l] = LAYER_CFG(config, l, out_feats);
+
+    for(d = 0; d < rnn->n_dirs; d++)
+    {
+      rnn->cells[l][d] = (xa_nnlib_handle_t)pptr;
+      if(rnn->cell == XA_NNLIB_RNN_CELL_LSTM)
+      {
+        xa_nnlib_lstm_init_config_t lstm_config;
+        rnn_lstm_config(config, l, &lstm_config);
+        ret = xa_nnlib_lstm_init(rnn->cells[l][d], &lstm_config);
+      }
+      else
+        ret = xa_nnlib_gru_init(rnn->cells[l][d], &config->layer[l].gru);
+      if(ret != XA_NNLIB_NO_ERROR)
+        return ret;
+
+      pptr += ALIGN_SIZE(rnn_cell_persistent(config, l));
+    }
+  }
+
+  if(config->bidirectional)
+  {
+    rnn->zero_context = (Int32 *)pptr;
+    memset(rnn->zero_context, 0, rnn_max_out_feats(config) * sizeof(Int32));
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+int xa_nnlib_rnn_set_config(
+  xa_nnlib_handle_t handle,
+  xa_nnlib_rnn_param_id_t param_id,
+  void *params )
+{
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(params, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(params, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  // Layers are configured through their own handles
+  (void)param_id;
+
+  return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_PARAM_ID;
+}
+
+int xa_nnlib_rnn_get_config(
+  xa_nnlib_handle_t handle,
+  xa_nnlib_rnn_param_id_t param_id,
+  void *params )
+{
+  rnn_state_t *rnn;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(params, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(params, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  rnn = (rnn_state_t *) handle;
+
+  switch(param_id)
+  {
+    case XA_NNLIB_RNN_LAYER_HANDLE:
+    {
+      xa_nnlib_rnn_layer_handle_t *p_layer;
+      p_layer = (xa_nnlib_rnn_layer_handle_t *)params;
+
+      if(p_layer->layer < 0 || p_layer->layer >= rnn->n_layers ||
+         p_layer->direction < 0 || p_layer->direction >= rnn->n_dirs)
+        return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYERS;
+
+      p_layer->handle = rnn->cells[p_layer->layer][p_layer->direction];
+    }
+    break;
+
+    case XA_NNLIB_RNN_INPUT_SHAPE:
+    {
+      xa_nnlib_shape_t *inp_shape;
+      inp_shape = (xa_nnlib_shape_t *)params;
+      inp_shape->dim.vector.length = rnn->in_feats[0];
+      inp_shape->shape_type = SHAPE_VECTOR_T;
+      inp_shape->n_shapes = rnn->window;
+      inp_shape->shape_offset = -1;
+    }
+    break;
+
+    case XA_NNLIB_RNN_OUTPUT_SHAPE:
+    {
+      xa_nnlib_shape_t *out_shape;
+      out_shape = (xa_nnlib_shape_t *)params;
+      out_shape->dim.vector.length = rnn->n_dirs * rnn->out_feats[rnn->n_layers - 1];
+      out_shape->shape_type = SHAPE_VECTOR_T;
+      out_shape->n_shapes = rnn->window;
+      out_shape->shape_offset = -1;
+    }
+    break;
+
+    default:
+    return XA_NNLIB_RNN_CONFIG_FATAL_INVALID_PARAM_ID;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+/* One frame of one cell */
+static Int32 rnn_cell_process(rnn_state_t *rnn,
+    xa_nnlib_handle_t cell,
+    void *cell_scratch,
+    char *input,
+    char *output,
+    int l)
+{
+  xa_nnlib_shape_t in_shape, out_shape;
+  Int32 err;
+
+  in_shape.shape_type = SHAPE_VECTOR_T;
+  in_shape.dim.vector.length = rnn->in_feats[l];
+  in_shape.n_shapes = 1;
+  in_shape.shape_offset = -1;
+
+  out_shape.shape_type = SHAPE_VECTOR_T;
+  out_shape.dim.vector.length = rnn->out_feats[l];
+  out_shape.n_shapes = 1;
+  out_shape.shape_offset = -1;
+
+  if(rnn->cell == XA_NNLIB_RNN_CELL_LSTM)
+  {
+    return xa_nnlib_lstm_process(cell, cell_scratch, input, output, &in_shape, &out_shape);
+  }
+
+  err = xa_nnlib_gru_process(cell, cell_scratch, input, output, &in_shape, &out_shape);
+  if(err != XA_NNLIB_NO_ERROR)
+    return err;
+
+  // The GRU layer does not update its context
+  return xa_nnlib_gru_set_config(cell, XA_NNLIB_GRU_RESTORE_CONTEXT, output);
+}
+
+/* All the frames of one layer and direction, frames are in_stride and
+   out_stride bytes apart */
+static Int32 rnn_layer_process(rnn_state_t *rnn,
+    void *cell_scratch,
+    char *input,
+    char *output,
+    int in_stride,
+    int out_stride,
+    int frames,
+    int l,
+    int direction)
+{
+  xa_nnlib_handle_t cell = rnn->cells[l][direction];
+  int t, err;
+
+  if(direction == XA_NNLIB_RNN_FORWARD && rnn->use_seq)
+  {
+    xa_nnlib_shape_t in_shape, out_shape;
+
+    in_shape.shape_type = SHAPE_VECTOR_T;
+    in_shape.dim.vector.length = rnn->in_feats[l];
+    in_shape.n_shapes = frames;
+    in_shape.shape_offset = in_stride / rnn->elem_size;
+
+    out_shape.shape_type = SHAPE_VECTOR_T;
+    out_shape.dim.vector.length = rnn->out_feats[l];
+    out_shape.n_shapes = frames;
+    out_shape.shape_offset = out_stride / rnn->elem_size;
+
+    return xa_nnlib_lstm_process_seq(cell, cell_scratch, input, output, &in_shape, &out_shape);
+  }
+
+  if(direction == XA_NNLIB_RNN_BACKWARD)
+  {
+    if(rnn->cell == XA_NNLIB_RNN_CELL_LSTM)
+    {
+      err = xa_nnlib_lstm_set_config(cell, XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT, rnn->zero_context);
+      err |= xa_nnlib_lstm_set_config(cell, XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL, rnn->zero_context);
+    }
+    else
+    {
+      err = xa_nnlib_gru_set_config(cell, XA_NNLIB_GRU_RESTORE_CONTEXT, rnn->zero_context);
+    }
+    if(err)
+      return err;
+  }
+
+  for(t = 0; t < frames; t++)
+  {
+    int frame = (direction == XA_NNLIB_RNN_FORWARD) ? t : (frames - 1 - t);
+
+    err = rnn_cell_process(rnn, cell, cell_scratch,
+        input + frame * in_stride,
+        output + frame * out_stride,
+        l);
+    if(err != XA_NNLIB_NO_ERROR)
+      return err;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
+
+int xa_nnlib_rnn_process(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape )
+{
+  rnn_state_t *rnn;
+  scratch_mem_t *scratch_mem;
+  char *layer_in, *layer_out;
+  int frames, in_stride, out_stride, out_length;
+  int layer_in_stride, layer_out_stride;
+  int l, d, err;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_in_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(p_out_shape, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_in_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(p_out_shape, 4, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  CHECK_IO_SHAPE(p_in_shape);
+  CHECK_IO_SHAPE(p_out_shape);
+
+  rnn = (rnn_state_t *) handle;
+
+  frames = p_in_shape->n_shapes;
+  out_length = rnn->n_dirs * rnn->out_feats[rnn->n_layers - 1];
+  in_stride = (p_in_shape->shape_offset == -1) ? rnn->in_feats[0] : p_in_shape->shape_offset;
+  out_stride = (p_out_shape->shape_offset == -1) ? out_length : p_out_shape->shape_offset;
+
+  if(frames < 1 || frames > rnn->window)
+  {
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+  }
+
+  // Frames must stay 8 bytes aligned
+  if(in_stride < rnn->in_feats[0] || ((in_stride * rnn->elem_size)&7) != 0 ||
+     out_stride < out_length || ((out_stride * rnn->elem_size)&7) != 0)
+  {
+    return XA_NNLIB_FATAL_INVALID_SHAPE;
+  }
+
+  if(p_out_shape->dim.vector.length < out_length || p_out_shape->n_shapes < frames)
+  {
+    return XA_NNLIB_RNN_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE;
+  }
+
+  if(p_in_shape->dim.vector.length < rnn->in_feats[0])
+  {
+    return XA_NNLIB_RNN_EXECUTE_FATAL_INSUFFICIENT_DATA;
+  }
+
+  p_in_shape->dim.vector.length = rnn->in_feats[0];
+  p_out_shape->dim.vector.length = out_length;
+  p_out_shape->n_shapes = frames;
+
+  //setup scratch
+  {
+    char *sptr = (char *)scratch;
+    int max_out_feats = 0;
+
+    for(l = 0; l < rnn->n_layers; l++)
+    {
+      if(rnn->out_feats[l] > max_out_feats)
+        max_out_feats = rnn->out_feats[l];
+    }
+
+    scratch_alloc(sptr, scratch_mem, scratch_mem_t, 1);
+    scratch_mem->layer_io[0] = scratch_mem->layer_io[1] = NULL;
+    if(rnn->n_layers > 1)
+    {
+      scratch_alloc(sptr, scratch_mem->layer_io[0], char, rnn->window * rnn->n_dirs * max_out_feats * rnn->elem_size);
+      scratch_alloc(sptr, scratch_mem->layer_io[1], char, rnn->window * rnn->n_dirs * max_out_feats * rnn->elem_size);
+    }
+    scratch_mem->cell_scratch = (void *)sptr;
+  }
+
+  layer_in = (char *)input;
+  layer_in_stride = in_stride * rnn->elem_size;
+
+  for(l = 0; l < rnn->n_layers; l++)
+  {
+    if(l == rnn->n_layers - 1)
+    {
+      layer_out = (char *)output;
+      layer_out_stride = out_stride * rnn->elem_size;
+    }
+    else
+    {
+      layer_out = scratch_mem->layer_io[l&1];
+      layer_out_stride = rnn->n_dirs * rnn->out_feats[l] * rnn->elem_size;
+    }
+
+    // Backward outputs go to the second half of every frame
+    for(d = 0; d < rnn->n_dirs; d++)
+    {
+      err = rnn_layer_process(rnn, scratch_mem->cell_scratch,
+          layer_in,
+          layer_out + d * rnn->out_feats[l] * rnn->elem_size,
+          layer_in_stride,
+          layer_out_stride,
+          frames,
+          l,
+          d);
+      if(err != XA_NNLIB_NO_ERROR)
+        return err;
+    }
+
+    layer_in = layer_out;
+    layer_in_stride = layer_out_stride;
+  }
+
+  return XA_NNLIB_NO_ERROR;
+}
@@ -26,14 +26,18 @@
 
 #define XA_NNLIB_GRU    1
 
+/* Maximum number of streams of a batched GRU instance */
+#define XA_NNLIB_GRU_MAX_BATCH    8
+
 /* GET/SET Config Parameters                                */
 typedef enum _xa_nnlib_gru_param_id_t
 {
-  XA_NNLIB_GRU_RESTORE_CONTEXT     = 0,             // GET/SET prev_h
+  XA_NNLIB_GRU_RESTORE_CONTEXT     = 0,             // GET/SET prev_h, batch x out_feats (WORD8 for 8bx8b)
   XA_NNLIB_GRU_WEIGHT              = 1,             // GET/SET weights
   XA_NNLIB_GRU_BIAS                = 2,             // GET/SET biases
   XA_NNLIB_GRU_INPUT_SHAPE         = 3,             // GET input shape information
-  XA_NNLIB_GRU_OUTPUT_SHAPE        = 4              // GET output shape information
+  XA_NNLIB_GRU_OUTPUT_SHAPE        = 4,             // GET output shape information
+  XA_NNLIB_GRU_QUANT_PARAMS        = 5              // GET/SET quantization parameters, 8bx8b only
 } xa_nnlib_gru_param_id_t;
 
 /* I/O Precision Settings */
@@ -41,7 +45,7 @@ typedef enum _xa_nnlib_gru_precision_t
 {
   XA_NNLIB_GRU_16bx16b             = 100,           // Coef: 16 bits, I/O: 16 bits Fixed Point
   XA_NNLIB_GRU_8bx16b              = 101,           // Coef: 8 bits, I/O: 16 bits Fixed Point
-  XA_NNLIB_GRU_8bx8b               = 102,           // Not supported
+  XA_NNLIB_GRU_8bx8b               = 102,           // Coef: 8 bits symmetric, I/O: 8 bits asymmetric
   XA_NNLIB_GRU_flt16xflt16         = 103            // Not supported
 } xa_nnlib_gru_precision_t;
 
@@ -61,7 +65,9 @@ typedef enum _xa_nnlib_fatal_config_gru_error_code_t
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_COEFF_QFORMAT    = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 3),
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 4),
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 5),
-  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 6)
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 6),
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_BATCH            = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 7),
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_QUANT_PARAMS     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 8)
 } xa_nnlib_fatal_config_gru_error_code_t;
 
 /************************************************************/
@@ -97,6 +103,8 @@ typedef struct _xa_nnlib_gru_init_config_t
   Int16 coeff_Qformat;
   /* Number of fractional bits for input and output; 0-15 */
   Int16 io_Qformat;
+  /* Number of independent streams sharing the weights; 1-8 (0 is taken as 1) */
+  Int32 batch;
 } xa_nnlib_gru_init_config_t;
 
 /* Structure for getting/setting XA_NNLIB_GRU_WEIGHT parameter
@@ -132,6 +140,32 @@ typedef struct _xa_nnlib_gru_biases_t
   coeff_t *b_h; xa_nnlib_shape_t shape_b_h;
 } xa_nnlib_gru_biases_t; 
 
+/* XA_NNLIB_GRU_BIAS parameter for XA_NNLIB_GRU_8bx8b: 32 bit biases in
+ the scale of the W*x products. All pointer needs to be 8 bytes aligned. */
+typedef struct _xa_nnlib_gru_biases32_t
+{
+  Int32 *b_z; xa_nnlib_shape_t shape_b_z;
+  Int32 *b_r; xa_nnlib_shape_t shape_b_r;
+  Int32 *b_h; xa_nnlib_shape_t shape_b_h;
+} xa_nnlib_gru_biases32_t;
+
+/* XA_NNLIB_GRU_QUANT_PARAMS parameter for XA_NNLIB_GRU_8bx8b.
+ Gates are indexed z, r, h. The W*x + b and U*h (U*(r.h) for the h gate)
+ products of each gate are requantized to Q3.12 with their multiplier/shift
+ (shift > 0 is a left shift) and added with saturation. Sigmoid and tanh
+ give Q0.15; r.h keeps the quantization of prev_h and (1 - z) * h~, a Q0.30
+ product, is requantized to the 8 bit output with hidden_multiplier/shift. */
+typedef struct _xa_nnlib_gru_quant_params_t
+{
+  /* Negated zero point of the input; -127 to 128 */
+  Int32 input_zero_bias;
+  /* Negated zero point of the output (and prev_h); -127 to 128 */
+  Int32 hidden_zero_bias;
+  Int32 x_multiplier[3]; Int32 x_shift[3];
+  Int32 h_multiplier[3]; Int32 h_shift[3];
+  Int32 hidden_multiplier; Int32 hidden_shift;
+} xa_nnlib_gru_quant_params_t;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif    /* __cplusplus */
@@ -155,6 +189,14 @@ Int32 xa_nnlib_gru_set_config(xa_nnlib_handle_t handle, xa_nnlib_gru_param_id_t
 
 Int32 xa_nnlib_gru_get_config(xa_nnlib_handle_t handle, xa_nnlib_gru_param_id_t param_id, void *params); 			
 
+/* With batch > 1, one frame of every stream is processed per call:
+   p_in_shape->n_shapes and p_out_shape->n_shapes must be at least batch and
+   the vectors of the streams are shape_offset (in_feats/out_feats if -1)
+   elements apart. Each weight matrix is read once for all streams. */
+
+/* With XA_NNLIB_GRU_8bx8b, input and output are WORD8 and the
+   quantization parameters must be set before xa_nnlib_gru_process. This
+   precision supports batch 1 only. */
 Int32 xa_nnlib_gru_process(xa_nnlib_handle_t handle, 
     void *scratch,
     void *input,
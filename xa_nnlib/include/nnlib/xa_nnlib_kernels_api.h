@@ -696,6 +696,47 @@ WORD32 xa_nn_vec_tanh_32_8(
     WORD32       vec_length                    /*!< [in] length of vectors */
   );
 
+WORD32 xa_nn_vec_sigmoid_16_16(
+    WORD16       *p_out,                       /*!< [out] result: vec_length x 1, Q0.15, may be p_vec */
+    const WORD16 *p_vec,                       /*!< [in] input data: vec_length x 1, integer_bits integer bits */
+    WORD32       integer_bits,                 /*!< [in] integer bits of the input, 0-13 */
+    WORD32       vec_length                    /*!< [in] length of vectors */
+  );
+
+WORD32 xa_nn_vec_tanh_16_16(
+    WORD16       *p_out,                       /*!< [out] result: vec_length x 1, Q0.15, may be p_vec */
+    const WORD16 *p_vec,                       /*!< [in] input data: vec_length x 1, integer_bits integer bits */
+    WORD32       integer_bits,                 /*!< [in] integer bits of the input, 0-12 */
+    WORD32       vec_length                    /*!< [in] length of vectors */
+  );
+
+/* Elementwise steps of the fully integer (XA_NNLIB_LSTM_8bx8b) LSTM cell */
+WORD32 xa_nn_elm_add_sat_16x16_16(
+    WORD16       *p_out,                       /*!< [out] saturate16(p_inp1 + p_inp2), may be p_inp1 or p_inp2 */
+    const WORD16 *p_inp1,                      /*!< [in] first addend: num_elm x 1 */
+    const WORD16 *p_inp2,                      /*!< [in] second addend: num_elm x 1 */
+    WORD32       num_elm                       /*!< [in] length of vectors */
+  );
+
+WORD32 xa_nn_lstm_cell_update_16x16_16(
+    WORD16       *p_cell,                      /*!< [in/out] cell state: num_elm x 1, cell_Qformat fractional bits */
+    const WORD16 *p_forget_gate,               /*!< [in] forget gate: num_elm x 1, Q0.15 */
+    const WORD16 *p_input_gate,                /*!< [in] input gate: num_elm x 1, Q0.15 */
+    const WORD16 *p_cell_gate,                 /*!< [in] cell candidate: num_elm x 1, Q0.15 */
+    WORD32       cell_Qformat,                 /*!< [in] fractional bits of the cell state, 0-15 */
+    WORD32       num_elm                       /*!< [in] length of vectors */
+  );
+
+WORD32 xa_nn_lstm_hidden_16x16_asym8s(
+    WORD8        *p_out,                       /*!< [out] hidden state: num_elm x 1, asym8s */
+    const WORD16 *p_output_gate,               /*!< [in] output gate: num_elm x 1, Q0.15 */
+    const WORD16 *p_tanh_cell,                 /*!< [in] tanh of the cell state: num_elm x 1, Q0.15 */
+    WORD32       out_multiplier,               /*!< [in] requantization multiplier of the Q0.30 product */
+    WORD32       out_shift,                    /*!< [in] requantization shift, -31..31 */
+    WORD32       out_zero_bias,                /*!< [in] output zero point, -128..127 */
+    WORD32       num_elm                       /*!< [in] length of vectors */
+  );
+
 WORD32 xa_nn_vec_relu_16_16(
     WORD16       * __restrict__ p_out,
     const WORD16 * __restrict__ p_vec,
@@ -803,6 +844,157 @@ WORD32 xa_nn_conv1d_std_f32(
     WORD32 out_data_format,
     VOID *p_handle);
 
+/* Streaming conv1d: the handle keeps the last kernel_height input rows
+   between calls; each call consumes input_rows new rows and returns the
+   number of output rows ([n][out_channels]) produced, or -1 on error. */
+WORD32 xa_nn_conv1d_std_stream_getsize(
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_std_stream_init(
+    VOID *p_handle,
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv1d_std_stream_reset(
+    VOID *p_handle);
+
+WORD32 xa_nn_conv1d_std_stream_copy(
+    VOID *p_dst_handle,
+    const VOID *p_src_handle);
+
+WORD32 xa_nn_conv1d_std_stream_8x16(
+    VOID *p_handle,
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD8 * __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift);
+
+WORD32 xa_nn_conv1d_std_stream_8x8(
+    VOID *p_handle,
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift);
+
+WORD32 xa_nn_conv1d_std_stream_16x16(
+    VOID *p_handle,
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels,
+    WORD32 bias_shift,
+    WORD32 acc_shift);
+
+WORD32 xa_nn_conv1d_std_stream_f32(
+    VOID *p_handle,
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    FLOAT32* __restrict__ p_kernel,
+    FLOAT32* __restrict__ p_bias,
+    WORD32 input_rows,
+    WORD32 out_channels);
+
+/* Dilated conv1d: kernel row k of output row j reads padded input row
+   j * y_stride + k * y_dilation. Kernel layout and output format are the
+   ones of xa_nn_conv1d_std_*; scratch from xa_nn_dilated_conv1d_std_getsize. */
+WORD32 xa_nn_dilated_conv1d_std_getsize(
+    WORD32 kernel_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 y_dilation,
+    WORD32 input_precision);
+
+WORD32 xa_nn_dilated_conv1d_std_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8 * __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_dilated_conv1d_std_8x8(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_inp,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_dilated_conv1d_std_16x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_dilated_conv1d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    FLOAT32* __restrict__ p_inp,
+    FLOAT32* __restrict__ p_kernel,
+    FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
 
 WORD32 xa_nn_conv2d_std_getsize(
     WORD32 input_height,
@@ -956,6 +1148,25 @@ WORD32 xa_nn_conv2d_depthwise_getsize
    ,WORD32 inp_data_format
    );
 
+WORD32 xa_nn_dilated_conv2d_depthwise_getsize
+  (WORD32 input_height
+   ,WORD32 input_width
+   ,WORD32 input_channels
+   ,WORD32 kernel_height
+   ,WORD32 kernel_width
+   ,WORD32 channels_multiplier
+   ,WORD32 x_stride
+   ,WORD32 y_stride
+   ,WORD32 x_padding
+   ,WORD32 y_padding
+   ,WORD32 x_dilation
+   ,WORD32 y_dilation
+   ,WORD32 output_height
+   ,WORD32 output_width
+   ,WORD32 circ_buf_precision
+   ,WORD32 inp_data_format
+   );
+
 WORD32 xa_nn_conv2d_depthwise_8x8
     (pWORD8 __restrict__ p_out
      ,const WORD8 *__restrict__ p_kernel
@@ -1439,264 +1650,1493 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     WORD32 out_data_format,
     VOID *p_scratch);
 
-WORD32 xa_nn_matXvec_batch_asym8uxasym8u_asym8u(
-    UWORD8 ** __restrict__ p_out,
-    UWORD8 * __restrict__ p_mat1,
-    UWORD8 ** __restrict__ p_vec1,
-    WORD32 * __restrict__ p_bias,
-    WORD32 rows,
-    WORD32 cols1,
-    WORD32 row_stride1,
-    WORD32 vec_count,
-    WORD32 mat1_zero_bias,
-    WORD32 vec1_zero_bias,
-    WORD32 out_multiplier,
-    WORD32 out_shift,
-    WORD32 out_zero_bias);
+/* Winograd conv2d_std for 3x3 kernels with unit stride: f32 uses F(4x4,3x3),
+   16x16 and sym8sxasym8s an integer F(2x2,3x3) that is bit exact with
+   xa_nn_conv2d_std_16x16 / xa_nn_conv2d_std_per_chan_sym8sxasym8s.
+   xa_nn_conv2d_std_winograd_select returns 1 when the fast path applies.
+   The kernel, in the xa_nn_conv2d_std_* layout, is transformed once at init
+   into a 16 byte aligned buffer of xa_nn_conv2d_std_winograd_kernel_getsize
+   bytes; scratch from xa_nn_conv2d_std_winograd_getsize. */
+WORD32 xa_nn_conv2d_std_winograd_select(
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 input_precision);
 
-WORD32 xa_nn_matmul_asym8uxasym8u_asym8u(
-    UWORD8 * __restrict__ p_out,                     
-    const UWORD8 * __restrict__ p_mat1,
-    const UWORD8 * __restrict__ p_mat2,
-    const WORD32 * __restrict__ p_bias,
-    WORD32 rows,
-    WORD32 cols,
-    WORD32 row_stride,
-    WORD32 vec_count,
-    WORD32 vec_offset,
-    WORD32 out_offset,
-    WORD32 out_stride,                      
-    WORD32 mat1_zero_bias,
-    WORD32 vec1_zero_bias,
-    WORD32 out_multiplier,
-    WORD32 out_shift,
-    WORD32 out_zero_bias);
+WORD32 xa_nn_conv2d_std_winograd_kernel_getsize(
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 input_precision);
 
-WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
-    WORD8 * __restrict__ p_out,
-    const WORD8 * __restrict__ p_mat1,
-    const WORD8 * __restrict__ p_vec1,
-    const WORD32 * __restrict__ p_bias,
-    WORD32 rows,
-    WORD32 cols1,
-    WORD32 row_stride1,
-    WORD32 vec_count,
-    WORD32 vec_offset,
-    WORD32 out_offset,
-    WORD32 out_stride,                      
-    WORD32 vec1_zero_bias,
-    const WORD32* __restrict__ p_out_multiplier,
-    const WORD32* __restrict__ p_out_shift,
-    WORD32 out_zero_bias);
+WORD32 xa_nn_conv2d_std_winograd_getsize(
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 input_precision);
 
-WORD32 xa_nn_conv2d_depthwise_asym8uxasym8u(
-    pUWORD8 __restrict__ p_out,
-    const UWORD8 *__restrict__ p_kernel,
-    const UWORD8 *__restrict__ p_inp,
-    const WORD32 *__restrict__ p_bias,
-    WORD32  input_height,
-    WORD32  input_width,
-    WORD32  input_channels,
-    WORD32  kernel_height,
-    WORD32  kernel_width,
-    WORD32  channels_multiplier,
-    WORD32  x_stride,
-    WORD32  y_stride,
-    WORD32  x_padding,
-    WORD32  y_padding,
-    WORD32  out_height,
-    WORD32  out_width,
-    WORD32  input_zero_bias,
-    WORD32  kernel_zero_bias,
-    WORD32  out_multiplier,
-    WORD32  out_shift,
-    WORD32  out_zero_bias,
-    WORD32  inp_data_format,
-    WORD32  out_data_format,
-    pVOID p_scratch);
+WORD32 xa_nn_conv2d_std_winograd_transform_kernel_f32(
+    VOID *p_kernel_wg,
+    const FLOAT32 *p_kernel,
+    WORD32 input_channels,
+    WORD32 out_channels);
 
-WORD32 xa_nn_conv2d_pointwise_asym8uxasym8u
-  (pUWORD8 __restrict__ p_out
-   ,pUWORD8  __restrict__ p_kernel
-   ,pUWORD8 __restrict__ p_inp
-   ,pWORD32 __restrict__ p_bias
-   ,WORD32  input_height
-   ,WORD32  input_width
-   ,WORD32  input_channels
-   ,WORD32  out_channels
-   ,WORD32  input_zero_bias
-   ,WORD32  kernel_zero_bias
-   ,WORD32  out_multiplier
-   ,WORD32  out_shift
-   ,WORD32  out_zero_bias
-   ,WORD32  out_data_format);
+WORD32 xa_nn_conv2d_std_winograd_transform_kernel_16x16(
+    VOID *p_kernel_wg,
+    const WORD16 *p_kernel,
+    WORD32 input_channels,
+    WORD32 out_channels);
 
-WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s(
-    pWORD8 __restrict__ p_out,
-    const WORD8 *__restrict__ p_kernel,
-    const WORD8 *__restrict__ p_inp,
-    const WORD32 *__restrict__ p_bias,
-    WORD32  input_height,
-    WORD32  input_width,
-    WORD32  input_channels,
-    WORD32  kernel_height,
-    WORD32  kernel_width,
-    WORD32  channels_multiplier,
-    WORD32  x_stride,
-    WORD32  y_stride,
-    WORD32  x_padding,
-    WORD32  y_padding,
-    WORD32  out_height,
-    WORD32  out_width,
-    WORD32  input_zero_bias,
-    const WORD32  *p_out_multiplier,
-    const WORD32  *p_out_shift,
-    WORD32  out_zero_bias,
-    WORD32  inp_data_format,
-    WORD32  out_data_format,
-    pVOID p_scratch);
+WORD32 xa_nn_conv2d_std_winograd_transform_kernel_sym8s(
+    VOID *p_kernel_wg,
+    const WORD8 *p_kernel,
+    WORD32 input_channels,
+    WORD32 out_channels);
 
-WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+WORD32 xa_nn_conv2d_std_winograd_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_wg,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_std_winograd_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_wg,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_std_winograd_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
-    WORD8* __restrict__ p_kernel,
-    WORD8* __restrict__ p_inp,
-    WORD32* __restrict__ p_bias,
-    WORD32  input_height,
-    WORD32  input_width,
-    WORD32  input_channels,
-    WORD32  out_channels,
-    WORD32  input_zero_bias,
-    WORD32* __restrict__ p_out_multiplier,
-    WORD32* __restrict__ p_out_shift,
-    WORD32  out_zero_bias,
-    WORD32  out_data_format);
+    const WORD8* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_wg,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 out_channels,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
 
-WORD32 xa_nn_elm_mul_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
-                               WORD32 num_elm);
+/* Transposed convolution (deconvolution): output (y, x) accumulates input
+   (iy, ix) with kernel tap (y + y_padding - iy * y_stride,
+   x + x_padding - ix * x_stride). Computed per output phase with stride 1
+   xa_nn_conv2d_std_* sub-kernel convolutions; the integer variants are bit
+   exact with xa_nn_conv2d_std_* on the zero stuffed input (-input_zero_bias
+   for sym8sxasym8s) and spatially flipped kernel.
+   The kernel uses the xa_nn_conv2d_std_* layout and padding for conv2d and
+   the xa_nn_conv1d_std_* layout for conv1d (not padded for sym8sxasym8s);
+   scratch from xa_nn_transpose_conv2d_getsize / xa_nn_transpose_conv1d_getsize. */
+WORD32 xa_nn_transpose_conv2d_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_precision);
 
-WORD32 xa_nn_elm_add_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
-                               WORD32 num_elm);
+WORD32 xa_nn_transpose_conv2d_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch);
 
-WORD32 xa_nn_elm_mul_acc_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
-                               WORD32 num_elm);
+WORD32 xa_nn_transpose_conv2d_8x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_transpose_conv2d_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_transpose_conv2d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_transpose_conv1d_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_precision);
+
+WORD32 xa_nn_transpose_conv1d_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_transpose_conv1d_8x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_transpose_conv1d_16x16(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD16* __restrict__ p_kernel,
+    const WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_transpose_conv1d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 out_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+/* Grouped convolution: input and output channels split into groups equal
+   slices, output channels of group g only see input channels of group g
+   (groups = 1 is xa_nn_conv2d_std_*). Bit exact with xa_nn_conv2d_std_* run
+   on each group's channel slice. The kernel is
+   [out_channels][kernel_height][kernel_width][input_channels / groups], padded
+   like the xa_nn_conv2d_std_* kernel with input_channels / groups channels;
+   scratch from xa_nn_conv2d_grouped_getsize. */
+WORD32 xa_nn_conv2d_grouped_getsize(
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 groups,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 input_precision);
+
+WORD32 xa_nn_conv2d_grouped_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_grouped_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_grouped_16x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_conv2d_grouped_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 groups,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+/* Dilated conv2d_std: kernel taps are x_dilation columns and y_dilation rows
+   apart (dilation 1 is xa_nn_conv2d_std_*). A dilation above 1 needs unit
+   stride in that dimension. Bit exact with xa_nn_conv2d_std_* run on the
+   kernel expanded with zero taps; the kernel itself is the unexpanded
+   xa_nn_conv2d_std_* kernel. Scratch from xa_nn_dilated_conv2d_std_getsize. */
+WORD32 xa_nn_dilated_conv2d_std_getsize(
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 input_precision);
+
+WORD32 xa_nn_dilated_conv2d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_dilated_conv2d_std_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_dilated_conv2d_std_16x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD16* __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 x_dilation,
+    WORD32 y_dilation,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch);
+
+WORD32 xa_nn_matXvec_batch_asym8uxasym8u_asym8u(
+    UWORD8 ** __restrict__ p_out,
+    UWORD8 * __restrict__ p_mat1,
+    UWORD8 ** __restrict__ p_vec1,
+    WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u(
+    UWORD8 * __restrict__ p_out,                     
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_mat2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,                      
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,                      
+    WORD32 vec1_zero_bias,
+    const WORD32* __restrict__ p_out_multiplier,
+    const WORD32* __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_conv2d_depthwise_asym8uxasym8u(
+    pUWORD8 __restrict__ p_out,
+    const UWORD8 *__restrict__ p_kernel,
+    const UWORD8 *__restrict__ p_inp,
+    const WORD32 *__restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  channels_multiplier,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  input_zero_bias,
+    WORD32  kernel_zero_bias,
+    WORD32  out_multiplier,
+    WORD32  out_shift,
+    WORD32  out_zero_bias,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    pVOID p_scratch);
+
+WORD32 xa_nn_conv2d_pointwise_asym8uxasym8u
+  (pUWORD8 __restrict__ p_out
+   ,pUWORD8  __restrict__ p_kernel
+   ,pUWORD8 __restrict__ p_inp
+   ,pWORD32 __restrict__ p_bias
+   ,WORD32  input_height
+   ,WORD32  input_width
+   ,WORD32  input_channels
+   ,WORD32  out_channels
+   ,WORD32  input_zero_bias
+   ,WORD32  kernel_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_data_format);
+
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s(
+    pWORD8 __restrict__ p_out,
+    const WORD8 *__restrict__ p_kernel,
+    const WORD8 *__restrict__ p_inp,
+    const WORD32 *__restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  channels_multiplier,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  input_zero_bias,
+    const WORD32  *p_out_multiplier,
+    const WORD32  *p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    pVOID p_scratch);
+
+/* Kernel tap (kh, kw) of output (oh, ow) reads input row oh * y_stride - y_padding
+   + kh * y_dilation and column ow * x_stride - x_padding + kw * x_dilation.
+   NHWC input only; a dilation above 1 needs stride 1 in the same dimension.
+   Scratch from xa_nn_dilated_conv2d_depthwise_getsize. */
+WORD32 xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s(
+    pWORD8 __restrict__ p_out,
+    const WORD8 *__restrict__ p_kernel,
+    const WORD8 *__restrict__ p_inp,
+    const WORD32 *__restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  kernel_height,
+    WORD32  kernel_width,
+    WORD32  channels_multiplier,
+    WORD32  x_stride,
+    WORD32  y_stride,
+    WORD32  x_padding,
+    WORD32  y_padding,
+    WORD32  x_dilation,
+    WORD32  y_dilation,
+    WORD32  out_height,
+    WORD32  out_width,
+    WORD32  input_zero_bias,
+    const WORD32  *p_out_multiplier,
+    const WORD32  *p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  inp_data_format,
+    WORD32  out_data_format,
+    pVOID p_scratch);
+
+WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format);
+
+WORD32 xa_nn_elm_mul_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+                               const FLOAT32 * __restrict__ p_inp1,
+                               const FLOAT32 * __restrict__ p_inp2,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_elm_add_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+                               const FLOAT32 * __restrict__ p_inp1,
+                               const FLOAT32 * __restrict__ p_inp2,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_elm_mul_acc_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+                               const FLOAT32 * __restrict__ p_inp1,
+                               const FLOAT32 * __restrict__ p_inp2,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_elm_sub_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+                               const FLOAT32 * __restrict__ p_inp1,
+                               const FLOAT32 * __restrict__ p_inp2,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+                               const FLOAT32 * __restrict__ p_inp1,
+                               const FLOAT32 * __restrict__ p_inp2,
+                               WORD32 num_elm);
+
+WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 * __restrict__ p_out,
+                           const FLOAT32 * __restrict__ p_inp,
+                           WORD32 num_elm);
+
+WORD32 xa_nn_elm_add_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_left_shift,
+                            WORD32  out_multiplier,
+                            WORD32  out_activation_min,
+                            WORD32  out_activation_max,
+                    const   UWORD8 * __restrict__ p_inp1,
+                            WORD32  inp1_zero_bias,
+                            WORD32  inp1_left_shift,
+                            WORD32  inp1_multiplier,
+                    const   UWORD8 * __restrict__ p_inp2,
+                            WORD32  inp2_zero_bias,
+                            WORD32  inp2_left_shift,
+                            WORD32  inp2_multiplier,
+                            WORD32  left_shift,
+                            WORD32  num_elm);
+
+WORD32 xa_nn_elm_add_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_left_shift,
+                            WORD32  out_multiplier,
+                            WORD32  out_activation_min,
+                            WORD32  out_activation_max,
+                    const    WORD8 * __restrict__ p_inp1,
+                            WORD32  inp1_zero_bias,
+                            WORD32  inp1_left_shift,
+                            WORD32  inp1_multiplier,
+                    const    WORD8 * __restrict__ p_inp2,
+                            WORD32  inp2_zero_bias,
+                            WORD32  inp2_left_shift,
+                            WORD32  inp2_multiplier,
+                            WORD32  left_shift,
+                            WORD32  num_elm);
+
+WORD32 xa_nn_elm_mul_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                            WORD32  out_activation_min,
+                            WORD32  out_activation_max,
+                    const   UWORD8 * __restrict__ p_inp1,
+                            WORD32  inp1_zero_bias,
+                    const   UWORD8 * __restrict__ p_inp2,
+                            WORD32  inp2_zero_bias,
+                            WORD32  num_elm);
+
+WORD32 xa_nn_elm_mul_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                            WORD32  out_activation_min,
+                            WORD32  out_activation_max,
+                    const    WORD8 * __restrict__ p_inp1,
+                            WORD32  inp1_zero_bias,
+                    const    WORD8 * __restrict__ p_inp2,
+                            WORD32  inp2_zero_bias,
+                            WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_asym16s_asym8s(WORD8 * __restrict__ p_out,
+                                    const WORD16 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_elm_quantize_asym16s_asym32s(WORD32 * __restrict__ p_out,
+                                    const WORD16 * __restrict__ p_inp,
+                                    WORD32  inp_zero_bias,
+                                    WORD32  out_zero_bias,
+                                    WORD32  out_shift,
+                                    WORD32  out_multiplier,
+                                    WORD32  num_elm);
+
+WORD32 xa_nn_l2_norm_f32(
+    FLOAT32 * __restrict__ p_out,
+    const FLOAT32 * __restrict__ p_inp,
+    WORD32 num_elm);
+
+
+WORD32 xa_nn_dot_prod_f32xf32_f32(
+    FLOAT32 * __restrict__ p_out,          /* pointer to output */
+    const FLOAT32 * __restrict__ p_inp1,   /* pointer to input1 */
+    const FLOAT32 * __restrict__ p_inp2,   /* pointer to input2 */
+    WORD32 vec_length,
+    WORD32 num_vecs);
+
+WORD32 xa_nn_dot_prod_16x16_asym8s(
+    WORD8 * __restrict__ p_out,                  /* pointer to output */
+    const WORD16 * __restrict__ p_inp1_start,    /* pointer to input1 */
+    const WORD16 * __restrict__ p_inp2_start,    /* pointer to input2 */
+    const WORD32 * bias_ptr,
+    WORD32 vec_length,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 vec_count);
+
+/* Weight pre-packing for the 8-bit matXvec/matmul kernels: rows in blocks
+   of 4, interleaved 16 columns at a time, padded to a multiple of 4 rows and
+   16 columns. p_packed must be 16-byte aligned and hold
+   xa_nn_get_packed_weights_size_8(rows, cols) bytes. */
+WORD32 xa_nn_get_packed_weights_size_8(
+    WORD32 rows,
+    WORD32 cols);
+
+WORD32 xa_nn_pack_weights_8(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride);
+
+/* Padding is -mat_zero_bias; use the same mat_zero_bias in the kernel */
+WORD32 xa_nn_pack_weights_asym8u(
+    UWORD8 * __restrict__ p_packed,
+    const UWORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 mat_zero_bias);
+
+/* Single matrix variants of xa_nn_matXvec_8x8_8,
+   xa_nn_matXvec_sym8sxasym8s_asym8s and xa_nn_matmul_asym8uxasym8u_asym8u
+   on packed weights */
+WORD32 xa_nn_matXvec_8x8_8_packed(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec,
+    const WORD8 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 acc_shift,
+    WORD32 bias_shift);
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_packed(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u_packed(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_packed,
+    const UWORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat_zero_bias,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+/* Folds the asym8u zero bias terms that depend only on the weights into
+   the bias: p_folded_bias[r] = p_bias[r] + vec1_zero_bias * sum(mat1 row r)
+   + cols1 * mat1_zero_bias * vec1_zero_bias. p_bias may be NULL. */
+WORD32 xa_nn_fold_zero_bias_asym8uxasym8u(
+    WORD32 * __restrict__ p_folded_bias,
+    const UWORD8 * __restrict__ p_mat1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias);
+
+/* Single matrix asym8u kernels on a folded bias; output is identical to
+   xa_nn_matmul_asym8uxasym8u_asym8u with the original bias */
+WORD32 xa_nn_matXvec_asym8uxasym8u_asym8u_folded(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_folded_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 mat1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_asym8uxasym8u_asym8u_folded(
+    UWORD8 * __restrict__ p_out,
+    const UWORD8 * __restrict__ p_mat1,
+    const UWORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_folded_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 mat1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+/* Cache-blocked 8-bit matmul. xa_nn_matmul_get_blocking derives the block
+   sizes (multiples of 4 rows, 4 vectors and 16 columns) from the cache
+   descriptor, or from a default one when p_cache is NULL; p_scratch must
+   hold xa_nn_matmul_blocked_getsize(p_blocking) bytes. */
+typedef struct _xa_nnlib_cache_desc_t
+{
+  WORD32 l1_size;   /* bytes of L1 data cache or local data memory */
+  WORD32 l2_size;   /* bytes of the next level, 0 if there is none */
+} xa_nnlib_cache_desc_t;
+
+typedef struct _xa_nnlib_gemm_blocking_t
+{
+  WORD32 mc;        /* mat1 rows per block */
+  WORD32 nc;        /* vectors per block */
+  WORD32 kc;        /* columns per block */
+} xa_nnlib_gemm_blocking_t;
+
+WORD32 xa_nn_matmul_get_blocking(
+    xa_nnlib_gemm_blocking_t * __restrict__ p_blocking,
+    const xa_nnlib_cache_desc_t * __restrict__ p_cache,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 vec_count);
+
+WORD32 xa_nn_matmul_blocked_getsize(
+    const xa_nnlib_gemm_blocking_t * __restrict__ p_blocking);
+
+WORD32 xa_nn_matmul_8x8_8_blocked(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    const xa_nnlib_gemm_blocking_t * __restrict__ p_blocking,
+    VOID * __restrict__ p_scratch);
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_gemm_blocking_t * __restrict__ p_blocking,
+    VOID * __restrict__ p_scratch);
+
+/* Structured-sparse 8-bit weights. xa_nn_pack_sparse_weights_8 compresses
+   a pruned matrix into p_sparse (16-byte aligned, sized with
+   xa_nn_get_sparse_weights_size_8 on the same matrix); it fails if a row
+   has more than 2 nonzeros in a group of 4 columns for XA_NNLIB_SPARSE_2_4.
+   index_type selects how the kept blocks of the block formats are indexed
+   and must be valid, though 2:4 does not use it. */
+typedef enum _xa_nnlib_sparse_format_t
+{
+  XA_NNLIB_SPARSE_2_4       = 0,  /* at most 2 nonzeros in each 4 columns */
+  XA_NNLIB_SPARSE_BLOCK_1X4 = 1,  /* 1 row x 4 column blocks */
+  XA_NNLIB_SPARSE_BLOCK_4X4 = 2   /* 4 row x 4 column blocks */
+} xa_nnlib_sparse_format_t;
+
+typedef enum _xa_nnlib_sparse_index_t
+{
+  XA_NNLIB_SPARSE_INDEX_BITMASK = 0,  /* one bit per column block */
+  XA_NNLIB_SPARSE_INDEX_CSR     = 1   /* block row pointer and column indices */
+} xa_nnlib_sparse_index_t;
+
+WORD32 xa_nn_get_sparse_weights_size_8(
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 format,
+    WORD32 index_type);
+
+WORD32 xa_nn_pack_sparse_weights_8(
+    VOID * __restrict__ p_sparse,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 format,
+    WORD32 index_type);
+
+/* Single matrix xa_nn_matXvec_sym8sxasym8s_asym8s and
+   xa_nn_fully_connected_sym8sxasym8s_asym8s on sparse weights; output is
+   identical to the dense kernels on the pruned matrix */
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_sparse(
+    WORD8 * __restrict__ p_out,
+    const VOID * __restrict__ p_sparse,
+    const WORD8 * __restrict__ p_vec,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 vec_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_fully_connected_sym8sxasym8s_asym8s_sparse
+  (WORD8 *__restrict__ p_out
+   ,const VOID *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  );
+
+/* sym4s weights: two 4-bit values in -8..7 per byte, the even column in the
+   low nibble; row_stride counts weights and has to be even */
+WORD32 xa_nn_pack_weights_sym4s(
+    WORD8 * __restrict__ p_packed,
+    const WORD8 * __restrict__ p_mat,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride);
+
+WORD32 xa_nn_matXvec_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_mat2,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD8 * __restrict__ p_vec2,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2,
+    WORD32 vec1_zero_bias,
+    WORD32 vec2_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_matmul_per_chan_sym4sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
+
+WORD32 xa_nn_fully_connected_sym4sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  );
+
+WORD32 xa_nn_fully_connected_per_chan_sym4sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  );
+
+/* Multi-core matXvec/matmul. The caller provides the workers: run must call
+   fn(p_task, task) once for every task in 0..num_tasks-1, possibly
+   concurrently, and return 0 once all of them are done. A NULL p_workers
+   runs the tasks in a loop on the calling core. XA_NNLIB_SPLIT_ROWS gives
+   every worker a range of rows; XA_NNLIB_SPLIT_K gives it a range of
+   columns and reduces the partial sums in a fixed order, which needs
+   xa_nn_matmul_parallel_getsize bytes of p_scratch. Both give exactly the
+   output of the single-core kernel. Only the sym8sxasym8s kernels have
+   parallel variants. */
+#define XA_NNLIB_MAX_WORKERS 64
+
+typedef void (*xa_nnlib_task_fn_t)(VOID *p_task, WORD32 task);
+
+typedef struct _xa_nnlib_workers_t
+{
+  WORD32 num_workers;
+  WORD32 (*run)(VOID *p_ctx, xa_nnlib_task_fn_t fn, VOID *p_task, WORD32 num_tasks);
+  VOID *p_ctx;
+} xa_nnlib_workers_t;
+
+typedef enum _xa_nnlib_split_t
+{
+  XA_NNLIB_SPLIT_ROWS = 0,  /* output rows */
+  XA_NNLIB_SPLIT_K    = 1   /* columns of mat1, the reduction dimension */
+} xa_nnlib_split_t;
+
+WORD32 xa_nn_matmul_parallel_getsize(
+    WORD32 rows,
+    WORD32 vec_count,
+    WORD32 split,
+    WORD32 num_workers);
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_parallel(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 split,
+    const xa_nnlib_workers_t *p_workers,
+    VOID * __restrict__ p_scratch);
+
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_parallel(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 split,
+    const xa_nnlib_workers_t *p_workers,
+    VOID * __restrict__ p_scratch);
+
+/* Fused epilogue of the sym8sxasym8s matXvec/matmul. act_type is applied
+   to the requantized output: XA_NNLIB_ACT_RELU clamps at out_zero_bias,
+   XA_NNLIB_ACT_CLAMP to [act_min, act_max] in the output domain (relu6,
+   relu_n1_to_1). A non-NULL p_residual, laid out as p_out, is then added
+   as by xa_nn_elm_add_asym8sxasym8s_asym8s with the activated output as
+   inp1 (inp1_zero_bias = -out_zero_bias) and p_residual as inp2. A NULL
+   p_epilogue gives the plain kernel output. */
+typedef enum _xa_nnlib_act_t
+{
+  XA_NNLIB_ACT_NONE  = 0,
+  XA_NNLIB_ACT_RELU  = 1,
+  XA_NNLIB_ACT_CLAMP = 2
+} xa_nnlib_act_t;
+
+typedef struct _xa_nnlib_epilogue_t
+{
+  WORD32 act_type;            /* xa_nnlib_act_t */
+  WORD32 act_min;             /* bounds of XA_NNLIB_ACT_CLAMP */
+  WORD32 act_max;
+  const WORD8 *p_residual;    /* NULL for no residual add */
+  WORD32 left_shift;          /* parameters of the elementwise add */
+  WORD32 inp1_left_shift;
+  WORD32 inp1_multiplier;
+  WORD32 res_zero_bias;
+  WORD32 res_left_shift;
+  WORD32 res_multiplier;
+  WORD32 add_out_zero_bias;
+  WORD32 add_out_left_shift;
+  WORD32 add_out_multiplier;
+  WORD32 add_act_min;
+  WORD32 add_act_max;
+} xa_nnlib_epilogue_t;
+
+WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s_epilogue(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_epilogue_t * __restrict__ p_epilogue);
 
-WORD32 xa_nn_elm_sub_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
-                               WORD32 num_elm);
+WORD32 xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_epilogue(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_epilogue_t * __restrict__ p_epilogue);
+
+/* Transposed-weight kernels. The _t and _tn kernels take mat1 stored
+   transposed, cols1 rows of `rows` elements row_stride1 >= rows apart, and
+   compute out[m] = sum_k mat1[k][m] * vec1[k] with the rounding of the
+   kernel on the untransposed matrix. The _nt matmuls take mat2 as vec_count
+   rows of cols, vec_offset apart (out = mat1 * mat2^T). */
+WORD32 xa_nn_matXvec_t_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 acc_shift,
+    WORD32 bias_shift);
 
-WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 * __restrict__ p_out,
-                               const FLOAT32 * __restrict__ p_inp1,
-                               const FLOAT32 * __restrict__ p_inp2,
-                               WORD32 num_elm);
+WORD32 xa_nn_matXvec_t_8x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 acc_shift,
+    WORD32 bias_shift);
 
-WORD32 xa_nn_elm_floor_f32_f32(FLOAT32 * __restrict__ p_out,
-                           const FLOAT32 * __restrict__ p_inp,
-                           WORD32 num_elm);
+WORD32 xa_nn_matXvec_t_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias);
 
-WORD32 xa_nn_elm_add_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
-                            WORD32  out_zero_bias,
-                            WORD32  out_left_shift,
-                            WORD32  out_multiplier,
-                            WORD32  out_activation_min,
-                            WORD32  out_activation_max,
-                    const   UWORD8 * __restrict__ p_inp1,
-                            WORD32  inp1_zero_bias,
-                            WORD32  inp1_left_shift,
-                            WORD32  inp1_multiplier,
-                    const   UWORD8 * __restrict__ p_inp2,
-                            WORD32  inp2_zero_bias,
-                            WORD32  inp2_left_shift,
-                            WORD32  inp2_multiplier,
-                            WORD32  left_shift,
-                            WORD32  num_elm);
+WORD32 xa_nn_matmul_tn_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride);
 
-WORD32 xa_nn_elm_add_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
-                            WORD32  out_zero_bias,
-                            WORD32  out_left_shift,
-                            WORD32  out_multiplier,
-                            WORD32  out_activation_min,
-                            WORD32  out_activation_max,
-                    const    WORD8 * __restrict__ p_inp1,
-                            WORD32  inp1_zero_bias,
-                            WORD32  inp1_left_shift,
-                            WORD32  inp1_multiplier,
-                    const    WORD8 * __restrict__ p_inp2,
-                            WORD32  inp2_zero_bias,
-                            WORD32  inp2_left_shift,
-                            WORD32  inp2_multiplier,
-                            WORD32  left_shift,
-                            WORD32  num_elm);
+WORD32 xa_nn_matmul_tn_8x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride);
 
-WORD32 xa_nn_elm_mul_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
-                            WORD32  out_zero_bias,
-                            WORD32  out_shift,
-                            WORD32  out_multiplier,
-                            WORD32  out_activation_min,
-                            WORD32  out_activation_max,
-                    const   UWORD8 * __restrict__ p_inp1,
-                            WORD32  inp1_zero_bias,
-                    const   UWORD8 * __restrict__ p_inp2,
-                            WORD32  inp2_zero_bias,
-                            WORD32  num_elm);
+WORD32 xa_nn_matmul_tn_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
 
-WORD32 xa_nn_elm_mul_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
-                            WORD32  out_zero_bias,
-                            WORD32  out_shift,
-                            WORD32  out_multiplier,
-                            WORD32  out_activation_min,
-                            WORD32  out_activation_max,
-                    const    WORD8 * __restrict__ p_inp1,
-                            WORD32  inp1_zero_bias,
-                    const    WORD8 * __restrict__ p_inp2,
-                            WORD32  inp2_zero_bias,
-                            WORD32  num_elm);
+WORD32 xa_nn_matmul_nt_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride);
 
-WORD32 xa_nn_elm_quantize_asym16s_asym8s(WORD8 * __restrict__ p_out,
-                                    const WORD16 * __restrict__ p_inp,
-                                    WORD32  inp_zero_bias,
-                                    WORD32  out_zero_bias,
-                                    WORD32  out_shift,
-                                    WORD32  out_multiplier,
-                                    WORD32  num_elm);
+WORD32 xa_nn_matmul_nt_8x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride);
 
-WORD32 xa_nn_elm_quantize_asym16s_asym32s(WORD32 * __restrict__ p_out,
-                                    const WORD16 * __restrict__ p_inp,
-                                    WORD32  inp_zero_bias,
-                                    WORD32  out_zero_bias,
-                                    WORD32  out_shift,
-                                    WORD32  out_multiplier,
-                                    WORD32  num_elm);
+WORD32 xa_nn_matmul_nt_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
 
-WORD32 xa_nn_l2_norm_f32(
-    FLOAT32 * __restrict__ p_out,
-    const FLOAT32 * __restrict__ p_inp,
-    WORD32 num_elm);
+/* Strided batched matmul: batch_count independent products in the layout of
+   the single matmul kernels. Batch b reads p_mat1 + b * mat1_batch_stride,
+   the vectors at p_vec1 + b * vec1_batch_stride and writes
+   p_out + b * out_batch_stride; bias, out multiplier and out shift are
+   advanced by b * chan_batch_stride (0 shares them across the batch).
+   Strides are in elements. */
+typedef struct _xa_nnlib_batch_desc_t
+{
+  WORD32 batch_count;
+  WORD32 mat1_batch_stride;
+  WORD32 vec1_batch_stride;
+  WORD32 out_batch_stride;
+  WORD32 chan_batch_stride;
+} xa_nnlib_batch_desc_t;
+
+WORD32 xa_nn_batch_matmul_per_chan_sym8sxasym8s_asym8s(
+    WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 * __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias,
+    const xa_nnlib_batch_desc_t * __restrict__ p_batch);
 
+WORD32 xa_nn_batch_matmul_16x16_16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride,
+    WORD32 acc_shift,
+    WORD32 bias_shift,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    const xa_nnlib_batch_desc_t * __restrict__ p_batch);
+
+/* 16x8 quantization mode: int8 per-channel weights, int16 activations and
+   outputs, int64 bias, 64 bit accumulation. out_shift is in -31..14 and
+   requantization follows the TFLite int64 path. The conv needs
+   input_zero_bias 0 and scratch from xa_nn_conv2d_std_getsize with
+   input_precision 16. */
+WORD32 xa_nn_matmul_per_chan_sym8sxasym16s_asym16s(
+    WORD16 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD64 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride,
+    WORD32 vec1_zero_bias,
+    const WORD32 * __restrict__ p_out_multiplier,
+    const WORD32 * __restrict__ p_out_shift,
+    WORD32 out_zero_bias);
 
-WORD32 xa_nn_dot_prod_f32xf32_f32(
-    FLOAT32 * __restrict__ p_out,          /* pointer to output */
-    const FLOAT32 * __restrict__ p_inp1,   /* pointer to input1 */
-    const FLOAT32 * __restrict__ p_inp2,   /* pointer to input2 */
-    WORD32 vec_length,
-    WORD32 num_vecs);
+WORD32 xa_nn_fully_connected_per_chan_sym8sxasym16s_asym16s
+  (WORD16 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD16 *__restrict__ p_inp
+   ,const WORD64 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  input_zero_bias
+   ,const WORD32 *__restrict__ p_out_multiplier
+   ,const WORD32 *__restrict__ p_out_shift
+   ,WORD32  out_zero_bias
+  );
 
-WORD32 xa_nn_dot_prod_16x16_asym8s(
-    WORD8 * __restrict__ p_out,                  /* pointer to output */
-    const WORD16 * __restrict__ p_inp1_start,    /* pointer to input1 */
-    const WORD16 * __restrict__ p_inp2_start,    /* pointer to input2 */
-    const WORD32 * bias_ptr,
-    WORD32 vec_length,
-    WORD32 out_multiplier,
-    WORD32 out_shift,
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym16s(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD64* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
     WORD32 out_zero_bias,
-    WORD32 vec_count);
+    WORD32 out_data_format,
+    VOID *p_scratch);
 
 /* Mapping the functions names from previous naming convension for backward compatibility */
 #define xa_nn_matXvec_asym8xasym8_asym8 xa_nn_matXvec_asym8uxasym8u_asym8u
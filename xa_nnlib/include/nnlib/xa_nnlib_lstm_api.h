@@ -26,16 +26,21 @@
 
 #define XA_NNLIB_LSTM    2
 
+/* Maximum number of streams of a batched LSTM instance */
+#define XA_NNLIB_LSTM_MAX_BATCH    8
+#define XA_NNLIB_LSTM_MAX_SEQ_FRAMES 256
+
 /* GET/SET Config Parameters                                */
 typedef enum _xa_nnlib_lstm_param_id_t
 {
-  XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT = 0,             // GET/SET prev_h
-  XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL   = 1,             // GET/SET prev_c
+  XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT = 0,             // GET/SET prev_h, batch x out_feats (WORD8 for 8bx8b)
+  XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL   = 1,             // GET/SET prev_c, batch x out_feats (WORD16 for 8bx8b)
   XA_NNLIB_LSTM_WEIGHT                 = 2,             // GET/SET weights
   XA_NNLIB_LSTM_BIAS                   = 3,             // GET/SET biases
   XA_NNLIB_LSTM_INPUT_SHAPE            = 4,             // GET input shape information
   XA_NNLIB_LSTM_OUTPUT_SHAPE           = 5,             // GET output shape information
-  XA_NNLIB_LSTM_CELL_SHAPE             = 6              // GET cell shape information
+  XA_NNLIB_LSTM_CELL_SHAPE             = 6,             // GET cell shape information
+  XA_NNLIB_LSTM_QUANT_PARAMS           = 7              // GET/SET quantization parameters, 8bx8b only
 } xa_nnlib_lstm_param_id_t;
 
 /* I/O Precision Settings */
@@ -43,7 +48,7 @@ typedef enum _xa_nnlib_lstm_precision_t
 {
   XA_NNLIB_LSTM_16bx16b             = 100,           // Coef: 16 bits, I/O: 16 bits Fixed Point
   XA_NNLIB_LSTM_8bx16b              = 101,           // Coef: 8 bits, I/O: 16 bits Fixed Point
-  XA_NNLIB_LSTM_8bx8b               = 102,           // Not supported
+  XA_NNLIB_LSTM_8bx8b               = 102,           // Coef: 8 bits symmetric, I/O: 8 bits asymmetric
   XA_NNLIB_LSTM_flt16xflt16         = 103            // Not supported
 } xa_nnlib_lstm_precision_t;
 
@@ -64,7 +69,10 @@ typedef enum _xa_nnlib_fatal_config_lstm_error_code_t
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_CELL_QFORMAT     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 4),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 5),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 6),
-  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7)
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_FRAMES           = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 8),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_BATCH            = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 9),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_QUANT_PARAMS     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 10)
 } xa_nnlib_fatal_config_lstm_error_code_t;
 
 /************************************************************/
@@ -102,6 +110,10 @@ typedef struct _xa_nnlib_lstm_init_config_t
   Int16 cell_Qformat;
   /* Number of fractional bits for input and output; 0-15 */
   Int16 io_Qformat;
+  /* Number of independent streams sharing the weights; 1-8 (0 is taken as 1) */
+  Int32 batch;
+  /* Maximum frames per xa_nnlib_lstm_process_seq call; 1-256 (0 is taken as 1) */
+  Int32 max_seq_frames;
 } xa_nnlib_lstm_init_config_t;
 
 /* Structure for getting/setting XA_NNLIB_LSTM_WEIGHT parameter
@@ -142,6 +154,33 @@ typedef struct _xa_nnlib_lstm_biases_t
   coeff_t *b_o; xa_nnlib_shape_t shape_b_o;
 } xa_nnlib_lstm_biases_t; 
 
+/* XA_NNLIB_LSTM_BIAS parameter for XA_NNLIB_LSTM_8bx8b: 32 bit biases in
+ the scale of the W_x*x products. All pointer needs to be 8 bytes aligned. */
+typedef struct _xa_nnlib_lstm_biases32_t
+{
+  Int32 *b_f; xa_nnlib_shape_t shape_b_f;
+  Int32 *b_i; xa_nnlib_shape_t shape_b_i;
+  Int32 *b_c; xa_nnlib_shape_t shape_b_c;
+  Int32 *b_o; xa_nnlib_shape_t shape_b_o;
+} xa_nnlib_lstm_biases32_t;
+
+/* XA_NNLIB_LSTM_QUANT_PARAMS parameter for XA_NNLIB_LSTM_8bx8b.
+ Gates are indexed f, i, c, o. The W_x*x + b and W_h*h products of each gate
+ are requantized to Q3.12 with their multiplier/shift (shift > 0 is a left
+ shift) and added with saturation. Sigmoid and tanh give Q0.15, the cell
+ state is 16 bits with cell_Qformat (3-15) fractional bits and
+ o * tanh(c), a Q0.30 product, is requantized to the 8 bit output. */
+typedef struct _xa_nnlib_lstm_quant_params_t
+{
+  /* Negated zero point of the input; -127 to 128 */
+  Int32 input_zero_bias;
+  /* Negated zero point of the output (and prev_h); -127 to 128 */
+  Int32 hidden_zero_bias;
+  Int32 x_multiplier[4]; Int32 x_shift[4];
+  Int32 h_multiplier[4]; Int32 h_shift[4];
+  Int32 hidden_multiplier; Int32 hidden_shift;
+} xa_nnlib_lstm_quant_params_t;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif    /* __cplusplus */
@@ -153,6 +192,12 @@ Int32 xa_nnlib_lstm_get_persistent_fast( xa_nnlib_lstm_init_config_t *config);
 
 Int32 xa_nnlib_lstm_get_scratch_fast( xa_nnlib_lstm_init_config_t *config);
 
+/* Scratch for xa_nnlib_lstm_process_seq() with up to max_seq_frames frames per call */
+Int32 xa_nnlib_lstm_get_scratch_seq_fast( xa_nnlib_lstm_init_config_t *config);
+
+/* Size of the gate interleaved weights written by xa_nnlib_lstm_pack_weights */
+Int32 xa_nnlib_lstm_get_packed_weights_size( xa_nnlib_lstm_init_config_t *config);
+
 /************************************************************/
 /* LSTM Initialization Function                              */
 /************************************************************/
@@ -165,6 +210,12 @@ Int32 xa_nnlib_lstm_set_config(xa_nnlib_handle_t handle, xa_nnlib_lstm_param_id_
 
 Int32 xa_nnlib_lstm_get_config(xa_nnlib_handle_t handle, xa_nnlib_lstm_param_id_t param_id, void *params); 			
 
+/* Repacks the weights set with XA_NNLIB_LSTM_WEIGHT into p_packed, with the
+   rows of the four gates interleaved, and makes xa_nnlib_lstm_process use
+   the fused four gate kernel. p_packed must stay valid while in use; setting
+   XA_NNLIB_LSTM_WEIGHT again returns to the unpacked path. */
+Int32 xa_nnlib_lstm_pack_weights(xa_nnlib_handle_t handle, void *p_packed);
+
 Int32 xa_nnlib_lstm_process(xa_nnlib_handle_t handle, 
     void *scratch,
     void *input,
@@ -172,6 +223,29 @@ Int32 xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     xa_nnlib_shape_t *p_in_shape,
     xa_nnlib_shape_t *p_out_shape);
 
+/* With batch > 1, xa_nnlib_lstm_process runs one frame of every stream:
+   p_in_shape->n_shapes and p_out_shape->n_shapes must be at least batch and
+   the vectors of the streams are shape_offset (in_feats/out_feats if -1)
+   elements apart. Each weight matrix is read once for all streams. The
+   packed weights and xa_nnlib_lstm_process_seq are for batch 1 only. */
+
+/* With XA_NNLIB_LSTM_8bx8b, input and output are WORD8 and the
+   quantization parameters must be set before xa_nnlib_lstm_process. This
+   precision supports batch 1 only, without packed weights or
+   xa_nnlib_lstm_process_seq. */
+
+/* Processes p_in_shape->n_shapes frames in one call. Frames are
+   p_in_shape->shape_offset (in_feats if -1) elements apart in input and
+   p_out_shape->shape_offset (out_feats if -1) elements apart in output.
+   The input projections of all frames are computed before the recurrence,
+   so the input weights are read once per call instead of once per frame. */
+Int32 xa_nnlib_lstm_process_seq(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape);
+
 #if defined(__cplusplus)
 }
 #endif    /* __cplusplus */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_RNN_API_H__
+#define __XA_RNN_API_H__
+
+#include "xa_nnlib_standards.h"
+#include "xa_nnlib_lstm_api.h"
+#include "xa_nnlib_gru_api.h"
+
+#define XA_NNLIB_RNN    4
+
+/* Maximum number of stacked layers */
+#define XA_NNLIB_RNN_MAX_LAYERS   4
+
+/* Maximum number of frames per xa_nnlib_rnn_process call */
+#define XA_NNLIB_RNN_MAX_WINDOW   256
+
+/* GET/SET Config Parameters                                */
+typedef enum _xa_nnlib_rnn_param_id_t
+{
+  XA_NNLIB_RNN_LAYER_HANDLE        = 0,             // GET handle of one layer/direction, xa_nnlib_rnn_layer_handle_t
+  XA_NNLIB_RNN_INPUT_SHAPE         = 1,             // GET input shape information
+  XA_NNLIB_RNN_OUTPUT_SHAPE        = 2              // GET output shape information
+} xa_nnlib_rnn_param_id_t;
+
+/* Recurrent cell of all the layers */
+typedef enum _xa_nnlib_rnn_cell_t
+{
+  XA_NNLIB_RNN_CELL_LSTM           = 300,           // xa_nnlib_lstm_* layers
+  XA_NNLIB_RNN_CELL_GRU            = 301            // xa_nnlib_gru_* layers
+} xa_nnlib_rnn_cell_t;
+
+typedef enum _xa_nnlib_rnn_direction_t
+{
+  XA_NNLIB_RNN_FORWARD             = 0,
+  XA_NNLIB_RNN_BACKWARD            = 1
+} xa_nnlib_rnn_direction_t;
+
+
+/************************************************************/
+/* Class 1: Configuration Errors                            */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_config_rnn_error_code_t
+{
+  XA_NNLIB_RNN_CONFIG_FATAL_INVALID_CELL             = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN, 0),
+  XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYERS           = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN, 1),
+  XA_NNLIB_RNN_CONFIG_FATAL_INVALID_BIDIRECTIONAL    = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN, 2),
+  XA_NNLIB_RNN_CONFIG_FATAL_INVALID_WINDOW           = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN, 3),
+  XA_NNLIB_RNN_CONFIG_FATAL_INVALID_LAYER_CONFIG     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN, 4),
+  XA_NNLIB_RNN_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_RNN, 5)
+} xa_nnlib_fatal_config_rnn_error_code_t;
+
+/************************************************************/
+/* Class 1: Execution Errors                                */
+/************************************************************/
+/* Nonfatal Errors */
+/* None */
+
+/* Fatal Errors */
+typedef enum _xa_nnlib_fatal_exec_rnn_error_code_t
+{
+  XA_NNLIB_RNN_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE    = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_RNN, 0),
+  XA_NNLIB_RNN_EXECUTE_FATAL_INSUFFICIENT_DATA                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_RNN, 1)
+} xa_nnlib_fatal_exec_rnn_error_code_t;
+
+
+/* Structure for initial configuration */
+typedef struct _xa_nnlib_rnn_init_config_t
+{
+  /* Cell of all the layers */
+  xa_nnlib_rnn_cell_t cell;
+  /* Number of stacked layers; 1-4 */
+  Int32 n_layers;
+  /* 0: forward only, 1: forward and backward cell in every layer */
+  Int32 bidirectional;
+  /* Maximum number of frames per process call; 1-256 */
+  Int32 window;
+  /* Configuration of every layer, lstm or gru as per cell. All layers
+     have the same precision and batch 1; in_feats of a layer is the
+     out_feats of the previous one, twice that if bidirectional.
+     max_seq_frames of the lstm layers is taken from window. */
+  union
+  {
+    xa_nnlib_lstm_init_config_t lstm;
+    xa_nnlib_gru_init_config_t gru;
+  } layer[XA_NNLIB_RNN_MAX_LAYERS];
+} xa_nnlib_rnn_init_config_t;
+
+/* Structure for getting XA_NNLIB_RNN_LAYER_HANDLE parameter. Weights,
+ biases, quantization parameters and context of a layer are set with
+ xa_nnlib_lstm_set_config/xa_nnlib_gru_set_config on the returned handle. */
+typedef struct _xa_nnlib_rnn_layer_handle_t
+{
+  /* In: layer index, 0 is the one reading the input */
+  Int32 layer;
+  /* In: xa_nnlib_rnn_direction_t, XA_NNLIB_RNN_BACKWARD if bidirectional */
+  Int32 direction;
+  /* Out */
+  xa_nnlib_handle_t handle;
+} xa_nnlib_rnn_layer_handle_t;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif    /* __cplusplus */
+
+/************************************************************/
+/* RNN Query Functions                                      */
+/************************************************************/
+Int32 xa_nnlib_rnn_get_persistent_fast( xa_nnlib_rnn_init_config_t *config);
+
+/* One scratch region shared by all the layers */
+Int32 xa_nnlib_rnn_get_scratch_fast( xa_nnlib_rnn_init_config_t *config);
+
+/************************************************************/
+/* RNN Initialization Function                              */
+/************************************************************/
+Int32 xa_nnlib_rnn_init(xa_nnlib_handle_t handle, xa_nnlib_rnn_init_config_t *config);
+
+/************************************************************/
+/* RNN Execution Functions                                  */
+/************************************************************/
+Int32 xa_nnlib_rnn_set_config(xa_nnlib_handle_t handle, xa_nnlib_rnn_param_id_t param_id, void *params);
+
+Int32 xa_nnlib_rnn_get_config(xa_nnlib_handle_t handle, xa_nnlib_rnn_param_id_t param_id, void *params);
+
+/* Processes a window of p_in_shape->n_shapes (up to window) frames through
+   all the layers. Frames are p_in_shape->shape_offset (in_feats if -1)
+   elements apart in input and p_out_shape->shape_offset (output length if
+   -1) elements apart in output. The layers run one after the other over
+   the whole window, each writing its frames straight into the input
+   buffer of the next one (the output buffer for the last layer).
+
+   The forward cells keep their context from one call to the next. The
+   backward cells run from the last frame of the window to the first,
+   starting every window from a zero context, and write the second half
+   of each output frame (out_feats forward outputs, then out_feats
+   backward outputs). GRU cells get each of their outputs restored as the
+   context of the next frame. */
+Int32 xa_nnlib_rnn_process(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    xa_nnlib_shape_t *p_in_shape,
+    xa_nnlib_shape_t *p_out_shape);
+
+#if defined(__cplusplus)
+}
+#endif    /* __cplusplus */
+
+#endif  /* __XA_RNN_API_H__ */
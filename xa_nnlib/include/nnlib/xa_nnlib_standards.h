@@ -141,7 +141,7 @@ enum xa_error_class {
 
 #define XA_NNLIB_GENERIC    0
 
-#define XA_ERROR_CODE(severity, class, codec, index)    ((severity << 31) | (class << 12) | (codec << 7) | index)
+#define XA_ERROR_CODE(severity, class, codec, index)    ((int)((unsigned int)(severity) << 31) | (class << 12) | (codec << 7) | index)
 #define XA_ERROR_SEVERITY(code)    (((code) & XA_FATAL_ERROR) != 0)
 #define XA_ERROR_CLASS(code)    (((code) >> 12) & 0x0f)
 #define XA_ERROR_CODEC(code)    (((code) >>  7) & 0x1f)
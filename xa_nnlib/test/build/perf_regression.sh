@@ -0,0 +1,225 @@
+#!/bin/sh
+#
+# Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining
+# a copy of this software and associated documentation files (the
+# "Software"), to use this Software with Cadence processor cores only and
+# not with any other processors and platforms, subject to
+# the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+# CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+# TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# Performance regression gate.
+#
+# Runs the testbenches (each reads its paramfilesimple_*.txt), collects the
+# PROFILE_INFO lines and compares avg_cyc (ISS) or avg_ns (host) of every
+# kernel/precision/shape against a baseline. Exits with status 1 if any
+# entry is slower than the baseline by more than the tolerance or if a
+# testbench reports result=fail.
+#
+# One baseline per toolchain is kept in the tree as
+# perf_baseline_<binary_prefix>.txt. ISS cycle counts are deterministic,
+# so the Xtensa baselines hold exactly; the xgcc one holds host ns timings
+# and only catches large regressions. Kernel changes do not edit the
+# baseline: entries of new kernels are reported as NEW and do not fail.
+# It is re-recorded with -u (make perf_baseline) in a commit of its own.
+# On hosts where timings drift between sessions, -R compares against the
+# testbenches of a reference build run interleaved with the current ones,
+# so only the ratio between the two builds matters.
+#
+# Baseline lines:  suite | name | params | unit | avg
+# where name and params are copied from PROFILE_INFO. A repeated
+# name/params pair within a suite gets a "#<n>" suffix on its name.
+#
+# Run from test/build, after the testbenches are built:
+#   sh perf_regression.sh [-b baseline | -R ref_binary_prefix] [-t tolerance_%]
+#                         [-n runs] [-f floor] [-p binary_prefix] [-r runner]
+#                         [-u] [suite ...]
+#   -b baseline file, default perf_baseline_<binary_prefix>.txt.
+#   -R compares against ./<ref_binary_prefix>_nn_<suite>_test run in the
+#      same session rather than against a baseline file: build the
+#      testbenches of the base revision, copy xgcc_nn_conv_test to
+#      ref_nn_conv_test, rebuild with the change and run
+#      sh perf_regression.sh -R ref conv
+#   -f entries whose baseline is below this many cycles/ns are reported
+#      but never fail the gate (host timings of tiny calls are noise).
+#   -u records the baseline entries of the suites that were run.
+
+BASELINE=
+REF_PREFIX=
+TOLERANCE=10
+RUNS=3
+FLOOR=0
+PREFIX=xgcc
+RUNNER=
+UPDATE=0
+DEFAULT_SUITES="matXvec activation conv pool gru lstm rnn cnn basic norm model_tiny_conv"
+
+usage()
+{
+  echo "Usage: sh perf_regression.sh [-b baseline | -R ref_binary_prefix] [-t tolerance_%] [-n runs] [-f floor] [-p binary_prefix] [-r runner] [-u] [suite ...]"
+  echo "  suites default to: $DEFAULT_SUITES"
+}
+
+while getopts "b:R:t:n:f:p:r:uh" opt; do
+  case $opt in
+    b) BASELINE=$OPTARG ;;
+    R) REF_PREFIX=$OPTARG ;;
+    t) TOLERANCE=$OPTARG ;;
+    n) RUNS=$OPTARG ;;
+    f) FLOOR=$OPTARG ;;
+    p) PREFIX=$OPTARG ;;
+    r) RUNNER=$OPTARG ;;
+    u) UPDATE=1 ;;
+    h) usage; exit 0 ;;
+    *) usage; exit 2 ;;
+  esac
+done
+shift $((OPTIND - 1))
+SUITES=${*:-$DEFAULT_SUITES}
+BASELINE=${BASELINE:-perf_baseline_$PREFIX.txt}
+if [ -n "$REF_PREFIX" ] && [ "$UPDATE" -eq 1 ]; then
+  echo "perf_regression: -u records a baseline file, it does not apply to -R" >&2
+  exit 2
+fi
+
+TMPDIR_PERF=$(mktemp -d) || exit 2
+trap 'rm -rf "$TMPDIR_PERF"' EXIT
+RAW=$TMPDIR_PERF/raw.txt
+CURRENT=$TMPDIR_PERF/current.txt
+REF_RAW=$TMPDIR_PERF/ref_raw.txt
+: > "$RAW"
+: > "$REF_RAW"
+
+# Append "suite | name | params | unit | avg | result" of one run of a
+# testbench to a file: collect <suite> <binary> <file>
+collect()
+{
+  $RUNNER "$2" 2>/dev/null | awk -v suite="$1" '
+      /^PROFILE_INFO,/ {
+        line = $0
+        sub(/^PROFILE_INFO, */, "", line)
+        name = substr(line, 1, index(line, ",") - 1)
+        sub(/ +$/, "", name)
+        if(!match(line, /avg_[a-z]+=[0-9.]+/)) next
+        split(substr(line, RSTART + 4, RLENGTH - 4), av, "=")
+        result = "pass"
+        if(match(line, /result=[a-z]+/)) result = substr(line, RSTART + 7, RLENGTH - 7)
+        params = ""
+        if(index(line, "params: ")) params = substr(line, index(line, "params: ") + 8)
+        sub(/ +$/, "", params)
+        key = name " | " params
+        if(++seen[key] > 1) name = name "#" seen[key]
+        print suite " | " name " | " params " | " av[1] " | " av[2] " | " result
+      }' >> "$3"
+}
+
+for suite in $SUITES; do
+  for prefix in $PREFIX $REF_PREFIX; do
+    if [ ! -x "./${prefix}_nn_${suite}_test" ]; then
+      echo "perf_regression: ./${prefix}_nn_${suite}_test not found, build it with 'make nn_$suite'" >&2
+      exit 2
+    fi
+  done
+  # Interleaved with the reference so that both see the same host load
+  run=1
+  while [ "$run" -le "$RUNS" ]; do
+    collect "$suite" "./${PREFIX}_nn_${suite}_test" "$RAW"
+    [ -n "$REF_PREFIX" ] && collect "$suite" "./${REF_PREFIX}_nn_${suite}_test" "$REF_RAW"
+    run=$((run + 1))
+  done
+done
+
+# Fastest run per entry; any failing run marks the entry as failed:
+# reduce <raw> <out>
+reduce()
+{
+awk -F ' \\| ' '
+  {
+    key = $1 " | " $2 " | " $3
+    if(!(key in avg)) { order[++n] = key; avg[key] = $5; unit[key] = $4; result[key] = $6 }
+    if($5 + 0 < avg[key] + 0) avg[key] = $5
+    if($6 != "pass") result[key] = $6
+  }
+  END { for(i = 1; i <= n; i++) print order[i] " | " unit[order[i]] " | " avg[order[i]] " | " result[order[i]] }
+' "$1" > "$2"
+}
+
+reduce "$RAW" "$CURRENT"
+if [ -n "$REF_PREFIX" ]; then
+  # The reference runs stand in for the baseline file
+  BASELINE=$TMPDIR_PERF/ref.txt
+  reduce "$REF_RAW" "$BASELINE"
+fi
+
+if [ "$UPDATE" -eq 1 ]; then
+  NEW=$TMPDIR_PERF/baseline.txt
+  {
+    echo "# Performance baseline: suite | name | params | unit | avg"
+    echo "# Recorded with: sh perf_regression.sh -u -n $RUNS -p $PREFIX${RUNNER:+ -r \"$RUNNER\"} on $(uname -m)"
+    if [ -f "$BASELINE" ]; then
+      # keep the entries of suites that were not run
+      grep -v '^#' "$BASELINE" | awk -F ' \\| ' -v suites=" $SUITES " 'index(suites, " " $1 " ") == 0'
+    fi
+    awk -F ' \\| ' '{ print $1 " | " $2 " | " $3 " | " $4 " | " $5 }' "$CURRENT"
+  } > "$NEW"
+  mv "$NEW" "$BASELINE"
+  echo "perf_regression: wrote $(grep -vc '^#' "$BASELINE") entries to $BASELINE"
+  exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+  echo "perf_regression: baseline $BASELINE not found, create it with -u" >&2
+  exit 2
+fi
+
+awk -F ' \\| ' -v tol="$TOLERANCE" -v floor="$FLOOR" -v suites=" $SUITES " '
+  FNR == NR {
+    if($0 ~ /^#/ || NF < 5) next
+    key = $1 " | " $2 " | " $3
+    base[key] = $5; base_unit[key] = $4; base_order[++nb] = key
+    next
+  }
+  {
+    key = $1 " | " $2 " | " $3
+    checked[key] = 1
+    if($6 != "pass") { status = "FAIL"; fails++ }
+    else if(!(key in base)) { status = "NEW" }
+    else if(base_unit[key] != $4) { status = "UNIT"; fails++ }
+    else {
+      delta = (base[key] > 0) ? 100.0 * ($5 - base[key]) / base[key] : 0
+      if(base[key] < floor + 0) status = (delta > tol) ? "slower" : (delta < -tol) ? "faster" : "ok"
+      else if(delta > tol) { status = "SLOWER"; slower++ }
+      else if(delta < -tol) { status = "FASTER"; faster++ }
+      else status = "OK"
+    }
+    if(status == "NEW" || status == "FAIL" && !(key in base))
+      printf("%-7s %-9s %-40s %14s %14.2f %9s  %s\n", status, $1, $2, "-", $5, "", $3)
+    else
+      printf("%-7s %-9s %-40s %14.2f %14.2f %+8.1f%%  %s\n", status, $1, $2, base[key], $5,
+          (base[key] > 0) ? 100.0 * ($5 - base[key]) / base[key] : 0, $3)
+  }
+  END {
+    for(i = 1; i <= nb; i++) {
+      split(base_order[i], k, / \| /)
+      if(index(suites, " " k[1] " ") && !(base_order[i] in checked)) {
+        printf("MISSING %-9s %-40s %14.2f %14s %9s  %s\n", k[1], k[2], base[base_order[i]], "-", "", k[3])
+        missing++
+      }
+    }
+    printf("\nperf_regression: tolerance %s%%, floor %s, %d slower, %d faster, %d missing, %d failed\n",
+        tol, floor, slower, faster, missing, fails)
+    exit (slower > 0 || fails > 0) ? 1 : 0
+  }
+' "$BASELINE" "$CURRENT"
@@ -21,9 +21,6 @@
 ******************************************************************************/
 #ifndef __PROFILER_H__
 #define __PROFILER_H__
-#ifndef __XTENSA__
-#undef PROFILE
-#endif
 
 #if defined(HW_SIM) && (1 == HW_SIM)
 #undef PROFILE
@@ -35,16 +32,28 @@
 #include <stdio.h>
 #include <string.h>
 #include <sys/times.h>
-#include <xtensa/sim.h>
 #include <inttypes.h>
+#ifdef __XTENSA__
+#include <xtensa/sim.h>
+#else
+#include <time.h>
+#endif
 
 #define MAX_PROFILER_NAME_LENGTH 100
 #define MAX_PROFILER_PARAMS_LENGTH 200
 #define MAX_PROFILER_METRIC_UNITS_LENGTH 20
 
+#ifdef __XTENSA__
 #define CCOUNT_AVAILABLE
+#else
+/* Host build: wall-clock nanoseconds instead of core cycles, no ISS */
+#define HOST_CLOCK_AVAILABLE
+#endif
 
-#ifdef CCOUNT_AVAILABLE
+#if defined(CCOUNT_AVAILABLE)
+
+typedef uint32_t prof_count_t;
+#define PROF_COUNT_UNIT "cyc"
 
 static unsigned long inline GETCLOCK(void)
 {
@@ -59,13 +68,56 @@ static unsigned long inline GETCLOCK(void)
 #define _EXCLUDE_START(prof) (&gProfiler[prof])->exclude_start
 #define _EXCLUDE_STOP(prof)  (&gProfiler[prof])->exclude_stop
 
+#elif defined(HOST_CLOCK_AVAILABLE)
+
+typedef uint64_t prof_count_t;
+#define PROF_COUNT_UNIT "ns"
+
+static inline uint64_t GETCLOCK(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+#define xt_iss_profile_enable()
+#define xt_iss_profile_disable()
+#define xt_iss_client_command(a, b)
+#define xt_iss_switch_mode(mode)
+
+/* Testbenches pass "cyc/point", "MACs/cyc"...; report them per ns instead */
+static inline void xt_profiler_host_units(char *units)
+{
+  char rest[MAX_PROFILER_METRIC_UNITS_LENGTH];
+  char *p_cyc = strstr(units, "cyc");
+  if(p_cyc != NULL)
+  {
+    strcpy(rest, p_cyc + 3);
+    strcpy(p_cyc, "ns");
+    strcat(p_cyc, rest);
+  }
+}
+#define PROF_METRIC_UNITS(units) xt_profiler_host_units(units)
+
+#define get_clock(val) *val = GETCLOCK() 
+#define _START(prof) (&gProfiler[prof])->start
+#define _STOP(prof)  (&gProfiler[prof])->stop
+#define _EXCLUDE_START(prof) (&gProfiler[prof])->exclude_start
+#define _EXCLUDE_STOP(prof)  (&gProfiler[prof])->exclude_stop
+
 #else
+#define PROF_COUNT_UNIT "tick"
 #define get_clock(val) times(val) 
 #define _START(prof) (&gProfiler[prof])->start.tms_utime
 #define _STOP(prof)  (&gProfiler[prof])->stop.tms_utime
 #define _EXCLUDE_START(prof) (&gProfiler[prof])->exclude_start.tms_utime
 #define _EXCLUDE_STOP(prof)  (&gProfiler[prof])->exclude_stop.tms_utime
 #endif
+
+#ifndef PROF_METRIC_UNITS
+#define PROF_METRIC_UNITS(units)
+#endif
+
 #define XTPWR_PROFILER_OPEN(prof, _name, _params, _metric_points, _metric_units, _metric_inverted) {              \
   (&gProfiler[prof])->cycles = (&gProfiler[prof])->exclude_cycles = 0;                                            \
   (&gProfiler[prof])->frame_cnt = (&gProfiler[prof])->peak_frame = 0;                                             \
@@ -77,6 +129,7 @@ static unsigned long inline GETCLOCK(void)
   strcpy((&gProfiler[prof])->name , _name);                                                                       \
   strcpy((&gProfiler[prof])->params , _params);                                                                   \
   strcpy((&gProfiler[prof])->metric_units, (NULL != _metric_units) ? _metric_units : "");                         \
+  PROF_METRIC_UNITS((&gProfiler[prof])->metric_units);                                                            \
   (&gProfiler[prof])->metric_inverted = _metric_inverted;                                                         \
 }
 
@@ -114,7 +167,7 @@ static unsigned long inline GETCLOCK(void)
 
 
 #define XTPWR_PROFILER_PRINT( prof )                                                               \
-  printf( " frame %d : %10.2f cycles; Total cycles : %10.2f cycles; %6.2f %s\n",                                         \
+  printf( " frame %d : %10.2f " PROF_COUNT_UNIT "; Total : %10.2f " PROF_COUNT_UNIT "; %6.2f %s\n",                                         \
       (&gProfiler[prof])->frame_cnt-1, (&gProfiler[prof])->curr, (&gProfiler[prof])->sum, (&gProfiler[prof])->curr_metric, \
       (&gProfiler[prof])->metric_units); \
 
@@ -149,20 +202,20 @@ static unsigned long inline GETCLOCK(void)
   {                                                                                                                 \
     total_ave+= (&gProfiler[prof])->ave;                                                                            \
   }                                                                                                                 \
-    printf("PROFILE_INFO_NN_MODEL,  total average cycles per frame=%-10.2f\n",                                                       \
+    printf("PROFILE_INFO_NN_MODEL,  total average " PROF_COUNT_UNIT " per frame=%-10.2f\n",                                                       \
         total_ave);                                                                                                 \
 }
 
 #define XTPWR_PROFILER_CLOSE( prof, pass_flag) {                                                                                            \
   if((&gProfiler[prof])->metric_units[0] != '\0')                                                                                           \
   {                                                                                                                                         \
-    printf("PROFILE_INFO, %-25s, avg_cyc=%-10.2f, effective_metric=%-6.2f (%s), peak_cyc=%-10.2f, peak_frame=%-3d, result=%s, params: %s\n",\
+    printf("PROFILE_INFO, %-25s, avg_" PROF_COUNT_UNIT "=%-10.2f, effective_metric=%-6.2f (%s), peak_" PROF_COUNT_UNIT "=%-10.2f, peak_frame=%-3d, result=%s, params: %s\n",\
         (&gProfiler[prof])->name, (&gProfiler[prof])->ave, (&gProfiler[prof])->ave_metric, (&gProfiler[prof])->metric_units,                \
         (&gProfiler[prof])->peak, (&gProfiler[prof])->peak_frame, pass_flag ?"pass":"fail", (&gProfiler[prof])->params);                    \
   }                                                                                                                                         \
   else                                                                                                                                      \
   {                                                                                                                                         \
-    printf("PROFILE_INFO, %-25s, avg_cyc=%-10.2f, peak_cyc=%-10.2f, peak_frame=%-3d, result=%s, params: %s\n",                              \
+    printf("PROFILE_INFO, %-25s, avg_" PROF_COUNT_UNIT "=%-10.2f, peak_" PROF_COUNT_UNIT "=%-10.2f, peak_frame=%-3d, result=%s, params: %s\n",                              \
         (&gProfiler[prof])->name, (&gProfiler[prof])->ave,                                                                                  \
         (&gProfiler[prof])->peak, (&gProfiler[prof])->peak_frame, pass_flag ?"pass":"fail", (&gProfiler[prof])->params);                    \
   }                                                                                                                                         \
@@ -187,13 +240,13 @@ typedef struct _profiler_t
 {
   char name[MAX_PROFILER_NAME_LENGTH];
 
-#ifdef CCOUNT_AVAILABLE
-  uint32_t cycles;
-  uint32_t start;
-  uint32_t stop;
-  uint32_t exclude_cycles;
-  uint32_t exclude_start;
-  uint32_t exclude_stop;
+#if defined(CCOUNT_AVAILABLE) || defined(HOST_CLOCK_AVAILABLE)
+  prof_count_t cycles;
+  prof_count_t start;
+  prof_count_t stop;
+  prof_count_t exclude_cycles;
+  prof_count_t exclude_start;
+  prof_count_t exclude_stop;
 #else
   clock_t cycles;
   struct tms start;
@@ -216,17 +269,34 @@ typedef struct _profiler_t
 
 #else /* PROFILE */
 
+#define MAX_PROFILER_NAME_LENGTH 100
+#define MAX_PROFILER_PARAMS_LENGTH 200
+#define MAX_PROFILER_METRIC_UNITS_LENGTH 20
+
+#include <stdio.h>
+#include <string.h>
+
+/* No cycle counts without the ISS; only the test name and result are kept */
 typedef struct _profiler_t
 {
-  char dummy;
+  char name[MAX_PROFILER_NAME_LENGTH];
+  char params[MAX_PROFILER_PARAMS_LENGTH];
 } profiler_t;
 
-#define XTPWR_PROFILER_OPEN(prof, _name, _params, _metric_points, _metric_units, _metric_inverted)
+#define XTPWR_PROFILER_OPEN(prof, _name, _params, _metric_points, _metric_units, _metric_inverted) { \
+  strcpy((&gProfiler[prof])->name , _name);                                                         \
+  strcpy((&gProfiler[prof])->params , _params);                                                     \
+}
 #define XTPWR_PROFILER_START( prof )
 #define XTPWR_PROFILER_STOP( prof )
+#define XTPWR_BASIC_PROFILER_START( prof )
+#define XTPWR_BASIC_PROFILER_STOP( prof )
 #define XTPWR_PROFILER_UPDATE( prof )
 #define XTPWR_PROFILER_AVE_TOTAL( no_of_prof )
-#define XTPWR_PROFILER_CLOSE( prof , pass_flag) 
+#define XTPWR_PROFILER_CLOSE( prof , pass_flag) {                                       \
+  printf("PROFILE_INFO, %-25s, result=%s, params: %s\n",                                   \
+      (&gProfiler[prof])->name, pass_flag ?"pass":"fail", (&gProfiler[prof])->params);    \
+}
 #define XTPWR_PROFILER_PRINT( prof ) 
 
 #define XTPWR_PROFILER_EXCLUDE_ON( prof )
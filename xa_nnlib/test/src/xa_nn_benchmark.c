@@ -0,0 +1,2258 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Kernel benchmark: sweeps the kernels of xa_nnlib_kernels_api.h over a grid
+ * of shapes and reports time per call, MAC throughput and memory traffic.
+ * Results can be written as CSV and/or JSON for tracking over time.
+ * For activation, elementwise and pooling kernels the MAC count is the
+ * number of elements (window positions for pooling) processed.
+ * MAC/cycle divides by core cycles with -perf, by ccount or TSC ticks
+ * otherwise. Kernels that are variants of another one (blocked, packed,
+ * sparse, ...) also report their speedup over it on the same shape.
+ * Shapes a kernel does not take (Winograd on strided shapes) are reported
+ * as unsupported rather than failed.
+ * Kernels declared in the API header without an implementation in the
+ * library (xa_nn_matmul_16x16_16, _8x16_16, _f32xf32_f32 and
+ * xa_nn_dot_prod_f32xf32_f32) are not listed.
+ *
+ * Usage: xa_nn_benchmark [-kernel <substr>] [-family <name>] [-min_time_ms N]
+ *                        [-reps N] [-quick] [-perf] [-workers N] [-list]
+ *                        [-csv <file>] [-json <file>]
+ */
+#if !defined(__XTENSA__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "xa_type_def.h"
+#include "nnlib/xa_nnlib_api.h"
+#include "xa_nnlib_standards.h"
+#include "cmdline_parser.h"
+#include "xt_workers.h"
+
+#if defined(__linux__) && !defined(__XTENSA__)
+#define BENCH_PERF_EVENTS
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#define XA_MAX_CMD_LINE_LENGTH 1024
+#define MAX_FAMILY_NAME_LENGTH 20
+#define MAX_SHAPE_STRING_LENGTH 100
+
+#define BENCH_ALIGNMENT 64
+#define BENCH_MAX_REPS 31
+#define BENCH_MAX_ITERS (1 << 20)
+
+/* Fixed-point parameters: valid for every kernel, values do not affect timing */
+#define BENCH_ACC_SHIFT (-8)
+#define BENCH_BIAS_SHIFT 0
+#define BENCH_OUT_MULTIPLIER 0x40000000
+#define BENCH_OUT_SHIFT (-8)
+#define BENCH_ZERO_BIAS_U8 (-128)
+#define BENCH_ZERO_BIAS_S8 (-5)
+#define BENCH_BATCH_COUNT 4             /* products per call of the batch_ kernels */
+#define BENCH_DILATION 2                /* dilated_ kernels on unit stride shapes */
+#define BENCH_GROUPS 2                  /* grouped_ kernels, keeps ic / groups unpadded */
+
+typedef enum _bench_family_t
+{
+  FAMILY_MATXVEC = 0,   /* rows x cols matrix times one vector */
+  FAMILY_MATMUL,        /* rows x cols matrix times vecs vectors */
+  FAMILY_ACT,           /* activations over n elements */
+  FAMILY_ELM,           /* elementwise ops over n elements */
+  FAMILY_DOT,           /* rows dot products of length cols */
+  FAMILY_CONV1D,
+  FAMILY_CONV2D,
+  FAMILY_DEPTHWISE,
+  FAMILY_POINTWISE,
+  FAMILY_POOL,
+  FAMILY_COUNT
+} bench_family_t;
+
+static const char *family_names[FAMILY_COUNT] =
+{
+  "matXvec", "matmul", "activation", "elementwise", "dot_prod",
+  "conv1d", "conv2d", "depthwise", "pointwise", "pool"
+};
+
+typedef struct _bench_shape_t
+{
+  int rows, cols, vecs;                 /* matXvec, matmul, dot_prod */
+  int n;                                /* activation, elementwise */
+  int ih, iw, ic, kh, kw, oc, cm;       /* conv, pool */
+  int stride, pad;
+  int oh, ow;                           /* derived */
+  int dil;                              /* derived, dilated_ kernels */
+  int quick;                            /* part of the -quick grid */
+} bench_shape_t;
+
+typedef struct _bench_bufs_t
+{
+  void *p_out;
+  void *p_inp;
+  void *p_wt;                           /* weights, or the second operand */
+  void *p_bias;                         /* bias, or the third operand */
+  void *p_scratch;
+  void *p_prep;                         /* weights or bias prepared before timing */
+  void **pp_out;                        /* matXvec_batch */
+  void **pp_inp;
+  WORD32 *p_out_multiplier;             /* per channel quantization */
+  WORD32 *p_out_shift;
+} bench_bufs_t;
+
+typedef WORD32 (*bench_run_fn_t)(bench_bufs_t *b, const bench_shape_t *s);
+
+typedef struct _bench_kernel_t
+{
+  const char *name;
+  bench_family_t family;
+  int inp_bytes;                        /* element sizes, 0 if unused */
+  int wt_bytes;
+  int bias_bytes;
+  int out_bytes;
+  int precision;                        /* scratch sizing, PREC_* */
+  bench_run_fn_t run;
+  const char *ref;                      /* kernel the speedup is reported against, or NULL */
+} bench_kernel_t;
+
+typedef struct _bench_result_t
+{
+  const char *status;
+  long iters;
+  int reps;
+  double ns_per_call;
+  double ticks_per_call;
+  double macs;
+  double bytes;
+  double gmacs_per_s;
+  double gbytes_per_s;
+  double macs_per_cycle;
+  double speedup;                       /* ref ns/call over ns/call, 0 if not measured */
+  int perf_valid;
+  double cycles_per_call;
+  double instructions_per_call;
+  double cache_misses_per_call;
+} bench_result_t;
+
+typedef struct _bench_config_t
+{
+  int help;
+  int list;
+  int quick;
+  int perf;
+  int min_time_ms;
+  int reps;
+  char kernel_filter[XA_MAX_CMD_LINE_LENGTH];
+  char family_filter[MAX_FAMILY_NAME_LENGTH];
+  char csv_file_name[XA_MAX_CMD_LINE_LENGTH];
+  char json_file_name[XA_MAX_CMD_LINE_LENGTH];
+  int workers;
+} bench_config_t;
+
+/*----------------------------------------------------------------------------*
+ * Shape grids
+ *----------------------------------------------------------------------------*/
+static bench_shape_t shapes_matXvec[] =
+{
+  {   64,   64,   1 }, {  256,  256,   1, .quick = 1 }, { 1024,  256,   1 },
+  {  256, 1024,   1 }, { 1024, 1024,   1 },
+};
+
+static bench_shape_t shapes_matmul[] =
+{
+  {   64,   64,   8 }, {  256,  256,   8, .quick = 1 }, {  256,  256,  32 },
+  { 1024,  256,  16 }, {  256, 2048,  64 },
+};
+
+static bench_shape_t shapes_elementwise[] =
+{
+  { .n = 256 }, { .n = 4096, .quick = 1 }, { .n = 65536 },
+};
+
+static bench_shape_t shapes_dot[] =
+{
+  {   16,   64 }, {  256,  256, .quick = 1 }, { 1024,  512 },
+};
+
+static bench_shape_t shapes_conv1d[] =
+{
+  { .ih = 32, .iw =  8, .ic = 16, .kh = 3, .oc = 32, .stride = 1, .quick = 1 },
+  { .ih = 64, .iw = 16, .ic = 32, .kh = 5, .oc = 64, .stride = 1 },
+};
+
+static bench_shape_t shapes_conv2d[] =
+{
+  { .ih = 16, .iw = 16, .ic = 16, .kh = 3, .kw = 3, .oc = 32, .stride = 1, .pad = 1, .quick = 1 },
+  { .ih = 32, .iw = 32, .ic = 32, .kh = 3, .kw = 3, .oc = 64, .stride = 1, .pad = 1 },
+  { .ih = 28, .iw = 28, .ic = 64, .kh = 3, .kw = 3, .oc = 64, .stride = 2, .pad = 1 },
+};
+
+static bench_shape_t shapes_depthwise[] =
+{
+  { .ih = 32, .iw = 32, .ic = 32, .kh = 3, .kw = 3, .cm = 1, .stride = 1, .pad = 1, .quick = 1 },
+  { .ih = 64, .iw = 64, .ic = 16, .kh = 5, .kw = 5, .cm = 2, .stride = 2, .pad = 2 },
+};
+
+static bench_shape_t shapes_pointwise[] =
+{
+  { .ih = 16, .iw = 16, .ic = 64, .oc = 64, .quick = 1 },
+  { .ih = 32, .iw = 32, .ic = 32, .oc = 128 },
+};
+
+static bench_shape_t shapes_pool[] =
+{
+  { .ih = 64, .iw = 64, .ic = 16, .kh = 3, .kw = 3, .stride = 2, .pad = 1, .quick = 1 },
+  { .ih = 32, .iw = 32, .ic = 64, .kh = 2, .kw = 2, .stride = 2 },
+};
+
+static bench_shape_t *family_shapes[FAMILY_COUNT] =
+{
+  shapes_matXvec, shapes_matmul, shapes_elementwise, shapes_elementwise, shapes_dot,
+  shapes_conv1d, shapes_conv2d, shapes_depthwise, shapes_pointwise, shapes_pool
+};
+
+static int family_num_shapes[FAMILY_COUNT] =
+{
+  sizeof(shapes_matXvec)/sizeof(bench_shape_t),
+  sizeof(shapes_matmul)/sizeof(bench_shape_t),
+  sizeof(shapes_elementwise)/sizeof(bench_shape_t),
+  sizeof(shapes_elementwise)/sizeof(bench_shape_t),
+  sizeof(shapes_dot)/sizeof(bench_shape_t),
+  sizeof(shapes_conv1d)/sizeof(bench_shape_t),
+  sizeof(shapes_conv2d)/sizeof(bench_shape_t),
+  sizeof(shapes_depthwise)/sizeof(bench_shape_t),
+  sizeof(shapes_pointwise)/sizeof(bench_shape_t),
+  sizeof(shapes_pool)/sizeof(bench_shape_t),
+};
+
+/*----------------------------------------------------------------------------*
+ * Kernel wrappers
+ *----------------------------------------------------------------------------*/
+#define BENCH_MATXVEC(NAME, MT, VT, BT, OT) \
+static WORD32 b_matXvec_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matXvec_##NAME((OT *)b->p_out, (MT *)b->p_wt, NULL, (VT *)b->p_inp, NULL, (BT *)b->p_bias, \
+      s->rows, s->cols, 0, s->cols, 0, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT); \
+}
+
+#define BENCH_MATXVEC_ACT(NAME, MT, VT, BPREC) \
+static WORD32 b_matXvec_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matXvec_##NAME(b->p_out, (MT *)b->p_wt, NULL, (VT *)b->p_inp, NULL, b->p_bias, \
+      s->rows, s->cols, 0, s->cols, 0, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, BPREC, b->p_scratch); \
+}
+
+#define BENCH_MATXVEC_BATCH(NAME, MT, VT, BT, OT) \
+static WORD32 b_matXvec_batch_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matXvec_batch_##NAME((OT **)b->pp_out, (MT *)b->p_wt, (VT **)b->pp_inp, (BT *)b->p_bias, \
+      s->rows, s->cols, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs); \
+}
+
+#define BENCH_MATMUL(NAME, MT, VT, BT, OT) \
+static WORD32 b_matmul_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matmul_##NAME((OT *)b->p_out, (const MT *)b->p_wt, (const VT *)b->p_inp, (const BT *)b->p_bias, \
+      s->rows, s->cols, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs, s->cols, s->rows, 1); \
+}
+
+#define BENCH_FC(NAME, WT, IT, BT) \
+static WORD32 b_fully_connected_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_fully_connected_##NAME((IT *)b->p_out, (WT *)b->p_wt, (IT *)b->p_inp, (BT *)b->p_bias, \
+      s->cols, s->rows, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT); \
+}
+
+#define BENCH_VEC(NAME, IT, OT) \
+static WORD32 b_vec_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_vec_##NAME((OT *)b->p_out, (const IT *)b->p_inp, s->n); \
+}
+
+#define BENCH_VEC_THRESHOLD(NAME, IT, OT, THRESHOLD) \
+static WORD32 b_vec_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_vec_##NAME((OT *)b->p_out, (const IT *)b->p_inp, THRESHOLD, s->n); \
+}
+
+#define BENCH_ELM_F32(NAME) \
+static WORD32 b_elm_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_elm_##NAME((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, (const FLOAT32 *)b->p_wt, s->n); \
+}
+
+#define BENCH_CONV1D(NAME, IT, KT, BT, OT) \
+static WORD32 b_conv1d_std_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_conv1d_std_##NAME((OT *)b->p_out, (IT *)b->p_inp, (KT *)b->p_wt, (BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->oh, BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 1, b->p_scratch); \
+}
+
+#define BENCH_CONV2D(NAME, IT, KT, BT, OT) \
+static WORD32 b_conv2d_std_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_conv2d_std_##NAME((OT *)b->p_out, (IT *)b->p_inp, (KT *)b->p_wt, (BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, \
+      BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 0, b->p_scratch); \
+}
+
+#define BENCH_DEPTHWISE(NAME, IT, KT, BT, OT) \
+static WORD32 b_conv2d_depthwise_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_conv2d_depthwise_##NAME((OT *)b->p_out, (const KT *)b->p_wt, (const IT *)b->p_inp, (const BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->kh, s->kw, s->cm, s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, \
+      BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, 0, 0, b->p_scratch); \
+}
+
+#define BENCH_POINTWISE(NAME, IT, KT, BT, OT, OUT_FORMAT) \
+static WORD32 b_conv2d_pointwise_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_conv2d_pointwise_##NAME((OT *)b->p_out, (KT *)b->p_wt, (IT *)b->p_inp, (BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->oc, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, OUT_FORMAT); \
+}
+
+#define BENCH_POOL(NAME, T) \
+static WORD32 b_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_##NAME((T *)b->p_out, (T *)b->p_inp, s->ih, s->iw, s->ic, s->kh, s->kw, \
+      s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, 0, 0, b->p_scratch); \
+}
+
+BENCH_MATXVEC(16x16_16, WORD16, WORD16, WORD16, WORD16)
+BENCH_MATXVEC(16x16_32, WORD16, WORD16, WORD16, WORD32)
+BENCH_MATXVEC(16x16_64, WORD16, WORD16, WORD16, WORD64)
+BENCH_MATXVEC(8x16_16, WORD8, WORD16, WORD16, WORD16)
+BENCH_MATXVEC(8x16_32, WORD8, WORD16, WORD16, WORD32)
+BENCH_MATXVEC(8x16_64, WORD8, WORD16, WORD16, WORD64)
+BENCH_MATXVEC(8x8_8, WORD8, WORD8, WORD8, WORD8)
+BENCH_MATXVEC(8x8_16, WORD8, WORD8, WORD8, WORD16)
+BENCH_MATXVEC(8x8_32, WORD8, WORD8, WORD8, WORD32)
+BENCH_MATXVEC_ACT(16x16_16_tanh, WORD16, WORD16, 16)
+BENCH_MATXVEC_ACT(16x16_16_sigmoid, WORD16, WORD16, 16)
+BENCH_MATXVEC_ACT(8x16_16_tanh, WORD8, WORD16, 16)
+BENCH_MATXVEC_ACT(8x16_16_sigmoid, WORD8, WORD16, 16)
+BENCH_MATXVEC_ACT(8x8_8_tanh, WORD8, WORD8, 8)
+BENCH_MATXVEC_ACT(8x8_8_sigmoid, WORD8, WORD8, 8)
+
+static WORD32 b_matXvec_f32xf32_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_f32xf32_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_wt, NULL, (const FLOAT32 *)b->p_inp,
+      NULL, (const FLOAT32 *)b->p_bias, s->rows, s->cols, 0, s->cols, 0);
+}
+
+static WORD32 b_matXvec_f32xf32_f32_tanh(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_f32xf32_f32_tanh((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_wt, NULL, (FLOAT32 *)b->p_inp,
+      NULL, (FLOAT32 *)b->p_bias, s->rows, s->cols, 0, s->cols, 0, (FLOAT32 *)b->p_scratch);
+}
+
+static WORD32 b_matXvec_f32xf32_f32_sigmoid(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_f32xf32_f32_sigmoid((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_wt, NULL, (FLOAT32 *)b->p_inp,
+      NULL, (FLOAT32 *)b->p_bias, s->rows, s->cols, 0, s->cols, 0, (FLOAT32 *)b->p_scratch);
+}
+
+static WORD32 b_matXvec_asym8uxasym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_asym8uxasym8u_asym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_wt, NULL,
+      (const UWORD8 *)b->p_inp, NULL, (const WORD32 *)b->p_bias, s->rows, s->cols, 0, s->cols, 0,
+      BENCH_ZERO_BIAS_U8, 0, BENCH_ZERO_BIAS_U8, 0, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+static WORD32 b_matXvec_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_sym8sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt, NULL,
+      (const WORD8 *)b->p_inp, NULL, (const WORD32 *)b->p_bias, s->rows, s->cols, 0, s->cols, 0,
+      BENCH_ZERO_BIAS_S8, 0, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3);
+}
+
+static WORD32 b_matXvec_out_stride_sym8sxasym8s_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_out_stride_sym8sxasym8s_16((WORD16 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, 1,
+      BENCH_ZERO_BIAS_S8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT);
+}
+
+BENCH_FC(16x16_16, WORD16, WORD16, WORD16)
+BENCH_FC(8x16_16, WORD8, WORD16, WORD16)
+BENCH_FC(8x8_8, WORD8, WORD8, WORD8)
+
+static WORD32 b_fully_connected_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_fully_connected_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_wt, (const FLOAT32 *)b->p_inp,
+      (const FLOAT32 *)b->p_bias, s->cols, s->rows);
+}
+
+static WORD32 b_fully_connected_asym8uxasym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_fully_connected_asym8uxasym8u_asym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_wt,
+      (const UWORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->cols, s->rows,
+      BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+static WORD32 b_fully_connected_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_fully_connected_sym8sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->cols, s->rows,
+      BENCH_ZERO_BIAS_S8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3);
+}
+
+/* Random weight bytes are valid sym4s nibble pairs; only the first half of
+   the weight buffer is read */
+static WORD32 b_matXvec_sym4sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_sym4sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt, NULL,
+      (const WORD8 *)b->p_inp, NULL, (const WORD32 *)b->p_bias, s->rows, s->cols, 0, (s->cols + 1) & ~1, 0,
+      BENCH_ZERO_BIAS_S8, 0, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3);
+}
+
+static WORD32 b_fully_connected_per_chan_sym4sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_fully_connected_per_chan_sym4sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->cols, s->rows,
+      BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3);
+}
+
+BENCH_MATXVEC_BATCH(16x16_64, WORD16, WORD16, WORD16, WORD64)
+BENCH_MATXVEC_BATCH(8x16_64, WORD8, WORD16, WORD16, WORD64)
+BENCH_MATXVEC_BATCH(8x8_32, WORD8, WORD8, WORD8, WORD32)
+
+static WORD32 b_matXvec_batch_f32xf32_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_batch_f32xf32_f32((FLOAT32 **)b->pp_out, (FLOAT32 *)b->p_wt, (FLOAT32 **)b->pp_inp,
+      (FLOAT32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs);
+}
+
+static WORD32 b_matXvec_batch_asym8uxasym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_batch_asym8uxasym8u_asym8u((UWORD8 **)b->pp_out, (UWORD8 *)b->p_wt,
+      (UWORD8 **)b->pp_inp, (WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs,
+      BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+BENCH_MATMUL(8x8_8, WORD8, WORD8, WORD8, WORD8)
+
+static WORD32 b_matmul_asym8uxasym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_asym8uxasym8u_asym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_wt,
+      (const UWORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+static WORD32 b_matmul_per_chan_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3);
+}
+
+static WORD32 b_matmul_per_chan_sym4sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_per_chan_sym4sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, (s->cols + 1) & ~1, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3);
+}
+
+/* Weights are packed once in bench_prepare_weights, outside the timed calls */
+static WORD32 b_matXvec_8x8_8_packed(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_8x8_8_packed((WORD8 *)b->p_out, (const WORD8 *)b->p_prep, (const WORD8 *)b->p_inp,
+      (const WORD8 *)b->p_bias, s->rows, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT);
+}
+
+static WORD32 b_matXvec_sym8sxasym8s_asym8s_packed(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_sym8sxasym8s_asym8s_packed((WORD8 *)b->p_out, (const WORD8 *)b->p_prep,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols,
+      BENCH_ZERO_BIAS_S8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3);
+}
+
+static WORD32 b_matmul_asym8uxasym8u_asym8u_packed(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_asym8uxasym8u_asym8u_packed((UWORD8 *)b->p_out, (const UWORD8 *)b->p_prep,
+      (const UWORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+/* The bias is folded once in bench_prepare_weights */
+static WORD32 b_matXvec_asym8uxasym8u_asym8u_folded(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_asym8uxasym8u_asym8u_folded((UWORD8 *)b->p_out, (const UWORD8 *)b->p_wt,
+      (const UWORD8 *)b->p_inp, (const WORD32 *)b->p_prep, s->rows, s->cols, s->cols,
+      BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+static WORD32 b_matmul_asym8uxasym8u_asym8u_folded(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_asym8uxasym8u_asym8u_folded((UWORD8 *)b->p_out, (const UWORD8 *)b->p_wt,
+      (const UWORD8 *)b->p_inp, (const WORD32 *)b->p_prep, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128);
+}
+
+/* Weights are pruned and compressed once in bench_prepare_weights; the
+   block formats keep a quarter of the blocks and use a bitmask index */
+#define BENCH_SPARSE(FORMAT) \
+static WORD32 b_matXvec_sym8sxasym8s_asym8s_sparse_##FORMAT(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matXvec_sym8sxasym8s_asym8s_sparse((WORD8 *)b->p_out, b->p_prep, (const WORD8 *)b->p_inp, \
+      (const WORD32 *)b->p_bias, s->rows, s->cols, BENCH_ZERO_BIAS_S8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3); \
+} \
+static WORD32 b_fully_connected_sym8sxasym8s_asym8s_sparse_##FORMAT(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_fully_connected_sym8sxasym8s_asym8s_sparse((WORD8 *)b->p_out, b->p_prep, (const WORD8 *)b->p_inp, \
+      (const WORD32 *)b->p_bias, s->cols, s->rows, BENCH_ZERO_BIAS_S8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3); \
+}
+
+BENCH_SPARSE(2_4)
+BENCH_SPARSE(1x4)
+BENCH_SPARSE(4x4)
+
+/* 16x8 quantization: int16 activations with zero bias 0, int64 bias */
+static WORD32 b_matmul_per_chan_sym8sxasym16s_asym16s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_per_chan_sym8sxasym16s_asym16s((WORD16 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD16 *)b->p_inp, (const WORD64 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, 0, b->p_out_multiplier, b->p_out_shift, 0);
+}
+
+static WORD32 b_fully_connected_per_chan_sym8sxasym16s_asym16s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_fully_connected_per_chan_sym8sxasym16s_asym16s((WORD16 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD16 *)b->p_inp, (const WORD64 *)b->p_bias, s->cols, s->rows, 0, b->p_out_multiplier,
+      b->p_out_shift, 0);
+}
+
+/* Transposed weights are cols x rows; random data needs no actual transpose */
+#define BENCH_MATXVEC_T(NAME, MT, VT, BT, OT) \
+static WORD32 b_matXvec_t_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matXvec_t_##NAME((OT *)b->p_out, (const MT *)b->p_wt, (const VT *)b->p_inp, (const BT *)b->p_bias, \
+      s->rows, s->cols, s->rows, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT); \
+}
+
+#define BENCH_MATMUL_TN_NT(NAME, MT, VT, BT, OT) \
+static WORD32 b_matmul_tn_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matmul_tn_##NAME((OT *)b->p_out, (const MT *)b->p_wt, (const VT *)b->p_inp, (const BT *)b->p_bias, \
+      s->rows, s->cols, s->rows, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs, s->cols, s->rows, 1); \
+} \
+static WORD32 b_matmul_nt_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matmul_nt_##NAME((OT *)b->p_out, (const MT *)b->p_wt, (const VT *)b->p_inp, (const BT *)b->p_bias, \
+      s->rows, s->cols, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs, s->cols, s->rows, 1); \
+}
+
+BENCH_MATXVEC_T(16x16_16, WORD16, WORD16, WORD16, WORD16)
+BENCH_MATXVEC_T(8x16_16, WORD8, WORD16, WORD16, WORD16)
+BENCH_MATMUL_TN_NT(16x16_16, WORD16, WORD16, WORD16, WORD16)
+BENCH_MATMUL_TN_NT(8x16_16, WORD8, WORD16, WORD16, WORD16)
+
+static WORD32 b_matXvec_t_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matXvec_t_sym8sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->rows, BENCH_ZERO_BIAS_S8,
+      BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3);
+}
+
+static WORD32 b_matmul_tn_per_chan_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_matmul_tn_per_chan_sym8sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->rows, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3);
+}
+
+/* batch_ kernels run BENCH_BATCH_COUNT products sharing bias and
+   quantization; the batch_loop_ references call the single kernel as many
+   times */
+static void bench_batch(xa_nnlib_batch_desc_t *p_batch, const bench_shape_t *s)
+{
+  p_batch->batch_count = BENCH_BATCH_COUNT;
+  p_batch->mat1_batch_stride = s->rows * s->cols;
+  p_batch->vec1_batch_stride = s->cols * s->vecs;
+  p_batch->out_batch_stride = s->rows * s->vecs;
+  p_batch->chan_batch_stride = 0;
+}
+
+static WORD32 b_batch_matmul_per_chan_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  xa_nnlib_batch_desc_t batch;
+  bench_batch(&batch, s);
+  return xa_nn_batch_matmul_per_chan_sym8sxasym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, &batch);
+}
+
+static WORD32 b_batch_loop_matmul_per_chan_sym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  WORD32 err = 0;
+  int i;
+  for(i = 0; i < BENCH_BATCH_COUNT; i++)
+    err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s((WORD8 *)b->p_out + i * s->rows * s->vecs,
+        (const WORD8 *)b->p_wt + i * s->rows * s->cols, (const WORD8 *)b->p_inp + i * s->cols * s->vecs,
+        (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols, s->rows, 1,
+        BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3);
+  return err;
+}
+
+static WORD32 b_batch_matmul_16x16_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  xa_nnlib_batch_desc_t batch;
+  bench_batch(&batch, s);
+  return xa_nn_batch_matmul_16x16_16((WORD16 *)b->p_out, (const WORD16 *)b->p_wt, (const WORD16 *)b->p_inp,
+      (const WORD16 *)b->p_bias, s->rows, s->cols, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs, s->cols,
+      s->rows, 1, &batch);
+}
+
+static WORD32 b_batch_loop_matmul_16x16_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  WORD32 err = 0;
+  int i;
+  for(i = 0; i < BENCH_BATCH_COUNT; i++)
+    err |= xa_nn_matmul_nt_16x16_16((WORD16 *)b->p_out + i * s->rows * s->vecs,
+        (const WORD16 *)b->p_wt + i * s->rows * s->cols, (const WORD16 *)b->p_inp + i * s->cols * s->vecs,
+        (const WORD16 *)b->p_bias, s->rows, s->cols, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs,
+        s->cols, s->rows, 1);
+  return err;
+}
+
+/* Clamp to a relu6-like range followed by a residual add; the residual is
+   set up in bench_prepare_weights */
+static void bench_epilogue(xa_nnlib_epilogue_t *p_epilogue, const bench_bufs_t *b)
+{
+  memset(p_epilogue, 0, sizeof(*p_epilogue));
+  p_epilogue->act_type = XA_NNLIB_ACT_CLAMP;
+  p_epilogue->act_min = 3;
+  p_epilogue->act_max = 3 + 96;
+  p_epilogue->p_residual = (const WORD8 *)b->p_prep;
+  p_epilogue->left_shift = 20;
+  p_epilogue->inp1_left_shift = -1;
+  p_epilogue->inp1_multiplier = 1518500250;
+  p_epilogue->res_zero_bias = 3;
+  p_epilogue->res_left_shift = -2;
+  p_epilogue->res_multiplier = 1431655765;
+  p_epilogue->add_out_zero_bias = -5;
+  p_epilogue->add_out_left_shift = -18;
+  p_epilogue->add_out_multiplier = 1288490189;
+  p_epilogue->add_act_min = -128;
+  p_epilogue->add_act_max = 127;
+}
+
+static WORD32 b_matXvec_sym8sxasym8s_asym8s_epilogue(bench_bufs_t *b, const bench_shape_t *s)
+{
+  xa_nnlib_epilogue_t epilogue;
+  bench_epilogue(&epilogue, b);
+  return xa_nn_matXvec_sym8sxasym8s_asym8s_epilogue((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, BENCH_ZERO_BIAS_S8,
+      BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3, &epilogue);
+}
+
+static WORD32 b_matmul_per_chan_sym8sxasym8s_asym8s_epilogue(bench_bufs_t *b, const bench_shape_t *s)
+{
+  xa_nnlib_epilogue_t epilogue;
+  bench_epilogue(&epilogue, b);
+  return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_epilogue((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, &epilogue);
+}
+
+/* Workers of the parallel kernels, set up from -workers in main */
+static xa_nnlib_workers_t bench_workers;
+
+#define BENCH_PARALLEL(SPLIT_NAME, SPLIT) \
+static WORD32 b_matXvec_sym8sxasym8s_asym8s_parallel_##SPLIT_NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matXvec_sym8sxasym8s_asym8s_parallel((WORD8 *)b->p_out, (const WORD8 *)b->p_wt, \
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, BENCH_ZERO_BIAS_S8, \
+      BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3, SPLIT, &bench_workers, b->p_scratch); \
+} \
+static WORD32 b_matmul_per_chan_sym8sxasym8s_asym8s_parallel_##SPLIT_NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_parallel((WORD8 *)b->p_out, (const WORD8 *)b->p_wt, \
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols, \
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, SPLIT, &bench_workers, \
+      b->p_scratch); \
+}
+
+BENCH_PARALLEL(rows, XA_NNLIB_SPLIT_ROWS)
+BENCH_PARALLEL(k, XA_NNLIB_SPLIT_K)
+
+/* Blocks from the default cache descriptor, as a caller without a
+   platform specific one would get */
+static WORD32 b_matmul_8x8_8_blocked(bench_bufs_t *b, const bench_shape_t *s)
+{
+  xa_nnlib_gemm_blocking_t blocking;
+  xa_nn_matmul_get_blocking(&blocking, NULL, s->rows, s->cols, s->vecs);
+  return xa_nn_matmul_8x8_8_blocked((WORD8 *)b->p_out, (const WORD8 *)b->p_wt, (const WORD8 *)b->p_inp,
+      (const WORD8 *)b->p_bias, s->rows, s->cols, s->cols, BENCH_ACC_SHIFT, BENCH_BIAS_SHIFT, s->vecs, s->cols,
+      s->rows, 1, &blocking, b->p_scratch);
+}
+
+static WORD32 b_matmul_per_chan_sym8sxasym8s_asym8s_blocked(bench_bufs_t *b, const bench_shape_t *s)
+{
+  xa_nnlib_gemm_blocking_t blocking;
+  xa_nn_matmul_get_blocking(&blocking, NULL, s->rows, s->cols, s->vecs);
+  return xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, s->vecs, s->cols,
+      s->rows, 1, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, &blocking, b->p_scratch);
+}
+
+BENCH_VEC(sigmoid_32_32, WORD32, WORD32)
+BENCH_VEC(tanh_32_32, WORD32, WORD32)
+BENCH_VEC(relu_std_32_32, WORD32, WORD32)
+BENCH_VEC_THRESHOLD(relu_32_32, WORD32, WORD32, 1 << 26)
+BENCH_VEC(relu1_32_32, WORD32, WORD32)
+BENCH_VEC(relu6_32_32, WORD32, WORD32)
+BENCH_VEC(softmax_32_32, WORD32, WORD32)
+BENCH_VEC(sigmoid_32_16, WORD32, WORD16)
+BENCH_VEC(tanh_32_16, WORD32, WORD16)
+BENCH_VEC(sigmoid_32_8, WORD32, WORD8)
+BENCH_VEC(tanh_32_8, WORD32, WORD8)
+BENCH_VEC_THRESHOLD(relu_16_16, WORD16, WORD16, 1 << 12)
+BENCH_VEC(relu_std_16_16, WORD16, WORD16)
+BENCH_VEC_THRESHOLD(relu_8_8, WORD8, WORD8, 64)
+BENCH_VEC(relu_std_8_8, WORD8, WORD8)
+BENCH_VEC(sigmoid_f32_f32, FLOAT32, FLOAT32)
+BENCH_VEC(tanh_f32_f32, FLOAT32, FLOAT32)
+BENCH_VEC_THRESHOLD(relu_f32_f32, FLOAT32, FLOAT32, 0.5f)
+BENCH_VEC(relu_std_f32_f32, FLOAT32, FLOAT32)
+BENCH_VEC(relu1_f32_f32, FLOAT32, FLOAT32)
+BENCH_VEC(relu6_f32_f32, FLOAT32, FLOAT32)
+BENCH_VEC(softmax_f32_f32, FLOAT32, FLOAT32)
+
+static WORD32 b_vec_activation_min_max_8_8(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_activation_min_max_8_8((WORD8 *)b->p_out, (const WORD8 *)b->p_inp, -64, 64, s->n);
+}
+
+static WORD32 b_vec_activation_min_max_16_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_activation_min_max_16_16((WORD16 *)b->p_out, (const WORD16 *)b->p_inp, -4096, 4096, s->n);
+}
+
+static WORD32 b_vec_activation_min_max_asym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_activation_min_max_asym8u_asym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_inp, 16, 240, s->n);
+}
+
+static WORD32 b_vec_activation_min_max_f32_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_activation_min_max_f32_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, -0.5f, 0.5f, s->n);
+}
+
+static WORD32 b_vec_softmax_asym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_softmax_asym8u_asym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_inp, -248, 23,
+      BENCH_OUT_MULTIPLIER, s->n, b->p_scratch);
+}
+
+static WORD32 b_vec_softmax_asym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_softmax_asym8s_asym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp, -248, 23,
+      BENCH_OUT_MULTIPLIER, s->n, b->p_scratch);
+}
+
+static WORD32 b_vec_softmax_asym8s_16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_softmax_asym8s_16((WORD16 *)b->p_out, (const WORD8 *)b->p_inp, -248, 23,
+      BENCH_OUT_MULTIPLIER, s->n, b->p_scratch);
+}
+
+static WORD32 b_vec_sigmoid_asym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_sigmoid_asym8u_asym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_inp, 128, 255,
+      BENCH_OUT_MULTIPLIER, 3, s->n);
+}
+
+static WORD32 b_vec_interpolation_q15(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_vec_interpolation_q15((WORD16 *)b->p_out, (const WORD16 *)b->p_bias, (const WORD16 *)b->p_inp,
+      (const WORD16 *)b->p_wt, s->n);
+}
+
+BENCH_ELM_F32(mul_f32xf32_f32)
+BENCH_ELM_F32(add_f32xf32_f32)
+BENCH_ELM_F32(mul_acc_f32xf32_f32)
+BENCH_ELM_F32(sub_f32xf32_f32)
+BENCH_ELM_F32(div_f32xf32_f32)
+
+static WORD32 b_elm_floor_f32_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_floor_f32_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, s->n);
+}
+
+static WORD32 b_elm_add_asym8uxasym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_add_asym8uxasym8u_asym8u((UWORD8 *)b->p_out, 128, BENCH_OUT_SHIFT, BENCH_OUT_MULTIPLIER, 0, 255,
+      (const UWORD8 *)b->p_inp, BENCH_ZERO_BIAS_U8, 0, BENCH_OUT_MULTIPLIER,
+      (const UWORD8 *)b->p_wt, BENCH_ZERO_BIAS_U8, 0, BENCH_OUT_MULTIPLIER, 20, s->n);
+}
+
+static WORD32 b_elm_add_asym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_add_asym8sxasym8s_asym8s((WORD8 *)b->p_out, 3, BENCH_OUT_SHIFT, BENCH_OUT_MULTIPLIER, -128, 127,
+      (const WORD8 *)b->p_inp, BENCH_ZERO_BIAS_S8, 0, BENCH_OUT_MULTIPLIER,
+      (const WORD8 *)b->p_wt, BENCH_ZERO_BIAS_S8, 0, BENCH_OUT_MULTIPLIER, 20, s->n);
+}
+
+static WORD32 b_elm_mul_asym8uxasym8u_asym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_mul_asym8uxasym8u_asym8u((UWORD8 *)b->p_out, 128, BENCH_OUT_SHIFT, BENCH_OUT_MULTIPLIER, 0, 255,
+      (const UWORD8 *)b->p_inp, BENCH_ZERO_BIAS_U8, (const UWORD8 *)b->p_wt, BENCH_ZERO_BIAS_U8, s->n);
+}
+
+static WORD32 b_elm_mul_asym8sxasym8s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_mul_asym8sxasym8s_asym8s((WORD8 *)b->p_out, 3, BENCH_OUT_SHIFT, BENCH_OUT_MULTIPLIER, -128, 127,
+      (const WORD8 *)b->p_inp, BENCH_ZERO_BIAS_S8, (const WORD8 *)b->p_wt, BENCH_ZERO_BIAS_S8, s->n);
+}
+
+static WORD32 b_elm_quantize_asym16s_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_quantize_asym16s_asym8s((WORD8 *)b->p_out, (const WORD16 *)b->p_inp, 5, 3,
+      BENCH_OUT_SHIFT, BENCH_OUT_MULTIPLIER, s->n);
+}
+
+static WORD32 b_elm_quantize_asym16s_asym32s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_elm_quantize_asym16s_asym32s((WORD32 *)b->p_out, (const WORD16 *)b->p_inp, 5, 3,
+      BENCH_OUT_SHIFT, BENCH_OUT_MULTIPLIER, s->n);
+}
+
+static WORD32 b_l2_norm_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_l2_norm_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, s->n);
+}
+
+static WORD32 b_dot_prod_16x16_asym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_dot_prod_16x16_asym8s((WORD8 *)b->p_out, (const WORD16 *)b->p_inp, (const WORD16 *)b->p_wt,
+      (const WORD32 *)b->p_bias, s->cols, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 3, s->rows);
+}
+
+BENCH_CONV1D(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_CONV1D(8x8, WORD8, WORD8, WORD8, WORD8)
+BENCH_CONV1D(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_conv1d_std_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv1d_std_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, (FLOAT32 *)b->p_wt, (FLOAT32 *)b->p_bias,
+      s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->oh, 1, b->p_scratch);
+}
+
+#define BENCH_DILATED_CONV1D(NAME, IT, KT, BT, OT) \
+static WORD32 b_dilated_conv1d_std_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_dilated_conv1d_std_##NAME((OT *)b->p_out, (IT *)b->p_inp, (KT *)b->p_wt, (BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->dil, s->oh, BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 1, \
+      b->p_scratch); \
+}
+
+BENCH_DILATED_CONV1D(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_DILATED_CONV1D(8x8, WORD8, WORD8, WORD8, WORD8)
+BENCH_DILATED_CONV1D(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_dilated_conv1d_std_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_dilated_conv1d_std_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_inp, (FLOAT32 *)b->p_wt,
+      (FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->dil, s->oh, 1, b->p_scratch);
+}
+
+/* Streaming conv1d on the handle set up in bench_prepare_weights: each call
+   appends oh * stride rows, so that in steady state it produces the oh
+   output rows of the whole-input kernel */
+#define BENCH_CONV1D_STREAM(NAME, IT, KT, BT, OT) \
+static WORD32 b_conv1d_std_stream_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  WORD32 out_rows = xa_nn_conv1d_std_stream_##NAME(b->p_prep, (OT *)b->p_out, (const IT *)b->p_inp, (KT *)b->p_wt, \
+      (BT *)b->p_bias, s->oh * s->stride, s->oc, BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT); \
+  return out_rows < 0 ? out_rows : 0; \
+}
+
+BENCH_CONV1D_STREAM(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_CONV1D_STREAM(8x8, WORD8, WORD8, WORD8, WORD8)
+BENCH_CONV1D_STREAM(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_conv1d_std_stream_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  WORD32 out_rows = xa_nn_conv1d_std_stream_f32(b->p_prep, (FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp,
+      (FLOAT32 *)b->p_wt, (FLOAT32 *)b->p_bias, s->oh * s->stride, s->oc);
+  return out_rows < 0 ? out_rows : 0;
+}
+
+static WORD32 b_conv1d_std_asym8uxasym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv1d_std_asym8uxasym8u((UWORD8 *)b->p_out, (UWORD8 *)b->p_inp, (UWORD8 *)b->p_wt,
+      (WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->oh,
+      BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128, 1, b->p_scratch);
+}
+
+BENCH_CONV2D(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_CONV2D(8x8, WORD8, WORD8, WORD8, WORD8)
+BENCH_CONV2D(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_conv2d_std_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, (const FLOAT32 *)b->p_wt,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_std_asym8uxasym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_asym8uxasym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_inp, (const UWORD8 *)b->p_wt,
+      (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER,
+      BENCH_OUT_SHIFT, 128, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_std_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp, (const WORD8 *)b->p_wt,
+      (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_std_per_chan_sym8sxasym16s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_per_chan_sym8sxasym16s((WORD16 *)b->p_out, (const WORD16 *)b->p_inp, (const WORD8 *)b->p_wt,
+      (const WORD64 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, 0, b->p_out_multiplier, b->p_out_shift, 0, 0, b->p_scratch);
+}
+
+/* Winograd kernels take the kernel transformed once in bench_prepare_weights;
+   MACs are those of the direct convolution */
+static WORD32 b_conv2d_std_winograd_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_winograd_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, b->p_prep,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->oc, s->pad, s->pad, s->oh, s->ow, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_std_winograd_16x16(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_winograd_16x16((WORD16 *)b->p_out, (const WORD16 *)b->p_inp, b->p_prep,
+      (const WORD16 *)b->p_bias, s->ih, s->iw, s->ic, s->oc, s->pad, s->pad, s->oh, s->ow,
+      BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_std_winograd_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_std_winograd_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp, b->p_prep,
+      (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->oc, s->pad, s->pad, s->oh, s->ow,
+      BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, 0, b->p_scratch);
+}
+
+#define BENCH_CONV2D_GROUPED(NAME, IT, KT, BT, OT) \
+static WORD32 b_conv2d_grouped_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_conv2d_grouped_##NAME((OT *)b->p_out, (IT *)b->p_inp, (KT *)b->p_wt, (BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, BENCH_GROUPS, s->stride, s->stride, s->pad, s->pad, \
+      s->oh, s->ow, BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 0, b->p_scratch); \
+}
+
+BENCH_CONV2D_GROUPED(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_CONV2D_GROUPED(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_conv2d_grouped_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_grouped_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, (const FLOAT32 *)b->p_wt,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, BENCH_GROUPS, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_grouped_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_grouped_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp,
+      (const WORD8 *)b->p_wt, (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, BENCH_GROUPS,
+      s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, BENCH_ZERO_BIAS_S8, b->p_out_multiplier,
+      b->p_out_shift, 3, 0, b->p_scratch);
+}
+
+/* Transposed convolutions read the conv2d (conv1d) shape as their input and
+   upsample it by the stride */
+#define BENCH_TRANSPOSE_CONV(NAME, IT, KT, BT, OT) \
+static WORD32 b_transpose_conv2d_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_transpose_conv2d_##NAME((OT *)b->p_out, (const IT *)b->p_inp, (const KT *)b->p_wt, \
+      (const BT *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride, s->pad, s->pad, \
+      s->oh, s->ow, BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 0, b->p_scratch); \
+} \
+static WORD32 b_transpose_conv1d_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_transpose_conv1d_##NAME((OT *)b->p_out, (const IT *)b->p_inp, (const KT *)b->p_wt, \
+      (const BT *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->oh, \
+      BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 1, b->p_scratch); \
+}
+
+BENCH_TRANSPOSE_CONV(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_TRANSPOSE_CONV(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_transpose_conv2d_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_transpose_conv2d_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, (const FLOAT32 *)b->p_wt,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, 0, b->p_scratch);
+}
+
+static WORD32 b_transpose_conv2d_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_transpose_conv2d_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp,
+      (const WORD8 *)b->p_wt, (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc,
+      s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, BENCH_ZERO_BIAS_S8, b->p_out_multiplier,
+      b->p_out_shift, 3, 0, b->p_scratch);
+}
+
+static WORD32 b_transpose_conv1d_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_transpose_conv1d_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, (const FLOAT32 *)b->p_wt,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->oh, 1, b->p_scratch);
+}
+
+static WORD32 b_transpose_conv1d_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_transpose_conv1d_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp,
+      (const WORD8 *)b->p_wt, (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0,
+      s->oh, BENCH_ZERO_BIAS_S8, b->p_out_multiplier, b->p_out_shift, 3, 0, b->p_scratch);
+}
+
+#define BENCH_DILATED_CONV2D(NAME, IT, KT, BT, OT) \
+static WORD32 b_dilated_conv2d_std_##NAME(bench_bufs_t *b, const bench_shape_t *s) \
+{ \
+  return xa_nn_dilated_conv2d_std_##NAME((OT *)b->p_out, (IT *)b->p_inp, (KT *)b->p_wt, (BT *)b->p_bias, \
+      s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride, s->pad, s->pad, s->dil, s->dil, \
+      s->oh, s->ow, BENCH_BIAS_SHIFT, BENCH_ACC_SHIFT, 0, b->p_scratch); \
+}
+
+BENCH_DILATED_CONV2D(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_DILATED_CONV2D(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_dilated_conv2d_std_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_dilated_conv2d_std_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_inp, (const FLOAT32 *)b->p_wt,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+      s->pad, s->pad, s->dil, s->dil, s->oh, s->ow, 0, b->p_scratch);
+}
+
+static WORD32 b_dilated_conv2d_std_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_inp,
+      (const WORD8 *)b->p_wt, (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->oc,
+      s->stride, s->stride, s->pad, s->pad, s->dil, s->dil, s->oh, s->ow, BENCH_ZERO_BIAS_S8,
+      b->p_out_multiplier, b->p_out_shift, 3, 0, b->p_scratch);
+}
+
+BENCH_DEPTHWISE(8x8, WORD8, WORD8, WORD8, WORD8)
+BENCH_DEPTHWISE(8x16, WORD16, WORD8, WORD16, WORD16)
+BENCH_DEPTHWISE(16x16, WORD16, WORD16, WORD16, WORD16)
+
+static WORD32 b_conv2d_depthwise_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_depthwise_f32((FLOAT32 *)b->p_out, (const FLOAT32 *)b->p_wt, (const FLOAT32 *)b->p_inp,
+      (const FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->cm, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, 0, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_depthwise_asym8uxasym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_depthwise_asym8uxasym8u((UWORD8 *)b->p_out, (const UWORD8 *)b->p_wt, (const UWORD8 *)b->p_inp,
+      (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->cm, s->stride, s->stride,
+      s->pad, s->pad, s->oh, s->ow, BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8, BENCH_OUT_MULTIPLIER,
+      BENCH_OUT_SHIFT, 128, 0, 0, b->p_scratch);
+}
+
+static WORD32 b_conv2d_depthwise_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->cm,
+      s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, BENCH_ZERO_BIAS_S8, b->p_out_multiplier,
+      b->p_out_shift, 3, 0, 0, b->p_scratch);
+}
+
+static WORD32 b_dilated_conv2d_depthwise_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (const WORD8 *)b->p_wt,
+      (const WORD8 *)b->p_inp, (const WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->kh, s->kw, s->cm,
+      s->stride, s->stride, s->pad, s->pad, s->dil, s->dil, s->oh, s->ow, BENCH_ZERO_BIAS_S8,
+      b->p_out_multiplier, b->p_out_shift, 3, 0, 0, b->p_scratch);
+}
+
+/* The 8x16, 16x16 and f32 variants only produce NCHW (out_data_format 1) */
+BENCH_POINTWISE(8x16, WORD16, WORD8, WORD16, WORD16, 1)
+BENCH_POINTWISE(8x8, WORD8, WORD8, WORD8, WORD8, 0)
+BENCH_POINTWISE(16x16, WORD16, WORD16, WORD16, WORD16, 1)
+
+static WORD32 b_conv2d_pointwise_f32(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_pointwise_f32((FLOAT32 *)b->p_out, (FLOAT32 *)b->p_wt, (FLOAT32 *)b->p_inp,
+      (FLOAT32 *)b->p_bias, s->ih, s->iw, s->ic, s->oc, 1);
+}
+
+static WORD32 b_conv2d_pointwise_asym8uxasym8u(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_pointwise_asym8uxasym8u((UWORD8 *)b->p_out, (UWORD8 *)b->p_wt, (UWORD8 *)b->p_inp,
+      (WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->oc, BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8,
+      BENCH_OUT_MULTIPLIER, BENCH_OUT_SHIFT, 128, 0);
+}
+
+static WORD32 b_conv2d_pointwise_per_chan_sym8sxasym8s(bench_bufs_t *b, const bench_shape_t *s)
+{
+  return xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s((WORD8 *)b->p_out, (WORD8 *)b->p_wt, (WORD8 *)b->p_inp,
+      (WORD32 *)b->p_bias, s->ih, s->iw, s->ic, s->oc, BENCH_ZERO_BIAS_S8, b->p_out_multiplier,
+      b->p_out_shift, 3, 0);
+}
+
+BENCH_POOL(avgpool_8, WORD8)
+BENCH_POOL(avgpool_16, WORD16)
+BENCH_POOL(avgpool_f32, FLOAT32)
+BENCH_POOL(avgpool_asym8u, UWORD8)
+BENCH_POOL(maxpool_8, WORD8)
+BENCH_POOL(maxpool_16, WORD16)
+BENCH_POOL(maxpool_f32, FLOAT32)
+BENCH_POOL(maxpool_asym8u, UWORD8)
+
+/*----------------------------------------------------------------------------*
+ * Kernel table
+ *----------------------------------------------------------------------------*/
+#define K(NAME, FAMILY, IB, WB, BB, OB, PREC) { #NAME, FAMILY, IB, WB, BB, OB, PREC, b_##NAME, NULL }
+/* NAME is also reported as a speedup over REF, an earlier row of the same family */
+#define K_VS(NAME, REF, FAMILY, IB, WB, BB, OB, PREC) { #NAME, FAMILY, IB, WB, BB, OB, PREC, b_##NAME, #REF }
+
+static const bench_kernel_t bench_kernels[] =
+{
+  /* name                                  family            inp wt bias out precision */
+  K(matXvec_16x16_16,                      FAMILY_MATXVEC,    2, 2, 2, 2, PREC_16),
+  K(matXvec_16x16_32,                      FAMILY_MATXVEC,    2, 2, 2, 4, PREC_16),
+  K(matXvec_16x16_64,                      FAMILY_MATXVEC,    2, 2, 2, 8, PREC_16),
+  K(matXvec_16x16_16_tanh,                 FAMILY_MATXVEC,    2, 2, 2, 2, PREC_16),
+  K(matXvec_16x16_16_sigmoid,              FAMILY_MATXVEC,    2, 2, 2, 2, PREC_16),
+  K(matXvec_8x16_16,                       FAMILY_MATXVEC,    2, 1, 2, 2, PREC_16),
+  K(matXvec_8x16_32,                       FAMILY_MATXVEC,    2, 1, 2, 4, PREC_16),
+  K(matXvec_8x16_64,                       FAMILY_MATXVEC,    2, 1, 2, 8, PREC_16),
+  K(matXvec_8x16_16_tanh,                  FAMILY_MATXVEC,    2, 1, 2, 2, PREC_16),
+  K(matXvec_8x16_16_sigmoid,               FAMILY_MATXVEC,    2, 1, 2, 2, PREC_16),
+  K(matXvec_8x8_8,                         FAMILY_MATXVEC,    1, 1, 1, 1, PREC_8),
+  K(matXvec_8x8_16,                        FAMILY_MATXVEC,    1, 1, 1, 2, PREC_8),
+  K(matXvec_8x8_32,                        FAMILY_MATXVEC,    1, 1, 1, 4, PREC_8),
+  K(matXvec_8x8_8_tanh,                    FAMILY_MATXVEC,    1, 1, 1, 1, PREC_8),
+  K(matXvec_8x8_8_sigmoid,                 FAMILY_MATXVEC,    1, 1, 1, 1, PREC_8),
+  K(matXvec_f32xf32_f32,                   FAMILY_MATXVEC,    4, 4, 4, 4, PREC_F32),
+  K(matXvec_f32xf32_f32_tanh,              FAMILY_MATXVEC,    4, 4, 4, 4, PREC_F32),
+  K(matXvec_f32xf32_f32_sigmoid,           FAMILY_MATXVEC,    4, 4, 4, 4, PREC_F32),
+  K(matXvec_asym8uxasym8u_asym8u,          FAMILY_MATXVEC,    1, 1, 4, 1, PREC_ASYM8U),
+  K(matXvec_sym8sxasym8s_asym8s,           FAMILY_MATXVEC,    1, 1, 4, 1, PREC_ASYM8S),
+  K(matXvec_out_stride_sym8sxasym8s_16,    FAMILY_MATXVEC,    1, 1, 4, 2, PREC_ASYM8S),
+  K(fully_connected_16x16_16,              FAMILY_MATXVEC,    2, 2, 2, 2, PREC_16),
+  K(fully_connected_8x16_16,               FAMILY_MATXVEC,    2, 1, 2, 2, PREC_16),
+  K(fully_connected_8x8_8,                 FAMILY_MATXVEC,    1, 1, 1, 1, PREC_8),
+  K(fully_connected_f32,                   FAMILY_MATXVEC,    4, 4, 4, 4, PREC_F32),
+  K(fully_connected_asym8uxasym8u_asym8u,  FAMILY_MATXVEC,    1, 1, 4, 1, PREC_ASYM8U),
+  K(fully_connected_sym8sxasym8s_asym8s,   FAMILY_MATXVEC,    1, 1, 4, 1, PREC_ASYM8S),
+  K(matXvec_sym4sxasym8s_asym8s,           FAMILY_MATXVEC,    1, 1, 4, 1, PREC_ASYM8S),
+  K(fully_connected_per_chan_sym4sxasym8s_asym8s, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K(fully_connected_per_chan_sym8sxasym16s_asym16s, FAMILY_MATXVEC, 2, 1, 8, 2, PREC_16),
+  K_VS(matXvec_8x8_8_packed, matXvec_8x8_8, FAMILY_MATXVEC, 1, 1, 1, 1, PREC_8),
+  K_VS(matXvec_sym8sxasym8s_asym8s_packed, matXvec_sym8sxasym8s_asym8s, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_asym8uxasym8u_asym8u_folded, matXvec_asym8uxasym8u_asym8u, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8U),
+  K_VS(matXvec_sym8sxasym8s_asym8s_sparse_2_4, matXvec_sym8sxasym8s_asym8s, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_sym8sxasym8s_asym8s_sparse_1x4, matXvec_sym8sxasym8s_asym8s, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_sym8sxasym8s_asym8s_sparse_4x4, matXvec_sym8sxasym8s_asym8s, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(fully_connected_sym8sxasym8s_asym8s_sparse_2_4, fully_connected_sym8sxasym8s_asym8s,
+       FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(fully_connected_sym8sxasym8s_asym8s_sparse_1x4, fully_connected_sym8sxasym8s_asym8s,
+       FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(fully_connected_sym8sxasym8s_asym8s_sparse_4x4, fully_connected_sym8sxasym8s_asym8s,
+       FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_sym8sxasym8s_asym8s_parallel_rows, matXvec_sym8sxasym8s_asym8s,
+       FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_sym8sxasym8s_asym8s_parallel_k, matXvec_sym8sxasym8s_asym8s,
+       FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_sym8sxasym8s_asym8s_epilogue, matXvec_sym8sxasym8s_asym8s,
+       FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matXvec_t_16x16_16, matXvec_16x16_16, FAMILY_MATXVEC, 2, 2, 2, 2, PREC_16),
+  K_VS(matXvec_t_8x16_16, matXvec_8x16_16, FAMILY_MATXVEC, 2, 1, 2, 2, PREC_16),
+  K_VS(matXvec_t_sym8sxasym8s_asym8s, matXvec_sym8sxasym8s_asym8s, FAMILY_MATXVEC, 1, 1, 4, 1, PREC_ASYM8S),
+  K(matXvec_batch_16x16_64,                FAMILY_MATMUL,     2, 2, 2, 8, PREC_16),
+  K(matXvec_batch_8x16_64,                 FAMILY_MATMUL,     2, 1, 2, 8, PREC_16),
+  K(matXvec_batch_8x8_32,                  FAMILY_MATMUL,     1, 1, 1, 4, PREC_8),
+  K(matXvec_batch_f32xf32_f32,             FAMILY_MATMUL,     4, 4, 4, 4, PREC_F32),
+  K(matXvec_batch_asym8uxasym8u_asym8u,    FAMILY_MATMUL,     1, 1, 4, 1, PREC_ASYM8U),
+  K(matmul_8x8_8,                          FAMILY_MATMUL,     1, 1, 1, 1, PREC_8),
+  K(matmul_asym8uxasym8u_asym8u,           FAMILY_MATMUL,     1, 1, 4, 1, PREC_ASYM8U),
+  K(matmul_per_chan_sym8sxasym8s_asym8s,   FAMILY_MATMUL,     1, 1, 4, 1, PREC_ASYM8S),
+  K(matmul_per_chan_sym4sxasym8s_asym8s,   FAMILY_MATMUL,     1, 1, 4, 1, PREC_ASYM8S),
+  K(matmul_per_chan_sym8sxasym16s_asym16s, FAMILY_MATMUL,     2, 1, 8, 2, PREC_16),
+  K_VS(matmul_asym8uxasym8u_asym8u_packed, matmul_asym8uxasym8u_asym8u, FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8U),
+  K_VS(matmul_asym8uxasym8u_asym8u_folded, matmul_asym8uxasym8u_asym8u, FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8U),
+  K_VS(matmul_8x8_8_blocked, matmul_8x8_8, FAMILY_MATMUL, 1, 1, 1, 1, PREC_8),
+  K_VS(matmul_per_chan_sym8sxasym8s_asym8s_blocked, matmul_per_chan_sym8sxasym8s_asym8s,
+       FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matmul_per_chan_sym8sxasym8s_asym8s_parallel_rows, matmul_per_chan_sym8sxasym8s_asym8s,
+       FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matmul_per_chan_sym8sxasym8s_asym8s_parallel_k, matmul_per_chan_sym8sxasym8s_asym8s,
+       FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(matmul_per_chan_sym8sxasym8s_asym8s_epilogue, matmul_per_chan_sym8sxasym8s_asym8s,
+       FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K(matmul_nt_16x16_16,                    FAMILY_MATMUL,     2, 2, 2, 2, PREC_16),
+  K(matmul_nt_8x16_16,                     FAMILY_MATMUL,     2, 1, 2, 2, PREC_16),
+  K_VS(matmul_tn_16x16_16, matmul_nt_16x16_16, FAMILY_MATMUL, 2, 2, 2, 2, PREC_16),
+  K_VS(matmul_tn_8x16_16, matmul_nt_8x16_16, FAMILY_MATMUL, 2, 1, 2, 2, PREC_16),
+  K_VS(matmul_tn_per_chan_sym8sxasym8s_asym8s, matmul_per_chan_sym8sxasym8s_asym8s,
+       FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K(batch_loop_matmul_per_chan_sym8sxasym8s_asym8s, FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K_VS(batch_matmul_per_chan_sym8sxasym8s_asym8s, batch_loop_matmul_per_chan_sym8sxasym8s_asym8s,
+       FAMILY_MATMUL, 1, 1, 4, 1, PREC_ASYM8S),
+  K(batch_loop_matmul_16x16_16,            FAMILY_MATMUL,     2, 2, 2, 2, PREC_16),
+  K_VS(batch_matmul_16x16_16, batch_loop_matmul_16x16_16, FAMILY_MATMUL, 2, 2, 2, 2, PREC_16),
+  K(vec_sigmoid_32_32,                     FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_tanh_32_32,                        FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_relu_std_32_32,                    FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_relu_32_32,                        FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_relu1_32_32,                       FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_relu6_32_32,                       FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_softmax_32_32,                     FAMILY_ACT,        4, 0, 0, 4, PREC_32),
+  K(vec_sigmoid_32_16,                     FAMILY_ACT,        4, 0, 0, 2, PREC_32),
+  K(vec_tanh_32_16,                        FAMILY_ACT,        4, 0, 0, 2, PREC_32),
+  K(vec_sigmoid_32_8,                      FAMILY_ACT,        4, 0, 0, 1, PREC_32),
+  K(vec_tanh_32_8,                         FAMILY_ACT,        4, 0, 0, 1, PREC_32),
+  K(vec_relu_16_16,                        FAMILY_ACT,        2, 0, 0, 2, PREC_16),
+  K(vec_relu_std_16_16,                    FAMILY_ACT,        2, 0, 0, 2, PREC_16),
+  K(vec_relu_8_8,                          FAMILY_ACT,        1, 0, 0, 1, PREC_8),
+  K(vec_relu_std_8_8,                      FAMILY_ACT,        1, 0, 0, 1, PREC_8),
+  K(vec_sigmoid_f32_f32,                   FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_tanh_f32_f32,                      FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_relu_f32_f32,                      FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_relu_std_f32_f32,                  FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_relu1_f32_f32,                     FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_relu6_f32_f32,                     FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_softmax_f32_f32,                   FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_activation_min_max_8_8,            FAMILY_ACT,        1, 0, 0, 1, PREC_8),
+  K(vec_activation_min_max_16_16,          FAMILY_ACT,        2, 0, 0, 2, PREC_16),
+  K(vec_activation_min_max_asym8u_asym8u,  FAMILY_ACT,        1, 0, 0, 1, PREC_ASYM8U),
+  K(vec_activation_min_max_f32_f32,        FAMILY_ACT,        4, 0, 0, 4, PREC_F32),
+  K(vec_softmax_asym8u_asym8u,             FAMILY_ACT,        1, 0, 0, 1, PREC_ASYM8U),
+  K(vec_softmax_asym8s_asym8s,             FAMILY_ACT,        1, 0, 0, 1, PREC_ASYM8S),
+  K(vec_softmax_asym8s_16,                 FAMILY_ACT,        1, 0, 0, 2, PREC_ASYM8S),
+  K(vec_sigmoid_asym8u_asym8u,             FAMILY_ACT,        1, 0, 0, 1, PREC_ASYM8U),
+  K(vec_interpolation_q15,                 FAMILY_ELM,        2, 2, 2, 2, PREC_16),
+  K(elm_mul_f32xf32_f32,                   FAMILY_ELM,        4, 4, 0, 4, PREC_F32),
+  K(elm_add_f32xf32_f32,                   FAMILY_ELM,        4, 4, 0, 4, PREC_F32),
+  K(elm_mul_acc_f32xf32_f32,               FAMILY_ELM,        4, 4, 0, 4, PREC_F32),
+  K(elm_sub_f32xf32_f32,                   FAMILY_ELM,        4, 4, 0, 4, PREC_F32),
+  K(elm_div_f32xf32_f32,                   FAMILY_ELM,        4, 4, 0, 4, PREC_F32),
+  K(elm_floor_f32_f32,                     FAMILY_ELM,        4, 0, 0, 4, PREC_F32),
+  K(elm_add_asym8uxasym8u_asym8u,          FAMILY_ELM,        1, 1, 0, 1, PREC_ASYM8U),
+  K(elm_add_asym8sxasym8s_asym8s,          FAMILY_ELM,        1, 1, 0, 1, PREC_ASYM8S),
+  K(elm_mul_asym8uxasym8u_asym8u,          FAMILY_ELM,        1, 1, 0, 1, PREC_ASYM8U),
+  K(elm_mul_asym8sxasym8s_asym8s,          FAMILY_ELM,        1, 1, 0, 1, PREC_ASYM8S),
+  K(elm_quantize_asym16s_asym8s,           FAMILY_ELM,        2, 0, 0, 1, PREC_ASYM16S),
+  K(elm_quantize_asym16s_asym32s,          FAMILY_ELM,        2, 0, 0, 4, PREC_ASYM16S),
+  K(l2_norm_f32,                           FAMILY_ELM,        4, 0, 0, 4, PREC_F32),
+  K(dot_prod_16x16_asym8s,                 FAMILY_DOT,        2, 2, 4, 1, PREC_16),
+  K(conv1d_std_8x16,                       FAMILY_CONV1D,     2, 1, 2, 2, PREC_16),
+  K(conv1d_std_8x8,                        FAMILY_CONV1D,     1, 1, 1, 1, PREC_8),
+  K(conv1d_std_16x16,                      FAMILY_CONV1D,     2, 2, 2, 2, PREC_16),
+  K(conv1d_std_f32,                        FAMILY_CONV1D,     4, 4, 4, 4, PREC_F32),
+  K(conv1d_std_asym8uxasym8u,              FAMILY_CONV1D,     1, 1, 4, 1, PREC_ASYM8U),
+  K_VS(conv1d_std_stream_8x16, conv1d_std_8x16, FAMILY_CONV1D, 2, 1, 2, 2, PREC_16),
+  K_VS(conv1d_std_stream_8x8, conv1d_std_8x8, FAMILY_CONV1D, 1, 1, 1, 1, PREC_8),
+  K_VS(conv1d_std_stream_16x16, conv1d_std_16x16, FAMILY_CONV1D, 2, 2, 2, 2, PREC_16),
+  K_VS(conv1d_std_stream_f32, conv1d_std_f32, FAMILY_CONV1D, 4, 4, 4, 4, PREC_F32),
+  K(dilated_conv1d_std_8x16,               FAMILY_CONV1D,     2, 1, 2, 2, PREC_16),
+  K(dilated_conv1d_std_8x8,                FAMILY_CONV1D,     1, 1, 1, 1, PREC_8),
+  K(dilated_conv1d_std_16x16,              FAMILY_CONV1D,     2, 2, 2, 2, PREC_16),
+  K(dilated_conv1d_std_f32,                FAMILY_CONV1D,     4, 4, 4, 4, PREC_F32),
+  K(transpose_conv1d_8x16,                 FAMILY_CONV1D,     2, 1, 2, 2, PREC_16),
+  K(transpose_conv1d_16x16,                FAMILY_CONV1D,     2, 2, 2, 2, PREC_16),
+  K(transpose_conv1d_f32,                  FAMILY_CONV1D,     4, 4, 4, 4, PREC_F32),
+  K(transpose_conv1d_per_chan_sym8sxasym8s, FAMILY_CONV1D,    1, 1, 4, 1, PREC_ASYM8S),
+  K(conv2d_std_8x16,                       FAMILY_CONV2D,     2, 1, 2, 2, PREC_16),
+  K(conv2d_std_8x8,                        FAMILY_CONV2D,     1, 1, 1, 1, PREC_8),
+  K(conv2d_std_16x16,                      FAMILY_CONV2D,     2, 2, 2, 2, PREC_16),
+  K(conv2d_std_f32,                        FAMILY_CONV2D,     4, 4, 4, 4, PREC_F32),
+  K(conv2d_std_asym8uxasym8u,              FAMILY_CONV2D,     1, 1, 4, 1, PREC_ASYM8U),
+  K(conv2d_std_per_chan_sym8sxasym8s,      FAMILY_CONV2D,     1, 1, 4, 1, PREC_ASYM8S),
+  K(conv2d_std_per_chan_sym8sxasym16s,     FAMILY_CONV2D,     2, 1, 8, 2, PREC_16),
+  K_VS(conv2d_std_winograd_f32, conv2d_std_f32, FAMILY_CONV2D, 4, 4, 4, 4, PREC_F32),
+  K_VS(conv2d_std_winograd_16x16, conv2d_std_16x16, FAMILY_CONV2D, 2, 2, 2, 2, PREC_16),
+  K_VS(conv2d_std_winograd_per_chan_sym8sxasym8s, conv2d_std_per_chan_sym8sxasym8s,
+       FAMILY_CONV2D, 1, 1, 4, 1, PREC_ASYM8S),
+  K(dilated_conv2d_std_8x16,               FAMILY_CONV2D,     2, 1, 2, 2, PREC_16),
+  K(dilated_conv2d_std_16x16,              FAMILY_CONV2D,     2, 2, 2, 2, PREC_16),
+  K(dilated_conv2d_std_f32,                FAMILY_CONV2D,     4, 4, 4, 4, PREC_F32),
+  K(dilated_conv2d_std_per_chan_sym8sxasym8s, FAMILY_CONV2D,  1, 1, 4, 1, PREC_ASYM8S),
+  K(conv2d_grouped_8x16,                   FAMILY_CONV2D,     2, 1, 2, 2, PREC_16),
+  K(conv2d_grouped_16x16,                  FAMILY_CONV2D,     2, 2, 2, 2, PREC_16),
+  K(conv2d_grouped_f32,                    FAMILY_CONV2D,     4, 4, 4, 4, PREC_F32),
+  K(conv2d_grouped_per_chan_sym8sxasym8s,  FAMILY_CONV2D,     1, 1, 4, 1, PREC_ASYM8S),
+  K(transpose_conv2d_8x16,                 FAMILY_CONV2D,     2, 1, 2, 2, PREC_16),
+  K(transpose_conv2d_16x16,                FAMILY_CONV2D,     2, 2, 2, 2, PREC_16),
+  K(transpose_conv2d_f32,                  FAMILY_CONV2D,     4, 4, 4, 4, PREC_F32),
+  K(transpose_conv2d_per_chan_sym8sxasym8s, FAMILY_CONV2D,    1, 1, 4, 1, PREC_ASYM8S),
+  K(conv2d_depthwise_8x8,                  FAMILY_DEPTHWISE,  1, 1, 1, 1, PREC_8),
+  K(conv2d_depthwise_8x16,                 FAMILY_DEPTHWISE,  2, 1, 2, 2, PREC_16),
+  K(conv2d_depthwise_16x16,                FAMILY_DEPTHWISE,  2, 2, 2, 2, PREC_16),
+  K(conv2d_depthwise_f32,                  FAMILY_DEPTHWISE,  4, 4, 4, 4, PREC_F32),
+  K(conv2d_depthwise_asym8uxasym8u,        FAMILY_DEPTHWISE,  1, 1, 4, 1, PREC_ASYM8U),
+  K(conv2d_depthwise_per_chan_sym8sxasym8s, FAMILY_DEPTHWISE, 1, 1, 4, 1, PREC_ASYM8S),
+  K(dilated_conv2d_depthwise_per_chan_sym8sxasym8s, FAMILY_DEPTHWISE, 1, 1, 4, 1, PREC_ASYM8S),
+  K(conv2d_pointwise_8x16,                 FAMILY_POINTWISE,  2, 1, 2, 2, PREC_16),
+  K(conv2d_pointwise_8x8,                  FAMILY_POINTWISE,  1, 1, 1, 1, PREC_8),
+  K(conv2d_pointwise_16x16,                FAMILY_POINTWISE,  2, 2, 2, 2, PREC_16),
+  K(conv2d_pointwise_f32,                  FAMILY_POINTWISE,  4, 4, 4, 4, PREC_F32),
+  K(conv2d_pointwise_asym8uxasym8u,        FAMILY_POINTWISE,  1, 1, 4, 1, PREC_ASYM8U),
+  K(conv2d_pointwise_per_chan_sym8sxasym8s, FAMILY_POINTWISE, 1, 1, 4, 1, PREC_ASYM8S),
+  K(avgpool_8,                             FAMILY_POOL,       1, 0, 0, 1, PREC_8),
+  K(avgpool_16,                            FAMILY_POOL,       2, 0, 0, 2, PREC_16),
+  K(avgpool_f32,                           FAMILY_POOL,       4, 0, 0, 4, PREC_F32),
+  K(avgpool_asym8u,                        FAMILY_POOL,       1, 0, 0, 1, PREC_ASYM8U),
+  K(maxpool_8,                             FAMILY_POOL,       1, 0, 0, 1, PREC_8),
+  K(maxpool_16,                            FAMILY_POOL,       2, 0, 0, 2, PREC_16),
+  K(maxpool_f32,                           FAMILY_POOL,       4, 0, 0, 4, PREC_F32),
+  K(maxpool_asym8u,                        FAMILY_POOL,       1, 0, 0, 1, PREC_ASYM8U),
+};
+
+#define NUM_BENCH_KERNELS (int)(sizeof(bench_kernels)/sizeof(bench_kernel_t))
+#define BENCH_MAX_SHAPES 8
+
+/*----------------------------------------------------------------------------*
+ * Clocks and hardware counters
+ *----------------------------------------------------------------------------*/
+static inline uint64_t bench_ns(void)
+{
+#if defined(__XTENSA__)
+  return (uint64_t)clock() * (1000000000u / CLOCKS_PER_SEC);
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* Free running cycle/timestamp counter, 0 where there is none */
+static inline uint64_t bench_ticks(void)
+{
+#if defined(__XTENSA__)
+  unsigned long r;
+  __asm__ volatile ("rsr.ccount %0" : "=r" (r));
+  return r;
+#elif defined(__x86_64__) || defined(__i386__)
+  unsigned int lo, hi;
+  __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64_t)hi << 32) | lo;
+#else
+  return 0;
+#endif
+}
+
+#define PERF_NUM_COUNTERS 3
+
+typedef struct _bench_perf_t
+{
+  int fd[PERF_NUM_COUNTERS];
+  int valid;
+} bench_perf_t;
+
+static void perf_open(bench_perf_t *p_perf)
+{
+  int i;
+  p_perf->valid = 0;
+  for(i = 0; i < PERF_NUM_COUNTERS; i++)
+    p_perf->fd[i] = -1;
+#ifdef BENCH_PERF_EVENTS
+  {
+    static const unsigned long long configs[PERF_NUM_COUNTERS] =
+    {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES
+    };
+    struct perf_event_attr attr;
+
+    for(i = 0; i < PERF_NUM_COUNTERS; i++)
+    {
+      memset(&attr, 0, sizeof(attr));
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = configs[i];
+      attr.disabled = (i == 0);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      p_perf->fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, i == 0 ? -1 : p_perf->fd[0], 0);
+      if(p_perf->fd[i] < 0)
+        break;
+    }
+    if(i == PERF_NUM_COUNTERS)
+    {
+      p_perf->valid = 1;
+      return;
+    }
+    for(i = 0; i < PERF_NUM_COUNTERS; i++)
+    {
+      if(p_perf->fd[i] >= 0)
+        close(p_perf->fd[i]);
+      p_perf->fd[i] = -1;
+    }
+  }
+#endif
+}
+
+static void perf_close(bench_perf_t *p_perf)
+{
+#ifdef BENCH_PERF_EVENTS
+  int i;
+  for(i = 0; i < PERF_NUM_COUNTERS; i++)
+    if(p_perf->fd[i] >= 0)
+      close(p_perf->fd[i]);
+#endif
+  p_perf->valid = 0;
+}
+
+static inline void perf_start(bench_perf_t *p_perf)
+{
+#ifdef BENCH_PERF_EVENTS
+  if(p_perf->valid)
+  {
+    ioctl(p_perf->fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(p_perf->fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+/* Stops the group and adds the counts to p_counts */
+static inline void perf_stop(bench_perf_t *p_perf, uint64_t *p_counts)
+{
+#ifdef BENCH_PERF_EVENTS
+  if(p_perf->valid)
+  {
+    uint64_t data[1 + PERF_NUM_COUNTERS];
+    int i;
+    ioctl(p_perf->fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    if(read(p_perf->fd[0], data, sizeof(data)) == (ssize_t)sizeof(data) && data[0] == PERF_NUM_COUNTERS)
+    {
+      for(i = 0; i < PERF_NUM_COUNTERS; i++)
+        p_counts[i] += data[1 + i];
+    }
+  }
+#else
+  (void)p_counts;
+#endif
+}
+
+/*----------------------------------------------------------------------------*
+ * Buffers
+ *----------------------------------------------------------------------------*/
+static void *bench_alloc(size_t bytes)
+{
+  char *p_raw = (char *)malloc(bytes + BENCH_ALIGNMENT + sizeof(void *));
+  char *p;
+  if(p_raw == NULL)
+    return NULL;
+  p = (char *)(((uintptr_t)p_raw + sizeof(void *) + BENCH_ALIGNMENT - 1) & ~(uintptr_t)(BENCH_ALIGNMENT - 1));
+  ((void **)p)[-1] = p_raw;
+  return p;
+}
+
+static void bench_free(void *p)
+{
+  if(p != NULL)
+    free(((void **)p)[-1]);
+}
+
+static unsigned int bench_seed = 12345;
+
+static inline int bench_rand(void)
+{
+  bench_seed = bench_seed * 1103515245u + 12345u;
+  return (int)((bench_seed >> 8) & 0xffff) - 0x8000;
+}
+
+/* Data in a moderate range so that fixed-point and float kernels do not overflow */
+static void *bench_alloc_data(long count, int elem_bytes, int precision)
+{
+  long i;
+  void *p;
+  if(count <= 0 || elem_bytes <= 0)
+    return NULL;
+  p = bench_alloc((size_t)count * elem_bytes);
+  if(p == NULL)
+    return NULL;
+  for(i = 0; i < count; i++)
+  {
+    switch(elem_bytes)
+    {
+      case 1: ((WORD8 *)p)[i] = (WORD8)(bench_rand() >> 8); break;
+      case 2: ((WORD16 *)p)[i] = (WORD16)(bench_rand() >> 4); break;
+      case 4:
+        if(precision == PREC_F32)
+          ((FLOAT32 *)p)[i] = (FLOAT32)bench_rand() / 0x8000;
+        else
+          ((WORD32 *)p)[i] = bench_rand() * 512;
+        break;
+      default: ((WORD64 *)p)[i] = bench_rand(); break;
+    }
+  }
+  return p;
+}
+
+/* Dilation needs unit stride, so the dilated kernels run strided shapes
+   undilated. Transposed convolutions produce the input of the convolution
+   of the same shape. */
+static void bench_shape_finalize(const bench_kernel_t *p_k, bench_shape_t *s)
+{
+  int kh, kw;
+  s->dil = strncmp(p_k->name, "dilated_", 8) == 0 && s->stride == 1 ? BENCH_DILATION : 1;
+  kh = (s->kh - 1) * s->dil + 1;
+  kw = (s->kw - 1) * s->dil + 1;
+  if(strncmp(p_k->name, "transpose_", 10) == 0)
+  {
+    s->oh = (s->ih - 1) * s->stride + kh - 2 * s->pad;
+    s->ow = p_k->family == FAMILY_CONV1D ? 1 : (s->iw - 1) * s->stride + kw - 2 * s->pad;
+    return;
+  }
+  switch(p_k->family)
+  {
+    case FAMILY_CONV1D:
+      s->oh = (s->ih - kh) / s->stride + 1;
+      s->ow = 1;
+      break;
+    case FAMILY_CONV2D:
+    case FAMILY_DEPTHWISE:
+    case FAMILY_POOL:
+      s->oh = (s->ih + 2 * s->pad - kh) / s->stride + 1;
+      s->ow = (s->iw + 2 * s->pad - kw) / s->stride + 1;
+      break;
+    case FAMILY_POINTWISE:
+      s->oh = s->ih;
+      s->ow = s->iw;
+      break;
+    default:
+      break;
+  }
+}
+
+static void bench_shape_string(bench_family_t family, const bench_shape_t *s, char *str)
+{
+  switch(family)
+  {
+    case FAMILY_MATXVEC:
+    case FAMILY_MATMUL:
+      sprintf(str, "rows=%d cols=%d vecs=%d", s->rows, s->cols, s->vecs);
+      break;
+    case FAMILY_DOT:
+      sprintf(str, "vecs=%d len=%d", s->rows, s->cols);
+      break;
+    case FAMILY_ACT:
+    case FAMILY_ELM:
+      sprintf(str, "n=%d", s->n);
+      break;
+    case FAMILY_CONV1D:
+      sprintf(str, "ih=%d iw=%d ic=%d kh=%d oc=%d s=%d oh=%d", s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, s->oh);
+      break;
+    case FAMILY_POINTWISE:
+      sprintf(str, "ih=%d iw=%d ic=%d oc=%d", s->ih, s->iw, s->ic, s->oc);
+      break;
+    case FAMILY_POOL:
+      sprintf(str, "ih=%d iw=%d ic=%d kh=%d kw=%d s=%d p=%d oh=%d ow=%d",
+          s->ih, s->iw, s->ic, s->kh, s->kw, s->stride, s->pad, s->oh, s->ow);
+      break;
+    case FAMILY_DEPTHWISE:
+      sprintf(str, "ih=%d iw=%d ic=%d kh=%d kw=%d cm=%d s=%d p=%d oh=%d ow=%d",
+          s->ih, s->iw, s->ic, s->kh, s->kw, s->cm, s->stride, s->pad, s->oh, s->ow);
+      break;
+    default:
+      sprintf(str, "ih=%d iw=%d ic=%d kh=%d kw=%d oc=%d s=%d p=%d oh=%d ow=%d",
+          s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->pad, s->oh, s->ow);
+      break;
+  }
+  if(s->dil > 1)
+    sprintf(str + strlen(str), " d=%d", s->dil);
+}
+
+/*
+ * Element counts of every operand, the number of multiply-accumulates (or
+ * compares/adds for pooling and elementwise ops) and the per-channel count.
+ */
+static void bench_counts(const bench_kernel_t *p_k, const bench_shape_t *s,
+    long *p_inp, long *p_wt, long *p_bias, long *p_out, double *p_macs, long *p_chan)
+{
+  long n_inp = 0, n_wt = 0, n_bias = 0, n_out = 0, n_chan = 0;
+  double macs = 0;
+  switch(p_k->family)
+  {
+    case FAMILY_MATXVEC:
+    case FAMILY_MATMUL:
+    {
+      int batch = strncmp(p_k->name, "batch_", 6) == 0 ? BENCH_BATCH_COUNT : 1;
+      n_inp = (long)s->cols * s->vecs * batch;
+      n_wt = (long)s->rows * s->cols * batch;
+      n_bias = n_chan = s->rows;
+      n_out = (long)s->rows * s->vecs * batch;
+      macs = (double)s->rows * s->cols * s->vecs * batch;
+      break;
+    }
+    case FAMILY_ACT:
+    case FAMILY_ELM:
+      n_inp = n_out = s->n;
+      n_wt = p_k->wt_bytes ? s->n : 0;
+      n_bias = p_k->bias_bytes ? s->n : 0;
+      macs = s->n;
+      break;
+    case FAMILY_DOT:
+      n_inp = n_wt = (long)s->rows * s->cols;
+      n_bias = n_out = s->rows;
+      macs = (double)s->rows * s->cols;
+      break;
+    case FAMILY_CONV1D:
+      n_inp = (long)s->ih * s->iw * s->ic;
+      n_wt = (long)s->kh * s->iw * s->ic * s->oc;
+      n_bias = n_chan = s->oc;
+      n_out = (long)s->oh * s->oc;
+      macs = (double)s->oh * s->oc * s->kh * s->iw * s->ic;
+      if(strncmp(p_k->name, "transpose_", 10) == 0)
+        macs = (double)s->ih * s->oc * s->kh * s->iw * s->ic;
+      break;
+    case FAMILY_CONV2D:
+      n_inp = (long)s->ih * s->iw * s->ic;
+      n_wt = (long)s->kh * s->kw * s->ic * s->oc;
+      n_bias = n_chan = s->oc;
+      n_out = (long)s->oh * s->ow * s->oc;
+      macs = (double)s->oh * s->ow * s->oc * s->kh * s->kw * s->ic;
+      /* every input scatters into kh x kw outputs */
+      if(strncmp(p_k->name, "transpose_", 10) == 0)
+        macs = (double)s->ih * s->iw * s->oc * s->kh * s->kw * s->ic;
+      /* each output channel only sees its group's input channels */
+      if(strncmp(p_k->name, "conv2d_grouped_", 15) == 0)
+      {
+        n_wt /= BENCH_GROUPS;
+        macs /= BENCH_GROUPS;
+      }
+      break;
+    case FAMILY_DEPTHWISE:
+      n_inp = (long)s->ih * s->iw * s->ic;
+      n_wt = (long)s->kh * s->kw * s->ic * s->cm;
+      n_bias = n_chan = (long)s->ic * s->cm;
+      n_out = (long)s->oh * s->ow * s->ic * s->cm;
+      macs = (double)n_out * s->kh * s->kw;
+      break;
+    case FAMILY_POINTWISE:
+      n_inp = (long)s->ih * s->iw * s->ic;
+      n_wt = (long)s->ic * s->oc;
+      n_bias = n_chan = s->oc;
+      n_out = (long)s->ih * s->iw * s->oc;
+      macs = (double)s->ih * s->iw * s->ic * s->oc;
+      break;
+    case FAMILY_POOL:
+      n_inp = (long)s->ih * s->iw * s->ic;
+      n_out = (long)s->oh * s->ow * s->ic;
+      macs = (double)n_out * s->kh * s->kw;
+      break;
+    default:
+      break;
+  }
+  if(p_k->wt_bytes == 0) n_wt = 0;
+  if(p_k->bias_bytes == 0) n_bias = 0;
+  *p_inp = n_inp; *p_wt = n_wt; *p_bias = n_bias; *p_out = n_out;
+  *p_macs = macs; *p_chan = n_chan;
+}
+
+static WORD32 bench_scratch_size(const bench_kernel_t *p_k, const bench_shape_t *s)
+{
+  if(strstr(p_k->name, "_parallel_") != NULL)
+    return xa_nn_matmul_parallel_getsize(s->rows, s->vecs,
+        strstr(p_k->name, "_parallel_k") != NULL ? XA_NNLIB_SPLIT_K : XA_NNLIB_SPLIT_ROWS, bench_workers.num_workers);
+  switch(p_k->family)
+  {
+    case FAMILY_MATXVEC:
+      return s->rows * 4;
+    case FAMILY_MATMUL:
+      if(strstr(p_k->name, "_blocked") != NULL)
+      {
+        xa_nnlib_gemm_blocking_t blocking;
+        if(xa_nn_matmul_get_blocking(&blocking, NULL, s->rows, s->cols, s->vecs))
+          return -1;
+        return xa_nn_matmul_blocked_getsize(&blocking);
+      }
+      return 0;
+    case FAMILY_ACT:
+      if(strstr(p_k->name, "softmax") != NULL && p_k->precision != PREC_F32 && p_k->precision != PREC_32)
+        return get_softmax_scratch_size(p_k->precision, p_k->out_bytes == 2 ? PREC_16 : p_k->precision, s->n);
+      return 0;
+    case FAMILY_CONV1D:
+      if(strncmp(p_k->name, "transpose_", 10) == 0)
+        return xa_nn_transpose_conv1d_getsize(s->ih, s->iw, s->ic, s->kh, s->oc, s->stride, 0, s->oh,
+            p_k->precision);
+      if(strncmp(p_k->name, "dilated_", 8) == 0)
+        return xa_nn_dilated_conv1d_std_getsize(s->kh, s->iw, s->ic, s->dil, p_k->precision);
+      return xa_nn_conv1d_std_getsize(s->kh, s->iw, s->ic, p_k->precision);
+    case FAMILY_CONV2D:
+      if(strncmp(p_k->name, "transpose_", 10) == 0)
+        return xa_nn_transpose_conv2d_getsize(s->ih, s->iw, s->ic, s->kh, s->kw, s->oc, s->stride, s->stride,
+            s->pad, s->pad, s->oh, s->ow, p_k->precision);
+      if(strncmp(p_k->name, "conv2d_grouped_", 15) == 0)
+        return xa_nn_conv2d_grouped_getsize(s->ih, s->ic, s->kh, s->kw, BENCH_GROUPS, s->stride, s->pad, s->oh,
+            p_k->precision);
+      if(strstr(p_k->name, "_winograd") != NULL)
+        return xa_nn_conv2d_std_winograd_getsize(s->ic, s->oc, p_k->precision);
+      if(strncmp(p_k->name, "dilated_", 8) == 0)
+        return xa_nn_dilated_conv2d_std_getsize(s->ih, s->ic, s->kh, s->kw, s->stride, s->pad, s->dil, s->oh,
+            p_k->precision);
+      return xa_nn_conv2d_std_getsize(s->ih, s->ic, s->kh, s->kw, s->stride, s->pad, s->oh, p_k->precision);
+    case FAMILY_DEPTHWISE:
+      if(strncmp(p_k->name, "dilated_", 8) == 0)
+        return xa_nn_dilated_conv2d_depthwise_getsize(s->ih, s->iw, s->ic, s->kh, s->kw, s->cm, s->stride, s->stride,
+            s->pad, s->pad, s->dil, s->dil, s->oh, s->ow, p_k->precision, 0);
+      return xa_nn_conv2d_depthwise_getsize(s->ih, s->iw, s->ic, s->kh, s->kw, s->cm, s->stride, s->stride,
+          s->pad, s->pad, s->oh, s->ow, p_k->precision, 0);
+    case FAMILY_POOL:
+      if(strncmp(p_k->name, "avgpool", 7) == 0)
+        return xa_nn_avgpool_getsize(s->ic, p_k->precision, p_k->precision, s->ih, s->iw, s->kh, s->kw,
+            s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, 0, 0);
+      return xa_nn_maxpool_getsize(s->ic, p_k->precision, p_k->precision, s->ih, s->iw, s->kh, s->kw,
+          s->stride, s->stride, s->pad, s->pad, s->oh, s->ow, 0, 0);
+    default:
+      return 0;
+  }
+}
+
+static void bench_free_bufs(bench_bufs_t *b)
+{
+  bench_free(b->p_out);
+  bench_free(b->p_inp);
+  bench_free(b->p_wt);
+  bench_free(b->p_bias);
+  bench_free(b->p_scratch);
+  bench_free(b->p_prep);
+  free(b->pp_out);
+  free(b->pp_inp);
+  free(b->p_out_multiplier);
+  free(b->p_out_shift);
+  memset(b, 0, sizeof(*b));
+}
+
+/*
+ * Weight layouts that a real caller computes once per model (packed,
+ * folded bias, sparse, epilogue residual, streaming state, Winograd
+ * kernel, ...)
+ * are built here into b->p_prep so that only the kernel itself is timed.
+ * Returns 0 on success, -3 if the preparation failed, -2 on allocation failure,
+ * -4 if the kernel does not support the shape.
+ */
+static int bench_prepare_weights(const bench_kernel_t *p_k, const bench_shape_t *s, bench_bufs_t *b)
+{
+  if(strstr(p_k->name, "_packed") != NULL)
+  {
+    WORD32 size = xa_nn_get_packed_weights_size_8(s->rows, s->cols);
+    if(size <= 0)
+      return -3;
+    b->p_prep = bench_alloc(size);
+    if(b->p_prep == NULL)
+      return -2;
+    if(p_k->precision == PREC_ASYM8U)
+      return xa_nn_pack_weights_asym8u((UWORD8 *)b->p_prep, (const UWORD8 *)b->p_wt, s->rows, s->cols,
+          s->cols, BENCH_ZERO_BIAS_U8) ? -3 : 0;
+    return xa_nn_pack_weights_8((WORD8 *)b->p_prep, (const WORD8 *)b->p_wt, s->rows, s->cols, s->cols) ? -3 : 0;
+  }
+  if(strstr(p_k->name, "_sparse_") != NULL)
+  {
+    WORD8 *p_wt = (WORD8 *)b->p_wt;
+    WORD32 format = strstr(p_k->name, "_2_4") != NULL ? XA_NNLIB_SPARSE_2_4 :
+                    strstr(p_k->name, "_1x4") != NULL ? XA_NNLIB_SPARSE_BLOCK_1X4 : XA_NNLIB_SPARSE_BLOCK_4X4;
+    int blk_rows = format == XA_NNLIB_SPARSE_BLOCK_4X4 ? 4 : 1;
+    WORD32 size;
+    long r, c;
+    for(r = 0; r < s->rows; r++)
+    {
+      for(c = 0; c < s->cols; c++)
+      {
+        int keep = format == XA_NNLIB_SPARSE_2_4 ? (c & 1) == 0 : ((c / 4 + r / blk_rows) & 3) == 0;
+        if(!keep)
+          p_wt[r * s->cols + c] = 0;
+      }
+    }
+    size = xa_nn_get_sparse_weights_size_8(p_wt, s->rows, s->cols, s->cols, format, XA_NNLIB_SPARSE_INDEX_BITMASK);
+    if(size <= 0)
+      return -3;
+    b->p_prep = bench_alloc(size);
+    if(b->p_prep == NULL)
+      return -2;
+    return xa_nn_pack_sparse_weights_8(b->p_prep, p_wt, s->rows, s->cols, s->cols, format,
+        XA_NNLIB_SPARSE_INDEX_BITMASK) ? -3 : 0;
+  }
+  if(strstr(p_k->name, "_winograd") != NULL)
+  {
+    WORD32 size, err;
+    if(xa_nn_conv2d_std_winograd_select(s->kh, s->kw, s->stride, s->stride, s->ic, s->oc, p_k->precision) != 1)
+      return -4;
+    size = xa_nn_conv2d_std_winograd_kernel_getsize(s->ic, s->oc, p_k->precision);
+    if(size <= 0)
+      return -3;
+    b->p_prep = bench_alloc(size);
+    if(b->p_prep == NULL)
+      return -2;
+    if(p_k->precision == PREC_F32)
+      err = xa_nn_conv2d_std_winograd_transform_kernel_f32(b->p_prep, (const FLOAT32 *)b->p_wt, s->ic, s->oc);
+    else if(p_k->precision == PREC_16)
+      err = xa_nn_conv2d_std_winograd_transform_kernel_16x16(b->p_prep, (const WORD16 *)b->p_wt, s->ic, s->oc);
+    else
+      err = xa_nn_conv2d_std_winograd_transform_kernel_sym8s(b->p_prep, (const WORD8 *)b->p_wt, s->ic, s->oc);
+    return err ? -3 : 0;
+  }
+  if(strstr(p_k->name, "_stream_") != NULL)
+  {
+    WORD32 size = xa_nn_conv1d_std_stream_getsize(s->kh, s->iw, s->ic, p_k->precision);
+    if(size <= 0)
+      return -3;
+    b->p_prep = bench_alloc(size);
+    if(b->p_prep == NULL)
+      return -2;
+    return xa_nn_conv1d_std_stream_init(b->p_prep, s->kh, s->iw, s->ic, s->stride, 0, p_k->precision) ? -3 : 0;
+  }
+  if(strstr(p_k->name, "_epilogue") != NULL)
+  {
+    b->p_prep = bench_alloc_data((long)s->rows * s->vecs, 1, p_k->precision);
+    return b->p_prep == NULL ? -2 : 0;
+  }
+  if(strstr(p_k->name, "_folded") != NULL)
+  {
+    b->p_prep = bench_alloc((size_t)s->rows * sizeof(WORD32));
+    if(b->p_prep == NULL)
+      return -2;
+    return xa_nn_fold_zero_bias_asym8uxasym8u((WORD32 *)b->p_prep, (const UWORD8 *)b->p_wt,
+        (const WORD32 *)b->p_bias, s->rows, s->cols, s->cols, BENCH_ZERO_BIAS_U8, BENCH_ZERO_BIAS_U8) ? -3 : 0;
+  }
+  return 0;
+}
+
+/* Returns 0 on success, -1 if the scratch size query failed, -2 on allocation failure,
+   -3 if the weight preparation failed, -4 if the kernel does not support the shape */
+static int bench_alloc_bufs(const bench_kernel_t *p_k, const bench_shape_t *s, bench_bufs_t *b)
+{
+  long n_inp, n_wt, n_bias, n_out, n_chan, i;
+  double macs;
+  WORD32 scratch_size;
+  /* 64-bit outputs also have room for any wider intermediate */
+  int out_bytes = p_k->out_bytes < 8 ? 8 : p_k->out_bytes;
+
+  memset(b, 0, sizeof(*b));
+  bench_counts(p_k, s, &n_inp, &n_wt, &n_bias, &n_out, &macs, &n_chan);
+
+  scratch_size = bench_scratch_size(p_k, s);
+  if(scratch_size < 0)
+    return -1;
+
+  b->p_inp = bench_alloc_data(n_inp, p_k->inp_bytes, p_k->precision);
+  b->p_wt = bench_alloc_data(n_wt, p_k->wt_bytes, p_k->precision);
+  b->p_bias = bench_alloc_data(n_bias, p_k->bias_bytes, p_k->bias_bytes == 4 && p_k->precision != PREC_F32 ? PREC_32 : p_k->precision);
+  b->p_out = bench_alloc((size_t)n_out * out_bytes);
+  if(scratch_size > 0)
+    b->p_scratch = bench_alloc(scratch_size);
+  if(b->p_inp == NULL || b->p_out == NULL || (n_wt && b->p_wt == NULL) || (n_bias && b->p_bias == NULL) ||
+     (scratch_size > 0 && b->p_scratch == NULL))
+    return -2;
+
+  if(p_k->bias_bytes == 4 && p_k->precision != PREC_F32)
+  {
+    /* int32 biases stay small so that requantization does not saturate */
+    for(i = 0; i < n_bias; i++)
+      ((WORD32 *)b->p_bias)[i] >>= 12;
+  }
+
+  if(p_k->family == FAMILY_MATMUL)
+  {
+    b->pp_inp = (void **)malloc(s->vecs * sizeof(void *));
+    b->pp_out = (void **)malloc(s->vecs * sizeof(void *));
+    if(b->pp_inp == NULL || b->pp_out == NULL)
+      return -2;
+    for(i = 0; i < s->vecs; i++)
+    {
+      b->pp_inp[i] = (char *)b->p_inp + i * s->cols * p_k->inp_bytes;
+      b->pp_out[i] = (char *)b->p_out + i * s->rows * p_k->out_bytes;
+    }
+  }
+
+  if(n_chan > 0)
+  {
+    b->p_out_multiplier = (WORD32 *)malloc(n_chan * sizeof(WORD32));
+    b->p_out_shift = (WORD32 *)malloc(n_chan * sizeof(WORD32));
+    if(b->p_out_multiplier == NULL || b->p_out_shift == NULL)
+      return -2;
+    for(i = 0; i < n_chan; i++)
+    {
+      b->p_out_multiplier[i] = BENCH_OUT_MULTIPLIER + (WORD32)(i << 16);
+      b->p_out_shift[i] = BENCH_OUT_SHIFT - (WORD32)(i & 3);
+    }
+  }
+  return bench_prepare_weights(p_k, s, b);
+}
+
+/*----------------------------------------------------------------------------*
+ * Measurement
+ *----------------------------------------------------------------------------*/
+static int compare_double(const void *a, const void *b)
+{
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/*
+ * One warm-up call sizes the batch so that each of the cfg->reps timed
+ * batches lasts about min_time_ms / reps; ns/call is the median batch.
+ */
+static void bench_measure(const bench_config_t *cfg, const bench_kernel_t *p_k, const bench_shape_t *s,
+    bench_bufs_t *b, bench_perf_t *p_perf, bench_result_t *r)
+{
+  double ns_per_rep[BENCH_MAX_REPS], ticks_per_rep[BENCH_MAX_REPS];
+  uint64_t counts[PERF_NUM_COUNTERS] = {0};
+  uint64_t t0, t1, c0, c1, target_ns;
+  long iters, it;
+  int rep, reps = cfg->reps;
+  WORD32 err;
+  long n_inp, n_wt, n_bias, n_out, n_chan;
+
+  memset(r, 0, sizeof(*r));
+  bench_counts(p_k, s, &n_inp, &n_wt, &n_bias, &n_out, &r->macs, &n_chan);
+  r->bytes = (double)n_inp * p_k->inp_bytes + (double)n_wt * p_k->wt_bytes +
+             (double)n_bias * p_k->bias_bytes + (double)n_out * p_k->out_bytes;
+
+  t0 = bench_ns();
+  err = p_k->run(b, s);
+  t1 = bench_ns();
+  if(err != 0)
+  {
+    r->status = "error";
+    return;
+  }
+
+  target_ns = (uint64_t)cfg->min_time_ms * 1000000u / reps;
+  iters = (long)(target_ns / (t1 - t0 + 1)) + 1;
+  if(iters > BENCH_MAX_ITERS)
+    iters = BENCH_MAX_ITERS;
+
+  for(rep = 0; rep < reps; rep++)
+  {
+    perf_start(p_perf);
+    c0 = bench_ticks();
+    t0 = bench_ns();
+    for(it = 0; it < iters; it++)
+      p_k->run(b, s);
+    t1 = bench_ns();
+    c1 = bench_ticks();
+    perf_stop(p_perf, counts);
+    ns_per_rep[rep] = (double)(t1 - t0) / iters;
+    ticks_per_rep[rep] = (double)(c1 - c0) / iters;
+  }
+  qsort(ns_per_rep, reps, sizeof(double), compare_double);
+  qsort(ticks_per_rep, reps, sizeof(double), compare_double);
+
+  r->status = "ok";
+  r->iters = iters;
+  r->reps = reps;
+  r->ns_per_call = ns_per_rep[reps / 2];
+  r->ticks_per_call = ticks_per_rep[reps / 2];
+  if(r->ns_per_call > 0)
+  {
+    r->gmacs_per_s = r->macs / r->ns_per_call;
+    r->gbytes_per_s = r->bytes / r->ns_per_call;
+  }
+  r->perf_valid = p_perf->valid;
+  if(p_perf->valid)
+  {
+    r->cycles_per_call = (double)counts[0] / ((double)iters * reps);
+    r->instructions_per_call = (double)counts[1] / ((double)iters * reps);
+    r->cache_misses_per_call = (double)counts[2] / ((double)iters * reps);
+  }
+  /* Core cycles when the counters are read, else ccount or TSC ticks */
+  if(r->perf_valid && r->cycles_per_call > 0)
+    r->macs_per_cycle = r->macs / r->cycles_per_call;
+  else if(r->ticks_per_call > 0)
+    r->macs_per_cycle = r->macs / r->ticks_per_call;
+}
+
+/*----------------------------------------------------------------------------*
+ * Reporting
+ *----------------------------------------------------------------------------*/
+static void report_header(FILE *fp_csv, FILE *fp_json, const bench_config_t *cfg, int perf_valid)
+{
+  const char *p_simd = getenv("XA_NNLIB_HOST_SIMD");
+  time_t now = time(NULL);
+  char stamp[32];
+
+  strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+  fprintf(stdout, "%-40s %-12s %-56s %12s %12s %10s %10s %10s %10s %8s\n",
+      "kernel", "family", "shape", "ns/call", "ticks/call", "GMAC/s", "bytes", "GB/s", "MAC/cycle", "vs ref");
+  if(fp_csv != NULL)
+    fprintf(fp_csv, "kernel,family,shape,status,iters,reps,ns_per_call,ticks_per_call,macs,gmacs_per_s,"
+        "bytes,gbytes_per_s,macs_per_cycle,ref,speedup,cycles_per_call,instructions_per_call,cache_misses_per_call\n");
+  if(fp_json != NULL)
+  {
+    fprintf(fp_json, "{\n  \"timestamp\": \"%s\",\n", stamp);
+    fprintf(fp_json, "  \"host_simd\": \"%s\",\n", p_simd != NULL ? p_simd : "auto");
+    fprintf(fp_json, "  \"min_time_ms\": %d,\n  \"reps\": %d,\n  \"workers\": %d,\n  \"perf_events\": %s,\n",
+        cfg->min_time_ms, cfg->reps, bench_workers.num_workers, perf_valid ? "true" : "false");
+    fprintf(fp_json, "  \"results\": [");
+  }
+}
+
+static void report_result(FILE *fp_csv, FILE *fp_json, int first, const bench_kernel_t *p_k,
+    const char *shape, const bench_result_t *r)
+{
+  char speedup[16];
+
+  if(r->speedup > 0)
+    sprintf(speedup, "%.2fx", r->speedup);
+  else
+    strcpy(speedup, "-");
+  if(strcmp(r->status, "ok") != 0)
+    fprintf(stdout, "%-40s %-12s %-56s %12s\n", p_k->name, family_names[p_k->family], shape, r->status);
+  else
+    fprintf(stdout, "%-40s %-12s %-56s %12.1f %12.1f %10.3f %10.0f %10.3f %10.3f %8s\n", p_k->name,
+        family_names[p_k->family], shape, r->ns_per_call, r->ticks_per_call, r->gmacs_per_s, r->bytes,
+        r->gbytes_per_s, r->macs_per_cycle, speedup);
+
+  if(fp_csv != NULL)
+  {
+    fprintf(fp_csv, "%s,%s,%s,%s,%ld,%d,%.2f,%.2f,%.0f,%.4f,%.0f,%.4f,%.4f,%s,", p_k->name, family_names[p_k->family],
+        shape, r->status, r->iters, r->reps, r->ns_per_call, r->ticks_per_call, r->macs, r->gmacs_per_s,
+        r->bytes, r->gbytes_per_s, r->macs_per_cycle, p_k->ref != NULL ? p_k->ref : "");
+    if(r->speedup > 0)
+      fprintf(fp_csv, "%.3f,", r->speedup);
+    else
+      fprintf(fp_csv, ",");
+    if(r->perf_valid)
+      fprintf(fp_csv, "%.1f,%.1f,%.2f\n", r->cycles_per_call, r->instructions_per_call, r->cache_misses_per_call);
+    else
+      fprintf(fp_csv, ",,\n");
+  }
+  if(fp_json != NULL)
+  {
+    fprintf(fp_json, "%s\n    {\"kernel\": \"%s\", \"family\": \"%s\", \"shape\": \"%s\", \"status\": \"%s\", "
+        "\"iters\": %ld, \"reps\": %d, \"ns_per_call\": %.2f, \"ticks_per_call\": %.2f, \"macs\": %.0f, "
+        "\"gmacs_per_s\": %.4f, \"bytes\": %.0f, \"gbytes_per_s\": %.4f, \"macs_per_cycle\": %.4f, ",
+        first ? "" : ",", p_k->name, family_names[p_k->family], shape, r->status, r->iters, r->reps,
+        r->ns_per_call, r->ticks_per_call, r->macs, r->gmacs_per_s, r->bytes, r->gbytes_per_s, r->macs_per_cycle);
+    if(p_k->ref != NULL && r->speedup > 0)
+      fprintf(fp_json, "\"ref\": \"%s\", \"speedup\": %.3f, ", p_k->ref, r->speedup);
+    else if(p_k->ref != NULL)
+      fprintf(fp_json, "\"ref\": \"%s\", \"speedup\": null, ", p_k->ref);
+    if(r->perf_valid)
+      fprintf(fp_json, "\"cycles_per_call\": %.1f, \"instructions_per_call\": %.1f, \"cache_misses_per_call\": %.2f}",
+          r->cycles_per_call, r->instructions_per_call, r->cache_misses_per_call);
+    else
+      fprintf(fp_json, "\"cycles_per_call\": null, \"instructions_per_call\": null, \"cache_misses_per_call\": null}");
+  }
+}
+
+static void report_footer(FILE *fp_json)
+{
+  if(fp_json != NULL)
+    fprintf(fp_json, "\n  ]\n}\n");
+}
+
+/*----------------------------------------------------------------------------*
+ * Driver
+ *----------------------------------------------------------------------------*/
+static int bench_find_kernel(const char *name)
+{
+  int k;
+  for(k = 0; k < NUM_BENCH_KERNELS; k++)
+    if(strcmp(bench_kernels[k].name, name) == 0)
+      return k;
+  return -1;
+}
+
+static int bench_selected(const bench_config_t *cfg, const bench_kernel_t *p_k)
+{
+  if(cfg->kernel_filter[0] != '\0' && strstr(p_k->name, cfg->kernel_filter) == NULL)
+    return 0;
+  if(cfg->family_filter[0] != '\0' && strcmp(family_names[p_k->family], cfg->family_filter) != 0)
+    return 0;
+  return 1;
+}
+
+/* Selected kernels run with the kernels they are compared against */
+static int bench_needed(const bench_config_t *cfg, int k)
+{
+  int j;
+  if(bench_selected(cfg, &bench_kernels[k]))
+    return 1;
+  for(j = k + 1; j < NUM_BENCH_KERNELS; j++)
+    if(bench_kernels[j].ref != NULL && strcmp(bench_kernels[j].ref, bench_kernels[k].name) == 0 &&
+       bench_selected(cfg, &bench_kernels[j]))
+      return 1;
+  return 0;
+}
+
+static void show_usage(void)
+{
+  printf("Usage xt-run <binary> [Options]\n");
+  printf("\t-kernel: run kernels whose name contains this string; Default=all\n");
+  printf("\t-family: matXvec, matmul, activation, elementwise, dot_prod, conv1d, conv2d, depthwise, pointwise or pool; Default=all\n");
+  printf("\t-min_time_ms: minimum measured time per kernel and shape; Default=20\n");
+  printf("\t-reps: number of timed batches, the median is reported; Default=5\n");
+  printf("\t-quick: one shape per family\n");
+  printf("\t-perf: read cycles, instructions and cache misses with perf_event (Linux host only)\n");
+  printf("\t-csv: write results to this CSV file\n");
+  printf("\t-json: write results to this JSON file\n");
+  printf("\t-workers: number of workers of the parallel kernels; Default=4\n");
+  printf("\t-list: print the kernels and exit\n");
+  printf("\t-h: help\n");
+}
+
+static void parse_arguments(int argc, char** argv, bench_config_t *p_cfg)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      printf("Invalid argument: %s\n",argv[argidx]);
+      show_usage();
+      exit(1);
+    }
+    ARGTYPE_STRING("-kernel",p_cfg->kernel_filter, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_STRING("-family",p_cfg->family_filter, MAX_FAMILY_NAME_LENGTH);
+    ARGTYPE_ONETIME_CONFIG("-min_time_ms",p_cfg->min_time_ms);
+    ARGTYPE_ONETIME_CONFIG("-reps",p_cfg->reps);
+    ARGTYPE_INDICATE("-quick",p_cfg->quick);
+    ARGTYPE_INDICATE("-perf",p_cfg->perf);
+    ARGTYPE_INDICATE("-list",p_cfg->list);
+    ARGTYPE_ONETIME_CONFIG("-workers",p_cfg->workers);
+    ARGTYPE_STRING("-csv",p_cfg->csv_file_name, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_STRING("-json",p_cfg->json_file_name, XA_MAX_CMD_LINE_LENGTH);
+    ARGTYPE_INDICATE("--help", p_cfg->help);
+    ARGTYPE_INDICATE("-help", p_cfg->help);
+    ARGTYPE_INDICATE("-h", p_cfg->help);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    show_usage();
+    exit(1);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  bench_config_t cfg;
+  bench_perf_t perf;
+  FILE *fp_csv = NULL, *fp_json = NULL;
+  int k, i, first = 1, num_errors = 0;
+  static double ns_per_call[NUM_BENCH_KERNELS][BENCH_MAX_SHAPES];
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.min_time_ms = 20;
+  cfg.reps = 5;
+  cfg.workers = 4;
+  parse_arguments(argc, argv, &cfg);
+  if(cfg.help)
+  {
+    show_usage();
+    return 0;
+  }
+  if(cfg.list)
+  {
+    for(k = 0; k < NUM_BENCH_KERNELS; k++)
+      printf("%-40s %s\n", bench_kernels[k].name, family_names[bench_kernels[k].family]);
+    return 0;
+  }
+  if(cfg.reps < 1) cfg.reps = 1;
+  if(cfg.reps > BENCH_MAX_REPS) cfg.reps = BENCH_MAX_REPS;
+  if(cfg.min_time_ms < 1) cfg.min_time_ms = 1;
+  xt_workers_init(&bench_workers, cfg.workers);
+
+  if(cfg.csv_file_name[0] != '\0' && (fp_csv = fopen(cfg.csv_file_name, "w")) == NULL)
+  {
+    printf("Cannot open %s\n", cfg.csv_file_name);
+    return 1;
+  }
+  if(cfg.json_file_name[0] != '\0' && (fp_json = fopen(cfg.json_file_name, "w")) == NULL)
+  {
+    printf("Cannot open %s\n", cfg.json_file_name);
+    return 1;
+  }
+
+  perf_open(&perf);
+  if(cfg.perf && !perf.valid)
+    printf("perf_event counters unavailable, reporting time only\n");
+  if(!cfg.perf)
+    perf_close(&perf);
+
+  report_header(fp_csv, fp_json, &cfg, perf.valid);
+
+  for(k = 0; k < NUM_BENCH_KERNELS; k++)
+  {
+    const bench_kernel_t *p_k = &bench_kernels[k];
+    int ref = p_k->ref != NULL ? bench_find_kernel(p_k->ref) : -1;
+    if(!bench_needed(&cfg, k))
+      continue;
+
+    for(i = 0; i < family_num_shapes[p_k->family]; i++)
+    {
+      bench_shape_t shape = family_shapes[p_k->family][i];
+      char shape_str[MAX_SHAPE_STRING_LENGTH];
+      bench_bufs_t bufs;
+      bench_result_t result;
+      int err;
+
+      if(cfg.quick && !shape.quick)
+        continue;
+      bench_shape_finalize(p_k, &shape);
+      bench_shape_string(p_k->family, &shape, shape_str);
+
+      err = bench_alloc_bufs(p_k, &shape, &bufs);
+      if(err != 0)
+      {
+        memset(&result, 0, sizeof(result));
+        result.status = err == -1 ? "getsize_error" : err == -3 ? "prepare_error" :
+                        err == -4 ? "unsupported" : "alloc_error";
+      }
+      else
+      {
+        bench_measure(&cfg, p_k, &shape, &bufs, &perf, &result);
+      }
+      if(strcmp(result.status, "ok") == 0)
+      {
+        ns_per_call[k][i] = result.ns_per_call;
+        if(ref >= 0 && ns_per_call[ref][i] > 0 && result.ns_per_call > 0)
+          result.speedup = ns_per_call[ref][i] / result.ns_per_call;
+      }
+      else if(strcmp(result.status, "unsupported") != 0)
+        num_errors++;
+      report_result(fp_csv, fp_json, first, p_k, shape_str, &result);
+      first = 0;
+      bench_free_bufs(&bufs);
+    }
+  }
+
+  report_footer(fp_json);
+  perf_close(&perf);
+  if(fp_csv != NULL)
+    fclose(fp_csv);
+  if(fp_json != NULL)
+    fclose(fp_json);
+
+  printf("\n%d kernel/shape combinations failed\n", num_errors);
+  return num_errors != 0;
+}
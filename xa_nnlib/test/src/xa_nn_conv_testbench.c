@@ -90,6 +90,12 @@ typedef struct _test_config_t
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_out_file_name[XA_MAX_CMD_LINE_LENGTH];
   int verify;
+  int stream_chunk;
+  int x_dilation;
+  int y_dilation;
+  int winograd;
+  int transpose;
+  int groups;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -134,6 +140,12 @@ int default_config(test_config_t *p_cfg)
     p_cfg->write_inp_file_name[0]='\0';
     p_cfg->write_out_file_name[0] = '\0';
     p_cfg->verify = 1;
+    p_cfg->stream_chunk = 0;
+    p_cfg->x_dilation = 1;
+    p_cfg->y_dilation = 1;
+    p_cfg->winograd = 0;
+    p_cfg->transpose = 0;
+    p_cfg->groups = 1;
 
     return 0;
   }
@@ -192,6 +204,12 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_out_file_name",p_cfg->write_out_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
+    ARGTYPE_ONETIME_CONFIG("-stream_chunk",p_cfg->stream_chunk);
+    ARGTYPE_ONETIME_CONFIG("-x_dilation",p_cfg->x_dilation);
+    ARGTYPE_ONETIME_CONFIG("-y_dilation",p_cfg->y_dilation);
+    ARGTYPE_ONETIME_CONFIG("-winograd",p_cfg->winograd);
+    ARGTYPE_ONETIME_CONFIG("-transpose",p_cfg->transpose);
+    ARGTYPE_ONETIME_CONFIG("-groups",p_cfg->groups);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -221,6 +239,7 @@ void show_usage(void)
     printf("\t-out_data_format: Output data format, 0 (DWH), 1 (WHD); Default=0 (DWH)\n");
     printf("\t-inp_precision: 8, 16, -1(single prec float), -3(Asymmetric 8-bit unsigned), -4(Asymmetric 8-bit signed); Default=16\n");
     printf("\t-kernel_precision: 8, 16, -1(single prec float), -3(Asymmetric 8-bit), -5(Symmetric 8-bit signed); Default=8\n");
+    printf("\t\t-kernel_precision -5 with -inp_precision 16 is the 16x8 conv2d_std (sym8sxasym16s, needs -input_zero_bias 0 -kernel_zero_bias 0); bias is widened to 64 bits and shifted by -bias_shift, the output is verified against a scalar reference\n");
     printf("\t-out_precision: 8, 16, -1(single prec float), -3(Asymmetric 8-bit), -4(Asymmetric 8-bit signed); Default=16\n");
     printf("\t-bias_precision: 8, 16, 32, -1(single prec float); Default=16\n");
     printf("\t-input_zero_bias: input zero zero bias for quantized 8-bit, -255 to 0 (for Asymmetric 8-bit unsigned), -127 to 128 (for Asymmetric 8-bit signed); Default=-128\n");
@@ -236,6 +255,15 @@ void show_usage(void)
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
+    printf("\t-stream_chunk: conv1d_std only, run the streaming conv1d feeding this many input rows per call and verify it against the batch conv1d_std; needs -out_data_format 0, -y_padding < kernel_height and out_height = (y_padding + input_height - kernel_height) / y_stride + 1; Default=0 (batch)\n");
+    printf("\t-x_dilation: dilation in width dimension, conv2d_std (f32, 8x16, 16x16, sym8sxasym8s, x_stride 1) and conv2d_depth (sym8sxasym8s, inp_data_format 0) only; Default=1\n");
+    printf("\t-y_dilation: dilation in height dimension, conv2d_std (f32, 8x16, 16x16, sym8sxasym8s, y_stride 1), conv1d_std and conv2d_depth (sym8sxasym8s, inp_data_format 0) only; Default=1\n");
+    printf("\t\tDilated kernels are verified against the undilated kernel run with the zero expanded kernel\n");
+    printf("\t-winograd: conv2d_std only, set to 1 to run the Winograd conv2d_std (f32, 16x16, sym8sxasym8s) when xa_nn_conv2d_std_winograd_select accepts the shape, verified against the direct conv2d_std; Default=0\n");
+    printf("\t-transpose: conv2d_std and conv1d_std (f32, 8x16, 16x16, sym8sxasym8s), set to 1 to run the transposed convolution of input_height x input_width into out_height x out_width with the strides and paddings; needs padding < kernel size; Default=0\n");
+    printf("\t\tTransposed kernels are verified against conv2d_std on the zero stuffed input with the flipped kernel\n");
+    printf("\t-groups: conv2d_std only (f32, 8x16, 16x16, sym8sxasym8s), number of channel groups of the grouped convolution, input_channels and out_channels must be multiples of it; the kernel has input_channels / groups channels; Default=1\n");
+    printf("\t\tGrouped kernels are verified against conv2d_std with the block diagonal kernel, bit exact for all but f32\n");
 }
 
 #define CONV_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
@@ -273,6 +301,72 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+/* Reference of the sym8sxasym16s conv2d_std: 64 bit sums and TFLite's int64
+   requantization, kernel rows of input_channels_pad */
+static void conv2d_std_sym16s_ref(WORD16 *p_out, const WORD16 *p_inp, const WORD8 *p_kernel, const WORD64 *p_bias,
+    int input_height, int input_width, int input_channels, int input_channels_pad,
+    int kernel_height, int kernel_width, int out_channels, int x_stride, int y_stride,
+    int x_padding, int y_padding, int out_height, int out_width,
+    const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, int out_zero_bias, int out_data_format)
+{
+  int oh, ow, oc, kh, kw, ic;
+  for(oh = 0; oh < out_height; oh++)
+  {
+    for(ow = 0; ow < out_width; ow++)
+    {
+      for(oc = 0; oc < out_channels; oc++)
+      {
+        WORD64 acc = p_bias[oc];
+        WORD64 reduced_mult = p_out_multiplier[oc] < 0x7FFF0000 ? ((p_out_multiplier[oc] + (1 << 15)) >> 16) : 0x7FFF;
+        int total_shift = 15 - p_out_shift[oc];
+        WORD64 out;
+        for(kh = 0; kh < kernel_height; kh++)
+        {
+          int y = oh * y_stride - y_padding + kh;
+          if(y < 0 || y >= input_height)
+            continue;
+          for(kw = 0; kw < kernel_width; kw++)
+          {
+            int x = ow * x_stride - x_padding + kw;
+            if(x < 0 || x >= input_width)
+              continue;
+            for(ic = 0; ic < input_channels; ic++)
+              acc += (WORD64)p_kernel[((oc * kernel_height + kh) * kernel_width + kw) * input_channels_pad + ic] *
+                p_inp[(y * input_width + x) * input_channels + ic];
+          }
+        }
+        out = ((acc * reduced_mult + ((WORD64)1 << (total_shift - 1))) >> total_shift) + out_zero_bias;
+        out = out > 32767 ? 32767 : out < -32768 ? -32768 : out;
+        if(out_data_format)
+          p_out[(oc * out_height + oh) * out_width + ow] = (WORD16)out;
+        else
+          p_out[(oh * out_width + ow) * out_channels + oc] = (WORD16)out;
+      }
+    }
+  }
+}
+
+#define CONV_KERNEL_SYM8SXASYM16S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    int itr_b;\
+    for(itr_b = 0; itr_b < cfg.out_channels; itr_b++)\
+      ((WORD64 *)p_bias64->p)[itr_b] = (WORD64)((WORD16 *)p_bias->p)[itr_b] << cfg.bias_shift;\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_sym8sxasym16s ( \
+        (WORD16 *)p_out->p, (WORD16 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD64 *)p_bias64->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(cfg.verify) \
+      conv2d_std_sym16s_ref((WORD16 *)p_ref->p, (WORD16 *)p_inp->p, (WORD8 *)p_kernel->p, (WORD64 *)p_bias64->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, input_channels_pad, \
+          cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.x_stride, cfg.y_stride, \
+          cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, cfg.out_data_format);\
+  }
+
 #define CONV1D_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -307,6 +401,252 @@ void show_usage(void)
     XTPWR_PROFILER_STOP(0);\
   }
 
+/* Streaming conv1d: the batch conv1d_std output is the reference. The input
+   is pushed stream_chunk rows per call; half way through, the state is
+   snapshotted into a second handle and streaming continues on the copy. */
+#define CONV1D_STREAM_LOOP(STREAM_CALL) \
+    WORD32 row = 0, rows, out_rows = 0, n_rows, copied = 0; \
+    void *p_handle = p_stream; \
+    err = xa_nn_conv1d_std_stream_init(p_stream, cfg.kernel_height, cfg.input_width, cfg.input_channels, \
+        cfg.y_stride, cfg.y_padding, cfg.inp_precision); \
+    XTPWR_PROFILER_START(0);\
+    while(!err && row < cfg.input_height) { \
+      rows = (cfg.input_height - row) < cfg.stream_chunk ? (cfg.input_height - row) : cfg.stream_chunk; \
+      if(!copied && 2*row >= cfg.input_height) { \
+        err = xa_nn_conv1d_std_stream_copy(p_stream_copy, p_stream); \
+        p_handle = p_stream_copy; \
+        copied = 1; \
+      } \
+      n_rows = STREAM_CALL; \
+      if(n_rows < 0) err = n_rows; else out_rows += n_rows; \
+      row += rows; \
+    } \
+    XTPWR_PROFILER_STOP(0);\
+    if(!err && out_rows != cfg.out_height) err = -1;
+
+#define CONV1D_STREAM_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv1d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    err = xa_nn_conv1d_std_##KPREC##x##IPREC ( \
+        (WORD##OPREC *)p_ref->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+        cfg.y_stride, cfg.y_padding, cfg.out_height, \
+        cfg.bias_shift, cfg.acc_shift, 0, p_scratch);\
+    if(!err) { \
+      CONV1D_STREAM_LOOP(xa_nn_conv1d_std_stream_##KPREC##x##IPREC(p_handle, \
+          (WORD##OPREC *)p_out->p + out_rows * cfg.out_channels, \
+          (WORD##IPREC *)p_inp->p + row * cfg.input_width * cfg.input_channels, \
+          (WORD##KPREC *)p_kernel->p, (WORD##BPREC *)p_bias->p, rows, cfg.out_channels, \
+          cfg.bias_shift, cfg.acc_shift)) \
+    } \
+  }
+
+#define CONV1D_STREAM_F_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv1d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    err = xa_nn_conv1d_std_f32 ( \
+        (FLOAT32 *)p_ref->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+        cfg.y_stride, cfg.y_padding, cfg.out_height, \
+        0, p_scratch);\
+    if(!err) { \
+      CONV1D_STREAM_LOOP(xa_nn_conv1d_std_stream_f32(p_handle, \
+          (FLOAT32 *)p_out->p + out_rows * cfg.out_channels, \
+          (FLOAT32 *)p_inp->p + row * cfg.input_width * cfg.input_channels, \
+          (FLOAT32 *)p_kernel->p, (FLOAT32 *)p_bias->p, rows, cfg.out_channels)) \
+    } \
+  }
+
+/* Zero expanded kernel of a dilated convolution, rows [outer][kernel_height][kernel_width]:
+   the undilated kernel run with it is the reference of the dilated one */
+static void expand_dilated_kernel(buf2D_t *p_dst, const buf2D_t *p_src,
+    int kernel_height, int kernel_width, int x_dilation, int y_dilation)
+{
+  int row_bytes = p_src->row_offset * p_src->bytes_per_element;
+  int kernel_height_eff = (kernel_height - 1) * y_dilation + 1;
+  int kernel_width_eff = (kernel_width - 1) * x_dilation + 1;
+  int outer = p_src->rows / (kernel_height * kernel_width);
+  int o, kh, kw;
+  memset(p_dst->p, 0, p_dst->rows * row_bytes);
+  for(o = 0; o < outer; o++)
+    for(kh = 0; kh < kernel_height; kh++)
+      for(kw = 0; kw < kernel_width; kw++)
+        memcpy((char *)p_dst->p + ((o * kernel_height_eff + kh * y_dilation) * kernel_width_eff + kw * x_dilation) * row_bytes,
+            (char *)p_src->p + ((o * kernel_height + kh) * kernel_width + kw) * row_bytes, row_bytes);
+}
+
+/* Zero stuffed input of a transposed convolution: input (iy, ix) at
+   (iy * y_stride, ix * x_stride), fill elsewhere */
+static void stuff_transpose_conv_input(buf1D_t *p_dst, const buf1D_t *p_src,
+    int input_height, int input_width, int channels, int x_stride, int y_stride, int fill)
+{
+  int row_bytes = channels * p_src->bytes_per_element;
+  int width_stuffed = (input_width - 1) * x_stride + 1;
+  int i, iy, ix;
+  for(i = 0; i < p_dst->length; i++)
+  {
+    switch(p_dst->bytes_per_element)
+    {
+      case 1: ((WORD8 *)p_dst->p)[i] = fill; break;
+      case 2: ((WORD16 *)p_dst->p)[i] = fill; break;
+      default: ((FLOAT32 *)p_dst->p)[i] = fill; break;
+    }
+  }
+  for(iy = 0; iy < input_height; iy++)
+    for(ix = 0; ix < input_width; ix++)
+      memcpy((char *)p_dst->p + (iy * y_stride * width_stuffed + ix * x_stride) * row_bytes,
+          (char *)p_src->p + (iy * input_width + ix) * row_bytes, row_bytes);
+}
+
+/* Spatially flipped kernel, rows [outer][kernel_height][kernel_width] */
+static void flip_transpose_conv_kernel(buf2D_t *p_dst, const buf2D_t *p_src,
+    int kernel_height, int kernel_width)
+{
+  int row_bytes = p_src->row_offset * p_src->bytes_per_element;
+  int outer = p_src->rows / (kernel_height * kernel_width);
+  int o, kh, kw;
+  for(o = 0; o < outer; o++)
+    for(kh = 0; kh < kernel_height; kh++)
+      for(kw = 0; kw < kernel_width; kw++)
+        memcpy((char *)p_dst->p + ((o * kernel_height + kernel_height - 1 - kh) * kernel_width + kernel_width - 1 - kw) * row_bytes,
+            (char *)p_src->p + ((o * kernel_height + kh) * kernel_width + kw) * row_bytes, row_bytes);
+}
+
+/* Block diagonal kernel of a grouped convolution: the rows of group g hold
+   its input_channels / groups taps at channel g * input_channels / groups */
+static void expand_grouped_conv_kernel(buf2D_t *p_dst, const buf2D_t *p_src, int groups)
+{
+  int rows_group = p_src->rows / groups;
+  int r;
+  memset(p_dst->p, 0, p_dst->rows * p_dst->row_offset * p_dst->bytes_per_element);
+  for(r = 0; r < p_src->rows; r++)
+    memcpy((char *)p_dst->p + (r * p_dst->row_offset + r / rows_group * p_src->cols) * p_dst->bytes_per_element,
+        (char *)p_src->p + r * p_src->row_offset * p_src->bytes_per_element, p_src->cols * p_src->bytes_per_element);
+}
+
+#define CONV1D_DILATED_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv1d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_dilated_conv1d_std_##KPREC##x##IPREC ( \
+        (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+        cfg.y_stride, cfg.y_padding, cfg.y_dilation, cfg.out_height, \
+        cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv1d_std_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_ref->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel_dil->p, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, kernel_height_dil, cfg.out_channels, \
+          cfg.y_stride, cfg.y_padding, cfg.out_height, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV1D_DILATED_F_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv1d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_dilated_conv1d_std_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+        cfg.y_stride, cfg.y_padding, cfg.y_dilation, cfg.out_height, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv1d_std_f32 ( \
+          (FLOAT32 *)p_ref->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel_dil->p, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, kernel_height_dil, cfg.out_channels, \
+          cfg.y_stride, cfg.y_padding, cfg.out_height, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV2D_DILATED_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv2d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_dilated_conv2d_std_##KPREC##x##IPREC ( \
+        (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.x_dilation, cfg.y_dilation, cfg.out_height, cfg.out_width, \
+        cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_ref->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel_dil->p, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, kernel_height_dil, kernel_width_dil, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV2D_DILATED_F_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv2d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_dilated_conv2d_std_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.x_dilation, cfg.y_dilation, cfg.out_height, cfg.out_width, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_f32 ( \
+          (FLOAT32 *)p_ref->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel_dil->p, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, kernel_height_dil, kernel_width_dil, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV2D_DILATED_SYM8S_PC_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv2d_std") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.x_dilation, cfg.y_dilation, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_ref->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel_dil->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, kernel_height_dil, kernel_width_dil, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV_DS_DILATED_SYM8_PC_FN(KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,"conv2d_depth") && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s ( \
+        (WORD8 *) p_dw_out->p, (const WORD8 *) p_kernel->p, (const WORD8 *) p_inp->p, (const WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.channels_multiplier, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.x_dilation, cfg.y_dilation, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.inp_data_format, 0 /* out_data_format always DWH*/, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    XTPWR_PROFILER_UPDATE(0); \
+    XTPWR_PROFILER_PRINT(0); \
+    if(!err) { \
+        XTPWR_PROFILER_START(1);\
+        err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s ( \
+            (WORD8 *) p_out->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_dw_out->p, (WORD32 *)p_bias_point->p, \
+            cfg.out_height, cfg.out_width, cfg.input_channels*cfg.channels_multiplier, cfg.out_channels, \
+            cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+            cfg.out_data_format); \
+        XTPWR_PROFILER_STOP(1);\
+        XTPWR_PROFILER_UPDATE(1); \
+        XTPWR_PROFILER_PRINT(1); \
+    } \
+    if(!err) \
+      err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_dw_ref->p, (const WORD8 *) p_kernel_dil->p, (const WORD8 *) p_inp->p, (const WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, kernel_height_dil, kernel_width_dil, cfg.channels_multiplier, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.inp_data_format, 0, p_scratch);\
+    if(!err) \
+      err = xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s ( \
+          (WORD8 *) p_ref->p, (WORD8 *) p_kernel_point->p, (WORD8 *) p_dw_ref->p, (WORD32 *)p_bias_point->p, \
+          cfg.out_height, cfg.out_width, cfg.input_channels*cfg.channels_multiplier, cfg.out_channels, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format); \
+  }
+
 #define CONV_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -416,6 +756,201 @@ void show_usage(void)
   }
 
 
+/* Winograd conv2d_std: the kernel transform runs once per frame outside the
+   profiler, the direct conv2d_std is the reference */
+#define CONV_WINOGRAD_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    err = xa_nn_conv2d_std_winograd_transform_kernel_##KPREC##x##IPREC ( \
+        p_kernel_wg, (WORD##KPREC *) p_kernel->p, cfg.input_channels, cfg.out_channels);\
+    XTPWR_PROFILER_START(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_winograd_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, p_kernel_wg, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_ref->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV_WINOGRAD_F_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    err = xa_nn_conv2d_std_winograd_transform_kernel_f32 ( \
+        p_kernel_wg, (FLOAT32 *) p_kernel->p, cfg.input_channels, cfg.out_channels);\
+    XTPWR_PROFILER_START(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_winograd_f32 ( \
+          (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, p_kernel_wg, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_f32 ( \
+          (FLOAT32 *)p_ref->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+#define CONV_WINOGRAD_SYM8S_PC_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    err = xa_nn_conv2d_std_winograd_transform_kernel_sym8s ( \
+        p_kernel_wg, (WORD8 *) p_kernel->p, cfg.input_channels, cfg.out_channels);\
+    XTPWR_PROFILER_START(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_winograd_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, p_kernel_wg, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_channels, \
+          cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_ref->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+/* Transposed conv2d / conv1d: the reference is conv2d_std of stride 1 on
+   the zero stuffed input with the flipped kernel, conv1d as a single column */
+#define TRANSPOSE_CONV_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    if(!strcmp(cfg.kernel_name,"conv2d_std")) \
+      err = xa_nn_transpose_conv2d_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+    else \
+      err = xa_nn_transpose_conv1d_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+          cfg.y_stride, cfg.y_padding, cfg.out_height, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_ref->p, (WORD##IPREC *) p_inp_tr->p, (WORD##KPREC *) p_kernel_tr->p, (WORD##BPREC *)p_bias->p, \
+          tr_input_height, tr_input_width, tr_channels, cfg.kernel_height, tr_kernel_width, cfg.out_channels, \
+          1, 1, tr_kernel_width - 1 - tr_x_padding, cfg.kernel_height - 1 - cfg.y_padding, cfg.out_height, tr_out_width, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+  }
+
+#define TRANSPOSE_CONV_F_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    if(!strcmp(cfg.kernel_name,"conv2d_std")) \
+      err = xa_nn_transpose_conv2d_f32 ( \
+          (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.out_data_format, p_scratch);\
+    else \
+      err = xa_nn_transpose_conv1d_f32 ( \
+          (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+          cfg.y_stride, cfg.y_padding, cfg.out_height, \
+          cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_f32 ( \
+          (FLOAT32 *)p_ref->p, (FLOAT32 *) p_inp_tr->p, (FLOAT32 *) p_kernel_tr->p, (FLOAT32 *)p_bias->p, \
+          tr_input_height, tr_input_width, tr_channels, cfg.kernel_height, tr_kernel_width, cfg.out_channels, \
+          1, 1, tr_kernel_width - 1 - tr_x_padding, cfg.kernel_height - 1 - cfg.y_padding, cfg.out_height, tr_out_width, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+#define TRANSPOSE_CONV_SYM8S_PC_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    if(!strcmp(cfg.kernel_name,"conv2d_std")) \
+      err = xa_nn_transpose_conv2d_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+    else \
+      err = xa_nn_transpose_conv1d_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, \
+          cfg.y_stride, cfg.y_padding, cfg.out_height, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_ref->p, (WORD8 *) p_inp_tr->p, (WORD8 *) p_kernel_tr->p, (WORD32 *)p_bias->p, \
+          tr_input_height, tr_input_width, tr_channels, cfg.kernel_height, tr_kernel_width, cfg.out_channels, \
+          1, 1, tr_kernel_width - 1 - tr_x_padding, cfg.kernel_height - 1 - cfg.y_padding, cfg.out_height, tr_out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+/* Grouped conv2d: the reference is conv2d_std with the block diagonal kernel */
+#define GROUPED_CONV_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_grouped_##KPREC##x##IPREC ( \
+        (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel->p, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.groups, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_##KPREC##x##IPREC ( \
+          (WORD##OPREC *)p_ref->p, (WORD##IPREC *) p_inp->p, (WORD##KPREC *) p_kernel_gr->p, (WORD##BPREC *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch);\
+  }
+
+#define GROUPED_CONV_F_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_grouped_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel->p, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.groups, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_f32 ( \
+          (FLOAT32 *)p_ref->p, (FLOAT32 *) p_inp->p, (FLOAT32 *) p_kernel_gr->p, (FLOAT32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.out_data_format, p_scratch);\
+  }
+
+#define GROUPED_CONV_SYM8S_PC_FN(KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_conv2d_grouped_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel->p, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.groups, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+    if(!err) \
+      err = xa_nn_conv2d_std_per_chan_sym8sxasym8s ( \
+          (WORD8 *)p_ref->p, (WORD8 *) p_inp->p, (WORD8 *) p_kernel_gr->p, (WORD32 *)p_bias->p, \
+          cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+          cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+          cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+          cfg.out_data_format, p_scratch);\
+  }
+
 #if HIFI_VFPU
 #define PROCESS_CONV \
     if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
@@ -423,6 +958,7 @@ void show_usage(void)
     else if CONV_KERNEL_FN(conv2d_std, 16, 16, 16, 16) \
     else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
     else if CONV_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
+    else if CONV_KERNEL_SYM8SXASYM16S_PC_FN(conv2d_std,-5,16,16, 64) \
     else if CONV_KERNEL_F_FN(conv2d_std, -1, -1, -1, -1) \
     else if CONV_DS_KERNEL_F_FN(conv2d_depth, -1, -1, -1, -1) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
@@ -436,6 +972,45 @@ void show_usage(void)
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
     else if CONV1D_KERNEL_F_FN(conv1d_std, -1, -1, -1, -1) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV1D_STREAM \
+    if CONV1D_STREAM_FN(8, 16, 16, 16) \
+    else if CONV1D_STREAM_FN(8, 8, 8, 8) \
+    else if CONV1D_STREAM_FN(16, 16, 16, 16) \
+    else if CONV1D_STREAM_F_FN(-1, -1, -1, -1) \
+    else {printf("[Error] [%s] streaming convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_DILATED \
+    if CONV1D_DILATED_FN(8, 16, 16, 16) \
+    else if CONV1D_DILATED_FN(8, 8, 8, 8) \
+    else if CONV1D_DILATED_FN(16, 16, 16, 16) \
+    else if CONV1D_DILATED_F_FN(-1, -1, -1, -1) \
+    else if CONV2D_DILATED_FN(8, 16, 16, 16) \
+    else if CONV2D_DILATED_FN(16, 16, 16, 16) \
+    else if CONV2D_DILATED_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else if CONV2D_DILATED_F_FN(-1, -1, -1, -1) \
+    else if CONV_DS_DILATED_SYM8_PC_FN(-5, -4, -4, 32) \
+    else {printf("[Error] [%s] dilated convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_WINOGRAD \
+    if CONV_WINOGRAD_FN(16, 16, 16, 16) \
+    else if CONV_WINOGRAD_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else if CONV_WINOGRAD_F_FN(-1, -1, -1, -1) \
+    else {printf("[Error] [%s] Winograd convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_TRANSPOSE \
+    if TRANSPOSE_CONV_FN(8, 16, 16, 16) \
+    else if TRANSPOSE_CONV_FN(16, 16, 16, 16) \
+    else if TRANSPOSE_CONV_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else if TRANSPOSE_CONV_F_FN(-1, -1, -1, -1) \
+    else {printf("[Error] [%s] transposed convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_GROUPED \
+    if GROUPED_CONV_FN(8, 16, 16, 16) \
+    else if GROUPED_CONV_FN(16, 16, 16, 16) \
+    else if GROUPED_CONV_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else if GROUPED_CONV_F_FN(-1, -1, -1, -1) \
+    else {printf("[Error] [%s] grouped convolution is not supported\n", cfg.kernel_name); return -1;}
 #else
 #define PROCESS_CONV \
     if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
@@ -443,6 +1018,7 @@ void show_usage(void)
     else if CONV_KERNEL_FN(conv2d_std, 16, 16, 16, 16) \
     else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
     else if CONV_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
+    else if CONV_KERNEL_SYM8SXASYM16S_PC_FN(conv2d_std,-5,16,16, 64) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
@@ -453,6 +1029,39 @@ void show_usage(void)
     else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV1D_STREAM \
+    if CONV1D_STREAM_FN(8, 16, 16, 16) \
+    else if CONV1D_STREAM_FN(8, 8, 8, 8) \
+    else if CONV1D_STREAM_FN(16, 16, 16, 16) \
+    else {printf("[Error] [%s] streaming convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_DILATED \
+    if CONV1D_DILATED_FN(8, 16, 16, 16) \
+    else if CONV1D_DILATED_FN(8, 8, 8, 8) \
+    else if CONV1D_DILATED_FN(16, 16, 16, 16) \
+    else if CONV2D_DILATED_FN(8, 16, 16, 16) \
+    else if CONV2D_DILATED_FN(16, 16, 16, 16) \
+    else if CONV2D_DILATED_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else if CONV_DS_DILATED_SYM8_PC_FN(-5, -4, -4, 32) \
+    else {printf("[Error] [%s] dilated convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_WINOGRAD \
+    if CONV_WINOGRAD_FN(16, 16, 16, 16) \
+    else if CONV_WINOGRAD_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else {printf("[Error] [%s] Winograd convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_TRANSPOSE \
+    if TRANSPOSE_CONV_FN(8, 16, 16, 16) \
+    else if TRANSPOSE_CONV_FN(16, 16, 16, 16) \
+    else if TRANSPOSE_CONV_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else {printf("[Error] [%s] transposed convolution is not supported\n", cfg.kernel_name); return -1;}
+
+#define PROCESS_CONV_GROUPED \
+    if GROUPED_CONV_FN(8, 16, 16, 16) \
+    else if GROUPED_CONV_FN(16, 16, 16, 16) \
+    else if GROUPED_CONV_SYM8S_PC_FN(-5, -4, -4, 32) \
+    else {printf("[Error] [%s] grouped convolution is not supported\n", cfg.kernel_name); return -1;}
 #endif
 
 int xa_nn_main_process(int argc, char *argv[])
@@ -465,6 +1074,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name_1[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_scratch;
+  void *p_stream = NULL, *p_stream_copy = NULL;
   int inp_size=0, kernel_size, out_size;
   int kernel_size_pad, input_channels_pad, kernel_width_pad;
   int kernel_channels, kernel_channels_pad;
@@ -482,6 +1092,19 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_dw_out;
   buf1D_t *p_out;
   buf1D_t *p_ref;
+  buf1D_t *p_bias64 = NULL;
+  buf2D_t *p_kernel_dil = NULL;
+  buf1D_t *p_dw_ref = NULL;
+  int sym16s = 0;
+  int dilated, kernel_height_dil, kernel_width_dil;
+  int winograd = 0;
+  void *p_kernel_wg = NULL;
+  buf1D_t *p_inp_tr = NULL;
+  buf2D_t *p_kernel_tr = NULL;
+  int tr_input_height = 0, tr_input_width = 0, tr_channels = 0;
+  int tr_kernel_width = 0, tr_x_padding = 0, tr_out_width = 0;
+  int grouped, input_channels_group, gr_input_channels_pad = 0;
+  buf2D_t *p_kernel_gr = NULL;
 
   FILE *fptr_inp;
   FILE *fptr_out;
@@ -503,27 +1126,85 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  dilated = (cfg.x_dilation != 1) || (cfg.y_dilation != 1);
+  kernel_height_dil = (cfg.kernel_height - 1) * cfg.y_dilation + 1;
+  kernel_width_dil = (cfg.kernel_width - 1) * cfg.x_dilation + 1;
+  if(dilated && (cfg.stream_chunk > 0 ||
+     (!strcmp(cfg.kernel_name,"conv1d_std") && cfg.x_dilation != 1) ||
+     (!strcmp(cfg.kernel_name,"conv2d_depth") && cfg.inp_data_format != 0)))
+  {
+    printf("[Error] [%s] dilation is supported by conv2d_std, conv1d_std (y_dilation) and NHWC conv2d_depth only\n", cfg.kernel_name);
+    return -1;
+  }
+  if(cfg.winograd && strcmp(cfg.kernel_name,"conv2d_std"))
+  {
+    printf("[Error] [%s] Winograd is supported by conv2d_std only\n", cfg.kernel_name);
+    return -1;
+  }
+  if(cfg.transpose && ((strcmp(cfg.kernel_name,"conv2d_std") && strcmp(cfg.kernel_name,"conv1d_std")) ||
+     cfg.stream_chunk > 0 || dilated || cfg.winograd))
+  {
+    printf("[Error] [%s] transposed convolution is supported by conv2d_std and conv1d_std only\n", cfg.kernel_name);
+    return -1;
+  }
+  /* The reference runs conv2d_std on the zero stuffed input, conv1d as a
+     single column of input_width * input_channels */
+  if(cfg.transpose)
+  {
+    int conv2d = !strcmp(cfg.kernel_name,"conv2d_std");
+    tr_input_height = (cfg.input_height - 1) * cfg.y_stride + 1;
+    tr_input_width = conv2d ? (cfg.input_width - 1) * cfg.x_stride + 1 : 1;
+    tr_channels = conv2d ? cfg.input_channels : cfg.input_width * cfg.input_channels;
+    tr_kernel_width = conv2d ? cfg.kernel_width : 1;
+    tr_x_padding = conv2d ? cfg.x_padding : 0;
+    tr_out_width = conv2d ? cfg.out_width : 1;
+    if(cfg.y_padding >= cfg.kernel_height || tr_x_padding >= tr_kernel_width)
+    {
+      printf("[Error] [%s] transposed convolution needs padding < kernel size\n", cfg.kernel_name);
+      return -1;
+    }
+  }
+  grouped = (cfg.groups != 1);
+  if(grouped && (strcmp(cfg.kernel_name,"conv2d_std") || dilated || cfg.winograd || cfg.transpose ||
+     cfg.groups <= 0 || cfg.input_channels % cfg.groups || cfg.out_channels % cfg.groups))
+  {
+    printf("[Error] [%s] grouped convolution is supported by conv2d_std only, with input_channels and out_channels multiples of groups\n", cfg.kernel_name);
+    return -1;
+  }
+  input_channels_group = grouped ? cfg.input_channels / cfg.groups : cfg.input_channels;
+  /* Shapes the fast path does not accept run the direct conv2d_std */
+  if(cfg.winograd)
+  {
+    winograd = xa_nn_conv2d_std_winograd_select(cfg.kernel_height, cfg.kernel_width, cfg.x_stride, cfg.y_stride,
+        cfg.input_channels, cfg.out_channels, cfg.inp_precision);
+  }
+
   if(!strcmp(cfg.kernel_name,"conv2d_std"))
   {
     inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
-    kernel_size = cfg.kernel_height * cfg.kernel_width * cfg.input_channels;
+    kernel_size = cfg.kernel_height * cfg.kernel_width * input_channels_group;
     if(cfg.inp_precision == -1)
     {
-      input_channels_pad = (cfg.input_channels + 2 - 1) & ~(2 - 1);
+      input_channels_pad = (input_channels_group + 2 - 1) & ~(2 - 1);
+      gr_input_channels_pad = (cfg.input_channels + 2 - 1) & ~(2 - 1);
     }
     else
     {
 #ifdef hifi5
       if(cfg.inp_precision == PREC_8 || cfg.inp_precision == PREC_ASYM8U)
-        input_channels_pad = cfg.input_channels;
+        input_channels_pad = gr_input_channels_pad = cfg.input_channels;
       else
 #endif
-      input_channels_pad = (cfg.input_channels + 4 - 1) & ~(4 - 1);
+      {
+        input_channels_pad = (input_channels_group + 4 - 1) & ~(4 - 1);
+        gr_input_channels_pad = (cfg.input_channels + 4 - 1) & ~(4 - 1);
+      }
     }
     kernel_size_pad = cfg.kernel_height * cfg.kernel_width * input_channels_pad;
     bias_size = cfg.out_channels;
     out_size = cfg.out_height * cfg.out_width * cfg.out_channels;
-    if(cfg.inp_precision == -4)
+    sym16s = (cfg.kernel_precision == -5) && (cfg.inp_precision == 16);
+    if(cfg.inp_precision == -4 || sym16s)
     {
       cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
       cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
@@ -596,12 +1277,50 @@ int xa_nn_main_process(int argc, char *argv[])
     kernel_size_pad = cfg.kernel_height * input_channelsXwidth_pad;
     bias_size = cfg.out_channels;
     out_size = cfg.out_height * cfg.out_channels;
+    if(cfg.inp_precision == -4)
+    {
+      cfg.p_out_multiplier = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      cfg.p_out_shift = (int *)malloc(cfg.out_channels*(sizeof(WORD32)));
+      int itr_c;
+      for(itr_c = 0; itr_c < cfg.out_channels; itr_c++)
+      {
+        cfg.p_out_multiplier[itr_c] = cfg.out_multiplier;
+        cfg.p_out_shift[itr_c] = cfg.out_shift;
+      }
+    }
+    if(cfg.stream_chunk > 0 &&
+       (cfg.out_data_format != 0 || cfg.y_padding >= cfg.kernel_height ||
+        cfg.out_height != (cfg.y_padding + cfg.input_height - cfg.kernel_height) / cfg.y_stride + 1))
+    {
+      printf("[Error] streaming conv1d_std needs out_data_format 0, y_padding < kernel_height and no bottom padding\n");
+      return -1;
+    }
   }
 
   // Set profiler name 
   if(cfg.kernel_name[0])
   {
     strcpy(profiler_name_0,cfg.kernel_name);
+    if(cfg.transpose)
+    {
+      strcpy(profiler_name_0, strcmp(cfg.kernel_name,"conv1d_std") ? "transpose_conv2d" : "transpose_conv1d");
+    }
+    if(cfg.stream_chunk > 0)
+    {
+      strcat(profiler_name_0,"_stream");
+    }
+    if(dilated)
+    {
+      strcat(profiler_name_0,"_dilated");
+    }
+    if(winograd)
+    {
+      strcat(profiler_name_0,"_winograd");
+    }
+    if(grouped)
+    {
+      strcat(profiler_name_0,"_grouped");
+    }
     if(!strcmp(cfg.kernel_name,"conv2d_depth"))
     {
       strcpy(profiler_name_1,"conv2d_point");
@@ -632,6 +1351,11 @@ int xa_nn_main_process(int argc, char *argv[])
       strcat(profiler_name_1, profiler_params);
     }
   }
+  else if(sym16s)
+  {
+    sprintf(profiler_params, "_sym8sxasym16s");
+    strcat(profiler_name_0, profiler_params);
+  }
   else if((cfg.kernel_precision == -5) || (cfg.inp_precision == -4))
   {
     sprintf(profiler_params, "_sym8sxasym8s");
@@ -657,12 +1381,28 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, out_channels=%d, out_height=%d", 
       cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.out_channels, cfg.out_height);
+    if(cfg.stream_chunk > 0)
+    {
+      sprintf(profiler_params + strlen(profiler_params), ", stream_chunk=%d", cfg.stream_chunk);
+    }
   }
   else
   {
     sprintf(profiler_params, "input_height=%d, input_width=%d, input_channels=%d, kernel_height=%d, kernel_width=%d, out_channels=%d, out_height=%d, out_width=%d", 
       cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.out_height, cfg.out_width);
   }
+  if(dilated && !strcmp(cfg.kernel_name,"conv1d_std"))
+  {
+    sprintf(profiler_params + strlen(profiler_params), ", y_dilation=%d", cfg.y_dilation);
+  }
+  else if(dilated)
+  {
+    sprintf(profiler_params + strlen(profiler_params), ", x_dilation=%d, y_dilation=%d", cfg.x_dilation, cfg.y_dilation);
+  }
+  if(grouped)
+  {
+    sprintf(profiler_params + strlen(profiler_params), ", groups=%d", cfg.groups);
+  }
 
 
   // Open input file
@@ -684,12 +1424,18 @@ int xa_nn_main_process(int argc, char *argv[])
   // Open output file
   fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
-  // Open reference file if verify flag is enabled
-  if(cfg.verify)
+  // Open reference file if verify flag is enabled; sym8sxasym16s is verified
+  // against a scalar reference, streaming conv1d against the batch kernel and
+  // dilated kernels against the undilated kernel with the expanded kernel and
+  // Winograd against the direct conv2d_std, transposed kernels against
+  // conv2d_std on the zero stuffed input and grouped kernels against
+  // conv2d_std with the block diagonal kernel
+  if(cfg.verify || cfg.stream_chunk > 0 || dilated || winograd || cfg.transpose || grouped)
   {
     p_ref = create_buf1D(out_size, cfg.out_precision); 
     
-    fptr_ref = file_open(pb_ref_file_path, cfg.read_ref_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
+    if(cfg.verify && !sym16s && cfg.stream_chunk <= 0 && !dilated && !winograd && !cfg.transpose && !grouped)
+      fptr_ref = file_open(pb_ref_file_path, cfg.read_ref_file_name, "rb", XA_MAX_CMD_LINE_LENGTH);
   }
 
   // Allocate Memory
@@ -697,17 +1443,43 @@ int xa_nn_main_process(int argc, char *argv[])
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
   if(!strcmp(cfg.kernel_name,"conv2d_std"))
   {
-    p_kernel = create_buf2D(cfg.out_channels * cfg.kernel_height * cfg.kernel_width, cfg.input_channels, input_channels_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
+    p_kernel = create_buf2D(cfg.out_channels * cfg.kernel_height * cfg.kernel_width, input_channels_group, input_channels_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
     p_bias = create_buf1D(bias_size, cfg.bias_precision);                            VALIDATE_PTR(p_bias);
+    if(grouped)
+    {
+      p_kernel_gr = create_buf2D(cfg.out_channels * cfg.kernel_height * cfg.kernel_width, cfg.input_channels, gr_input_channels_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel_gr);
+    }
+    if(sym16s)
+    {
+      p_bias64 = create_buf1D(bias_size, 64);                                        VALIDATE_PTR(p_bias64);
+    }
+    if(dilated)
+    {
+      p_kernel_dil = create_buf2D(cfg.out_channels * kernel_height_dil * kernel_width_dil, cfg.input_channels, input_channels_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel_dil);
+    }
+    if(cfg.transpose)
+    {
+      p_kernel_tr = create_buf2D(cfg.out_channels * cfg.kernel_height * cfg.kernel_width, cfg.input_channels, input_channels_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel_tr);
+    }
 
-    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params,
+        cfg.transpose ? cfg.input_height * cfg.input_width * cfg.out_channels * kernel_size : out_size * kernel_size, "MACs/cyc", 1);
   }
   else if(!strcmp(cfg.kernel_name,"conv1d_std"))
   {
     p_kernel = create_buf2D(cfg.out_channels * cfg.kernel_height, cfg.input_width * cfg.input_channels, input_channelsXwidth_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel);
     p_bias = create_buf1D(bias_size, cfg.bias_precision);                            VALIDATE_PTR(p_bias);
+    if(dilated)
+    {
+      p_kernel_dil = create_buf2D(cfg.out_channels * kernel_height_dil, cfg.input_width * cfg.input_channels, input_channelsXwidth_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel_dil);
+    }
+    if(cfg.transpose)
+    {
+      p_kernel_tr = create_buf2D(cfg.out_channels * cfg.kernel_height, cfg.input_width * cfg.input_channels, input_channelsXwidth_pad, cfg.kernel_precision, 0);    VALIDATE_PTR(p_kernel_tr);
+    }
 
-    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, out_size * kernel_size, "MACs/cyc", 1);
+    XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params,
+        cfg.transpose ? cfg.input_height * cfg.out_channels * kernel_size : out_size * kernel_size, "MACs/cyc", 1);
   }
   else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
@@ -723,6 +1495,11 @@ int xa_nn_main_process(int argc, char *argv[])
     p_kernel_point = create_buf1D(kernel_point_size, cfg.kernel_precision);    VALIDATE_PTR(p_kernel_point);
     p_dw_out = create_buf1D(dw_out_size, cfg.out_precision);                   VALIDATE_PTR(p_dw_out);
     p_bias_point = create_buf1D(bias_point_size, cfg.bias_precision);          VALIDATE_PTR(p_bias_point);
+    if(dilated)
+    {
+      p_kernel_dil = create_buf2D(kernel_height_dil * kernel_width_dil, kernel_channels, kernel_channels_pad, cfg.kernel_precision, 0);         VALIDATE_PTR(p_kernel_dil);
+      p_dw_ref = create_buf1D(dw_out_size, cfg.out_precision);                 VALIDATE_PTR(p_dw_ref);
+    }
 
     int total_conv2d_depth_MACS = (
        (cfg.channels_multiplier * cfg.input_channels * cfg.out_height * cfg.out_width * cfg.kernel_height * cfg.kernel_width) /* MACs in depthwise */
@@ -733,6 +1510,10 @@ int xa_nn_main_process(int argc, char *argv[])
     XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, total_conv2d_depth_MACS, "MACs/cyc", 1);
     XTPWR_PROFILER_OPEN(1, profiler_name_1, profiler_params, total_conv2d_point_MACS, "MACs/cyc", 1);
   }
+  if(cfg.transpose)
+  {
+    p_inp_tr = create_buf1D(tr_input_height * tr_input_width * tr_channels, cfg.inp_precision);    VALIDATE_PTR(p_inp_tr);
+  }
   
   // Init
   WORD32 scratch_size=0;
@@ -741,6 +1522,30 @@ int xa_nn_main_process(int argc, char *argv[])
   if(!strcmp(cfg.kernel_name,"conv2d_std"))
   {
     scratch_size = xa_nn_conv2d_std_getsize(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,cfg.y_stride,cfg.y_padding,cfg.out_height,cfg.inp_precision); PRINT_VAR(scratch_size)
+    if(grouped)
+    {
+      WORD32 grouped_size = xa_nn_conv2d_grouped_getsize(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,
+        cfg.groups,cfg.y_stride,cfg.y_padding,cfg.out_height,cfg.inp_precision); PRINT_VAR(grouped_size)
+      /* Scratch is shared with the reference */
+      scratch_size = scratch_size > grouped_size ? scratch_size : grouped_size;
+    }
+    if(dilated)
+    {
+      WORD32 dilated_size = xa_nn_dilated_conv2d_std_getsize(cfg.input_height,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,
+        cfg.y_stride,cfg.y_padding,cfg.y_dilation,cfg.out_height,cfg.inp_precision); PRINT_VAR(dilated_size)
+      /* Scratch is shared with the reference, which runs the expanded kernel */
+      scratch_size = xa_nn_conv2d_std_getsize(cfg.input_height,cfg.input_channels,kernel_height_dil,kernel_width_dil,
+        cfg.y_stride,cfg.y_padding,cfg.out_height,cfg.inp_precision);
+      scratch_size = scratch_size > dilated_size ? scratch_size : dilated_size;
+    }
+    if(winograd)
+    {
+      WORD32 winograd_size = xa_nn_conv2d_std_winograd_getsize(cfg.input_channels,cfg.out_channels,cfg.inp_precision); PRINT_VAR(winograd_size)
+      WORD32 kernel_wg_size = xa_nn_conv2d_std_winograd_kernel_getsize(cfg.input_channels,cfg.out_channels,cfg.inp_precision); PRINT_VAR(kernel_wg_size)
+      /* Scratch is shared with the reference */
+      scratch_size = scratch_size > winograd_size ? scratch_size : winograd_size;
+      p_kernel_wg = malloc(kernel_wg_size);                                        VALIDATE_PTR(p_kernel_wg);
+    }
   }
   else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
@@ -762,14 +1567,50 @@ int xa_nn_main_process(int argc, char *argv[])
        ,cfg.inp_data_format
       );
     PRINT_VAR(scratch_size)
+    if(dilated)
+    {
+      WORD32 dilated_size = xa_nn_dilated_conv2d_depthwise_getsize(cfg.input_height,cfg.input_width,cfg.input_channels,
+        cfg.kernel_height,cfg.kernel_width,cfg.channels_multiplier,cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,
+        cfg.x_dilation,cfg.y_dilation,cfg.out_height,cfg.out_width,cfg.inp_precision,cfg.inp_data_format); PRINT_VAR(dilated_size)
+      /* Scratch is shared with the reference, which runs the expanded kernel */
+      scratch_size = xa_nn_conv2d_depthwise_getsize(cfg.input_height,cfg.input_width,cfg.input_channels,
+        kernel_height_dil,kernel_width_dil,cfg.channels_multiplier,cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,
+        cfg.out_height,cfg.out_width,cfg.inp_precision,cfg.inp_data_format);
+      scratch_size = scratch_size > dilated_size ? scratch_size : dilated_size;
+    }
   }
   else if(!strcmp(cfg.kernel_name,"conv1d_std"))
   {
     scratch_size = xa_nn_conv1d_std_getsize(cfg.kernel_height,cfg.input_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(scratch_size)
+    if(dilated)
+    {
+      WORD32 dilated_size = xa_nn_dilated_conv1d_std_getsize(cfg.kernel_height,cfg.input_width,cfg.input_channels,cfg.y_dilation,cfg.inp_precision); PRINT_VAR(dilated_size)
+      scratch_size = xa_nn_conv1d_std_getsize(kernel_height_dil,cfg.input_width,cfg.input_channels,cfg.inp_precision);
+      scratch_size = scratch_size > dilated_size ? scratch_size : dilated_size;
+    }
+  }
+  if(cfg.transpose)
+  {
+    WORD32 transpose_size = !strcmp(cfg.kernel_name,"conv2d_std") ?
+      xa_nn_transpose_conv2d_getsize(cfg.input_height,cfg.input_width,cfg.input_channels,cfg.kernel_height,cfg.kernel_width,
+        cfg.out_channels,cfg.x_stride,cfg.y_stride,cfg.x_padding,cfg.y_padding,cfg.out_height,cfg.out_width,cfg.inp_precision) :
+      xa_nn_transpose_conv1d_getsize(cfg.input_height,cfg.input_width,cfg.input_channels,cfg.kernel_height,
+        cfg.out_channels,cfg.y_stride,cfg.y_padding,cfg.out_height,cfg.inp_precision); PRINT_VAR(transpose_size)
+    /* Scratch is shared with the reference */
+    scratch_size = xa_nn_conv2d_std_getsize(tr_input_height,tr_channels,cfg.kernel_height,tr_kernel_width,1,
+      cfg.kernel_height-1-cfg.y_padding,cfg.out_height,cfg.inp_precision);
+    scratch_size = scratch_size > transpose_size ? scratch_size : transpose_size;
   }
 
   p_scratch = (xa_nnlib_handle_t)malloc(scratch_size); PRINT_PTR(p_scratch)
 
+  if(cfg.stream_chunk > 0)
+  {
+    WORD32 stream_size = xa_nn_conv1d_std_stream_getsize(cfg.kernel_height,cfg.input_width,cfg.input_channels,cfg.inp_precision); PRINT_VAR(stream_size)
+    p_stream = malloc(stream_size);                                                VALIDATE_PTR(p_stream);
+    p_stream_copy = malloc(stream_size);                                           VALIDATE_PTR(p_stream_copy);
+  }
+
   fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
 
   // Frame processing loop
@@ -777,14 +1618,51 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     // If write_file enabled, generate random data for input, else read from file
     if(!strcmp(cfg.kernel_name,"conv2d_std"))
-      load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, input_channels_pad, -cfg.kernel_zero_bias);
+      load_conv2d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, input_channels_group, input_channels_pad, -cfg.kernel_zero_bias);
     else if(!strcmp(cfg.kernel_name,"conv2d_depth"))
       load_conv2d_ds_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, p_kernel_point, p_bias_point, -cfg.kernel_zero_bias);
     else if(!strcmp(cfg.kernel_name,"conv1d_std"))
       load_conv1d_std_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel, p_bias, cfg.input_channels, cfg.input_width, input_channelsXwidth_pad, -cfg.kernel_zero_bias);
 
+    if(dilated)
+      expand_dilated_kernel(p_kernel_dil, p_kernel, cfg.kernel_height,
+          strcmp(cfg.kernel_name,"conv1d_std") ? cfg.kernel_width : 1, cfg.x_dilation, cfg.y_dilation);
+
+    if(cfg.transpose)
+    {
+      stuff_transpose_conv_input(p_inp_tr, p_inp, cfg.input_height, tr_input_width == 1 ? 1 : cfg.input_width, tr_channels,
+          tr_input_width == 1 ? 1 : cfg.x_stride, cfg.y_stride, cfg.inp_precision == -4 ? -cfg.input_zero_bias : 0);
+      flip_transpose_conv_kernel(p_kernel_tr, p_kernel, cfg.kernel_height, tr_kernel_width);
+    }
+
+    if(grouped)
+      expand_grouped_conv_kernel(p_kernel_gr, p_kernel, cfg.groups);
+
     // Call the cnn kernel_name specified on command line
-    PROCESS_CONV;
+    if(cfg.stream_chunk > 0)
+    {
+      PROCESS_CONV1D_STREAM;
+    }
+    else if(dilated)
+    {
+      PROCESS_CONV_DILATED;
+    }
+    else if(winograd)
+    {
+      PROCESS_CONV_WINOGRAD;
+    }
+    else if(cfg.transpose)
+    {
+      PROCESS_CONV_TRANSPOSE;
+    }
+    else if(grouped)
+    {
+      PROCESS_CONV_GROUPED;
+    }
+    else
+    {
+      PROCESS_CONV;
+    }
     if(err)
     {
       fprintf(stdout, "\nKernel returned error (invalid parameters), Performance numbers may be incorrect!\n\n");
@@ -806,8 +1684,17 @@ int xa_nn_main_process(int argc, char *argv[])
     // If verify flag enabled, compare output against reference
     if(cfg.verify)
     {
-      read_buf1D_from_file(fptr_ref, p_ref);
-      pass_count += compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, kernel_size_pad);
+      if(!sym16s && cfg.stream_chunk <= 0 && !dilated && !winograd && !cfg.transpose && !grouped)
+        read_buf1D_from_file(fptr_ref, p_ref);
+      // Dilated depthwise also checks its own output, ahead of the pointwise
+      if(p_dw_ref && !compare_buf1D(p_dw_ref, p_dw_out, cfg.verify, cfg.out_precision, kernel_size_pad))
+        continue;
+      /* F(4x4,3x3) f32 rescales the sums in its transforms, its rounding
+         error grows with the transformed tile rather than the kernel size;
+         the grouped reference sums over all input channels */
+      pass_count += compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision,
+          (winograd && cfg.out_precision == -1) ? 16 * kernel_size_pad :
+          grouped ? cfg.kernel_height * cfg.kernel_width * gr_input_channels_pad : kernel_size_pad);
     }
     else
     {
@@ -835,19 +1722,44 @@ int xa_nn_main_process(int argc, char *argv[])
     free_buf1D(p_bias_point);
     free_buf1D(p_dw_out);
   }
-  if(cfg.inp_precision == -4)
+  if(cfg.inp_precision == -4 || sym16s)
   {
     free(cfg.p_out_multiplier);
     free(cfg.p_out_shift);
   }
+  if(sym16s)
+  {
+    free_buf1D(p_bias64);
+  }
+  if(dilated)
+  {
+    free_buf2D(p_kernel_dil);
+    if(p_dw_ref)
+      free_buf1D(p_dw_ref);
+  }
+
+  if(cfg.transpose)
+  {
+    free_buf1D(p_inp_tr);
+    free_buf2D(p_kernel_tr);
+  }
+
+  if(grouped)
+  {
+    free_buf2D(p_kernel_gr);
+  }
 
-  if(cfg.verify)
+  if(cfg.verify || cfg.stream_chunk > 0 || dilated || winograd || cfg.transpose || grouped)
   {
-    fclose(fptr_ref);
+    if(cfg.verify && !sym16s && cfg.stream_chunk <= 0 && !dilated && !winograd && !cfg.transpose && !grouped)
+      fclose(fptr_ref);
     free_buf1D(p_ref);
   }
 
   free(p_scratch);
+  free(p_kernel_wg);
+  free(p_stream);
+  free(p_stream_copy);
 
   return 0;
 }
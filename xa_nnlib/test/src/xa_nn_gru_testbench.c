@@ -109,6 +109,8 @@ const char *coef_files[9] =
   "/b_h.bin"
 };
 
+const char *quant_file = "/quant.bin";
+
 
 
 void show_usage(void)
@@ -118,8 +120,9 @@ void show_usage(void)
   printf("--out_feats:   \t Output length (Default=256)                  \t  Range: 4-2048 NOTE:-Output length must be multiple of 4\n");
   printf("--membank_padding:\t Memory bank padding (Default=1)           \t  Must be 0 or 1\n");
   printf("--mat_prec:    \t Coefficient precision (Default=16)                        \t  Must be 8 or 16\n");
-  printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 16\n");
+  printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 16, or 8 with mat_prec 8\n");
   printf("--verify:      \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--batch:       \t Number of streams (Default=1)                \t  Range: 1-8, every stream gets the same input\n");
   printf("--input_file:  \t File containing input shape\n");
   printf("--filter_path: \t Path where file containing filter are stored\n");
   printf("--output_file: \t File to which output will be written\n");
@@ -130,6 +133,7 @@ void show_usage(void)
      
 void *setup_weights_and_biases(xa_nnlib_gru_weights_t *weights,
                  xa_nnlib_gru_biases_t *biases,
+                 xa_nnlib_gru_biases32_t *biases32,
                  int in_feats, int out_feats, int pad_flag,
                  char *filter_path,
                  xa_nnlib_gru_precision_t precision)
@@ -274,10 +278,95 @@ void *setup_weights_and_biases(xa_nnlib_gru_weights_t *weights,
       return weights_and_biases;
       // If not, allocate memory (single allocation)
   }
+  else if(precision == XA_NNLIB_GRU_8bx8b)
+  {
+      coeff8_t *weights_and_biases, *ptr8;
+      Int32 *ptr;
+      size_t size, size_b;
+      char coef_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+      int pad = XA_PAD_BYTES*pad_flag;  //Width of mem bank for HiFi4/5
+
+      size   = 3 * (in_feats + pad) * out_feats;
+      size  += 3 * (out_feats + pad) * out_feats;
+      size_b = 3 * out_feats ;
+
+      CHECK_PTR_RETURN_NULL(weights, "Allocation for weights");
+      CHECK_PTR_RETURN_NULL(biases32, "Allocation for biases");
+  
+      ptr = malloc(size * sizeof(coeff8_t)+ size_b * sizeof(Int32));
+      weights_and_biases = (coeff8_t *)ptr;
+      CHECK_PTR_RETURN_NULL(ptr, "Allocation for weights_and_biases");
+  
+      biases32->b_z  = ptr; ptr += out_feats;
+      FILL_SHAPE_VECTOR(biases32->shape_b_z, out_feats)
+  
+      biases32->b_r  = ptr; ptr += out_feats;
+      FILL_SHAPE_VECTOR(biases32->shape_b_r, out_feats)
+  
+      biases32->b_h  = ptr; ptr += out_feats;
+      FILL_SHAPE_VECTOR(biases32->shape_b_h, out_feats)
+  
+      ptr8 = (coeff8_t*)ptr;
+
+      weights->weights8.w_z = ptr8; ptr8 += (in_feats + pad)  * out_feats;
+      FILL_SHAPE_MATRIX(weights->weights8.shape_w_z, out_feats, in_feats)
+  
+      weights->weights8.u_z = ptr8; ptr8 += (out_feats + pad) * out_feats;
+      FILL_SHAPE_MATRIX(weights->weights8.shape_u_z, out_feats, out_feats)
+  
+      weights->weights8.w_r = ptr8; ptr8 += (in_feats + pad)  * out_feats;
+      FILL_SHAPE_MATRIX(weights->weights8.shape_w_r, out_feats, in_feats)
+  
+      weights->weights8.u_r = ptr8; ptr8 += (out_feats + pad) * out_feats;
+      FILL_SHAPE_MATRIX(weights->weights8.shape_u_r, out_feats, out_feats)
+  
+      weights->weights8.w_h = ptr8; ptr8 += (in_feats + pad)  * out_feats;
+      FILL_SHAPE_MATRIX(weights->weights8.shape_w_h, out_feats, in_feats)
+  
+      weights->weights8.u_h = ptr8; ptr8 += (out_feats + pad) * out_feats;
+      FILL_SHAPE_MATRIX(weights->weights8.shape_u_h, out_feats, out_feats)
+
+      // Read from file
+      READ_FILE(coef_file_name, filter_path, coef_files[0], weights->weights8.w_z, 1, in_feats,  out_feats, pad, "Allocation for w_z")
+      READ_FILE(coef_file_name, filter_path, coef_files[1], weights->weights8.u_z, 1, out_feats, out_feats, pad, "Allocation for u_z")
+      READ_FILE(coef_file_name, filter_path, coef_files[2], weights->weights8.w_r, 1, in_feats,  out_feats, pad, "Allocation for w_r")
+      READ_FILE(coef_file_name, filter_path, coef_files[3], weights->weights8.u_r, 1, out_feats, out_feats, pad, "Allocation for u_r")
+      READ_FILE(coef_file_name, filter_path, coef_files[4], weights->weights8.w_h, 1, in_feats,  out_feats, pad, "Allocation for w_h")
+      READ_FILE(coef_file_name, filter_path, coef_files[5], weights->weights8.u_h, 1, out_feats, out_feats, pad, "Allocation for u_h")
+      READ_FILE(coef_file_name, filter_path, coef_files[6], biases32->b_z , 4,  out_feats, 1, 0     , "Allocation for b_z")
+      READ_FILE(coef_file_name, filter_path, coef_files[7], biases32->b_r , 4,  out_feats, 1, 0     , "Allocation for b_r")
+      READ_FILE(coef_file_name, filter_path, coef_files[8], biases32->b_h , 4,  out_feats, 1, 0     , "Allocation for b_h")
+
+      return weights_and_biases;
+  }
 
   return NULL;
 }
 
+/* Quantization parameters of XA_NNLIB_GRU_8bx8b, stored as the Int32
+   fields of xa_nnlib_gru_quant_params_t in order */
+int read_quant_params(xa_nnlib_gru_quant_params_t *quant, char *filter_path)
+{
+  char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  FILE *fptr;
+  int n_words = sizeof(xa_nnlib_gru_quant_params_t) / sizeof(Int32);
+
+  strcpy(file_name, filter_path);
+  strcat(file_name, quant_file);
+  fptr = fopen(file_name, "rb");
+  CHECK_PTR(fptr, "Opening the quantization parameters file");
+
+  if(fread(quant, sizeof(Int32), n_words, fptr) != (size_t)n_words)
+  {
+    printf("File %s has insufficent data\n", file_name);
+    fclose(fptr);
+    return -1;
+  }
+  fclose(fptr);
+
+  return 0;
+}
+
 #ifdef VERIFY
 #define ABS(A) (((A) < 0) ? -(A):(A))
 
@@ -312,6 +401,23 @@ int compare(vect_t *p_dut, vect_t *p_ref, int len)
 #endif
   return 0;
 }
+
+int compare_8(WORD8 *p_dut, WORD8 *p_ref, int len)
+{
+  int j, err, max_err = 0;
+
+  for(j=0;j<len;j++)
+  {
+    err = ABS(p_ref[j] - p_dut[j]);
+    if(err > max_err)
+    {
+      max_err = err;
+    }
+  }
+  printf("Max error found wrt the reference = %d\n", max_err);
+  if(max_err > INT16_MAX_ERR) return -1;
+  return 0;
+}
 #endif
 
 int default_config(xa_nnlib_gru_init_config_t *config, 
@@ -332,6 +438,7 @@ int default_config(xa_nnlib_gru_init_config_t *config,
     config->precision = XA_NNLIB_GRU_16bx16b;
     config->coeff_Qformat = 15;
     config->io_Qformat = 12;
+    config->batch = 1;
     *verify_flag=1;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
@@ -372,6 +479,7 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
+    ARGTYPE_ONETIME_CONFIG("--batch",config->batch);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
     ARGTYPE_STRING("--output_file", output_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
@@ -392,7 +500,7 @@ void parse_arguments(int argc, char** argv,
 
 int xa_nn_main_process(int argc, char *argv[])
 {
-  int i;
+  int i, b;
   int err=0;
   xa_nnlib_gru_init_config_t config;
   char profiler_name[MAX_PROFILER_NAME_LENGTH];
@@ -412,6 +520,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char prev_h_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
   int show_help = 0;
   int verify_pass = 1;
+  int io_size;
 #ifdef VERIFY
   FILE *output_ref_file;
   vect_t *output_ref;
@@ -464,6 +573,8 @@ int xa_nn_main_process(int argc, char *argv[])
         config.precision = XA_NNLIB_GRU_16bx16b;
     else if((config.mat_prec == 8)&&(config.vec_prec == 16))
         config.precision = XA_NNLIB_GRU_8bx16b;
+    else if((config.mat_prec == 8)&&(config.vec_prec == 8))
+        config.precision = XA_NNLIB_GRU_8bx8b;
     else
         return err;
         //#error "Unsupported precision\n"
@@ -472,6 +583,14 @@ int xa_nn_main_process(int argc, char *argv[])
   if(config.mat_prec == 8)
     config.coeff_Qformat = 7;
 
+  io_size = (config.precision == XA_NNLIB_GRU_8bx8b) ? sizeof(WORD8) : sizeof(vect_t);
+
+  if(config.batch < 1)
+  {
+    fprintf(stderr, "Invalid batch %d\n", config.batch);
+    return -1;
+  }
+
   fprintf(stdout, "Use Case:\nGRU_%dx%d: In Feats: %d, Out Feats: %d, Qformats- Weights and Biases: Q%d, Input and Output: Q%d\n",
           config.mat_prec, config.vec_prec, config.in_feats, config.out_feats, config.coeff_Qformat, config.io_Qformat);
   PRINT_STR("Init Loop ");
@@ -514,10 +633,12 @@ int xa_nn_main_process(int argc, char *argv[])
 #ifndef CONSTANT_WEIGHTS
     xa_nnlib_gru_weights_t weights;
     xa_nnlib_gru_biases_t biases;
+    xa_nnlib_gru_biases32_t biases32;
 
     p_weights_biases = setup_weights_and_biases(
         &weights, 
         &biases, 
+        &biases32, 
         config.in_feats,
         config.out_feats,
         config.pad,
@@ -530,7 +651,25 @@ int xa_nn_main_process(int argc, char *argv[])
 #endif
 
     xa_nnlib_gru_set_config(gru_handle, XA_NNLIB_GRU_WEIGHT, &weights);
-    xa_nnlib_gru_set_config(gru_handle, XA_NNLIB_GRU_BIAS,   &biases);
+    if(config.precision == XA_NNLIB_GRU_8bx8b)
+    {
+      xa_nnlib_gru_quant_params_t quant;
+
+      xa_nnlib_gru_set_config(gru_handle, XA_NNLIB_GRU_BIAS, &biases32);
+
+      if(read_quant_params(&quant, filter_path))
+        return -1;
+      err = xa_nnlib_gru_set_config(gru_handle, XA_NNLIB_GRU_QUANT_PARAMS, &quant);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Invalid quantization parameters, failed with error code: 0x%x \n", err);
+        return err;
+      }
+    }
+    else
+    {
+      xa_nnlib_gru_set_config(gru_handle, XA_NNLIB_GRU_BIAS,   &biases);
+    }
   }
 
 
@@ -543,16 +682,20 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
     FILE *prev_h_file;
-    vect_t *prev_h;
+    char *prev_h;
     strcpy(file_name, pb_prev_h_file_path);
     strcat(file_name, prev_h_file_name);
     prev_h_file=fopen(file_name, "rb");
     CHECK_PTR(prev_h_file, "Opening the context file");
 
-    prev_h = malloc(output_shape.dim.vector.length * sizeof(vect_t));
+    prev_h = malloc(config.batch * output_shape.dim.vector.length * io_size);
     CHECK_PTR(prev_h, "temporary Allocate memory for prev context");
 
-    fread(prev_h,sizeof(vect_t),output_shape.dim.vector.length,prev_h_file);
+    fread(prev_h,io_size,output_shape.dim.vector.length,prev_h_file);
+    for(b = 1; b < config.batch; b++)
+    {
+      memcpy(prev_h + b * output_shape.dim.vector.length * io_size, prev_h, output_shape.dim.vector.length * io_size);
+    }
 
     xa_nnlib_gru_set_config(gru_handle, XA_NNLIB_GRU_RESTORE_CONTEXT, prev_h);
 
@@ -575,11 +718,11 @@ int xa_nn_main_process(int argc, char *argv[])
     CHECK_PTR(output_file, "Allocation for output_file");
 
     /* Allocate input and output buffer */
-    input_buffer_size = input_shape.dim.vector.length * sizeof(vect_t);
+    input_buffer_size = config.batch * input_shape.dim.vector.length * io_size;
     p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
     CHECK_PTR(p_input, "Allocation for p_input");
 
-    output_buffer_size = output_shape.dim.vector.length * sizeof(vect_t);
+    output_buffer_size = config.batch * output_shape.dim.vector.length * io_size;
     p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
     CHECK_PTR(p_output, "Allocation for p_output");
 
@@ -593,7 +736,7 @@ int xa_nn_main_process(int argc, char *argv[])
       output_ref_file = fopen(file_name,"rb");
       CHECK_PTR(output_ref_file, "Allocation for output_ref_file");
 
-      output_ref = malloc(output_shape.dim.vector.length * sizeof(vect_t));
+      output_ref = malloc(output_shape.dim.vector.length * io_size);
       CHECK_PTR(output_ref, "Allocation for output_ref");
     }
   
@@ -612,8 +755,12 @@ int xa_nn_main_process(int argc, char *argv[])
  
     // Set profiler parameters
     sprintf(profiler_params, "in_feats=%d, out_feats=%d", config.in_feats, config.out_feats);
+    if(config.batch > 1)
+    {
+      sprintf(profiler_params + strlen(profiler_params), ", batch=%d", config.batch);
+    }
         
-    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, config.out_feats, NULL, 0);
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, config.batch * config.out_feats, NULL, 0);
 
     /* Execution Loop */
     PRINT_STR("GRU Process loop starts")
@@ -623,15 +770,25 @@ int xa_nn_main_process(int argc, char *argv[])
       xa_nnlib_shape_t input_length;  
       output_length.dim.vector.length = output_shape.dim.vector.length; 
       output_length.shape_type = output_shape.shape_type; 
+      output_length.n_shapes = config.batch;
+      output_length.shape_offset = -1;
       // Read input frame
-      input_length.dim.vector.length  = fread(p_input, sizeof(vect_t), input_shape.dim.vector.length, input_file);
+      input_length.dim.vector.length  = fread(p_input, io_size, input_shape.dim.vector.length, input_file);
       input_length.shape_type = input_shape.shape_type;
+      input_length.n_shapes = config.batch;
+      input_length.shape_offset = -1;
       
       if (input_length.dim.vector.length < input_shape.dim.vector.length) 
       { 
         printf("File end / partial frame \n");
         break;
       }
+
+      // Same frame on every stream
+      for(b = 1; b < config.batch; b++)
+      {
+        memcpy((char *)p_input + b * input_shape.dim.vector.length * io_size, p_input, input_shape.dim.vector.length * io_size);
+      }
       
       XTPWR_PROFILER_START(0);
       // Process
@@ -654,16 +811,29 @@ int xa_nn_main_process(int argc, char *argv[])
       PRINT_VAR(output_length.dim.vector.length);  
       
       // Write output frame
-      fwrite(p_output, sizeof(vect_t), output_length.dim.vector.length, output_file);
+      fwrite(p_output, io_size, output_length.dim.vector.length, output_file);
 
 #ifdef VERIFY
       {
         if(verify_flag)
         {
-          fread(output_ref,sizeof(vect_t),output_shape.dim.vector.length,output_ref_file);
-          if(XA_NNLIB_NO_ERROR != compare(p_output, output_ref, output_length.dim.vector.length))
+          fread(output_ref,io_size,output_shape.dim.vector.length,output_ref_file);
+          if(config.precision == XA_NNLIB_GRU_8bx8b)
           {
-            verify_pass = 0;
+            if(XA_NNLIB_NO_ERROR != compare_8((WORD8 *)p_output, (WORD8 *)output_ref, output_length.dim.vector.length))
+            {
+              verify_pass = 0;
+            }
+          }
+          else
+          {
+            for(b = 0; b < config.batch; b++)
+            {
+              if(XA_NNLIB_NO_ERROR != compare(p_output + b * output_length.dim.vector.length, output_ref, output_length.dim.vector.length))
+              {
+                verify_pass = 0;
+              }
+            }
           }
         }
       }
@@ -114,6 +114,8 @@ const char *coef_files[12] =
   "/b_o.bin"
 };
 
+const char *quant_file = "/quant.bin";
+
 
 
 void show_usage(void)
@@ -123,8 +125,11 @@ void show_usage(void)
   printf("--out_feats:   \t Output length (Default=256)                  \t  Range: 4-2048 NOTE:-Output length must be multiple of 4\n");
   printf("--membank_padding:\t Memory bank padding (Default=1)           \t  Must be 0 or 1\n");
   printf("--mat_prec:    \t Coefficient precision (Default=16)                        \t  Must be 8 or 16\n");
-  printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 16\n");
+  printf("--vec_prec:    \t Input precision (Default=16)                              \t  Must be 8 or 16, 8 needs mat_prec=8\n");
   printf("--verify:      \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--frames_per_call:\t Frames per process call (Default=1)      \t  >1 uses xa_nnlib_lstm_process_seq\n");
+  printf("--packed_weights:\t Use gate interleaved weights (Default=0)  \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--batch:       \t Number of streams (Default=1)                \t  Range: 1-8, every stream gets the same input\n");
   printf("--input_file:  \t File containing input shape\n");
   printf("--filter_path: \t Path where file containing filter are stored\n");
   printf("--output_file: \t File to which output will be written\n");
@@ -138,6 +143,7 @@ void show_usage(void)
 
 void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     xa_nnlib_lstm_biases_t *biases,
+    xa_nnlib_lstm_biases32_t *biases32,
     int in_feats, int out_feats, int pad_flag,
     char *filter_path,
     xa_nnlib_lstm_precision_t precision)
@@ -310,10 +316,108 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
     return weights_and_biases;
     // If not, allocate memory (single allocation)
   }
+  else if(precision == XA_NNLIB_LSTM_8bx8b)
+  {
+    coeff8_t *weights_and_biases, *ptr8;
+    Int32 *ptr;
+    size_t size, size_b;
+    char coef_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+    int pad = XA_PAD_BYTES*pad_flag;  //Width of mem bank for HiFi4/5
+
+    size   = 4 * (in_feats + pad) * out_feats;
+    size  += 4 * (out_feats + pad) * out_feats;
+    size_b = 4 * out_feats ;
+
+    CHECK_PTR_RETURN_NULL(weights, "Allocation for weights");
+    CHECK_PTR_RETURN_NULL(biases32, "Allocation for biases");
+
+    ptr = malloc(size * sizeof(coeff8_t)+ size_b * sizeof(Int32));
+    weights_and_biases = (coeff8_t *)ptr;
+    CHECK_PTR_RETURN_NULL(ptr, "Allocation for weights_and_biases");
+
+    biases32->b_f  = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(biases32->shape_b_f, out_feats);
+
+    biases32->b_i  = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(biases32->shape_b_i, out_feats);
+
+    biases32->b_c  = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(biases32->shape_b_c, out_feats);
+
+    biases32->b_o  = ptr; ptr += out_feats;
+    FILL_SHAPE_VECTOR(biases32->shape_b_o, out_feats);
+
+    ptr8 = (coeff8_t*)ptr;
+
+    weights->weights8.w_xf = ptr8; ptr8 += (in_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_xf, out_feats, in_feats);
+
+    weights->weights8.w_hf = ptr8; ptr8 += (out_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hf, out_feats, out_feats);
+
+    weights->weights8.w_xi = ptr8; ptr8 += (in_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_xi, out_feats, in_feats);
+
+    weights->weights8.w_hi = ptr8; ptr8 += (out_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hi, out_feats, out_feats);
+
+    weights->weights8.w_xc = ptr8; ptr8 += (in_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_xc, out_feats, in_feats);
+
+    weights->weights8.w_hc = ptr8; ptr8 += (out_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_hc, out_feats, out_feats);
+
+    weights->weights8.w_xo = ptr8; ptr8 += (in_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_xo, out_feats, in_feats);
+
+    weights->weights8.w_ho = ptr8; ptr8 += (out_feats + pad) * out_feats;
+    FILL_SHAPE_MATRIX(weights->weights8.shape_w_ho, out_feats, out_feats);
+
+    // Read from file
+    READ_FILE(coef_file_name, filter_path, coef_files[0] , weights->weights8.w_xf, 1, in_feats  , out_feats, pad, "Allocation for w_xf");
+    READ_FILE(coef_file_name, filter_path, coef_files[1] , weights->weights8.w_hf, 1, out_feats , out_feats, pad, "Allocation for w_hf");
+    READ_FILE(coef_file_name, filter_path, coef_files[2] , weights->weights8.w_xi, 1, in_feats  , out_feats, pad, "Allocation for w_xi");
+    READ_FILE(coef_file_name, filter_path, coef_files[3] , weights->weights8.w_hi, 1, out_feats , out_feats, pad, "Allocation for w_hi");
+    READ_FILE(coef_file_name, filter_path, coef_files[4] , weights->weights8.w_xc, 1, in_feats  , out_feats, pad, "Allocation for w_xc");
+    READ_FILE(coef_file_name, filter_path, coef_files[5] , weights->weights8.w_hc, 1, out_feats , out_feats, pad, "Allocation for w_hc");
+    READ_FILE(coef_file_name, filter_path, coef_files[6] , weights->weights8.w_xo, 1, in_feats  , out_feats, pad, "Allocation for w_xo");
+    READ_FILE(coef_file_name, filter_path, coef_files[7] , weights->weights8.w_ho, 1, out_feats , out_feats, pad, "Allocation for w_ho");
+
+    READ_FILE(coef_file_name, filter_path, coef_files[8] , biases32->b_f , 4,  out_feats, 1, 0     , "Allocation for b_f");
+    READ_FILE(coef_file_name, filter_path, coef_files[9] , biases32->b_i , 4,  out_feats, 1, 0     , "Allocation for b_i");
+    READ_FILE(coef_file_name, filter_path, coef_files[10], biases32->b_c , 4,  out_feats, 1, 0     , "Allocation for b_c");
+    READ_FILE(coef_file_name, filter_path, coef_files[11], biases32->b_o , 4,  out_feats, 1, 0     , "Allocation for b_o");
+
+    return weights_and_biases;
+  }
 
   return NULL;
 }
 
+/* Quantization parameters of XA_NNLIB_LSTM_8bx8b, stored as the Int32
+   fields of xa_nnlib_lstm_quant_params_t in order */
+int read_quant_params(xa_nnlib_lstm_quant_params_t *quant, char *filter_path)
+{
+  char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  FILE *fptr;
+  int n_words = sizeof(xa_nnlib_lstm_quant_params_t) / sizeof(Int32);
+
+  strcpy(file_name, filter_path);
+  strcat(file_name, quant_file);
+  fptr = fopen(file_name, "rb");
+  CHECK_PTR(fptr, "Opening the quantization parameters file");
+
+  if(fread(quant, sizeof(Int32), n_words, fptr) != (size_t)n_words)
+  {
+    printf("File %s has insufficent data\n", file_name);
+    fclose(fptr);
+    return -1;
+  }
+  fclose(fptr);
+
+  return 0;
+}
+
 #ifdef VERIFY
 #define ABS(A) (((A) < 0) ? -(A):(A))
 
@@ -348,6 +452,40 @@ int compare(vect_t *p_dut, vect_t *p_ref, int len)
 #endif
   return 0;
 }
+int compare_8(WORD8 *p_dut, WORD8 *p_ref, int len)
+{
+  int j, err, max_err = 0;
+
+  for(j=0;j<len;j++)
+  {
+    err = ABS(p_ref[j] - p_dut[j]);
+    if(err > max_err)
+    {
+      max_err = err;
+    }
+  }
+  printf("Max error found wrt the reference = %d\n", max_err);
+  if(max_err > INT16_MAX_ERR) return -1;
+  return 0;
+}
+
+int compare_cell_16(WORD16 *p_dut, WORD16 *p_ref, int len)
+{
+  int j, err, max_err = 0;
+
+  for(j=0;j<len;j++)
+  {
+    err = ABS(p_ref[j] - p_dut[j]);
+    if(err > max_err)
+    {
+      max_err = err;
+    }
+  }
+  printf("Max error found wrt the reference = %d\n", max_err);
+  if(max_err > INT16_MAX_ERR) return -1;
+  return 0;
+}
+
 int compare_cell(int *p_dut, int *p_ref, int len)
 {
 
@@ -383,6 +521,8 @@ int compare_cell(int *p_dut, int *p_ref, int len)
 
 int default_config(xa_nnlib_lstm_init_config_t *config, 
     int *verify_flag,
+    int *frames_per_call,
+    int *packed_weights,
     char *input_file_name, 
     char *filter_path, 
     char *output_file_name, 
@@ -403,7 +543,11 @@ int default_config(xa_nnlib_lstm_init_config_t *config,
     config->coeff_Qformat = 15;
     config->io_Qformat = 12;
     config->cell_Qformat = 25;
+    config->batch = 1;
+    config->max_seq_frames = 1;
     *verify_flag=1;
+    *frames_per_call=1;
+    *packed_weights=0;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
     output_file_name[0] = '\0';
@@ -424,6 +568,8 @@ void parse_arguments(int argc, char** argv,
     xa_nnlib_lstm_init_config_t *config, 
     int *show_help,
     int *verify_flag,
+    int *frames_per_call,
+    int *packed_weights,
     char *input_file_name, 
     char *filter_path, 
     char *output_file_name, 
@@ -449,6 +595,9 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
+    ARGTYPE_ONETIME_CONFIG("--frames_per_call",*frames_per_call);
+    ARGTYPE_ONETIME_CONFIG("--packed_weights",*packed_weights);
+    ARGTYPE_ONETIME_CONFIG("--batch",config->batch);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
     ARGTYPE_STRING("--output_file", output_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
@@ -472,7 +621,7 @@ void parse_arguments(int argc, char** argv,
 
 int xa_nn_main_process(int argc, char *argv[])
 {
-  int i;
+  int i, b;
   int err=0;
   xa_nnlib_lstm_init_config_t config;
   char profiler_name[MAX_PROFILER_NAME_LENGTH];
@@ -497,6 +646,10 @@ int xa_nn_main_process(int argc, char *argv[])
   char prev_c_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
   int show_help = 0;
   int verify_pass = 1;
+  int frames_per_call;
+  int packed_weights;
+  void *p_packed_weights = NULL;
+  int io_size, cell_size;
 #ifdef VERIFY
   FILE *output_ref_file;
   FILE *cell_ref_file;
@@ -510,6 +663,8 @@ int xa_nn_main_process(int argc, char *argv[])
   /* Set default configurations */
   if(default_config(&config,
         &verify_flag,
+        &frames_per_call,
+        &packed_weights,
         input_file_name, 
         filter_path, 
         output_file_name, 
@@ -538,6 +693,8 @@ int xa_nn_main_process(int argc, char *argv[])
         &config,
         &show_help,
         &verify_flag,
+        &frames_per_call,
+        &packed_weights,
         input_file_name, 
         filter_path, 
         output_file_name, 
@@ -553,11 +710,27 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  if(frames_per_call < 1)
+  {
+    fprintf(stderr, "Invalid frames_per_call %d\n", frames_per_call);
+    return -1;
+  }
+
+  config.max_seq_frames = frames_per_call;
+
+  if(config.batch < 1 || (config.batch > 1 && (frames_per_call > 1 || packed_weights)))
+  {
+    fprintf(stderr, "Invalid batch %d, batch > 1 needs frames_per_call=1 and packed_weights=0\n", config.batch);
+    return -1;
+  }
+
   /* Set precision as per command line */
   if((config.mat_prec == 16)&&(config.vec_prec == 16))
     config.precision = XA_NNLIB_LSTM_16bx16b;
   else if((config.mat_prec == 8)&&(config.vec_prec == 16))
     config.precision = XA_NNLIB_LSTM_8bx16b;
+  else if((config.mat_prec == 8)&&(config.vec_prec == 8))
+    config.precision = XA_NNLIB_LSTM_8bx8b;
   else
     return err;
   //#error "Unsupported precision\n"
@@ -566,6 +739,13 @@ int xa_nn_main_process(int argc, char *argv[])
   if(config.mat_prec == 8)
     config.coeff_Qformat = 7;
 
+  /* 8 bit I/O with 16 bit cell state in Q4.11 */
+  if(config.precision == XA_NNLIB_LSTM_8bx8b)
+    config.cell_Qformat = 11;
+
+  io_size = (config.precision == XA_NNLIB_LSTM_8bx8b) ? sizeof(WORD8) : sizeof(vect_t);
+  cell_size = (config.precision == XA_NNLIB_LSTM_8bx8b) ? sizeof(WORD16) : sizeof(int);
+
   fprintf(stdout, "Use Case:\nLSTM_%dx%d: In Feats: %d, Out Feats: %d, Qformats- Weights and Biases: Q%d, Input and Output: Q%d, Cell: Q%d\n",
       config.mat_prec, config.vec_prec, config.in_feats, config.out_feats, config.coeff_Qformat, config.io_Qformat, config.cell_Qformat);
   PRINT_STR("Init Loop ");
@@ -580,7 +760,11 @@ int xa_nn_main_process(int argc, char *argv[])
       fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", persistent_size);
       return persistent_size;
     }
-    scratch_size = xa_nnlib_lstm_get_scratch_fast(&config);   PRINT_VAR(scratch_size)
+    if(frames_per_call > 1)
+      scratch_size = xa_nnlib_lstm_get_scratch_seq_fast(&config);
+    else
+      scratch_size = xa_nnlib_lstm_get_scratch_fast(&config);
+    PRINT_VAR(scratch_size)
     if(scratch_size < 0)
     {
       fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", scratch_size);
@@ -608,10 +792,12 @@ int xa_nn_main_process(int argc, char *argv[])
 #ifndef CONSTANT_WEIGHTS
     xa_nnlib_lstm_weights_t weights;
     xa_nnlib_lstm_biases_t biases;
+    xa_nnlib_lstm_biases32_t biases32;
 
     p_weights_biases = setup_weights_and_biases(
         &weights, 
         &biases, 
+        &biases32, 
         config.in_feats,
         config.out_feats,
         config.pad,
@@ -624,7 +810,45 @@ int xa_nn_main_process(int argc, char *argv[])
 #endif
 
     xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_WEIGHT, &weights);
-    xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_BIAS,   &biases);
+    if(config.precision == XA_NNLIB_LSTM_8bx8b)
+    {
+      xa_nnlib_lstm_quant_params_t quant;
+
+      xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_BIAS, &biases32);
+
+      if(read_quant_params(&quant, filter_path))
+        return -1;
+      err = xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_QUANT_PARAMS, &quant);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Invalid quantization parameters, failed with error code: 0x%x \n", err);
+        return err;
+      }
+    }
+    else
+    {
+      xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_BIAS, &biases);
+    }
+
+    if(packed_weights)
+    {
+      int packed_size = xa_nnlib_lstm_get_packed_weights_size(&config);
+      if(packed_size < 0)
+      {
+        fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", packed_size);
+        return packed_size;
+      }
+      p_packed_weights = malloc(packed_size);
+      CHECK_PTR(p_packed_weights, "Allocation for p_packed_weights");
+
+      err = xa_nnlib_lstm_pack_weights(lstm_handle, p_packed_weights);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Weight packing failed with error code: 0x%x \n", err);
+        return err;
+      }
+      fprintf(stdout, "Packed weights size:   %8d bytes\n", packed_size);
+    }
   }
 
 
@@ -638,8 +862,8 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
     FILE *context_file;
-    vect_t *p_context;
-    int *p_context_c;
+    char *p_context;
+    char *p_context_c;
 
     // Restore prev_h
     strcpy(file_name, pb_context_file_path);
@@ -647,10 +871,14 @@ int xa_nn_main_process(int argc, char *argv[])
     context_file=fopen(file_name, "rb");
     CHECK_PTR(context_file, "Opening the context (prev output) file");
 
-    p_context = malloc(output_shape.dim.vector.length * sizeof(vect_t));
+    p_context = malloc(config.batch * output_shape.dim.vector.length * io_size);
     CHECK_PTR(p_context, "temporary Allocate memory for prev output context");
 
-    fread(p_context,sizeof(vect_t),output_shape.dim.vector.length,context_file);
+    fread(p_context,io_size,output_shape.dim.vector.length,context_file);
+    for(i = 1; i < config.batch; i++)
+    {
+      memcpy(p_context + i * output_shape.dim.vector.length * io_size, p_context, output_shape.dim.vector.length * io_size);
+    }
 
     xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_RESTORE_CONTEXT_OUTPUT, p_context);
 
@@ -663,10 +891,14 @@ int xa_nn_main_process(int argc, char *argv[])
     context_file=fopen(file_name, "rb");
     CHECK_PTR(context_file, "Opening the context (prev cell state) file");
 
-    p_context_c = malloc(cell_shape.dim.vector.length * sizeof(int));
+    p_context_c = malloc(config.batch * cell_shape.dim.vector.length * cell_size);
     CHECK_PTR(p_context_c, "temporary Allocate memory for prev cell state context");
 
-    fread(p_context_c,sizeof(int),cell_shape.dim.vector.length,context_file);
+    fread(p_context_c,cell_size,cell_shape.dim.vector.length,context_file);
+    for(i = 1; i < config.batch; i++)
+    {
+      memcpy(p_context_c + i * cell_shape.dim.vector.length * cell_size, p_context_c, cell_shape.dim.vector.length * cell_size);
+    }
 
     xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL, p_context_c);
 
@@ -694,15 +926,15 @@ int xa_nn_main_process(int argc, char *argv[])
     CHECK_PTR(output_cell_file, "Allocation for output_cell_file");
 
     /* Allocate input and output buffer */
-    input_buffer_size = input_shape.dim.vector.length * sizeof(vect_t);
+    input_buffer_size = frames_per_call * config.batch * input_shape.dim.vector.length * io_size;
     p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
     CHECK_PTR(p_input, "Allocation for p_input");
 
-    output_buffer_size = output_shape.dim.vector.length * sizeof(vect_t);
+    output_buffer_size = frames_per_call * config.batch * output_shape.dim.vector.length * io_size;
     p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
     CHECK_PTR(p_output, "Allocation for p_output");
 
-    output_cell_buffer_size = cell_shape.dim.vector.length * sizeof(int);
+    output_cell_buffer_size = config.batch * cell_shape.dim.vector.length * cell_size;
     p_cell_output = malloc(output_cell_buffer_size); PRINT_VAR(output_cell_buffer_size);
     CHECK_PTR(p_cell_output, "Allocation for p_cell_output");
 
@@ -716,7 +948,7 @@ int xa_nn_main_process(int argc, char *argv[])
       output_ref_file = fopen(file_name,"rb");
       CHECK_PTR(output_ref_file, "Allocation for output_ref_file");
 
-      output_ref = malloc(output_shape.dim.vector.length * sizeof(vect_t));
+      output_ref = malloc(frames_per_call * output_shape.dim.vector.length * io_size);
       CHECK_PTR(output_ref, "Allocation for output_ref");
 
       strcpy(file_name, pb_ref_file_path);
@@ -724,7 +956,7 @@ int xa_nn_main_process(int argc, char *argv[])
       cell_ref_file = fopen(file_name,"rb");
       CHECK_PTR(cell_ref_file, "Allocation for cell_ref_file");
 
-      cell_ref = malloc(cell_shape.dim.vector.length * sizeof(int));
+      cell_ref = malloc(cell_shape.dim.vector.length * cell_size);
       CHECK_PTR(cell_ref, "Allocation for cell_ref");
     }
 
@@ -743,38 +975,77 @@ int xa_nn_main_process(int argc, char *argv[])
 
     // Set profiler parameters
     sprintf(profiler_params, "in_feats=%d, out_feats=%d", config.in_feats, config.out_feats);
+    if(frames_per_call > 1)
+    {
+      sprintf(profiler_params + strlen(profiler_params), ", frames_per_call=%d", frames_per_call);
+    }
+    if(packed_weights)
+    {
+      sprintf(profiler_params + strlen(profiler_params), ", packed_weights=1");
+    }
+    if(config.batch > 1)
+    {
+      sprintf(profiler_params + strlen(profiler_params), ", batch=%d", config.batch);
+    }
 
-    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, config.out_feats, NULL, 0);
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, frames_per_call * config.batch * config.out_feats, NULL, 0);
 
     xa_nnlib_shape_t output_length;
     xa_nnlib_shape_t input_length;  
     
     /* Execution Loop */
     PRINT_STR("LSTM Process loop starts");
-    for(i = 0;i < N_FRAMES; i++)
+    for(i = 0;i < N_FRAMES; i += frames_per_call)
     {
+      int frames = (N_FRAMES - i < frames_per_call) ? (N_FRAMES - i) : frames_per_call;
+      int frames_read;
+
       output_length.dim.vector.length = output_shape.dim.vector.length; 
       output_length.shape_type = output_shape.shape_type; 
+      output_length.n_shapes = (config.batch > 1) ? config.batch : frames;
+      output_length.shape_offset = -1;
       
-      // Read input frame
-      input_length.dim.vector.length  = fread(p_input, sizeof(vect_t), input_shape.dim.vector.length, input_file);
+      // Read input frames
+      frames_read = fread(p_input, io_size * input_shape.dim.vector.length, frames, input_file);
+      input_length.dim.vector.length  = input_shape.dim.vector.length;
       input_length.shape_type = input_shape.shape_type;
+      input_length.n_shapes = (config.batch > 1) ? config.batch : frames;
+      input_length.shape_offset = -1;
 
-      if (input_length.dim.vector.length < input_shape.dim.vector.length) 
+      if (frames_read < frames) 
       { 
         printf("File end / partial frame \n");
         break;
       }
 
+      // Same frame on every stream
+      for(b = 1; b < config.batch; b++)
+      {
+        memcpy((char *)p_input + b * input_shape.dim.vector.length * io_size, p_input, input_shape.dim.vector.length * io_size);
+      }
+
       XTPWR_PROFILER_START(0);
       // Process
-      err = xa_nnlib_lstm_process(
-              lstm_handle, 
-              p_scratch, 
-              p_input, 
-              p_output, 
-              &input_length, 
-              &output_length);
+      if(frames_per_call > 1)
+      {
+        err = xa_nnlib_lstm_process_seq(
+                lstm_handle, 
+                p_scratch, 
+                p_input, 
+                p_output, 
+                &input_length, 
+                &output_length);
+      }
+      else
+      {
+        err = xa_nnlib_lstm_process(
+                lstm_handle, 
+                p_scratch, 
+                p_input, 
+                p_output, 
+                &input_length, 
+                &output_length);
+      }
       XTPWR_PROFILER_STOP(0);
 
       if(XA_NNLIB_NO_ERROR != err)
@@ -786,17 +1057,30 @@ int xa_nn_main_process(int argc, char *argv[])
       PRINT_VAR(input_length.dim.vector.length);
       PRINT_VAR(output_length.dim.vector.length);  
 
-      // Write output frame
-      fwrite(p_output, sizeof(vect_t), output_length.dim.vector.length, output_file);
+      // Write output frames
+      fwrite(p_output, io_size, frames * output_length.dim.vector.length, output_file);
 
 #ifdef VERIFY
       {
         if(verify_flag)
         {
-          fread(output_ref,sizeof(vect_t),output_shape.dim.vector.length,output_ref_file);
-          if(XA_NNLIB_NO_ERROR != compare(p_output, output_ref, output_length.dim.vector.length))
+          fread(output_ref,io_size,frames * output_shape.dim.vector.length,output_ref_file);
+          if(config.precision == XA_NNLIB_LSTM_8bx8b)
           {
-            verify_pass = 0;
+            if(XA_NNLIB_NO_ERROR != compare_8((WORD8 *)p_output, (WORD8 *)output_ref, frames * output_length.dim.vector.length))
+            {
+              verify_pass = 0;
+            }
+          }
+          else
+          {
+            for(b = 0; b < config.batch; b++)
+            {
+              if(XA_NNLIB_NO_ERROR != compare((vect_t *)p_output + b * output_length.dim.vector.length, output_ref, frames * output_length.dim.vector.length))
+              {
+                verify_pass = 0;
+              }
+            }
           }
         }
       }
@@ -810,16 +1094,29 @@ int xa_nn_main_process(int argc, char *argv[])
 
     // Write cell output
     xa_nnlib_lstm_get_config(lstm_handle, XA_NNLIB_LSTM_RESTORE_CONTEXT_CELL, p_cell_output);
-    fwrite(p_cell_output, sizeof(int), cell_shape.dim.vector.length, output_cell_file);
+    fwrite(p_cell_output, cell_size, cell_shape.dim.vector.length, output_cell_file);
 
 #ifdef VERIFY
     {
       if(verify_flag)
       {
-        fread(cell_ref,sizeof(int),cell_shape.dim.vector.length,cell_ref_file);
-        if(XA_NNLIB_NO_ERROR != compare_cell(p_cell_output, cell_ref, cell_shape.dim.vector.length))
+        fread(cell_ref,cell_size,cell_shape.dim.vector.length,cell_ref_file);
+        if(config.precision == XA_NNLIB_LSTM_8bx8b)
         {
-          verify_pass = 0;
+          if(XA_NNLIB_NO_ERROR != compare_cell_16((WORD16 *)p_cell_output, (WORD16 *)cell_ref, cell_shape.dim.vector.length))
+          {
+            verify_pass = 0;
+          }
+        }
+        else
+        {
+          for(b = 0; b < config.batch; b++)
+          {
+            if(XA_NNLIB_NO_ERROR != compare_cell((int *)p_cell_output + b * cell_shape.dim.vector.length, cell_ref, cell_shape.dim.vector.length))
+            {
+              verify_pass = 0;
+            }
+          }
         }
       }
     }
@@ -844,6 +1141,7 @@ int xa_nn_main_process(int argc, char *argv[])
     free(p_cell_output);
   }
 
+  free(p_packed_weights);
   free(p_scratch);
   free(lstm_handle);
 
@@ -30,6 +30,7 @@
 #include "xt_manage_buffers.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
+#include "xt_workers.h"
 
 #define PROF_ALLOCATE
 #include "xt_profiler.h"
@@ -55,6 +56,7 @@ typedef struct _test_config_t
   int row_stride1;
   int row_stride2;
   int vec_count;
+  int vec_offset;
   int acc_shift;
   int bias_shift;
   int mat_precision;
@@ -79,6 +81,24 @@ typedef struct _test_config_t
   int verify;
   int batch;
   int fc;
+  int packed;
+  int fold_bias;
+  int blocked;
+  int l1_size;
+  int l2_size;
+  int sparse;
+  int sparse_format;
+  int sparse_index;
+  int sym4s;
+  int workers;
+  int split;
+  int epilogue;
+  int epilogue_act;
+  int residual;
+  int transposed;
+  int batch_count;
+  int batch_chan;
+  int sym16s;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -93,6 +113,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->row_stride1    = 32;
     p_cfg->row_stride2    = 32;
     p_cfg->vec_count = 1;
+    p_cfg->vec_offset = 0;
     p_cfg->acc_shift = 0;
     p_cfg->bias_shift = 0;
     p_cfg->mat_precision   = 16;
@@ -117,6 +138,24 @@ int default_config(test_config_t *p_cfg)
     p_cfg->verify = 1;
     p_cfg->batch = 0;
     p_cfg->fc = 0;
+    p_cfg->packed = 0;
+    p_cfg->fold_bias = 0;
+    p_cfg->blocked = 0;
+    p_cfg->l1_size = 0;
+    p_cfg->l2_size = 0;
+    p_cfg->sparse = 0;
+    p_cfg->sparse_format = XA_NNLIB_SPARSE_2_4;
+    p_cfg->sparse_index = XA_NNLIB_SPARSE_INDEX_BITMASK;
+    p_cfg->sym4s = 0;
+    p_cfg->workers = 0;
+    p_cfg->split = XA_NNLIB_SPLIT_ROWS;
+    p_cfg->epilogue = 0;
+    p_cfg->epilogue_act = XA_NNLIB_ACT_NONE;
+    p_cfg->residual = 0;
+    p_cfg->transposed = 0;
+    p_cfg->batch_count = 0;
+    p_cfg->batch_chan = 0;
+    p_cfg->sym16s = 0;
 
     return 0;
   }
@@ -147,6 +186,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-row_stride1",p_cfg->row_stride1);
     ARGTYPE_ONETIME_CONFIG("-row_stride2",p_cfg->row_stride2);
     ARGTYPE_ONETIME_CONFIG("-vec_count",p_cfg->vec_count);
+    ARGTYPE_ONETIME_CONFIG("-vec_offset",p_cfg->vec_offset);
     ARGTYPE_ONETIME_CONFIG("-acc_shift",p_cfg->acc_shift);
     ARGTYPE_ONETIME_CONFIG("-bias_shift",p_cfg->bias_shift);
     ARGTYPE_ONETIME_CONFIG("-mat_precision",p_cfg->mat_precision);
@@ -171,6 +211,24 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-batch",p_cfg->batch);
     ARGTYPE_ONETIME_CONFIG("-fc",p_cfg->fc);
+    ARGTYPE_ONETIME_CONFIG("-packed",p_cfg->packed);
+    ARGTYPE_ONETIME_CONFIG("-fold_bias",p_cfg->fold_bias);
+    ARGTYPE_ONETIME_CONFIG("-blocked",p_cfg->blocked);
+    ARGTYPE_ONETIME_CONFIG("-l1_size",p_cfg->l1_size);
+    ARGTYPE_ONETIME_CONFIG("-l2_size",p_cfg->l2_size);
+    ARGTYPE_ONETIME_CONFIG("-sparse",p_cfg->sparse);
+    ARGTYPE_ONETIME_CONFIG("-sparse_format",p_cfg->sparse_format);
+    ARGTYPE_ONETIME_CONFIG("-sparse_index",p_cfg->sparse_index);
+    ARGTYPE_ONETIME_CONFIG("-sym4s",p_cfg->sym4s);
+    ARGTYPE_ONETIME_CONFIG("-workers",p_cfg->workers);
+    ARGTYPE_ONETIME_CONFIG("-split",p_cfg->split);
+    ARGTYPE_ONETIME_CONFIG("-epilogue",p_cfg->epilogue);
+    ARGTYPE_ONETIME_CONFIG("-epilogue_act",p_cfg->epilogue_act);
+    ARGTYPE_ONETIME_CONFIG("-residual",p_cfg->residual);
+    ARGTYPE_ONETIME_CONFIG("-transposed",p_cfg->transposed);
+    ARGTYPE_ONETIME_CONFIG("-batch_count",p_cfg->batch_count);
+    ARGTYPE_ONETIME_CONFIG("-batch_chan",p_cfg->batch_chan);
+    ARGTYPE_ONETIME_CONFIG("-sym16s",p_cfg->sym16s);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -187,8 +245,9 @@ void show_usage(void)
     printf("\t-row_stride1 : row stride for mat1; Default=32\n");
     printf("\t-row_stride2 : row stride for mat2; Default=32\n");
     printf("\t-vec_count : vec count for time batching; Default=1\n");
+    printf("\t-vec_offset : distance between the vectors of the per channel sym8sxasym8s matmul; Default=cols1\n");
     printf("\t-acc_shift : Accumulator left shift; Default=0\n");
-    printf("\t-bias_shift : Bias left shift; Default=0\n");
+    printf("\t-bias_shift : Bias left shift, a negative value right shifts the sym8sxasym8s bias; Default=0\n");
     printf("\t-mat_precision : 8, 16 or -1(single prec float); Default=16\n");
     printf("\t-inp_precision : 8, 16 or -1(single prec float); Default=16\n");
     printf("\t-out_precision : 8, 16, 32, 64 or -1(single prec float); Default=16\n");
@@ -211,6 +270,242 @@ void show_usage(void)
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
     printf("\t-batch: Flag to check time batching; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-fc: Flag for fully connected; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-packed: Flag for the kernels on pre-packed mat1 (8x8_8, sym8sxasym8s, asym8 matmul); output is verified against the unpacked kernel; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-fold_bias: Flag for the asym8 kernels on a bias with the zero bias terms folded in (matXvec for vec_count 1, else matmul); output is verified against the asym8 matmul; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-blocked: Flag for the cache-blocked matmul kernels (8x8_8, per channel sym8sxasym8s with per row multipliers and shifts around out_multiplier/out_shift); output is verified against the unblocked kernel; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-l1_size, -l2_size: Cache descriptor in bytes used to pick the blocks of -blocked; 0: library default; Default=0\n");
+    printf("\t-sparse: Flag for the sym8sxasym8s matXvec (or fully connected with -fc 1) on structured-sparse mat1; mat1 is pruned to the format and the output is verified against the dense kernel on the pruned matrix; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-sparse_format: 0: 2:4, 1: 1x4 blocks, 2: 4x4 blocks; Default=0\n");
+    printf("\t-sparse_index: Block index of -sparse_format 1 and 2; 0: bitmask, 1: CSR; Default=0\n");
+    printf("\t-sym4s: Flag for the sym4sxasym8s kernels: matXvec (both matrices), per channel matmul with -vec_count > 1 or per channel fully connected with -fc 1; mat1/mat2 are reduced to 4 bits, packed and the output is verified against the sym8sxasym8s kernel on the reduced weights; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-workers: Number of workers of the parallel sym8sxasym8s kernels: matXvec (mat1 only) or per channel matmul with -vec_count > 1; the output is verified against the single-core kernel; 0: Disable; Default=0\n");
+    printf("\t-split: Partition of -workers; 0: rows, 1: columns (split K); Default=0\n");
+    printf("\t-epilogue: Flag for the sym8sxasym8s kernels with a fused epilogue: matXvec (mat1 only) or per channel matmul with -vec_count > 1; the output is verified against the unfused kernel followed by the activation and xa_nn_elm_add_asym8sxasym8s_asym8s; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-epilogue_act: Activation of -epilogue; 0: none, 1: relu, 2: clamp to [out_zero_bias - 16, out_zero_bias + 48]; Default=0\n");
+    printf("\t-residual: Residual add of -epilogue; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-transposed: Flag for the transposed-weight 16x16, 8x16 and sym8sxasym8s kernels: matXvec (mat1 only) or matmul (per channel for sym8sxasym8s) with -vec_count > 1; the output is verified against the base kernel on the untransposed mat1; 0: Disable, 1: mat1 stored transposed (_t, _tn), 2: mat1 * mat2^T (_nt, needs -vec_count > 1); Default=0\n");
+    printf("\t-batch_count: Number of products of the strided batched matmul (per channel sym8sxasym8s and 16x16); the output is verified against the base kernel per batch; 0: Disable; Default=0\n");
+    printf("\t-batch_chan: Per channel parameters of -batch_count; 0: Shared by all batches, 1: One set per batch; Default=0\n");
+    printf("\t-sym16s: Flag for the sym8sxasym16s (16x8) kernels: per channel matmul or per channel fully connected with -fc 1, needs -mat_precision -5 -inp_precision 16 -out_precision 16; bias is widened to 64 bits and shifted by -bias_shift, the output is verified against a scalar reference; 0: Disable, 1: Enable; Default=0\n");
+}
+
+/* Kernels verified against the reference files; the other variants are
+   checked against the base kernel (or a scalar reference) on the same data */
+static int is_base_variant(const test_config_t *p_cfg)
+{
+  return p_cfg->packed == 0 && p_cfg->fold_bias == 0 && p_cfg->blocked == 0 &&
+         p_cfg->sparse == 0 && p_cfg->sym4s == 0 && p_cfg->workers == 0 &&
+         p_cfg->epilogue == 0 && p_cfg->transposed == 0 && p_cfg->batch_count == 0 &&
+         p_cfg->sym16s == 0;
+}
+
+/* Kernels profiled over vec_count vectors of cols1 */
+static int is_matmul_variant(const test_config_t *p_cfg)
+{
+  return p_cfg->batch == 1 || p_cfg->packed == 1 || p_cfg->fold_bias == 1 ||
+         p_cfg->blocked == 1 || p_cfg->sparse == 1 ||
+         ((p_cfg->sym4s == 1 || p_cfg->sym16s == 1 || p_cfg->workers > 0 ||
+           p_cfg->epilogue == 1 || p_cfg->transposed > 0) && p_cfg->vec_count > 1);
+}
+
+/* Per row requantization of the per channel kernels: the multiplier and
+   shift vary over rows around -out_multiplier and -out_shift */
+static void fill_per_chan_quant(buf1D_t *p_out_multiplier, buf1D_t *p_out_shift,
+    int count, int out_multiplier, int out_shift)
+{
+  int i;
+
+  for(i = 0; i < count; i++)
+  {
+    ((WORD32 *)p_out_multiplier->p)[i] = out_multiplier - (i % 7) * 0x01000000;
+    ((WORD32 *)p_out_shift->p)[i] = out_shift + (i % 3);
+  }
+}
+
+/* Prunes mat1 to the sparse format: the 2 largest magnitudes of each group
+   of 4 columns for 2:4, about a quarter of the column blocks for the block
+   formats */
+static void prune_mat_sparse(buf2D_t *p_mat, int rows, int cols, int format)
+{
+  WORD8 *p = (WORD8 *)p_mat->p;
+  int stride = p_mat->row_offset;
+  int blk_rows = (format == XA_NNLIB_SPARSE_BLOCK_4X4) ? 4 : 1;
+  int r, c, ii, jj;
+
+  for(r = 0; r < rows; r++)
+  {
+    for(c = 0; c < cols; c += 4)
+    {
+      WORD8 *p_grp = p + r * stride + c;
+      int n = (cols - c) < 4 ? (cols - c) : 4;
+      if(format == XA_NNLIB_SPARSE_2_4)
+      {
+        for(ii = 0; ii < n; ii++)
+        {
+          int larger = 0;
+          for(jj = 0; jj < n; jj++)
+          {
+            int a = abs(p_grp[jj]), b = abs(p_grp[ii]);
+            larger += (a > b) || (a == b && jj < ii);
+          }
+          if(larger >= 2)
+            p_grp[ii] = 0;
+        }
+      }
+      else
+      {
+        unsigned int h = (unsigned int)(c / 4) * 2654435761u ^ (unsigned int)(r / blk_rows) * 40503u;
+        if((h >> 29) >= 2)
+          memset(p_grp, 0, n);
+      }
+    }
+  }
+}
+
+/* Reduces mat to the sym4s range -8..7 and packs it two weights per byte */
+static int quantize_mat_sym4s(buf1D_t *p_sym4s, buf2D_t *p_mat, int rows, int cols)
+{
+  WORD8 *p = (WORD8 *)p_mat->p;
+  int r, c;
+
+  for(r = 0; r < rows; r++)
+  {
+    for(c = 0; c < cols; c++)
+    {
+      p[r * p_mat->row_offset + c] >>= 4;
+    }
+  }
+  return xa_nn_pack_weights_sym4s((WORD8 *)p_sym4s->p, p, rows, cols, p_mat->row_offset);
+}
+
+/* Stores mat1 transposed: cols rows of `rows` elements, row_stride apart */
+static void transpose_mat(buf1D_t *p_mat_t, buf2D_t *p_mat, int rows, int cols, int row_stride)
+{
+  int r, c;
+
+  for(r = 0; r < rows; r++)
+  {
+    for(c = 0; c < cols; c++)
+    {
+      if(p_mat->bytes_per_element == 2)
+        ((WORD16 *)p_mat_t->p)[c * row_stride + r] = ((WORD16 *)p_mat->p)[r * p_mat->row_offset + c];
+      else
+        ((WORD8 *)p_mat_t->p)[c * row_stride + r] = ((WORD8 *)p_mat->p)[r * p_mat->row_offset + c];
+    }
+  }
+}
+
+/* Inputs of -batch_count: batch b uses mat1 rows and bias rotated by b
+   and the vectors rotated by 7 * b elements */
+static void fill_batch_inputs(buf1D_t *p_bmm_mat1, buf1D_t *p_bmm_vec1, buf1D_t *p_bmm_bias,
+    buf2D_t *p_mat1, buf1D_t *p_vec1, buf1D_t *p_bias, int rows, int cols, int batch_count)
+{
+  int b, r, i;
+  int mat_size = rows * p_mat1->row_offset;
+  int mat_bytes = p_mat1->row_offset * p_mat1->bytes_per_element;
+  int vec_size = p_vec1->length;
+  int ve = p_vec1->bytes_per_element;
+  int be = p_bias->bytes_per_element;
+
+  for(b = 0; b < batch_count; b++)
+  {
+    char *p_mat_b = (char *)p_bmm_mat1->p + b * mat_size * p_mat1->bytes_per_element;
+    char *p_vec_b = (char *)p_bmm_vec1->p + b * vec_size * ve;
+    char *p_bias_b = (char *)p_bmm_bias->p + b * rows * be;
+
+    for(r = 0; r < rows; r++)
+    {
+      memcpy(p_mat_b + r * mat_bytes, (char *)p_mat1->p + ((r + b) % rows) * mat_bytes, mat_bytes);
+      memcpy(p_bias_b + r * be, (char *)p_bias->p + ((r + b) % rows) * be, be);
+    }
+    for(i = 0; i < vec_size; i++)
+      memcpy(p_vec_b + i * ve, (char *)p_vec1->p + ((i + 7 * b) % vec_size) * ve, ve);
+  }
+}
+
+/* Reference of -sym16s: 64 bit sums and TFLite's int64 requantization */
+static void matmul_sym16s_ref(WORD16 *p_out, const WORD8 *p_mat, const WORD16 *p_vec,
+    const WORD64 *p_bias, int rows, int cols, int row_stride, int vec_count,
+    int vec_zero_bias, const WORD32 *p_out_multiplier, const WORD32 *p_out_shift, int out_zero_bias)
+{
+  int v, r, c;
+  for(v = 0; v < vec_count; v++)
+  {
+    for(r = 0; r < rows; r++)
+    {
+      WORD64 acc = p_bias[r];
+      WORD64 reduced_mult = p_out_multiplier[r] < 0x7FFF0000 ? ((p_out_multiplier[r] + (1 << 15)) >> 16) : 0x7FFF;
+      int total_shift = 15 - p_out_shift[r];
+      WORD64 out;
+      for(c = 0; c < cols; c++)
+        acc += (WORD64)p_mat[r * row_stride + c] * (p_vec[v * cols + c] + vec_zero_bias);
+      out = ((acc * reduced_mult + ((WORD64)1 << (total_shift - 1))) >> total_shift) + out_zero_bias;
+      out = out > 32767 ? 32767 : out < -32768 ? -32768 : out;
+      p_out[v * rows + r] = (WORD16)out;
+    }
+  }
+}
+
+/* Epilogue of -epilogue; the residual add uses fixed quantization parameters */
+static void init_epilogue(xa_nnlib_epilogue_t *p_epilogue, buf1D_t *p_residual, int act_type, int out_zero_bias)
+{
+  int i;
+
+  memset(p_epilogue, 0, sizeof(*p_epilogue));
+  p_epilogue->act_type = act_type;
+  p_epilogue->act_min = out_zero_bias - 16 < -128 ? -128 : out_zero_bias - 16;
+  p_epilogue->act_max = out_zero_bias + 48 > 127 ? 127 : out_zero_bias + 48;
+  if(p_residual)
+  {
+    for(i = 0; i < p_residual->length; i++)
+    {
+      ((WORD8 *)p_residual->p)[i] = (WORD8)(((i * 73 + 17) & 0xff) - 128);
+    }
+    p_epilogue->p_residual = (WORD8 *)p_residual->p;
+    p_epilogue->left_shift = 20;
+    p_epilogue->inp1_left_shift = -1;
+    p_epilogue->inp1_multiplier = 1518500250;
+    p_epilogue->res_zero_bias = 3;
+    p_epilogue->res_left_shift = -2;
+    p_epilogue->res_multiplier = 1431655765;
+    p_epilogue->add_out_zero_bias = -5;
+    p_epilogue->add_out_left_shift = -18;
+    p_epilogue->add_out_multiplier = 1288490189;
+    p_epilogue->add_act_min = -128;
+    p_epilogue->add_act_max = 127;
+  }
+}
+
+/* Unfused reference of the epilogue on the kernel output */
+static int apply_epilogue_ref(buf1D_t *p_out, buf1D_t *p_tmp, const xa_nnlib_epilogue_t *p_epilogue, int out_zero_bias)
+{
+  WORD8 *p = (WORD8 *)p_out->p;
+  int i, act_min = -128, act_max = 127;
+
+  if(p_epilogue->act_type == XA_NNLIB_ACT_RELU)
+  {
+    act_min = out_zero_bias;
+  }
+  else if(p_epilogue->act_type == XA_NNLIB_ACT_CLAMP)
+  {
+    act_min = p_epilogue->act_min;
+    act_max = p_epilogue->act_max;
+  }
+  for(i = 0; i < p_out->length; i++)
+  {
+    p[i] = p[i] < act_min ? act_min : (p[i] > act_max ? act_max : p[i]);
+  }
+
+  if(p_epilogue->p_residual == NULL)
+    return 0;
+
+  memcpy(p_tmp->p, p, p_out->length);
+  return xa_nn_elm_add_asym8sxasym8s_asym8s(p,
+      p_epilogue->add_out_zero_bias, p_epilogue->add_out_left_shift, p_epilogue->add_out_multiplier,
+      p_epilogue->add_act_min, p_epilogue->add_act_max,
+      (WORD8 *)p_tmp->p, -out_zero_bias, p_epilogue->inp1_left_shift, p_epilogue->inp1_multiplier,
+      p_epilogue->p_residual, p_epilogue->res_zero_bias, p_epilogue->res_left_shift, p_epilogue->res_multiplier,
+      p_epilogue->left_shift, p_out->length);
 }
 
 #define MAT_VEC_MUL_FN(MPREC, VPREC, OPREC) \
@@ -235,12 +530,34 @@ void show_usage(void)
 
 #define MAT_VEC_MUL_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
-      XTPWR_PROFILER_START(0);\
-      err = xa_nn_matXvec_sym8sxasym8s_asym8s ( \
-          (WORD8 *) p_out->p, (WORD8 *) p_mat1->p, (WORD8 *) p_mat2->p, (WORD8 *)p_vec1->p, (WORD8 *)p_vec2->p, (WORD32 *)p_bias->p, \
-          cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
-          cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
-      XTPWR_PROFILER_STOP(0);\
+      int i;\
+      for(i = 0; (cfg.bias_shift < 0) && (i < cfg.rows); i++) {\
+        ((WORD32 *)p_bias->p)[i] >>= -cfg.bias_shift;\
+      }\
+      if(cfg.vec_count > 1) {\
+        WORD32 *p_chan_multiplier = (WORD32 *)malloc(sizeof(WORD32)*cfg.rows);\
+        WORD32 *p_chan_shift = (WORD32 *)malloc(sizeof(WORD32)*cfg.rows);\
+        for(i = 0; i < cfg.rows; i++) {\
+          p_chan_multiplier[i] = cfg.out_multiplier;\
+          p_chan_shift[i] = cfg.out_shift;\
+        }\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.vec_offset, cfg.rows, 1, \
+            cfg.inp1_zero_bias, p_chan_multiplier, p_chan_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+        free(p_chan_multiplier);\
+        free(p_chan_shift);\
+      }\
+      else {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+            (WORD8 *) p_out->p, (WORD8 *) p_mat1->p, (WORD8 *) p_mat2->p, (WORD8 *)p_vec1->p, (WORD8 *)p_vec2->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
+            cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
     }
 
 #define MAT_VEC_MUL_FC_FN(MPREC, VPREC, OPREC) \
@@ -396,6 +713,407 @@ void show_usage(void)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_VEC_MUL_PACKED_FN(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      err = xa_nn_pack_weights_8((WORD8 *)p_packed->p, (WORD8 *)p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset);\
+      XTPWR_PROFILER_START(0);\
+      err |= xa_nn_matXvec_8x8_8_packed ( \
+          (WORD8 *)p_out->p, (WORD8 *)p_packed->p, (WORD8 *)p_vec1->p, (WORD8 *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.acc_shift, cfg.bias_shift);\
+      XTPWR_PROFILER_STOP(0);\
+      err |= xa_nn_matXvec_8x8_8 ( \
+          (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, NULL, (WORD8 *)p_vec1->p, NULL, (WORD8 *)p_bias->p, \
+          cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, cfg.acc_shift, cfg.bias_shift);\
+    }
+
+#define MAT_VEC_MUL_PACKED_FN_ASYM8(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      err = xa_nn_pack_weights_asym8u((UWORD8 *)p_packed->p, (UWORD8 *)p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.mat1_zero_bias);\
+      XTPWR_PROFILER_START(0);\
+      err |= xa_nn_matmul_asym8uxasym8u_asym8u_packed ( \
+          (UWORD8 *)p_out->p, (UWORD8 *)p_packed->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+          cfg.mat1_zero_bias, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      XTPWR_PROFILER_STOP(0);\
+      err |= xa_nn_matmul_asym8uxasym8u_asym8u ( \
+          (UWORD8 *)p_out_base->p, (UWORD8 *)p_mat1->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+          cfg.mat1_zero_bias, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+    }
+
+#define MAT_VEC_MUL_PACKED_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      err = xa_nn_pack_weights_8((WORD8 *)p_packed->p, (WORD8 *)p_mat1->p, cfg.rows, cfg.cols1, p_mat1->row_offset);\
+      XTPWR_PROFILER_START(0);\
+      err |= xa_nn_matXvec_sym8sxasym8s_asym8s_packed ( \
+          (WORD8 *)p_out->p, (WORD8 *)p_packed->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      XTPWR_PROFILER_STOP(0);\
+      err |= xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, NULL, (WORD8 *)p_vec1->p, NULL, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, \
+          cfg.inp1_zero_bias, 0, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+    }
+
+#define PROCESS_MATXVEC_PACKED \
+    MAT_VEC_MUL_PACKED_FN(8, 8, 8) \
+    else MAT_VEC_MUL_PACKED_FN_ASYM8(-3, -3, -3) \
+    else MAT_VEC_MUL_PACKED_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define MAT_VEC_MUL_FOLDED_FN_ASYM8(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      err = xa_nn_fold_zero_bias_asym8uxasym8u((WORD32 *)p_folded_bias->p, (UWORD8 *)p_mat1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.mat1_zero_bias, cfg.inp1_zero_bias);\
+      XTPWR_PROFILER_START(0);\
+      if(cfg.vec_count == 1) {\
+        err |= xa_nn_matXvec_asym8uxasym8u_asym8u_folded ( \
+            (UWORD8 *)p_out->p, (UWORD8 *)p_mat1->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_folded_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, \
+            cfg.mat1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+      else {\
+        err |= xa_nn_matmul_asym8uxasym8u_asym8u_folded ( \
+            (UWORD8 *)p_out->p, (UWORD8 *)p_mat1->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_folded_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.mat1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+      XTPWR_PROFILER_STOP(0);\
+      err |= xa_nn_matmul_asym8uxasym8u_asym8u ( \
+          (UWORD8 *)p_out_base->p, (UWORD8 *)p_mat1->p, (UWORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+          cfg.mat1_zero_bias, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+    }
+
+#define MAT_VEC_MUL_BLOCKED_FN(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matmul_8x8_8_blocked ( \
+          (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD8 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.acc_shift, cfg.bias_shift, \
+          cfg.vec_count, cfg.cols1, cfg.rows, 1, &blocking, p_blocked_scratch->p);\
+      XTPWR_PROFILER_STOP(0);\
+      err |= xa_nn_matmul_8x8_8 ( \
+          (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD8 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.acc_shift, cfg.bias_shift, \
+          cfg.vec_count, cfg.cols1, cfg.rows, 1);\
+    }
+
+#define MAT_VEC_MUL_BLOCKED_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_blocked ( \
+          (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+          cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias, \
+          &blocking, p_blocked_scratch->p);\
+      XTPWR_PROFILER_STOP(0);\
+      err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+          cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+    }
+
+#define MAT_VEC_MUL_SPARSE_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      prune_mat_sparse(p_mat1, cfg.rows, cfg.cols1, cfg.sparse_format);\
+      p_sparse = create_buf1D(xa_nn_get_sparse_weights_size_8((WORD8 *)p_mat1->p, cfg.rows, cfg.cols1, \
+          p_mat1->row_offset, cfg.sparse_format, cfg.sparse_index), 8);                                  VALIDATE_PTR(p_sparse);\
+      err = xa_nn_pack_sparse_weights_8(p_sparse->p, (WORD8 *)p_mat1->p, cfg.rows, cfg.cols1, \
+          p_mat1->row_offset, cfg.sparse_format, cfg.sparse_index);\
+      XTPWR_PROFILER_START(0);\
+      if(cfg.fc == 1) {\
+        err |= xa_nn_fully_connected_sym8sxasym8s_asym8s_sparse ( \
+            (WORD8 *)p_out->p, p_sparse->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+      else {\
+        err |= xa_nn_matXvec_sym8sxasym8s_asym8s_sparse ( \
+            (WORD8 *)p_out->p, p_sparse->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+      XTPWR_PROFILER_STOP(0);\
+      free_buf1D(p_sparse);\
+      err |= xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, NULL, (WORD8 *)p_vec1->p, NULL, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, \
+          cfg.inp1_zero_bias, 0, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+    }
+
+#define MAT_VEC_MUL_SYM4S_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      err = quantize_mat_sym4s(p_sym4s_mat1, p_mat1, cfg.rows, cfg.cols1);\
+      if(cfg.fc == 1) {\
+        XTPWR_PROFILER_START(0);\
+        err |= xa_nn_fully_connected_per_chan_sym4sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_sym4s_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.cols1, cfg.rows, cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      else if(cfg.vec_count > 1) {\
+        XTPWR_PROFILER_START(0);\
+        err |= xa_nn_matmul_per_chan_sym4sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_sym4s_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, (cfg.cols1 + 1) & ~1, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      else {\
+        err |= quantize_mat_sym4s(p_sym4s_mat2, p_mat2, cfg.rows, cfg.cols2);\
+        XTPWR_PROFILER_START(0);\
+        err |= xa_nn_matXvec_sym4sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_sym4s_mat1->p, (WORD8 *)p_sym4s_mat2->p, (WORD8 *)p_vec1->p, (WORD8 *)p_vec2->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, cfg.cols2, (cfg.cols1 + 1) & ~1, (cfg.cols2 + 1) & ~1, \
+            cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+      }\
+      if(cfg.fc == 1 || cfg.vec_count > 1) {\
+        err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+      }\
+      else {\
+        err |= xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_mat2->p, (WORD8 *)p_vec1->p, (WORD8 *)p_vec2->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset, \
+            cfg.inp1_zero_bias, cfg.inp2_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+    }
+
+#define MAT_VEC_MUL_PARALLEL_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      if(cfg.vec_count > 1) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_parallel ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias, \
+            cfg.split, &workers, p_parallel_scratch ? p_parallel_scratch->p : NULL);\
+        XTPWR_PROFILER_STOP(0);\
+        err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+      }\
+      else {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matXvec_sym8sxasym8s_asym8s_parallel ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, \
+            cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+            cfg.split, &workers, p_parallel_scratch ? p_parallel_scratch->p : NULL);\
+        XTPWR_PROFILER_STOP(0);\
+        err |= xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, NULL, (WORD8 *)p_vec1->p, NULL, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, \
+            cfg.inp1_zero_bias, 0, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+    }
+
+#define MAT_VEC_MUL_EPILOGUE_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      if(cfg.vec_count > 1) {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s_epilogue ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias, \
+            &epilogue);\
+        XTPWR_PROFILER_STOP(0);\
+        err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+      }\
+      else {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matXvec_sym8sxasym8s_asym8s_epilogue ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, \
+            cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, &epilogue);\
+        XTPWR_PROFILER_STOP(0);\
+        err |= xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, NULL, (WORD8 *)p_vec1->p, NULL, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, \
+            cfg.inp1_zero_bias, 0, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+      err |= apply_epilogue_ref(p_out_base, p_epilogue_tmp, &epilogue, cfg.out_zero_bias);\
+    }
+
+/* The matmul_16x16_16 / 8x16_16 reference is the matXvec per vector */
+#define MAT_VEC_MUL_TRANSPOSED_FN(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      transpose_mat(p_mat1_t, p_mat1, cfg.rows, cfg.cols1, t_row_stride);\
+      XTPWR_PROFILER_START(0);\
+      if(cfg.transposed == 2) {\
+        err = xa_nn_matmul_nt_##MPREC##x##VPREC##_##OPREC ( \
+            (WORD##OPREC *)p_out->p, (WORD##MPREC *)p_mat1->p, (WORD##VPREC *)p_vec1->p, (WORD16 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.acc_shift, cfg.bias_shift, \
+            cfg.vec_count, cfg.cols1, cfg.rows, 1);\
+      }\
+      else if(cfg.vec_count > 1) {\
+        err = xa_nn_matmul_tn_##MPREC##x##VPREC##_##OPREC ( \
+            (WORD##OPREC *)p_out->p, (WORD##MPREC *)p_mat1_t->p, (WORD##VPREC *)p_vec1->p, (WORD16 *)p_bias->p, \
+            cfg.rows, cfg.cols1, t_row_stride, cfg.acc_shift, cfg.bias_shift, \
+            cfg.vec_count, cfg.cols1, cfg.rows, 1);\
+      }\
+      else {\
+        err = xa_nn_matXvec_t_##MPREC##x##VPREC##_##OPREC ( \
+            (WORD##OPREC *)p_out->p, (WORD##MPREC *)p_mat1_t->p, (WORD##VPREC *)p_vec1->p, (WORD16 *)p_bias->p, \
+            cfg.rows, cfg.cols1, t_row_stride, cfg.acc_shift, cfg.bias_shift);\
+      }\
+      XTPWR_PROFILER_STOP(0);\
+      for(i = 0; i < cfg.vec_count; i++) {\
+        err |= xa_nn_matXvec_##MPREC##x##VPREC##_##OPREC ( \
+            (WORD##OPREC *)p_out_base->p + i * cfg.rows, (WORD##MPREC *)p_mat1->p, NULL, (WORD##VPREC *)p_vec1->p + i * cfg.cols1, NULL, (WORD16 *)p_bias->p, \
+            cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, cfg.acc_shift, cfg.bias_shift);\
+      }\
+    }
+
+#define MAT_VEC_MUL_TRANSPOSED_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      transpose_mat(p_mat1_t, p_mat1, cfg.rows, cfg.cols1, t_row_stride);\
+      if(cfg.vec_count > 1) {\
+        XTPWR_PROFILER_START(0);\
+        if(cfg.transposed == 2) {\
+          err = xa_nn_matmul_nt_per_chan_sym8sxasym8s_asym8s ( \
+              (WORD8 *)p_out->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+              cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+              cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+        }\
+        else {\
+          err = xa_nn_matmul_tn_per_chan_sym8sxasym8s_asym8s ( \
+              (WORD8 *)p_out->p, (WORD8 *)p_mat1_t->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+              cfg.rows, cfg.cols1, t_row_stride, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+              cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+        }\
+        XTPWR_PROFILER_STOP(0);\
+        err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+      }\
+      else {\
+        XTPWR_PROFILER_START(0);\
+        err = xa_nn_matXvec_t_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out->p, (WORD8 *)p_mat1_t->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, t_row_stride, \
+            cfg.inp1_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+        XTPWR_PROFILER_STOP(0);\
+        err |= xa_nn_matXvec_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p, (WORD8 *)p_mat1->p, NULL, (WORD8 *)p_vec1->p, NULL, (WORD32 *)p_bias->p, \
+            cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, \
+            cfg.inp1_zero_bias, 0, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      }\
+    }
+
+/* The reference is the base kernel per batch: the per channel matmul, or
+   the 16x16 matXvec per vector */
+#define MAT_VEC_MUL_BATCH_MATMUL_FN_16X16(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_batch_matmul_16x16_16 ( \
+          (WORD16 *)p_out->p, (WORD16 *)p_bmm_mat1->p, (WORD16 *)p_bmm_vec1->p, (WORD16 *)p_bmm_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.acc_shift, cfg.bias_shift, \
+          cfg.vec_count, cfg.cols1, cfg.rows, 1, &batch_desc);\
+      XTPWR_PROFILER_STOP(0);\
+      for(j = 0; j < cfg.batch_count; j++) {\
+        for(i = 0; i < cfg.vec_count; i++) {\
+          err |= xa_nn_matXvec_16x16_16 ( \
+              (WORD16 *)p_out_base->p + j * batch_desc.out_batch_stride + i * cfg.rows, \
+              (WORD16 *)p_bmm_mat1->p + j * batch_desc.mat1_batch_stride, NULL, \
+              (WORD16 *)p_bmm_vec1->p + j * batch_desc.vec1_batch_stride + i * cfg.cols1, NULL, \
+              (WORD16 *)p_bmm_bias->p + j * batch_desc.chan_batch_stride, \
+              cfg.rows, cfg.cols1, 0, p_mat1->row_offset, 0, cfg.acc_shift, cfg.bias_shift);\
+        }\
+      }\
+    }
+
+#define MAT_VEC_MUL_BATCH_MATMUL_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_batch_matmul_per_chan_sym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *)p_bmm_mat1->p, (WORD8 *)p_bmm_vec1->p, (WORD32 *)p_bmm_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+          cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias, &batch_desc);\
+      XTPWR_PROFILER_STOP(0);\
+      for(j = 0; j < cfg.batch_count; j++) {\
+        err |= xa_nn_matmul_per_chan_sym8sxasym8s_asym8s ( \
+            (WORD8 *)p_out_base->p + j * batch_desc.out_batch_stride, \
+            (WORD8 *)p_bmm_mat1->p + j * batch_desc.mat1_batch_stride, \
+            (WORD8 *)p_bmm_vec1->p + j * batch_desc.vec1_batch_stride, \
+            (WORD32 *)p_bmm_bias->p + j * batch_desc.chan_batch_stride, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p + j * batch_desc.chan_batch_stride, \
+            (WORD32 *)p_out_shift->p + j * batch_desc.chan_batch_stride, cfg.out_zero_bias);\
+      }\
+    }
+
+#define PROCESS_MATXVEC_BATCH_MATMUL \
+    MAT_VEC_MUL_BATCH_MATMUL_FN_16X16(16, 16, 16) \
+    else MAT_VEC_MUL_BATCH_MATMUL_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define MAT_VEC_MUL_SYM16S_FN_SYM8SXASYM16S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      for(i = 0; i < cfg.rows; i++) {\
+        ((WORD64 *)p_bias64->p)[i] = (cfg.bias_precision == 16) ? \
+            ((WORD64)((WORD16 *)p_bias->p)[i] << cfg.bias_shift) : ((WORD64)((WORD32 *)p_bias->p)[i] << cfg.bias_shift);\
+      }\
+      XTPWR_PROFILER_START(0);\
+      if(cfg.fc == 1) {\
+        err = xa_nn_fully_connected_per_chan_sym8sxasym16s_asym16s ( \
+            (WORD16 *)p_out->p, (WORD8 *)p_mat1->p, (WORD16 *)p_vec1->p, (WORD64 *)p_bias64->p, \
+            cfg.cols1, cfg.rows, cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+      }\
+      else {\
+        err = xa_nn_matmul_per_chan_sym8sxasym16s_asym16s ( \
+            (WORD16 *)p_out->p, (WORD8 *)p_mat1->p, (WORD16 *)p_vec1->p, (WORD64 *)p_bias64->p, \
+            cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, cfg.cols1, cfg.rows, 1, \
+            cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+      }\
+      XTPWR_PROFILER_STOP(0);\
+      matmul_sym16s_ref((WORD16 *)p_out_base->p, (WORD8 *)p_mat1->p, (WORD16 *)p_vec1->p, (WORD64 *)p_bias64->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, cfg.vec_count, \
+          cfg.inp1_zero_bias, (WORD32 *)p_out_multiplier->p, (WORD32 *)p_out_shift->p, cfg.out_zero_bias);\
+    }
+
+#define PROCESS_MATXVEC_SYM16S \
+    MAT_VEC_MUL_SYM16S_FN_SYM8SXASYM16S(-5, 16, 16) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_TRANSPOSED \
+    MAT_VEC_MUL_TRANSPOSED_FN(16, 16, 16) \
+    else MAT_VEC_MUL_TRANSPOSED_FN(8, 16, 16) \
+    else MAT_VEC_MUL_TRANSPOSED_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_EPILOGUE \
+    MAT_VEC_MUL_EPILOGUE_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_PARALLEL \
+    MAT_VEC_MUL_PARALLEL_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_SYM4S \
+    MAT_VEC_MUL_SYM4S_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_SPARSE \
+    MAT_VEC_MUL_SPARSE_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_BLOCKED \
+    MAT_VEC_MUL_BLOCKED_FN(8, 8, 8) \
+    else MAT_VEC_MUL_BLOCKED_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
+#define PROCESS_MATXVEC_FOLDED \
+    MAT_VEC_MUL_FOLDED_FN_ASYM8(-3, -3, -3) \
+    else {  printf("unsupported multiplication\n"); return -1;} 
+
 #if HIFI_VFPU 
 #define PROCESS_MATXVEC \
     MAT_VEC_MUL_ACTIVATION_FN(16, 16, 16, sigmoid) \
@@ -481,7 +1199,7 @@ int xa_nn_main_process(int argc, char *argv[])
 
   int frame;
   int err = 0;
-  //int i;
+  int i, j;
   int pass_count=0;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
@@ -495,8 +1213,33 @@ int xa_nn_main_process(int argc, char *argv[])
   buf1D_t *p_bias;
   buf1D_t *p_out;
   buf1D_t *p_scratch;
+  buf1D_t *p_packed = NULL;
+  buf1D_t *p_out_base = NULL;
+  buf1D_t *p_folded_bias = NULL;
+  buf1D_t *p_blocked_scratch = NULL;
+  buf1D_t *p_out_multiplier = NULL;
+  buf1D_t *p_out_shift = NULL;
+  buf1D_t *p_sparse = NULL;
+  buf1D_t *p_sym4s_mat1 = NULL;
+  buf1D_t *p_sym4s_mat2 = NULL;
+  buf1D_t *p_parallel_scratch = NULL;
+  xa_nnlib_workers_t workers;
+  buf1D_t *p_residual = NULL;
+  buf1D_t *p_epilogue_tmp = NULL;
+  xa_nnlib_epilogue_t epilogue;
+  buf1D_t *p_mat1_t = NULL;
+  int t_row_stride = 0;
+  buf1D_t *p_bmm_mat1 = NULL;
+  buf1D_t *p_bmm_vec1 = NULL;
+  buf1D_t *p_bmm_bias = NULL;
+  xa_nnlib_batch_desc_t batch_desc;
+  int out_batches;
+  buf1D_t *p_bias64 = NULL;
+  xa_nnlib_cache_desc_t cache_desc;
+  xa_nnlib_gemm_blocking_t blocking;
   buf1D_t *ptr_ref;
   int scratch_size = 0;
+  int parallel_scratch_size = 0;
 
   FILE *fptr_inp;
   FILE *fptr_out;
@@ -525,6 +1268,8 @@ int xa_nn_main_process(int argc, char *argv[])
     cfg.row_stride1 = cfg.cols1;
     cfg.row_stride2 = cfg.cols2;
   }
+  if(cfg.vec_offset <= 0)
+    cfg.vec_offset = cfg.cols1;
 
   // Set profiler name 
   if((cfg.mat_precision == -1) || (cfg.inp_precision == -1) || (cfg.out_precision == -1))
@@ -557,7 +1302,7 @@ int xa_nn_main_process(int argc, char *argv[])
       sprintf(profiler_name,"fully_connected_sym8sxasym8s_asym8s");
     }
     else{
-      sprintf(profiler_name,"matXvec%s_sym8sxasym8s_asym8s",(cfg.batch)? "_batch": "");
+      sprintf(profiler_name,"%s_sym8sxasym8s_asym8s",(cfg.batch)? "matXvec_batch": (cfg.vec_count > 1)? "matmul_per_chan": "matXvec");
     }
   }
   else
@@ -573,9 +1318,97 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     sprintf(profiler_name,"%s_%s",profiler_name,cfg.activation);
   }
+  if(cfg.packed == 1)
+  {
+    /* Single matrix kernels on pre-packed mat1; the asym8 one is the matmul */
+    if(cfg.mat_precision == -3)
+    {
+      sprintf(profiler_name,"matmul_asym8xasym8_asym8_packed");
+    }
+    else
+    {
+      sprintf(profiler_name,"%s_packed",profiler_name);
+    }
+  }
+  if(cfg.fold_bias == 1)
+  {
+    sprintf(profiler_name,"%s_asym8xasym8_asym8_folded",(cfg.vec_count == 1)? "matXvec": "matmul");
+  }
+  if(cfg.blocked == 1)
+  {
+    if(cfg.mat_precision == -5)
+    {
+      sprintf(profiler_name,"matmul_per_chan_sym8sxasym8s_asym8s_blocked");
+    }
+    else
+    {
+      sprintf(profiler_name,"matmul_%dx%d_%d_blocked",cfg.mat_precision, cfg.inp_precision, cfg.out_precision);
+    }
+  }
+  if(cfg.sparse == 1)
+  {
+    sprintf(profiler_name,"%s_sparse_%s%s",profiler_name,
+        (cfg.sparse_format == XA_NNLIB_SPARSE_2_4) ? "2_4" : (cfg.sparse_format == XA_NNLIB_SPARSE_BLOCK_1X4) ? "1x4" : "4x4",
+        (cfg.sparse_format == XA_NNLIB_SPARSE_2_4) ? "" : (cfg.sparse_index == XA_NNLIB_SPARSE_INDEX_CSR) ? "_csr" : "_bitmask");
+  }
+  if(cfg.sym4s == 1)
+  {
+    if(cfg.fc == 1)
+    {
+      sprintf(profiler_name,"fully_connected_per_chan_sym4sxasym8s_asym8s");
+    }
+    else if(cfg.vec_count > 1)
+    {
+      sprintf(profiler_name,"matmul_per_chan_sym4sxasym8s_asym8s");
+    }
+    else
+    {
+      sprintf(profiler_name,"matXvec_sym4sxasym8s_asym8s");
+    }
+  }
+  if(cfg.workers > 0)
+  {
+    sprintf(profiler_name,"%s_parallel_%s",(cfg.vec_count > 1)? "matmul_per_chan_sym8sxasym8s_asym8s": "matXvec_sym8sxasym8s_asym8s",
+        (cfg.split == XA_NNLIB_SPLIT_K)? "k": "rows");
+  }
+  if(cfg.epilogue == 1)
+  {
+    sprintf(profiler_name,"%s_epilogue%s%s",(cfg.vec_count > 1)? "matmul_per_chan_sym8sxasym8s_asym8s": "matXvec_sym8sxasym8s_asym8s",
+        (cfg.epilogue_act == XA_NNLIB_ACT_RELU)? "_relu": (cfg.epilogue_act == XA_NNLIB_ACT_CLAMP)? "_clamp": "",
+        (cfg.residual)? "_residual": "");
+  }
+  if(cfg.transposed > 0)
+  {
+    if(cfg.mat_precision == -5)
+    {
+      sprintf(profiler_name,"%s_sym8sxasym8s_asym8s",
+          (cfg.transposed == 2)? "matmul_nt_per_chan": (cfg.vec_count > 1)? "matmul_tn_per_chan": "matXvec_t");
+    }
+    else
+    {
+      sprintf(profiler_name,"%s_%dx%d_%d",
+          (cfg.transposed == 2)? "matmul_nt": (cfg.vec_count > 1)? "matmul_tn": "matXvec_t",
+          cfg.mat_precision, cfg.inp_precision, cfg.out_precision);
+    }
+  }
+  if(cfg.batch_count > 0)
+  {
+    if(cfg.mat_precision == -5)
+      sprintf(profiler_name,"batch_matmul_per_chan_sym8sxasym8s_asym8s");
+    else
+      sprintf(profiler_name,"batch_matmul_%dx%d_%d", cfg.mat_precision, cfg.inp_precision, cfg.out_precision);
+  }
+  if(cfg.sym16s == 1)
+  {
+    sprintf(profiler_name,"%s_per_chan_sym8sxasym16s_asym16s",(cfg.fc == 1)? "fully_connected": "matmul");
+  }
   
   // Set profiler parameters
-  if(cfg.batch == 1){
+  if(cfg.batch_count > 0){
+    sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, vec_count=%d, batch_count=%d", 
+      cfg.rows, cfg.cols1, cfg.bias_precision, cfg.vec_count, cfg.batch_count);
+  }
+  else if(is_matmul_variant(&cfg)){
     sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, vec_count=%d", 
       cfg.rows, cfg.cols1, cfg.bias_precision,cfg.vec_count);
   }
@@ -603,8 +1436,11 @@ int xa_nn_main_process(int argc, char *argv[])
   // Open output file
   fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
-  // Open reference file if verify flag is enabled
-  if(cfg.verify)
+  // Open reference file if verify flag is enabled; packed, folded bias,
+  // blocked, sparse, sym4s, parallel, epilogue, transposed and batched
+  // matmul kernels are verified against the base kernel on the same data,
+  // sym16s ones against a scalar reference
+  if(cfg.verify && is_base_variant(&cfg))
   {
     ptr_ref =  create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision); 
     
@@ -616,17 +1452,117 @@ int xa_nn_main_process(int argc, char *argv[])
 
   // Allocate Memory
   p_mat1 = create_buf2D(cfg.rows, cfg.cols1, cfg.row_stride1, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat1);
-  p_vec1 = create_buf1D(cfg.cols1*cfg.vec_count, cfg.inp_precision);                                      VALIDATE_PTR(p_vec1);
+  p_vec1 = create_buf1D(cfg.vec_offset*cfg.vec_count, cfg.inp_precision);                                 VALIDATE_PTR(p_vec1);
   p_mat2 = create_buf2D(cfg.rows, cfg.cols2, cfg.row_stride2, cfg.mat_precision, cfg.membank_padding);    VALIDATE_PTR(p_mat2);
   p_vec2 = create_buf1D(cfg.cols2, cfg.inp_precision);                                                    VALIDATE_PTR(p_vec2);
   p_bias = create_buf1D(cfg.rows, cfg.bias_precision);                                                    VALIDATE_PTR(p_bias);
-  p_out = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                                        VALIDATE_PTR(p_out);
+  out_batches = (cfg.batch_count > 0) ? cfg.batch_count : 1;
+  p_out = create_buf1D(cfg.rows*cfg.vec_count*out_batches, cfg.out_precision);                            VALIDATE_PTR(p_out);
   p_scratch = create_buf1D(scratch_size, 8);                                                              VALIDATE_PTR(p_scratch);
+  if(cfg.packed == 1){
+    p_packed = create_buf1D(xa_nn_get_packed_weights_size_8(cfg.rows, cfg.cols1), 8);                    VALIDATE_PTR(p_packed);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+  }
+  if(cfg.fold_bias == 1){
+    p_folded_bias = create_buf1D(cfg.rows, 32);                                                          VALIDATE_PTR(p_folded_bias);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+  }
+  if(cfg.blocked == 1){
+    cache_desc.l1_size = cfg.l1_size;
+    cache_desc.l2_size = cfg.l2_size;
+    if(xa_nn_matmul_get_blocking(&blocking, cfg.l1_size ? &cache_desc : NULL, cfg.rows, cfg.cols1, cfg.vec_count))
+    {
+      printf("%s: invalid cache descriptor\n", profiler_name);
+      return -1;
+    }
+    fprintf(stdout, "\nBlocking: mc=%d nc=%d kc=%d\n", blocking.mc, blocking.nc, blocking.kc);
+    p_blocked_scratch = create_buf1D(xa_nn_matmul_blocked_getsize(&blocking), 8);                       VALIDATE_PTR(p_blocked_scratch);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+    p_out_multiplier = create_buf1D(cfg.rows, 32);                                                      VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows, 32);                                                           VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows, cfg.out_multiplier, cfg.out_shift);
+  }
+  if(cfg.sparse == 1){
+    p_out_base = create_buf1D(cfg.rows, cfg.out_precision);                                            VALIDATE_PTR(p_out_base);
+  }
+  if(cfg.sym4s == 1){
+    p_sym4s_mat1 = create_buf1D(cfg.rows * ((cfg.cols1 + 1) / 2), 8);                                  VALIDATE_PTR(p_sym4s_mat1);
+    p_sym4s_mat2 = create_buf1D(cfg.rows * ((cfg.cols2 + 1) / 2), 8);                                  VALIDATE_PTR(p_sym4s_mat2);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+    p_out_multiplier = create_buf1D(cfg.rows, 32);                                                      VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows, 32);                                                           VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows, cfg.out_multiplier, cfg.out_shift);
+  }
+  if(cfg.workers > 0){
+    xt_workers_init(&workers, cfg.workers);
+    parallel_scratch_size = xa_nn_matmul_parallel_getsize(cfg.rows, cfg.vec_count, cfg.split, workers.num_workers);
+    if(parallel_scratch_size < 0)
+    {
+      printf("%s: invalid split\n", profiler_name);
+      return -1;
+    }
+    fprintf(stdout, "\nWorkers: %d, parallel scratch size: %d bytes\n", workers.num_workers, parallel_scratch_size);
+    if(parallel_scratch_size > 0){
+      p_parallel_scratch = create_buf1D(parallel_scratch_size, 8);                                      VALIDATE_PTR(p_parallel_scratch);
+    }
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+    p_out_multiplier = create_buf1D(cfg.rows, 32);                                                      VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows, 32);                                                           VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows, cfg.out_multiplier, cfg.out_shift);
+  }
+
+  if(cfg.epilogue == 1){
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+    p_epilogue_tmp = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                         VALIDATE_PTR(p_epilogue_tmp);
+    if(cfg.residual){
+      p_residual = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                           VALIDATE_PTR(p_residual);
+    }
+    init_epilogue(&epilogue, p_residual, cfg.epilogue_act, cfg.out_zero_bias);
+    p_out_multiplier = create_buf1D(cfg.rows, 32);                                                      VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows, 32);                                                           VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows, cfg.out_multiplier, cfg.out_shift);
+  }
+
+  if(cfg.transposed > 0){
+    /* Rows padded to a multiple of 4 elements */
+    t_row_stride = (cfg.rows + 3) & ~3;
+    p_mat1_t = create_buf1D(cfg.cols1 * t_row_stride, cfg.mat_precision);                           VALIDATE_PTR(p_mat1_t);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+    p_out_multiplier = create_buf1D(cfg.rows, 32);                                                      VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows, 32);                                                           VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows, cfg.out_multiplier, cfg.out_shift);
+  }
+
+  if(cfg.batch_count > 0){
+    batch_desc.batch_count = cfg.batch_count;
+    batch_desc.mat1_batch_stride = cfg.rows * p_mat1->row_offset;
+    batch_desc.vec1_batch_stride = cfg.cols1 * cfg.vec_count;
+    batch_desc.out_batch_stride = cfg.rows * cfg.vec_count;
+    batch_desc.chan_batch_stride = cfg.batch_chan ? cfg.rows : 0;
+    p_bmm_mat1 = create_buf1D(cfg.batch_count * batch_desc.mat1_batch_stride, cfg.mat_precision);     VALIDATE_PTR(p_bmm_mat1);
+    p_bmm_vec1 = create_buf1D(cfg.batch_count * batch_desc.vec1_batch_stride, cfg.inp_precision);     VALIDATE_PTR(p_bmm_vec1);
+    p_bmm_bias = create_buf1D(cfg.batch_count * cfg.rows, cfg.bias_precision);                        VALIDATE_PTR(p_bmm_bias);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count*cfg.batch_count, cfg.out_precision);            VALIDATE_PTR(p_out_base);
+    p_out_multiplier = create_buf1D(cfg.rows*cfg.batch_count, 32);                                    VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows*cfg.batch_count, 32);                                         VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows*cfg.batch_count, cfg.out_multiplier, cfg.out_shift);
+  }
+
+  if(cfg.sym16s == 1){
+    p_bias64 = create_buf1D(cfg.rows, 64);                                                              VALIDATE_PTR(p_bias64);
+    p_out_base = create_buf1D(cfg.rows*cfg.vec_count, cfg.out_precision);                             VALIDATE_PTR(p_out_base);
+    p_out_multiplier = create_buf1D(cfg.rows, 32);                                                      VALIDATE_PTR(p_out_multiplier);
+    p_out_shift = create_buf1D(cfg.rows, 32);                                                           VALIDATE_PTR(p_out_shift);
+    fill_per_chan_quant(p_out_multiplier, p_out_shift, cfg.rows, cfg.out_multiplier, cfg.out_shift);
+  }
 
   if(cfg.inp_precision == cfg.out_precision && (!strcmp(cfg.activation, "sigmoid") || !strcmp(cfg.activation, "tanh"))){
     fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
   }
-  if(cfg.batch == 1){
+  if(cfg.batch_count > 0){
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1 * cfg.vec_count * cfg.batch_count), "MACs/cyc", 1);
+  }
+  else if(is_matmul_variant(&cfg)){
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1 * cfg.vec_count), "MACs/cyc", 1);
   }
   else if(cfg.fc == 1){
@@ -642,11 +1578,43 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     // If write_file enabled, generate random data for input, else read from file
     load_matXvec_input_data(cfg.write_file, fptr_inp, p_mat1, p_vec1, p_mat2, p_vec2, p_bias);
+    if(cfg.batch_count > 0)
+      fill_batch_inputs(p_bmm_mat1, p_bmm_vec1, p_bmm_bias, p_mat1, p_vec1, p_bias, cfg.rows, cfg.cols1, cfg.batch_count);
 
     // Call the matXvec kernel specified on command line
     if(cfg.batch == 1){
         PROCESS_MATXVEC_BATCH;
     }
+    else if(cfg.packed == 1){
+        PROCESS_MATXVEC_PACKED;
+    }
+    else if(cfg.fold_bias == 1){
+        PROCESS_MATXVEC_FOLDED;
+    }
+    else if(cfg.blocked == 1){
+        PROCESS_MATXVEC_BLOCKED;
+    }
+    else if(cfg.sparse == 1){
+        PROCESS_MATXVEC_SPARSE;
+    }
+    else if(cfg.sym4s == 1){
+        PROCESS_MATXVEC_SYM4S;
+    }
+    else if(cfg.workers > 0){
+        PROCESS_MATXVEC_PARALLEL;
+    }
+    else if(cfg.epilogue == 1){
+        PROCESS_MATXVEC_EPILOGUE;
+    }
+    else if(cfg.transposed > 0){
+        PROCESS_MATXVEC_TRANSPOSED;
+    }
+    else if(cfg.batch_count > 0){
+        PROCESS_MATXVEC_BATCH_MATMUL;
+    }
+    else if(cfg.sym16s == 1){
+        PROCESS_MATXVEC_SYM16S;
+    }
     else if(cfg.fc == 1){
         PROCESS_MATXVEC_FC;
     }
@@ -669,7 +1637,11 @@ int xa_nn_main_process(int argc, char *argv[])
     write_buf1D_to_file(fptr_out, p_out);
 
     // If verify flag enabled, compare output against reference
-    if(cfg.verify)
+    if(cfg.verify && !is_base_variant(&cfg))
+    {
+      pass_count += compare_buf1D(p_out_base, p_out, cfg.verify, cfg.out_precision, 1);
+    }
+    else if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, ptr_ref);
       pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
@@ -694,8 +1666,77 @@ int xa_nn_main_process(int argc, char *argv[])
   free_buf1D(p_bias);
   free_buf1D(p_out);
   free_buf1D(p_scratch);
+  if(cfg.packed == 1)
+  {
+    free_buf1D(p_packed);
+    free_buf1D(p_out_base);
+  }
+  if(cfg.fold_bias == 1)
+  {
+    free_buf1D(p_folded_bias);
+    free_buf1D(p_out_base);
+  }
+  if(cfg.blocked == 1)
+  {
+    free_buf1D(p_blocked_scratch);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
+  if(cfg.sparse == 1)
+  {
+    free_buf1D(p_out_base);
+  }
+  if(cfg.sym4s == 1)
+  {
+    free_buf1D(p_sym4s_mat1);
+    free_buf1D(p_sym4s_mat2);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
+  if(cfg.workers > 0)
+  {
+    if(p_parallel_scratch)
+      free_buf1D(p_parallel_scratch);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
+  if(cfg.epilogue == 1)
+  {
+    if(p_residual)
+      free_buf1D(p_residual);
+    free_buf1D(p_epilogue_tmp);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
+  if(cfg.transposed > 0)
+  {
+    free_buf1D(p_mat1_t);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
+  if(cfg.batch_count > 0)
+  {
+    free_buf1D(p_bmm_mat1);
+    free_buf1D(p_bmm_vec1);
+    free_buf1D(p_bmm_bias);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
+  if(cfg.sym16s == 1)
+  {
+    free_buf1D(p_bias64);
+    free_buf1D(p_out_base);
+    free_buf1D(p_out_multiplier);
+    free_buf1D(p_out_shift);
+  }
 
-  if(cfg.verify)
+  if(cfg.verify && is_base_variant(&cfg))
   {
     fclose(fptr_ref);
     free_buf1D(ptr_ref);
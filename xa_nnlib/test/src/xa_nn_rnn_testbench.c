@@ -0,0 +1,946 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#define FILE_IO
+#define PROF_ALLOCATE
+#define INT16_MAX_ERR 0
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "xa_type_def.h"
+#include "xa_nnlib_rnn_api.h"
+#include "cmdline_parser.h"
+#include "xt_profiler.h"
+#ifdef hifi4
+#define XA_PAD_BYTES    8
+#endif
+
+#ifdef hifi5
+#define XA_PAD_BYTES    16
+#endif
+
+#define XA_MAX_FILE_PATH_LENGTH 200
+#define XA_MAX_FILE_NAME_LENGTH  80
+#define XA_MAX_FULL_FILE_NAME_LENGTH (XA_MAX_FILE_PATH_LENGTH + XA_MAX_FILE_NAME_LENGTH)
+#define XA_MAX_ARGS 30
+#define PARAMFILE "paramfilesimple_rnn.txt"
+
+char pb_input_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
+char pb_output_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
+
+#define CHECK_PTR(ptr, context) \
+  if(NULL == ptr) {printf("%s: Failed\n", context); return -1;}
+
+#define CHECK_PTR_RETURN_NULL(ptr, context) \
+  if(NULL == ptr) {printf("%s: Failed\n", context); return NULL;}
+
+#define PRINT_VAR(var)  // printf("%d: %s = %d\n", __LINE__, #var, (int) var); fflush(stdout); fflush(stderr);
+#define PRINT_PTR(ptr)  // printf("%d: %s = %p\n", __LINE__, #ptr, (void *) ptr); fflush(stdout); fflush(stderr);
+#define PRINT_STR(str)  // printf("%d: %s\n", __LINE__, str); fflush(stdout); fflush(stderr);
+
+#define FILL_SHAPE_MATRIX(shape, rows_shape, cols_shape)  \
+{                                                         \
+  shape.shape_type = SHAPE_MATRIX_T;                      \
+  shape.dim.matrix.rows = rows_shape;                     \
+  shape.dim.matrix.cols = cols_shape;                     \
+  shape.dim.matrix.row_offset = cols_shape;               \
+  shape.n_shapes = 1;                                     \
+  shape.shape_offset = -1;                                \
+}
+
+#define FILL_SHAPE_VECTOR(shape, length_shape)  \
+{                                               \
+  shape.shape_type = SHAPE_VECTOR_T;            \
+  shape.dim.vector.length = length_shape;       \
+  shape.n_shapes = 1;                           \
+  shape.shape_offset = -1;                      \
+}
+
+/* Coefficients of one layer; every layer of the stack and both directions
+   are given the same lstm/gru coefficients, so in_feats of the layers after
+   the first (directions x out_feats) must match the stored matrices */
+typedef struct _rnn_coef_t
+{
+  union
+  {
+    xa_nnlib_lstm_weights_t lstm;
+    xa_nnlib_gru_weights_t gru;
+  } weights;
+  union
+  {
+    xa_nnlib_lstm_biases_t lstm;
+    xa_nnlib_gru_biases_t gru;
+  } biases;
+  void *buffers[12];
+  int n_buffers;
+} rnn_coef_t;
+
+const char *lstm_coef_files[12] =
+{
+  "/w_xf.bin",
+  "/w_hf.bin",
+  "/w_xi.bin",
+  "/w_hi.bin",
+  "/w_xc.bin",
+  "/w_hc.bin",
+  "/w_xo.bin",
+  "/w_ho.bin",
+  "/b_f.bin",
+  "/b_i.bin",
+  "/b_c.bin",
+  "/b_o.bin"
+};
+
+const char *gru_coef_files[9] =
+{
+  "/w_z.bin",
+  "/u_z.bin",
+  "/w_r.bin",
+  "/u_r.bin",
+  "/w_h.bin",
+  "/u_h.bin",
+  "/b_z.bin",
+  "/b_r.bin",
+  "/b_h.bin"
+};
+
+void show_usage(void)
+{
+  printf("xt-run <binary> [Options]\n");
+  printf("--cell:        \t Recurrent cell (Default=lstm)                \t  Supported values: lstm, gru\n");
+  printf("--n_layers:    \t Number of stacked layers (Default=1)         \t  Range: 1-4\n");
+  printf("--bidirectional:\t Backward cell per layer (Default=0)          \t  Supported values: 0, 1\n");
+  printf("--in_feats:    \t Input length (Default=256)                   \t  Range: 4-2048 NOTE:-Input length must be multiple of 4\n");
+  printf("--out_feats:   \t Output length (Default=256)                  \t  Range: 4-2048 NOTE:-Output length must be multiple of 4\n");
+  printf("--window:      \t Frames per process call (Default=5)          \t  Range: 1-256\n");
+  printf("--membank_padding:\t Memory bank padding (Default=1)           \t  Must be 0 or 1\n");
+  printf("--mat_prec:    \t Coefficient precision (Default=16)           \t  Must be 8 or 16\n");
+  printf("--vec_prec:    \t Input precision (Default=16)                 \t  Must be 16\n");
+  printf("--verify:      \t Verify output against single layer processing (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--input_file:  \t File containing input frames\n");
+  printf("--filter_path: \t Path where file containing filter are stored\n");
+  printf("--output_file: \t File to which output will be written\n");
+  printf("--h/-help:     \t Prints help\n");
+}
+
+void *read_coef(char *filter_path, const char *file, int bytes, int in_size, int out_size, int pad)
+{
+  char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  char *buffer;
+  FILE *fptr;
+  int i;
+
+  strcpy(file_name, filter_path);
+  strcat(file_name, file);
+  fptr = fopen(file_name, "rb");
+  CHECK_PTR_RETURN_NULL(fptr, file_name);
+
+  buffer = malloc((size_t)(in_size + pad) * out_size * bytes);
+  if(NULL == buffer)
+  {
+    fclose(fptr);
+    return NULL;
+  }
+
+  for(i = 0; i < out_size; i++)
+  {
+    if(fread(buffer + i * (in_size + pad) * bytes, bytes, (size_t)in_size, fptr) != (size_t)in_size)
+    {
+      printf("File %s has insufficent data\n", file_name);
+      fclose(fptr);
+      free(buffer);
+      return NULL;
+    }
+  }
+  fclose(fptr);
+
+  return buffer;
+}
+
+void free_coef(rnn_coef_t *coef)
+{
+  int i;
+  for(i = 0; i < coef->n_buffers; i++)
+  {
+    free(coef->buffers[i]);
+  }
+  coef->n_buffers = 0;
+}
+
+#define LOAD_MATRIX(coef, files, idx, member, rows, cols, bytes, pad)                              \
+{                                                                                                   \
+  coef->buffers[idx] = read_coef(filter_path, files[idx], bytes, cols, rows, pad);                  \
+  if(NULL == coef->buffers[idx]) { free_coef(coef); return -1; }                                    \
+  coef->n_buffers = idx + 1;                                                                        \
+  member = coef->buffers[idx];                                                                      \
+}
+
+#define LOAD_LSTM_WEIGHTS(coef, w, in_feats, out_feats, bytes, pad)                                \
+{                                                                                                   \
+  LOAD_MATRIX(coef, lstm_coef_files, 0, w.w_xf, out_feats, in_feats , bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 1, w.w_hf, out_feats, out_feats, bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 2, w.w_xi, out_feats, in_feats , bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 3, w.w_hi, out_feats, out_feats, bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 4, w.w_xc, out_feats, in_feats , bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 5, w.w_hc, out_feats, out_feats, bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 6, w.w_xo, out_feats, in_feats , bytes, pad)                  \
+  LOAD_MATRIX(coef, lstm_coef_files, 7, w.w_ho, out_feats, out_feats, bytes, pad)                  \
+  FILL_SHAPE_MATRIX(w.shape_w_xf, out_feats, in_feats)                                              \
+  FILL_SHAPE_MATRIX(w.shape_w_hf, out_feats, out_feats)                                             \
+  FILL_SHAPE_MATRIX(w.shape_w_xi, out_feats, in_feats)                                              \
+  FILL_SHAPE_MATRIX(w.shape_w_hi, out_feats, out_feats)                                             \
+  FILL_SHAPE_MATRIX(w.shape_w_xc, out_feats, in_feats)                                              \
+  FILL_SHAPE_MATRIX(w.shape_w_hc, out_feats, out_feats)                                             \
+  FILL_SHAPE_MATRIX(w.shape_w_xo, out_feats, in_feats)                                              \
+  FILL_SHAPE_MATRIX(w.shape_w_ho, out_feats, out_feats)                                             \
+}
+
+#define LOAD_GRU_WEIGHTS(coef, w, in_feats, out_feats, bytes, pad)                                 \
+{                                                                                                   \
+  LOAD_MATRIX(coef, gru_coef_files, 0, w.w_z, out_feats, in_feats , bytes, pad)                    \
+  LOAD_MATRIX(coef, gru_coef_files, 1, w.u_z, out_feats, out_feats, bytes, pad)                    \
+  LOAD_MATRIX(coef, gru_coef_files, 2, w.w_r, out_feats, in_feats , bytes, pad)                    \
+  LOAD_MATRIX(coef, gru_coef_files, 3, w.u_r, out_feats, out_feats, bytes, pad)                    \
+  LOAD_MATRIX(coef, gru_coef_files, 4, w.w_h, out_feats, in_feats , bytes, pad)                    \
+  LOAD_MATRIX(coef, gru_coef_files, 5, w.u_h, out_feats, out_feats, bytes, pad)                    \
+  FILL_SHAPE_MATRIX(w.shape_w_z, out_feats, in_feats)                                               \
+  FILL_SHAPE_MATRIX(w.shape_u_z, out_feats, out_feats)                                              \
+  FILL_SHAPE_MATRIX(w.shape_w_r, out_feats, in_feats)                                               \
+  FILL_SHAPE_MATRIX(w.shape_u_r, out_feats, out_feats)                                              \
+  FILL_SHAPE_MATRIX(w.shape_w_h, out_feats, in_feats)                                               \
+  FILL_SHAPE_MATRIX(w.shape_u_h, out_feats, out_feats)                                              \
+}
+
+int setup_coef(rnn_coef_t *coef, xa_nnlib_rnn_cell_t cell, int mat_prec,
+               int in_feats, int out_feats, int pad_flag, char *filter_path)
+{
+  int pad = XA_PAD_BYTES*pad_flag;  //Width of mem bank for HiFi4/5
+  int bytes = (mat_prec == 8) ? sizeof(coeff8_t) : sizeof(coeff_t);
+
+  coef->n_buffers = 0;
+
+  if(cell == XA_NNLIB_RNN_CELL_LSTM)
+  {
+    if(mat_prec == 8)
+      LOAD_LSTM_WEIGHTS(coef, coef->weights.lstm.weights8, in_feats, out_feats, bytes, pad)
+    else
+      LOAD_LSTM_WEIGHTS(coef, coef->weights.lstm.weights16, in_feats, out_feats, bytes, pad)
+
+    LOAD_MATRIX(coef, lstm_coef_files,  8, coef->biases.lstm.b_f, 1, out_feats, sizeof(coeff_t), 0)
+    LOAD_MATRIX(coef, lstm_coef_files,  9, coef->biases.lstm.b_i, 1, out_feats, sizeof(coeff_t), 0)
+    LOAD_MATRIX(coef, lstm_coef_files, 10, coef->biases.lstm.b_c, 1, out_feats, sizeof(coeff_t), 0)
+    LOAD_MATRIX(coef, lstm_coef_files, 11, coef->biases.lstm.b_o, 1, out_feats, sizeof(coeff_t), 0)
+    FILL_SHAPE_VECTOR(coef->biases.lstm.shape_b_f, out_feats)
+    FILL_SHAPE_VECTOR(coef->biases.lstm.shape_b_i, out_feats)
+    FILL_SHAPE_VECTOR(coef->biases.lstm.shape_b_c, out_feats)
+    FILL_SHAPE_VECTOR(coef->biases.lstm.shape_b_o, out_feats)
+  }
+  else
+  {
+    if(mat_prec == 8)
+      LOAD_GRU_WEIGHTS(coef, coef->weights.gru.weights8, in_feats, out_feats, bytes, pad)
+    else
+      LOAD_GRU_WEIGHTS(coef, coef->weights.gru.weights16, in_feats, out_feats, bytes, pad)
+
+    LOAD_MATRIX(coef, gru_coef_files, 6, coef->biases.gru.b_z, 1, out_feats, sizeof(coeff_t), 0)
+    LOAD_MATRIX(coef, gru_coef_files, 7, coef->biases.gru.b_r, 1, out_feats, sizeof(coeff_t), 0)
+    LOAD_MATRIX(coef, gru_coef_files, 8, coef->biases.gru.b_h, 1, out_feats, sizeof(coeff_t), 0)
+    FILL_SHAPE_VECTOR(coef->biases.gru.shape_b_z, out_feats)
+    FILL_SHAPE_VECTOR(coef->biases.gru.shape_b_r, out_feats)
+    FILL_SHAPE_VECTOR(coef->biases.gru.shape_b_h, out_feats)
+  }
+
+  return 0;
+}
+
+int set_cell_coef(xa_nnlib_handle_t cell_handle, xa_nnlib_rnn_cell_t cell, rnn_coef_t *coef)
+{
+  int err;
+
+  if(cell == XA_NNLIB_RNN_CELL_LSTM)
+  {
+    err = xa_nnlib_lstm_set_config(cell_handle, XA_NNLIB_LSTM_WEIGHT, &coef->weights.lstm);
+    if(err == XA_NNLIB_NO_ERROR)
+      err = xa_nnlib_lstm_set_config(cell_handle, XA_NNLIB_LSTM_BIAS, &coef->biases.lstm);
+  }
+  else
+  {
+    err = xa_nnlib_gru_set_config(cell_handle, XA_NNLIB_GRU_WEIGHT, &coef->weights.gru);
+    if(err == XA_NNLIB_NO_ERROR)
+      err = xa_nnlib_gru_set_config(cell_handle, XA_NNLIB_GRU_BIAS, &coef->biases.gru);
+  }
+
+  return err;
+}
+
+#ifdef VERIFY
+#define ABS(A) (((A) < 0) ? -(A):(A))
+
+int compare(vect_t *p_dut, vect_t *p_ref, int len)
+{
+  int j, err, max_err = 0;
+
+  for(j=0;j<len;j++)
+  {
+    err = ABS(p_ref[j] - p_dut[j]);
+    if(err > max_err)
+    {
+      max_err = err;
+    }
+  }
+  printf("Max error found wrt the reference = %d\n", max_err);
+  if(max_err > INT16_MAX_ERR) return -1;
+  return 0;
+}
+
+/* Reference: the layers of the stack as separate lstm/gru handles, one
+   frame per call, each layer output copied into the input of the next */
+int rnn_reference(xa_nnlib_rnn_init_config_t *config,
+                  rnn_coef_t *coef,
+                  vect_t *p_input,
+                  vect_t *p_ref,
+                  int frames)
+{
+  int n_dirs = config->bidirectional + 1;
+  int l, d, t, err = 0;
+  vect_t *layer_in, *layer_out;
+  int in_len, out_len;
+
+  layer_in = malloc(frames * config->layer[0].lstm.in_feats * sizeof(vect_t));
+  CHECK_PTR(layer_in, "Allocation for reference input");
+  memcpy(layer_in, p_input, frames * config->layer[0].lstm.in_feats * sizeof(vect_t));
+
+  for(l = 0; l < config->n_layers && !err; l++)
+  {
+    if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+    {
+      in_len = config->layer[l].lstm.in_feats;
+      out_len = config->layer[l].lstm.out_feats;
+    }
+    else
+    {
+      in_len = config->layer[l].gru.in_feats;
+      out_len = config->layer[l].gru.out_feats;
+    }
+
+    layer_out = malloc(frames * n_dirs * out_len * sizeof(vect_t));
+    CHECK_PTR(layer_out, "Allocation for reference output");
+
+    for(d = 0; d < n_dirs && !err; d++)
+    {
+      xa_nnlib_handle_t handle;
+      void *scratch;
+      vect_t *frame_out;
+      int persistent_size, scratch_size;
+
+      if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+      {
+        persistent_size = xa_nnlib_lstm_get_persistent_fast(&config->layer[l].lstm);
+        scratch_size = xa_nnlib_lstm_get_scratch_fast(&config->layer[l].lstm);
+      }
+      else
+      {
+        persistent_size = xa_nnlib_gru_get_persistent_fast(&config->layer[l].gru);
+        scratch_size = xa_nnlib_gru_get_scratch_fast(&config->layer[l].gru);
+      }
+      handle = malloc(persistent_size);
+      scratch = malloc(scratch_size);
+      frame_out = malloc(out_len * sizeof(vect_t));
+      CHECK_PTR(handle, "Allocation for reference handle");
+      CHECK_PTR(scratch, "Allocation for reference scratch");
+      CHECK_PTR(frame_out, "Allocation for reference frame");
+
+      if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+        err = xa_nnlib_lstm_init(handle, &config->layer[l].lstm);
+      else
+        err = xa_nnlib_gru_init(handle, &config->layer[l].gru);
+      if(!err)
+        err = set_cell_coef(handle, config->cell, coef);
+
+      for(t = 0; t < frames && !err; t++)
+      {
+        xa_nnlib_shape_t in_shape, out_shape;
+        int frame = (d == 0) ? t : frames - 1 - t;
+
+        FILL_SHAPE_VECTOR(in_shape, in_len)
+        FILL_SHAPE_VECTOR(out_shape, out_len)
+
+        if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+        {
+          err = xa_nnlib_lstm_process(handle, scratch, layer_in + frame * in_len, frame_out, &in_shape, &out_shape);
+        }
+        else
+        {
+          err = xa_nnlib_gru_process(handle, scratch, layer_in + frame * in_len, frame_out, &in_shape, &out_shape);
+          if(!err)
+            err = xa_nnlib_gru_set_config(handle, XA_NNLIB_GRU_RESTORE_CONTEXT, frame_out);
+        }
+
+        memcpy(layer_out + (frame * n_dirs + d) * out_len, frame_out, out_len * sizeof(vect_t));
+      }
+
+      free(frame_out);
+      free(scratch);
+      free(handle);
+    }
+
+    free(layer_in);
+    layer_in = layer_out;
+  }
+
+  if(!err)
+    memcpy(p_ref, layer_in, frames * n_dirs * out_len * sizeof(vect_t));
+  free(layer_in);
+
+  return err;
+}
+#endif
+
+typedef struct _rnn_args_t
+{
+  char cell[XA_MAX_FILE_NAME_LENGTH];
+  int n_layers;
+  int bidirectional;
+  int in_feats;
+  int out_feats;
+  int window;
+  int pad;
+  int mat_prec;
+  int vec_prec;
+} rnn_args_t;
+
+int default_config(rnn_args_t *args,
+                    int *verify_flag,
+                    char *input_file_name,
+                    char *filter_path,
+                    char *output_file_name)
+{
+  if(args)
+  {
+    strcpy(args->cell, "lstm");
+    args->n_layers = 1;
+    args->bidirectional = 0;
+    args->in_feats = 256;
+    args->out_feats = 256;
+    args->window = 5;
+    args->pad = 1;
+    args->mat_prec = 16;
+    args->vec_prec = 16;
+    *verify_flag=1;
+    input_file_name[0] = '\0';
+    filter_path[0] = '\0';
+    output_file_name[0] = '\0';
+    return 0;
+  }
+  else
+  {
+    return -1;
+  }
+}
+
+void parse_arguments(int argc, char** argv,
+                      rnn_args_t *args,
+                      int *show_help,
+                      int *verify_flag,
+                      char *input_file_name,
+                      char *filter_path,
+                      char *output_file_name)
+{
+  int argidx;
+  for (argidx=1;argidx<argc;argidx++)
+  {
+    if(strncmp((argv[argidx]), "-", 1) != 0)
+    {
+      printf("Invalid argument: %s\n",argv[argidx]);
+      exit(1);
+    }
+    ARGTYPE_INDICATE("--h",*show_help);
+    ARGTYPE_INDICATE("-help",*show_help);
+    ARGTYPE_STRING("--cell", args->cell, XA_MAX_FILE_NAME_LENGTH);
+    ARGTYPE_ONETIME_CONFIG("--n_layers",args->n_layers);
+    ARGTYPE_ONETIME_CONFIG("--bidirectional",args->bidirectional);
+    ARGTYPE_ONETIME_CONFIG("--in_feats",args->in_feats);
+    ARGTYPE_ONETIME_CONFIG("--out_feats",args->out_feats);
+    ARGTYPE_ONETIME_CONFIG("--window",args->window);
+    ARGTYPE_ONETIME_CONFIG("--membank_padding",args->pad);
+    ARGTYPE_ONETIME_CONFIG("--mat_prec",args->mat_prec);
+    ARGTYPE_ONETIME_CONFIG("--vec_prec",args->vec_prec);
+    ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
+    ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
+    ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
+    ARGTYPE_STRING("--output_file", output_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
+
+    // If arg doesnt match with any of the above supported options, report option as invalid
+    printf("Invalid argument: %s\n",argv[argidx]);
+    exit(1);
+  }
+}
+
+/* One lstm/gru configuration per layer, layers after the first take the
+   outputs of all directions of the previous layer */
+int fill_config(xa_nnlib_rnn_init_config_t *config, rnn_args_t *args)
+{
+  int l;
+
+  memset(config, 0, sizeof(xa_nnlib_rnn_init_config_t));
+
+  if(strcmp(args->cell, "lstm") == 0)
+    config->cell = XA_NNLIB_RNN_CELL_LSTM;
+  else if(strcmp(args->cell, "gru") == 0)
+    config->cell = XA_NNLIB_RNN_CELL_GRU;
+  else
+    return -1;
+
+  if(args->vec_prec != 16 || (args->mat_prec != 8 && args->mat_prec != 16))
+    return -1;
+
+  config->n_layers = args->n_layers;
+  config->bidirectional = args->bidirectional;
+  config->window = args->window;
+
+  for(l = 0; l < args->n_layers && l < XA_NNLIB_RNN_MAX_LAYERS; l++)
+  {
+    int in_feats = (l == 0) ? args->in_feats : (args->bidirectional + 1) * args->out_feats;
+
+    if(config->cell == XA_NNLIB_RNN_CELL_LSTM)
+    {
+      xa_nnlib_lstm_init_config_t *lstm = &config->layer[l].lstm;
+      lstm->in_feats = in_feats;
+      lstm->out_feats = args->out_feats;
+      lstm->pad = args->pad;
+      lstm->mat_prec = args->mat_prec;
+      lstm->vec_prec = args->vec_prec;
+      lstm->precision = (args->mat_prec == 8) ? XA_NNLIB_LSTM_8bx16b : XA_NNLIB_LSTM_16bx16b;
+      lstm->coeff_Qformat = (args->mat_prec == 8) ? 7 : 15;
+      lstm->cell_Qformat = 25;
+      lstm->io_Qformat = 12;
+      lstm->batch = 1;
+    }
+    else
+    {
+      xa_nnlib_gru_init_config_t *gru = &config->layer[l].gru;
+      gru->in_feats = in_feats;
+      gru->out_feats = args->out_feats;
+      gru->pad = args->pad;
+      gru->mat_prec = args->mat_prec;
+      gru->vec_prec = args->vec_prec;
+      gru->precision = (args->mat_prec == 8) ? XA_NNLIB_GRU_8bx16b : XA_NNLIB_GRU_16bx16b;
+      gru->coeff_Qformat = (args->mat_prec == 8) ? 7 : 15;
+      gru->io_Qformat = 12;
+      gru->batch = 1;
+    }
+  }
+
+  return 0;
+}
+
+ /****************************************************************************/
+ /*                                   MAIN                                   */
+ /****************************************************************************/
+
+int xa_nn_main_process(int argc, char *argv[])
+{
+  int l, d;
+  int err=0;
+  rnn_args_t args;
+  xa_nnlib_rnn_init_config_t config;
+  char profiler_name[MAX_PROFILER_NAME_LENGTH];
+  char profiler_params[MAX_PROFILER_PARAMS_LENGTH];
+  rnn_coef_t coef;
+  xa_nnlib_handle_t rnn_handle;
+  void *p_scratch;
+  FILE *input_file;
+  FILE *output_file;
+  vect_t *p_input;
+  vect_t *p_output;
+  xa_nnlib_shape_t input_shape;
+  xa_nnlib_shape_t output_shape;
+  char input_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  char filter_path[XA_MAX_FILE_PATH_LENGTH];
+  char output_file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+  int show_help = 0;
+  int verify_pass = 1;
+  int frames;
+  int verify_flag;
+#ifdef VERIFY
+  vect_t *output_ref;
+#endif
+
+  /* Set default configurations */
+  if(default_config(&args,
+                    &verify_flag,
+                    input_file_name,
+                    filter_path,
+                    output_file_name))
+  {
+    return -1;
+  }
+
+  /* Library name version etc print */
+  fprintf(stderr, "\n--------------------------------------------------------\n");
+  fprintf(stderr, "%s library version %s\n",
+          xa_nnlib_get_lib_name_string(),
+          xa_nnlib_get_lib_version_string());
+  fprintf(stderr, "API version: %s\n", xa_nnlib_get_lib_api_version_string());
+  fprintf(stderr, "Cadence Design Systems, Inc. http://www.cadence.com\n");
+  fprintf(stderr, "\n");
+
+  /* Parse command line options */
+  if(argc>1)
+  {
+    parse_arguments(argc, argv,
+                    &args,
+                    &show_help,
+                    &verify_flag,
+                    input_file_name,
+                    filter_path,
+                    output_file_name);
+    if(show_help)
+    {
+      show_usage();
+      return 0;
+    }
+  }
+
+  if(fill_config(&config, &args))
+  {
+    fprintf(stderr, "Unsupported cell %s or precision %dx%d\n", args.cell, args.mat_prec, args.vec_prec);
+    return -1;
+  }
+
+  fprintf(stdout, "Use Case:\nRNN_%s_%dx%d: Layers: %d, Bidirectional: %d, In Feats: %d, Out Feats: %d, Window: %d\n",
+          args.cell, args.mat_prec, args.vec_prec, args.n_layers, args.bidirectional,
+          args.in_feats, args.out_feats, args.window);
+  PRINT_STR("Init Loop ");
+  {
+    int persistent_size;
+    int scratch_size;
+
+    /* Get persistent and scratch sizes and allocate them */
+    persistent_size = xa_nnlib_rnn_get_persistent_fast(&config);  PRINT_VAR(persistent_size)
+    if(persistent_size < 0)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", persistent_size);
+      return persistent_size;
+    }
+    scratch_size = xa_nnlib_rnn_get_scratch_fast(&config);   PRINT_VAR(scratch_size)
+    if(scratch_size < 0)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", scratch_size);
+      return scratch_size;
+    }
+
+    rnn_handle = (xa_nnlib_handle_t)malloc(persistent_size); PRINT_PTR(rnn_handle)
+    p_scratch  = malloc(scratch_size);    PRINT_PTR(p_scratch)
+    CHECK_PTR(rnn_handle, "Allocation for rnn_handle");
+    CHECK_PTR(p_scratch, "Allocation for p_scratch");
+
+    fprintf(stdout, "\nPersistent(fast) size: %8d bytes\n", persistent_size);
+    fprintf(stdout, "Scratch(fast) size:    %8d bytes\n", scratch_size);
+    /* Initialize RNN Layer with configurations */
+    err = xa_nnlib_rnn_init(rnn_handle, &config);
+
+    if(XA_NNLIB_NO_ERROR != err)
+    {
+      fprintf(stderr, "Invalid Config, failed with error code: 0x%x \n", err);
+      return err;
+    }
+  }
+
+  /* Set weights and biases of every cell */
+  PRINT_STR("Setup Filter and Biases ");
+  if(setup_coef(&coef, config.cell, args.mat_prec, args.in_feats, args.out_feats, args.pad, filter_path))
+  {
+    fprintf(stderr, "Reading coefficients from %s failed\n", filter_path);
+    return -1;
+  }
+
+  for(l = 0; l < config.n_layers; l++)
+  {
+    for(d = 0; d <= config.bidirectional; d++)
+    {
+      xa_nnlib_rnn_layer_handle_t layer;
+      layer.layer = l;
+      layer.direction = d;
+
+      err = xa_nnlib_rnn_get_config(rnn_handle, XA_NNLIB_RNN_LAYER_HANDLE, &layer);
+      if(XA_NNLIB_NO_ERROR == err)
+        err = set_cell_coef(layer.handle, config.cell, &coef);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Setting coefficients of layer %d failed with error code: 0x%x \n", l, err);
+        return err;
+      }
+    }
+  }
+
+  xa_nnlib_rnn_get_config(rnn_handle, XA_NNLIB_RNN_INPUT_SHAPE, &input_shape);PRINT_VAR(input_shape.dim.vector.length);
+  xa_nnlib_rnn_get_config(rnn_handle, XA_NNLIB_RNN_OUTPUT_SHAPE, &output_shape);PRINT_VAR(output_shape.dim.vector.length);
+
+  PRINT_STR("RNN Process")
+  {
+    char file_name[XA_MAX_FULL_FILE_NAME_LENGTH];
+    Int32 input_buffer_size, output_buffer_size;
+
+    strcpy(file_name, pb_input_file_path);
+    strcat(file_name, input_file_name);
+    input_file  = fopen(file_name,"rb");
+    CHECK_PTR(input_file, "Allocation for input_file");
+
+    strcpy(file_name, pb_output_file_path);
+    strcat(file_name, output_file_name);
+    output_file = fopen(file_name,"wb");
+    CHECK_PTR(output_file, "Allocation for output_file");
+
+    /* Allocate input and output buffer for a window */
+    input_buffer_size = input_shape.n_shapes * input_shape.dim.vector.length * sizeof(vect_t);
+    p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
+    CHECK_PTR(p_input, "Allocation for p_input");
+
+    output_buffer_size = output_shape.n_shapes * output_shape.dim.vector.length * sizeof(vect_t);
+    p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
+    CHECK_PTR(p_output, "Allocation for p_output");
+
+    fprintf(stdout, "Input size:            %8d bytes\n", input_buffer_size);
+    fprintf(stdout, "Output size:           %8d bytes\n\n", output_buffer_size);
+
+    frames = fread(p_input, input_shape.dim.vector.length * sizeof(vect_t), input_shape.n_shapes, input_file);
+    if(frames < 1)
+    {
+      printf("File end / partial frame \n");
+      return -1;
+    }
+#ifdef VERIFY
+    if(verify_flag)
+    {
+      output_ref = malloc(output_buffer_size);
+      CHECK_PTR(output_ref, "Allocation for output_ref");
+
+      err = rnn_reference(&config, &coef, p_input, output_ref, frames);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Reference failed with error code: 0x%x \n", err);
+        return err;
+      }
+    }
+#endif // VERIFY
+
+    // Set profiler name
+    sprintf(profiler_name, "rnn_%s_%dx%d", args.cell, args.mat_prec, args.vec_prec);
+
+    // Set profiler parameters
+    sprintf(profiler_params, "in_feats=%d, out_feats=%d, layers=%d", args.in_feats, args.out_feats, args.n_layers);
+    if(args.bidirectional)
+    {
+      sprintf(profiler_params + strlen(profiler_params), ", bidirectional=1");
+    }
+
+    XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, frames * output_shape.dim.vector.length * config.n_layers, NULL, 0);
+
+    {
+      xa_nnlib_shape_t output_length;
+      xa_nnlib_shape_t input_length;
+      output_length.dim.vector.length = output_shape.dim.vector.length;
+      output_length.shape_type = output_shape.shape_type;
+      output_length.n_shapes = frames;
+      output_length.shape_offset = -1;
+      input_length.dim.vector.length = input_shape.dim.vector.length;
+      input_length.shape_type = input_shape.shape_type;
+      input_length.n_shapes = frames;
+      input_length.shape_offset = -1;
+
+      XTPWR_PROFILER_START(0);
+      // Process the window
+      err = xa_nnlib_rnn_process(
+                rnn_handle,
+                p_scratch,
+                p_input,
+                p_output,
+                &input_length,
+                &output_length);
+      XTPWR_PROFILER_STOP(0);
+
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        fprintf(stderr, "Runtime Error, failed with error code: 0x%x \n", err);
+        return err;
+      }
+
+      // Write output frames
+      fwrite(p_output, sizeof(vect_t), output_length.n_shapes * output_length.dim.vector.length, output_file);
+
+#ifdef VERIFY
+      if(verify_flag)
+      {
+        if(XA_NNLIB_NO_ERROR != compare(p_output, output_ref, output_length.n_shapes * output_length.dim.vector.length))
+        {
+          verify_pass = 0;
+        }
+      }
+#endif
+    }
+
+    XTPWR_PROFILER_UPDATE(0);
+    XTPWR_PROFILER_PRINT(0);
+
+    PRINT_STR("RNN Process ended")
+    XTPWR_PROFILER_CLOSE(0, verify_pass);
+#ifdef VERIFY
+    if(verify_flag)
+    {
+      free(output_ref);
+    }
+#endif
+    fclose(output_file);
+    fclose(input_file);
+
+    free(p_output);
+    free(p_input);
+  }
+
+  free_coef(&coef);
+  free(p_scratch);
+  free(rnn_handle);
+
+  return 0;
+}
+
+int main (int argc, char *argv[])
+{
+    FILE *param_file_id;
+    int err_code = 0;
+
+    WORD8 curr_cmd[XA_MAX_ARGS * XA_MAX_FULL_FILE_NAME_LENGTH];
+    WORD32 fargc, curpos;
+    WORD32 processcmd = 0;
+
+    char fargv[XA_MAX_ARGS][XA_MAX_FULL_FILE_NAME_LENGTH];
+
+    char *pargv[XA_MAX_ARGS+1];
+
+    if(argc == 1)
+    {
+        param_file_id = fopen(PARAMFILE, "r");
+        if (param_file_id == NULL)
+        {
+            err_code = -1;
+            printf("Error opening Parameter file for reading %s\n",PARAMFILE);
+            exit(1);
+        }
+
+        /* Process one line at a time */
+        while(fgets((char *)curr_cmd, XA_MAX_ARGS * XA_MAX_FULL_FILE_NAME_LENGTH, param_file_id))
+        {
+            curpos = 0;
+            fargc = 0;
+            /* if it is not a param_file command and if */
+            /* CLP processing is not enabled */
+            if(curr_cmd[0] != '@' && !processcmd)
+            {   /* skip it */
+                continue;
+            }
+
+            while(sscanf((const char *)curr_cmd + curpos, "%s", fargv[fargc]) != EOF)
+            {
+                if(fargv[0][0]=='/' && fargv[0][1]=='/')
+                    break;
+                if(strcmp(fargv[0], "@echo") == 0)
+                    break;
+                if(strcmp(fargv[fargc], "@New_line") == 0)
+                {
+                    fgets((char *)curr_cmd + curpos, XA_MAX_FULL_FILE_NAME_LENGTH, param_file_id);
+                    continue;
+                }
+                curpos += strlen(fargv[fargc]);
+                while(*(curr_cmd + curpos)==' ' || *(curr_cmd + curpos)=='\t')
+                    curpos++;
+                fargc++;
+            }
+
+            if(fargc < 1)   /* for blank lines etc. */
+                continue;
+
+            if(strcmp(fargv[0], "@Output_path") == 0)
+            {
+                if(fargc > 1) strcpy((char *)pb_output_file_path, fargv[1]);
+                else strcpy((char *)pb_output_file_path, "");
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Input_path") == 0)
+            {
+                if(fargc > 1) strcpy((char *)pb_input_file_path, fargv[1]);
+                else strcpy((char *)pb_input_file_path, "");
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Start") == 0)
+            {
+                processcmd = 1;
+                continue;
+            }
+
+            if(strcmp(fargv[0], "@Stop") == 0)
+            {
+                processcmd = 0;
+                continue;
+            }
+
+            /* otherwise if this a normal command and its enabled for execution */
+            if(processcmd)
+            {
+                int i;
+
+                pargv[0] = argv[0];
+                for(i = 0; i < fargc; i++)
+                {
+                    fprintf(stdout, "%s ", fargv[i]);
+                    pargv[i+1] = fargv[i];
+                }
+
+                fprintf(stdout, "\n");
+
+                if(err_code == 0)
+                    xa_nn_main_process(fargc+1, pargv);
+
+            }
+        }
+    }
+    else
+    {
+        int i;
+
+        for(i = 1; i < argc; i++)
+        {
+            fprintf(stdout, "%s ", argv[i]);
+
+        }
+
+        fprintf(stdout, "\n");
+
+        if(err_code == 0)
+            xa_nn_main_process(argc, argv);
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright (c) 2018-2020 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <stdio.h>
+#include "xt_workers.h"
+
+#if !defined(__XTENSA__)
+#include <pthread.h>
+
+typedef struct _xt_worker_arg_t
+{
+  xa_nnlib_task_fn_t fn;
+  void *p_task;
+  int first;
+  int num_tasks;
+  int step;
+} xt_worker_arg_t;
+
+static void *xt_worker_main(void *p_arg)
+{
+  xt_worker_arg_t *p = (xt_worker_arg_t *)p_arg;
+  int task;
+
+  for(task = p->first; task < p->num_tasks; task += p->step)
+    p->fn(p->p_task, task);
+  return NULL;
+}
+
+/* Task i goes to worker i % num_workers; worker 0 is the calling thread,
+   which also runs the tasks of the workers whose thread failed to start */
+static WORD32 xt_workers_run(void *p_ctx, xa_nnlib_task_fn_t fn, void *p_task, WORD32 num_tasks)
+{
+  int num_workers = (int)(size_t)p_ctx;
+  pthread_t threads[XA_NNLIB_MAX_WORKERS];
+  xt_worker_arg_t args[XA_NNLIB_MAX_WORKERS];
+  int ii, started;
+
+  if(num_workers > num_tasks)
+    num_workers = num_tasks;
+
+  for(ii = 0; ii < num_workers; ii++)
+  {
+    args[ii].fn = fn;
+    args[ii].p_task = p_task;
+    args[ii].first = ii;
+    args[ii].num_tasks = num_tasks;
+    args[ii].step = num_workers;
+  }
+
+  for(started = 1; started < num_workers; started++)
+  {
+    if(pthread_create(&threads[started], NULL, xt_worker_main, &args[started]) != 0)
+      break;
+  }
+  xt_worker_main(&args[0]);
+  for(ii = started; ii < num_workers; ii++)
+    xt_worker_main(&args[ii]);
+  for(ii = 1; ii < started; ii++)
+    pthread_join(threads[ii], NULL);
+
+  return 0;
+}
+#else
+static WORD32 xt_workers_run(void *p_ctx, xa_nnlib_task_fn_t fn, void *p_task, WORD32 num_tasks)
+{
+  int task;
+
+  (void)p_ctx;
+  for(task = 0; task < num_tasks; task++)
+    fn(p_task, task);
+  return 0;
+}
+#endif
+
+void xt_workers_init(xa_nnlib_workers_t *p_workers, int num_workers)
+{
+  if(num_workers < 1)
+    num_workers = 1;
+  if(num_workers > XA_NNLIB_MAX_WORKERS)
+    num_workers = XA_NNLIB_MAX_WORKERS;
+
+  p_workers->num_workers = num_workers;
+  p_workers->run = xt_workers_run;
+  p_workers->p_ctx = (void *)(size_t)num_workers;
+}